@@ -34,6 +34,7 @@ PACKAGES+=" kmod" # needed for pcn-iptables, when using lsmod to unload conntrac
 PACKAGES+=" jq bash-completion" # needed for polycubectl bash autocompletion
 PACKAGES+=" libpcre3-dev" # needed for libyang
 PACKAGES+=" libpcap-dev" # needed for packetcapture filter
+PACKAGES+=" zlib1g-dev" # needed for packetcapture dump compression
 
   
 
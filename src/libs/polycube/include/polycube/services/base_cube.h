@@ -80,6 +80,13 @@ class BaseCube {
       const std::string &table_name, int index = 0,
       ProgramType type = ProgramType::INGRESS);
 
+  // page_cnt is the size in pages of the buffer of each cpu, a power of 2
+  PerfBuffer get_perf_buffer(const std::string &table_name,
+                             PerfBuffer::data_cb data,
+                             PerfBuffer::lost_cb lost = nullptr,
+                             int page_cnt = 64, int index = 0,
+                             ProgramType type = ProgramType::INGRESS);
+
   const ebpf::TableDesc &get_table_desc(const std::string &table_name, int index,
                                      ProgramType type);
                                      
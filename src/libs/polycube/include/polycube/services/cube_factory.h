@@ -47,6 +47,11 @@ struct __attribute__((__packed__)) PacketIn {
                                additional information to the control plane */
 };
 
+// Reason used by the datapath of the transparent cubes when a packet sent back
+// to the parent by pcn_pkt_hairpin() has to go through the control plane, the
+// packet is handled by the framework and it is not passed to the service
+static const uint16_t PACKET_IN_REASON_HAIRPIN = 0xffff;
+
 typedef std::function<void(const PacketIn *md,
                            const std::vector<uint8_t> &packet)>
     packet_in_cb;
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace polycube {
+namespace service {
+
+/*
+ * Maglev consistent hashing (Eisenbud et al., "Maglev: A Fast and Reliable
+ * Software Network Load Balancer", NSDI 2016).
+ *
+ * Each backend fills the lookup table following its own permutation of the
+ * entries, given by an offset and a skip derived from its name; since the
+ * table size is prime every permutation covers the whole table.
+ * The table only depends on the set of backends (and weights), so that
+ * adding or removing a backend moves few flows among the others.
+ */
+
+struct MaglevBackend {
+  std::string name;  // any string that identifies the backend
+  uint16_t weight;   // backends with weight 0 get no entries
+};
+
+// Returns the lookup table: the index (in backends) of the backend of each
+// entry, or an empty vector if no backend has a weight.
+// size must be a prime number.
+std::vector<int> maglevPopulate(const std::vector<MaglevBackend> &backends,
+                                uint32_t size);
+
+bool isPrime(uint32_t n);
+
+}  // namespace service
+}  // namespace polycube
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -58,6 +59,7 @@ class RawTable {
   int get_batch(void *keys, void *values, unsigned int *count, void *in_batch = nullptr, void *out_batch = nullptr);
   int get_and_delete_batch(void *keys, void *values, unsigned int *count, void *in_batch = nullptr, void *out_batch = nullptr);
   int update_batch(void *keys, void *values, unsigned int *count);
+  int remove_batch(void *keys, unsigned int *count);
 
   int first(void *key);
   int next(const void *key, void *next);
@@ -291,4 +293,33 @@ class QueueStackTable : protected RawQueueStackTable {
   explicit QueueStackTable(void *op) : RawQueueStackTable(op){};
 };
 
+/** PERF BUFFERS*/
+
+// Reader of the per-cpu buffers of a BPF_PERF_OUTPUT map. The entries
+// submitted by the datapath are passed to the callbacks by poll(), in the
+// thread that calls it.
+class PerfBuffer {
+
+ public:
+  typedef std::function<void(void *data, int size)> data_cb;
+  typedef std::function<void(uint64_t lost)> lost_cb;
+
+  PerfBuffer() = default;
+  ~PerfBuffer();
+
+  // waits at most timeout ms for new entries, returns the number of buffers
+  // that were read or a negative value on error
+  int poll(int timeout);
+
+  // waits at most timeout ms for new entries in any of the buffers, with a
+  // single wait on all of them; same return value as poll(timeout)
+  static int poll(std::vector<PerfBuffer> &buffers, int timeout);
+
+  explicit PerfBuffer(void *op, data_cb data, lost_cb lost, int page_cnt);
+
+ private:
+  class impl;
+  std::shared_ptr<impl> pimpl_;
+};
+
 }  // namespace polycube
@@ -75,6 +75,15 @@ RawQueueStackTable BaseCube::get_raw_queuestack_table(const std::string &table_n
   return std::move(t);
 }
 
+PerfBuffer BaseCube::get_perf_buffer(const std::string &table_name,
+                                     PerfBuffer::data_cb data,
+                                     PerfBuffer::lost_cb lost, int page_cnt,
+                                     int index, ProgramType type) {
+  int fd = get_table_fd(table_name, index, type);
+  PerfBuffer b(&fd, data, lost, page_cnt);
+  return std::move(b);
+}
+
 void BaseCube::datapath_log_msg(const LogMsg *msg) {
   spdlog::level::level_enum level_ =
       logLevelToSPDLog((polycube::LogLevel)msg->level);
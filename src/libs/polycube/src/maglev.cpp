@@ -0,0 +1,97 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "polycube/services/maglev.h"
+
+#include <algorithm>
+
+namespace polycube {
+namespace service {
+
+// FNV-1a: stable across runs, unlike std::hash
+static uint64_t maglevHash(const std::string &name, uint64_t seed) {
+  uint64_t hash = 14695981039346656037ULL ^ seed;
+  for (unsigned char c : name) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  // final mix, FNV alone spreads short similar strings poorly
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+bool isPrime(uint32_t n) {
+  if (n < 2) {
+    return false;
+  }
+  for (uint32_t i = 2; (uint64_t)i * i <= n; i++) {
+    if (n % i == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * Weights are supported by letting the backends take turns proportionally to
+ * them: in each round every backend gains its weight as credit, and fills its
+ * next preferred entry every time the credit reaches the maximum weight.
+ */
+std::vector<int> maglevPopulate(const std::vector<MaglevBackend> &backends,
+                                uint32_t size) {
+  uint32_t max_weight = 0;
+  for (auto &backend : backends) {
+    max_weight = std::max(max_weight, (uint32_t)backend.weight);
+  }
+  if (max_weight == 0 || size < 2) {
+    return std::vector<int>();
+  }
+
+  size_t n = backends.size();
+  std::vector<uint32_t> offset(n), skip(n), next(n, 0), credit(n, 0);
+  for (size_t i = 0; i < n; i++) {
+    offset[i] = maglevHash(backends[i].name, 0) % size;
+    skip[i] = maglevHash(backends[i].name, 1) % (size - 1) + 1;
+  }
+
+  std::vector<int> table(size, -1);
+  uint32_t filled = 0;
+  while (true) {
+    for (size_t i = 0; i < n; i++) {
+      credit[i] += backends[i].weight;
+      if (credit[i] < max_weight) {
+        continue;
+      }
+      credit[i] -= max_weight;
+
+      uint32_t entry;
+      do {
+        entry = (offset[i] + (uint64_t)next[i] * skip[i]) % size;
+        next[i]++;
+      } while (table[entry] >= 0);
+
+      table[entry] = i;
+      if (++filled == size) {
+        return table;
+      }
+    }
+  }
+}
+
+}  // namespace service
+}  // namespace polycube
@@ -18,6 +18,9 @@
 
 #include <libbpf/src/bpf.h>
 #include <api/BPFTable.h>
+#include <common.h>
+#include <libbpf.h>
+#include <perf_reader.h>
 
 using ebpf::BPFTable;
 
@@ -38,6 +41,7 @@ class RawTable::impl {
   int get_batch(void *keys, void *values, unsigned int *count, void *in_batch = nullptr, void *out_batch = nullptr) const;
   int get_and_delete_batch(void *keys, void *values, unsigned int *count, void *in_batch = nullptr, void *out_batch = nullptr) const;
   int update_batch(void *keys, void *values, unsigned int *count) const;
+  int remove_batch(void *keys, unsigned int *count) const;
 
   int first(void *key) const;
   int next(const void *key, void *next);
@@ -96,6 +100,10 @@ int RawTable::impl::update_batch(void *keys, void *values, unsigned int *count)
   return bpf_map_update_batch(fd_, keys, values, count, nullptr);
 }
 
+int RawTable::impl::remove_batch(void *keys, unsigned int *count) const {
+  return bpf_map_delete_batch(fd_, keys, count, nullptr);
+}
+
 // QUEUE/STACK eBPF maps impl
 class RawQueueStackTable::impl {
  public:
@@ -123,6 +131,81 @@ int RawQueueStackTable::impl::push(const void *value) const {
   return bpf_map_update_elem(fd_, nullptr, value, 0);
 }
 
+// PERF BUFFERS impl
+class PerfBuffer::impl {
+ public:
+  impl(void *op, data_cb data, lost_cb lost, int page_cnt);
+  ~impl();
+
+  int poll(int timeout);
+
+  const std::vector<perf_reader *> &readers() const {
+    return readers_;
+  }
+
+ private:
+  static void data_proxy(void *cookie, void *data, int size);
+  static void lost_proxy(void *cookie, uint64_t lost);
+  void close();
+
+  int fd_;
+  data_cb data_;
+  lost_cb lost_;
+  std::vector<int> cpus_;
+  std::vector<perf_reader *> readers_;
+};
+
+PerfBuffer::impl::impl(void *op, data_cb data, lost_cb lost, int page_cnt)
+    : fd_(*(int *)op), data_(data), lost_(lost) {
+  for (int cpu : ebpf::get_online_cpus()) {
+    auto reader = static_cast<perf_reader *>(bpf_open_perf_buffer(
+        &data_proxy, &lost_proxy, this, -1, cpu, page_cnt));
+    if (reader == nullptr) {
+      close();
+      throw std::runtime_error("Perf buffer open error on cpu " +
+                               std::to_string(cpu));
+    }
+    readers_.push_back(reader);
+    cpus_.push_back(cpu);
+
+    int reader_fd = perf_reader_fd(reader);
+    if (bpf_update_elem(fd_, &cpu, &reader_fd, 0)) {
+      std::string err(std::strerror(errno));
+      close();
+      throw std::runtime_error("Perf buffer set error: " + err);
+    }
+  }
+}
+
+PerfBuffer::impl::~impl() {
+  close();
+}
+
+void PerfBuffer::impl::close() {
+  for (int i = 0; i < readers_.size(); i++) {
+    bpf_delete_elem(fd_, &cpus_[i]);
+    perf_reader_free(readers_[i]);
+  }
+  readers_.clear();
+  cpus_.clear();
+}
+
+int PerfBuffer::impl::poll(int timeout) {
+  return perf_reader_poll(readers_.size(), readers_.data(), timeout);
+}
+
+void PerfBuffer::impl::data_proxy(void *cookie, void *data, int size) {
+  auto self = static_cast<PerfBuffer::impl *>(cookie);
+  self->data_(data, size);
+}
+
+void PerfBuffer::impl::lost_proxy(void *cookie, uint64_t lost) {
+  auto self = static_cast<PerfBuffer::impl *>(cookie);
+  if (self->lost_) {
+    self->lost_(lost);
+  }
+}
+
 
 // PIMPL for traditional maps
 RawTable::~RawTable() = default;
@@ -161,6 +244,10 @@ int RawTable::update_batch(void *keys, void *values, unsigned int *count){
   return pimpl_->update_batch(keys, values, count);
 }
 
+int RawTable::remove_batch(void *keys, unsigned int *count){
+  return pimpl_->remove_batch(keys, count);
+}
+
 //PIMPL for QUEUE/STACK maps
 
 RawQueueStackTable::~RawQueueStackTable() = default;
@@ -175,6 +262,26 @@ int RawQueueStackTable::push(const void *value) {
   return pimpl_->push(value);
 }
 
+//PIMPL for perf buffers
+
+PerfBuffer::~PerfBuffer() = default;
+
+PerfBuffer::PerfBuffer(void *op, data_cb data, lost_cb lost, int page_cnt)
+    : pimpl_(new impl(op, data, lost, page_cnt)) {}
+
+int PerfBuffer::poll(int timeout) {
+  return pimpl_->poll(timeout);
+}
+
+int PerfBuffer::poll(std::vector<PerfBuffer> &buffers, int timeout) {
+  std::vector<perf_reader *> readers;
+  for (auto &buffer : buffers) {
+    auto &buffer_readers = buffer.pimpl_->readers();
+    readers.insert(readers.end(), buffer_readers.begin(), buffer_readers.end());
+  }
+  return perf_reader_poll(readers.size(), readers.data(), timeout);
+}
+
 
 }  // namespace service
 }  // namespace polycube
@@ -33,6 +33,13 @@ TransparentCube::TransparentCube(const nlohmann::json &conf,
     if (dismounted_)
       return;
 
+    if (md->reason == PACKET_IN_REASON_HAIRPIN) {
+      // already processed by the egress program, it goes back to the parent
+      // as if it was received from the port
+      cube_->send_packet_out(packet, Direction::INGRESS);
+      return;
+    }
+
     Direction direction = static_cast<Direction>(md->port_id);
     PacketInMetadata md_;
     md_.traffic_class = md->traffic_class;
@@ -149,6 +149,8 @@ std::shared_ptr<TransparentCubeIface> CubeFactoryImpl::create_transparent_cube(
     case CubeType::XDP_SKB:
     case CubeType::XDP_DRV:
       controller_xdp_.register_cb(cube->get_id(), cb);
+      // the TC version of the egress programs uses the TC controller
+      controller_tc_.register_cb(cube->get_id(), cb);
       break;
     case CubeType::TC:
       controller_tc_.register_cb(cube->get_id(), cb);
@@ -171,6 +173,7 @@ void CubeFactoryImpl::destroy_cube(const std::string &name) {
   case CubeType::XDP_SKB:
   case CubeType::XDP_DRV:
     controller_xdp_.unregister_cb(id);
+    controller_tc_.unregister_cb(id);
     break;
   case CubeType::TC:
     controller_tc_.unregister_cb(id);
@@ -205,8 +205,11 @@ void ExtIface::update_indexes() {
   
   next = peer_ ? peer_->get_index() : 0xffff;
   for (int i = cubes_.size()-1; i >= 0; i--) {
+    // the packets sent back by the egress programs go through the ingress
+    // hook of the interface again
+    cubes_[i]->set_parent_port(0, true);
+    cubes_[i]->set_next(next, ProgramType::INGRESS);
     if (cubes_[i]->get_index(ProgramType::INGRESS)) {
-      cubes_[i]->set_next(next, ProgramType::INGRESS);
       next = cubes_[i]->get_index(ProgramType::INGRESS);
     }
   }
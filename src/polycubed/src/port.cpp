@@ -277,8 +277,11 @@ void Port::update_indexes() {
   
   next = get_parent_index();
   for (int i = 0; i < cubes_.size(); i++) {
+    // the next program is set for the cubes without an ingress program too,
+    // it is where the packets sent back by their egress program continue
+    cubes_[i]->set_parent_port(index(), false);
+    cubes_[i]->set_next(next, ProgramType::INGRESS);
     if (cubes_[i]->get_index(ProgramType::INGRESS)) {
-      cubes_[i]->set_next(next, ProgramType::INGRESS);
       next = cubes_[i]->get_index(ProgramType::INGRESS);
     }
   }
@@ -37,6 +37,9 @@ TransparentCube::TransparentCube(const std::string &name,
       ingress_next_(0),
       egress_next_(0),
       egress_next_is_netdev_(false),
+      parent_port_(0),
+      parent_is_netdev_(false),
+      parent_port_changed_(false),
       attach_(attach),
       parent_(nullptr) {}
 
@@ -62,10 +65,11 @@ void TransparentCube::set_next(uint16_t next, ProgramType type,
                                "followed by a netdev");
     }
 
-    if (ingress_next_ == next) {
+    if (ingress_next_ == next && !parent_port_changed_) {
       return;
     }
     ingress_next_ = next;
+    parent_port_changed_ = false;
     break;
 
   case ProgramType::EGRESS:
@@ -83,6 +87,15 @@ uint16_t TransparentCube::get_next(ProgramType type) {
   return type == ProgramType::INGRESS ? ingress_next_ : egress_next_;
 }
 
+void TransparentCube::set_parent_port(uint16_t port, bool is_netdev) {
+  if (parent_port_ == port && parent_is_netdev_ == is_netdev) {
+    return;
+  }
+  parent_port_ = port;
+  parent_is_netdev_ = is_netdev;
+  parent_port_changed_ = true;
+}
+
 void TransparentCube::set_parent(PeerIface *parent) {
   parent_ = parent;
   if (parent_) {
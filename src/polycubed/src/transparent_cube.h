@@ -39,6 +39,11 @@ class TransparentCube : public BaseCube, public TransparentCubeIface {
   virtual void set_next(uint16_t next, ProgramType type,
                         bool is_netdev = false);
   uint16_t get_next(ProgramType type);
+  // Sets the port of the parent the cube is attached to, where the packets
+  // sent back by pcn_pkt_hairpin() are received from (the interface itself
+  // if is_netdev). It takes effect with the next set_next() of the ingress
+  // program.
+  void set_parent_port(uint16_t port, bool is_netdev);
   void set_parent(PeerIface *parent);
   PeerIface *get_parent();
   void set_parameter(const std::string &parameter, const std::string &value);
@@ -61,6 +66,9 @@ class TransparentCube : public BaseCube, public TransparentCubeIface {
   uint16_t ingress_next_;
   uint16_t egress_next_;
   bool egress_next_is_netdev_;
+  uint16_t parent_port_;
+  bool parent_is_netdev_;
+  bool parent_port_changed_;
 
   std::unordered_map<std::string, ParameterEventCallback> subscription_list;
   std::mutex subscription_list_mutex;
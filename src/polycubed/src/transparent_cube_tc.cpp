@@ -46,7 +46,8 @@ std::string TransparentCubeTC::get_wrapper_code() {
 }
 
 void TransparentCubeTC::do_compile(int id, uint16_t next,
-                                   bool is_netdev, ProgramType type,
+                                   bool is_netdev, uint16_t hairpin_next,
+                                   uint16_t hairpin_port, ProgramType type,
                                    LogLevel level_, ebpf::BPF &bpf,
                                    const std::string &code, int index) {
   std::string all_code(get_wrapper_code() +
@@ -59,6 +60,12 @@ void TransparentCubeTC::do_compile(int id, uint16_t next,
   cflags.push_back(std::string("-DNEXT=" + std::to_string(next)));
   cflags.push_back(std::string("-DNEXT_IS_NETDEV=") +
                    std::to_string(int(is_netdev)));
+  cflags.push_back(std::string("-DHAIRPIN_NEXT=") +
+                   std::to_string(hairpin_next));
+  cflags.push_back(std::string("-DHAIRPIN_PORT=") +
+                   std::to_string(hairpin_port));
+  cflags.push_back(std::string("-DHAIRPIN_REASON=") +
+                   std::to_string(service::PACKET_IN_REASON_HAIRPIN));
   cflags.push_back(std::string("-DPOLYCUBE_PROGRAM_TYPE=") +
                    std::to_string(static_cast<int>(type)));
 
@@ -84,7 +91,11 @@ void TransparentCubeTC::compile(ebpf::BPF &bpf, const std::string &code,
     is_netdev = egress_next_is_netdev_;
     break;
   }
-  do_compile(get_id(), next, is_netdev, type, level_, bpf, code, index);
+  // packets sent back to a netdev parent go through its ingress hook,
+  // otherwise they continue in the ingress chain after the cube
+  uint16_t hairpin_next = parent_is_netdev_ ? 0xffff : ingress_next_;
+  do_compile(get_id(), next, is_netdev, hairpin_next, parent_port_, type,
+             level_, bpf, code, index);
 }
 
 int TransparentCubeTC::load(ebpf::BPF &bpf, ProgramType type) {
@@ -110,6 +121,9 @@ int handle_rx_wrapper(struct CTXTYPE *skb) {
   switch (rc) {
     case RX_DROP:
       return TC_ACT_SHOT;
+    case RX_REDIRECT:
+      // Redirected by pcn_pkt_reflect()
+      return TC_ACT_REDIRECT;
     case RX_OK:
 #if NEXT_IS_NETDEV
       return bpf_redirect(NEXT, 0);
@@ -143,6 +157,37 @@ int pcn_pkt_controller(struct CTXTYPE *skb, struct pkt_metadata *md,
 
   return controller_tc.perf_submit_skb(skb, skb->len, md, sizeof(*md));
 }
+
+#if POLYCUBE_PROGRAM_TYPE == 0  // Only INGRESS programs can reflect
+// Sends the packet back through the interface it has been received from
+static __always_inline
+int pcn_pkt_reflect(struct CTXTYPE *skb, struct pkt_metadata *md) {
+  bpf_redirect(skb->ifindex, 0);
+  return RX_REDIRECT;
+}
+#endif
+
+#if POLYCUBE_PROGRAM_TYPE == 1  // Only EGRESS programs can hairpin
+// Sends the packet back to the parent, as if it was received from the port
+// (or the interface) the cube is attached to
+static __always_inline
+int pcn_pkt_hairpin(struct CTXTYPE *skb, struct pkt_metadata *md) {
+#if HAIRPIN_NEXT == 0xffff
+  bpf_redirect(skb->ifindex, BPF_F_INGRESS);
+  return RX_REDIRECT;
+#elif HAIRPIN_NEXT == 0
+  // the ingress chain of the parent is not reachable from this hook, the
+  // control plane sends the packet to it
+  pcn_pkt_controller(skb, md, HAIRPIN_REASON);
+  return RX_DROP;
+#else
+  skb->mark = md->traffic_class;
+  skb->cb[0] = HAIRPIN_PORT << 16;
+  nodes.call(skb, HAIRPIN_NEXT);
+  return RX_DROP;
+#endif
+}
+#endif
 )";
 
 }  // namespace polycubed
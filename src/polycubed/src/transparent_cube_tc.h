@@ -46,6 +46,7 @@ class TransparentCubeTC : virtual public TransparentCube {
 
  protected:
   static void do_compile(int module_index, uint16_t next, bool is_netdev,
+                         uint16_t hairpin_next, uint16_t hairpin_port,
                          ProgramType type, LogLevel level_, ebpf::BPF &bpf,
                          const std::string &code, int index);
   static std::string get_wrapper_code();
@@ -101,6 +101,7 @@ void TransparentCubeXDP::reload(const std::string &code, int index,
         bcc_guard.unlock();
         TransparentCubeTC::do_compile(get_id(), egress_next_tc_,
                                       egress_next_tc_is_netdev_,
+                                      get_hairpin_next_tc(), parent_port_,
                                       ProgramType::EGRESS, level_,
                                       *new_bpf_program, code, 0);
         int fd = CubeTC::do_load(*new_bpf_program);
@@ -148,6 +149,7 @@ void TransparentCubeXDP::reload_all() {
         bcc_guard.unlock();
         TransparentCubeTC::do_compile(get_id(), egress_next_tc_,
                                       egress_next_tc_is_netdev_,
+                                      get_hairpin_next_tc(), parent_port_,
                                       ProgramType::EGRESS, level_,
                                       *new_bpf_program, egress_code_[i], 0);
         int fd = CubeTC::do_load(*new_bpf_program);
@@ -192,6 +194,7 @@ int TransparentCubeXDP::add_program(const std::string &code, int index, ProgramT
         bcc_guard.unlock();
         TransparentCubeTC::do_compile(get_id(), egress_next_tc_,
                                       egress_next_tc_is_netdev_,
+                                      get_hairpin_next_tc(), parent_port_,
                                       ProgramType::EGRESS, level_,
                                       *egress_programs_tc_.at(index), code, 0);
         int fd = CubeTC::do_load(*egress_programs_tc_.at(index));
@@ -240,6 +243,13 @@ void TransparentCubeXDP::del_program(int index, ProgramType type) {
   }
 }
 
+// The TC version of the egress programs can send the packets back to a netdev
+// parent through its ingress hook, while the ingress chain of a parent port is
+// made of XDP programs: the packets go through the control plane (0)
+uint16_t TransparentCubeXDP::get_hairpin_next_tc() const {
+  return parent_is_netdev_ ? 0xffff : 0;
+}
+
 void TransparentCubeXDP::compile(ebpf::BPF &bpf, const std::string &code,
                                  int index, ProgramType type) {
   uint16_t next;
@@ -268,6 +278,15 @@ void TransparentCubeXDP::compile(ebpf::BPF &bpf, const std::string &code,
   cflags.push_back(std::string("-DNEXT=" + std::to_string(next)));
   cflags.push_back(std::string("-DNEXT_IS_NETDEV=") +
                    std::to_string(int(is_netdev)));
+  // XDP programs cannot redirect a packet to the ingress of an interface, the
+  // packets sent back to a netdev parent go through the control plane
+  uint16_t hairpin_next = parent_is_netdev_ ? 0xffff : ingress_next_;
+  cflags.push_back(std::string("-DHAIRPIN_NEXT=") +
+                   std::to_string(hairpin_next));
+  cflags.push_back(std::string("-DHAIRPIN_PORT=") +
+                   std::to_string(parent_port_));
+  cflags.push_back(std::string("-DHAIRPIN_REASON=") +
+                   std::to_string(service::PACKET_IN_REASON_HAIRPIN));
   cflags.push_back(std::string("-DPOLYCUBE_PROGRAM_TYPE=") +
                    std::to_string(static_cast<int>(type)));
 
@@ -306,6 +325,10 @@ int handle_rx_xdp_wrapper(struct CTXTYPE *ctx) {
     case RX_DROP:
       return XDP_DROP;
 
+    case RX_REDIRECT:
+      // Redirected by pcn_pkt_reflect()
+      return XDP_REDIRECT;
+
     case RX_OK:
 #if NEXT_IS_NETDEV
       return bpf_redirect(NEXT, 0);
@@ -337,6 +360,31 @@ int pcn_pkt_controller(struct CTXTYPE *pkt, struct pkt_metadata *md,
   // Restore original port
   md->in_port = in_port;
 }
+
+#if POLYCUBE_PROGRAM_TYPE == 0  // Only INGRESS programs can reflect
+// Sends the packet back through the interface it has been received from
+static __always_inline
+int pcn_pkt_reflect(struct CTXTYPE *pkt, struct pkt_metadata *md) {
+  bpf_redirect(pkt->ingress_ifindex, 0);
+  return RX_REDIRECT;
+}
+#endif
+
+#if POLYCUBE_PROGRAM_TYPE == 1  // Only EGRESS programs can hairpin
+// Sends the packet back to the parent, as if it was received from the port
+// (or the interface) the cube is attached to
+static __always_inline
+int pcn_pkt_hairpin(struct CTXTYPE *pkt, struct pkt_metadata *md) {
+#if HAIRPIN_NEXT == 0xffff
+  pcn_pkt_controller(pkt, md, HAIRPIN_REASON);
+  return RX_DROP;
+#else
+  md->in_port = HAIRPIN_PORT;
+  xdp_nodes.call(pkt, HAIRPIN_NEXT);
+  return RX_DROP;
+#endif
+}
+#endif
 )";
 
 }  // namespace polycubed
@@ -71,6 +71,8 @@ class TransparentCubeXDP : virtual public TransparentCube {
  private:
   static const std::string TRANSPARENTCUBEXDP_WRAPPER;
 
+  uint16_t get_hairpin_next_tc() const;
+
   uint16_t egress_next_tc_;
   bool egress_next_tc_is_netdev_;
 };
@@ -1,5 +1,7 @@
 #include "Dynmon.h"
 
+#include <regex>
+
 #include "Utils.h"
 
 Dynmon::Dynmon(const std::string& name, const DynmonJsonObject &conf)
@@ -7,12 +9,17 @@ Dynmon::Dynmon(const std::string& name, const DynmonJsonObject &conf)
       DynmonBase(name) {
   logger()->info("Creating Dynmon instance");
   m_dpConfig = std::make_shared<DataplaneConfig>(*this);
+  m_collector = std::make_shared<Collector>(*this);
   if (conf.dataplaneConfigIsSet())
     setDataplaneConfig(conf.getDataplaneConfig());
+  if (conf.collectorIsSet())
+    setCollector(conf.getCollector());
 }
 
 Dynmon::~Dynmon() {
   logger()->info("Destroying Dynmon instance");
+  // The collection thread uses the maps and the mutexes of the instance
+  m_collector->stop();
 }
 
 void Dynmon::packet_in(polycube::service::Direction direction,
@@ -48,33 +55,24 @@ void Dynmon::resetDataplaneConfig() {
 
 void Dynmon::setEgressPathConfig(const PathConfigJsonObject &config) {
   logger()->debug("[Dynmon] setEgressPathConfig(config)");
-  int progress = 0;
   std::lock_guard<std::mutex> lock_eg(m_egressPathMutex);
   try {
-    auto original_code = config.getCode();
+    auto original_code = includeHelpers(config.getCode());
     /*Try to compile the current injected code and optimize accordingly to map parameters*/
-    CodeRewriter::compile(original_code, ProgramType::EGRESS, config.getMetricConfigs(),
+    CodeRewriter::compile(original_code, config.getMetricConfigs(),
                           egressSwapState, logger());
 
     switch (egressSwapState.getCompileType()) {
     case CodeRewriter::CompileType::NONE: {
       /*Load the real config code since no swap*/
-      reload(config.getCode(), 0, ProgramType::EGRESS);
-      break;
-    }
-    case CodeRewriter::CompileType::PROGRAM_RELOAD: {
-      /*Retrieve current code to load, if original or swap*/
-      reload(egressSwapState.getCodeToLoad(), 0, ProgramType::EGRESS);
+      reload(original_code, 0, ProgramType::EGRESS);
       break;
     }
-    case CodeRewriter::CompileType::PROGRAM_INDEX_SWAP: {
-      /*Load PIVOTING code at index 0, tuned original at index 1 and tuned swap at index 2*/
+    case CodeRewriter::CompileType::MAP_SWAP: {
+      /*Load the tuned code and link the buffers of each swappable map to its outer map*/
       logger()->debug("[Dynmon] Swap enabled for EGRESS program");
-      reload(egressSwapState.getMasterCode(), 0, ProgramType::EGRESS);
-      add_program(egressSwapState.getOriginalCode(), 1, ProgramType::EGRESS);
-      add_program(egressSwapState.getSwappedCode(), 2, ProgramType::EGRESS);
-      get_array_table<int>(CodeRewriter::SWAP_MASTER_INDEX_MAP, 0, ProgramType::EGRESS)
-          .set(0, 1);
+      reload(egressSwapState.getCode(), 0, ProgramType::EGRESS);
+      initSwapMaps(egressSwapState, ProgramType::EGRESS);
       break;
     }
     default :
@@ -82,51 +80,38 @@ void Dynmon::setEgressPathConfig(const PathConfigJsonObject &config) {
     }
 
     m_dpConfig->replaceEgressPathConfig(config);
+    m_collector->refresh();
   } catch (std::exception &ex) {
     logger()->error("ERROR injecting EGRESS path code: {0}", ex.what());
     logger()->info("Restoring default EGRESS path configuration");
     m_dpConfig->replaceEgressPathConfig(PathConfig(*m_dpConfig).toJsonObject());
     reload(m_dpConfig->getEgressPathConfig()->getCode(), 0,
            ProgramType::EGRESS);
-    /*In case the exception is thrown during code loading, delete the ones that have
-     * already been loaded*/
-    for(int i=1; i<=progress;i ++) {
-      del_program(i, ProgramType::EGRESS);
-    }
     egressSwapState = {};
+    m_collector->refresh();
   }
 }
 
 void Dynmon::setIngressPathConfig(const PathConfigJsonObject &config) {
   logger()->debug("[Dynmon] setIngressPathConfig(config)");
-  int progress = 0;
-
   std::lock_guard<std::mutex> lock_in(m_ingressPathMutex);
   try {
-    auto original_code = config.getCode();
+    auto original_code = includeHelpers(config.getCode());
     /*Try to compile the current injected code and optimize accordingly to map parameters*/
-    CodeRewriter::compile(original_code, ProgramType::INGRESS, config.getMetricConfigs(),
+    CodeRewriter::compile(original_code, config.getMetricConfigs(),
                           ingressSwapState, logger());
 
     switch (ingressSwapState.getCompileType()) {
     case CodeRewriter::CompileType::NONE: {
       /*Load the real config code since no swap*/
-      reload(config.getCode(), 0, ProgramType::INGRESS);
+      reload(original_code, 0, ProgramType::INGRESS);
       break;
     }
-    case CodeRewriter::CompileType::PROGRAM_RELOAD: {
-      /*Retrieve current code to load, if original or swap*/
-      reload(ingressSwapState.getCodeToLoad(), 0, ProgramType::INGRESS);
-      break;
-    }
-    case CodeRewriter::CompileType::PROGRAM_INDEX_SWAP: {
-      /*Load PIVOTING code at index 0, tuned original at index 1 and tuned swap at index 2*/
+    case CodeRewriter::CompileType::MAP_SWAP: {
+      /*Load the tuned code and link the buffers of each swappable map to its outer map*/
       logger()->debug("[Dynmon] Swap enabled for INGRESS program");
-      reload(ingressSwapState.getMasterCode(), 0, ProgramType::INGRESS);
-      add_program(ingressSwapState.getOriginalCode(), ++progress, ProgramType::INGRESS);
-      add_program(ingressSwapState.getSwappedCode(), ++progress, ProgramType::INGRESS);
-      get_array_table<int>(CodeRewriter::SWAP_MASTER_INDEX_MAP, 0, ProgramType::INGRESS)
-          .set(0, 1);
+      reload(ingressSwapState.getCode(), 0, ProgramType::INGRESS);
+      initSwapMaps(ingressSwapState, ProgramType::INGRESS);
       break;
     }
     default :
@@ -134,6 +119,7 @@ void Dynmon::setIngressPathConfig(const PathConfigJsonObject &config) {
     }
 
     m_dpConfig->replaceIngressPathConfig(config);
+    m_collector->refresh();
   } catch (std::exception &ex) {
     logger()->error("ERROR injecting INGRESS path code: {0}", ex.what());
     logger()->info("Restoring default INGRESS path configuration");
@@ -141,12 +127,8 @@ void Dynmon::setIngressPathConfig(const PathConfigJsonObject &config) {
         PathConfig(*m_dpConfig).toJsonObject());
     reload(m_dpConfig->getIngressPathConfig()->getCode(), 0,
            ProgramType::INGRESS);
-    /*In case the exception is thrown during code loading, delete the ones that have
-     * already been loaded*/
-    for(int i=1; i<=progress;i ++) {
-      del_program(i, ProgramType::INGRESS);
-    }
     ingressSwapState = {};
+    m_collector->refresh();
   }
 }
 
@@ -161,13 +143,8 @@ void Dynmon::resetEgressPathConfig() {
   m_dpConfig->replaceEgressPathConfig(conf);
   reload(DEFAULT_PATH_CODE, 0, ProgramType::EGRESS);
 
-  /*Check if there were other programs loaded (PROGRAM_INDEX_SWAP compilation)*/
-  if(egressSwapState.getCompileType() == CodeRewriter::CompileType::PROGRAM_INDEX_SWAP) {
-    del_program(2, ProgramType::EGRESS);
-    del_program(1, ProgramType::EGRESS);
-  }
-
   egressSwapState = {};
+  m_collector->refresh();
 }
 
 void Dynmon::resetIngressPathConfig() {
@@ -181,17 +158,94 @@ void Dynmon::resetIngressPathConfig() {
   m_dpConfig->replaceIngressPathConfig(conf);
   reload(DEFAULT_PATH_CODE, 0, ProgramType::INGRESS);
 
-  /*Check if there were other programs loaded (PROGRAM_INDEX_SWAP compilation)*/
-  if(ingressSwapState.getCompileType() == CodeRewriter::CompileType::PROGRAM_INDEX_SWAP) {
-    del_program(2, ProgramType::INGRESS);
-    del_program(1, ProgramType::INGRESS);
+  ingressSwapState = {};
+  m_collector->refresh();
+}
+
+std::shared_ptr<Collector> Dynmon::getCollector() {
+  logger()->debug("[Dynmon] getCollector()");
+  return m_collector;
+}
+
+void Dynmon::setCollector(const CollectorJsonObject &config) {
+  logger()->debug("[Dynmon] setCollector(config)");
+  m_collector->update(config);
+}
+
+void Dynmon::resetCollector() {
+  logger()->debug("[Dynmon] resetCollector()");
+  m_collector->setInterval(0);
+  m_collector->setPushUrl("");
+  m_collector->setPushDeltas(false);
+}
+
+std::shared_ptr<MetricsSnapshot> Dynmon::collect() {
+  logger()->debug("[Dynmon] collect()");
+  auto snapshot = std::make_shared<MetricsSnapshot>();
+  snapshot->metrics = std::make_shared<Metrics>(*this);
+  auto ingressMetricConfigs =
+      m_dpConfig->getIngressPathConfig()->getMetricConfigsList();
+  auto egressMetricConfigs =
+      m_dpConfig->getEgressPathConfig()->getMetricConfigsList();
+
+  {
+    std::lock_guard<std::mutex> lock_in(m_ingressPathMutex);
+    std::lock_guard<std::mutex> lock_eg(m_egressPathMutex);
+    triggerReadIngress();
+    triggerReadEgress();
+
+    for (auto &it : ingressMetricConfigs)
+      collectMetric(it, ProgramType::INGRESS, *snapshot);
+    for (auto &it : egressMetricConfigs)
+      collectMetric(it, ProgramType::EGRESS, *snapshot);
   }
 
-  ingressSwapState = {};
+  std::vector<std::string> metrics;
+  for (auto &metric : snapshot->openMetrics)
+    metrics.push_back(metric.second);
+  snapshot->openMetricsText = Utils::join(metrics, "\n");
+  return snapshot;
+}
+
+void Dynmon::collectMetric(const shared_ptr<MetricConfig>& config, ProgramType type,
+                           MetricsSnapshot &snapshot) {
+  auto name = config->getName();
+  try {
+    if (config->getOpenMetricsMetadata() != nullptr) {
+      try {
+        // A single read of the map provides both the formats
+        nlohmann::json value;
+        auto metric = do_get_open_metric(config, type, &value);
+        snapshot.openMetrics.emplace_back(
+            (type == ProgramType::INGRESS ? "ingress/" : "egress/") + name, metric);
+        auto timestamp = Utils::genTimestampMicroSeconds();
+        if (type == ProgramType::INGRESS)
+          snapshot.metrics->addIngressMetricUnsafe(std::make_shared<Metric>(*this, name, value, timestamp));
+        else
+          snapshot.metrics->addEgressMetricUnsafe(std::make_shared<Metric>(*this, name, value, timestamp));
+        return;
+      } catch (const std::exception &ex) {
+        // The map cannot be exported in OpenMetric format, it has not been read
+        logger()->warn("{0}", ex.what());
+      }
+    }
+
+    auto metric = do_get_metric(name, config->getMapName(), type, config->getExtractionOptions());
+    if (type == ProgramType::INGRESS)
+      snapshot.metrics->addIngressMetricUnsafe(metric);
+    else
+      snapshot.metrics->addEgressMetricUnsafe(metric);
+  } catch (const std::exception &ex) {
+    logger()->warn("{0}", ex.what());
+    logger()->warn("Unable to read {0} map", config->getMapName());
+  }
 }
 
 std::shared_ptr<Metrics> Dynmon::getMetrics() {
   logger()->debug("[Dynmon] getMetrics()");
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot)
+    return snapshot->metrics;
 
   std::vector<shared_ptr<Metric>> egressMetrics, ingressMetrics;
 
@@ -247,6 +301,14 @@ std::shared_ptr<Metric> Dynmon::getEgressMetric(const std::string &name) {
   auto egressPathConfig = m_dpConfig->getEgressPathConfig();
   auto metricConfig = egressPathConfig->getMetricConfig(name);
 
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot) {
+    for (auto &metric : snapshot->metrics->getEgressMetricsList())
+      if (metric->getName() == name)
+        return metric;
+    throw std::runtime_error("Unable to read " + metricConfig->getMapName() + " map");
+  }
+
   std::lock_guard<std::mutex> lock_eg(m_egressPathMutex);
   triggerReadEgress();
 
@@ -263,6 +325,10 @@ std::shared_ptr<Metric> Dynmon::getEgressMetric(const std::string &name) {
 
 std::vector<std::shared_ptr<Metric>> Dynmon::getEgressMetrics() {
   logger()->debug("[Dynmon] getEgressMetrics()");
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot)
+    return snapshot->metrics->getEgressMetricsList();
+
   std::vector<std::shared_ptr<Metric>> metrics;
   auto egressMetricConfigs =
       m_dpConfig->getEgressPathConfig()->getMetricConfigsList();
@@ -290,6 +356,14 @@ std::shared_ptr<Metric> Dynmon::getIngressMetric(const std::string &name) {
   auto ingressPathConfig = m_dpConfig->getIngressPathConfig();
   auto metricConfig = ingressPathConfig->getMetricConfig(name);
 
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot) {
+    for (auto &metric : snapshot->metrics->getIngressMetricsList())
+      if (metric->getName() == name)
+        return metric;
+    throw std::runtime_error("Unable to read " + metricConfig->getMapName() + " map");
+  }
+
   std::lock_guard<std::mutex> lock_in(m_ingressPathMutex);
   triggerReadIngress();
 
@@ -307,6 +381,10 @@ std::shared_ptr<Metric> Dynmon::getIngressMetric(const std::string &name) {
 
 std::vector<std::shared_ptr<Metric>> Dynmon::getIngressMetrics() {
   logger()->debug("[Dynmon] getIngressMetrics()");
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot)
+    return snapshot->metrics->getIngressMetricsList();
+
   std::vector<std::shared_ptr<Metric>> metrics;
   auto ingressMetricConfigs =
       m_dpConfig->getIngressPathConfig()->getMetricConfigsList();
@@ -331,6 +409,9 @@ std::vector<std::shared_ptr<Metric>> Dynmon::getIngressMetrics() {
 
 std::string Dynmon::getOpenMetrics() {
   logger()->debug("[Dynmon] getOpenMetrics()");
+  auto snapshot = m_collector->getSnapshot();
+  if (snapshot)
+    return snapshot->openMetricsText;
 
   std::string eg_metrics, in_metrics;
   {
@@ -445,73 +526,89 @@ std::string Dynmon::getIngressOpenMetrics() {
 }
 
 std::string Dynmon::toOpenMetrics(const std::shared_ptr<MetricConfig>& conf,
-                                  nlohmann::json value) {
-  std::vector<std::string> sub_metrics;
-  try {
-    auto metadata = conf->getOpenMetricsMetadata();
+                                  const std::vector<uint64_t> &values) {
+  if (values.empty())
+    return "";
+
+  auto metadata = conf->getOpenMetricsMetadata();
+  auto name = conf->getName();
+
+  // The HELP and TYPE headers and the labels are the same for every value
+  std::string headers = "#HELP " + name + " " + metadata->getHelp() + "\n" +
+      "#TYPE " + name + " " +
+      OpenMetricsMetadataJsonObject::MetricTypeEnum_to_string(metadata->getType()) + "\n";
+  std::string labels = "{" + openMetricsLabels(conf) + "} ";
+
+  // Transforming the metric values in the OpenMetric format
+  std::string metrics;
+  metrics.reserve(values.size() * (headers.size() + name.size() + labels.size() + 32));
+  for (size_t i = 0; i < values.size(); i++) {
+    if (i > 0)
+      metrics.push_back('\n');
+    metrics.append(headers);
+    metrics.append(name);
+    if (values.size() > 1)
+      metrics.append("_" + std::to_string(i));
+    metrics.append(labels);
+    metrics.append(std::to_string(values[i]));
+  }
+  return metrics;
+}
 
-    if (value.is_null() || value[0].is_null() || !value[0].is_number()) {
-      logger()->warn("Unable to convert metric {0} to OpenMetrics format.",
-                     conf->getName());
-      return "";
-    }
+std::string Dynmon::toOpenMetrics(const std::shared_ptr<MetricConfig>& conf, const Sketch &sketch,
+                                  const std::vector<const char *> &values) {
+  auto metadata = conf->getOpenMetricsMetadata();
+  auto name = conf->getName();
+  auto labels = openMetricsLabels(conf);
+  // The type is given by the sketch, as its samples depend on it
+  auto type = OpenMetricsMetadataJsonObject::MetricTypeEnum_to_string(sketch.getType());
+
+  std::string metrics;
+  for (size_t i = 0; i < values.size(); i++) {
+    auto family = values.size() > 1 ? name + "_" + std::to_string(i) : name;
+    metrics.append("#HELP " + family + " " + metadata->getHelp() + "\n" +
+                   "#TYPE " + family + " " + type + "\n");
+    sketch.toOpenMetrics(values[i], family, labels, metrics);
+  }
+  // Metrics are joined by the callers
+  if (!metrics.empty())
+    metrics.pop_back();
+  return metrics;
+}
 
-    // Transforming the metric value in the OpenMetric format
-    for (auto i = 0; i < value.size(); i++) {
-      std::string strMetric;
-      // Appending metric name
-      strMetric.append(conf->getName() +
-                       (value.size() == 1 ? "" : "_" + std::to_string(i)));
-
-      // Appending metric labels
-      strMetric.append("{");
-      auto labels = metadata->getLabelsList();
-      for (auto label = labels.begin(); label != labels.end(); label++)
-        strMetric.append(label->get()->getName() + "=\"" +
-                         label->get()->getValue() + "\"" +
-                         ((std::next(label) != labels.end()) ? ", " : ""));
-      strMetric.append("} ");
-
-      // Appending metric value
-      strMetric.append(std::to_string(value[i].get<uint64_t>()));
-
-      // Adding the HELP header
-      sub_metrics.push_back("#HELP " + conf->getName() + " " +
-                            metadata->getHelp());
-
-      // Adding the TYPE header
-      sub_metrics.push_back(
-          "#TYPE " + conf->getName() + " " +
-          OpenMetricsMetadataJsonObject::MetricTypeEnum_to_string(
-              metadata->getType()));
-      // Adding the metric
-      sub_metrics.push_back(strMetric);
-    }
+std::string Dynmon::openMetricsLabels(const std::shared_ptr<MetricConfig>& conf) {
+  std::string labels;
+  auto labelsList = conf->getOpenMetricsMetadata()->getLabelsList();
+  for (auto label = labelsList.begin(); label != labelsList.end(); label++)
+    labels.append(label->get()->getName() + "=\"" + label->get()->getValue() + "\"" +
+                  ((std::next(label) != labelsList.end()) ? ", " : ""));
+  return labels;
+}
 
-  } catch (const std::exception &ex) {
-    logger()->warn("{0}", ex.what());
-    logger()->warn("Unable to read {0} map", conf->getMapName());
+std::string Dynmon::includeHelpers(const std::string &code) {
+  static const std::regex include_regex("#\\s*include\\s*[<\"]dynmon_helpers\\.h[>\"]");
+  // Not using regex_replace, which would interpret any $ in the helpers
+  std::string expanded;
+  std::smatch match;
+  auto begin = code.cbegin();
+  while (std::regex_search(begin, code.cend(), match, include_regex)) {
+    expanded.append(begin, match[0].first);
+    expanded.append(dynmon_helpers_code);
+    begin = match[0].second;
   }
-  // Joining the sub_metrics in a unique string before returning them
-  return Utils::join(sub_metrics, "\n");
+  expanded.append(begin, code.cend());
+  return expanded;
 }
 
 void Dynmon::triggerReadEgress() {
   switch(egressSwapState.getCompileType()) {
   case CodeRewriter::CompileType::NONE:
     break;
-  case CodeRewriter::CompileType::PROGRAM_RELOAD: {
-    /* Triggering read egress and retrieve index and code to load*/
+  case CodeRewriter::CompileType::MAP_SWAP: {
+    /* Triggering read egress and flipping the buffer index used by the datapath*/
     auto index = egressSwapState.triggerRead();
-    logger()->debug("[Dynmon] Triggered read EGRESS! Swapping code with {} ", index == 1? "original" : "swap");
-    reload(egressSwapState.getCodeToLoad(), 0, ProgramType::EGRESS);
-    break;
-  }
-  case CodeRewriter::CompileType::PROGRAM_INDEX_SWAP: {
-    /* Triggering read egress and changing the PIVOTING map index to call the right program*/
-    auto index = egressSwapState.triggerRead();
-    logger()->debug("[Dynmon] Triggered read EGRESS! Changing map index to {}", index);
-    get_array_table<int>(CodeRewriter::SWAP_MASTER_INDEX_MAP, 0, ProgramType::EGRESS)
+    logger()->debug("[Dynmon] Triggered read EGRESS! Changing buffer index to {}", index);
+    get_array_table<int>(CodeRewriter::SWAP_INDEX_MAP, 0, ProgramType::EGRESS)
         .set(0, index);
     break;
   }
@@ -521,54 +618,61 @@ void Dynmon::triggerReadEgress() {
 }
 
 void Dynmon::triggerReadIngress() {
-
   switch(ingressSwapState.getCompileType()) {
   case CodeRewriter::CompileType::NONE:
     break;
-  case CodeRewriter::CompileType::PROGRAM_RELOAD: {
-    /* Triggering read ingress and retrieve index and code to load*/
+  case CodeRewriter::CompileType::MAP_SWAP: {
+    /* Triggering read ingress and flipping the buffer index used by the datapath*/
     auto index = ingressSwapState.triggerRead();
-    logger()->debug("[Dynmon] Triggered read INGRESS! Swapping code with {} ", index == 1? "original" : "swap");
-    reload(ingressSwapState.getCodeToLoad(), 0, ProgramType::INGRESS);
-    break;
-  }
-  case CodeRewriter::CompileType::PROGRAM_INDEX_SWAP: {
-    /* Triggering read ingress and changing the PIVOTING map index to call the right program*/
-    auto index = ingressSwapState.triggerRead();
-    logger()->debug("[Dynmon] Triggered read INGRESS! Changing map index to {} ", index);
-    get_array_table<int>(CodeRewriter::SWAP_MASTER_INDEX_MAP, 0, ProgramType::INGRESS)
+    logger()->debug("[Dynmon] Triggered read INGRESS! Changing buffer index to {}", index);
+    get_array_table<int>(CodeRewriter::SWAP_INDEX_MAP, 0, ProgramType::INGRESS)
         .set(0, index);
     break;
   }
   default:
     throw std::runtime_error("Unable to handle compilation triggerReadIngress()");
   }
+}
 
+void Dynmon::initSwapMaps(SwapStateConfig &swapState, ProgramType type) {
+  for (auto &map : swapState.getSwappedMaps()) {
+    auto outer = get_raw_table(CodeRewriter::outerMapName(map), 0, type);
+    for (int i = 0; i < 2; i++) {
+      int fd = get_table_fd(CodeRewriter::bufferName(map, i), 0, type);
+      outer.set(&i, &fd);
+    }
+  }
+  get_array_table<int>(CodeRewriter::SWAP_INDEX_MAP, 0, type).set(0, 0);
 }
 
 std::shared_ptr<Metric> Dynmon::do_get_metric(const std::string& name, std::string mapName,
                                               ProgramType type,
                                               const std::shared_ptr<ExtractionOptions>& extractionOptions) {
-  int index = type == ProgramType::INGRESS ? ingressSwapState.getProgramIndexAndMapNameToRead(mapName) :
-              egressSwapState.getProgramIndexAndMapNameToRead(mapName);
+  mapName = type == ProgramType::INGRESS ? ingressSwapState.getMapNameToRead(mapName) :
+            egressSwapState.getMapNameToRead(mapName);
 
   auto value = MapExtractor::extractFromMap(*this, mapName,
-                                            index, type,
+                                            0, type,
                                             extractionOptions);
   return std::make_shared<Metric>(*this, name, value,
                                   Utils::genTimestampMicroSeconds());
 }
 
-std::string Dynmon::do_get_open_metric(const shared_ptr<MetricConfig>& config, ProgramType type) {
+std::string Dynmon::do_get_open_metric(const shared_ptr<MetricConfig>& config, ProgramType type,
+                                       nlohmann::json *entries) {
 
   auto extractionOptions = config->getExtractionOptions();
-  auto mapName = config->getMapName();
-  
-  int index = type == ProgramType::INGRESS ? ingressSwapState.getProgramIndexAndMapNameToRead(mapName) :
-      egressSwapState.getProgramIndexAndMapNameToRead(mapName);
-
-  auto value = MapExtractor::extractFromMap(*this, mapName,
-                                            index, type,
-                                            extractionOptions);
-  return toOpenMetrics(config, value);
+  auto mapName = type == ProgramType::INGRESS ?
+      ingressSwapState.getMapNameToRead(config->getMapName()) :
+      egressSwapState.getMapNameToRead(config->getMapName());
+
+  std::vector<const char *> sketches;
+  auto sketch = MapExtractor::extractSketches(*this, mapName, 0, type, extractionOptions, sketches,
+                                              entries);
+  if (sketch)
+    return toOpenMetrics(config, *sketch, sketches);
+
+  std::vector<uint64_t> values;
+  MapExtractor::extractNumbers(*this, mapName, 0, type, extractionOptions, values, entries);
+  return toOpenMetrics(config, values);
 }
\ No newline at end of file
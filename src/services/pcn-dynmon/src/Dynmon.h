@@ -2,6 +2,7 @@
 
 #include "../base/DynmonBase.h"
 #include "Dynmon_dp.h"
+#include "Dynmon_helpers.h"
 #include "extractor/MapExtractor.h"
 #include "models/DataplaneConfig.h"
 #include "models/Metric.h"
@@ -42,6 +43,19 @@ class Dynmon : public DynmonBase {
   void setIngressPathConfig(const PathConfigJsonObject &config);
   void resetIngressPathConfig();
 
+  /**
+   *  Periodic collection of the metrics, served to every reader until the next collection
+   */
+  std::shared_ptr<Collector> getCollector() override;
+  void setCollector(const CollectorJsonObject &config) override;
+  void resetCollector() override;
+
+  /**
+   *  Collects the metrics of both ingress and egress paths in JSON and
+   *  OpenMetrics format, reading every map once
+   */
+  std::shared_ptr<MetricsSnapshot> collect();
+
   /**
    *  Collected metrics in JSON format of both ingress and egress paths
    */
@@ -102,12 +116,41 @@ class Dynmon : public DynmonBase {
   /**
    * Function to parse a metric into OpenMetric format
    *
-   * @param conf  the metric configuration
-   * @param value the metric extracted value
-   * @return      the metric in OpenMetric format
+   * @param conf   the metric configuration
+   * @param values the metric extracted values
+   * @return       the metric in OpenMetric format
    */
   string toOpenMetrics(const std::shared_ptr<MetricConfig>& conf,
-                       nlohmann::json value);
+                       const std::vector<uint64_t> &values);
+
+  /**
+   * Function to parse a metric whose values are sketches of the datapath
+   * helpers into OpenMetric format
+   *
+   * @param conf   the metric configuration
+   * @param sketch the sketch stored in the map
+   * @param values the map values
+   * @return       the metric in OpenMetric format
+   */
+  string toOpenMetrics(const std::shared_ptr<MetricConfig>& conf, const Sketch &sketch,
+                       const std::vector<const char *> &values);
+
+  /**
+   * Function to join the labels of a metric in OpenMetric format
+   *
+   * @param conf the metric configuration
+   * @return     the labels, eg. a="1", b="2"
+   */
+  static string openMetricsLabels(const std::shared_ptr<MetricConfig>& conf);
+
+  /**
+   * Function to replace the #include <dynmon_helpers.h> directives of the
+   * injected code with the datapath helpers
+   *
+   * @param code the injected code
+   * @return     the code to be compiled
+   */
+  static string includeHelpers(const string &code);
 
   /**
    * Private function to retrieve a metric
@@ -126,9 +169,31 @@ class Dynmon : public DynmonBase {
    *
    * @param config  the entire metric configuration
    * @param type    the program type
+   * @param entries if not null, where the metric is stored also in JSON format
    * @return        the metric extracted
    */
-  std::string do_get_open_metric(const shared_ptr<MetricConfig>& config, ProgramType type);
+  std::string do_get_open_metric(const shared_ptr<MetricConfig>& config, ProgramType type,
+                                 nlohmann::json *entries = nullptr);
+
+  /**
+   * Private function to add a metric to a snapshot, in OpenMetric format too
+   * if it has the OpenMetrics metadata
+   *
+   * @param config   the entire metric configuration
+   * @param type     the program type
+   * @param snapshot the snapshot being collected
+   */
+  void collectMetric(const shared_ptr<MetricConfig>& config, ProgramType type,
+                     MetricsSnapshot &snapshot);
+
+  /**
+   * Private function to store the buffers of every swappable map in their
+   * outer map and to make the datapath use the first buffer
+   *
+   * @param swapState the swap state configuration of the path
+   * @param type      the program type
+   */
+  void initSwapMaps(SwapStateConfig &swapState, ProgramType type);
 
   /* The Swap state configuration for ingress path*/
   SwapStateConfig ingressSwapState;
@@ -137,4 +202,5 @@ class Dynmon : public DynmonBase {
   std::shared_ptr<DataplaneConfig> m_dpConfig;
   std::mutex m_ingressPathMutex;
   std::mutex m_egressPathMutex;
+  std::shared_ptr<Collector> m_collector;
 };
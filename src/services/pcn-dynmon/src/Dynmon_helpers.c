@@ -0,0 +1,256 @@
+/*
+ * Dynmon datapath helpers: histograms and sketches whose memory footprint does
+ * not depend on the number of observed flows.
+ *
+ * The injected code includes them with
+ *
+ *   #include <dynmon_helpers.h>
+ *
+ * then declares a BPF_ARRAY whose value is one of the following structs, looks
+ * up an entry and passes it to the helpers. Dynmon recognizes the structs by
+ * their name and exports them in the OpenMetrics format:
+ * - struct dynmon_log2_histogram and struct dynmon_linear_histogram as histograms
+ * - struct dynmon_count_min as a gauge with the total count
+ * - struct dynmon_hll as a gauge with the estimated number of distinct keys
+ * - struct dynmon_topk as a gauge per heavy hitter, labelled with its key
+ *
+ * Counters are updated with atomic operations, so the same entry can be shared
+ * by all the cpus; HyperLogLog registers and top-k entries are updated without
+ * locks, concurrent updates may rarely lose an observation.
+ *
+ * The sizes can be tuned defining the following macros before the include.
+ */
+#ifndef DYNMON_HELPERS
+#define DYNMON_HELPERS
+
+/* Number of slots of the linear histograms */
+#ifndef DYNMON_LINEAR_HISTOGRAM_SLOTS
+#define DYNMON_LINEAR_HISTOGRAM_SLOTS 32
+#endif
+
+/* Rows and columns of the count-min sketches, the columns must be a power of 2 */
+#ifndef DYNMON_COUNT_MIN_DEPTH
+#define DYNMON_COUNT_MIN_DEPTH 4
+#endif
+#ifndef DYNMON_COUNT_MIN_WIDTH
+#define DYNMON_COUNT_MIN_WIDTH 1024
+#endif
+
+/* HyperLogLog registers are 2^PRECISION, with a standard error of 1.04/sqrt(2^PRECISION) */
+#ifndef DYNMON_HLL_PRECISION
+#define DYNMON_HLL_PRECISION 10
+#endif
+
+/* Number of heavy hitters tracked by the top-k and type of their key */
+#ifndef DYNMON_TOPK_SIZE
+#define DYNMON_TOPK_SIZE 8
+#endif
+#ifndef DYNMON_TOPK_KEY
+#define DYNMON_TOPK_KEY u32
+#endif
+
+/* Maximum size of the keys hashed or compared by the helpers */
+#define DYNMON_KEY_MAX_LEN 64
+
+/*
+ * Slot i counts the values whose base 2 logarithm is i (0 is counted in slot 0)
+ */
+struct dynmon_log2_histogram {
+  u64 slots[64];
+  u64 sum;
+};
+
+/*
+ * Slot i counts the values in [min + i * step, min + (i + 1) * step); the first
+ * slot also counts the values lower than min, the last one the values higher
+ * than the range
+ */
+struct dynmon_linear_histogram {
+  u64 min;
+  u64 step;
+  u64 slots[DYNMON_LINEAR_HISTOGRAM_SLOTS];
+  u64 sum;
+};
+
+struct dynmon_count_min {
+  u32 counters[DYNMON_COUNT_MIN_DEPTH * DYNMON_COUNT_MIN_WIDTH];
+  u64 total;
+};
+
+struct dynmon_hll {
+  u8 registers[1 << DYNMON_HLL_PRECISION];
+};
+
+/*
+ * Empty entries have a zero count
+ */
+struct dynmon_topk {
+  DYNMON_TOPK_KEY keys[DYNMON_TOPK_SIZE];
+  u64 counts[DYNMON_TOPK_SIZE];
+};
+
+/* Murmur3 finalizer */
+static __always_inline u32 dynmon_mix(u32 h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+/* FNV-1a hash of a key of len bytes, followed by the murmur3 finalizer */
+static __always_inline u32 dynmon_hash(const void *key, u32 len) {
+  const u8 *data = key;
+  u32 h = 2166136261;
+#pragma unroll
+  for (int i = 0; i < DYNMON_KEY_MAX_LEN; i++) {
+    if (i >= len)
+      break;
+    h ^= data[i];
+    h *= 16777619;
+  }
+  return dynmon_mix(h);
+}
+
+static __always_inline u32 dynmon_log2(u64 v) {
+  u32 r = 0;
+  if (v >> 32) {
+    v >>= 32;
+    r += 32;
+  }
+  if (v >> 16) {
+    v >>= 16;
+    r += 16;
+  }
+  if (v >> 8) {
+    v >>= 8;
+    r += 8;
+  }
+  if (v >> 4) {
+    v >>= 4;
+    r += 4;
+  }
+  if (v >> 2) {
+    v >>= 2;
+    r += 2;
+  }
+  if (v >> 1)
+    r += 1;
+  return r;
+}
+
+static __always_inline void dynmon_log2_histogram_observe(
+    struct dynmon_log2_histogram *h, u64 value) {
+  u32 slot = dynmon_log2(value) & 63;
+  __sync_fetch_and_add(&h->slots[slot], 1);
+  __sync_fetch_and_add(&h->sum, value);
+}
+
+static __always_inline void dynmon_linear_histogram_observe(
+    struct dynmon_linear_histogram *h, u64 value, u64 min, u64 step) {
+  u64 slot = 0;
+  /* The bounds are stored in the histogram to let Dynmon export them */
+  if (h->min != min || h->step != step) {
+    h->min = min;
+    h->step = step;
+  }
+  if (value >= min && step > 0)
+    slot = (value - min) / step;
+  if (slot >= DYNMON_LINEAR_HISTOGRAM_SLOTS)
+    slot = DYNMON_LINEAR_HISTOGRAM_SLOTS - 1;
+  __sync_fetch_and_add(&h->slots[slot], 1);
+  __sync_fetch_and_add(&h->sum, value);
+}
+
+/*
+ * Adds increment to the count of a key and returns its estimated count.
+ * The rows are indexed by double hashing of a single hash of the key.
+ */
+static __always_inline u32 dynmon_count_min_update(
+    struct dynmon_count_min *s, const void *key, u32 len, u32 increment) {
+  u32 h1 = dynmon_hash(key, len);
+  u32 h2 = dynmon_mix(h1 ^ 0x9e3779b9) | 1;
+  u32 estimate = 0xffffffff;
+  __sync_fetch_and_add(&s->total, increment);
+#pragma unroll
+  for (int i = 0; i < DYNMON_COUNT_MIN_DEPTH; i++) {
+    u32 index = i * DYNMON_COUNT_MIN_WIDTH +
+                ((h1 + i * h2) & (DYNMON_COUNT_MIN_WIDTH - 1));
+    __sync_fetch_and_add(&s->counters[index], increment);
+    u32 count = s->counters[index];
+    if (count < estimate)
+      estimate = count;
+  }
+  return estimate;
+}
+
+/* Returns the estimated count of a key */
+static __always_inline u32 dynmon_count_min_estimate(
+    struct dynmon_count_min *s, const void *key, u32 len) {
+  u32 h1 = dynmon_hash(key, len);
+  u32 h2 = dynmon_mix(h1 ^ 0x9e3779b9) | 1;
+  u32 estimate = 0xffffffff;
+#pragma unroll
+  for (int i = 0; i < DYNMON_COUNT_MIN_DEPTH; i++) {
+    u32 index = i * DYNMON_COUNT_MIN_WIDTH +
+                ((h1 + i * h2) & (DYNMON_COUNT_MIN_WIDTH - 1));
+    u32 count = s->counters[index];
+    if (count < estimate)
+      estimate = count;
+  }
+  return estimate;
+}
+
+static __always_inline void dynmon_hll_add(struct dynmon_hll *s,
+                                           const void *key, u32 len) {
+  u32 h1 = dynmon_hash(key, len);
+  u64 hash = ((u64)h1 << 32) | dynmon_mix(h1 ^ 0x9e3779b9);
+  /* The first bits select the register, the position of the first 1 in the
+   * others is the rank */
+  u32 index = (hash >> (64 - DYNMON_HLL_PRECISION)) &
+              ((1 << DYNMON_HLL_PRECISION) - 1);
+  u64 rest = hash << DYNMON_HLL_PRECISION;
+  u8 rank = rest ? 64 - dynmon_log2(rest) : 64 - DYNMON_HLL_PRECISION + 1;
+  if (s->registers[index] < rank)
+    s->registers[index] = rank;
+}
+
+static __always_inline int dynmon_key_equal(const void *a, const void *b,
+                                            u32 len) {
+  const u8 *x = a, *y = b;
+#pragma unroll
+  for (int i = 0; i < DYNMON_KEY_MAX_LEN; i++) {
+    if (i >= len)
+      break;
+    if (x[i] != y[i])
+      return 0;
+  }
+  return 1;
+}
+
+/*
+ * Records the count of a key, usually the estimate returned by
+ * dynmon_count_min_update(): the key replaces the entry with the lowest count
+ * if its count is higher.
+ */
+static __always_inline void dynmon_topk_update(struct dynmon_topk *t,
+                                               DYNMON_TOPK_KEY *key, u64 count) {
+  u32 min = 0;
+#pragma unroll
+  for (int i = 0; i < DYNMON_TOPK_SIZE; i++) {
+    if (t->counts[i] > 0 && dynmon_key_equal(&t->keys[i], key, sizeof(*key))) {
+      if (count > t->counts[i])
+        t->counts[i] = count;
+      return;
+    }
+    if (t->counts[i] < t->counts[min])
+      min = i;
+  }
+  if (count > t->counts[min]) {
+    t->keys[min] = *key;
+    t->counts[min] = count;
+  }
+}
+
+#endif
@@ -26,6 +26,23 @@ Response create_dynmon_by_id_handler(
   }
 }
 
+Response create_dynmon_collector_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // Getting the body param
+    CollectorJsonObject unique_value{request_body};
+    create_dynmon_collector_by_id(unique_name, unique_value);
+    return {kCreated, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response create_dynmon_dataplane_config_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys,
@@ -90,6 +107,19 @@ Response delete_dynmon_by_id_handler(
   }
 }
 
+Response delete_dynmon_collector_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    delete_dynmon_collector_by_id(unique_name);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response delete_dynmon_dataplane_config_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys) {
@@ -144,6 +174,66 @@ Response read_dynmon_by_id_handler(
   }
 }
 
+Response read_dynmon_collector_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto x = read_dynmon_collector_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response read_dynmon_collector_interval_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto x = read_dynmon_collector_interval_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response read_dynmon_collector_push_deltas_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto x = read_dynmon_collector_push_deltas_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response read_dynmon_collector_push_url_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto x = read_dynmon_collector_push_url_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response read_dynmon_dataplane_config_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys) {
@@ -252,6 +342,27 @@ Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_opti
   }
 }
 
+Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_percpu_aggregation_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  std::string unique_metricConfigsName;
+  for (size_t i = 0; i < num_keys; ++i)
+    if (!strcmp(keys[i].name, "metric-configs_name")) {
+      unique_metricConfigsName = std::string{keys[i].value.string};
+      break;
+    }
+  try {
+    auto x = read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_percpu_aggregation_by_id(unique_name, unique_metricConfigsName);
+    nlohmann::json response_body;
+    response_body = ExtractionOptionsJsonObject::PercpuAggregationEnum_to_string(x);
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_swap_on_read_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys) {
@@ -545,6 +656,25 @@ Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_opt
   }
 }
 
+Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_percpu_aggregation_by_id_handler(const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name{name};
+  std::string unique_metricConfigsName;
+  for (size_t i = 0; i < num_keys; ++i)
+    if (!strcmp(keys[i].name, "metric-configs_name")) {
+      unique_metricConfigsName = std::string{keys[i].value.string};
+      break;
+    }
+  try {
+    auto x = read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_percpu_aggregation_by_id(unique_name, unique_metricConfigsName);
+    nlohmann::json response_body;
+    response_body = ExtractionOptionsJsonObject::PercpuAggregationEnum_to_string(x);
+    return {kOk, ::strdup(response_body.dump().c_str())};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_swap_on_read_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys) {
@@ -978,6 +1108,23 @@ Response replace_dynmon_by_id_handler(
   }
 }
 
+Response replace_dynmon_collector_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // Getting the body param
+    CollectorJsonObject unique_value{request_body};
+    replace_dynmon_collector_by_id(unique_name, unique_value);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response replace_dynmon_dataplane_config_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys,
@@ -1047,6 +1194,74 @@ Response update_dynmon_by_id_handler(
   }
 }
 
+Response update_dynmon_collector_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // Getting the body param
+    CollectorJsonObject unique_value{request_body};
+    update_dynmon_collector_by_id(unique_name, unique_value);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response update_dynmon_collector_interval_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_dynmon_collector_interval_by_id(unique_name, unique_value);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response update_dynmon_collector_push_deltas_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // The conversion is done automatically by the json library
+    bool unique_value = request_body;
+    update_dynmon_collector_push_deltas_by_id(unique_name, unique_value);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
+Response update_dynmon_collector_push_url_by_id_handler(
+    const char *name, const Key *keys,
+    size_t num_keys,
+    const char *value) {
+  // Getting the path params
+  std::string unique_name{name};
+  try {
+    auto request_body = nlohmann::json::parse(std::string{value});
+    // The conversion is done automatically by the json library
+    std::string unique_value = request_body;
+    update_dynmon_collector_push_url_by_id(unique_name, unique_value);
+    return {kOk, nullptr};
+  } catch (const std::exception &e) {
+    return {kGenericError, ::strdup(e.what())};
+  }
+}
+
 Response update_dynmon_dataplane_config_by_id_handler(
     const char *name, const Key *keys,
     size_t num_keys,
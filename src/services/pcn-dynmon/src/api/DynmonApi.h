@@ -4,6 +4,7 @@
 #include "polycube/services/response.h"
 #include "polycube/services/shared_lib_elements.h"
 
+#include "CollectorJsonObject.h"
 #include "DataplaneConfigJsonObject.h"
 #include "DynmonJsonObject.h"
 #include "ExtractionOptionsJsonObject.h"
@@ -20,22 +21,29 @@ extern "C" {
 #endif
 
 Response create_dynmon_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_dynmon_collector_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_dynmon_dataplane_config_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_dynmon_dataplane_config_egress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_dynmon_dataplane_config_ingress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response delete_dynmon_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_dynmon_collector_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_dynmon_dataplane_config_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_dynmon_dataplane_config_egress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_dynmon_dataplane_config_ingress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 
 Response read_dynmon_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_collector_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_collector_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_collector_push_deltas_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_collector_push_url_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_code_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_empty_on_read_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_percpu_aggregation_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_swap_on_read_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_egress_path_metric_configs_map_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -51,6 +59,7 @@ Response read_dynmon_dataplane_config_ingress_path_code_by_id_handler(const char
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_empty_on_read_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_percpu_aggregation_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_swap_on_read_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_dynmon_dataplane_config_ingress_path_metric_configs_map_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -74,11 +83,16 @@ Response read_dynmon_metrics_ingress_metrics_value_by_id_handler(const char *nam
 Response read_dynmon_open_metrics_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 
 Response replace_dynmon_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_dynmon_collector_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_dynmon_dataplane_config_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_dynmon_dataplane_config_egress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_dynmon_dataplane_config_ingress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response update_dynmon_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_dynmon_collector_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_dynmon_collector_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_dynmon_collector_push_deltas_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_dynmon_collector_push_url_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_dynmon_dataplane_config_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_dynmon_dataplane_config_egress_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_dynmon_dataplane_config_egress_path_name_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -65,6 +65,23 @@ namespace polycube {
           return r;
         }
 
+        /**
+         * @brief   Create collector by ID
+         *
+         * Create operation of resource: collector*
+         *
+         * @param[in] name ID of name
+         * @param[in] value collectorbody object
+         *
+         * Responses:
+         *
+         */
+        void
+        create_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value) {
+          auto dynmon = get_cube(name);
+          return dynmon->setCollector(value);
+        }
+
         /**
          * @brief   Create dataplane-config by ID
          *
@@ -120,6 +137,22 @@ namespace polycube {
           return dataplaneConfig->addIngressPathConfig(value);
         }
 
+        /**
+         * @brief   Delete collector by ID
+         *
+         * Delete operation of resource: collector*
+         *
+         * @param[in] name ID of name
+         *
+         * Responses:
+         *
+         */
+        void
+        delete_dynmon_collector_by_id(const std::string &name) {
+          auto dynmon = get_cube(name);
+          return dynmon->resetCollector();
+        }
+
         /**
          * @brief   Delete dataplane-config by ID
          *
@@ -183,6 +216,70 @@ namespace polycube {
           return get_cube(name)->toJsonObject();
         }
 
+        /**
+         * @brief   Read collector by ID
+         *
+         * Read operation of resource: collector*
+         *
+         * @param[in] name ID of name
+         *
+         * Responses:
+         * CollectorJsonObject
+         */
+        CollectorJsonObject
+        read_dynmon_collector_by_id(const std::string &name) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->toJsonObject();
+        }
+
+        /**
+         * @brief   Read interval by ID
+         *
+         * Read operation of resource: interval*
+         *
+         * @param[in] name ID of name
+         *
+         * Responses:
+         * uint32_t
+         */
+        uint32_t
+        read_dynmon_collector_interval_by_id(const std::string &name) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->getInterval();
+        }
+
+        /**
+         * @brief   Read push-deltas by ID
+         *
+         * Read operation of resource: push-deltas*
+         *
+         * @param[in] name ID of name
+         *
+         * Responses:
+         * bool
+         */
+        bool
+        read_dynmon_collector_push_deltas_by_id(const std::string &name) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->getPushDeltas();
+        }
+
+        /**
+         * @brief   Read push-url by ID
+         *
+         * Read operation of resource: push-url*
+         *
+         * @param[in] name ID of name
+         *
+         * Responses:
+         * std::string
+         */
+        std::string
+        read_dynmon_collector_push_url_by_id(const std::string &name) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->getPushUrl();
+        }
+
         /**
          * @brief   Read dataplane-config by ID
          *
@@ -298,6 +395,28 @@ namespace polycube {
           return extractionOptions->getEmptyOnRead();
         }
 
+        /**
+         * @brief   Read percpu-aggregation by ID
+         *
+         * Read operation of resource: percpu-aggregation*
+         *
+         * @param[in] name ID of name
+         * @param[in] metricConfigsName ID of metric-configs_name
+         *
+         * Responses:
+         * PercpuAggregationEnum
+         */
+        PercpuAggregationEnum
+        read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_percpu_aggregation_by_id(
+            const std::string &name, const std::string &metricConfigsName) {
+          auto dynmon = get_cube(name);
+          auto dataplaneConfig = dynmon->getDataplaneConfig();
+          auto egress = dataplaneConfig->getEgressPathConfig();
+          auto metricConfigs = egress->getMetricConfig(metricConfigsName);
+          auto extractionOptions = metricConfigs->getExtractionOptions();
+          return extractionOptions->getPercpuAggregation();
+        }
+
         /**
          * @brief   Read swap-on-read by ID
          *
@@ -617,6 +736,28 @@ namespace polycube {
           return extractionOptions->getEmptyOnRead();
         }
 
+        /**
+         * @brief   Read percpu-aggregation by ID
+         *
+         * Read operation of resource: percpu-aggregation*
+         *
+         * @param[in] name ID of name
+         * @param[in] metricConfigsName ID of metric-configs_name
+         *
+         * Responses:
+         * PercpuAggregationEnum
+         */
+        PercpuAggregationEnum
+        read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_percpu_aggregation_by_id(
+            const std::string &name, const std::string &metricConfigsName) {
+          auto dynmon = get_cube(name);
+          auto dataplaneConfig = dynmon->getDataplaneConfig();
+          auto ingress = dataplaneConfig->getIngressPathConfig();
+          auto metricConfigs = ingress->getMetricConfig(metricConfigsName);
+          auto extractionOptions = metricConfigs->getExtractionOptions();
+          return extractionOptions->getPercpuAggregation();
+        }
+
         /**
          * @brief   Read swap-on-read by ID
          *
@@ -1022,6 +1163,24 @@ namespace polycube {
           return dynmon->getOpenMetrics();
         }
 
+        /**
+         * @brief   Replace collector by ID
+         *
+         * Replace operation of resource: collector*
+         *
+         * @param[in] name ID of name
+         * @param[in] value collectorbody object
+         *
+         * Responses:
+         *
+         */
+        void
+        replace_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value) {
+          auto dynmon = get_cube(name);
+          dynmon->resetCollector();
+          return dynmon->setCollector(value);
+        }
+
         /**
          * @brief   Replace dataplane-config by ID
          *
@@ -1092,6 +1251,74 @@ namespace polycube {
           return dynmon->update(value);
         }
 
+        /**
+         * @brief   Update collector by ID
+         *
+         * Update operation of resource: collector*
+         *
+         * @param[in] name ID of name
+         * @param[in] value collectorbody object
+         *
+         * Responses:
+         *
+         */
+        void
+        update_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value) {
+          auto dynmon = get_cube(name);
+          return dynmon->setCollector(value);
+        }
+
+        /**
+         * @brief   Update interval by ID
+         *
+         * Update operation of resource: interval*
+         *
+         * @param[in] name ID of name
+         * @param[in] value Interval between two collections of the metrics (in seconds)
+         *
+         * Responses:
+         *
+         */
+        void
+        update_dynmon_collector_interval_by_id(const std::string &name, const uint32_t &value) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->setInterval(value);
+        }
+
+        /**
+         * @brief   Update push-deltas by ID
+         *
+         * Update operation of resource: push-deltas*
+         *
+         * @param[in] name ID of name
+         * @param[in] value When true, only the metrics changed since the previous push are pushed
+         *
+         * Responses:
+         *
+         */
+        void
+        update_dynmon_collector_push_deltas_by_id(const std::string &name, const bool &value) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->setPushDeltas(value);
+        }
+
+        /**
+         * @brief   Update push-url by ID
+         *
+         * Update operation of resource: push-url*
+         *
+         * @param[in] name ID of name
+         * @param[in] value HTTP endpoint where the metrics are pushed
+         *
+         * Responses:
+         *
+         */
+        void
+        update_dynmon_collector_push_url_by_id(const std::string &name, const std::string &value) {
+          auto dynmon = get_cube(name);
+          return dynmon->getCollector()->setPushUrl(value);
+        }
+
         /**
          * @brief   Update dataplane-config by ID
          *
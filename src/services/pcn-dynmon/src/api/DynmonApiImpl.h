@@ -5,6 +5,7 @@
 #include <memory>
 #include <mutex>
 
+#include "CollectorJsonObject.h"
 #include "DataplaneConfigJsonObject.h"
 #include "DynmonJsonObject.h"
 #include "ExtractionOptionsJsonObject.h"
@@ -22,20 +23,27 @@ namespace polycube {
       using namespace polycube::service::model;
       namespace DynmonApiImpl {
         void create_dynmon_by_id(const std::string &name, const DynmonJsonObject &value);
+        void create_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value);
         void create_dynmon_dataplane_config_by_id(const std::string &name, const DataplaneConfigJsonObject &value);
         void create_dynmon_dataplane_config_egress_path_by_id(const std::string &name, const PathConfigJsonObject &value);
         void create_dynmon_dataplane_config_ingress_path_by_id(const std::string &name, const PathConfigJsonObject &value);
         void delete_dynmon_by_id(const std::string &name);
+        void delete_dynmon_collector_by_id(const std::string &name);
         void delete_dynmon_dataplane_config_by_id(const std::string &name);
         void delete_dynmon_dataplane_config_egress_path_by_id(const std::string &name);
         void delete_dynmon_dataplane_config_ingress_path_by_id(const std::string &name);
         DynmonJsonObject read_dynmon_by_id(const std::string &name);
+        CollectorJsonObject read_dynmon_collector_by_id(const std::string &name);
+        uint32_t read_dynmon_collector_interval_by_id(const std::string &name);
+        bool read_dynmon_collector_push_deltas_by_id(const std::string &name);
+        std::string read_dynmon_collector_push_url_by_id(const std::string &name);
         DataplaneConfigJsonObject read_dynmon_dataplane_config_by_id(const std::string &name);
         PathConfigJsonObject read_dynmon_dataplane_config_egress_path_by_id(const std::string &name);
         std::string read_dynmon_dataplane_config_egress_path_code_by_id(const std::string &name);
         MetricConfigJsonObject read_dynmon_dataplane_config_egress_path_metric_configs_by_id(const std::string &name, const std::string &metricConfigsName);
         ExtractionOptionsJsonObject read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_by_id(const std::string &name, const std::string &metricConfigsName);
         bool read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_empty_on_read_by_id(const std::string &name, const std::string &metricConfigsName);
+        PercpuAggregationEnum read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_percpu_aggregation_by_id(const std::string &name, const std::string &metricConfigsName);
         bool read_dynmon_dataplane_config_egress_path_metric_configs_extraction_options_swap_on_read_by_id(const std::string &name, const std::string &metricConfigsName);
         std::vector<MetricConfigJsonObject> read_dynmon_dataplane_config_egress_path_metric_configs_list_by_id(const std::string &name);
         std::string read_dynmon_dataplane_config_egress_path_metric_configs_map_name_by_id(const std::string &name, const std::string &metricConfigsName);
@@ -51,6 +59,7 @@ namespace polycube {
         MetricConfigJsonObject read_dynmon_dataplane_config_ingress_path_metric_configs_by_id(const std::string &name, const std::string &metricConfigsName);
         ExtractionOptionsJsonObject read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_by_id(const std::string &name, const std::string &metricConfigsName);
         bool read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_empty_on_read_by_id(const std::string &name, const std::string &metricConfigsName);
+        PercpuAggregationEnum read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_percpu_aggregation_by_id(const std::string &name, const std::string &metricConfigsName);
         bool read_dynmon_dataplane_config_ingress_path_metric_configs_extraction_options_swap_on_read_by_id(const std::string &name, const std::string &metricConfigsName);
         std::vector<MetricConfigJsonObject> read_dynmon_dataplane_config_ingress_path_metric_configs_list_by_id(const std::string &name);
         std::string read_dynmon_dataplane_config_ingress_path_metric_configs_map_name_by_id(const std::string &name, const std::string &metricConfigsName);
@@ -73,10 +82,15 @@ namespace polycube {
         nlohmann::json read_dynmon_metrics_ingress_metrics_value_by_id(const std::string &name, const std::string &ingressName);
         std::string read_dynmon_open_metrics_by_id(const std::string &name);
         void replace_dynmon_by_id(const std::string &name, const DynmonJsonObject &value);
+        void replace_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value);
         void replace_dynmon_dataplane_config_by_id(const std::string &name, const DataplaneConfigJsonObject &value);
         void replace_dynmon_dataplane_config_egress_path_by_id(const std::string &name, const PathConfigJsonObject &value);
         void replace_dynmon_dataplane_config_ingress_path_by_id(const std::string &name, const PathConfigJsonObject &value);
         void update_dynmon_by_id(const std::string &name, const DynmonJsonObject &value);
+        void update_dynmon_collector_by_id(const std::string &name, const CollectorJsonObject &value);
+        void update_dynmon_collector_interval_by_id(const std::string &name, const uint32_t &value);
+        void update_dynmon_collector_push_deltas_by_id(const std::string &name, const bool &value);
+        void update_dynmon_collector_push_url_by_id(const std::string &name, const std::string &value);
         void update_dynmon_dataplane_config_by_id(const std::string &name, const DataplaneConfigJsonObject &value);
         void update_dynmon_dataplane_config_egress_path_by_id(const std::string &name, const PathConfigJsonObject &value);
         void update_dynmon_dataplane_config_egress_path_name_by_id(const std::string &name, const std::string &value);
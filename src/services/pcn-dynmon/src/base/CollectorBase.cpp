@@ -0,0 +1,28 @@
+#include "CollectorBase.h"
+#include "../Dynmon.h"
+
+CollectorBase::CollectorBase(Dynmon &parent)
+    : parent_(parent) {}
+
+void CollectorBase::update(const CollectorJsonObject &conf) {
+  if (conf.pushUrlIsSet())
+    setPushUrl(conf.getPushUrl());
+  if (conf.pushDeltasIsSet())
+    setPushDeltas(conf.getPushDeltas());
+  if (conf.intervalIsSet())
+    setInterval(conf.getInterval());
+}
+
+CollectorJsonObject CollectorBase::toJsonObject() {
+  CollectorJsonObject conf;
+  conf.setInterval(getInterval());
+  auto pushUrl = getPushUrl();
+  if (!pushUrl.empty())
+    conf.setPushUrl(pushUrl);
+  conf.setPushDeltas(getPushDeltas());
+  return conf;
+}
+
+std::shared_ptr<spdlog::logger> CollectorBase::logger() {
+  return parent_.logger();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../serializer/CollectorJsonObject.h"
+#include <spdlog/spdlog.h>
+
+using namespace polycube::service::model;
+
+class Dynmon;
+
+class CollectorBase {
+ public:
+  explicit CollectorBase(Dynmon &parent);
+  virtual ~CollectorBase() = default;
+  virtual void update(const CollectorJsonObject &conf);
+  virtual CollectorJsonObject toJsonObject();
+
+  /**
+   *  Interval between two collections of the metrics (in seconds); when 0, the metrics are collected every time they are read
+   */
+  virtual uint32_t getInterval() = 0;
+  virtual void setInterval(const uint32_t &value) = 0;
+
+  /**
+   *  HTTP endpoint (e.g., 'http://127.0.0.1:9091/metrics/job/dynmon') where the metrics in OpenMetrics format are pushed after every collection
+   */
+  virtual std::string getPushUrl() = 0;
+  virtual void setPushUrl(const std::string &value) = 0;
+
+  /**
+   *  When true, only the metrics changed since the previous push are pushed
+   */
+  virtual bool getPushDeltas() = 0;
+  virtual void setPushDeltas(const bool &value) = 0;
+
+  std::shared_ptr<spdlog::logger> logger();
+
+ protected:
+  Dynmon &parent_;
+};
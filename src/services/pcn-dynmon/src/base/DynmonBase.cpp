@@ -9,6 +9,9 @@ void DynmonBase::update(const DynmonJsonObject &conf) {
   if (conf.dataplaneConfigIsSet()) {
     setDataplaneConfig(conf.getDataplaneConfig());
   }
+  if (conf.collectorIsSet()) {
+    setCollector(conf.getCollector());
+  }
 }
 
 DynmonJsonObject DynmonBase::toJsonObject() {
@@ -18,6 +21,7 @@ DynmonJsonObject DynmonBase::toJsonObject() {
   auto dpConfig = getDataplaneConfig();
   if (dpConfig != nullptr)
     conf.setDataplaneConfig(dpConfig->toJsonObject());
+  conf.setCollector(getCollector()->toJsonObject());
   conf.setMetrics(getMetrics()->toJsonObject());
   return conf;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../models/Collector.h"
 #include "../models/DataplaneConfig.h"
 #include "../models/Metrics.h"
 #include "../serializer/DynmonJsonObject.h"
@@ -24,6 +25,13 @@ class DynmonBase : public virtual polycube::service::TransparentCube {
   virtual void setDataplaneConfig(const DataplaneConfigJsonObject &value) = 0;
   virtual void resetDataplaneConfig() = 0;
 
+  /**
+   *  Periodic collection of the metrics, served to every reader until the next collection
+   */
+  virtual std::shared_ptr<Collector> getCollector() = 0;
+  virtual void setCollector(const CollectorJsonObject &value) = 0;
+  virtual void resetCollector() = 0;
+
   /**
    *  Collected metrics in JSON format
    */
@@ -10,6 +10,7 @@ ExtractionOptionsJsonObject ExtractionOptionsBase::toJsonObject() {
   ExtractionOptionsJsonObject conf;
   conf.setSwapOnRead(getSwapOnRead());
   conf.setEmptyOnRead(getEmptyOnRead());
+  conf.setPercpuAggregation(getPercpuAggregation());
   return conf;
 }
 
@@ -24,6 +24,11 @@ class ExtractionOptionsBase {
    */
   virtual bool getEmptyOnRead() = 0;
 
+  /**
+   *  Reduction of the per-cpu values of PERCPU maps; when None, every value is the array of the per-cpu values
+   */
+  virtual PercpuAggregationEnum getPercpuAggregation() = 0;
+
   std::shared_ptr<spdlog::logger> logger();
 
  protected:
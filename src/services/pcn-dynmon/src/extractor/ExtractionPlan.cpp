@@ -0,0 +1,405 @@
+#include "ExtractionPlan.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#define PADDING "__pad_"
+
+using std::runtime_error;
+using std::string;
+
+namespace {
+
+/**
+ * Reads a value of type T from a possibly unaligned memory block
+ */
+template <typename T>
+T read(const char *address) {
+  T value;
+  std::memcpy(&value, address, sizeof(T));
+  return value;
+}
+
+/**
+ * Merges the value of type T at address into the one at accumulator
+ */
+template <typename T>
+void merge(PercpuAggregationEnum aggregation, char *accumulator, const char *address) {
+  T result = read<T>(accumulator);
+  T value = read<T>(address);
+  switch (aggregation) {
+  case PercpuAggregationEnum::SUM:
+    result += value;
+    break;
+  case PercpuAggregationEnum::MIN:
+    if (value < result)
+      result = value;
+    break;
+  case PercpuAggregationEnum::MAX:
+    if (value > result)
+      result = value;
+    break;
+  default:
+    return;
+  }
+  std::memcpy(accumulator, &result, sizeof(T));
+}
+
+}  // namespace
+
+ExtractionPlan::ExtractionPlan(const string &description) {
+  size_t offset = 0;
+  auto object = json::parse(description);
+  root = compile(object, offset);
+  if (object.is_array() && object.size() == 3 && object[2].is_string())
+    type_name = object[0].get<string>();
+}
+
+size_t ExtractionPlan::compile(const json &object, size_t &offset) {
+  // A primitive type
+  if (object.is_string())
+    return addPrimitive(Kind::PRIMITIVE, object.get<string>(), offset, 1);
+
+  if (object.is_array() && object.size() == 2)
+    // A property of a struct, described by its type
+    return compile(object[1], offset);
+
+  if (object.is_array() && object.size() == 3) {
+    if (object[2].is_string()) {
+      auto type = object[2].get<string>();
+      if (type == "struct" || type == "struct_packed") {
+        Node node{Kind::STRUCT};
+        for (auto &property : object[1]) {
+          auto name = property[0].get<string>();
+          // Alignment paddings are skipped increasing the offset
+          if (name.rfind(PADDING, 0) == 0)
+            offset += property[2][0].get<size_t>();
+          else
+            node.fields.emplace_back(name, compile(property, offset));
+        }
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+      }
+      if (type == "union") {
+        // Every type of the union starts at the same offset, the union
+        // spans as much as its biggest type
+        Node node{Kind::UNION};
+        size_t start = offset, end = 0;
+        for (auto &property : object[1]) {
+          offset = start;
+          node.fields.emplace_back(property[0].get<string>(),
+                                   compile(property, offset));
+          if (offset > end)
+            end = offset;
+        }
+        offset = end;
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+      }
+      if (type == "enum") {
+        Node node{Kind::ENUM};
+        node.offset = offset;
+        node.enum_values = object[1].get<std::vector<string>>();
+        offset += sizeof(int);
+        nodes.push_back(std::move(node));
+        return nodes.size() - 1;
+      }
+      throw runtime_error("Unknown type " + type);
+    }
+    if (object[2].is_array()) {
+      // An array property
+      auto len = object[2][0].get<size_t>();
+      if (object[1].is_string()) {
+        auto type_name = object[1].get<string>();
+        auto kind = type_name == "signed char" || type_name == "unsigned char"
+                        ? Kind::STRING
+                        : Kind::PRIMITIVE_ARRAY;
+        return addPrimitive(kind, type_name, offset, len);
+      }
+      // The element of an array of complex types is compiled once, with
+      // offsets relative to the beginning of each element
+      size_t stride = 0;
+      auto element = compile(object[1], stride);
+      Node node{Kind::ARRAY};
+      node.name = object[0].get<string>();
+      node.offset = offset;
+      node.len = len;
+      node.stride = stride;
+      node.fields.emplace_back("", element);
+      offset += stride * len;
+      nodes.push_back(std::move(node));
+      return nodes.size() - 1;
+    }
+    if (object[2].is_number() && object[1].is_string())
+      // A bitfield property
+      return compile(object[1], offset);
+    throw runtime_error("Unknown element " + object[0].dump());
+  }
+  throw runtime_error("Unable to identifyObject " + object.dump());
+}
+
+size_t ExtractionPlan::addPrimitive(Kind kind, const string &type_name,
+                                    size_t &offset, size_t len) {
+  Node node{kind};
+  node.primitive = parsePrimitive(type_name);
+  node.offset = offset;
+  node.len = len;
+  offset += primitiveSize(node.primitive) * len;
+  nodes.push_back(std::move(node));
+  return nodes.size() - 1;
+}
+
+json ExtractionPlan::toJson(const char *data) const {
+  return nodeToJson(nodes[root], data);
+}
+
+bool ExtractionPlan::isNumber() const {
+  return nodes[root].kind == Kind::PRIMITIVE;
+}
+
+uint64_t ExtractionPlan::toNumber(const char *data) const {
+  auto &node = nodes[root];
+  if (node.kind != Kind::PRIMITIVE)
+    throw runtime_error("The value is not a number");
+  return primitiveToJson(node.primitive, data + node.offset).get<uint64_t>();
+}
+
+json ExtractionPlan::nodeToJson(const Node &node, const char *data) const {
+  auto address = data + node.offset;
+  switch (node.kind) {
+  case Kind::PRIMITIVE:
+    return primitiveToJson(node.primitive, address);
+
+  case Kind::PRIMITIVE_ARRAY: {
+    json array = json::array();
+    auto size = primitiveSize(node.primitive);
+    for (size_t i = 0; i < node.len; i++)
+      array.push_back(primitiveToJson(node.primitive, address + i * size));
+    return array;
+  }
+
+  case Kind::STRING:
+    return string(address, strnlen(address, node.len));
+
+  case Kind::STRUCT:
+  case Kind::UNION: {
+    json object;
+    for (auto &field : node.fields)
+      object[field.first] = nodeToJson(nodes[field.second], data);
+    return object;
+  }
+
+  case Kind::ENUM: {
+    auto index = read<int>(address);
+    if (index < 0 || static_cast<size_t>(index) >= node.enum_values.size())
+      return index;
+    return node.enum_values[index];
+  }
+
+  case Kind::ARRAY: {
+    json array;
+    auto &element = nodes[node.fields[0].second];
+    for (size_t i = 0; i < node.len; i++)
+      array.push_back(nodeToJson(element, address + i * node.stride));
+    return json::array({node.name, array});
+  }
+  }
+  throw runtime_error("Unhandled node type - nodeToJson()");
+}
+
+void ExtractionPlan::aggregate(PercpuAggregationEnum aggregation,
+                               char *accumulator, const char *data) const {
+  aggregateNode(nodes[root], aggregation, accumulator, data);
+}
+
+void ExtractionPlan::aggregateNode(const Node &node, PercpuAggregationEnum aggregation,
+                                   char *accumulator, const char *data) const {
+  switch (node.kind) {
+  case Kind::PRIMITIVE:
+  case Kind::PRIMITIVE_ARRAY: {
+    auto size = primitiveSize(node.primitive);
+    for (size_t i = 0; i < node.len; i++)
+      aggregatePrimitive(node.primitive, aggregation,
+                         accumulator + node.offset + i * size,
+                         data + node.offset + i * size);
+    break;
+  }
+
+  case Kind::STRUCT:
+    for (auto &field : node.fields)
+      aggregateNode(nodes[field.second], aggregation, accumulator, data);
+    break;
+
+  case Kind::ARRAY: {
+    auto &element = nodes[node.fields[0].second];
+    for (size_t i = 0; i < node.len; i++)
+      aggregateNode(element, aggregation,
+                    accumulator + node.offset + i * node.stride,
+                    data + node.offset + i * node.stride);
+    break;
+  }
+
+  case Kind::STRING:
+  case Kind::UNION:
+  case Kind::ENUM:
+    break;
+  }
+}
+
+const string &ExtractionPlan::getTypeName() const {
+  return type_name;
+}
+
+bool ExtractionPlan::findProperty(const string &name, size_t &offset,
+                                  size_t &size) const {
+  auto &node = nodes[root];
+  if (node.kind != Kind::STRUCT)
+    return false;
+  for (auto &field : node.fields) {
+    if (field.first != name)
+      continue;
+    auto &property = nodes[field.second];
+    offset = property.offset;
+    switch (property.kind) {
+    case Kind::PRIMITIVE:
+    case Kind::PRIMITIVE_ARRAY:
+    case Kind::STRING:
+      size = primitiveSize(property.primitive) * property.len;
+      return true;
+    case Kind::ENUM:
+      size = sizeof(int);
+      return true;
+    case Kind::ARRAY:
+      size = property.stride * property.len;
+      return true;
+    default:
+      return false;
+    }
+  }
+  return false;
+}
+
+ExtractionPlan::Primitive ExtractionPlan::parsePrimitive(const string &type_name) {
+  static const std::vector<std::pair<string, Primitive>> primitives = {
+      {"int", Primitive::INT},
+      {"char", Primitive::CHAR},
+      {"short", Primitive::SHORT},
+      {"long", Primitive::LONG},
+      {"float", Primitive::FLOAT},
+      {"double", Primitive::DOUBLE},
+      {"long long", Primitive::LONG_LONG},
+      {"long double", Primitive::LONG_DOUBLE},
+      {"signed char", Primitive::SIGNED_CHAR},
+      {"unsigned int", Primitive::UNSIGNED_INT},
+      {"unsigned char", Primitive::UNSIGNED_CHAR},
+      {"unsigned long", Primitive::UNSIGNED_LONG},
+      {"unsigned short", Primitive::UNSIGNED_SHORT},
+      {"unsigned long long", Primitive::UNSIGNED_LONG_LONG}};
+  for (auto &p : primitives)
+    if (p.first == type_name)
+      return p.second;
+  throw runtime_error("ERROR: " + type_name + " not a valid type!");
+}
+
+size_t ExtractionPlan::primitiveSize(Primitive primitive) {
+  switch (primitive) {
+  case Primitive::INT:
+    return sizeof(int);
+  case Primitive::CHAR:
+    return sizeof(char);
+  case Primitive::SHORT:
+    return sizeof(short);
+  case Primitive::LONG:
+    return sizeof(long);
+  case Primitive::FLOAT:
+    return sizeof(float);
+  case Primitive::DOUBLE:
+    return sizeof(double);
+  case Primitive::LONG_LONG:
+    return sizeof(long long);
+  case Primitive::LONG_DOUBLE:
+    return sizeof(long double);
+  case Primitive::SIGNED_CHAR:
+    return sizeof(signed char);
+  case Primitive::UNSIGNED_INT:
+    return sizeof(unsigned int);
+  case Primitive::UNSIGNED_CHAR:
+    return sizeof(unsigned char);
+  case Primitive::UNSIGNED_LONG:
+    return sizeof(unsigned long);
+  case Primitive::UNSIGNED_SHORT:
+    return sizeof(unsigned short);
+  case Primitive::UNSIGNED_LONG_LONG:
+    return sizeof(unsigned long long);
+  }
+  return 0;
+}
+
+json ExtractionPlan::primitiveToJson(Primitive primitive, const char *address) {
+  // Casting the memory pointed by address to the corresponding C type
+  switch (primitive) {
+  case Primitive::INT:
+    return read<int>(address);
+  case Primitive::CHAR:
+    return read<char>(address);
+  case Primitive::SHORT:
+    return read<short>(address);
+  case Primitive::LONG:
+    return read<long>(address);
+  case Primitive::FLOAT:
+    return read<float>(address);
+  case Primitive::DOUBLE:
+    return read<double>(address);
+  case Primitive::LONG_LONG:
+    return read<long long>(address);
+  case Primitive::LONG_DOUBLE:
+    return read<long double>(address);
+  case Primitive::SIGNED_CHAR:
+    return read<signed char>(address);
+  case Primitive::UNSIGNED_INT:
+    return read<unsigned int>(address);
+  case Primitive::UNSIGNED_CHAR:
+    return read<unsigned char>(address);
+  case Primitive::UNSIGNED_LONG:
+    return read<unsigned long>(address);
+  case Primitive::UNSIGNED_SHORT:
+    return read<unsigned short>(address);
+  case Primitive::UNSIGNED_LONG_LONG:
+    return read<unsigned long long>(address);
+  }
+  return nullptr;
+}
+
+void ExtractionPlan::aggregatePrimitive(Primitive primitive, PercpuAggregationEnum aggregation,
+                                        char *accumulator, const char *address) {
+  switch (primitive) {
+  case Primitive::INT:
+    return merge<int>(aggregation, accumulator, address);
+  case Primitive::CHAR:
+    return merge<char>(aggregation, accumulator, address);
+  case Primitive::SHORT:
+    return merge<short>(aggregation, accumulator, address);
+  case Primitive::LONG:
+    return merge<long>(aggregation, accumulator, address);
+  case Primitive::FLOAT:
+    return merge<float>(aggregation, accumulator, address);
+  case Primitive::DOUBLE:
+    return merge<double>(aggregation, accumulator, address);
+  case Primitive::LONG_LONG:
+    return merge<long long>(aggregation, accumulator, address);
+  case Primitive::LONG_DOUBLE:
+    return merge<long double>(aggregation, accumulator, address);
+  case Primitive::SIGNED_CHAR:
+    return merge<signed char>(aggregation, accumulator, address);
+  case Primitive::UNSIGNED_INT:
+    return merge<unsigned int>(aggregation, accumulator, address);
+  case Primitive::UNSIGNED_CHAR:
+    return merge<unsigned char>(aggregation, accumulator, address);
+  case Primitive::UNSIGNED_LONG:
+    return merge<unsigned long>(aggregation, accumulator, address);
+  case Primitive::UNSIGNED_SHORT:
+    return merge<unsigned short>(aggregation, accumulator, address);
+  case Primitive::UNSIGNED_LONG_LONG:
+    return merge<unsigned long long>(aggregation, accumulator, address);
+  }
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../serializer/ExtractionOptionsJsonObject.h"
+#include "polycube/services/json.hpp"  // nlohmann::json
+
+using json = nlohmann::json;
+using polycube::service::model::PercpuAggregationEnum;
+
+/**
+ * ExtractionPlan is the compiled form of a TableDesc's leaf_desc or key_desc
+ * object, the JSON which describes the structure of a eBPF map key or value.
+ *
+ * This JSON object has a predefined structure to represent C structs, unions,
+ * arrays, enums and primitive types (such as "int", "char", "double", "unsigned
+ * long long" and so on):
+ *
+ * - a primitive type is its name, eg. "unsigned long long"
+ * - a struct is ["mystruct", [["property1", "unsigned long long"], ...], "struct_packed"],
+ *   where alignment paddings are properties named "__pad_N" with their size, eg.
+ *   ["__pad_0", "char", [3]]
+ * - a union is ["myunion", [["type1", "unsigned long long"], ["type2", "char"]], "union"]
+ * - an enum is ["myenum", ["TCP", "UDP", "HTTP"], "enum"]
+ * - an array property is ["property", "int", [len]]
+ *
+ * The description is walked only once, when the plan is built, and flattened
+ * into a vector of nodes, each one knowing its offset from the beginning of
+ * the enclosing entry (or array element). Extracting a value is then a walk
+ * of the nodes reading memory at fixed offsets, without any parsing.
+ *
+ * The produced JSON is:
+ * - a number for primitive types
+ * - an array of numbers for arrays of primitive types, except "signed char" and
+ *   "unsigned char" arrays which are returned as strings
+ * - an object {"property1": value, ...} for structs and unions, where every
+ *   type of a union is casted from the same memory
+ * - the name of the value for enums
+ * - an array ["property", [values...]] for arrays of structs, unions or enums
+ */
+class ExtractionPlan {
+ public:
+  /**
+   * Compiles the description of a map key or value
+   *
+   * @param[description] the leaf_desc or key_desc JSON string
+   *
+   * @throw std::runtime_error if the description cannot be recognized
+   */
+  explicit ExtractionPlan(const std::string &description);
+
+  /**
+   * Extracts the value stored in a memory block
+   *
+   * @param[data] pointer to the memory block of a map key or value
+   *
+   * @returns a JSON object which represents the value
+   */
+  json toJson(const char *data) const;
+
+  /**
+   * Checks if the described value is a single primitive type
+   *
+   * @returns true if the value can be read with toNumber()
+   */
+  bool isNumber() const;
+
+  /**
+   * Extracts the value stored in a memory block as an unsigned integer
+   *
+   * @param[data] pointer to the memory block of a map value
+   *
+   * @returns the value casted to uint64_t
+   */
+  uint64_t toNumber(const char *data) const;
+
+  /**
+   * Merges a value into an accumulator of the same type, as needed to reduce
+   * the per-cpu values of a PERCPU map into a single one
+   *
+   * Every number (also inside structs and arrays) is summed, or replaced if it
+   * is the minimum/maximum; enums, strings and unions are kept as they are in
+   * the accumulator, as there is no meaningful way to merge them.
+   *
+   * @param[aggregation] the merge operation
+   * @param[accumulator] pointer to the memory block updated in place
+   * @param[data] pointer to the memory block of the value to be merged
+   */
+  void aggregate(PercpuAggregationEnum aggregation, char *accumulator,
+                 const char *data) const;
+
+  /**
+   * Returns the name of the described struct, union or enum
+   *
+   * @returns the type name, empty for primitive types
+   */
+  const std::string &getTypeName() const;
+
+  /**
+   * Looks for a property of the described struct
+   *
+   * @param[name] the property name
+   * @param[offset] the offset of the property from the beginning of the value
+   * @param[size] the size of the property in bytes
+   *
+   * @returns false if there is no such primitive, enum or array property
+   */
+  bool findProperty(const std::string &name, size_t &offset, size_t &size) const;
+
+ private:
+  enum class Primitive {
+    INT, CHAR, SHORT, LONG, FLOAT, DOUBLE, LONG_LONG, LONG_DOUBLE, SIGNED_CHAR,
+    UNSIGNED_INT, UNSIGNED_CHAR, UNSIGNED_LONG, UNSIGNED_SHORT, UNSIGNED_LONG_LONG
+  };
+
+  enum class Kind { PRIMITIVE, PRIMITIVE_ARRAY, STRING, STRUCT, UNION, ENUM, ARRAY };
+
+  struct Node {
+    Kind kind;
+    Primitive primitive;
+    /* Offset from the beginning of the entry or of the enclosing array element */
+    size_t offset;
+    /* Number of elements for arrays, size of an element for arrays of complex types */
+    size_t len;
+    size_t stride;
+    /* Property name of an array of complex types */
+    std::string name;
+    /* Properties of structs and unions, element of arrays of complex types */
+    std::vector<std::pair<std::string, size_t>> fields;
+    std::vector<std::string> enum_values;
+  };
+
+  /**
+   * Recursive method which identifies the type of an object of the description
+   * and appends the corresponding node(s) to the plan
+   *
+   * @param[object] the object to be compiled
+   * @param[offset] offset from the beginning of the entry, moved after the object
+   *
+   * @returns the index of the node representing the object
+   */
+  size_t compile(const json &object, size_t &offset);
+
+  size_t addPrimitive(Kind kind, const std::string &type_name, size_t &offset,
+                      size_t len);
+
+  json nodeToJson(const Node &node, const char *data) const;
+
+  void aggregateNode(const Node &node, PercpuAggregationEnum aggregation,
+                     char *accumulator, const char *data) const;
+
+  static Primitive parsePrimitive(const std::string &type_name);
+  static size_t primitiveSize(Primitive primitive);
+  static json primitiveToJson(Primitive primitive, const char *address);
+  static void aggregatePrimitive(Primitive primitive, PercpuAggregationEnum aggregation,
+                                 char *accumulator, const char *address);
+
+  std::vector<Node> nodes;
+  size_t root;
+  std::string type_name;
+};
@@ -1,628 +1,276 @@
 #include "MapExtractor.h"
 
-#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <linux/bpf.h>
 
 #include "polycube/services/table_desc.h"
 
-#define INT "int"
-#define CHAR "char"
-#define SHORT "short"
-#define LONG "long"
-#define FLOAT "float"
-#define DOUBLE "double"
-#define LONG_LONG "long long"
-#define LONG_DOUBLE "long double"
-#define SIGNED_CHAR "signed char"
-#define UNSIGNED_INT "unsigned int"
-#define UNSIGNED_CHAR "unsigned char"
-#define UNSIGNED_LONG "unsigned long"
-#define UNSIGNED_SHORT "unsigned short"
-#define UNSIGNED_LONG_LONG "unsigned long long"
-
-using std::ostringstream;
 using std::runtime_error;
 using namespace polycube::service;
 using json = nlohmann::json;
-using value_type = json::object_t::value_type;
 
-#pragma region compiletime_string_hashing
+namespace {
+
+/* Buffers holding the raw entries read from a map, reused by the extractions
+ * performed by the same thread */
+struct ExtractionBuffers {
+  std::vector<char> keys;
+  std::vector<char> values;
+  /* Never written, used to reset the entries when emptying a map */
+  std::vector<char> zeros;
+};
+
+thread_local ExtractionBuffers buffers;
+
 /**
- * This region of code exports the hash method which is used at compile time to
- * transform a string into uint64_t value by hashing it; this permits to use
- * the switch statement on strings.
+ * Grows a buffer to hold at least @size bytes
+ *
+ * @returns the buffer data
  */
-namespace StringHash {
-constexpr uint64_t _(uint64_t h, const char *s) {
-  return (*s == 0)
-         ? h
-         : _((h * 1099511628211ull) ^ static_cast<uint64_t>(*s), s + 1);
+char *reserve(std::vector<char> &buffer, size_t size) {
+  if (buffer.size() < size)
+    buffer.resize(size);
+  return buffer.data();
 }
 
-constexpr uint64_t hash(const char *s) {
-  return StringHash::_(14695981039346656037ull, s);
+bool isPerCPU(const TableDesc &desc) {
+  return desc.type == BPF_MAP_TYPE_PERCPU_HASH || desc.type == BPF_MAP_TYPE_PERCPU_ARRAY ||
+         desc.type == BPF_MAP_TYPE_LRU_PERCPU_HASH;
 }
 
-uint64_t hash(const std::string &s) {
-  return StringHash::_(14695981039346656037ull, s.data());
+/**
+ * Returns the size of a single per-cpu value of a map: the kernel copies every
+ * per-cpu value rounded up to 8 bytes
+ */
+size_t perCPUValueSize(const TableDesc &desc) {
+  return (desc.leaf_size + 7) & ~static_cast<size_t>(7);
 }
-}  // namespace StringHash
-#pragma endregion
-
-using namespace StringHash;
-
-#define ENUM hash("enum")
-#define UNION hash("union")
-#define STRUCT hash("struct")
-#define STRUCT_PACKED hash("struct_packed")
-#define PADDING "__pad_"
-
-typedef enum {
-  Property,
-  ArrayProperty,
-  Value,
-  Struct,
-  Union,
-  Enum,
-} objectType;
 
 /**
- * Recognizes the type of a node object contained in a TableDesc's leaf_desc tree
- *
- * @param[object] the object to be recognized
- *
- * @throw std::runtime_error if the object cannot be recognized
- *
- * @returns a objectType
+ * Reduces the per-cpu values of an entry into the value of the first cpu
  */
-objectType identifyObject(json object) {
-  if (object.is_string())
-    return Value;
-  if (object.is_array()) {
-    if (object.size() == 2)
-      return Property;
-    if (object.size() == 3) {
-      if (object[2].is_string()) {
-        switch (hash(object[2])) {
-        case STRUCT:
-        case STRUCT_PACKED:
-          return Struct;
-        case UNION:
-          return Union;
-        case ENUM:
-          return Enum;
-        default:
-          throw runtime_error("Unknown type" + object[3].get<string>());
-        }
-      } else if (object[2].is_array())
-        return ArrayProperty;
-      else if (object[2].is_number() && object[1].is_string())
-        return Property;
-      throw runtime_error("Unknown element" + object[0].get<string>());
-    }
-  }
-  throw runtime_error("Unable to identifyObject " + object.dump());
+void reducePerCPU(const ExtractionPlan &plan, PercpuAggregationEnum aggregation,
+                  char *values, size_t n_cpus, size_t value_size) {
+  for (size_t cpu = 1; cpu < n_cpus; cpu++)
+    plan.aggregate(aggregation, values, values + cpu * value_size);
 }
 
-json MapExtractor::extractFromArrayMap(const TableDesc &desc, RawTable table,
-                                             std::shared_ptr<ExtractionOptions> &extractionOptions) {
+/* Cached plans, indexed by the description they have been compiled from */
+std::mutex plans_mutex;
+std::unordered_map<std::string, std::shared_ptr<const ExtractionPlan>> plans;
+/* Also the descriptions which are not sketches are cached, with a null sketch */
+std::unordered_map<std::string, std::shared_ptr<const Sketch>> sketches;
 
-  auto value_desc = json::parse(string{desc.leaf_desc});
-  json j_entries;
-
-  MapEntry batch(desc.max_entries * desc.key_size,
-                 desc.max_entries * desc.leaf_size);
-  unsigned int count = desc.max_entries;
-
-  //Trying to retrieve values using batch operations
-  if(table.get_batch(batch.getKey(), batch.getValue(), &count) == 0 || errno == ENOENT) {
-    //Batch retrieval ok, checking if need to empty
-    if(count > 0 && extractionOptions->getEmptyOnRead()) {
-      MapEntry reset(0, desc.max_entries * desc.leaf_size);
-      table.update_batch(batch.getKey(), reset.getValue(), &count);
-    }
-    for(int i=0; i<count; i++) {
-      int offset = 0;
-      auto value = recExtract(value_desc, static_cast<char*>(batch.getValue()) + i*desc.leaf_size, offset);
-      j_entries.push_back(value);
-    }
-    return j_entries;
-  }
+/* Plans and sketches are dropped all at once when a cache reaches this size */
+const size_t MAX_CACHED_PLANS = 1024;
 
-  // Retrieving values using old method
-  std::vector<std::shared_ptr<MapEntry>> entries;
-  MapEntry reset_value(0, desc.key_size);
-  void *last_key = nullptr;
+}  // namespace
 
-  //Getting all map values
-  while (true) {
-    MapEntry entry(desc.key_size, desc.leaf_size);
-    if (table.next(last_key, entry.getKey()) > -1) {
-      last_key = entry.getKey();
-      table.get(entry.getKey(), entry.getValue());
-      entries.push_back(std::make_shared<MapEntry>(entry));
-      if(extractionOptions->getEmptyOnRead())
-        table.set(last_key, reset_value.getValue());
-    }else
-      break;
-  }
+std::shared_ptr<const ExtractionPlan> MapExtractor::getPlan(const std::string &description) {
+  std::lock_guard<std::mutex> lock(plans_mutex);
+  auto it = plans.find(description);
+  if (it != plans.end())
+    return it->second;
 
-  //Parsing retrieved values
-  for(auto &entry: entries) {
-    int offset = 0;
-    auto j_entry = recExtract(value_desc, entry->getValue(), offset);
-    j_entries.push_back(j_entry);
-  }
-  return j_entries;
+  if (plans.size() >= MAX_CACHED_PLANS)
+    plans.clear();
+  auto plan = std::make_shared<const ExtractionPlan>(description);
+  plans.emplace(description, plan);
+  return plan;
 }
 
-json MapExtractor::extractFromQueueStackMap(const TableDesc &desc, RawQueueStackTable table,
-                                        std::shared_ptr<ExtractionOptions> &extractionOptions) {
+std::shared_ptr<const Sketch> MapExtractor::getSketch(const std::string &description) {
+  std::lock_guard<std::mutex> lock(plans_mutex);
+  auto it = sketches.find(description);
+  if (it != sketches.end())
+    return it->second;
+
+  if (sketches.size() >= MAX_CACHED_PLANS)
+    sketches.clear();
+  auto sketch = Sketch::fromDescription(description);
+  sketches.emplace(description, sketch);
+  return sketch;
+}
 
-  auto value_desc = json::parse(string{desc.leaf_desc});
-  std::vector<std::shared_ptr<MapEntry>> entries;
+size_t MapExtractor::readQueueStackMap(const TableDesc &desc, RawQueueStackTable table) {
+  auto values = reserve(buffers.values, desc.max_entries * desc.leaf_size);
+  size_t count = 0;
 
   // Retrieving map entries iteratively, DOES NOT SUPPORT BATCH OPERATIONS
-  while(true) {
-    MapEntry entry(0, desc.leaf_size);
-    if (table.pop(entry.getValue()) != 0)
-      break;
-    entries.push_back(std::make_shared<MapEntry>(entry));
-  }
-
-  json j_entries;
-  for(auto &entry: entries) {
-    int offset = 0;
-    auto j_entry = recExtract(value_desc, entry->getValue(), offset);
-    j_entries.push_back(j_entry);
-  }
-  return j_entries;
+  while(count < desc.max_entries &&
+        table.pop(values + count * desc.leaf_size) == 0)
+    count++;
+  return count;
 }
 
-json MapExtractor::extractFromHashMap(const TableDesc &desc, RawTable table,
-                                      std::shared_ptr<ExtractionOptions> &extractionOptions) {
-  // Getting both key_desc and leaf_desc objects which represents the structure of the map entry
-  auto value_desc = json::parse(string{desc.leaf_desc});
-  auto key_desc = json::parse(string{desc.key_desc});
-  json j_entries;
-
-  MapEntry batch(desc.max_entries * desc.key_size,
-                 desc.max_entries * desc.leaf_size);
+size_t MapExtractor::readMap(const TableDesc &desc, RawTable table, size_t value_size,
+                             std::shared_ptr<ExtractionOptions> &extractionOptions) {
+  // Array entries cannot be deleted, they are reset to zero instead
+  bool is_array = desc.type == BPF_MAP_TYPE_ARRAY || desc.type == BPF_MAP_TYPE_PERCPU_ARRAY;
+  bool empty = extractionOptions->getEmptyOnRead();
+  auto keys = reserve(buffers.keys, desc.max_entries * desc.key_size);
+  auto values = reserve(buffers.values, desc.max_entries * value_size);
   unsigned int count = desc.max_entries;
 
   //Trying to retrieve values using batch operations
-  if((extractionOptions->getEmptyOnRead() && (table.get_and_delete_batch(batch.getKey(), batch.getValue(), &count) == 0 || errno == ENOENT)) ||
-      (!extractionOptions->getEmptyOnRead() && (table.get_batch(batch.getKey(), batch.getValue(), &count) == 0 || errno == ENOENT))) {
-    //Batch retrieval ok
-    for(int i=0; i<count; i++) {
-      int offset_key = 0, offset_value = 0;
-      json entry_obj;
-      entry_obj["key"] = recExtract(key_desc, static_cast<char*>(batch.getKey()) + i*desc.key_size, offset_key);
-      entry_obj["value"] = recExtract(value_desc, static_cast<char*>(batch.getValue()) + i*desc.leaf_size, offset_value);
-      j_entries.push_back(entry_obj);
+  int ret = empty && !is_array ? table.get_and_delete_batch(keys, values, &count)
+                               : table.get_batch(keys, values, &count);
+  if(ret == 0 || errno == ENOENT) {
+    //Batch retrieval ok, checking if need to reset the array
+    if(count > 0 && empty && is_array) {
+      unsigned int reset_count = count;
+      table.update_batch(keys, reserve(buffers.zeros, count * value_size), &reset_count);
     }
-    return j_entries;
+    return count;
   }
 
-  // Retrieving map entries with old method
-  std::vector<std::shared_ptr<MapEntry>> entries;
+  // Retrieving map entries with old method (kernels without batch operations)
+  auto reset_value = reserve(buffers.zeros, value_size);
   void *last_key = nullptr;
-
-  while (true) {
-    MapEntry entry(desc.key_size, desc.leaf_size);
-    if (table.next(last_key, entry.getKey()) > -1) {
-      last_key = entry.getKey();
-      table.get(entry.getKey(), entry.getValue());
-      entries.push_back(std::make_shared<MapEntry>(entry));
-      if(extractionOptions->getEmptyOnRead())
+  count = 0;
+  while (count < desc.max_entries &&
+         table.next(last_key, keys + count * desc.key_size) > -1) {
+    last_key = keys + count * desc.key_size;
+    table.get(last_key, values + count * value_size);
+    if(empty) {
+      if(is_array)
+        table.set(last_key, reset_value);
+      else
         table.remove(last_key);
-    } else
-      break;
-  }
-
-  for (auto &entry : entries) {
-    int val_offset = 0, key_offset = 0;
-    json entry_obj;
-    entry_obj["key"] = recExtract(key_desc, entry->getKey(), key_offset);
-    entry_obj["value"] = recExtract(value_desc, entry->getValue(), val_offset);
-    j_entries.push_back(entry_obj);
-  }
-  return j_entries;
-}
-
-json MapExtractor::extractFromPerCPUMap(const TableDesc &desc, RawTable table,
-                                        std::shared_ptr<ExtractionOptions> &extractionOptions) {
-  // Getting the maximux cpu available
-  size_t n_cpus = polycube::get_possible_cpu_count();
-  size_t leaf_array_size = n_cpus * desc.leaf_size;
-  // Getting key and value description to parse correctly
-  auto value_desc = json::parse(string{desc.leaf_desc});
-  auto key_desc = json::parse(string{desc.key_desc});
-  json j_entries;
-
-  std::vector<std::shared_ptr<MapEntry>> entries;
-  MapEntry reset_value(0, leaf_array_size);
-  void *last_key = nullptr;
-
-  // Retrieving map entries with old method, DOES NOT SUPPORT BATCH OPERATION
-  while (true) {
-    MapEntry entry(desc.key_size, leaf_array_size);
-    if (table.next(last_key, entry.getKey()) > -1) {
-      last_key = entry.getKey();
-      table.get(entry.getKey(), entry.getValue());
-      entries.push_back(std::make_shared<MapEntry>(entry));
-      if(extractionOptions->getEmptyOnRead()) {
-        table.set(last_key, reset_value.getValue());
-        if(desc.type != BPF_MAP_TYPE_PERCPU_ARRAY) {
-          table.remove(last_key);
-        }
-      }
-    } else
-      break;
-  }
-
-  for(auto& entry : entries) {
-    int key_offset = 0;
-    json j_entry;
-
-    // Parse the current key and set the id of that entry
-    j_entry["key"] = recExtract(key_desc, entry->getKey(), key_offset);
-
-    json j_values;
-    // The leaf_size is the size of a single leaf value, but potentially there is an
-    // array of values! So the entry->getValue() pointer must be manually shifted to parse
-    // all the per_cpu values
-    for(int i=0, offset=0; i<n_cpus; i++, offset=0){
-      auto val = recExtract(value_desc, static_cast<char*>(entry->getValue()) + (i * desc.leaf_size), offset);
-      j_values.emplace_back(val);
     }
-    j_entry["value"] = j_values;
-    j_entries.push_back(j_entry);
+    count++;
   }
-  return j_entries;
+  return count;
 }
 
 json MapExtractor::extractFromMap(BaseCube &cube_ref, const string& map_name, int index,
                                   ProgramType type, std::shared_ptr<ExtractionOptions> extractionOptions) {
   // Getting the TableDesc object of the eBPF table
   auto &desc = cube_ref.get_table_desc(map_name, index, type);
+  json j_entries;
 
-  if(desc.type == BPF_MAP_TYPE_HASH || desc.type == BPF_MAP_TYPE_LRU_HASH)
-    return extractFromHashMap(desc, cube_ref.get_raw_table(map_name, index, type), extractionOptions);
-  else if(desc.type == BPF_MAP_TYPE_ARRAY)
-    return extractFromArrayMap(desc, cube_ref.get_raw_table(map_name, index, type), extractionOptions);
-  else if(desc.type == BPF_MAP_TYPE_QUEUE || desc.type == BPF_MAP_TYPE_STACK)
-    return extractFromQueueStackMap(desc, cube_ref.get_raw_queuestack_table(map_name, index, type), extractionOptions);
-  else if(desc.type == BPF_MAP_TYPE_PERCPU_HASH || desc.type == BPF_MAP_TYPE_PERCPU_ARRAY || desc.type == BPF_MAP_TYPE_LRU_PERCPU_HASH)
-    return extractFromPerCPUMap(desc, cube_ref.get_raw_table(map_name, index, type), extractionOptions);
-  else
+  if(desc.type == BPF_MAP_TYPE_HASH || desc.type == BPF_MAP_TYPE_LRU_HASH) {
+    auto key_plan = getPlan(desc.key_desc);
+    auto value_plan = getPlan(desc.leaf_desc);
+    auto count = readMap(desc, cube_ref.get_raw_table(map_name, index, type), desc.leaf_size, extractionOptions);
+    for (size_t i = 0; i < count; i++) {
+      json entry_obj;
+      entry_obj["key"] = key_plan->toJson(buffers.keys.data() + i * desc.key_size);
+      entry_obj["value"] = value_plan->toJson(buffers.values.data() + i * desc.leaf_size);
+      j_entries.push_back(std::move(entry_obj));
+    }
+  } else if(desc.type == BPF_MAP_TYPE_ARRAY ||
+            desc.type == BPF_MAP_TYPE_QUEUE || desc.type == BPF_MAP_TYPE_STACK) {
+    auto value_plan = getPlan(desc.leaf_desc);
+    auto count = desc.type == BPF_MAP_TYPE_ARRAY ?
+        readMap(desc, cube_ref.get_raw_table(map_name, index, type), desc.leaf_size, extractionOptions) :
+        readQueueStackMap(desc, cube_ref.get_raw_queuestack_table(map_name, index, type));
+    for (size_t i = 0; i < count; i++)
+      j_entries.push_back(value_plan->toJson(buffers.values.data() + i * desc.leaf_size));
+  } else if(isPerCPU(desc)) {
+    auto key_plan = getPlan(desc.key_desc);
+    auto value_plan = getPlan(desc.leaf_desc);
+    auto aggregation = extractionOptions->getPercpuAggregation();
+    // Every entry holds an array of values, one per cpu
+    size_t n_cpus = polycube::get_possible_cpu_count();
+    size_t value_size = perCPUValueSize(desc);
+    auto count = readMap(desc, cube_ref.get_raw_table(map_name, index, type),
+                         n_cpus * value_size, extractionOptions);
+    for (size_t i = 0; i < count; i++) {
+      json j_entry;
+      j_entry["key"] = key_plan->toJson(buffers.keys.data() + i * desc.key_size);
+      auto values = buffers.values.data() + i * n_cpus * value_size;
+      if (aggregation != PercpuAggregationEnum::NONE) {
+        reducePerCPU(*value_plan, aggregation, values, n_cpus, value_size);
+        j_entry["value"] = value_plan->toJson(values);
+      } else {
+        json j_values;
+        for (size_t cpu = 0; cpu < n_cpus; cpu++)
+          j_values.push_back(value_plan->toJson(values + cpu * value_size));
+        j_entry["value"] = std::move(j_values);
+      }
+      j_entries.push_back(std::move(j_entry));
+    }
+  } else
     // The map type is not supported yet by Dynmon
     throw runtime_error("Unhandled Map Type " + std::to_string(desc.type) + " extraction.");
+  return j_entries;
 }
 
-json MapExtractor::recExtract(json object_description, void *data, int &offset) {
-  // Identifying the object
-  auto objectType = identifyObject(object_description);
-
-  switch (objectType) {
-  case Property: { // the object describes a property of a C struct
-    auto propertyName = object_description[0].get<string>();
-    auto propertyType = object_description[1];
-    return propertyName, recExtract(propertyType, data, offset);
-  }
-  case ArrayProperty: { // the object describes a property of a C struct which is an array
-    auto propertyName = object_description[0].get<string>();
-    auto propertyType = object_description[1];
-    auto len = object_description[2][0].get<int>();
-    // array of primitive type
-    if (propertyType.is_string()) // this string is the name of the primitive type
-      return valueFromPrimitiveType(propertyType, data, offset, len);
-      // array of complex type
-    else {
-      json array;
-      for (int i = 0; i < len; i++)
-        array.push_back(recExtract(propertyType, data, offset));
-      return value_type(propertyName, array);
+void MapExtractor::extractNumbers(BaseCube &cube_ref, const string& map_name, int index,
+                                  ProgramType type,
+                                  std::shared_ptr<ExtractionOptions> extractionOptions,
+                                  std::vector<uint64_t> &values, json *entries) {
+  auto &desc = cube_ref.get_table_desc(map_name, index, type);
+  auto value_plan = getPlan(desc.leaf_desc);
+  auto aggregation = extractionOptions->getPercpuAggregation();
+  // A per-cpu array is a sequence of numbers only if its values are reduced
+  bool reduced = desc.type == BPF_MAP_TYPE_PERCPU_ARRAY && aggregation != PercpuAggregationEnum::NONE;
+  // Checking before reading, so that the map is not emptied if it cannot be exported
+  if (!value_plan->isNumber() ||
+      (!reduced && desc.type != BPF_MAP_TYPE_ARRAY && desc.type != BPF_MAP_TYPE_QUEUE &&
+       desc.type != BPF_MAP_TYPE_STACK))
+    throw runtime_error("The values of map " + map_name + " are not numbers");
+
+  values.clear();
+  if (entries)
+    *entries = json();
+  if (reduced) {
+    auto key_plan = getPlan(desc.key_desc);
+    size_t n_cpus = polycube::get_possible_cpu_count();
+    size_t value_size = perCPUValueSize(desc);
+    auto count = readMap(desc, cube_ref.get_raw_table(map_name, index, type),
+                         n_cpus * value_size, extractionOptions);
+    for (size_t i = 0; i < count; i++) {
+      auto value = buffers.values.data() + i * n_cpus * value_size;
+      reducePerCPU(*value_plan, aggregation, value, n_cpus, value_size);
+      values.push_back(value_plan->toNumber(value));
+      if (entries) {
+        json j_entry;
+        j_entry["key"] = key_plan->toJson(buffers.keys.data() + i * desc.key_size);
+        j_entry["value"] = value_plan->toJson(value);
+        entries->push_back(std::move(j_entry));
+      }
     }
+    return;
   }
-  case Value: // the object describes a primitive type
-    return valueFromPrimitiveType(object_description.get<string>(), data,
-                                  offset);
-  case Struct: // the object describes a C struct
-    return valueFromStruct(object_description, data, offset);
-
-  case Union: // the object describes a C union
-    return valueFromUnion(object_description, data, offset);
 
-  case Enum: // the object describes a C enum
-    return valueFromEnum(object_description, data, offset);
+  auto count = desc.type == BPF_MAP_TYPE_ARRAY ?
+      readMap(desc, cube_ref.get_raw_table(map_name, index, type), desc.leaf_size, extractionOptions) :
+      readQueueStackMap(desc, cube_ref.get_raw_queuestack_table(map_name, index, type));
+  for (size_t i = 0; i < count; i++) {
+    auto value = buffers.values.data() + i * desc.leaf_size;
+    values.push_back(value_plan->toNumber(value));
+    if (entries)
+      entries->push_back(value_plan->toJson(value));
   }
-  throw runtime_error("Unhandled object type " + std::to_string(objectType) + " - recExtract()");
 }
 
-json MapExtractor::valueFromStruct(json struct_description, void *data,
-                                   int &offset) {
-  json array;
-  // Getting the name of the C struct
-  // auto structName = struct_description[0].get<string>();
-  // Getting the set of properties of the C struct
-  auto structProperties = struct_description[1];
-
-  // For each property
-  for (auto &property : structProperties) {
-    // Getting the property's name
-    auto propertyName = property[0].get<std::string>();
-    // Getting the property type object
-    // auto propertyType = property[1];
-    // If the property is an alignment padding -> skipp it increasing the offset
-    if (propertyName.rfind(PADDING, 0) == 0) {
-      auto paddingSize = property[2][0].get<int>();
-      offset += paddingSize;
-    } else
-      // Adding the property to the returning set extracting its value recursively
-      array.push_back(value_type(propertyName, recExtract(property, data, offset)));
-  }
-  return array;
-}
-
-json MapExtractor::valueFromUnion(json union_description, void *data,
-                                  int &offset) {
-  json array;
-  int oldOffset = offset;
-  int maxOffset = 0;
-  // Getting the name of the C union
-  // auto unionName = union_description[0].get<string>();
-  // Getting the set of properties of the C union
-  auto unionProperties = union_description[1];
-
-  // For each property
-  for (auto &property : unionProperties) {
-    // Getting the property's name
-    auto propertyName = property[0].get<std::string>();
-    // Getting the property type object
-    // auto propertyType = property[1];
-    // Adding the property to the returning set extracting its value recursively
-    array.push_back(value_type(propertyName, recExtract(property, data, offset)));
-    // Saving the offset in order to increase it to the maximum property size
-    if (offset > maxOffset)
-      maxOffset = offset;
-    // Restoring the previous offset before iterate to the next property
-    offset = oldOffset;
-  }
-  // Setting the offset to the maximum found so far
-  offset = maxOffset;
-  return array;
-}
-
-json MapExtractor::valueFromEnum(json enum_description, void *data,
-                                 int &offset) {
-  int index = *(int *)((char *)data + offset);
-  offset += sizeof(int);
-  return enum_description[1][index].get<string>();
-}
-
-json MapExtractor::valueFromPrimitiveType(const string& type_name, void *data,
-                                          int &offset, int len) {
-  char *address = ((char *)data + offset);
-  // Casting the memory pointed by *address to the corresponding C type
-  switch (hash(type_name)) {
-  case hash(INT): {
-    if (len == -1) {
-      int value = *(int *)address;
-      offset += sizeof(int);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        int value = *(int *)address;
-        offset += sizeof(int);
-        address += sizeof(int);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(CHAR): {
-    if (len == -1) {
-      char value = *address;
-      offset += sizeof(char);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        char value = *address;
-        offset += sizeof(char);
-        address += sizeof(char);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(SHORT): {
-    if (len == -1) {
-      short value = *(short *)address;
-      offset += sizeof(short);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        short value = *(short *)address;
-        offset += sizeof(short);
-        address += sizeof(short);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(LONG): {
-    if (len == -1) {
-      long value = *(long *)address;
-      offset += sizeof(long);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        long value = *(long *)address;
-        offset += sizeof(long);
-        address += sizeof(long);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(FLOAT): {
-    if (len == -1) {
-      float value = *(float *)address;
-      offset += sizeof(float);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        float value = *(float *)address;
-        offset += sizeof(float);
-        address += sizeof(float);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(DOUBLE): {
-    if (len == -1) {
-      double value = *(double *)address;
-      offset += sizeof(double);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        double value = *(double *)address;
-        offset += sizeof(double);
-        address += sizeof(double);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(LONG_LONG): {
-    if (len == -1) {
-      long long value = *(long long *)address;
-      offset += sizeof(long long);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        long long value = *(long long *)address;
-        offset += sizeof(long long);
-        address += sizeof(long long);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(LONG_DOUBLE): {
-    if (len == -1) {
-      long double value = *(long double *)address;
-      offset += sizeof(long double);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        long double value = *(long double *)address;
-        offset += sizeof(long double);
-        address += sizeof(long double);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(SIGNED_CHAR): {
-    if (len == -1) {
-      signed char value = *address;
-      offset += sizeof(signed char);
-      return value;
-    } else {
-      signed char *value = (signed char *)address;
-      offset += sizeof(signed char) * len;
-      return (char *)value;
-    }
-  }
-  case hash(UNSIGNED_INT): {
-    if (len == -1) {
-      unsigned int value = *(unsigned int *)address;
-      offset += sizeof(unsigned int);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        unsigned int value = *(unsigned int *)address;
-        offset += sizeof(unsigned int);
-        address += sizeof(unsigned int);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(UNSIGNED_CHAR): {
-    if (len == -1) {
-      unsigned char value = *address;
-      offset += sizeof(unsigned char);
-      return value;
-    } else {
-      unsigned char *value = (unsigned char *)address;
-      offset += sizeof(unsigned char) * len;
-      return (char *)value;
-    }
-  }
-  case hash(UNSIGNED_LONG): {
-    if (len == -1) {
-      unsigned long value = *(unsigned long *)address;
-      offset += sizeof(unsigned long);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        unsigned long value = *(unsigned long *)address;
-        offset += sizeof(unsigned long);
-        address += sizeof(unsigned long);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(UNSIGNED_SHORT): {
-    if (len == -1) {
-      unsigned short value = *(unsigned short *)address;
-      offset += sizeof(unsigned short);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        unsigned short value = *(unsigned short *)address;
-        offset += sizeof(unsigned short);
-        address += sizeof(unsigned short);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  case hash(UNSIGNED_LONG_LONG): {
-    if (len == -1) {
-      unsigned long long value = *(unsigned long long *)address;
-      offset += sizeof(unsigned long long);
-      return value;
-    } else {
-      json vec = json::array();
-      for (int i = 0; i < len; i++) {
-        unsigned long long value = *(unsigned long long *)address;
-        offset += sizeof(unsigned long long);
-        address += sizeof(unsigned long long);
-        vec.push_back(value);
-      }
-      return vec;
-    }
-  }
-  default:
-    throw runtime_error("ERROR: " + type_name + " not a valid type!");
+std::shared_ptr<const Sketch> MapExtractor::extractSketches(BaseCube &cube_ref, const string& map_name,
+                                                            int index, ProgramType type,
+                                                            std::shared_ptr<ExtractionOptions> extractionOptions,
+                                                            std::vector<const char *> &values,
+                                                            json *entries) {
+  auto &desc = cube_ref.get_table_desc(map_name, index, type);
+  auto sketch = getSketch(desc.leaf_desc);
+  if (!sketch)
+    return nullptr;
+  // The helpers update the sketches atomically, they are never per-cpu
+  if (desc.type != BPF_MAP_TYPE_ARRAY)
+    throw runtime_error("The sketches of map " + map_name + " must be stored in an array map");
+
+  auto count = readMap(desc, cube_ref.get_raw_table(map_name, index, type), desc.leaf_size, extractionOptions);
+  values.clear();
+  for (size_t i = 0; i < count; i++)
+    values.push_back(buffers.values.data() + i * desc.leaf_size);
+  if (entries) {
+    auto value_plan = getPlan(desc.leaf_desc);
+    *entries = json();
+    for (auto value : values)
+      entries->push_back(value_plan->toJson(value));
   }
+  return sketch;
 }
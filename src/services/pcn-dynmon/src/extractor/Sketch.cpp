@@ -0,0 +1,217 @@
+#include "Sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using std::runtime_error;
+using std::string;
+
+namespace {
+
+uint64_t readU64(const char *address) {
+  uint64_t value;
+  std::memcpy(&value, address, sizeof(value));
+  return value;
+}
+
+/**
+ * Returns the offset of a property of a sketch struct
+ *
+ * @param[size] set to the size of the property in bytes
+ *
+ * @throw std::runtime_error if the property is missing
+ */
+size_t property(const ExtractionPlan &plan, const string &name, size_t &size) {
+  size_t offset;
+  if (!plan.findProperty(name, offset, size))
+    throw runtime_error("Property " + name + " missing in " + plan.getTypeName());
+  return offset;
+}
+
+size_t property(const ExtractionPlan &plan, const string &name) {
+  size_t size;
+  return property(plan, name, size);
+}
+
+/**
+ * Escapes a string to be used as OpenMetrics label value
+ */
+string escapeLabel(const string &value) {
+  string escaped;
+  for (char c : value) {
+    if (c == '\\' || c == '"')
+      escaped.push_back('\\');
+    if (c == '\n') {
+      escaped.append("\\n");
+      continue;
+    }
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+/**
+ * Appends a sample to an OpenMetrics exposition
+ */
+void appendSample(string &out, const string &name, const string &labels,
+                  const string &label, const string &value) {
+  out.append(name);
+  out.push_back('{');
+  out.append(labels);
+  if (!labels.empty() && !label.empty())
+    out.append(", ");
+  out.append(label);
+  out.append("} ");
+  out.append(value);
+  out.push_back('\n');
+}
+
+}  // namespace
+
+Sketch::Sketch(Kind kind) : kind(kind) {}
+
+std::shared_ptr<const Sketch> Sketch::fromDescription(const string &description) {
+  ExtractionPlan plan(description);
+  auto &type_name = plan.getTypeName();
+  std::shared_ptr<Sketch> sketch;
+  size_t size;
+
+  if (type_name == "dynmon_log2_histogram" || type_name == "dynmon_linear_histogram") {
+    bool linear = type_name == "dynmon_linear_histogram";
+    sketch.reset(new Sketch(linear ? Kind::LINEAR_HISTOGRAM : Kind::LOG2_HISTOGRAM));
+    sketch->items_offset = property(plan, "slots", size);
+    sketch->items_count = size / sizeof(uint64_t);
+    sketch->value_offset = property(plan, "sum");
+    if (linear) {
+      sketch->min_offset = property(plan, "min");
+      sketch->step_offset = property(plan, "step");
+    }
+  } else if (type_name == "dynmon_count_min") {
+    sketch.reset(new Sketch(Kind::COUNT_MIN));
+    sketch->value_offset = property(plan, "total");
+  } else if (type_name == "dynmon_hll") {
+    sketch.reset(new Sketch(Kind::HYPERLOGLOG));
+    sketch->items_offset = property(plan, "registers", size);
+    sketch->items_count = size;
+  } else if (type_name == "dynmon_topk") {
+    sketch.reset(new Sketch(Kind::TOP_K));
+    sketch->value_offset = property(plan, "counts", size);
+    sketch->items_count = size / sizeof(uint64_t);
+    if (sketch->items_count == 0)
+      throw runtime_error("Empty " + type_name);
+    sketch->items_offset = property(plan, "keys", size);
+    sketch->key_size = size / sketch->items_count;
+    // The keys are exported through the plan of their own type
+    auto object = json::parse(description);
+    for (auto &p : object[1])
+      if (p[0] == "keys")
+        sketch->key_plan = std::make_shared<ExtractionPlan>(p[1].dump());
+  }
+  return sketch;
+}
+
+MetricTypeEnum Sketch::getType() const {
+  return kind == Kind::LOG2_HISTOGRAM || kind == Kind::LINEAR_HISTOGRAM ?
+      MetricTypeEnum::HISTOGRAM : MetricTypeEnum::GAUGE;
+}
+
+void Sketch::toOpenMetrics(const char *data, const string &name,
+                           const string &labels, string &out) const {
+  switch (kind) {
+  case Kind::LOG2_HISTOGRAM:
+  case Kind::LINEAR_HISTOGRAM:
+    histogramToOpenMetrics(data, name, labels, out);
+    break;
+  case Kind::COUNT_MIN:
+    appendSample(out, name, labels, "",
+                 std::to_string(readU64(data + value_offset)));
+    break;
+  case Kind::HYPERLOGLOG:
+    appendSample(out, name, labels, "",
+                 std::to_string(std::llround(hllEstimate(
+                     reinterpret_cast<const unsigned char *>(data + items_offset),
+                     items_count))));
+    break;
+  case Kind::TOP_K:
+    topkToOpenMetrics(data, name, labels, out);
+    break;
+  }
+}
+
+void Sketch::histogramToOpenMetrics(const char *data, const string &name,
+                                    const string &labels, string &out) const {
+  uint64_t min = 0, step = 1;
+  if (kind == Kind::LINEAR_HISTOGRAM) {
+    min = readU64(data + min_offset);
+    // The bounds are stored by the first observation
+    step = std::max<uint64_t>(readU64(data + step_offset), 1);
+  }
+
+  // Buckets are cumulative, the last slot counts every higher value
+  uint64_t count = 0;
+  for (size_t i = 0; i < items_count; i++) {
+    count += readU64(data + items_offset + i * sizeof(uint64_t));
+    string le;
+    if (i == items_count - 1)
+      le = "+Inf";
+    else if (kind == Kind::LOG2_HISTOGRAM)
+      le = std::to_string((uint64_t(1) << (i + 1)) - 1);
+    else
+      le = std::to_string(min + (i + 1) * step - 1);
+    appendSample(out, name + "_bucket", labels, "le=\"" + le + "\"",
+                 std::to_string(count));
+  }
+  appendSample(out, name + "_count", labels, "", std::to_string(count));
+  appendSample(out, name + "_sum", labels, "",
+               std::to_string(readU64(data + value_offset)));
+}
+
+void Sketch::topkToOpenMetrics(const char *data, const string &name,
+                               const string &labels, string &out) const {
+  // Heavy hitters are exported from the biggest one
+  std::vector<std::pair<uint64_t, size_t>> entries;
+  for (size_t i = 0; i < items_count; i++) {
+    auto count = readU64(data + value_offset + i * sizeof(uint64_t));
+    if (count > 0)
+      entries.emplace_back(count, i);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<uint64_t, size_t> &a,
+               const std::pair<uint64_t, size_t> &b) { return a.first > b.first; });
+
+  for (auto &entry : entries) {
+    auto key = key_plan->toJson(data + items_offset + entry.second * key_size);
+    auto key_label = key.is_string() ? key.get<string>() : key.dump();
+    appendSample(out, name, labels, "key=\"" + escapeLabel(key_label) + "\"",
+                 std::to_string(entry.first));
+  }
+}
+
+double Sketch::hllEstimate(const unsigned char *registers, size_t count) {
+  double m = count;
+  double alpha;
+  if (count == 16)
+    alpha = 0.673;
+  else if (count == 32)
+    alpha = 0.697;
+  else if (count == 64)
+    alpha = 0.709;
+  else
+    alpha = 0.7213 / (1 + 1.079 / m);
+
+  double sum = 0;
+  size_t zeros = 0;
+  for (size_t i = 0; i < count; i++) {
+    sum += std::ldexp(1.0, -registers[i]);
+    if (registers[i] == 0)
+      zeros++;
+  }
+  double estimate = alpha * m * m / sum;
+  // Linear counting is more accurate for small cardinalities
+  if (estimate <= 2.5 * m && zeros > 0)
+    estimate = m * std::log(m / zeros);
+  return estimate;
+}
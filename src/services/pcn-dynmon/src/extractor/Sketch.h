@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "../serializer/OpenMetricsMetadataJsonObject.h"
+#include "ExtractionPlan.h"
+
+using polycube::service::model::MetricTypeEnum;
+
+/**
+ * Sketch is the userspace counterpart of the histograms and sketches of the
+ * Dynmon datapath helpers (Dynmon_helpers.c).
+ *
+ * A map value is recognized as a sketch by the name of its struct, eg.
+ * "dynmon_log2_histogram"; the offsets of the struct properties are taken
+ * from the map value description, so that the sizes tuned in the datapath
+ * are honored.
+ *
+ * Every sketch is exported as a fixed number of OpenMetrics samples:
+ * - histograms as cumulative buckets, count and sum
+ * - count-min sketches as a gauge with the total count
+ * - HyperLogLog sketches as a gauge with the estimated number of distinct keys
+ * - top-k as a gauge per heavy hitter, labelled with its key
+ */
+class Sketch {
+ public:
+  /**
+   * Recognizes the sketch described by the value description of a map
+   *
+   * @param[description] the leaf_desc JSON string
+   *
+   * @returns the sketch, nullptr if the value is not a sketch
+   *
+   * @throw std::runtime_error if the value is a sketch with an unexpected structure
+   */
+  static std::shared_ptr<const Sketch> fromDescription(const std::string &description);
+
+  /**
+   * Returns the OpenMetrics type of the exported metric
+   */
+  MetricTypeEnum getType() const;
+
+  /**
+   * Appends the samples of a sketch to an OpenMetrics exposition
+   *
+   * @param[data] pointer to the memory block of the map value
+   * @param[name] the metric family name
+   * @param[labels] the metric labels, eg. a="1", b="2"
+   * @param[out] the string where the samples are appended
+   */
+  void toOpenMetrics(const char *data, const std::string &name,
+                     const std::string &labels, std::string &out) const;
+
+ private:
+  enum class Kind { LOG2_HISTOGRAM, LINEAR_HISTOGRAM, COUNT_MIN, HYPERLOGLOG, TOP_K };
+
+  explicit Sketch(Kind kind);
+
+  void histogramToOpenMetrics(const char *data, const std::string &name,
+                              const std::string &labels, std::string &out) const;
+  void topkToOpenMetrics(const char *data, const std::string &name,
+                         const std::string &labels, std::string &out) const;
+
+  static double hllEstimate(const unsigned char *registers, size_t count);
+
+  Kind kind;
+  /* Slots of histograms, registers of HyperLogLog sketches, keys of top-k */
+  size_t items_offset = 0;
+  size_t items_count = 0;
+  /* Sum of histograms, total of count-min sketches, counts of top-k */
+  size_t value_offset = 0;
+  /* Bounds of linear histograms */
+  size_t min_offset = 0;
+  size_t step_offset = 0;
+  /* Size and plan of the keys of top-k */
+  size_t key_size = 0;
+  std::shared_ptr<ExtractionPlan> key_plan;
+};
@@ -0,0 +1,227 @@
+#include "Collector.h"
+#include "../Dynmon.h"
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <regex>
+
+namespace {
+/* Only plain HTTP endpoints are supported: http://host[:port][/path] */
+const std::regex url_regex("http://([^/:\\s]+)(:([0-9]{1,5}))?(/\\S*)?");
+}// namespace
+
+Collector::Collector(Dynmon &parent) : CollectorBase(parent) {
+  m_thread = std::thread(&Collector::collectLoop, this);
+}
+
+Collector::~Collector() {
+  stop();
+}
+
+uint32_t Collector::getInterval() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_interval;
+}
+
+void Collector::setInterval(const uint32_t &value) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_interval == value)
+    return;
+  m_interval = value;
+  // Without the collector the readers collect the metrics by themselves
+  if (m_interval == 0)
+    m_snapshot.reset();
+  m_wakeup = true;
+  m_cv.notify_all();
+}
+
+std::string Collector::getPushUrl() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pushUrl;
+}
+
+void Collector::setPushUrl(const std::string &value) {
+  if (!value.empty() && !std::regex_match(value, url_regex))
+    throw std::runtime_error("Invalid push URL " + value + ", expected http://host[:port][/path]");
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_pushUrl == value)
+    return;
+  m_pushUrl = value;
+  // Nothing has been sent to the new endpoint yet
+  m_pushed.clear();
+}
+
+bool Collector::getPushDeltas() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pushDeltas;
+}
+
+void Collector::setPushDeltas(const bool &value) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_pushDeltas = value;
+}
+
+std::shared_ptr<const MetricsSnapshot> Collector::getSnapshot() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  uint32_t seconds = m_interval;
+  if (seconds > SNAPSHOT_TIMEOUT)
+    seconds = SNAPSHOT_TIMEOUT;
+  auto timeout = std::chrono::seconds(seconds);
+  if (!m_cv.wait_for(lock, timeout, [this] { return m_snapshot || m_interval == 0 || m_stop; }))
+    logger()->warn("[Collector] No metrics collected within {0}s, reading them directly", timeout.count());
+  return m_snapshot;
+}
+
+void Collector::refresh() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_snapshot.reset();
+  m_wakeup = true;
+  m_cv.notify_all();
+}
+
+void Collector::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+    m_cv.notify_all();
+  }
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+void Collector::collectLoop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop) {
+    if (m_interval == 0) {
+      m_cv.wait(lock, [this] { return m_stop || m_interval > 0; });
+      continue;
+    }
+    m_wakeup = false;
+    auto next = std::chrono::steady_clock::now() + std::chrono::seconds(m_interval);
+    lock.unlock();
+
+    std::shared_ptr<const MetricsSnapshot> snapshot;
+    try {
+      snapshot = parent_.collect();
+    } catch (const std::exception &ex) {
+      logger()->error("[Collector] Unable to collect the metrics: {0}", ex.what());
+    }
+
+    lock.lock();
+    // The snapshot is discarded if the configuration changed in the meantime
+    if (snapshot && !m_wakeup && !m_stop) {
+      m_snapshot = snapshot;
+      m_cv.notify_all();
+
+      if (!m_pushUrl.empty()) {
+        auto url = m_pushUrl;
+        auto body = pushBody(*snapshot, m_pushed, m_pushDeltas);
+        lock.unlock();
+        bool pushed = body.empty();
+        if (!pushed) {
+          try {
+            push(url, body);
+            pushed = true;
+          } catch (const std::exception &ex) {
+            logger()->warn("[Collector] Unable to push the metrics: {0}", ex.what());
+          }
+        }
+        lock.lock();
+        if (pushed && m_pushUrl == url)
+          m_pushed = {snapshot->openMetrics.begin(), snapshot->openMetrics.end()};
+      }
+    }
+    m_cv.wait_until(lock, next, [this] { return m_stop || m_wakeup; });
+  }
+}
+
+std::string Collector::pushBody(const MetricsSnapshot &snapshot,
+                                const std::unordered_map<std::string, std::string> &pushed,
+                                bool deltas) {
+  std::string body;
+  for (auto &metric : snapshot.openMetrics) {
+    if (metric.second.empty())
+      continue;
+    if (deltas) {
+      auto it = pushed.find(metric.first);
+      if (it != pushed.end() && it->second == metric.second)
+        continue;
+    }
+    body.append(metric.second);
+    body.push_back('\n');
+  }
+  return body;
+}
+
+void Collector::push(const std::string &url, const std::string &body) {
+  std::smatch match;
+  if (!std::regex_match(url, match, url_regex))
+    throw std::runtime_error("Invalid push URL " + url);
+  std::string host = match[1];
+  std::string port = match[3].matched ? match[3].str() : "80";
+  std::string path = match[4].matched ? match[4].str() : "/";
+
+  struct addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *addresses;
+  int ret = getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+  if (ret != 0)
+    throw std::runtime_error("Unable to resolve " + host + ": " + gai_strerror(ret));
+
+  int fd = -1;
+  for (auto address = addresses; address != nullptr && fd < 0; address = address->ai_next) {
+    fd = socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+    if (fd < 0)
+      continue;
+    // The timeouts apply also to the connection of a blocking socket
+    struct timeval timeout = {PUSH_TIMEOUT, 0};
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (connect(fd, address->ai_addr, address->ai_addrlen) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(addresses);
+  if (fd < 0)
+    throw std::runtime_error("Unable to connect to " + host + ":" + port);
+
+  std::string request = "POST " + path + " HTTP/1.0\r\n" +
+                        "Host: " + host + ":" + port + "\r\n" +
+                        "Content-Type: text/plain; version=0.0.4\r\n" +
+                        "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+                        "Connection: close\r\n\r\n" + body;
+  bool sent = true;
+  for (size_t offset = 0; offset < request.size();) {
+    ssize_t n = send(fd, request.data() + offset, request.size() - offset, MSG_NOSIGNAL);
+    if (n <= 0) {
+      sent = false;
+      break;
+    }
+    offset += n;
+  }
+
+  // Only the status line of the response is needed
+  char response[64];
+  size_t len = 0;
+  while (sent && len < sizeof(response) - 1 && !memchr(response, '\n', len)) {
+    ssize_t n = recv(fd, response + len, sizeof(response) - 1 - len, 0);
+    if (n <= 0)
+      break;
+    len += n;
+  }
+  response[len] = '\0';
+  close(fd);
+
+  int status = 0;
+  if (!sent || sscanf(response, "HTTP/%*d.%*d %d", &status) != 1)
+    throw std::runtime_error("No response from " + url);
+  if (status < 200 || status >= 300)
+    throw std::runtime_error("Push to " + url + " failed with status " + std::to_string(status));
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../base/CollectorBase.h"
+#include "Metrics.h"
+
+class Dynmon;
+
+using namespace polycube::service::model;
+
+/**
+ * Metrics collected at the same time from both the paths
+ */
+struct MetricsSnapshot {
+  /* The metrics in JSON format */
+  std::shared_ptr<Metrics> metrics;
+  /* The metrics in OpenMetrics format, each one identified by its path and name */
+  std::vector<std::pair<std::string, std::string>> openMetrics;
+  /* The metrics in OpenMetrics format, joined as returned to the readers */
+  std::string openMetricsText;
+};
+
+/**
+ * Collector of the metrics of a Dynmon instance.
+ *
+ * When the interval is not 0, a thread collects the metrics of both the paths
+ * every interval, reading every map once, and the latest snapshot is returned
+ * to every reader; otherwise the metrics are collected by every reader.
+ *
+ * After every collection the metrics in OpenMetrics format can be pushed with
+ * an HTTP POST request (eg. to a Prometheus Pushgateway); with push-deltas only
+ * the metrics changed since the previous successful push are sent.
+ */
+class Collector : public CollectorBase {
+ public:
+  explicit Collector(Dynmon &parent);
+  ~Collector() override;
+
+  /**
+   *  Interval between two collections of the metrics (in seconds); when 0, the metrics are collected every time they are read
+   */
+  uint32_t getInterval() override;
+  void setInterval(const uint32_t &value) override;
+
+  /**
+   *  HTTP endpoint (e.g., 'http://127.0.0.1:9091/metrics/job/dynmon') where the metrics in OpenMetrics format are pushed after every collection
+   */
+  std::string getPushUrl() override;
+  void setPushUrl(const std::string &value) override;
+
+  /**
+   *  When true, only the metrics changed since the previous push are pushed
+   */
+  bool getPushDeltas() override;
+  void setPushDeltas(const bool &value) override;
+
+  /**
+   * Returns the latest snapshot, waiting for the first collection for at most
+   * an interval (and no more than SNAPSHOT_TIMEOUT)
+   *
+   * @return the snapshot, nullptr if the collector is disabled or the
+   *         collection did not complete in time: the caller collects the
+   *         metrics by itself
+   */
+  std::shared_ptr<const MetricsSnapshot> getSnapshot();
+
+  /**
+   * Discards the latest snapshot and collects the metrics again, to be called
+   * when the configuration of the metrics changes
+   */
+  void refresh();
+
+  /**
+   * Stops the collection thread, to be called before destroying the parent
+   */
+  void stop();
+
+ private:
+  void collectLoop();
+
+  /**
+   * Builds the body of a push
+   *
+   * @param snapshot the collected metrics
+   * @param pushed   the metrics previously sent to the endpoint
+   * @param deltas   whether the metrics equal to the ones previously sent must be skipped
+   * @return         the body, empty if there is nothing to push
+   */
+  static std::string pushBody(const MetricsSnapshot &snapshot,
+                              const std::unordered_map<std::string, std::string> &pushed,
+                              bool deltas);
+
+  /**
+   * Sends an HTTP POST request with the metrics to an endpoint
+   *
+   * @param url  the endpoint
+   * @param body the metrics in OpenMetrics format
+   * @throw      std::runtime_error if the request fails
+   */
+  static void push(const std::string &url, const std::string &body);
+
+  /* Timeout of the connection and of every read or write of a push, in seconds */
+  static const int PUSH_TIMEOUT = 5;
+  /* Maximum wait of a reader for a collection in progress, in seconds */
+  static const uint32_t SNAPSHOT_TIMEOUT = 5;
+
+  // the configuration is read by the collection thread as well
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  uint32_t m_interval = 0;
+  std::string m_pushUrl;
+  bool m_pushDeltas = false;
+  /* The metrics sent by the latest successful push to the current endpoint */
+  std::unordered_map<std::string, std::string> m_pushed;
+  std::shared_ptr<const MetricsSnapshot> m_snapshot;
+  /* Set to collect again without waiting for the interval */
+  bool m_wakeup = false;
+  bool m_stop = false;
+  std::thread m_thread;
+};
@@ -7,6 +7,8 @@ ExtractionOptions::ExtractionOptions(MetricConfig &parent, const ExtractionOptio
     m_emptyOnRead = conf.getEmptyOnRead();
   if (conf.swapOnReadIsSet())
     m_swapOnRead = conf.getSwapOnRead();
+  if (conf.percpuAggregationIsSet())
+    m_percpuAggregation = conf.getPercpuAggregation();
 }
 
 bool ExtractionOptions::getEmptyOnRead() {
@@ -16,3 +18,7 @@ bool ExtractionOptions::getEmptyOnRead() {
 bool ExtractionOptions::getSwapOnRead() {
   return m_swapOnRead;
 }
+
+PercpuAggregationEnum ExtractionOptions::getPercpuAggregation() {
+  return m_percpuAggregation;
+}
@@ -21,7 +21,13 @@ class ExtractionOptions : public ExtractionOptionsBase {
    */
   bool getSwapOnRead() override;
 
+  /**
+   *  Reduction of the per-cpu values of PERCPU maps; when None, every value is the array of the per-cpu values
+   */
+  PercpuAggregationEnum getPercpuAggregation() override;
+
  private:
   bool m_emptyOnRead;
   bool m_swapOnRead;
+  PercpuAggregationEnum m_percpuAggregation = PercpuAggregationEnum::NONE;
 };
@@ -0,0 +1,93 @@
+#include "CollectorJsonObject.h"
+#include <regex>
+
+namespace polycube {
+  namespace service {
+    namespace model {
+
+      CollectorJsonObject::CollectorJsonObject() {
+        m_interval = 0;
+        m_intervalIsSet = true;
+        m_pushUrlIsSet = false;
+        m_pushDeltas = false;
+        m_pushDeltasIsSet = true;
+      }
+
+      CollectorJsonObject::CollectorJsonObject(const nlohmann::json &val) : JsonObjectBase(val) {
+        m_intervalIsSet = false;
+        m_pushUrlIsSet = false;
+        m_pushDeltasIsSet = false;
+        if (val.count("interval"))
+          setInterval(val.at("interval").get<uint32_t>());
+        if (val.count("push-url"))
+          setPushUrl(val.at("push-url").get<std::string>());
+        if (val.count("push-deltas"))
+          setPushDeltas(val.at("push-deltas").get<bool>());
+      }
+
+      nlohmann::json CollectorJsonObject::toJson() const {
+        nlohmann::json val = nlohmann::json::object();
+        if (!getBase().is_null())
+          val.update(getBase());
+        if (m_intervalIsSet)
+          val["interval"] = m_interval;
+        if (m_pushUrlIsSet)
+          val["push-url"] = m_pushUrl;
+        if (m_pushDeltasIsSet)
+          val["push-deltas"] = m_pushDeltas;
+        return val;
+      }
+
+      uint32_t CollectorJsonObject::getInterval() const {
+        return m_interval;
+      }
+
+      void CollectorJsonObject::setInterval(uint32_t value) {
+        m_interval = value;
+        m_intervalIsSet = true;
+      }
+
+      bool CollectorJsonObject::intervalIsSet() const {
+        return m_intervalIsSet;
+      }
+
+      void CollectorJsonObject::unsetInterval() {
+        m_intervalIsSet = false;
+      }
+
+      std::string CollectorJsonObject::getPushUrl() const {
+        return m_pushUrl;
+      }
+
+      void CollectorJsonObject::setPushUrl(std::string value) {
+        m_pushUrl = value;
+        m_pushUrlIsSet = true;
+      }
+
+      bool CollectorJsonObject::pushUrlIsSet() const {
+        return m_pushUrlIsSet;
+      }
+
+      void CollectorJsonObject::unsetPushUrl() {
+        m_pushUrlIsSet = false;
+      }
+
+      bool CollectorJsonObject::getPushDeltas() const {
+        return m_pushDeltas;
+      }
+
+      void CollectorJsonObject::setPushDeltas(bool value) {
+        m_pushDeltas = value;
+        m_pushDeltasIsSet = true;
+      }
+
+      bool CollectorJsonObject::pushDeltasIsSet() const {
+        return m_pushDeltasIsSet;
+      }
+
+      void CollectorJsonObject::unsetPushDeltas() {
+        m_pushDeltasIsSet = false;
+      }
+    }// namespace model
+  }// namespace service
+}// namespace polycube
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "JsonObjectBase.h"
+
+namespace polycube {
+  namespace service {
+    namespace model {
+
+      /**
+       *  Collector
+       */
+      class CollectorJsonObject : public JsonObjectBase {
+       public:
+        CollectorJsonObject();
+        CollectorJsonObject(const nlohmann::json &json);
+        ~CollectorJsonObject() final = default;
+        nlohmann::json toJson() const final;
+
+        /**
+         *  Interval between two collections of the metrics (in seconds); when 0, the metrics are collected every time they are read
+         */
+        uint32_t getInterval() const;
+        void setInterval(uint32_t value);
+        bool intervalIsSet() const;
+        void unsetInterval();
+
+        /**
+         *  HTTP endpoint (e.g., 'http://127.0.0.1:9091/metrics/job/dynmon') where the metrics in OpenMetrics format are pushed after every collection
+         */
+        std::string getPushUrl() const;
+        void setPushUrl(std::string value);
+        bool pushUrlIsSet() const;
+        void unsetPushUrl();
+
+        /**
+         *  When true, only the metrics changed since the previous push are pushed
+         */
+        bool getPushDeltas() const;
+        void setPushDeltas(bool value);
+        bool pushDeltasIsSet() const;
+        void unsetPushDeltas();
+
+       private:
+        uint32_t m_interval;
+        bool m_intervalIsSet;
+        std::string m_pushUrl;
+        bool m_pushUrlIsSet;
+        bool m_pushDeltas;
+        bool m_pushDeltasIsSet;
+      };
+    }// namespace model
+  }// namespace service
+}// namespace polycube
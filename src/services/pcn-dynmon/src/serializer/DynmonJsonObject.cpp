@@ -8,6 +8,7 @@ namespace polycube {
       DynmonJsonObject::DynmonJsonObject() {
         m_nameIsSet = false;
         m_dataplaneConfigIsSet = false;
+        m_collectorIsSet = false;
         m_metricsIsSet = true;
         m_openMetricsIsSet = false;
       }
@@ -15,6 +16,7 @@ namespace polycube {
       DynmonJsonObject::DynmonJsonObject(const nlohmann::json &val) : JsonObjectBase(val) {
         m_nameIsSet = false;
         m_dataplaneConfigIsSet = false;
+        m_collectorIsSet = false;
         m_metricsIsSet = false;
         m_openMetricsIsSet = false;
         if (val.count("name"))
@@ -25,6 +27,11 @@ namespace polycube {
             DataplaneConfigJsonObject newItem{val["dataplane-config"]};
             setDataplaneConfig(newItem);
           }
+        if (val.count("collector"))
+          if (!val["collector"].is_null()) {
+            CollectorJsonObject newItem{val["collector"]};
+            setCollector(newItem);
+          }
         if (val.count("metrics"))
           if (!val["metrics"].is_null()) {
             MetricsJsonObject newItem{val["metrics"]};
@@ -42,6 +49,8 @@ namespace polycube {
           val["name"] = m_name;
         if (m_dataplaneConfigIsSet)
           val["dataplane-config"] = JsonObjectBase::toJson(m_dataplaneConfig);
+        if (m_collectorIsSet)
+          val["collector"] = JsonObjectBase::toJson(m_collector);
         if (m_metricsIsSet)
           val["metrics"] = JsonObjectBase::toJson(m_metrics);
         if (m_openMetricsIsSet)
@@ -79,6 +88,23 @@ namespace polycube {
         m_dataplaneConfigIsSet = false;
       }
 
+      CollectorJsonObject DynmonJsonObject::getCollector() const {
+        return m_collector;
+      }
+
+      void DynmonJsonObject::setCollector(CollectorJsonObject value) {
+        m_collector = value;
+        m_collectorIsSet = true;
+      }
+
+      bool DynmonJsonObject::collectorIsSet() const {
+        return m_collectorIsSet;
+      }
+
+      void DynmonJsonObject::unsetCollector() {
+        m_collectorIsSet = false;
+      }
+
       MetricsJsonObject DynmonJsonObject::getMetrics() const {
         return m_metrics;
       }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "CollectorJsonObject.h"
 #include "DataplaneConfigJsonObject.h"
 #include "JsonObjectBase.h"
 #include "MetricsJsonObject.h"
@@ -34,6 +35,14 @@ namespace polycube {
         bool dataplaneConfigIsSet() const;
         void unsetDataplaneConfig();
 
+        /**
+         *  Periodic collection of the metrics, served to every reader until the next collection
+         */
+        CollectorJsonObject getCollector() const;
+        void setCollector(CollectorJsonObject value);
+        bool collectorIsSet() const;
+        void unsetCollector();
+
         /**
          *  Collected metrics in JSON format
          */
@@ -55,6 +64,8 @@ namespace polycube {
         bool m_nameIsSet;
         DataplaneConfigJsonObject m_dataplaneConfig;
         bool m_dataplaneConfigIsSet;
+        CollectorJsonObject m_collector;
+        bool m_collectorIsSet;
         MetricsJsonObject m_metrics;
         bool m_metricsIsSet;
         std::string m_openMetrics;
@@ -10,15 +10,20 @@ namespace polycube {
         m_swapOnReadIsSet = true;
         m_emptyOnRead = false;
         m_emptyOnReadIsSet = true;
+        m_percpuAggregation = PercpuAggregationEnum::NONE;
+        m_percpuAggregationIsSet = true;
       }
 
       ExtractionOptionsJsonObject::ExtractionOptionsJsonObject(const nlohmann::json &val) : JsonObjectBase(val) {
         m_swapOnReadIsSet = false;
         m_emptyOnReadIsSet = false;
+        m_percpuAggregationIsSet = false;
         if (val.count("swap-on-read"))
           setSwapOnRead(val.at("swap-on-read").get<bool>());
         if (val.count("empty-on-read"))
           setEmptyOnRead(val.at("empty-on-read").get<bool>());
+        if (val.count("percpu-aggregation"))
+          setPercpuAggregation(string_to_PercpuAggregationEnum(val.at("percpu-aggregation").get<std::string>()));
       }
 
       nlohmann::json ExtractionOptionsJsonObject::toJson() const {
@@ -29,6 +34,8 @@ namespace polycube {
           val["swap-on-read"] = m_swapOnRead;
         if (m_emptyOnReadIsSet)
           val["empty-on-read"] = m_emptyOnRead;
+        if (m_percpuAggregationIsSet)
+          val["percpu-aggregation"] = PercpuAggregationEnum_to_string(m_percpuAggregation);
         return val;
       }
 
@@ -65,6 +72,50 @@ namespace polycube {
       void ExtractionOptionsJsonObject::unsetEmptyOnRead() {
         m_emptyOnReadIsSet = false;
       }
+
+      PercpuAggregationEnum ExtractionOptionsJsonObject::getPercpuAggregation() const {
+        return m_percpuAggregation;
+      }
+
+      void ExtractionOptionsJsonObject::setPercpuAggregation(PercpuAggregationEnum value) {
+        m_percpuAggregation = value;
+        m_percpuAggregationIsSet = true;
+      }
+
+      bool ExtractionOptionsJsonObject::percpuAggregationIsSet() const {
+        return m_percpuAggregationIsSet;
+      }
+
+      void ExtractionOptionsJsonObject::unsetPercpuAggregation() {
+        m_percpuAggregationIsSet = false;
+      }
+
+      std::string ExtractionOptionsJsonObject::PercpuAggregationEnum_to_string(const PercpuAggregationEnum &value) {
+        switch (value) {
+          case PercpuAggregationEnum::NONE:
+            return std::string("none");
+          case PercpuAggregationEnum::SUM:
+            return std::string("sum");
+          case PercpuAggregationEnum::MIN:
+            return std::string("min");
+          case PercpuAggregationEnum::MAX:
+            return std::string("max");
+          default:
+            throw std::runtime_error("Bad ExtractionOptions percpuAggregation");
+        }
+      }
+
+      PercpuAggregationEnum ExtractionOptionsJsonObject::string_to_PercpuAggregationEnum(const std::string &str) {
+        if (JsonObjectBase::iequals("none", str))
+          return PercpuAggregationEnum::NONE;
+        if (JsonObjectBase::iequals("sum", str))
+          return PercpuAggregationEnum::SUM;
+        if (JsonObjectBase::iequals("min", str))
+          return PercpuAggregationEnum::MIN;
+        if (JsonObjectBase::iequals("max", str))
+          return PercpuAggregationEnum::MAX;
+        throw std::runtime_error("ExtractionOptions percpuAggregation is invalid");
+      }
     }// namespace model
   }// namespace service
 }// namespace polycube
@@ -5,6 +5,14 @@
 namespace polycube {
   namespace service {
     namespace model {
+
+      enum class PercpuAggregationEnum {
+        NONE,
+        SUM,
+        MIN,
+        MAX
+      };
+
       /**
        *  Extraction Options
        */
@@ -23,6 +31,16 @@ namespace polycube {
         bool emptyOnReadIsSet() const;
         void unsetEmptyOnRead();
 
+        /**
+         *  Reduction of the per-cpu values of PERCPU maps; when None, every value is the array of the per-cpu values
+         */
+        PercpuAggregationEnum getPercpuAggregation() const;
+        void setPercpuAggregation(PercpuAggregationEnum value);
+        bool percpuAggregationIsSet() const;
+        void unsetPercpuAggregation();
+        static std::string PercpuAggregationEnum_to_string(const PercpuAggregationEnum &value);
+        static PercpuAggregationEnum string_to_PercpuAggregationEnum(const std::string &str);
+
         /**
          *  When true, the map is swapped with a new one before reading its content to provide thread safety and atomicity on read/write operations
          */
@@ -36,6 +54,8 @@ namespace polycube {
         bool m_swapOnReadIsSet;
         bool m_emptyOnRead;
         bool m_emptyOnReadIsSet;
+        PercpuAggregationEnum m_percpuAggregation;
+        bool m_percpuAggregationIsSet;
       };
 
     }// namespace model
@@ -2,300 +2,313 @@
 
 #include <polycube/services/cube_iface.h>
 
+#include <algorithm>
 #include <regex>
 #include <unordered_map>
 
-/*The suffix to be added to the original NON_SWAPPABLE map name when swapped
- * in the EGRESS program and CompileType=PROGRAM_INDEX_SWAP*/
-const char ENHANCED_SWAP_MAP_NAME_FORMAT_EGRESS[]  = "_egress";
+/*Declarations shared by all the swappable maps, injected before the first of them*/
+const char dynmon_swap_index[] = R"(
+BPF_ARRAY(INTERNAL_SWAP_INDEX, int, 1);
+#define DYNMON_SWAP_SELECT(_1, _2, NAME, ...) NAME
+)";
 
-/*The suffix to be added to the original NON_SWAPPABLE map name when swapped
- * in the INGRESS program and CompileType=PROGRAM_INDEX_SWAP*/
-const char ENHANCED_SWAP_MAP_NAME_FORMAT_INGRESS[] = "_ingress";
-
-/*The suffix to be added to the original SWAPPABLE map name when swapped and CompileType=BASE*/
-const char BASE_SWAP_MAP_NAME_FORMAT[]             = "_1";
-
-/*Dynmon master code to be injected when swap is enabled*/
-const char dynmon_swap_master[] = R"(
-      BPF_ARRAY(INTERNAL_PROGRAM_INDEX, int, 1);
-      static __always_inline int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
-       unsigned key = 0;
-       int *index = INTERNAL_PROGRAM_INDEX.lookup(&key);
-       if(!index) {
-         return RX_OK;
-        }
-        call_PROGRAMTYPE_program(ctx, *index);
-        return RX_OK;
-      }
-    )";
-
-/**
- * Internal method called during PROGRAM_INDEX_SWAP compilation to adjust NON-SWAPPABLE maps
- *
- * Checks for all non-swappable maps and declare them SHARED/extern. This way they
- * can be shared among the two programs (original/swapped).
- * NB:
- *  If some maps is already SHARED/PUBLIC/PINNED, the swapped code will have the "extern"
- *  declaration instead, to reuse the same map.
- *  If maps are declared using more-specific helpers than the classic BPF_TABLE/BPF_QUEUESTACK
- *  (like BPF_ARRAY), the compilation will terminate since still not implemented that part.
- *  For all the other maps, their declaration is changed into SHARED in the "original"
- *  program, and as "extern" in the swap one.
- *
- * @param original_code  the original code to be compiled
- * @param swapped_code   the swap code
- * @param maps_to_swap   the list of maps which need to be swapped
- * @param modified_names the list of maps whose names have been modified
- * @param type           the program type INGRESS/EGRESS
- * @return               true if correctly executed, false otherwise
- */
-bool enhancedFixNotSwappableMaps(std::string &original_code, std::string &swapped_code,
-                         const std::vector<std::string>& maps_to_swap,
-                         std::unordered_map<std::string, std::string> &modified_names,
-                         ProgramType type) {
-  /*Create a regex Pattern to match all maps not declared swappable*/
-  std::smatch match;
-  std::string pattern = "BPF_";
-  for(auto &m: maps_to_swap)
-    pattern += "(?!.+" + m + ")";
-  pattern += ".+";
-
-  if (std::regex_search(original_code, match, std::regex(pattern))) {
-
-    /*Retrieving the non-swappable maps that their declaration should be slightly modified in the swapped code*/
-    /*Checking if all the non-swappable map are supported as SHARED*/
-    for (auto &x: match) {
-      auto decl = x.str();
-
-      /*Checking if the map is already "extern" or PINNED*/
-      if (decl.find("\"extern\"") != std::string::npos ||
-          decl.find("_PINNED") != std::string::npos) {
-        continue;
-      }
-
-      bool is_table = decl.find("BPF_TABLE") != std::string::npos,
-           is_queue = decl.find("BPF_QUEUESTACK") != std::string::npos;
-      /*Checking if the map has been declared using the traditional BPF_TABLE or BPF_QUEUESTACK*/
-      if(!is_table && !is_queue) {
-        // TODO: Change map declaration from helper to standard BPF_TABLE
-        // By now if the user has declared the map using an helper
-        // (eg. BPF_ARRAY instead of BPF_TABLE) I use the basic compilation
-        return false;
-      }
-
-      /*Check if map is _SHARED or _PUBLIC that should be marked as extern in swapped code*/
-      size_t index;
-      if((index=decl.find("_SHARED")) != std::string::npos ||
-          (index=decl.find("_PUBLIC")) != std::string::npos){
-        std::size_t index_replace_decl = swapped_code.find(decl);
-        size_t index_comma_after_name = decl.find(',');
-        /*Before erase then insert to avoid that part of declaration stays (if BPF_QUEUESTACK, the name is longer)*/
-        swapped_code.erase(index_replace_decl + index,index_comma_after_name - index);
-        swapped_code.insert(index_replace_decl + index, "(\"extern\"");
-        continue;
-      }
+/*Outer array of maps and current buffer lookup, injected after each swappable map declaration*/
+const char dynmon_swap_map[] = R"(
+BPF_ARRAY_OF_MAPS(MAPNAME_swap, "MAPNAME", 2);
+static __always_inline void *MAPNAME_swap_current() {
+  int key = 0;
+  int *index = INTERNAL_SWAP_INDEX.lookup(&key);
+  if (!index)
+    return NULL;
+  int current = *index;
+  return MAPNAME_swap.lookup(&current);
+}
+)";
 
-      /*Now I know that:
-       * - the map has been declared using standard BPF_TABLE* or BPF_QUEUESTACK*
-       * - it is a non special type, since already matched
-       * - need to set BPF_TABLE_SHARED(..) in original, BPF_TABLE("extern",...) in swapped
-       *   and change name accordingly to ingress/egress
-       * */
+/*Replacements of the map methods, injected only if the method is used*/
+const char dynmon_swap_lookup[] = R"(
+static __always_inline VALUETYPE *MAPNAME_swap_lookup(void *key) {
+  void *map = MAPNAME_swap_current();
+  if (!map)
+    return NULL;
+  return bpf_map_lookup_elem(map, key);
+}
+)";
 
-      /*Match the name of the map*/
-      if( (is_table && !std::regex_search(decl, match, std::regex(",.*,\\s*(\\w+),.*"))) ||
-          (is_queue && !std::regex_search(decl, match, std::regex(",\\s*(\\w+),.*"))) )  {
-        return false;
-      }
+const char dynmon_swap_update[] = R"(
+static __always_inline int MAPNAME_swap_FUNCTION(void *key, void *value) {
+  void *map = MAPNAME_swap_current();
+  if (!map)
+    return -1;
+  return bpf_map_update_elem(map, key, value, FLAGS);
+}
+)";
 
-      /*Retrieving indexes to modify codes*/
-      auto index_replace_decl_or = original_code.find(decl),
-          index_replace_decl_sw = swapped_code.find(decl),
-           index_comma_after_name = decl.find(',');
+const char dynmon_swap_delete[] = R"(
+static __always_inline int MAPNAME_swap_delete(void *key) {
+  void *map = MAPNAME_swap_current();
+  if (!map)
+    return -1;
+  return bpf_map_delete_elem(map, key);
+}
+)";
 
-      /*Modifying map name*/
-      auto map_name = match[1].str(), map_name_repl = type == ProgramType::INGRESS ?
-        map_name + ENHANCED_SWAP_MAP_NAME_FORMAT_INGRESS : map_name + ENHANCED_SWAP_MAP_NAME_FORMAT_EGRESS;
+const char dynmon_swap_lookup_or_init[] = R"(
+static __always_inline VALUETYPE *MAPNAME_swap_FUNCTION(void *key, void *init) {
+  void *map = MAPNAME_swap_current();
+  if (!map)
+    return NULL;
+  VALUETYPE *value = bpf_map_lookup_elem(map, key);
+  if (!value) {
+    bpf_map_update_elem(map, key, init, BPF_NOEXIST);
+    value = bpf_map_lookup_elem(map, key);
+  }
+  return value;
+}
+)";
 
-      if(is_table) {
-        /* BPF_TABLE = 9 char */
-        index_replace_decl_or += 9;
-        index_replace_decl_sw += 10;
-        index_comma_after_name -= 10;
-      } else {
-        /* BPF_QUEUESTACK = 14 char */
-        index_replace_decl_or += 14;
-        index_replace_decl_sw += 15;
-        index_comma_after_name -= 15;
-      }
+const char dynmon_swap_increment[] = R"(
+static __always_inline void MAPNAME_swap_FUNCTION_by(KEYTYPE key, VALUETYPE increment) {
+  void *map = MAPNAME_swap_current();
+  if (!map)
+    return;
+  VALUETYPE *value = bpf_map_lookup_elem(map, &key);
+  if (value) {
+    __sync_fetch_and_add(value, increment);
+    return;
+  }
+  bpf_map_update_elem(map, &key, &increment, BPF_NOEXIST);
+}
+#define MAPNAME_swap_FUNCTION_1(key) MAPNAME_swap_FUNCTION_by(key, 1)
+#define MAPNAME_swap_FUNCTION_2(key, increment) MAPNAME_swap_FUNCTION_by(key, increment)
+#define MAPNAME_swap_FUNCTION(...) \
+  DYNMON_SWAP_SELECT(__VA_ARGS__, MAPNAME_swap_FUNCTION_2, MAPNAME_swap_FUNCTION_1)(__VA_ARGS__)
+)";
 
-      /*Inserting shared in original map and extern in swap map*/
-      original_code.insert(index_replace_decl_or, "_SHARED");
-      swapped_code.erase(index_replace_decl_sw, index_comma_after_name);
-      swapped_code.insert(index_replace_decl_sw, "\"extern\"");
+/*Table types which can be used as inner maps*/
+const std::vector<std::string> SWAPPABLE_TABLE_TYPES = {
+    "hash", "array", "percpu_hash", "percpu_array", "lru_hash", "lru_percpu_hash"};
 
-      /*Replacing map name*/
-      original_code = std::regex_replace(original_code, std::regex(map_name), map_name_repl);
-      swapped_code = std::regex_replace(swapped_code, std::regex(map_name), map_name_repl);
+/**
+ * Internal structure describing the declaration of a swappable map
+ */
+struct MapDeclaration {
+  /*Position and length of the declaration in the code*/
+  size_t position;
+  size_t length;
+  std::string key_type;
+  std::string value_type;
+};
 
-      modified_names.insert({map_name, map_name_repl});
+/**
+ * Internal method to split the arguments of a map declaration
+ *
+ * @param args the text between the declaration parenthesis
+ * @return     the trimmed arguments
+ */
+std::vector<std::string> splitArguments(const std::string &args) {
+  std::vector<std::string> out;
+  std::string current;
+  int depth = 0;
+  for (char c : args) {
+    if (c == '(')
+      depth++;
+    else if (c == ')')
+      depth--;
+    if (c == ',' && depth == 0) {
+      out.push_back(current);
+      current.clear();
+    } else {
+      current += c;
     }
   }
-  return true;
+  out.push_back(current);
+  for (auto &arg : out) {
+    arg = std::regex_replace(arg, std::regex("^\\s+|\\s+$"), "");
+  }
+  return out;
 }
 
 /**
- * Internal method called to adjust the swappable map declaration.
+ * Internal method to find and parse the declaration of a swappable map.
  *
- * NB: the swappable maps don't need to be declared differently, except if they
- *     belong to any of the following types:
- * - SHARED: the user SHOULD have declared a swappable "extern" map in the other
- *           program type
- * - PUBLIC: the user SHOULD have declared a swappable "extern" map in the other
- *           program type
- * - PINNED: the user MUST have declared both the PINNED_MAP and PINNED_MAP_1
- *          (Risky but better than not supported)
- * - extern: the user SHOULD have declared a swappable SHARED/PUBLIC map in the other
- *           program type
+ * Supported declarations are BPF_TABLE with one of the SWAPPABLE_TABLE_TYPES and
+ * the BPF_HASH, BPF_ARRAY, BPF_PERCPU_HASH and BPF_PERCPU_ARRAY helpers.
+ * _SHARED, _PUBLIC, _PINNED and "extern" maps are not program-local, so they
+ * cannot be double-buffered.
  *
- * @param original_code  the original code to be compiled
- * @param swapped_code   the swap code
- * @param maps_to_swap   the list of maps which need to be swapped
- * @param modified_names the list of maps whose names have been modified
- * @return               true if correctly executed, false otherwise
+ * @param code    the code where to look for the declaration
+ * @param mapName the map name
+ * @param decl    the declaration found
+ * @param error   the reason of the failure if any
+ * @return        true if correctly executed, false otherwise
  */
-bool enhancedFixSwappableMaps(std::string &original_code, std::string &swapped_code,
-                         const std::vector<std::string>& maps_to_swap,
-                         std::unordered_map<std::string, std::string> &modified_names) {
-  std::smatch match;
+bool findDeclaration(const std::string &code, const std::string &mapName,
+                     MapDeclaration &decl, std::string &error) {
+  std::regex decl_regex("BPF_(\\w+)\\s*\\(([^;]*)\\)\\s*;");
+  for (auto it = std::sregex_iterator(code.begin(), code.end(), decl_regex);
+       it != std::sregex_iterator(); ++it) {
+    auto &match = *it;
+    auto macro = match[1].str();
+    auto args = splitArguments(match[2].str());
 
-  for(auto &map: maps_to_swap) {
-    /*Checking if able to retrieve map declaration*/
-    if (!std::regex_search(original_code, match, std::regex("BPF.+(" + map + ").+"))) {
-      //Error in regex ?
+    if (macro == "TABLE") {
+      if (args.size() != 5 || args[3] != mapName)
+        continue;
+      auto table_type = std::regex_replace(args[0], std::regex("\""), "");
+      if (std::find(SWAPPABLE_TABLE_TYPES.begin(), SWAPPABLE_TABLE_TYPES.end(),
+                    table_type) == SWAPPABLE_TABLE_TYPES.end()) {
+        error = "table type " + args[0] + " cannot be swapped";
+        return false;
+      }
+      decl.key_type = args[1];
+      decl.value_type = args[2];
+    } else if (macro == "HASH" || macro == "PERCPU_HASH") {
+      if (args[0] != mapName)
+        continue;
+      decl.key_type = args.size() > 1 ? args[1] : "u64";
+      decl.value_type = args.size() > 2 ? args[2] : "u64";
+    } else if (macro == "ARRAY" || macro == "PERCPU_ARRAY") {
+      if (args[0] != mapName)
+        continue;
+      decl.key_type = "int";
+      decl.value_type = args.size() > 1 ? args[1] : "u64";
+    } else {
+      if (std::find(args.begin(), args.end(), mapName) == args.end())
+        continue;
+      error = "BPF_" + macro + " declaration cannot be swapped";
       return false;
     }
-    auto decl = match[0].str();
-
-    /*Checking if special map*/
-    if(decl.find("_SHARED") != std::string::npos ||
-        decl.find("_PINNED") != std::string::npos ||
-        decl.find("_PUBLIC") != std::string::npos ||
-        decl.find("\"extern\"") != std::string::npos) {
-      auto new_name = map + BASE_SWAP_MAP_NAME_FORMAT;
-      swapped_code = std::regex_replace(swapped_code, std::regex(map), new_name);
-      modified_names.insert({map, new_name});
-    }
-    /*All the other maps do not need to be defined differently, since program-scope*/
+    decl.position = match.position(0);
+    decl.length = match.length(0);
+    return true;
   }
-  return true;
+  error = "declaration not found";
+  return false;
 }
 
 /**
- * Internal functions to perform the enhanced compilation.
+ * Internal method to rewrite a single swappable map.
+ *
+ * The declaration is duplicated into the second buffer and followed by the outer
+ * array of maps; every MAP.method(...) call after the declaration is replaced with
+ * the corresponding MAP_swap_method(...) helper.
  *
- * @param original_code the original code to compile
- * @param type          the program type (Ingress/Egress)
- * @param maps_to_swap  the list of maps which need to be swap
- * @param config        the SwapStateConfig to be modified
- * @return              true if correctly performed, false otherwise
+ * @param code    the code to be rewritten
+ * @param mapName the map to be swapped
+ * @param error   the reason of the failure if any
+ * @return        true if correctly executed, false otherwise
  */
-bool try_enhance_compilation(std::string original_code, ProgramType type,
-                             const std::vector<std::string>& maps_to_swap,
-                             SwapStateConfig &config) {
-  auto swapped_code = original_code;
-  /*Defining map holding the map names which have been modified in the same PROGRAM TYPE*/
-  std::unordered_map<std::string, std::string> modified_names;
-  /*Defining map holding the map names which have been modified between INGRESS/EGRESS*/
-  std::unordered_map<std::string, std::string> modified_global_names;
-
-  if(!enhancedFixNotSwappableMaps(original_code, swapped_code, maps_to_swap, modified_names, type)) {
-    return false;
-  }
-  if(!enhancedFixSwappableMaps(original_code, swapped_code, maps_to_swap, modified_global_names)) {
+bool rewriteMap(std::string &code, const std::string &mapName, std::string &error) {
+  MapDeclaration decl;
+  if (!findDeclaration(code, mapName, decl, error)) {
     return false;
   }
+  auto decl_end = decl.position + decl.length;
+  auto declaration = code.substr(decl.position, decl.length);
+  auto usages = code.substr(decl_end);
 
-  /*Modify PIVOTING master code according to the program type*/
-  auto master_code = std::regex_replace(
-      dynmon_swap_master, std::regex("PROGRAMTYPE"),
-      type == ProgramType::INGRESS ? "ingress" : "egress");
+  /*Replacing the method calls, remembering which helpers are needed*/
+  std::regex call_regex("\\b" + mapName + "\\s*\\.\\s*(\\w+)\\s*\\(");
+  std::vector<std::string> methods;
+  std::string rewritten;
+  auto last = usages.cbegin();
+  for (auto it = std::sregex_iterator(usages.begin(), usages.end(), call_regex);
+       it != std::sregex_iterator(); ++it) {
+    auto method = (*it)[1].str();
+    if (method != "lookup" && method != "update" && method != "insert" &&
+        method != "delete" && method != "lookup_or_init" &&
+        method != "lookup_or_try_init" && method != "increment" &&
+        method != "atomic_increment") {
+      error = "method " + method + " cannot be swapped";
+      return false;
+    }
+    if (std::find(methods.begin(), methods.end(), method) == methods.end())
+      methods.push_back(method);
+    rewritten.append(last, (*it)[0].first);
+    rewritten += mapName + SWAP_OUTER_MAP_SUFFIX + "_" + method + "(";
+    last = (*it)[0].second;
+  }
+  rewritten.append(last, usages.cend());
 
-  config = SwapStateConfig(original_code, swapped_code, CompileType::PROGRAM_INDEX_SWAP,
-                           master_code, modified_names, modified_global_names);
-  return true;
-}
+  /*Any other usage (eg. the map passed to an helper) would bypass the indirection*/
+  if (std::regex_search(rewritten, std::regex("\\b" + mapName + "\\b"))) {
+    error = "map used outside of its methods";
+    return false;
+  }
 
-/**
- *  Internal functions to perform the PROGRAM_RELOAD compilation.
- *
- * @param original_code the original code to compile
- * @param maps_to_swap  the list of map which need to be swapped
- * @param config        the SwapStateConfig where all info will be held
- * @return true if correctly executed, false otherwise
- */
-bool do_base_compile(std::string original_code,
-                     const std::vector<std::string>& maps_to_swap,
-                     SwapStateConfig &config) {
-  auto swapped_code = original_code;
-  std::unordered_map<std::string, std::string> modified_names;
-  for(auto &mapName: maps_to_swap) {
-    /*Regex used to change from map NAME to NAME_1 */
-    std::regex name_sub ("(" + mapName + ")");
-    /*Regex to declare also in original program the swapped map and vice-versa.
-      This way every reloaded program steals both the maps, otherwise they would not be
-      seen anymore*/
-    std::regex map_decl ("(BPF_.+" + mapName +".+)");
-    std::smatch match1, match2;
-    /*Replacing the map name in swap code*/
-    swapped_code = std::regex_replace(original_code, name_sub, mapName + BASE_SWAP_MAP_NAME_FORMAT);
-    /*Check if able to find declaration in codes*/
-    if(std::regex_search(swapped_code, match1, map_decl) && std::regex_search(original_code, match2, map_decl)) {
-      /*Retrieving original and swapped declaration and their indexes in codes*/
-      auto orig_decl = match2[0].str(), swap_decl = match1[0].str();
-      auto orig_index = original_code.find(orig_decl), swap_index = swapped_code.find(swap_decl);
-      /*Check if there was an error finding the declaration in the codes*/
-      if(orig_index == std::string::npos || swap_index == std::string::npos){
-        return false;
-      }
-      original_code.insert(orig_index, swap_decl + "\n");
-      swapped_code.insert(swap_index, orig_decl + "\n");
-      /*Map correctly tuned, insert in the list of maps which have the name modified*/
-      modified_names.insert({mapName, mapName + BASE_SWAP_MAP_NAME_FORMAT});
+  /*Building the buffer, the outer map and the helpers declarations*/
+  std::string swap_code = "\n" + std::regex_replace(
+      declaration, std::regex("\\b" + mapName + "\\b"),
+      CodeRewriter::bufferName(mapName, 1));
+  swap_code += dynmon_swap_map;
+  for (auto &method : methods) {
+    std::string helper;
+    if (method == "lookup") {
+      helper = dynmon_swap_lookup;
+    } else if (method == "update" || method == "insert") {
+      helper = std::regex_replace(dynmon_swap_update, std::regex("FLAGS"),
+                                  method == "update" ? "BPF_ANY" : "BPF_NOEXIST");
+    } else if (method == "delete") {
+      helper = dynmon_swap_delete;
+    } else if (method == "lookup_or_init" || method == "lookup_or_try_init") {
+      helper = dynmon_swap_lookup_or_init;
     } else {
-      return false;
+      helper = dynmon_swap_increment;
     }
+    swap_code += std::regex_replace(helper, std::regex("FUNCTION"), method);
   }
-  config = SwapStateConfig(original_code, swapped_code, CompileType::PROGRAM_RELOAD, "", modified_names);
+  swap_code = std::regex_replace(swap_code, std::regex("KEYTYPE"), decl.key_type);
+  swap_code = std::regex_replace(swap_code, std::regex("VALUETYPE"), decl.value_type);
+  swap_code = std::regex_replace(swap_code, std::regex("MAPNAME"), mapName);
+
+  code = code.substr(0, decl_end) + swap_code + rewritten;
   return true;
 }
 
+std::string CodeRewriter::bufferName(const std::string &mapName, int index) {
+  return index == 0 ? mapName : mapName + SWAP_BUFFER_SUFFIX;
+}
 
-/*For the doc read SwapCompiler.h*/
-void CodeRewriter::compile(std::string &original_code, ProgramType type,
-                                      const std::vector<MetricConfigJsonObject> &metricConfigs,
-                                      SwapStateConfig &config,
-                                      const std::shared_ptr<spdlog::logger>& logger){
-  bool is_enabled = false;
+std::string CodeRewriter::outerMapName(const std::string &mapName) {
+  return mapName + SWAP_OUTER_MAP_SUFFIX;
+}
+
+/*For the doc read CodeRewriter.h*/
+void CodeRewriter::compile(std::string &original_code,
+                           const std::vector<MetricConfigJsonObject> &metricConfigs,
+                           SwapStateConfig &config,
+                           const std::shared_ptr<spdlog::logger>& logger){
   std::vector<std::string> maps_to_swap;
   /*Checking if some map has been declared as SWAP, otherwise no compilation will be performed*/
   for(auto &mc : metricConfigs) {
-    if (mc.getExtractionOptions().getSwapOnRead()) {
+    if (mc.getExtractionOptions().getSwapOnRead() &&
+        std::find(maps_to_swap.begin(), maps_to_swap.end(), mc.getMapName()) == maps_to_swap.end()) {
       maps_to_swap.emplace_back(mc.getMapName());
-      is_enabled = true;
     }
   }
-  /*If is enabled, try PROGRAM_INDEX_SWAP compilation or PROGRAM_RELOAD compilation if it has failed.*/
-  if(!is_enabled) {
+  if(maps_to_swap.empty()) {
     config = {};
     logger->info("[Dynmon_CodeRewriter] No map marked as swappable, no rewrites performed");
-  } else if(try_enhance_compilation(original_code, type, maps_to_swap, config)) {
-    logger->info("[Dynmon_CodeRewriter] Successfully rewritten using PROGRAM_INDEX_SWAP technique.");
-  } else if(do_base_compile(original_code, maps_to_swap, config)) {
-    logger->info("[Dynmon_CodeRewriter] Successfully rewritten using PROGRAM_RELOAD technique.");
-  } else {
-    config = {};
-    logger->info("[Dynmon_CodeRewriter] Error while trying to rewrite the code, no rewrites performed");
+    return;
   }
+
+  auto code = original_code;
+  /*Position of the first swappable map, where the shared declarations are injected*/
+  size_t first = std::string::npos;
+  for(auto &map : maps_to_swap) {
+    MapDeclaration decl;
+    std::string error;
+    if(!rewriteMap(code, map, error) || !findDeclaration(code, map, decl, error)) {
+      config = {};
+      logger->warn("[Dynmon_CodeRewriter] Unable to swap map {0}: {1}", map, error);
+      logger->info("[Dynmon_CodeRewriter] Error while trying to rewrite the code, no rewrites performed");
+      return;
+    }
+    first = std::min(first, decl.position);
+  }
+  code.insert(first, dynmon_swap_index);
+
+  config = SwapStateConfig(code, maps_to_swap);
+  logger->info("[Dynmon_CodeRewriter] Successfully rewritten using MAP_SWAP technique.");
 }
@@ -9,47 +9,62 @@ using namespace polycube::service;
 
 namespace polycube {
 namespace service {
-enum class ProgramType;
 
 namespace CodeRewriter {
   /*
    * Enum class to define the Compilation Type:
-   * - None               => there was no need to optimize/compile the injected code
-   * - PROGRAM_RELOAD     => the codes will be alternatively swapped, replacing the current active one
-   *                         (every GET requires almost 400ms seconds to reload the code in the probe)
-   * - PROGRAM_INDEX_SWAP => the codes are both injected as two different programs and they will be
-   *                          managed by a Master code which will pivot them, calling the right
-   *                          alternatively.
-   *                          (every GET requires almost 4ms to change the pivoting index)
+   * - None     => there was no need to optimize/compile the injected code
+   * - MAP_SWAP => every swappable map is double-buffered: the two buffers are stored in an
+   *               outer array of maps and the datapath uses the one selected by a flag.
+   *               Reading a map only flips the flag, the program is never reloaded.
    */
-  enum class CompileType { NONE, PROGRAM_RELOAD, PROGRAM_INDEX_SWAP};
+  enum class CompileType { NONE, MAP_SWAP };
 
-  /*The Master/Pivoting program map name where to store the current active program when CompileType=PROGRAM_INDEX_SWAP*/
-  const char SWAP_MASTER_INDEX_MAP[] = "INTERNAL_PROGRAM_INDEX";
+  /*The map holding the index of the buffer currently used by the datapath when CompileType=MAP_SWAP*/
+  const char SWAP_INDEX_MAP[] = "INTERNAL_SWAP_INDEX";
+
+  /*The suffix of the outer array of maps holding the two buffers of a swappable map*/
+  const char SWAP_OUTER_MAP_SUFFIX[] = "_swap";
+
+  /*The suffix of the second buffer of a swappable map*/
+  const char SWAP_BUFFER_SUFFIX[] = "_1";
+
+  /**
+   * Method to return the name of a buffer of a swappable map
+   *
+   * @param mapName the original map name
+   * @param index   the buffer index (0 or 1)
+   * @return        the buffer name
+   */
+  std::string bufferName(const std::string &mapName, int index);
+
+  /**
+   * Method to return the name of the outer array of maps of a swappable map
+   *
+   * @param mapName the original map name
+   * @return        the outer map name
+   */
+  std::string outerMapName(const std::string &mapName);
 
   /**
    * Method to compile/optimize user injected code according to the parameter he has inserted.
    * Firstly, it is checked if there's the need of performing optimization.
-   * If some map has been declared as swappable, then will be performed the following
-   * optimization in cascade if some of them fails:
-   * - PROGRAM_INDEX_SWAP: a master pivoting code will control which program to call when new
-   *            packets arrive; new parallel maps will be declared and for those which
-   *            have not been declared swappable, a SHARED map will be used among the
-   *            two programs.
-   *            Read time: 5ms (index change) + time to read map
-   * - PROGRAM_RELOAD:    two codes will be generated and they will alternatively be loaded into
-   *            the probe. Every swappable map has a modified name in the second program,
-   *            while the non-swappable will be shared thanks to program map stealing.
-   *            Read time: 400ms (program reload) + time to read map
+   * If some map has been declared as swappable, then the MAP_SWAP rewrite is performed:
+   * - a second buffer MAP_1 is declared with the same declaration of MAP;
+   * - an outer array of maps MAP_swap is declared to hold the two buffers;
+   * - every MAP.method(...) call is replaced with a helper which looks up the
+   *   current buffer through INTERNAL_SWAP_INDEX and MAP_swap.
+   * If some swappable map cannot be rewritten, the code is left unchanged.
+   *
+   * Read time: a single array update + time to read map
    *
    * @param original_code
-   * @param type
    * @param metricConfigs
    * @param config
    * @param logger
    */
-  extern void compile(std::string &original_code, ProgramType type,
-                   const std::vector<MetricConfigJsonObject> &metricConfigs,
-                                 SwapStateConfig &config,
-                                 const std::shared_ptr<spdlog::logger>& logger);
-}}}
\ No newline at end of file
+  extern void compile(std::string &original_code,
+                      const std::vector<MetricConfigJsonObject> &metricConfigs,
+                      SwapStateConfig &config,
+                      const std::shared_ptr<spdlog::logger>& logger);
+}}}
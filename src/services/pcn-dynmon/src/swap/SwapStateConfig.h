@@ -1,8 +1,7 @@
 #pragma once
 
 #include <string>
-#include <array>
-#include <unordered_map>
+#include <vector>
 
 
 namespace polycube{
@@ -14,36 +13,28 @@ namespace polycube{
 using namespace polycube::service::CodeRewriter;
 
 /**
- * Container class responsible of holding all data concerning the program
+ * Container class responsible of holding all data concerning the map
  * swap state and needs
  */
 class SwapStateConfig {
  public:
   SwapStateConfig();
   /**
-   * Constructor used by SwapCompiler once finished compiling the code
+   * Constructor used by CodeRewriter once finished compiling the code
    *
-   * @param original_code the "original" tuned code
-   * @param swapped_code  the swap tuned code
-   * @param compileType   the type of the compilation performed
-   * @param master_code   the pivoting code to inject in case of an ENHANCED compilation
-   * @param names         an hash map containing the new names of those maps which have changed
-   * @param global_names  an hash map holding the new names of those maps shared among
-   *                      INGRESS and EGRESS for whose was enabled SWAP-ON-READ
+   * @param code         the tuned code, where the swappable maps are double-buffered
+   * @param swapped_maps the names of the swappable maps
    */
-  SwapStateConfig(std::string original_code, std::string swapped_code,
-                  CompileType compileType, std::string master_code = "",
-                  std::unordered_map<std::string,std::string> names = {},
-                  std::unordered_map<std::string,std::string> global_names = {});
+  SwapStateConfig(std::string code, std::vector<std::string> swapped_maps);
 
   /**
-   * Method to trigger a read. Modify accordingly the next program index
+   * Method to trigger a read. Modify accordingly the buffer index used by the datapath
    *
-   * @return the next index to be used to call eBPF program
+   * @return the next buffer index to be used by the datapath
    */
   int triggerRead() {
-    current_program_index = (current_program_index % 2) + 1;
-    return current_program_index;
+    current_index ^= 1;
+    return current_index;
   }
 
   /**
@@ -56,58 +47,39 @@ class SwapStateConfig {
   }
 
   /**
-   * Method to return the return the next code to load.
+   * Method to return the tuned code to load
    *
-   * @return the "original" code
+   * @return the tuned code
    */
-  const std::string &getCodeToLoad() {
-    return codes[current_program_index];
+  const std::string &getCode() {
+    return code;
   }
 
   /**
-   * Method to return the "original" code
+   * Method to return the names of the swappable maps
    *
-   * @return the "original" code
+   * @return the swappable maps
    */
-  const std::string &getOriginalCode() {
-    return codes[1];
+  const std::vector<std::string> &getSwappedMaps() {
+    return swapped_maps;
   }
 
   /**
-   * Method to return the swap code
+   * Method to return the name of the map to read.
+   * For a swappable map it is the buffer which is not used by the datapath.
    *
-   * @return the swap code
+   * @param mapName the map name in the metric configuration
+   * @return        the name of the map where I can/should read from
    */
-  const std::string &getSwappedCode() {
-    return codes[2];
-  }
-
-  /**
-   * Method to return the Master pivoting code
-   *
-   * @return the master pivoting code
-   */
-  const std::string &getMasterCode() {
-    return codes[0];
-  }
-
-  /**
-   * Method to return the index of the program where to read the map from.
-   * This method also modifies the mapName if needed.
-   *
-   * @return the index of the program which is not loaded (where I can/should read the maps)
-   */
-  int getProgramIndexAndMapNameToRead(std::string &mapName);
+  std::string getMapNameToRead(const std::string &mapName);
 
  private:
-  /** Variable to keep track of the current program index*/
-  int current_program_index;
-  /** Array to store the optimized codes */
-  std::array<std::string, 3> codes;
-  /** Variable to keep track of the map tuned name if any */
-  std::unordered_map<std::string, std::string> enhanced_names;
-  /** Variable to keep track of the map tuned name between EGRESS-INGRESS if any */
-  std::unordered_map<std::string, std::string> enhanced_global_names;
+  /** Variable to keep track of the buffer currently used by the datapath */
+  int current_index;
+  /** The optimized code */
+  std::string code;
+  /** The names of the swappable maps */
+  std::vector<std::string> swapped_maps;
   /** Variable to keep track of the compilation type */
   CompileType compileType;
-};
\ No newline at end of file
+};
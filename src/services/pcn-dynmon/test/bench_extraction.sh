@@ -0,0 +1,68 @@
+#! /bin/bash
+
+#                 ===dynmon map extraction benchmark===
+#
+# Injects a dataplane filling a 16384 entries array of counters and a 16384
+# entries hash map of structs, sends enough packets from ns1 with the pktgen
+# kernel module to fill both maps, and then times repeated reads of the JSON
+# metrics and of the OpenMetrics endpoint. At the end it prints the number of
+# map entries extracted per second by each endpoint.
+#
+# usage: bench_extraction.sh [reads] [TC|XDP_SKB|XDP_DRV]
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+READS=${1:-20}
+TYPE=${2:-TC}
+ENTRIES=16384
+
+set -e
+
+DIR=$(dirname "$0")
+URL="localhost:9000/polycube/v1/dynmon/dm"
+
+function cleanup {
+  set +e
+  polycubectl dynmon del dm
+  delete_veth 2
+}
+trap cleanup EXIT
+
+create_veth 2
+
+polycubectl dynmon add dm type=$TYPE
+polycubectl attach dm veth1
+curl -s -H "Content-Type: application/json" "$URL/dataplane-config" --upload-file $DIR/bench_extraction.json
+
+sudo modprobe pktgen
+veth2_mac=$(sudo ip netns exec ns2 cat /sys/class/net/veth2_/address)
+
+function pgset {
+  sudo ip netns exec ns1 sh -c "echo \"$2\" > /proc/net/pktgen/$1"
+}
+
+pgset kpktgend_0 "rem_device_all"
+pgset kpktgend_0 "add_device veth1_"
+pgset veth1_ "count $((ENTRIES * 4))"
+pgset veth1_ "pkt_size 64"
+pgset veth1_ "delay 0"
+pgset veth1_ "dst 10.0.0.2"
+pgset veth1_ "dst_mac $veth2_mac"
+pgset pgctrl "start"
+
+# time_reads <path> <map entries per read>
+function time_reads {
+  # the first read warms up the extraction of the map
+  curl -s -o /dev/null "$URL/$1"
+  local start=$(date +%s.%N)
+  for i in $(seq $READS); do
+    curl -s -o /dev/null "$URL/$1"
+  done
+  local end=$(date +%s.%N)
+  local elapsed=$(echo "$end - $start" | bc)
+  echo "$1: $READS reads in $elapsed s, $(echo "$READS * $2 / $elapsed" | bc) entries/s"
+}
+
+time_reads "metrics/ingress-metrics/packets_per_slot/value" $ENTRIES
+time_reads "metrics/ingress-metrics/flows/value" $ENTRIES
+time_reads "open-metrics" $ENTRIES
@@ -0,0 +1,102 @@
+#! /bin/bash
+
+# include helper.bash file: used to provide some common function across testing scripts
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+# function cleanup: is invoked each time script exit (with or without errors)
+# please remember to cleanup all entities previously created:
+# namespaces, veth, cubes, ..
+function cleanup {
+  set +e
+  polycubectl dynmon del dm
+  delete_veth 2
+  kill $server_pid
+  rm -f $pushed
+}
+trap cleanup EXIT
+
+# Enable verbose output
+set -x
+
+# Makes the script exit, at first error
+# Errors are thrown by commands returning not 0 value
+set -e
+
+DIR=$(dirname "$0")
+
+TYPE="TC"
+
+if [ -n "$1" ]; then
+  TYPE=$1
+fi
+
+PORT=9191
+
+# local stand-in of the push endpoint, saving the body of every POST request
+pushed=$(mktemp)
+python3 -c "
+import http.server, sys
+class Handler(http.server.BaseHTTPRequestHandler):
+    def do_POST(self):
+        body = self.rfile.read(int(self.headers['Content-Length']))
+        with open(sys.argv[1], 'ab') as f:
+            f.write(body)
+        self.send_response(200)
+        self.end_headers()
+http.server.HTTPServer(('127.0.0.1', $PORT), Handler).serve_forever()
+" $pushed &
+server_pid=$!
+
+# helper.bash function, creates namespaces and veth connected to them
+create_veth 2
+
+# create instance of service dynmon
+polycubectl dynmon add dm type=$TYPE
+
+# attaching the monitor to veth1
+polycubectl attach dm veth1
+
+# injecting the per-cpu dataplane configuration
+curl -H "Content-Type: application/json" "localhost:9000/polycube/v1/dynmon/dm/dataplane-config" --upload-file $DIR/test_percpu.json
+
+# collecting the metrics every second and pushing them to the stand-in
+polycubectl dm collector set interval=1 push-url=http://127.0.0.1:$PORT/metrics/job/dynmon
+polycubectl dm collector show
+
+set +e
+ping_result=$(sudo ip netns exec ns1 ping 10.0.0.2 -c 4 -w 4 | grep -Po '[0-9]+(?= +packets transmitted)')
+set -e
+
+# waiting for a collection after the pings
+sleep 2
+
+# the readers are served from the latest snapshot, so two consecutive reads
+# return the same timestamp unless a collection happens in between
+same_snapshot=0
+for i in 1 2 3; do
+  first=$(curl -s "localhost:9000/polycube/v1/dynmon/dm/metrics/ingress-metrics/packets_total/timestamp")
+  second=$(curl -s "localhost:9000/polycube/v1/dynmon/dm/metrics/ingress-metrics/packets_total/timestamp")
+  if [ "$first" == "$second" ]; then
+    same_snapshot=1
+    break
+  fi
+done
+
+if [ $same_snapshot -ne 1 ];
+then
+    echo "Error: the metrics are not served from the collected snapshot"
+    exit 1
+fi;
+
+cat $pushed
+metric_value=$(sed -n "s/^packets_total{} \([0-9]*\).*$/\1/p" $pushed | tail -n 1)
+
+if [ -z "$metric_value" ] || [ $metric_value -lt $ping_result ];
+then
+    echo "Error: expected a push with packets_total >= $ping_result"
+    echo "packets_total: $metric_value"
+    exit 1
+else
+    echo "packets_total: $metric_value"
+    echo "TEST: OK"
+fi;
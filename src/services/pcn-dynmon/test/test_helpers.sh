@@ -0,0 +1,67 @@
+#! /bin/bash
+
+# include helper.bash file: used to provide some common function across testing scripts
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+# function cleanup: is invoked each time script exit (with or without errors)
+# please remember to cleanup all entities previously created:
+# namespaces, veth, cubes, ..
+function cleanup {
+  set +e
+  polycubectl dynmon del dm
+  delete_veth 2
+}
+trap cleanup EXIT
+
+# Enable verbose output
+set -x
+
+# Makes the script exit, at first error
+# Errors are thrown by commands returning not 0 value
+set -e
+
+DIR=$(dirname "$0")
+
+TYPE="TC"
+
+if [ -n "$1" ]; then
+  TYPE=$1
+fi
+
+# helper.bash function, creates namespaces and veth connected to them
+create_veth 2
+
+# create instance of service dynmon
+polycubectl dynmon add dm type=$TYPE
+
+# attaching the monitor to veth1
+polycubectl attach dm veth1
+
+# injecting a dataplane configuration with histograms and sketches of the datapath helpers
+curl -H "Content-Type: application/json" "localhost:9000/polycube/v1/dynmon/dm/dataplane-config" --upload-file $DIR/test_helpers.json
+polycubectl dm show
+
+set +e
+ping_result=$(sudo ip netns exec ns1 ping 10.0.0.2 -c 4 -w 4 | grep -Po '[0-9]+(?= +packets transmitted)')
+set -e
+
+polycubectl dm metrics ingress-metrics packet_size show
+
+# the histogram counts every packet in its +Inf bucket, while the HyperLogLog
+# sketch estimates a single destination, as all the pings are sent to 10.0.0.2
+open_metrics=$(curl -s "localhost:9000/polycube/v1/dynmon/dm/open-metrics")
+echo "$open_metrics"
+packets_value=$(echo -e "$open_metrics" | sed -n 's/^packet_size_bucket{le="+Inf"} \([0-9]*\).*$/\1/p')
+destinations_value=$(echo -e "$open_metrics" | sed -n "s/^packet_destinations{} \([0-9]*\).*$/\1/p")
+
+if [ -z "$packets_value" ] || [ $packets_value -lt $ping_result ] || [ "$destinations_value" != "1" ];
+then
+    echo "Error: expected packets >= $ping_result and packet_destinations = 1"
+    echo "packets: $packets_value"
+    echo "packet_destinations: $destinations_value"
+    exit 1
+else
+    echo "packets: $packets_value"
+    echo "packet_destinations: $destinations_value"
+    echo "TEST: OK"
+fi;
@@ -0,0 +1,64 @@
+#! /bin/bash
+
+# include helper.bash file: used to provide some common function across testing scripts
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+# function cleanup: is invoked each time script exit (with or without errors)
+# please remember to cleanup all entities previously created:
+# namespaces, veth, cubes, ..
+function cleanup {
+  set +e
+  polycubectl dynmon del dm
+  delete_veth 2
+}
+trap cleanup EXIT
+
+# Enable verbose output
+set -x
+
+# Makes the script exit, at first error
+# Errors are thrown by commands returning not 0 value
+set -e
+
+DIR=$(dirname "$0")
+
+TYPE="TC"
+
+if [ -n "$1" ]; then
+  TYPE=$1
+fi
+
+# helper.bash function, creates namespaces and veth connected to them
+create_veth 2
+
+# create instance of service dynmon
+polycubectl dynmon add dm type=$TYPE
+
+# attaching the monitor to veth1
+polycubectl attach dm veth1
+
+# injecting a dataplane configuration with swappable maps
+curl -H "Content-Type: application/json" "localhost:9000/polycube/v1/dynmon/dm/dataplane-config" --upload-file $DIR/test_swap.json
+polycubectl dm show
+
+# every read flips the buffer used by the datapath and reads the other one,
+# so the first read returns the packets counted so far
+polycubectl dm metrics ingress-metrics packets_total value show
+
+set +e
+ping_result=$(sudo ip netns exec ns1 ping 10.0.0.2 -c 4 -w 4 | grep -Po '[0-9]+(?= +packets transmitted)')
+set -e
+
+first=$(polycubectl dm metrics ingress-metrics packets_total value show | sed -n "s/^\[\([0-9]*\)\]$/\1/p")
+second=$(polycubectl dm metrics ingress-metrics packets_total value show | sed -n "s/^\[\([0-9]*\)\]$/\1/p")
+polycubectl dm metrics ingress-metrics packets_per_key show
+
+if [ $first -lt $ping_result ] || [ $second -ge $first ];
+then
+    echo "Error: expected first read >= $ping_result and second read < first read"
+    echo "first read: $first, second read: $second"
+    exit 1
+else
+    echo "first read: $first, second read: $second"
+    echo "TEST: OK"
+fi;
@@ -25,24 +25,36 @@
 using namespace Tins;
 namespace poly_utils = polycube::service::utils;
 
-const std::string K8sdispatcher::EBPF_EGRESS_SESSION_TABLE =
-    "egress_session_table";
-const std::string K8sdispatcher::EBPF_INGRESS_SESSION_TABLE =
-    "ingress_session_table";
+const std::string K8sdispatcher::EBPF_SESSION_TABLE = "session_table";
+const std::string K8sdispatcher::EBPF_SESSION_INDEX = "session_index";
+const std::string K8sdispatcher::EBPF_SESSION_STATS = "session_stats";
+const std::string K8sdispatcher::EBPF_PORT_ALLOCATOR = "port_allocator";
 const std::string K8sdispatcher::EBPF_NPR_TABLE_MAP = "npr_table";
+const std::string K8sdispatcher::EBPF_NPR_STATS_MAP = "npr_stats";
+
+// Ports used to translate the source of the sessions
+#define FIRST_SESSION_PORT 1024
+#define LAST_SESSION_PORT 65534
 
 K8sdispatcher::K8sdispatcher(const std::string name,
                              const K8sdispatcherJsonObject &conf)
-    : Cube(conf.getBase(), {k8sdispatcher_code}, {}),
+    : Cube(conf.getBase(),
+           {"#define SESSION_MAP_DIM " +
+            std::to_string(conf.getSessionTableSize()) + "\n" +
+            k8sdispatcher_code},
+           {}),
       K8sdispatcherBase(name),
       internalSrcIp_{conf.getInternalSrcIp()},
       internalSrcIpNboInt_{poly_utils::ip_string_to_nbo_uint(internalSrcIp_)},
       nodeportRange_{"30000-32767"},
       nodeportRangeTuple_{30000, 32767},
-      nodeIpNboInt_{0} {
+      nodeIpNboInt_{0},
+      sessionTableSize_{conf.getSessionTableSize()} {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [K8sDispatcher] [%n] [%l] %v");
   logger()->info("Creating K8sDispatcher instance");
 
+  this->initPortAllocator();
+
   if (conf.nodeportRangeIsSet()) {
     this->setNodeportRange(conf.getNodeportRange());
   }
@@ -177,6 +189,8 @@ void K8sdispatcher::setNodeportRange(const std::string &value) {
   try {
     auto npr_table = get_hash_table<struct nt_k, struct nt_v>(
         K8sdispatcher::EBPF_NPR_TABLE_MAP);
+    auto npr_stats = get_percpuhash_table<struct nt_k, uint64_t>(
+        K8sdispatcher::EBPF_NPR_STATS_MAP);
 
     for (auto const &rule : this->getNodeportRuleList()) {
       uint16_t port = rule->getNodeportPort();
@@ -185,6 +199,7 @@ void K8sdispatcher::setNodeportRange(const std::string &value) {
         nt_k npr_key{.port = htons(port),
                      .proto = utils::L4ProtoEnum_to_int(proto)};
         npr_table.remove(npr_key);
+        npr_stats.remove(npr_key);
 
         if (this->nodePortRuleMap_.erase(NodeportKey(port, proto)) != 1) {
           std::runtime_error{"Failed to delete NodePort rule from user map"};
@@ -201,33 +216,76 @@ void K8sdispatcher::setNodeportRange(const std::string &value) {
   this->nodeportRange_ = value;
 }
 
+uint32_t K8sdispatcher::getSessionTableSize() {
+  return this->sessionTableSize_;
+}
+
+uint64_t K8sdispatcher::getPortAllocationFailures() {
+  auto stats =
+      get_percpuarray_table<uint64_t>(K8sdispatcher::EBPF_SESSION_STATS);
+  uint64_t failures = 0;
+  for (auto value : stats.get(
+           static_cast<uint32_t>(SessionStats::PORT_ALLOC_FAILURES))) {
+    failures += value;
+  }
+  return failures;
+}
+
+std::shared_ptr<SessionRule> K8sdispatcher::makeSessionRule(
+    SessionRuleDirectionEnum direction, const st_k &key, const st_v &value) {
+  return std::make_shared<SessionRule>(
+      *this, direction, poly_utils::nbo_uint_to_ip_string(key.src_ip),
+      poly_utils::nbo_uint_to_ip_string(key.dst_ip), ntohs(key.src_port),
+      ntohs(key.dst_port), utils::int_to_L4ProtoEnum(key.proto),
+      poly_utils::nbo_uint_to_ip_string(value.new_ip), ntohs(value.new_port),
+      utils::int_to_SessionRuleOperationEnum(value.operation),
+      utils::int_to_SessionRuleOriginatingRuleEnum(value.originating_rule));
+}
+
+static SessionRuleDirectionEnum session_direction(uint8_t direction,
+                                                  bool reverse) {
+  bool egress = direction == static_cast<uint8_t>(SessionDirection::EGRESS);
+  return egress != reverse ? SessionRuleDirectionEnum::EGRESS
+                           : SessionRuleDirectionEnum::INGRESS;
+}
+
+static bool st_k_equal(const st_k &a, const st_k &b) {
+  return a.src_ip == b.src_ip && a.dst_ip == b.dst_ip &&
+         a.src_port == b.src_port && a.dst_port == b.dst_port &&
+         a.proto == b.proto;
+}
+
 std::shared_ptr<SessionRule> K8sdispatcher::getSessionRule(
     const SessionRuleDirectionEnum &direction, const std::string &srcIp,
     const std::string &dstIp, const uint16_t &srcPort, const uint16_t &dstPort,
     const L4ProtoEnum &proto) {
   try {
-    auto table = get_hash_table<st_k, st_v>(
-        direction == SessionRuleDirectionEnum::EGRESS
-            ? K8sdispatcher::EBPF_EGRESS_SESSION_TABLE
-            : K8sdispatcher::EBPF_INGRESS_SESSION_TABLE);
+    auto table =
+        get_hash_table<st_k, session>(K8sdispatcher::EBPF_SESSION_TABLE);
     st_k map_key{.src_ip = poly_utils::ip_string_to_nbo_uint(srcIp),
                  .dst_ip = poly_utils::ip_string_to_nbo_uint(dstIp),
                  .src_port = htons(srcPort),
                  .dst_port = htons(dstPort),
                  .proto = utils::L4ProtoEnum_to_int(proto)};
 
-    st_v value = table.get(map_key);
-
-    std::string newIp = poly_utils::nbo_uint_to_ip_string(value.new_ip);
-    uint16_t newPort = ntohs(value.new_port);
-    SessionRuleOperationEnum operation =
-        utils::int_to_SessionRuleOperationEnum(value.operation);
-    SessionRuleOriginatingRuleEnum originatingRule =
-        utils::int_to_SessionRuleOriginatingRuleEnum(value.originating_rule);
+    // The key is either the one of the packet that created the session...
+    try {
+      session s = table.get(map_key);
+      if (session_direction(s.direction, false) == direction) {
+        return makeSessionRule(direction, map_key, s.forward);
+      }
+    } catch (std::exception &) {
+    }
 
-    return std::make_shared<SessionRule>(*this, direction, srcIp, dstIp,
-                                         srcPort, dstPort, proto, newIp,
-                                         newPort, operation, originatingRule);
+    // ... or the one of the packets in the other direction
+    auto index =
+        get_hash_table<st_k, st_k>(K8sdispatcher::EBPF_SESSION_INDEX);
+    session s = table.get(index.get(map_key));
+    if (!st_k_equal(s.reverse_key, map_key) ||
+        session_direction(s.direction, true) != direction) {
+      throw std::runtime_error("Stale session index entry");
+    }
+    return makeSessionRule(direction, map_key, s.reverse);
   } catch (std::exception &ex) {
     logger()->error("Failed to get session rule: {}", ex.what());
     throw std::runtime_error("Failed to get session rule");
@@ -236,31 +294,17 @@ std::shared_ptr<SessionRule> K8sdispatcher::getSessionRule(
 
 std::vector<std::shared_ptr<SessionRule>> K8sdispatcher::getSessionRuleList() {
   std::vector<std::shared_ptr<SessionRule>> rules;
-  std::vector<std::string> tableNames{
-      K8sdispatcher::EBPF_EGRESS_SESSION_TABLE,
-      K8sdispatcher::EBPF_INGRESS_SESSION_TABLE};
   try {
-    for (auto &tableName : tableNames) {
-      auto table = get_hash_table<struct st_k, struct st_v>(tableName);
-      auto direction = tableName == K8sdispatcher::EBPF_INGRESS_SESSION_TABLE
-                           ? SessionRuleDirectionEnum::INGRESS
-                           : SessionRuleDirectionEnum::EGRESS;
-      for (auto &entry : table.get_all()) {
-        auto key = entry.first;
-        auto value = entry.second;
-
-        auto rule = std::make_shared<SessionRule>(
-            *this, direction, poly_utils::nbo_uint_to_ip_string(key.src_ip),
-            poly_utils::nbo_uint_to_ip_string(key.dst_ip), ntohs(key.src_port),
-            ntohs(key.dst_port), utils::int_to_L4ProtoEnum(key.proto),
-            poly_utils::nbo_uint_to_ip_string(value.new_ip),
-            ntohs(value.new_port),
-            utils::int_to_SessionRuleOperationEnum(value.operation),
-            utils::int_to_SessionRuleOriginatingRuleEnum(
-                value.originating_rule));
-
-        rules.push_back(rule);
-      }
+    auto table =
+        get_hash_table<st_k, session>(K8sdispatcher::EBPF_SESSION_TABLE);
+    // Each session holds the entries of both directions
+    for (auto &entry : table.get_all()) {
+      auto &key = entry.first;
+      auto &value = entry.second;
+      rules.push_back(makeSessionRule(session_direction(value.direction, false),
+                                      key, value.forward));
+      rules.push_back(makeSessionRule(session_direction(value.direction, true),
+                                      value.reverse_key, value.reverse));
     }
   } catch (std::exception &ex) {
     logger()->error("Failed to get session rules list: {0}", ex.what());
@@ -368,6 +412,9 @@ void K8sdispatcher::addNodeportRule(const uint16_t &nodeportPort,
 
     logger()->trace("Storing NodePort rule in NodePort rules kernel map");
     npr_table.set(npr_key, npr_value);
+    auto npr_stats = get_percpuhash_table<nt_k, uint64_t>(
+        K8sdispatcher::EBPF_NPR_STATS_MAP);
+    npr_stats.set(npr_key, uint64_t{0});
     logger()->trace("Stored NodePort rule in NodePort rules kernel map");
   } catch (std::exception &ex) {
     logger()->warn("Failed to store NodePort rule in kernel map: {}",
@@ -436,6 +483,12 @@ void K8sdispatcher::delNodeportRule(const uint16_t &nodeportPort,
                  .proto = utils::L4ProtoEnum_to_int(proto)};
 
     npr_table.remove(npr_key);
+    try {
+      get_percpuhash_table<nt_k, uint64_t>(K8sdispatcher::EBPF_NPR_STATS_MAP)
+          .remove(npr_key);
+    } catch (std::exception &ex) {
+      logger()->debug("No NodePort rule counters to delete: {}", ex.what());
+    }
 
     if (this->nodePortRuleMap_.erase(key) == 0) {
       std::runtime_error{"No NodePort rule associated with the provided key"};
@@ -454,6 +507,36 @@ void K8sdispatcher::delNodeportRuleList() {
   }
 }
 
+uint64_t K8sdispatcher::getNodeportSessionsCreated(
+    const uint16_t &nodeportPort, const L4ProtoEnum &proto) {
+  auto npr_stats = get_percpuhash_table<nt_k, uint64_t>(
+      K8sdispatcher::EBPF_NPR_STATS_MAP);
+  nt_k npr_key{.port = htons(nodeportPort),
+               .proto = utils::L4ProtoEnum_to_int(proto)};
+  uint64_t sessions = 0;
+  for (auto value : npr_stats.get(npr_key)) {
+    sessions += value;
+  }
+  return sessions;
+}
+
+uint32_t K8sdispatcher::getNodeportActiveSessions(const uint16_t &nodeportPort,
+                                                  const L4ProtoEnum &proto) {
+  auto table = get_hash_table<st_k, session>(K8sdispatcher::EBPF_SESSION_TABLE);
+  uint16_t port = htons(nodeportPort);
+  uint8_t l4proto = utils::L4ProtoEnum_to_int(proto);
+  uint32_t sessions = 0;
+  for (auto &entry : table.get_all()) {
+    if (entry.second.forward.originating_rule ==
+            utils::SessionRuleOriginatingRuleEnum_to_int(
+                SessionRuleOriginatingRuleEnum::NODEPORT_CLUSTER) &&
+        entry.first.dst_port == port && entry.first.proto == l4proto) {
+      sessions++;
+    }
+  }
+  return sessions;
+}
+
 void K8sdispatcher::reloadConfig() {
   std::string flags;
 
@@ -468,8 +551,10 @@ void K8sdispatcher::reloadConfig() {
   flags += "#define FRONTEND_PORT " + std::to_string(frontend) + "\n";
   flags += "#define BACKEND_PORT " + std::to_string(backend) + "\n";
   flags += "#define NODE_IP " + std::to_string(this->nodeIpNboInt_) + "\n";
+  flags += "#define INTERNAL_SRC_IP " +
+           std::to_string(this->internalSrcIpNboInt_) + "\n";
   flags +=
-      "#define INTERNAL_SRC_IP " + std::to_string(this->internalSrcIpNboInt_);
+      "#define SESSION_MAP_DIM " + std::to_string(this->sessionTableSize_);
 
   logger()->trace("Reloading code with the following flags:\n{}", flags);
 
@@ -478,6 +563,31 @@ void K8sdispatcher::reloadConfig() {
   logger()->trace("Reloaded K8sDispatcher code");
 }
 
+void K8sdispatcher::initPortAllocator() {
+  // Split the port space among the cpus, so that each of them can allocate
+  // ports without synchronizing with the others
+  unsigned int ncpus = polycube::get_possible_cpu_count();
+  uint32_t ports = LAST_SESSION_PORT - FIRST_SESSION_PORT + 1;
+  uint32_t ports_per_cpu = ports / ncpus;
+
+  std::vector<port_allocator> allocators;
+  for (unsigned int i = 0; i < ncpus; i++) {
+    port_allocator allocator;
+    allocator.first = FIRST_SESSION_PORT + i * ports_per_cpu;
+    allocator.last = (i == ncpus - 1) ? LAST_SESSION_PORT
+                                      : allocator.first + ports_per_cpu - 1;
+    allocator.next = allocator.first;
+    allocators.push_back(allocator);
+  }
+
+  auto table =
+      get_percpuarray_table<port_allocator>(K8sdispatcher::EBPF_PORT_ALLOCATOR);
+  table.set(0, allocators);
+
+  logger()->debug("Port range {0}-{1} split among {2} cpus",
+                  FIRST_SESSION_PORT, LAST_SESSION_PORT, ncpus);
+}
+
 std::shared_ptr<Ports> K8sdispatcher::getFrontendPort() {
   for (auto &it : get_ports()) {
     if (it->getType() == PortsTypeEnum::FRONTEND) {
@@ -67,6 +67,16 @@ class K8sdispatcher : public K8sdispatcherBase {
   std::string getNodeportRange() override;
   void setNodeportRange(const std::string &value) override;
 
+  /// <summary>
+  /// Maximum number of sessions tracked by the dispatcher
+  /// </summary>
+  uint32_t getSessionTableSize() override;
+
+  /// <summary>
+  /// Number of sessions dropped because no free port was found
+  /// </summary>
+  uint64_t getPortAllocationFailures() override;
+
   /// <summary>
   /// Session entry related to a specific traffic direction
   /// </summary>
@@ -114,9 +124,17 @@ class K8sdispatcher : public K8sdispatcherBase {
                        const L4ProtoEnum &proto) override;
   void delNodeportRuleList() override;
 
-  static const std::string EBPF_EGRESS_SESSION_TABLE;
-  static const std::string EBPF_INGRESS_SESSION_TABLE;
+  uint64_t getNodeportSessionsCreated(const uint16_t &nodeportPort,
+                                      const L4ProtoEnum &proto);
+  uint32_t getNodeportActiveSessions(const uint16_t &nodeportPort,
+                                     const L4ProtoEnum &proto);
+
+  static const std::string EBPF_SESSION_TABLE;
+  static const std::string EBPF_SESSION_INDEX;
+  static const std::string EBPF_SESSION_STATS;
+  static const std::string EBPF_PORT_ALLOCATOR;
   static const std::string EBPF_NPR_TABLE_MAP;
+  static const std::string EBPF_NPR_STATS_MAP;
 
   typedef std::tuple<uint16_t, L4ProtoEnum> NodeportKey;
 
@@ -128,11 +146,18 @@ class K8sdispatcher : public K8sdispatcherBase {
 
   uint32_t nodeIpNboInt_;
 
+  uint32_t sessionTableSize_;
+
   std::unordered_map<NodeportKey, std::shared_ptr<NodeportRule>>
       nodePortRuleMap_;
 
   void reloadConfig();
 
+  void initPortAllocator();
+
+  std::shared_ptr<SessionRule> makeSessionRule(
+      SessionRuleDirectionEnum direction, const st_k &key, const st_v &value);
+
   std::shared_ptr<Ports> getFrontendPort();
 
   std::shared_ptr<Ports> getBackendPort();
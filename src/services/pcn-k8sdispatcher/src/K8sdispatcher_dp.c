@@ -42,7 +42,12 @@
 #define INTERNAL_SRC_IP 0
 #endif
 
+#ifndef SESSION_MAP_DIM
 #define SESSION_MAP_DIM 32768
+#endif
+
+// Max number of ports tried before giving up
+#define PORT_MAX_ATTEMPTS 8
 
 enum OPERATION_TYPE { OP_XLATE_SRC = 0, OP_XLATE_DST = 1 };
 
@@ -52,6 +57,15 @@ enum EXTERNAL_TRAFFIC_POLICY_TYPE { ETP_LOCAL = 0, ETP_CLUSTER = 1 };
 
 enum SLOWPATH_REASON { REASON_ARP_REPLY = 0 };
 
+// Direction of a packet: EGRESS if coming from the BACKEND port
+enum SESSION_DIRECTION_TYPE { DIR_EGRESS = 0, DIR_INGRESS = 1 };
+
+enum SESSION_STATS_TYPE {
+  STATS_SESSIONS_CREATED = 0,
+  STATS_PORT_ALLOC_FAILURES = 1,
+  STATS_DIM = 2
+};
+
 #define IP_CSUM_OFFSET (sizeof(struct eth_hdr) + offsetof(struct iphdr, check))
 #define UDP_CSUM_OFFSET                            \
   (sizeof(struct eth_hdr) + sizeof(struct iphdr) + \
@@ -96,10 +110,57 @@ struct st_v {
   uint8_t operation;
   uint8_t originating_rule;
 } __attribute__((packed));
-BPF_TABLE("lru_hash", struct st_k, struct st_v, egress_session_table,
-          SESSION_MAP_DIM);
-BPF_TABLE("lru_hash", struct st_k, struct st_v, ingress_session_table,
+// A session is a single entry, keyed by the quintuple of the packet that
+// created it, holding the translations of both directions: if the entry is
+// evicted both directions are lost together, no half-open translation is left.
+struct session {
+  struct st_k reverse_key;  // quintuple of the packets in the other direction
+  struct st_v forward;      // translation of the packets in the same direction
+  struct st_v reverse;      // translation of the packets in the other direction
+  uint8_t direction;        // direction of the packet that created the session
+} __attribute__((packed));
+BPF_TABLE("lru_hash", struct st_k, struct session, session_table,
           SESSION_MAP_DIM);
+// Index of the sessions by the quintuple of the packets in the other
+// direction. It only points to the session entry: an index entry is valid
+// only if the session it points to stores its key as reverse key. It is an LRU
+// map twice the size of the session table, so that the entries left behind by
+// the evicted sessions are evicted before the ones of the live sessions, and
+// never prevent new sessions from being indexed. Packets in the forward
+// direction restore the index entry of their session if it has been evicted.
+BPF_TABLE("lru_hash", struct st_k, struct st_k, session_index,
+          2 * SESSION_MAP_DIM);
+
+// Session counters, see SESSION_STATS_TYPE
+BPF_TABLE("percpu_array", uint32_t, uint64_t, session_stats, STATS_DIM);
+
+static inline void session_stats_inc(uint32_t index) {
+  uint64_t *value = session_stats.lookup(&index);
+  if (value) {
+    *value += 1;
+  }
+}
+
+static inline bool st_k_equal(struct st_k *a, struct st_k *b) {
+  return a->src_ip == b->src_ip && a->dst_ip == b->dst_ip &&
+         a->src_port == b->src_port && a->dst_port == b->dst_port &&
+         a->proto == b->proto;
+}
+
+// Returns the session that the index entry of key points to, NULL if the
+// session is gone (in that case the stale index entry is removed)
+static inline struct session *session_index_lookup(struct st_k *key) {
+  struct st_k *forward_key = session_index.lookup(key);
+  if (!forward_key) {
+    return NULL;
+  }
+  struct session *session = session_table.lookup(forward_key);
+  if (session && st_k_equal(&session->reverse_key, key)) {
+    return session;
+  }
+  session_index.delete(key);
+  return NULL;
+}
 
 // NodePort rules table
 struct nt_k {
@@ -115,29 +176,49 @@ struct nt_v {
 BPF_F_TABLE("hash", struct nt_k, struct nt_v, npr_table, 1024,
             BPF_F_NO_PREALLOC);
 
-// Port numbers
-struct free_port_entry {
-  uint16_t free_port;
-  struct bpf_spin_lock lock;
-};
+// Sessions created by each NodePort rule, entries are created by the control
+// plane together with the rule
+BPF_TABLE("percpu_hash", struct nt_k, uint64_t, npr_stats, 1024);
 
-BPF_TABLE("array", uint32_t, struct free_port_entry, free_port_map, 1);
+// Port numbers
+// The port space is split among the cpus by the control plane, so that each
+// cpu allocates ports from its own range without any locking
+struct port_allocator {
+  uint16_t first;
+  uint16_t last;
+  uint16_t next;
+} __attribute__((packed));
+BPF_TABLE("percpu_array", uint32_t, struct port_allocator, port_allocator, 1);
 
-static inline __be16 get_free_port() {
+// Returns a port for a new session, such that the quintuple of the packets
+// in the other direction (reverse_key, with the port still to be set) is not
+// used by another live session; 0 if no port is found
+static inline __be16 get_free_port(struct st_k *reverse_key, bool src_port,
+                                   bool dst_port) {
   uint32_t key = 0;
-  uint16_t free_port = 0;
-  struct free_port_entry *entry = free_port_map.lookup(&key);
-  if (!entry) {  // never happen for array
+  struct port_allocator *allocator = port_allocator.lookup(&key);
+  if (!allocator || allocator->first == 0) {
     return 0;
   }
-  bpf_spin_lock(&entry->lock);
-  if (entry->free_port < 1024 || entry->free_port == 65535) {
-    entry->free_port = 1024;
+
+#pragma unroll
+  for (int attempt = 0; attempt < PORT_MAX_ATTEMPTS; attempt++) {
+    if (allocator->next < allocator->first || allocator->next > allocator->last)
+      allocator->next = allocator->first;
+    __be16 candidate = bpf_htons(allocator->next);
+    allocator->next++;
+
+    if (src_port)
+      reverse_key->src_port = candidate;
+    if (dst_port)
+      reverse_key->dst_port = candidate;
+    if (!session_index_lookup(reverse_key)) {
+      return candidate;
+    }
   }
-  free_port = entry->free_port;
-  entry->free_port++;
-  bpf_spin_unlock(&entry->lock);
-  return bpf_htons(free_port);
+
+  session_stats_inc(STATS_PORT_ALLOC_FAILURES);
+  return 0;
 }
 
 static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
@@ -279,23 +360,36 @@ IP:;
   uint32_t new_ip = 0;
   uint16_t new_port = 0;
   uint8_t operation = 0;
+  uint8_t direction = (md->in_port == BACKEND_PORT) ? DIR_EGRESS : DIR_INGRESS;
   struct st_k session_key = {.src_ip = src_ip,
                              .dst_ip = dst_ip,
                              .src_port = src_port,
                              .dst_port = dst_port,
                              .proto = proto};
-  struct st_v *session_entry = (md->in_port == BACKEND_PORT)
-                                   ? egress_session_table.lookup(&session_key)
-                                   : ingress_session_table.lookup(&session_key);
-  if (session_entry) {
-    // Extract NAT data
-    new_ip = session_entry->new_ip;
-    new_port = session_entry->new_port;
-    operation = session_entry->operation;
+
+  // Packet in the same direction of the one that created the session
+  struct session *session = session_table.lookup(&session_key);
+  if (session && session->direction == direction) {
+    if (!session_index.lookup(&session->reverse_key)) {
+      session_index.insert(&session->reverse_key, &session_key);
+    }
+    new_ip = session->forward.new_ip;
+    new_port = session->forward.new_port;
+    operation = session->forward.operation;
+    goto APPLY_NAT;
+  }
+
+  // Packet in the other direction
+  session = session_index_lookup(&session_key);
+  if (session && session->direction != direction) {
+    new_ip = session->reverse.new_ip;
+    new_port = session->reverse.new_port;
+    operation = session->reverse.operation;
     goto APPLY_NAT;
   }
 
   uint8_t originating_rule = 0;
+  struct nt_k npr_key = {.port = dst_port, .proto = proto};
 
   // 3) Session table miss, start rule lookup
   if (md->in_port == BACKEND_PORT) {  // inside -> outside
@@ -314,7 +408,6 @@ IP:;
     // Rule: POD_TO_EXT
     // A Pod want to reach the external world => SNAT
     new_ip = NODE_IP;
-    new_port = get_free_port();
     operation = OP_XLATE_SRC;
     originating_rule = RULE_POD_TO_EXT;
     pcn_log(ctx, LOG_TRACE,
@@ -324,7 +417,6 @@ IP:;
   } else {  // outside -> inside
     // Check ingress rules
 
-    struct nt_k npr_key = {.port = dst_port, .proto = proto};
     struct nt_v *npr_value = npr_table.lookup(&npr_key);
 
     // Incoming packet doesn't match any NodePort rule => stack
@@ -348,7 +440,6 @@ IP:;
     // Rule: REQ_NP_CLUSTER
     // Request for a NodePort Svc with externalTrafficPolicy=CLUSTER => SNAT
     new_ip = INTERNAL_SRC_IP;
-    new_port = get_free_port();
     operation = OP_XLATE_SRC;
     originating_rule = RULE_NODEPORT_CLUSTER;
 
@@ -359,75 +450,95 @@ IP:;
         src_ip, src_port, dst_ip, dst_port);
   }
 
-  // No session table exist for the packet but a rule matched, so both sessions
-  // tables must be updated. In the following, the forward table is intended
-  // to be the table that handles the sessions in the same direction of the
-  // actual packet; similarly, the reverse table is intended to be
-  // the table that handles the sessions in the opposite direction of the
-  // actual packet. Example:
-  // packet coming from the BACKEND port
-  // - forward table = egress session table
-  // - reverse table = ingress session table
-
-  // Regardless the type of NAT, the forward table key always match the original
-  // packet quintuple data. Moreover, the forward table value always stores
+  // No session exists for the packet but a rule matched, so a new session is
+  // created. In the following, the forward translation is intended to be the
+  // one applied to the packets in the same direction of the actual packet;
+  // similarly, the reverse translation is intended to be the one applied to
+  // the packets in the opposite direction of the actual packet.
+
+  // Regardless the type of NAT, the session key always match the original
+  // packet quintuple data. Moreover, the forward translation always stores
   // the new ip, the new port and the same kind of operation that will be
   // applied on the actual packet. The originating rule is determined during
   // the rules scan
-  struct st_k forward_key = {.src_ip = src_ip,
-                             .dst_ip = dst_ip,
-                             .src_port = src_port,
-                             .dst_port = dst_port,
-                             .proto = proto};
-  struct st_v forward_value = {.new_ip = new_ip,
-                               .new_port = new_port,
-                               .operation = operation,
-                               .originating_rule = originating_rule};
+  struct session new_session = {};
+  new_session.direction = direction;
 
-  // The reverse table key and value depend on the kind of operation that will
+  // The reverse key and translation depend on the kind of operation that will
   // be applied on the actual packet
-  struct st_k reverse_key = {0, 0, 0, 0, 0};
-  struct st_v reverse_value = {0, 0};
+  struct st_k *reverse_key = &new_session.reverse_key;
+  struct st_v *reverse_value = &new_session.reverse;
+
+  // The protocol type in the reverse key and the originating rule type in the
+  // reverse translation do not depend on the operation applied on the actual
+  // packet
+  reverse_key->proto = proto;
+  reverse_value->originating_rule = originating_rule;
 
   if (operation == OP_XLATE_SRC) {
-    reverse_key.src_ip = dst_ip;
-    reverse_key.dst_ip = new_ip;
+    reverse_key->src_ip = dst_ip;
+    reverse_key->dst_ip = new_ip;
+    reverse_key->src_port = dst_port;
     // During the NAT operation, the ICMP ID will be replaced with the value
     // of "new port": this means that for the reverse traffic, the session will
     // be identified by a packet having both "source port" and "destination port"
     // equal to "new port"
-    reverse_key.src_port = (proto == IPPROTO_ICMP) ? new_port : dst_port;
-    reverse_key.dst_port = new_port;
+    new_port = get_free_port(reverse_key, proto == IPPROTO_ICMP, true);
+    if (new_port == 0) {
+      pcn_log(ctx, LOG_TRACE,
+              "Dropped pkt: no free port for the new session - (src: %I:%P, "
+              "dst: %I:%P)",
+              src_ip, src_port, dst_ip, dst_port);
+      return RX_DROP;
+    }
 
-    reverse_value.new_ip = src_ip;
-    reverse_value.new_port = src_port;
-    reverse_value.operation = OP_XLATE_DST;
+    reverse_value->new_ip = src_ip;
+    reverse_value->new_port = src_port;
+    reverse_value->operation = OP_XLATE_DST;
   } else {
-    reverse_key.src_ip = new_ip;
-    reverse_key.dst_ip = src_ip;
-    reverse_key.src_port = new_port;
+    reverse_key->src_ip = new_ip;
+    reverse_key->dst_ip = src_ip;
+    reverse_key->src_port = new_port;
     // During the NAT operation, the ICMP ID will be replaced with the value
     // of "new port": this means that for the reverse traffic, the session will
     // be identified by a packet having both "source port" and "destination port"
     // equal to "new port"
-    reverse_key.dst_port = (proto == IPPROTO_ICMP) ? new_port : src_port;
+    reverse_key->dst_port = (proto == IPPROTO_ICMP) ? new_port : src_port;
 
-    reverse_value.new_ip = dst_ip;
-    reverse_value.new_port = dst_port;
-    reverse_value.operation = OP_XLATE_SRC;
+    reverse_value->new_ip = dst_ip;
+    reverse_value->new_port = dst_port;
+    reverse_value->operation = OP_XLATE_SRC;
   }
-  // The protocol type in the reverse table key and the originating rule type
-  // in the reverse table value do not depend on the operation applied on the
-  // actual packet
-  reverse_key.proto = proto;
-  reverse_value.originating_rule = originating_rule;
-
-  if (md->in_port == BACKEND_PORT) {
-    egress_session_table.update(&forward_key, &forward_value);
-    ingress_session_table.update(&reverse_key, &reverse_value);
-  } else {
-    ingress_session_table.update(&forward_key, &forward_value);
-    egress_session_table.update(&reverse_key, &reverse_value);
+
+  new_session.forward.new_ip = new_ip;
+  new_session.forward.new_port = new_port;
+  new_session.forward.operation = operation;
+  new_session.forward.originating_rule = originating_rule;
+
+  // The quintuple of the packets in the other direction must not belong to
+  // another live session, whose index entry would be overwritten (another cpu
+  // may have created one in the meantime)
+  if (session_index_lookup(reverse_key)) {
+    pcn_log(ctx, LOG_TRACE,
+            "Dropped pkt: reverse quintuple in use - (src: %I:%P, dst: %I:%P)",
+            src_ip, src_port, dst_ip, dst_port);
+    return RX_DROP;
+  }
+  session_table.update(&session_key, &new_session);
+  if (session_index.insert(reverse_key, &session_key) != 0) {
+    session_table.delete(&session_key);
+    pcn_log(ctx, LOG_TRACE,
+            "Dropped pkt: reverse quintuple in use - (src: %I:%P, dst: %I:%P)",
+            src_ip, src_port, dst_ip, dst_port);
+    return RX_DROP;
+  }
+  session_stats_inc(STATS_SESSIONS_CREATED);
+
+  if (originating_rule == RULE_NODEPORT_CLUSTER) {
+    uint64_t *npr_sessions = npr_stats.lookup(&npr_key);
+    if (npr_sessions) {
+      *npr_sessions += 1;
+    }
   }
 
   pcn_log(ctx, LOG_TRACE, "Created new session - (src: %I:%P, dst: %I:%P)",
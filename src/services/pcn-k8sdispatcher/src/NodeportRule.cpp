@@ -96,4 +96,14 @@ void NodeportRule::setExternalTrafficPolicy(
 
 std::string NodeportRule::getRuleName() {
   return this->ruleName_;
-}
\ No newline at end of file
+}
+
+uint64_t NodeportRule::getSessionsCreated() {
+  return this->parent_.getNodeportSessionsCreated(this->nodeportPort_,
+                                                  this->proto_);
+}
+
+uint32_t NodeportRule::getActiveSessions() {
+  return this->parent_.getNodeportActiveSessions(this->nodeportPort_,
+                                                 this->proto_);
+}
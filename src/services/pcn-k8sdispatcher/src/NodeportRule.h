@@ -48,6 +48,16 @@ class NodeportRule : public NodeportRuleBase {
   /// </summary>
   std::string getRuleName() override;
 
+  /// <summary>
+  /// Number of sessions created by the NodePort rule
+  /// </summary>
+  uint64_t getSessionsCreated() override;
+
+  /// <summary>
+  /// Number of sessions of the NodePort rule currently in the session table
+  /// </summary>
+  uint32_t getActiveSessions() override;
+
  private:
   K8sdispatcher& parent_;
 
@@ -31,6 +31,20 @@ struct st_v {
   uint8_t operation;
   uint8_t originating_rule;
 } __attribute__((packed));
+struct session {
+  st_k reverse_key;
+  st_v forward;
+  st_v reverse;
+  uint8_t direction;
+} __attribute__((packed));
+struct port_allocator {
+  uint16_t first;
+  uint16_t last;
+  uint16_t next;
+} __attribute__((packed));
+
+enum class SessionDirection { EGRESS = 0, INGRESS = 1 };
+enum class SessionStats { SESSIONS_CREATED = 0, PORT_ALLOC_FAILURES = 1 };
 
 class K8sdispatcher;
 
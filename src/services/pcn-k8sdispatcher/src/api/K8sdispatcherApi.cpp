@@ -317,6 +317,40 @@ Response read_k8sdispatcher_nodeport_range_by_id_handler(
   }
 }
 
+Response read_k8sdispatcher_nodeport_rule_active_sessions_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_nodeportPort;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "nodeport-port")) {
+      unique_nodeportPort = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = NodeportRuleJsonObject::string_to_L4ProtoEnum(unique_proto);
+
+
+  try {
+
+    auto x = read_k8sdispatcher_nodeport_rule_active_sessions_by_id(unique_name, unique_nodeportPort, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8sdispatcher_nodeport_rule_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -438,6 +472,57 @@ Response read_k8sdispatcher_nodeport_rule_rule_name_by_id_handler(
   }
 }
 
+Response read_k8sdispatcher_nodeport_rule_sessions_created_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_nodeportPort;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "nodeport-port")) {
+      unique_nodeportPort = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = NodeportRuleJsonObject::string_to_L4ProtoEnum(unique_proto);
+
+
+  try {
+
+    auto x = read_k8sdispatcher_nodeport_rule_sessions_created_by_id(unique_name, unique_nodeportPort, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8sdispatcher_port_allocation_failures_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8sdispatcher_port_allocation_failures_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8sdispatcher_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -886,6 +971,23 @@ Response read_k8sdispatcher_session_rule_originating_rule_by_id_handler(
   }
 }
 
+Response read_k8sdispatcher_session_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8sdispatcher_session_table_size_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response replace_k8sdispatcher_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
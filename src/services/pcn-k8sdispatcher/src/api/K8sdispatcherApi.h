@@ -46,10 +46,13 @@ Response read_k8sdispatcher_by_id_handler(const char *name, const Key *keys, siz
 Response read_k8sdispatcher_internal_src_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_nodeport_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sdispatcher_nodeport_rule_active_sessions_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_nodeport_rule_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_nodeport_rule_external_traffic_policy_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_nodeport_rule_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_nodeport_rule_rule_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sdispatcher_nodeport_rule_sessions_created_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sdispatcher_port_allocation_failures_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_ports_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -60,6 +63,7 @@ Response read_k8sdispatcher_session_rule_new_ip_by_id_handler(const char *name,
 Response read_k8sdispatcher_session_rule_new_port_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_session_rule_operation_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sdispatcher_session_rule_originating_rule_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sdispatcher_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_k8sdispatcher_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8sdispatcher_nodeport_rule_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8sdispatcher_nodeport_rule_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
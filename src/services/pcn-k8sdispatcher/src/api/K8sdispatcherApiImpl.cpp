@@ -277,6 +277,26 @@ read_k8sdispatcher_nodeport_range_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read active-sessions by ID
+*
+* Read operation of resource: active-sessions*
+*
+* @param[in] name ID of name
+* @param[in] nodeportPort ID of nodeport-port
+* @param[in] proto ID of proto
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8sdispatcher_nodeport_rule_active_sessions_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto) {
+  auto k8sdispatcher = get_cube(name);
+  auto nodeportRule = k8sdispatcher->getNodeportRule(nodeportPort, proto);
+  return nodeportRule->getActiveSessions();
+
+}
+
 /**
 * @brief   Read nodeport-rule by ID
 *
@@ -356,6 +376,43 @@ read_k8sdispatcher_nodeport_rule_rule_name_by_id(const std::string &name, const
 
 }
 
+/**
+* @brief   Read sessions-created by ID
+*
+* Read operation of resource: sessions-created*
+*
+* @param[in] name ID of name
+* @param[in] nodeportPort ID of nodeport-port
+* @param[in] proto ID of proto
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8sdispatcher_nodeport_rule_sessions_created_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto) {
+  auto k8sdispatcher = get_cube(name);
+  auto nodeportRule = k8sdispatcher->getNodeportRule(nodeportPort, proto);
+  return nodeportRule->getSessionsCreated();
+
+}
+
+/**
+* @brief   Read port-allocation-failures by ID
+*
+* Read operation of resource: port-allocation-failures*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8sdispatcher_port_allocation_failures_by_id(const std::string &name) {
+  auto k8sdispatcher = get_cube(name);
+  return k8sdispatcher->getPortAllocationFailures();
+
+}
+
 /**
 * @brief   Read ports by ID
 *
@@ -571,6 +628,23 @@ read_k8sdispatcher_session_rule_originating_rule_by_id(const std::string &name,
 
 }
 
+/**
+* @brief   Read session-table-size by ID
+*
+* Read operation of resource: session-table-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8sdispatcher_session_table_size_by_id(const std::string &name) {
+  auto k8sdispatcher = get_cube(name);
+  return k8sdispatcher->getSessionTableSize();
+
+}
+
 /**
 * @brief   Replace nodeport-rule by ID
 *
@@ -49,10 +49,13 @@ namespace K8sdispatcherApiImpl {
   std::string read_k8sdispatcher_internal_src_ip_by_id(const std::string &name);
   std::vector<K8sdispatcherJsonObject> read_k8sdispatcher_list_by_id();
   std::string read_k8sdispatcher_nodeport_range_by_id(const std::string &name);
+  uint32_t read_k8sdispatcher_nodeport_rule_active_sessions_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto);
   NodeportRuleJsonObject read_k8sdispatcher_nodeport_rule_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto);
   NodeportRuleExternalTrafficPolicyEnum read_k8sdispatcher_nodeport_rule_external_traffic_policy_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto);
   std::vector<NodeportRuleJsonObject> read_k8sdispatcher_nodeport_rule_list_by_id(const std::string &name);
   std::string read_k8sdispatcher_nodeport_rule_rule_name_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto);
+  uint64_t read_k8sdispatcher_nodeport_rule_sessions_created_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto);
+  uint64_t read_k8sdispatcher_port_allocation_failures_by_id(const std::string &name);
   PortsJsonObject read_k8sdispatcher_ports_by_id(const std::string &name, const std::string &portsName);
   std::string read_k8sdispatcher_ports_ip_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_k8sdispatcher_ports_list_by_id(const std::string &name);
@@ -63,6 +66,7 @@ namespace K8sdispatcherApiImpl {
   uint16_t read_k8sdispatcher_session_rule_new_port_by_id(const std::string &name, const SessionRuleDirectionEnum &direction, const std::string &srcIp, const std::string &dstIp, const uint16_t &srcPort, const uint16_t &dstPort, const L4ProtoEnum &proto);
   SessionRuleOperationEnum read_k8sdispatcher_session_rule_operation_by_id(const std::string &name, const SessionRuleDirectionEnum &direction, const std::string &srcIp, const std::string &dstIp, const uint16_t &srcPort, const uint16_t &dstPort, const L4ProtoEnum &proto);
   SessionRuleOriginatingRuleEnum read_k8sdispatcher_session_rule_originating_rule_by_id(const std::string &name, const SessionRuleDirectionEnum &direction, const std::string &srcIp, const std::string &dstIp, const uint16_t &srcPort, const uint16_t &dstPort, const L4ProtoEnum &proto);
+  uint32_t read_k8sdispatcher_session_table_size_by_id(const std::string &name);
   void replace_k8sdispatcher_by_id(const std::string &name, const K8sdispatcherJsonObject &value);
   void replace_k8sdispatcher_nodeport_rule_by_id(const std::string &name, const uint16_t &nodeportPort, const L4ProtoEnum &proto, const NodeportRuleJsonObject &value);
   void replace_k8sdispatcher_nodeport_rule_list_by_id(const std::string &name, const std::vector<NodeportRuleJsonObject> &value);
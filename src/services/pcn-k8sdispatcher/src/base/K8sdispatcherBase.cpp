@@ -64,6 +64,8 @@ K8sdispatcherJsonObject K8sdispatcherBase::toJsonObject() {
   }
   conf.setInternalSrcIp(getInternalSrcIp());
   conf.setNodeportRange(getNodeportRange());
+  conf.setSessionTableSize(getSessionTableSize());
+  conf.setPortAllocationFailures(getPortAllocationFailures());
   for(auto &i : getSessionRuleList()) {
     conf.addSessionRule(i->toJsonObject());
   }
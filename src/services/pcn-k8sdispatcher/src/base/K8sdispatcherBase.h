@@ -65,6 +65,16 @@ class K8sdispatcherBase: public virtual polycube::service::Cube<Ports> {
   virtual std::string getNodeportRange() = 0;
   virtual void setNodeportRange(const std::string &value) = 0;
 
+  /// <summary>
+  /// Maximum number of sessions (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getSessionTableSize() = 0;
+
+  /// <summary>
+  /// New sessions dropped because no free port was available
+  /// </summary>
+  virtual uint64_t getPortAllocationFailures() = 0;
+
   /// <summary>
   /// Session entry related to a specific traffic direction
   /// </summary>
@@ -32,6 +32,8 @@ NodeportRuleJsonObject NodeportRuleBase::toJsonObject() {
   conf.setProto(getProto());
   conf.setExternalTrafficPolicy(getExternalTrafficPolicy());
   conf.setRuleName(getRuleName());
+  conf.setSessionsCreated(getSessionsCreated());
+  conf.setActiveSessions(getActiveSessions());
 
   return conf;
 }
@@ -59,6 +59,16 @@ class NodeportRuleBase {
   /// </summary>
   virtual std::string getRuleName() = 0;
 
+  /// <summary>
+  /// Sessions created by the NodePort rule
+  /// </summary>
+  virtual uint64_t getSessionsCreated() = 0;
+
+  /// <summary>
+  /// Sessions of the NodePort rule currently in the session table
+  /// </summary>
+  virtual uint32_t getActiveSessions() = 0;
+
   std::shared_ptr<spdlog::logger> logger();
  protected:
   K8sdispatcher &parent_;
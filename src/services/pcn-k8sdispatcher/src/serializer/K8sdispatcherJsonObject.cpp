@@ -25,6 +25,9 @@ K8sdispatcherJsonObject::K8sdispatcherJsonObject() {
   m_nodeportRangeIsSet = true;
   m_sessionRuleIsSet = false;
   m_nodeportRuleIsSet = false;
+  m_sessionTableSize = 32768;
+  m_sessionTableSizeIsSet = true;
+  m_portAllocationFailuresIsSet = false;
 }
 
 K8sdispatcherJsonObject::K8sdispatcherJsonObject(const nlohmann::json &val) :
@@ -35,6 +38,8 @@ K8sdispatcherJsonObject::K8sdispatcherJsonObject(const nlohmann::json &val) :
   m_nodeportRangeIsSet = false;
   m_sessionRuleIsSet = false;
   m_nodeportRuleIsSet = false;
+  m_sessionTableSizeIsSet = false;
+  m_portAllocationFailuresIsSet = false;
 
 
   if (val.count("name")) {
@@ -75,6 +80,14 @@ K8sdispatcherJsonObject::K8sdispatcherJsonObject(const nlohmann::json &val) :
 
     m_nodeportRuleIsSet = true;
   }
+
+  if (val.count("session-table-size")) {
+    setSessionTableSize(val.at("session-table-size").get<uint32_t>());
+  }
+
+  if (val.count("port-allocation-failures")) {
+    setPortAllocationFailures(val.at("port-allocation-failures").get<uint64_t>());
+  }
 }
 
 nlohmann::json K8sdispatcherJsonObject::toJson() const {
@@ -128,6 +141,14 @@ nlohmann::json K8sdispatcherJsonObject::toJson() const {
     }
   }
 
+  if (m_sessionTableSizeIsSet) {
+    val["session-table-size"] = m_sessionTableSize;
+  }
+
+  if (m_portAllocationFailuresIsSet) {
+    val["port-allocation-failures"] = m_portAllocationFailures;
+  }
+
   return val;
 }
 
@@ -232,6 +253,36 @@ void K8sdispatcherJsonObject::unsetNodeportRule() {
   m_nodeportRuleIsSet = false;
 }
 
+uint32_t K8sdispatcherJsonObject::getSessionTableSize() const {
+  return m_sessionTableSize;
+}
+
+void K8sdispatcherJsonObject::setSessionTableSize(uint32_t value) {
+  m_sessionTableSize = value;
+  m_sessionTableSizeIsSet = true;
+}
+
+bool K8sdispatcherJsonObject::sessionTableSizeIsSet() const {
+  return m_sessionTableSizeIsSet;
+}
+
+uint64_t K8sdispatcherJsonObject::getPortAllocationFailures() const {
+  return m_portAllocationFailures;
+}
+
+void K8sdispatcherJsonObject::setPortAllocationFailures(uint64_t value) {
+  m_portAllocationFailures = value;
+  m_portAllocationFailuresIsSet = true;
+}
+
+bool K8sdispatcherJsonObject::portAllocationFailuresIsSet() const {
+  return m_portAllocationFailuresIsSet;
+}
+
+void K8sdispatcherJsonObject::unsetPortAllocationFailures() {
+  m_portAllocationFailuresIsSet = false;
+}
+
 
 }
 }
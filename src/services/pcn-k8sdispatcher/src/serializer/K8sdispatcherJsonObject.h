@@ -87,6 +87,21 @@ public:
   bool nodeportRuleIsSet() const;
   void unsetNodeportRule();
 
+  /// <summary>
+  /// Maximum number of sessions (can be set only at creation)
+  /// </summary>
+  uint32_t getSessionTableSize() const;
+  void setSessionTableSize(uint32_t value);
+  bool sessionTableSizeIsSet() const;
+
+  /// <summary>
+  /// New sessions dropped because no free port was available
+  /// </summary>
+  uint64_t getPortAllocationFailures() const;
+  void setPortAllocationFailures(uint64_t value);
+  bool portAllocationFailuresIsSet() const;
+  void unsetPortAllocationFailures();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -100,6 +115,10 @@ private:
   bool m_sessionRuleIsSet;
   std::vector<NodeportRuleJsonObject> m_nodeportRule;
   bool m_nodeportRuleIsSet;
+  uint32_t m_sessionTableSize;
+  bool m_sessionTableSizeIsSet;
+  uint64_t m_portAllocationFailures;
+  bool m_portAllocationFailuresIsSet;
 };
 
 }
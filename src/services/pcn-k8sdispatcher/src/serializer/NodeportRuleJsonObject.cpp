@@ -23,6 +23,8 @@ NodeportRuleJsonObject::NodeportRuleJsonObject() {
   m_externalTrafficPolicy = NodeportRuleExternalTrafficPolicyEnum::CLUSTER;
   m_externalTrafficPolicyIsSet = true;
   m_ruleNameIsSet = false;
+  m_sessionsCreatedIsSet = false;
+  m_activeSessionsIsSet = false;
 }
 
 NodeportRuleJsonObject::NodeportRuleJsonObject(const nlohmann::json &val) :
@@ -31,6 +33,8 @@ NodeportRuleJsonObject::NodeportRuleJsonObject(const nlohmann::json &val) :
   m_protoIsSet = false;
   m_externalTrafficPolicyIsSet = false;
   m_ruleNameIsSet = false;
+  m_sessionsCreatedIsSet = false;
+  m_activeSessionsIsSet = false;
 
 
   if (val.count("nodeport-port")) {
@@ -48,6 +52,14 @@ NodeportRuleJsonObject::NodeportRuleJsonObject(const nlohmann::json &val) :
   if (val.count("rule-name")) {
     setRuleName(val.at("rule-name").get<std::string>());
   }
+
+  if (val.count("sessions-created")) {
+    setSessionsCreated(val.at("sessions-created").get<uint64_t>());
+  }
+
+  if (val.count("active-sessions")) {
+    setActiveSessions(val.at("active-sessions").get<uint32_t>());
+  }
 }
 
 nlohmann::json NodeportRuleJsonObject::toJson() const {
@@ -72,6 +84,14 @@ nlohmann::json NodeportRuleJsonObject::toJson() const {
     val["rule-name"] = m_ruleName;
   }
 
+  if (m_sessionsCreatedIsSet) {
+    val["sessions-created"] = m_sessionsCreated;
+  }
+
+  if (m_activeSessionsIsSet) {
+    val["active-sessions"] = m_activeSessions;
+  }
+
   return val;
 }
 
@@ -179,6 +199,40 @@ void NodeportRuleJsonObject::unsetRuleName() {
   m_ruleNameIsSet = false;
 }
 
+uint64_t NodeportRuleJsonObject::getSessionsCreated() const {
+  return m_sessionsCreated;
+}
+
+void NodeportRuleJsonObject::setSessionsCreated(uint64_t value) {
+  m_sessionsCreated = value;
+  m_sessionsCreatedIsSet = true;
+}
+
+bool NodeportRuleJsonObject::sessionsCreatedIsSet() const {
+  return m_sessionsCreatedIsSet;
+}
+
+void NodeportRuleJsonObject::unsetSessionsCreated() {
+  m_sessionsCreatedIsSet = false;
+}
+
+uint32_t NodeportRuleJsonObject::getActiveSessions() const {
+  return m_activeSessions;
+}
+
+void NodeportRuleJsonObject::setActiveSessions(uint32_t value) {
+  m_activeSessions = value;
+  m_activeSessionsIsSet = true;
+}
+
+bool NodeportRuleJsonObject::activeSessionsIsSet() const {
+  return m_activeSessionsIsSet;
+}
+
+void NodeportRuleJsonObject::unsetActiveSessions() {
+  m_activeSessionsIsSet = false;
+}
+
 
 }
 }
@@ -79,6 +79,22 @@ public:
   bool ruleNameIsSet() const;
   void unsetRuleName();
 
+  /// <summary>
+  /// Sessions created by the NodePort rule
+  /// </summary>
+  uint64_t getSessionsCreated() const;
+  void setSessionsCreated(uint64_t value);
+  bool sessionsCreatedIsSet() const;
+  void unsetSessionsCreated();
+
+  /// <summary>
+  /// Sessions of the NodePort rule currently in the session table
+  /// </summary>
+  uint32_t getActiveSessions() const;
+  void setActiveSessions(uint32_t value);
+  bool activeSessionsIsSet() const;
+  void unsetActiveSessions();
+
 private:
   uint16_t m_nodeportPort;
   bool m_nodeportPortIsSet;
@@ -88,6 +104,10 @@ private:
   bool m_externalTrafficPolicyIsSet;
   std::string m_ruleName;
   bool m_ruleNameIsSet;
+  uint64_t m_sessionsCreated;
+  bool m_sessionsCreatedIsSet;
+  uint32_t m_activeSessions;
+  bool m_activeSessionsIsSet;
 };
 
 }
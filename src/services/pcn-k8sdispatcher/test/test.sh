@@ -20,5 +20,9 @@ polycubectl k0 ports add to_backend type=BACKEND
 polycubectl k0 show ports to_backend
 polycubectl k0 nodeport-rule add 32000 TCP external-traffic-policy=LOCAL rule-name=my-rule
 polycubectl k0 show nodeport-rule 32000 TCP
+polycubectl k0 nodeport-rule 32000 TCP show sessions-created
+polycubectl k0 nodeport-rule 32000 TCP show active-sessions
+polycubectl k0 show session-table-size
+polycubectl k0 show port-allocation-failures
 polycubectl k0 set nodeport-range=32000-32500
 polycubectl k0 show nodeport-range
@@ -0,0 +1,71 @@
+#!/bin/bash
+
+# Creates many more sessions than the session table can hold and checks that
+# new sessions are still created and translated in both directions, and that
+# a session in use survives the churn.
+# It needs hping3.
+
+function cleanup {
+  set +e
+  sudo pkill -SIGTERM hping3
+  polycubectl k8sdispatcher del k0
+  sudo ip link del veth1
+  sudo ip link del veth2
+  sudo ip netns del ns1
+  sudo ip netns del ns2
+}
+trap cleanup EXIT
+
+set -x
+set -e
+
+#        ns1 (external host)                          ns2 (pod)
+#  +-------------------+                       +-------------------+
+#  | veth1_ 10.10.10.1 |--veth1--k0--veth2-----| veth2_ 10.20.0.2  |
+#  +-------------------+  FRONTEND  BACKEND    +-------------------+
+#
+# k0 translates the pod address to the node address 10.10.10.10, the packets
+# are not modified at L2: static neighbours are used on both sides
+
+NODE_IP=10.10.10.10
+EXT_IP=10.10.10.1
+POD_IP=10.20.0.2
+
+for i in 1 2; do
+  sudo ip netns add ns${i}
+  sudo ip link add veth${i}_ type veth peer name veth${i}
+  sudo ip link set veth${i}_ netns ns${i}
+  sudo ip netns exec ns${i} ip link set dev veth${i}_ up
+  sudo ip link set dev veth${i} up
+done
+sudo ip netns exec ns1 ip addr add $EXT_IP/24 dev veth1_
+sudo ip netns exec ns2 ip addr add $POD_IP/24 dev veth2_
+
+mac1=$(sudo ip netns exec ns1 cat /sys/class/net/veth1_/address)
+mac2=$(sudo ip netns exec ns2 cat /sys/class/net/veth2_/address)
+sudo ip netns exec ns1 ip neigh add $NODE_IP lladdr $mac2 dev veth1_
+sudo ip netns exec ns2 ip route add $EXT_IP dev veth2_
+sudo ip netns exec ns2 ip neigh add $EXT_IP lladdr $mac1 dev veth2_
+
+# smallest session table allowed
+polycubectl k8sdispatcher add k0 internal-src-ip=3.3.1.1 session-table-size=1024
+polycubectl k0 ports add to_frontend type=FRONTEND ip=$NODE_IP peer=veth1
+polycubectl k0 ports add to_backend type=BACKEND peer=veth2
+
+sudo ip netns exec ns2 ping -c 2 -W 2 $EXT_IP
+
+# a session kept in use while the table is churned
+sudo ip netns exec ns2 ping -c 100 -i 0.1 -W 2 $EXT_IP > /tmp/k0_ping.log &
+ping_pid=$!
+
+# 8 times the size of the table, one session per source port
+sudo ip netns exec ns2 hping3 --udp -p 9000 -s 10000 -c 8192 -i u200 \
+  $EXT_IP > /dev/null 2>&1 || true
+
+wait $ping_pid
+cat /tmp/k0_ping.log
+grep -q " 0% packet loss" /tmp/k0_ping.log
+
+# the evicted sessions do not prevent new ones from being created
+test $(polycubectl k0 show port-allocation-failures) -eq 0
+sudo ip netns exec ns2 ping -c 2 -W 2 $EXT_IP
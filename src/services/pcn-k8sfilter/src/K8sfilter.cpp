@@ -21,6 +21,17 @@
 
 #include <cinttypes>
 
+/* definitions copied from datapath */
+struct nodeport_range {
+  uint16_t low;
+  uint16_t high;
+};
+
+struct port_bitmap_word {
+  uint64_t allow;
+  uint64_t deny;
+};
+
 K8sfilter::K8sfilter(const std::string name, const K8sfilterJsonObject &conf)
     : Cube(conf.getBase(), {k8sfilter_code}, {}) {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [K8sfilter] [%n] [%l] %v");
@@ -28,6 +39,7 @@ K8sfilter::K8sfilter(const std::string name, const K8sfilterJsonObject &conf)
 
   addPortsList(conf.getPorts());
   setNodeportRange(conf.getNodeportRange());
+  addPortExceptionList(conf.getPortException());
 }
 
 K8sfilter::~K8sfilter() {}
@@ -48,6 +60,13 @@ void K8sfilter::update(const K8sfilterJsonObject &conf) {
   if (conf.nodeportRangeIsSet()) {
     setNodeportRange(conf.getNodeportRange());
   }
+  if (conf.portExceptionIsSet()) {
+    for (auto &i : conf.getPortException()) {
+      auto port = i.getPort();
+      auto m = getPortException(port);
+      m->update(i);
+    }
+  }
 }
 
 K8sfilterJsonObject K8sfilter::toJsonObject() {
@@ -60,6 +79,14 @@ K8sfilterJsonObject K8sfilter::toJsonObject() {
 
   conf.setNodeportRange(getNodeportRange());
 
+  for (auto &i : getPortExceptionList()) {
+    conf.addPortException(i->toJsonObject());
+  }
+
+  for (auto &i : getNodeportHitsList()) {
+    conf.addNodeportHits(i->toJsonObject());
+  }
+
   return conf;
 }
 
@@ -85,11 +112,146 @@ void K8sfilter::setNodeportRange(const std::string &value) {
     throw std::runtime_error("Invalid node port range");
   }
 
+  // a single map write, the datapath does not need to be reloaded
+  auto range_table = get_array_table<nodeport_range>("nodeport_range");
+  range_table.set(0, nodeport_range{.low = low, .high = high});
+
   nodeport_range_low_ = low;
   nodeport_range_high_ = high;
 
   nodeport_range_ = value;
-  reloadConfig();
+}
+
+std::shared_ptr<PortException> K8sfilter::getPortException(
+    const uint16_t &port) {
+  auto it = port_exceptions_.find(port);
+  if (it == port_exceptions_.end()) {
+    throw std::runtime_error("Port exception not found");
+  }
+  return it->second;
+}
+
+std::vector<std::shared_ptr<PortException>>
+K8sfilter::getPortExceptionList() {
+  std::vector<std::shared_ptr<PortException>> exceptions;
+  for (auto &it : port_exceptions_) {
+    exceptions.push_back(it.second);
+  }
+  return exceptions;
+}
+
+void K8sfilter::addPortException(const uint16_t &port,
+                                 const PortExceptionJsonObject &conf) {
+  if (port_exceptions_.count(port)) {
+    throw std::runtime_error("Port exception already exists");
+  }
+
+  PortExceptionJsonObject conf_(conf);
+  conf_.setPort(port);
+  port_exceptions_[port] = std::make_shared<PortException>(*this, conf_);
+  writePortBitmap(port);
+}
+
+void K8sfilter::addPortExceptionList(
+    const std::vector<PortExceptionJsonObject> &conf) {
+  for (auto &i : conf) {
+    addPortException(i.getPort(), i);
+  }
+}
+
+void K8sfilter::replacePortException(const uint16_t &port,
+                                     const PortExceptionJsonObject &conf) {
+  delPortException(port);
+  addPortException(port, conf);
+}
+
+void K8sfilter::delPortException(const uint16_t &port) {
+  if (port_exceptions_.erase(port) == 0) {
+    throw std::runtime_error("Port exception not found");
+  }
+  writePortBitmap(port);
+}
+
+void K8sfilter::delPortExceptionList() {
+  std::vector<uint16_t> ports;
+  for (auto &it : port_exceptions_) {
+    ports.push_back(it.first);
+  }
+  port_exceptions_.clear();
+  for (auto port : ports) {
+    writePortBitmap(port);
+  }
+}
+
+void K8sfilter::writePortBitmap(uint16_t port) {
+  // The whole word is rebuilt from the exceptions, so that it is always
+  // consistent with them
+  uint16_t first = port - port % 64;
+  port_bitmap_word word = {0, 0};
+  for (auto it = port_exceptions_.lower_bound(first);
+       it != port_exceptions_.end() && it->first < first + 64; ++it) {
+    uint64_t bit = 1ULL << (it->first % 64);
+    if (it->second->getAction() == PortExceptionActionEnum::ALLOW) {
+      word.allow |= bit;
+    } else {
+      word.deny |= bit;
+    }
+  }
+
+  auto bitmap = get_array_table<port_bitmap_word>("port_bitmap");
+  bitmap.set(port / 64, word);
+}
+
+std::shared_ptr<NodeportHits> K8sfilter::getNodeportHits(
+    const uint16_t &port) {
+  auto hits_table = get_percpuhash_table<uint16_t, uint64_t>("nodeport_hits");
+  NodeportHitsJsonObject conf;
+  conf.setPort(port);
+  uint64_t packets = 0;
+  for (auto value : hits_table.get(port)) {
+    packets += value;
+  }
+  conf.setPackets(packets);
+  return std::make_shared<NodeportHits>(*this, conf);
+}
+
+std::vector<std::shared_ptr<NodeportHits>> K8sfilter::getNodeportHitsList() {
+  std::vector<std::shared_ptr<NodeportHits>> hits;
+  auto hits_table = get_percpuhash_table<uint16_t, uint64_t>("nodeport_hits");
+  for (auto &entry : hits_table.get_all()) {
+    NodeportHitsJsonObject conf;
+    conf.setPort(entry.first);
+    uint64_t packets = 0;
+    for (auto value : entry.second) {
+      packets += value;
+    }
+    conf.setPackets(packets);
+    hits.push_back(std::make_shared<NodeportHits>(*this, conf));
+  }
+  return hits;
+}
+
+void K8sfilter::addNodeportHits(const uint16_t &port,
+                                const NodeportHitsJsonObject &conf) {
+  throw std::runtime_error("[NodeportHits]: Method create not allowed");
+}
+
+void K8sfilter::addNodeportHitsList(
+    const std::vector<NodeportHitsJsonObject> &conf) {
+  throw std::runtime_error("[NodeportHits]: Method create not allowed");
+}
+
+void K8sfilter::replaceNodeportHits(const uint16_t &port,
+                                    const NodeportHitsJsonObject &conf) {
+  throw std::runtime_error("[NodeportHits]: Method replace not allowed");
+}
+
+void K8sfilter::delNodeportHits(const uint16_t &port) {
+  throw std::runtime_error("[NodeportHits]: Method delete not allowed");
+}
+
+void K8sfilter::delNodeportHitsList() {
+  throw std::runtime_error("[NodeportHits]: Method delete not allowed");
 }
 
 void K8sfilter::reloadConfig() {
@@ -112,10 +274,6 @@ void K8sfilter::reloadConfig() {
 
   flags += "#define EXTERNAL_PORT " + std::to_string(external_port) + "\n";
   flags += "#define INTERNAL_PORT " + std::to_string(internal_port) + "\n";
-  flags += "#define NODEPORT_RANGE_LOW " + std::to_string(nodeport_range_low_) +
-           "\n";
-  flags += "#define NODEPORT_RANGE_HIGH " +
-           std::to_string(nodeport_range_high_) + "\n";
 
   logger()->debug("Reloading code with flags port: {}", flags);
 
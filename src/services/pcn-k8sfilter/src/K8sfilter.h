@@ -25,6 +25,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "NodeportHits.h"
+#include "PortException.h"
 #include "Ports.h"
 
 using namespace io::swagger::server::model;
@@ -60,9 +62,42 @@ class K8sfilter : public polycube::service::Cube<Ports>,
   std::string getNodeportRange() override;
   void setNodeportRange(const std::string &value) override;
 
+  /// <summary>
+  /// Exception to the NodePort range for a single port
+  /// </summary>
+  std::shared_ptr<PortException> getPortException(
+      const uint16_t &port) override;
+  std::vector<std::shared_ptr<PortException>> getPortExceptionList() override;
+  void addPortException(const uint16_t &port,
+                        const PortExceptionJsonObject &conf) override;
+  void addPortExceptionList(
+      const std::vector<PortExceptionJsonObject> &conf) override;
+  void replacePortException(const uint16_t &port,
+                            const PortExceptionJsonObject &conf) override;
+  void delPortException(const uint16_t &port) override;
+  void delPortExceptionList() override;
+
+  /// <summary>
+  /// Packets sent to the internal port, by destination port
+  /// </summary>
+  std::shared_ptr<NodeportHits> getNodeportHits(const uint16_t &port) override;
+  std::vector<std::shared_ptr<NodeportHits>> getNodeportHitsList() override;
+  void addNodeportHits(const uint16_t &port,
+                       const NodeportHitsJsonObject &conf) override;
+  void addNodeportHitsList(
+      const std::vector<NodeportHitsJsonObject> &conf) override;
+  void replaceNodeportHits(const uint16_t &port,
+                           const NodeportHitsJsonObject &conf) override;
+  void delNodeportHits(const uint16_t &port) override;
+  void delNodeportHitsList() override;
+
+  // writes the bitmap word holding the given port according to the exceptions
+  void writePortBitmap(uint16_t port);
+
  private:
   std::string nodeport_range_;
   uint16_t nodeport_range_low_;
   uint16_t nodeport_range_high_;
+  std::map<uint16_t, std::shared_ptr<PortException>> port_exceptions_;
   void reloadConfig();
 };
@@ -28,13 +28,11 @@
 #define INTERNAL_PORT 0
 #endif
 
-#ifndef NODEPORT_RANGE_LOW
-#define NODEPORT_RANGE_LOW (30000)
+#ifndef NODEPORT_HITS_DIM
+#define NODEPORT_HITS_DIM 65536
 #endif
 
-#ifndef NODEPORT_RANGE_HIGH
-#define NODEPORT_RANGE_HIGH (32767)
-#endif
+#define PORT_BITMAP_WORDS 1024  // 65536 ports, 64 per word
 
 struct eth_hdr {
   __be64 dst : 48;
@@ -42,6 +40,56 @@ struct eth_hdr {
   __be16 proto;
 } __attribute__((packed));
 
+// NodePort range, written by the control plane
+struct nodeport_range {
+  uint16_t low;
+  uint16_t high;
+};
+BPF_TABLE("array", uint32_t, struct nodeport_range, nodeport_range, 1);
+
+// Exceptions to the NodePort range, one bit per port: the traffic to an
+// allowed port is sent to the internal port even if the port is out of the
+// range, the traffic to a denied port is sent to the stack even if the port
+// is in the range
+struct port_bitmap_word {
+  uint64_t allow;
+  uint64_t deny;
+};
+BPF_TABLE("array", uint32_t, struct port_bitmap_word, port_bitmap,
+          PORT_BITMAP_WORDS);
+
+// Packets sent to the internal port, by destination port (host byte order)
+BPF_F_TABLE("percpu_hash", uint16_t, uint64_t, nodeport_hits,
+            NODEPORT_HITS_DIM, BPF_F_NO_PREALLOC);
+
+static __always_inline bool is_nodeport(uint16_t port) {
+  uint32_t key = port / 64;
+  uint64_t bit = 1ULL << (port % 64);
+  struct port_bitmap_word *word = port_bitmap.lookup(&key);
+  if (word) {
+    if (word->deny & bit)
+      return false;
+    if (word->allow & bit)
+      return true;
+  }
+
+  key = 0;
+  struct nodeport_range *range = nodeport_range.lookup(&key);
+  if (!range)
+    return false;
+  return port >= range->low && port <= range->high;
+}
+
+static __always_inline void count_nodeport_hit(uint16_t port) {
+  uint64_t *hits = nodeport_hits.lookup(&port);
+  if (hits) {
+    *hits += 1;
+  } else {
+    uint64_t one = 1;
+    nodeport_hits.update(&port, &one);
+  }
+}
+
 static __always_inline int handle_rx(struct CTXTYPE *ctx,
                                      struct pkt_metadata *md) {
   pcn_log(ctx, LOG_TRACE, "k8s received packet");
@@ -79,8 +127,9 @@ static __always_inline int handle_rx(struct CTXTYPE *ctx,
     return RX_OK;
   }
 
-  if (ntohs(dst_port) >= NODEPORT_RANGE_LOW &&
-      ntohs(dst_port) <= NODEPORT_RANGE_HIGH) {
+  uint16_t port = ntohs(dst_port);
+  if (is_nodeport(port)) {
+    count_nodeport_hit(port);
     pcn_log(ctx, LOG_DEBUG, "Sending packet to internal port");
     return pcn_pkt_redirect(ctx, md, INTERNAL_PORT);
   }
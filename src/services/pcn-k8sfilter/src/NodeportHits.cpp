@@ -0,0 +1,47 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NodeportHits.h"
+#include "K8sfilter.h"
+
+NodeportHits::NodeportHits(K8sfilter &parent,
+                           const NodeportHitsJsonObject &conf)
+    : parent_(parent), port_(conf.getPort()), packets_(conf.getPackets()) {}
+
+NodeportHits::~NodeportHits() {}
+
+void NodeportHits::update(const NodeportHitsJsonObject &conf) {}
+
+NodeportHitsJsonObject NodeportHits::toJsonObject() {
+  NodeportHitsJsonObject conf;
+
+  conf.setPort(getPort());
+  conf.setPackets(getPackets());
+
+  return conf;
+}
+
+uint16_t NodeportHits::getPort() {
+  return port_;
+}
+
+uint64_t NodeportHits::getPackets() {
+  return packets_;
+}
+
+std::shared_ptr<spdlog::logger> NodeportHits::logger() {
+  return parent_.logger();
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/NodeportHitsInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class K8sfilter;
+
+using namespace io::swagger::server::model;
+
+class NodeportHits : public NodeportHitsInterface {
+ public:
+  NodeportHits(K8sfilter &parent, const NodeportHitsJsonObject &conf);
+  virtual ~NodeportHits();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const NodeportHitsJsonObject &conf) override;
+  NodeportHitsJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  uint16_t getPort() override;
+
+  /// <summary>
+  /// Number of packets sent to the internal port
+  /// </summary>
+  uint64_t getPackets() override;
+
+ private:
+  K8sfilter &parent_;
+  uint16_t port_;
+  uint64_t packets_;
+};
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PortException.h"
+#include "K8sfilter.h"
+
+PortException::PortException(K8sfilter &parent,
+                             const PortExceptionJsonObject &conf)
+    : parent_(parent), port_(conf.getPort()) {
+  if (!conf.actionIsSet()) {
+    throw std::runtime_error("Port exception action must be provided");
+  }
+  action_ = conf.getAction();
+}
+
+PortException::~PortException() {}
+
+void PortException::update(const PortExceptionJsonObject &conf) {
+  if (conf.actionIsSet()) {
+    setAction(conf.getAction());
+  }
+}
+
+PortExceptionJsonObject PortException::toJsonObject() {
+  PortExceptionJsonObject conf;
+
+  conf.setPort(getPort());
+  conf.setAction(getAction());
+
+  return conf;
+}
+
+uint16_t PortException::getPort() {
+  return port_;
+}
+
+PortExceptionActionEnum PortException::getAction() {
+  return action_;
+}
+
+void PortException::setAction(const PortExceptionActionEnum &value) {
+  if (action_ == value) {
+    return;
+  }
+  action_ = value;
+  parent_.writePortBitmap(port_);
+}
+
+std::shared_ptr<spdlog::logger> PortException::logger() {
+  return parent_.logger();
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/PortExceptionInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class K8sfilter;
+
+using namespace io::swagger::server::model;
+
+class PortException : public PortExceptionInterface {
+ public:
+  PortException(K8sfilter &parent, const PortExceptionJsonObject &conf);
+  virtual ~PortException();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const PortExceptionJsonObject &conf) override;
+  PortExceptionJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  uint16_t getPort() override;
+
+  /// <summary>
+  /// Action applied to the traffic directed to the port
+  /// </summary>
+  PortExceptionActionEnum getAction() override;
+  void setAction(const PortExceptionActionEnum &value) override;
+
+ private:
+  K8sfilter &parent_;
+  uint16_t port_;
+  PortExceptionActionEnum action_;
+};
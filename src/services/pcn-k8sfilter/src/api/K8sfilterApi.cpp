@@ -43,6 +43,58 @@ Response create_k8sfilter_by_id_handler(
   }
 }
 
+Response create_k8sfilter_port_exception_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    PortExceptionJsonObject unique_value { request_body };
+
+    unique_value.setPort(unique_port);
+    create_k8sfilter_port_exception_by_id(unique_name, unique_port, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_k8sfilter_port_exception_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<PortExceptionJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<PortExceptionJsonObject> unique_value;
+    for (auto &j : request_body) {
+      PortExceptionJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    create_k8sfilter_port_exception_list_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response create_k8sfilter_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -109,6 +161,42 @@ Response delete_k8sfilter_by_id_handler(
   }
 }
 
+Response delete_k8sfilter_port_exception_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+    delete_k8sfilter_port_exception_by_id(unique_name, unique_port);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response delete_k8sfilter_port_exception_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_k8sfilter_port_exception_list_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_k8sfilter_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -180,6 +268,75 @@ Response read_k8sfilter_list_by_id_handler(
   }
 }
 
+Response read_k8sfilter_nodeport_hits_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_k8sfilter_nodeport_hits_by_id(unique_name, unique_port);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8sfilter_nodeport_hits_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8sfilter_nodeport_hits_list_by_id(unique_name);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8sfilter_nodeport_hits_packets_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_k8sfilter_nodeport_hits_packets_by_id(unique_name, unique_port);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8sfilter_nodeport_range_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -197,6 +354,75 @@ Response read_k8sfilter_nodeport_range_by_id_handler(
   }
 }
 
+Response read_k8sfilter_port_exception_action_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_k8sfilter_port_exception_action_by_id(unique_name, unique_port);
+    nlohmann::json response_body;
+    response_body = PortExceptionJsonObject::PortExceptionActionEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8sfilter_port_exception_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_k8sfilter_port_exception_by_id(unique_name, unique_port);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8sfilter_port_exception_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8sfilter_port_exception_list_by_id(unique_name);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8sfilter_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -286,6 +512,58 @@ Response replace_k8sfilter_by_id_handler(
   }
 }
 
+Response replace_k8sfilter_port_exception_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    PortExceptionJsonObject unique_value { request_body };
+
+    unique_value.setPort(unique_port);
+    replace_k8sfilter_port_exception_by_id(unique_name, unique_port, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_k8sfilter_port_exception_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<PortExceptionJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<PortExceptionJsonObject> unique_value;
+    for (auto &j : request_body) {
+      PortExceptionJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    replace_k8sfilter_port_exception_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response replace_k8sfilter_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -399,6 +677,83 @@ Response update_k8sfilter_nodeport_range_by_id_handler(
   }
 }
 
+Response update_k8sfilter_port_exception_action_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    PortExceptionActionEnum unique_value_ = PortExceptionJsonObject::string_to_PortExceptionActionEnum(request_body);
+    update_k8sfilter_port_exception_action_by_id(unique_name, unique_port, unique_value_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_k8sfilter_port_exception_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint16_t unique_port;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "port")) {
+      unique_port = keys[i].value.uint16;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    PortExceptionJsonObject unique_value { request_body };
+
+    unique_value.setPort(unique_port);
+    update_k8sfilter_port_exception_by_id(unique_name, unique_port, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_k8sfilter_port_exception_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<PortExceptionJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<PortExceptionJsonObject> unique_value;
+    for (auto &j : request_body) {
+      PortExceptionJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    update_k8sfilter_port_exception_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_k8sfilter_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -460,6 +815,24 @@ Response k8sfilter_list_by_id_help(
   return { kOk, ::strdup(val.dump().c_str()) };
 }
 
+Response k8sfilter_nodeport_hits_list_by_id_help(
+  const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name { name };
+  nlohmann::json val = read_k8sfilter_nodeport_hits_list_by_id_get_list(unique_name);
+
+  return { kOk, ::strdup(val.dump().c_str()) };
+}
+
+Response k8sfilter_port_exception_list_by_id_help(
+  const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name { name };
+  nlohmann::json val = read_k8sfilter_port_exception_list_by_id_get_list(unique_name);
+
+  return { kOk, ::strdup(val.dump().c_str()) };
+}
+
 Response k8sfilter_ports_list_by_id_help(
   const char *name, const Key *keys, size_t num_keys) {
   // Getting the path params
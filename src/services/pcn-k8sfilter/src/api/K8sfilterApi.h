@@ -27,6 +27,8 @@
 
 #include "K8sfilterJsonObject.h"
 #include "PortsJsonObject.h"
+#include "PortExceptionJsonObject.h"
+#include "NodeportHitsJsonObject.h"
 #include <vector>
 
 
@@ -35,27 +37,44 @@ extern "C" {
 #endif
 
 Response create_k8sfilter_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_k8sfilter_port_exception_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_k8sfilter_port_exception_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8sfilter_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8sfilter_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_k8sfilter_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_k8sfilter_port_exception_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_k8sfilter_port_exception_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8sfilter_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8sfilter_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_nodeport_hits_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_nodeport_hits_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_nodeport_hits_packets_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_nodeport_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_port_exception_action_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_port_exception_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8sfilter_port_exception_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8sfilter_ports_type_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_k8sfilter_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_k8sfilter_port_exception_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_k8sfilter_port_exception_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8sfilter_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8sfilter_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8sfilter_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8sfilter_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8sfilter_nodeport_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8sfilter_port_exception_action_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8sfilter_port_exception_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8sfilter_port_exception_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8sfilter_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8sfilter_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response k8sfilter_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
+Response k8sfilter_nodeport_hits_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
+Response k8sfilter_port_exception_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response k8sfilter_ports_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 
 
@@ -90,6 +90,42 @@ std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_list_by
   return r;
 }
 
+/**
+* @brief   Create port-exception by ID
+*
+* Create operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+create_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value) {
+  auto k8sfilter = get_cube(name);
+
+  k8sfilter->addPortException(port, value);
+}
+
+/**
+* @brief   Create port-exception by ID
+*
+* Create operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+create_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value) {
+  auto k8sfilter = get_cube(name);
+  k8sfilter->addPortExceptionList(value);
+}
+
 /**
 * @brief   Create ports by ID
 *
@@ -126,6 +162,40 @@ create_k8sfilter_ports_list_by_id(const std::string &name, const std::vector<Por
   k8sfilter->addPortsList(value);
 }
 
+/**
+* @brief   Delete port-exception by ID
+*
+* Delete operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+*
+* Responses:
+*
+*/
+void
+delete_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port) {
+  auto k8sfilter = get_cube(name);
+
+  k8sfilter->delPortException(port);
+}
+
+/**
+* @brief   Delete port-exception by ID
+*
+* Delete operation of resource: port-exception*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_k8sfilter_port_exception_list_by_id(const std::string &name) {
+  auto k8sfilter = get_cube(name);
+  k8sfilter->delPortExceptionList();
+}
+
 /**
 * @brief   Delete ports by ID
 *
@@ -176,6 +246,63 @@ read_k8sfilter_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read nodeport-hits by ID
+*
+* Read operation of resource: nodeport-hits*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+*
+* Responses:
+* NodeportHitsJsonObject
+*/
+NodeportHitsJsonObject
+read_k8sfilter_nodeport_hits_by_id(const std::string &name, const uint16_t &port) {
+  auto k8sfilter = get_cube(name);
+  return k8sfilter->getNodeportHits(port)->toJsonObject();
+
+}
+
+/**
+* @brief   Read nodeport-hits by ID
+*
+* Read operation of resource: nodeport-hits*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::vector<NodeportHitsJsonObject>
+*/
+std::vector<NodeportHitsJsonObject>
+read_k8sfilter_nodeport_hits_list_by_id(const std::string &name) {
+  auto k8sfilter = get_cube(name);
+  auto &&nodeportHits = k8sfilter->getNodeportHitsList();
+  std::vector<NodeportHitsJsonObject> m;
+  for(auto &i : nodeportHits)
+    m.push_back(i->toJsonObject());
+  return m;
+}
+
+/**
+* @brief   Read packets by ID
+*
+* Read operation of resource: packets*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8sfilter_nodeport_hits_packets_by_id(const std::string &name, const uint16_t &port) {
+  auto k8sfilter = get_cube(name);
+  auto nodeportHits = k8sfilter->getNodeportHits(port);
+  return nodeportHits->getPackets();
+
+}
+
 /**
 * @brief   Read nodeport-range by ID
 *
@@ -193,6 +320,63 @@ read_k8sfilter_nodeport_range_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read action by ID
+*
+* Read operation of resource: action*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+*
+* Responses:
+* PortExceptionActionEnum
+*/
+PortExceptionActionEnum
+read_k8sfilter_port_exception_action_by_id(const std::string &name, const uint16_t &port) {
+  auto k8sfilter = get_cube(name);
+  auto portException = k8sfilter->getPortException(port);
+  return portException->getAction();
+
+}
+
+/**
+* @brief   Read port-exception by ID
+*
+* Read operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+*
+* Responses:
+* PortExceptionJsonObject
+*/
+PortExceptionJsonObject
+read_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port) {
+  auto k8sfilter = get_cube(name);
+  return k8sfilter->getPortException(port)->toJsonObject();
+
+}
+
+/**
+* @brief   Read port-exception by ID
+*
+* Read operation of resource: port-exception*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::vector<PortExceptionJsonObject>
+*/
+std::vector<PortExceptionJsonObject>
+read_k8sfilter_port_exception_list_by_id(const std::string &name) {
+  auto k8sfilter = get_cube(name);
+  auto &&portException = k8sfilter->getPortExceptionList();
+  std::vector<PortExceptionJsonObject> m;
+  for(auto &i : portException)
+    m.push_back(i->toJsonObject());
+  return m;
+}
+
 /**
 * @brief   Read ports by ID
 *
@@ -250,6 +434,41 @@ read_k8sfilter_ports_type_by_id(const std::string &name, const std::string &port
 
 }
 
+/**
+* @brief   Replace port-exception by ID
+*
+* Replace operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+replace_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value) {
+  auto k8sfilter = get_cube(name);
+
+  k8sfilter->replacePortException(port, value);
+}
+
+/**
+* @brief   Replace port-exception by ID
+*
+* Replace operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+replace_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
 /**
 * @brief   Replace ports by ID
 *
@@ -336,6 +555,62 @@ update_k8sfilter_nodeport_range_by_id(const std::string &name, const std::string
   k8sfilter->setNodeportRange(value);
 }
 
+/**
+* @brief   Update action by ID
+*
+* Update operation of resource: action*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+* @param[in] value Action applied to the traffic directed to the port
+*
+* Responses:
+*
+*/
+void
+update_k8sfilter_port_exception_action_by_id(const std::string &name, const uint16_t &port, const PortExceptionActionEnum &value) {
+  auto k8sfilter = get_cube(name);
+  auto portException = k8sfilter->getPortException(port);
+
+  return portException->setAction(value);
+}
+
+/**
+* @brief   Update port-exception by ID
+*
+* Update operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] port ID of port
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+update_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value) {
+  auto k8sfilter = get_cube(name);
+  auto portException = k8sfilter->getPortException(port);
+
+  portException->update(value);
+}
+
+/**
+* @brief   Update port-exception by ID
+*
+* Update operation of resource: port-exception*
+*
+* @param[in] name ID of name
+* @param[in] value port-exceptionbody object
+*
+* Responses:
+*
+*/
+void
+update_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
 /**
 * @brief   Update ports by ID
 *
@@ -378,6 +653,36 @@ update_k8sfilter_ports_list_by_id(const std::string &name, const std::vector<Por
  * help related
  */
 
+std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_nodeport_hits_list_by_id_get_list(const std::string &name) {
+  std::vector<nlohmann::fifo_map<std::string, std::string>> r;
+  auto &&k8sfilter = get_cube(name);
+
+  auto &&nodeportHits = k8sfilter->getNodeportHitsList();
+  for(auto &i : nodeportHits) {
+    nlohmann::fifo_map<std::string, std::string> keys;
+
+    keys["port"] = std::to_string(i->getPort());
+
+    r.push_back(keys);
+  }
+  return r;
+}
+
+std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_port_exception_list_by_id_get_list(const std::string &name) {
+  std::vector<nlohmann::fifo_map<std::string, std::string>> r;
+  auto &&k8sfilter = get_cube(name);
+
+  auto &&portException = k8sfilter->getPortExceptionList();
+  for(auto &i : portException) {
+    nlohmann::fifo_map<std::string, std::string> keys;
+
+    keys["port"] = std::to_string(i->getPort());
+
+    r.push_back(keys);
+  }
+  return r;
+}
+
 std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_ports_list_by_id_get_list(const std::string &name) {
   std::vector<nlohmann::fifo_map<std::string, std::string>> r;
   auto &&k8sfilter = get_cube(name);
@@ -28,6 +28,8 @@
 
 #include "K8sfilterJsonObject.h"
 #include "PortsJsonObject.h"
+#include "PortExceptionJsonObject.h"
+#include "NodeportHitsJsonObject.h"
 #include <vector>
 
 namespace io {
@@ -39,28 +41,45 @@ using namespace io::swagger::server::model;
 
 namespace K8sfilterApiImpl {
   void create_k8sfilter_by_id(const std::string &name, const K8sfilterJsonObject &value);
+  void create_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value);
+  void create_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value);
   void create_k8sfilter_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void create_k8sfilter_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void delete_k8sfilter_by_id(const std::string &name);
+  void delete_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port);
+  void delete_k8sfilter_port_exception_list_by_id(const std::string &name);
   void delete_k8sfilter_ports_by_id(const std::string &name, const std::string &portsName);
   void delete_k8sfilter_ports_list_by_id(const std::string &name);
   K8sfilterJsonObject read_k8sfilter_by_id(const std::string &name);
   std::vector<K8sfilterJsonObject> read_k8sfilter_list_by_id();
+  NodeportHitsJsonObject read_k8sfilter_nodeport_hits_by_id(const std::string &name, const uint16_t &port);
+  std::vector<NodeportHitsJsonObject> read_k8sfilter_nodeport_hits_list_by_id(const std::string &name);
+  uint64_t read_k8sfilter_nodeport_hits_packets_by_id(const std::string &name, const uint16_t &port);
   std::string read_k8sfilter_nodeport_range_by_id(const std::string &name);
+  PortExceptionActionEnum read_k8sfilter_port_exception_action_by_id(const std::string &name, const uint16_t &port);
+  PortExceptionJsonObject read_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port);
+  std::vector<PortExceptionJsonObject> read_k8sfilter_port_exception_list_by_id(const std::string &name);
   PortsJsonObject read_k8sfilter_ports_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_k8sfilter_ports_list_by_id(const std::string &name);
   PortsTypeEnum read_k8sfilter_ports_type_by_id(const std::string &name, const std::string &portsName);
   void replace_k8sfilter_by_id(const std::string &name, const K8sfilterJsonObject &value);
+  void replace_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value);
+  void replace_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value);
   void replace_k8sfilter_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void replace_k8sfilter_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void update_k8sfilter_by_id(const std::string &name, const K8sfilterJsonObject &value);
   void update_k8sfilter_list_by_id(const std::vector<K8sfilterJsonObject> &value);
   void update_k8sfilter_nodeport_range_by_id(const std::string &name, const std::string &value);
+  void update_k8sfilter_port_exception_action_by_id(const std::string &name, const uint16_t &port, const PortExceptionActionEnum &value);
+  void update_k8sfilter_port_exception_by_id(const std::string &name, const uint16_t &port, const PortExceptionJsonObject &value);
+  void update_k8sfilter_port_exception_list_by_id(const std::string &name, const std::vector<PortExceptionJsonObject> &value);
   void update_k8sfilter_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void update_k8sfilter_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
 
   /* help related */
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_list_by_id_get_list();
+  std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_nodeport_hits_list_by_id_get_list(const std::string &name);
+  std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_port_exception_list_by_id_get_list(const std::string &name);
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8sfilter_ports_list_by_id_get_list(const std::string &name);
 
 }
@@ -22,6 +22,8 @@
 
 #include "../serializer/K8sfilterJsonObject.h"
 
+#include "../NodeportHits.h"
+#include "../PortException.h"
 #include "../Ports.h"
 
 using namespace io::swagger::server::model;
@@ -48,5 +50,27 @@ public:
   /// </summary>
   virtual std::string getNodeportRange() = 0;
   virtual void setNodeportRange(const std::string &value) = 0;
+
+  /// <summary>
+  /// Exception to the NodePort range for a single port
+  /// </summary>
+  virtual std::shared_ptr<PortException> getPortException(const uint16_t &port) = 0;
+  virtual std::vector<std::shared_ptr<PortException>> getPortExceptionList() = 0;
+  virtual void addPortException(const uint16_t &port, const PortExceptionJsonObject &conf) = 0;
+  virtual void addPortExceptionList(const std::vector<PortExceptionJsonObject> &conf) = 0;
+  virtual void replacePortException(const uint16_t &port, const PortExceptionJsonObject &conf) = 0;
+  virtual void delPortException(const uint16_t &port) = 0;
+  virtual void delPortExceptionList() = 0;
+
+  /// <summary>
+  /// Packets sent to the internal port, by destination port
+  /// </summary>
+  virtual std::shared_ptr<NodeportHits> getNodeportHits(const uint16_t &port) = 0;
+  virtual std::vector<std::shared_ptr<NodeportHits>> getNodeportHitsList() = 0;
+  virtual void addNodeportHits(const uint16_t &port, const NodeportHitsJsonObject &conf) = 0;
+  virtual void addNodeportHitsList(const std::vector<NodeportHitsJsonObject> &conf) = 0;
+  virtual void replaceNodeportHits(const uint16_t &port, const NodeportHitsJsonObject &conf) = 0;
+  virtual void delNodeportHits(const uint16_t &port) = 0;
+  virtual void delNodeportHitsList() = 0;
 };
 
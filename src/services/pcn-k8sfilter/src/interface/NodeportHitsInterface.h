@@ -0,0 +1,44 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* NodeportHitsInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/NodeportHitsJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class NodeportHitsInterface {
+public:
+
+  virtual void update(const NodeportHitsJsonObject &conf) = 0;
+  virtual NodeportHitsJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  virtual uint16_t getPort() = 0;
+
+  /// <summary>
+  /// Number of packets sent to the internal port
+  /// </summary>
+  virtual uint64_t getPackets() = 0;
+};
+
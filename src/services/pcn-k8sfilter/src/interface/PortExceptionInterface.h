@@ -0,0 +1,45 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* PortExceptionInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/PortExceptionJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class PortExceptionInterface {
+public:
+
+  virtual void update(const PortExceptionJsonObject &conf) = 0;
+  virtual PortExceptionJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  virtual uint16_t getPort() = 0;
+
+  /// <summary>
+  /// Action applied to the traffic directed to the port
+  /// </summary>
+  virtual PortExceptionActionEnum getAction() = 0;
+  virtual void setAction(const PortExceptionActionEnum &value) = 0;
+};
+
@@ -27,6 +27,8 @@ K8sfilterJsonObject::K8sfilterJsonObject() {
   m_portsIsSet = false;
   m_nodeportRange = "30000-32767";
   m_nodeportRangeIsSet = true;
+  m_portExceptionIsSet = false;
+  m_nodeportHitsIsSet = false;
 }
 
 K8sfilterJsonObject::K8sfilterJsonObject(const nlohmann::json &val) :
@@ -34,6 +36,8 @@ K8sfilterJsonObject::K8sfilterJsonObject(const nlohmann::json &val) :
   m_nameIsSet = false;
   m_portsIsSet = false;
   m_nodeportRangeIsSet = false;
+  m_portExceptionIsSet = false;
+  m_nodeportHitsIsSet = false;
 
 
   if (val.count("name")) {
@@ -52,6 +56,24 @@ K8sfilterJsonObject::K8sfilterJsonObject(const nlohmann::json &val) :
   if (val.count("nodeport-range")) {
     setNodeportRange(val.at("nodeport-range").get<std::string>());
   }
+
+  if (val.count("port-exception")) {
+    for (auto& item : val["port-exception"]) {
+      PortExceptionJsonObject newItem{ item };
+      m_portException.push_back(newItem);
+    }
+
+    m_portExceptionIsSet = true;
+  }
+
+  if (val.count("nodeport-hits")) {
+    for (auto& item : val["nodeport-hits"]) {
+      NodeportHitsJsonObject newItem{ item };
+      m_nodeportHits.push_back(newItem);
+    }
+
+    m_nodeportHitsIsSet = true;
+  }
 }
 
 nlohmann::json K8sfilterJsonObject::toJson() const {
@@ -79,6 +101,28 @@ nlohmann::json K8sfilterJsonObject::toJson() const {
     val["nodeport-range"] = m_nodeportRange;
   }
 
+  {
+    nlohmann::json jsonArray;
+    for (auto& item : m_portException) {
+      jsonArray.push_back(JsonObjectBase::toJson(item));
+    }
+
+    if (jsonArray.size() > 0) {
+      val["port-exception"] = jsonArray;
+    }
+  }
+
+  {
+    nlohmann::json jsonArray;
+    for (auto& item : m_nodeportHits) {
+      jsonArray.push_back(JsonObjectBase::toJson(item));
+    }
+
+    if (jsonArray.size() > 0) {
+      val["nodeport-hits"] = jsonArray;
+    }
+  }
+
   return val;
 }
 
@@ -122,6 +166,8 @@ std::string K8sfilterJsonObject::getNodeportRange() const {
 void K8sfilterJsonObject::setNodeportRange(std::string value) {
   m_nodeportRange = value;
   m_nodeportRangeIsSet = true;
+  m_portExceptionIsSet = false;
+  m_nodeportHitsIsSet = false;
 }
 
 bool K8sfilterJsonObject::nodeportRangeIsSet() const {
@@ -132,6 +178,42 @@ void K8sfilterJsonObject::unsetNodeportRange() {
   m_nodeportRangeIsSet = false;
 }
 
+const std::vector<PortExceptionJsonObject>& K8sfilterJsonObject::getPortException() const{
+  return m_portException;
+}
+
+void K8sfilterJsonObject::addPortException(PortExceptionJsonObject value) {
+  m_portException.push_back(value);
+  m_portExceptionIsSet = true;
+}
+
+
+bool K8sfilterJsonObject::portExceptionIsSet() const {
+  return m_portExceptionIsSet;
+}
+
+void K8sfilterJsonObject::unsetPortException() {
+  m_portExceptionIsSet = false;
+}
+
+const std::vector<NodeportHitsJsonObject>& K8sfilterJsonObject::getNodeportHits() const{
+  return m_nodeportHits;
+}
+
+void K8sfilterJsonObject::addNodeportHits(NodeportHitsJsonObject value) {
+  m_nodeportHits.push_back(value);
+  m_nodeportHitsIsSet = true;
+}
+
+
+bool K8sfilterJsonObject::nodeportHitsIsSet() const {
+  return m_nodeportHitsIsSet;
+}
+
+void K8sfilterJsonObject::unsetNodeportHits() {
+  m_nodeportHitsIsSet = false;
+}
+
 
 }
 }
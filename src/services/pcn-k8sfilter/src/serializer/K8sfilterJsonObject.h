@@ -23,6 +23,8 @@
 
 #include "JsonObjectBase.h"
 
+#include "NodeportHitsJsonObject.h"
+#include "PortExceptionJsonObject.h"
 #include "PortsJsonObject.h"
 #include <vector>
 #include "polycube/services/cube.h"
@@ -67,6 +69,22 @@ public:
   bool nodeportRangeIsSet() const;
   void unsetNodeportRange();
 
+  /// <summary>
+  /// Exception to the NodePort range for a single port
+  /// </summary>
+  const std::vector<PortExceptionJsonObject>& getPortException() const;
+  void addPortException(PortExceptionJsonObject value);
+  bool portExceptionIsSet() const;
+  void unsetPortException();
+
+  /// <summary>
+  /// Packets sent to the internal port, by destination port
+  /// </summary>
+  const std::vector<NodeportHitsJsonObject>& getNodeportHits() const;
+  void addNodeportHits(NodeportHitsJsonObject value);
+  bool nodeportHitsIsSet() const;
+  void unsetNodeportHits();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -74,6 +92,10 @@ private:
   bool m_portsIsSet;
   std::string m_nodeportRange;
   bool m_nodeportRangeIsSet;
+  std::vector<PortExceptionJsonObject> m_portException;
+  bool m_portExceptionIsSet;
+  std::vector<NodeportHitsJsonObject> m_nodeportHits;
+  bool m_nodeportHitsIsSet;
 };
 
 }
@@ -0,0 +1,97 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "NodeportHitsJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+NodeportHitsJsonObject::NodeportHitsJsonObject() {
+  m_portIsSet = false;
+  m_packetsIsSet = false;
+}
+
+NodeportHitsJsonObject::NodeportHitsJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_portIsSet = false;
+  m_packetsIsSet = false;
+
+
+  if (val.count("port")) {
+    setPort(val.at("port").get<uint16_t>());
+  }
+
+  if (val.count("packets")) {
+    setPackets(val.at("packets").get<uint64_t>());
+  }
+}
+
+nlohmann::json NodeportHitsJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_portIsSet) {
+    val["port"] = m_port;
+  }
+
+  if (m_packetsIsSet) {
+    val["packets"] = m_packets;
+  }
+
+  return val;
+}
+
+uint16_t NodeportHitsJsonObject::getPort() const {
+  return m_port;
+}
+
+void NodeportHitsJsonObject::setPort(uint16_t value) {
+  m_port = value;
+  m_portIsSet = true;
+}
+
+bool NodeportHitsJsonObject::portIsSet() const {
+  return m_portIsSet;
+}
+
+uint64_t NodeportHitsJsonObject::getPackets() const {
+  return m_packets;
+}
+
+void NodeportHitsJsonObject::setPackets(uint64_t value) {
+  m_packets = value;
+  m_packetsIsSet = true;
+}
+
+bool NodeportHitsJsonObject::packetsIsSet() const {
+  return m_packetsIsSet;
+}
+
+void NodeportHitsJsonObject::unsetPackets() {
+  m_packetsIsSet = false;
+}
+
+
+}
+}
+}
+}
+
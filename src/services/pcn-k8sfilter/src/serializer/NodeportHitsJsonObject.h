@@ -0,0 +1,70 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* NodeportHitsJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  NodeportHitsJsonObject : public JsonObjectBase {
+public:
+  NodeportHitsJsonObject();
+  NodeportHitsJsonObject(const nlohmann::json &json);
+  ~NodeportHitsJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  uint16_t getPort() const;
+  void setPort(uint16_t value);
+  bool portIsSet() const;
+
+  /// <summary>
+  /// Number of packets sent to the internal port
+  /// </summary>
+  uint64_t getPackets() const;
+  void setPackets(uint64_t value);
+  bool packetsIsSet() const;
+  void unsetPackets();
+
+private:
+  uint16_t m_port;
+  bool m_portIsSet;
+  uint64_t m_packets;
+  bool m_packetsIsSet;
+};
+
+}
+}
+}
+}
+
@@ -0,0 +1,112 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "PortExceptionJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+PortExceptionJsonObject::PortExceptionJsonObject() {
+  m_portIsSet = false;
+  m_actionIsSet = false;
+}
+
+PortExceptionJsonObject::PortExceptionJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_portIsSet = false;
+  m_actionIsSet = false;
+
+
+  if (val.count("port")) {
+    setPort(val.at("port").get<uint16_t>());
+  }
+
+  if (val.count("action")) {
+    setAction(string_to_PortExceptionActionEnum(val.at("action").get<std::string>()));
+  }
+}
+
+nlohmann::json PortExceptionJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_portIsSet) {
+    val["port"] = m_port;
+  }
+
+  if (m_actionIsSet) {
+    val["action"] = PortExceptionActionEnum_to_string(m_action);
+  }
+
+  return val;
+}
+
+uint16_t PortExceptionJsonObject::getPort() const {
+  return m_port;
+}
+
+void PortExceptionJsonObject::setPort(uint16_t value) {
+  m_port = value;
+  m_portIsSet = true;
+}
+
+bool PortExceptionJsonObject::portIsSet() const {
+  return m_portIsSet;
+}
+
+PortExceptionActionEnum PortExceptionJsonObject::getAction() const {
+  return m_action;
+}
+
+void PortExceptionJsonObject::setAction(PortExceptionActionEnum value) {
+  m_action = value;
+  m_actionIsSet = true;
+}
+
+bool PortExceptionJsonObject::actionIsSet() const {
+  return m_actionIsSet;
+}
+
+std::string PortExceptionJsonObject::PortExceptionActionEnum_to_string(const PortExceptionActionEnum &value){
+  switch(value) {
+  case PortExceptionActionEnum::ALLOW:
+    return std::string("allow");
+  case PortExceptionActionEnum::DENY:
+    return std::string("deny");
+  default:
+    throw std::runtime_error("Bad PortException action");
+  }
+}
+
+PortExceptionActionEnum PortExceptionJsonObject::string_to_PortExceptionActionEnum(const std::string &str){
+  if (JsonObjectBase::iequals("allow", str))
+    return PortExceptionActionEnum::ALLOW;
+  if (JsonObjectBase::iequals("deny", str))
+    return PortExceptionActionEnum::DENY;
+  throw std::runtime_error("PortException action is invalid");
+}
+
+
+}
+}
+}
+}
+
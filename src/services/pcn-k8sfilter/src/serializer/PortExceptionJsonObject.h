@@ -0,0 +1,74 @@
+/**
+* k8sfilter API
+* k8sfilter API generated from k8sfilter.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* PortExceptionJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+enum class PortExceptionActionEnum {
+  ALLOW, DENY
+};
+
+/// <summary>
+///
+/// </summary>
+class  PortExceptionJsonObject : public JsonObjectBase {
+public:
+  PortExceptionJsonObject();
+  PortExceptionJsonObject(const nlohmann::json &json);
+  ~PortExceptionJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Destination L4 port number
+  /// </summary>
+  uint16_t getPort() const;
+  void setPort(uint16_t value);
+  bool portIsSet() const;
+
+  /// <summary>
+  /// Action applied to the traffic directed to the port
+  /// </summary>
+  PortExceptionActionEnum getAction() const;
+  void setAction(PortExceptionActionEnum value);
+  bool actionIsSet() const;
+  static std::string PortExceptionActionEnum_to_string(const PortExceptionActionEnum &value);
+  static PortExceptionActionEnum string_to_PortExceptionActionEnum(const std::string &str);
+
+private:
+  uint16_t m_port;
+  bool m_portIsSet;
+  PortExceptionActionEnum m_action;
+  bool m_actionIsSet;
+};
+
+}
+}
+}
+}
+
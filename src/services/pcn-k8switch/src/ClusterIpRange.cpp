@@ -0,0 +1,47 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ClusterIpRange.h"
+#include "K8switch.h"
+
+using namespace polycube::service;
+
+ClusterIpRange::ClusterIpRange(K8switch &parent,
+                               const ClusterIpRangeJsonObject &conf)
+    : parent_(parent), subnet_(conf.getSubnet()) {}
+
+ClusterIpRange::ClusterIpRange(K8switch &parent, const std::string &subnet)
+    : parent_(parent), subnet_(subnet) {}
+
+ClusterIpRange::~ClusterIpRange() {}
+
+void ClusterIpRange::update(const ClusterIpRangeJsonObject &conf) {}
+
+ClusterIpRangeJsonObject ClusterIpRange::toJsonObject() {
+  ClusterIpRangeJsonObject conf;
+
+  conf.setSubnet(getSubnet());
+
+  return conf;
+}
+
+std::string ClusterIpRange::getSubnet() {
+  return subnet_;
+}
+
+std::shared_ptr<spdlog::logger> ClusterIpRange::logger() {
+  return parent_.logger();
+}
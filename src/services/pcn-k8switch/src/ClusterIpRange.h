@@ -0,0 +1,51 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/ClusterIpRangeInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class K8switch;
+
+using namespace io::swagger::server::model;
+
+/* definitions copied from datapath */
+struct cluster_ip_subnet_key {
+  uint32_t prefixlen;
+  uint32_t ip;
+} __attribute__((packed));
+
+class ClusterIpRange : public ClusterIpRangeInterface {
+ public:
+  ClusterIpRange(K8switch &parent, const ClusterIpRangeJsonObject &conf);
+  ClusterIpRange(K8switch &parent, const std::string &subnet);
+  virtual ~ClusterIpRange();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const ClusterIpRangeJsonObject &conf) override;
+  ClusterIpRangeJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Range of VIPs where clusterIP services are exposed
+  /// </summary>
+  std::string getSubnet() override;
+
+ private:
+  K8switch &parent_;
+  std::string subnet_;
+};
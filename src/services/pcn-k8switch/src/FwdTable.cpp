@@ -74,9 +74,3 @@ void FwdTable::setPort(const std::string &value) {
 std::shared_ptr<spdlog::logger> FwdTable::logger() {
   return parent_.logger();
 }
-
-// TODO: this function should evolve and consider also a netmask
-uint32_t FwdTable::get_index(const std::string &ip) {
-  auto dot_index = ip.find_last_of('.');
-  return std::stol(ip.substr(dot_index + 1, std::string::npos));
-}
@@ -60,8 +60,6 @@ class FwdTable : public FwdTableInterface {
   std::string getPort() override;
   void setPort(const std::string &value) override;
 
-  static uint32_t get_index(const std::string &ip);
-
  private:
   K8switch &parent_;
   std::string ip_;
@@ -17,17 +17,43 @@
 #include "K8switch.h"
 #include <tins/ethernetII.h>
 #include <tins/tins.h>
+#include <cerrno>
 #include <cinttypes>
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <unordered_map>
 #include "K8switch_dp.h"
 
 using namespace polycube::service;
 using namespace Tins;
 
+// seconds between two cleanups of the NodePort session table
+#define SESSION_CLEANUP_INTERVAL 60
+// number of entries read by each batch operation on the session table
+#define SESSION_BATCH_SIZE 1024
+// number of ports in the free ports buffer of each cpu
+#define FREE_PORTS_BUFFER_SIZE 65536
+// sessions with a single entry younger than this (seconds) are being created
+#define SESSION_SETUP_TIME 2
+// max number of clusterIP ranges (cluster-ip-subnet included), as in datapath
+#define CLUSTER_IP_RANGES_DIM 64
+
 K8switch::K8switch(const std::string name, const K8switchJsonObject &conf)
-    : Cube(conf.getBase(), {}, {}) {
+    : Cube(conf.getBase(), {}, {}),
+      services_table_size_(conf.getServicesTableSize()),
+      fwd_table_size_(conf.getFwdTableSize()),
+      session_table_size_(conf.getSessionTable().getSize()),
+      session_table_timeout_(conf.getSessionTable().getTimeout()),
+      sessions_expired_(0),
+      sessions_evicted_(0) {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [K8switch] [%n] [%l] %v");
   logger()->info("Creating K8switch instance");
 
+  if (services_table_size_ == 0 || fwd_table_size_ == 0) {
+    throw std::runtime_error("Services and forwarding tables cannot be empty");
+  }
+
   // call do... functions to avoid reloading code so many times
   doSetClusterIpSubnet(conf.getClusterIpSubnet());
   doSetClientSubnet(conf.getClientSubnet());
@@ -36,35 +62,14 @@ K8switch::K8switch(const std::string name, const K8switchJsonObject &conf)
   // reload code a single time
   add_program(getFlags() + k8switch_code, 0);
 
+  writeClusterIpSubnet(cluster_ip_cidr_, true);
+  addClusterIpRangeList(conf.getClusterIpRange());
+  addSessionTable(conf.getSessionTable());
   addServiceList(conf.getService());
   addPortsList(conf.getPorts());
 
   // fill list of free ports and control structures
-  buf_size = 65536;
-  ncpus = polycube::get_possible_cpu_count();
-
-  auto free_ports_buffer = get_percpuarray_table<uint64_t>("free_ports_buffer");
-  auto free_ports_cb = get_array_table<cb_control>("free_ports_cb");
-
-  // fill buffer with list of ports
-  uint16_t n = (65535 - 1024) / ncpus;
-  uint64_t port_counter = 1024;
-  for (int i = 0; i < n; i++) {
-    std::vector<uint64_t> values;
-    for (int j = 0; j < ncpus; j++) {
-      values.push_back(port_counter++);
-    }
-    // update value
-    free_ports_buffer.set(i, values);
-  }
-
-  // init control structures
-  for (int j = 0; j < ncpus; j++) {
-    cb_control value{
-        .reader = 0, .writer = n, .size = buf_size,
-    };
-    free_ports_cb.set(j, value);
-  }
+  initFreePorts();
 
   stop_ = false;
   std::unique_ptr<std::thread> uptr(
@@ -100,6 +105,11 @@ void K8switch::update(const K8switchJsonObject &conf) {
       m->update(i);
     }
   }
+
+  if (conf.sessionTableIsSet()) {
+    auto m = getSessionTable();
+    m->update(conf.getSessionTable());
+  }
 }
 
 K8switchJsonObject K8switch::toJsonObject() {
@@ -117,6 +127,13 @@ K8switchJsonObject K8switch::toJsonObject() {
   conf.setClusterIpSubnet(getClusterIpSubnet());
   conf.setClientSubnet(getClientSubnet());
   conf.setVirtualClientSubnet(getVirtualClientSubnet());
+  conf.setServicesTableSize(getServicesTableSize());
+  conf.setFwdTableSize(getFwdTableSize());
+  conf.setSessionTable(getSessionTable()->toJsonObject());
+
+  for (auto &i : getClusterIpRangeList()) {
+    conf.addClusterIpRange(i->toJsonObject());
+  }
 
   //  Remove comments when you implement all sub-methods
   // for(auto &i : getFwdTableList()){
@@ -133,8 +150,13 @@ std::string K8switch::getClusterIpSubnet() {
 }
 
 void K8switch::setClusterIpSubnet(const std::string &value) {
+  // the clusterIP ranges are in a map, no need to reload the code
+  std::string old_cidr = cluster_ip_cidr_;
   doSetClusterIpSubnet(value);
-  reloadConfig();
+  if (cluster_ip_ranges_.count(old_cidr) == 0) {
+    writeClusterIpSubnet(old_cidr, false);
+  }
+  writeClusterIpSubnet(cluster_ip_cidr_, true);
 }
 
 void K8switch::doSetClusterIpSubnet(const std::string &value) {
@@ -142,6 +164,114 @@ void K8switch::doSetClusterIpSubnet(const std::string &value) {
   cluster_ip_cidr_ = value;
 }
 
+std::shared_ptr<ClusterIpRange> K8switch::getClusterIpRange(
+    const std::string &subnet) {
+  if (cluster_ip_ranges_.count(subnet) == 0) {
+    throw std::runtime_error("ClusterIP range " + subnet + " does not exist");
+  }
+
+  return std::make_shared<ClusterIpRange>(*this, subnet);
+}
+
+std::vector<std::shared_ptr<ClusterIpRange>>
+K8switch::getClusterIpRangeList() {
+  std::vector<std::shared_ptr<ClusterIpRange>> ranges;
+  for (auto &it : cluster_ip_ranges_) {
+    ranges.push_back(std::make_shared<ClusterIpRange>(*this, it.first));
+  }
+
+  return ranges;
+}
+
+void K8switch::addClusterIpRange(const std::string &subnet,
+                                 const ClusterIpRangeJsonObject &conf) {
+  logger()->debug("Adding clusterIP range {}", subnet);
+
+  if (cluster_ip_ranges_.count(subnet) != 0) {
+    throw std::runtime_error("ClusterIP range " + subnet + " already exists");
+  }
+
+  if (cluster_ip_ranges_.size() + 1 >= CLUSTER_IP_RANGES_DIM) {
+    throw std::runtime_error("Max number of clusterIP ranges reached");
+  }
+
+  uint32_t subnet_, mask_;
+  parse_cidr(subnet, &subnet_, &mask_);
+  cluster_ip_ranges_[subnet] = std::make_pair(subnet_, mask_);
+  writeClusterIpSubnet(subnet, true);
+}
+
+void K8switch::addClusterIpRangeList(
+    const std::vector<ClusterIpRangeJsonObject> &conf) {
+  for (auto &i : conf) {
+    std::string subnet_ = i.getSubnet();
+    addClusterIpRange(subnet_, i);
+  }
+}
+
+void K8switch::replaceClusterIpRange(const std::string &subnet,
+                                     const ClusterIpRangeJsonObject &conf) {
+  delClusterIpRange(subnet);
+  std::string subnet_ = conf.getSubnet();
+  addClusterIpRange(subnet_, conf);
+}
+
+void K8switch::delClusterIpRange(const std::string &subnet) {
+  logger()->debug("Removing clusterIP range {}", subnet);
+
+  if (cluster_ip_ranges_.erase(subnet) == 0) {
+    throw std::runtime_error("ClusterIP range " + subnet + " does not exist");
+  }
+
+  if (subnet != cluster_ip_cidr_) {
+    writeClusterIpSubnet(subnet, false);
+  }
+}
+
+void K8switch::delClusterIpRangeList() {
+  auto ranges = cluster_ip_ranges_;
+  for (auto &it : ranges) {
+    delClusterIpRange(it.first);
+  }
+}
+
+bool K8switch::isClusterIp(const std::string &ip) {
+  uint32_t ip_ = ip_to_dec(ip);
+
+  if ((ip_ & cluster_ip_mask_) == (cluster_ip_subnet_ & cluster_ip_mask_)) {
+    return true;
+  }
+
+  for (auto &it : cluster_ip_ranges_) {
+    if ((ip_ & it.second.second) == (it.second.first & it.second.second)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void K8switch::writeClusterIpSubnet(const std::string &cidr, bool add) {
+  uint32_t subnet, mask;
+  parse_cidr(cidr, &subnet, &mask);
+
+  cluster_ip_subnet_key key{
+      .prefixlen = uint32_t(__builtin_popcount(mask)),
+      .ip = htonl(subnet & mask),
+  };
+
+  auto cluster_ip_subnets =
+      get_hash_table<cluster_ip_subnet_key, uint8_t>("cluster_ip_subnets");
+  if (add) {
+    cluster_ip_subnets.set(key, 1);
+  } else {
+    try {
+      cluster_ip_subnets.remove(key);
+    } catch (...) {
+    }
+  }
+}
+
 std::string K8switch::getClientSubnet() {
   return client_cidr_;
 }
@@ -152,7 +282,18 @@ void K8switch::setClientSubnet(const std::string &value) {
 }
 
 void K8switch::doSetClientSubnet(const std::string &value) {
-  parse_cidr(value, &client_subnet_, &client_mask_);
+  uint32_t subnet, mask;
+  parse_cidr(value, &subnet, &mask);
+
+  // pods are indexed in the forwarding table by the host part of the address
+  if (uint64_t(~mask) + 1 > fwd_table_size_) {
+    throw std::runtime_error("Client subnet " + value +
+                             " is larger than the forwarding table (" +
+                             std::to_string(fwd_table_size_) + " entries)");
+  }
+
+  client_subnet_ = subnet;
+  client_mask_ = mask;
   client_cidr_ = value;
 }
 
@@ -186,17 +327,21 @@ std::string K8switch::getFlags() {
 
   flags += "#define NODEPORT_PORT " + std::to_string(nodeport_port) + "\n";
 
-  flags += "#define CLUSTER_IP_SUBNET " +
-           std::to_string(htonl(cluster_ip_subnet_)) + "\n";
-  flags += "#define CLUSTER_IP_MASK " +
-           std::to_string(htonl(cluster_ip_mask_)) + "\n";
-
   flags += "#define CLIENT_SUBNET_MASK " + std::to_string(htonl(client_mask_)) +
            "\n";
   flags +=
       "#define CLIENT_SUBNET " + std::to_string(htonl(client_subnet_)) + "\n";
   flags += "#define VIRTUAL_CLIENT_SUBNET " +
            std::to_string(htonl(virtual_client_subnet_)) + "\n";
+
+  flags += "#define SERVICES_MAP_DIM " + std::to_string(services_table_size_) +
+           "\n";
+  flags += "#define FWD_TABLE_DIM " + std::to_string(fwd_table_size_) + "\n";
+
+  flags += "#define NODEPORT_SESSION_DIM " +
+           std::to_string(session_table_size_) + "\n";
+  flags += "#define NODEPORT_SESSION_TIMEOUT " +
+           std::to_string(session_table_timeout_) + "\n";
   logger()->debug("flags is {}", flags);
 
   return flags;
@@ -221,60 +366,323 @@ std::shared_ptr<Ports> K8switch::getNodePortPort() {
   return nullptr;
 }
 
+std::shared_ptr<SessionTable> K8switch::getSessionTable() {
+  return session_table_;
+}
+
+void K8switch::addSessionTable(const SessionTableJsonObject &value) {
+  session_table_ = std::make_shared<SessionTable>(*this, value);
+}
+
+void K8switch::replaceSessionTable(const SessionTableJsonObject &conf) {
+  session_table_->update(conf);
+}
+
+void K8switch::delSessionTable() {
+  throw std::runtime_error(
+      "[SessionTable]: Method delSessionTable not supported");
+}
+
+uint32_t K8switch::getServicesTableSize() {
+  return services_table_size_;
+}
+
+uint32_t K8switch::getFwdTableSize() {
+  return fwd_table_size_;
+}
+
+std::vector<std::pair<nodeport_session_key, nodeport_session>>
+K8switch::getSessionEntries() {
+  std::vector<std::pair<nodeport_session_key, nodeport_session>> entries;
+
+  // Batch operations read the table in a few syscalls instead of two for
+  // each entry, they are not supported by older kernels though
+  auto table = get_raw_table("nodeport_sessions");
+  std::vector<nodeport_session_key> keys(SESSION_BATCH_SIZE);
+  std::vector<nodeport_session> values(SESSION_BATCH_SIZE);
+  uint32_t in_batch = 0, out_batch = 0;
+  bool first = true;
+
+  while (true) {
+    unsigned int count = SESSION_BATCH_SIZE;
+    int ret = table.get_batch(keys.data(), values.data(), &count,
+                              first ? nullptr : &in_batch, &out_batch);
+    if (ret != 0 && errno != ENOENT) {
+      if (!first) {
+        throw std::runtime_error("Unable to read the session table: " +
+                                 std::string(std::strerror(errno)));
+      }
+      return get_hash_table<nodeport_session_key, nodeport_session>(
+                 "nodeport_sessions")
+          .get_all();
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+      entries.emplace_back(keys[i], values[i]);
+    }
+
+    // ENOENT: no more entries
+    if (ret != 0) {
+      break;
+    }
+
+    in_batch = out_batch;
+    first = false;
+  }
+
+  return entries;
+}
+
+uint64_t K8switch::getNodePortStat(uint32_t index) {
+  auto nodeport_stats = get_percpuarray_table<uint64_t>("nodeport_stats");
+  auto values = nodeport_stats.get(index);
+  return std::accumulate(values.begin(), values.end(), (uint64_t)0);
+}
+
+uint32_t K8switch::getFreePorts() {
+  auto free_ports_reader = get_array_table<uint32_t>("free_ports_reader");
+  auto free_ports_writer = get_array_table<uint32_t>("free_ports_writer");
+
+  uint32_t free_ports = 0;
+  for (unsigned int cpu = 0; cpu < ncpus; cpu++) {
+    // positions are free running counters, the difference handles the wrap
+    free_ports += free_ports_writer.get(cpu) - free_ports_reader.get(cpu);
+  }
+
+  return free_ports;
+}
+
+void K8switch::initFreePorts() {
+  buf_size = FREE_PORTS_BUFFER_SIZE;
+  ncpus = polycube::get_possible_cpu_count();
+
+  auto free_ports_buffer = get_percpuarray_table<uint64_t>("free_ports_buffer");
+  auto free_ports_reader = get_array_table<uint32_t>("free_ports_reader");
+  auto free_ports_writer = get_array_table<uint32_t>("free_ports_writer");
+
+  // fill buffer with list of ports, each cpu gets the same number of ports
+  uint32_t n = (65536 - 1024) / ncpus;
+  first_port_ = 1024;
+  last_port_ = first_port_ + n * ncpus - 1;
+
+  free_ports_.assign(ncpus, std::vector<uint16_t>(buf_size, 0));
+
+  uint16_t port_counter = first_port_;
+  for (uint32_t i = 0; i < n; i++) {
+    std::vector<uint64_t> values;
+    for (unsigned int j = 0; j < ncpus; j++) {
+      free_ports_[j][i] = port_counter;
+      values.push_back(port_counter++);
+    }
+    // update value
+    free_ports_buffer.set(i, values);
+  }
+
+  // init control structures
+  for (unsigned int j = 0; j < ncpus; j++) {
+    free_ports_reader.set(j, 0);
+    free_ports_writer.set(j, n);
+  }
+}
+
+void K8switch::returnFreePorts(const std::vector<uint16_t> &ports) {
+  if (ports.empty()) {
+    return;
+  }
+
+  auto free_ports_buffer = get_percpuarray_table<uint64_t>("free_ports_buffer");
+  auto free_ports_reader = get_array_table<uint32_t>("free_ports_reader");
+  auto free_ports_writer = get_array_table<uint32_t>("free_ports_writer");
+
+  std::vector<uint32_t> readers(ncpus), writers(ncpus);
+  for (unsigned int cpu = 0; cpu < ncpus; cpu++) {
+    readers[cpu] = free_ports_reader.get(cpu);
+    writers[cpu] = free_ports_writer.get(cpu);
+  }
+
+  // each port goes to the cpu with less free ports, ports are grouped by
+  // position in the buffers, so that a single write updates all the cpus
+  std::map<uint32_t, std::vector<std::pair<unsigned int, uint16_t>>> slots;
+  for (auto port : ports) {
+    unsigned int cpu = 0;
+    for (unsigned int j = 1; j < ncpus; j++) {
+      if (writers[j] - readers[j] < writers[cpu] - readers[cpu]) {
+        cpu = j;
+      }
+    }
+
+    uint32_t slot = writers[cpu] % buf_size;
+    slots[slot].emplace_back(cpu, port);
+    free_ports_[cpu][slot] = port;
+    writers[cpu]++;
+  }
+
+  // the datapath only reads the buffers, the values of the other cpus are
+  // written back unchanged
+  for (auto &slot : slots) {
+    auto values = free_ports_buffer.get(slot.first);
+    for (auto &port : slot.second) {
+      values[port.first] = port.second;
+    }
+    free_ports_buffer.set(slot.first, values);
+  }
+
+  // the new ports are available to the datapath once the writer positions
+  // are moved, all of them are updated with a single batch operation when
+  // supported
+  std::vector<uint32_t> keys(ncpus);
+  std::iota(keys.begin(), keys.end(), 0);
+  unsigned int count = ncpus;
+  if (get_raw_table("free_ports_writer")
+          .update_batch(keys.data(), writers.data(), &count) != 0) {
+    for (unsigned int cpu = 0; cpu < ncpus; cpu++) {
+      free_ports_writer.set(cpu, writers[cpu]);
+    }
+  }
+
+  logger()->debug("{0} ports returned to the free ports buffers",
+                  ports.size());
+}
+
 void K8switch::cleanupSessionTable() {
+  // entries of a session, sessions are identified by their allocated port
+  struct nodeport_entries {
+    // timestamp of each entry when it was read
+    std::vector<std::pair<nodeport_session_key, uint64_t>> keys;
+    bool in = false;
+    bool out = false;
+    uint64_t timestamp = 0;
+  };
+
   try {
-    auto session_table_out =
-        get_hash_table<nodeport_session_in, nodeport_session_out>(
-            "nodeport_session_out");
-    auto session_table_in =
-        get_hash_table<nodeport_session_out, nodeport_session_in>(
-            "nodeport_session_in");
-    auto free_ports_buffer =
-        get_percpuarray_table<uint64_t>("free_ports_buffer");
-    auto free_ports_cb = get_array_table<cb_control>("free_ports_cb");
-
-    auto session_table_offline = session_table_out.get_all();
-
-    for (auto &pair : session_table_offline) {
-      auto key = pair.first;
-      auto value = pair.second;
-      // is the entry too old and have to be cleanup?
-      if (timestampToAge(value.timestamp) > sessionTableTimeout) {
-        nodeport_session_out key_in = value;
-        key_in.timestamp = 0;  // entries are saved without timestamp
-        auto value_in = session_table_in.get(key_in);
-        if (timestampToAge(value_in.timestamp) > sessionTableTimeout) {
-          session_table_out.remove(key);
-          session_table_in.remove(key_in);
-
-          // add port of that entry
-          uint16_t free_port = ntohs(key.port_src);
-          logger()->trace("port {0} is now free", free_port);
-
-          uint32_t cpu = free_port % ncpus;
-          // get writer position
-          cb_control cb = free_ports_cb.get(cpu);
-
-          // insert port in circular buffer
-          // this is racy, it is possible that ports is changes between this
-          // updates:
-          // https://github.com/iovisor/bcc/issues/1886
-          auto ports = free_ports_buffer.get(cb.writer);
-          ports[cpu] = free_port;
-          free_ports_buffer.set(cb.writer, ports);
-          // update writer position
-          cb.writer++;
-          cb.writer %= buf_size;
-
-          free_ports_cb.set(cpu, cb);
+    auto session_table = get_hash_table<nodeport_session_key, nodeport_session>(
+        "nodeport_sessions");
+    auto free_ports_reader = get_array_table<uint32_t>("free_ports_reader");
+    auto free_ports_writer = get_array_table<uint32_t>("free_ports_writer");
+
+    std::unordered_map<uint16_t, nodeport_entries> sessions;
+    for (auto &entry : getSessionEntries()) {
+      auto &key = entry.first;
+      auto &value = entry.second;
+
+      uint16_t port = sessionPort(key, value);
+      auto &session = sessions[port];
+      session.keys.emplace_back(key, uint64_t(value.timestamp));
+      if (value.dir == NODEPORT_DIR_IN) {
+        session.in = true;
+      } else {
+        session.out = true;
+      }
+      session.timestamp = std::max(session.timestamp, value.timestamp);
+    }
+
+    std::vector<uint16_t> free_ports;
+    for (auto &it : sessions) {
+      auto &session = it.second;
+      uint32_t age = timestampToAge(session.timestamp);
+
+      bool expired = age > session_table_timeout_;
+      if (!expired &&
+          !((!session.in || !session.out) && age > SESSION_SETUP_TIME)) {
+        continue;
+      }
+
+      // The datapath never reuses the port of a session, it is freed only
+      // here. An entry whose timestamp changed since it was read has been
+      // refreshed, or now belongs to a new session of the same client with
+      // another port: the session is kept in the first case, the entry in
+      // the second one.
+      std::vector<nodeport_session_key> keys;
+      bool refreshed = false;
+      for (auto &key : session.keys) {
+        nodeport_session value;
+        try {
+          value = session_table.get(key.first);
+        } catch (const std::exception &e) {
+          // the entry has been evicted meanwhile
+          continue;
+        }
+        if (sessionPort(key.first, value) != it.first) {
+          continue;
         }
+        if (value.timestamp != key.second) {
+          refreshed = true;
+          break;
+        }
+        keys.push_back(key.first);
+      }
+      if (refreshed) {
+        continue;
       }
+
+      if (expired) {
+        sessions_expired_++;
+      } else {
+        // the other entry has been evicted by the lru map, the session can't
+        // be translated anymore
+        sessions_evicted_++;
+      }
+
+      for (auto &key : keys) {
+        try {
+          session_table.remove(key);
+        } catch (const std::exception &e) {
+          // the entry has been evicted meanwhile
+        }
+      }
+
+      logger()->trace("port {0} is now free", it.first);
+      free_ports.push_back(it.first);
     }
+
+    // Ports that are neither free nor used by a session have been lost when
+    // the lru map evicted both the entries of their session.
+    // The datapath takes a port before creating its session, so a port is
+    // reclaimed only if it was missing also during the previous cleanup.
+    std::vector<bool> used(last_port_ - first_port_ + 1, false);
+    for (auto &it : sessions) {
+      if (it.first >= first_port_ && it.first <= last_port_) {
+        used[it.first - first_port_] = true;
+      }
+    }
+
+    for (unsigned int cpu = 0; cpu < ncpus; cpu++) {
+      uint32_t writer = free_ports_writer.get(cpu);
+      for (uint32_t pos = free_ports_reader.get(cpu); pos != writer; pos++) {
+        used[free_ports_[cpu][pos % buf_size] - first_port_] = true;
+      }
+    }
+
+    std::set<uint16_t> missing_ports;
+    for (uint32_t port = first_port_; port <= last_port_; port++) {
+      if (used[port - first_port_]) {
+        continue;
+      }
+
+      if (missing_ports_.count(port)) {
+        sessions_evicted_++;
+        free_ports.push_back(port);
+      } else {
+        missing_ports.insert(port);
+      }
+    }
+    missing_ports_ = std::move(missing_ports);
+
+    returnFreePorts(free_ports);
   } catch (const std::exception &e) {
     logger()->error("{0}", e.what());
   }
 }
 
+// port allocated to the session of an entry
+uint16_t K8switch::sessionPort(const nodeport_session_key &key,
+                               const nodeport_session &value) {
+  if (value.dir == NODEPORT_DIR_IN) {
+    return ntohs(value.port_src);
+  }
+  return ntohs(key.port_src);
+}
+
 uint32_t K8switch::timestampToAge(const uint64_t timestamp) {
   struct timespec now_timespec;
   clock_gettime(CLOCK_MONOTONIC, &now_timespec);
@@ -291,7 +699,7 @@ void K8switch::tick() {
   while (!stop_) {
     std::this_thread::sleep_for(timeWindow);
     counter++;
-    if (counter == 60 && !stop_) {
+    if (counter == SESSION_CLEANUP_INTERVAL && !stop_) {
       cleanupSessionTable();
       counter = 0;
     }
@@ -465,13 +873,26 @@ void K8switch::delPortsList() {
   }
 }
 
+uint32_t K8switch::getFwdTableIndex(const std::string &address) {
+  // host part of the address, 0.0.0.0 (the gateway) is index 0
+  uint32_t index = ip_to_dec(address) & ~client_mask_;
+  if (index >= fwd_table_size_) {
+    throw std::runtime_error("Address " + address +
+                             " does not fit in the forwarding table");
+  }
+
+  return index;
+}
+
 std::shared_ptr<FwdTable> K8switch::getFwdTable(const std::string &address) {
-  uint32_t ip_key =
-      FwdTable::get_index(address);  // takes last part of the IP address
+  uint32_t ip_key = getFwdTableIndex(address);
 
   try {
     auto fwd_table = get_array_table<pod>("fwd_table");
     auto entry = fwd_table.get(ip_key);
+    if (entry.mac == 0) {
+      throw std::runtime_error("empty entry");
+    }
 
     std::string mac = utils::nbo_uint_to_ip_string(entry.mac);
     std::string port(get_port(entry.port)->name());
@@ -497,9 +918,15 @@ std::vector<std::shared_ptr<FwdTable>> K8switch::getFwdTableList() {
       auto key = entry.first;
       auto value = entry.second;
 
-      // TODO: key is only the index, it should be converted back to the full IP
-      // address
-      std::string ip = utils::nbo_uint_to_ip_string(key);
+      // fwd_table is an array, unused entries are 0s
+      if (value.mac == 0) {
+        continue;
+      }
+
+      // key is the host part of the address
+      std::string ip = key == 0 ? "0.0.0.0"
+                                : utils::nbo_uint_to_ip_string(
+                                      htonl(client_subnet_ | key));
       std::string mac = utils::nbo_uint_to_mac_string(value.mac);
       std::string port(get_port(value.port)->name());
 
@@ -519,8 +946,7 @@ void K8switch::addFwdTable(const std::string &address,
   logger()->debug("Creating fwd entry ip: {0} - mac: {1} - port: {2}", address,
                   conf.getMac(), conf.getPort());
 
-  uint32_t ip_key =
-      FwdTable::get_index(address);  // takes last part of the IP address
+  uint32_t ip_key = getFwdTableIndex(address);
   auto port = get_port(conf.getPort());
 
   pod p{
@@ -549,8 +975,7 @@ void K8switch::replaceFwdTable(const std::string &address,
 void K8switch::delFwdTable(const std::string &address) {
   logger()->debug("Remove the FWD table entry for address {0}", address);
 
-  uint32_t ip_key =
-      FwdTable::get_index(address);  // takes last part of the IP address
+  uint32_t ip_key = getFwdTableIndex(address);
 
   // fwd_table is implemented as an array, deleting means writing 0s
   auto fwd_table = get_array_table<pod>("fwd_table");
@@ -24,37 +24,16 @@
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <map>
+#include <set>
+
+#include "ClusterIpRange.h"
 #include "Ports.h"
 #include "Service.h"
+#include "SessionTable.h"
 #include "hash_tuple.h"
 
-/* definitions copied from dataplane */
-struct cb_control {
-  uint16_t reader;
-  uint16_t writer;
-  uint32_t size;
-} __attribute__((packed));
-
-struct nodeport_session_in {
-  uint32_t ip_src;
-  uint32_t ip_dst;
-  uint16_t port_src;
-  uint16_t port_dst;
-  uint16_t proto;
-  uint64_t timestamp;
-} __attribute__((packed));
-
-struct nodeport_session_out {
-  uint64_t mac_dst;  // : 48;
-  uint64_t mac_src;  // : 48;
-  uint32_t ip_src;
-  uint32_t ip_dst;
-  uint16_t port_src;
-  uint16_t port_dst;
-  uint16_t proto;
-  uint64_t timestamp;
-} __attribute__((packed));
-
 using namespace io::swagger::server::model;
 using polycube::service::CubeType;
 
@@ -62,6 +41,7 @@ class K8switch : public polycube::service::Cube<Ports>,
                  public K8switchInterface {
   friend class Ports;
   friend class Service;
+  friend class SessionTable;
 
  public:
   K8switch(const std::string name, const K8switchJsonObject &conf);
@@ -97,6 +77,21 @@ class K8switch : public polycube::service::Cube<Ports>,
   void setClusterIpSubnet(const std::string &value) override;
   void doSetClusterIpSubnet(const std::string &value);
 
+  /// <summary>
+  /// Additional ranges of VIPs where clusterIP services are exposed
+  /// </summary>
+  std::shared_ptr<ClusterIpRange> getClusterIpRange(
+      const std::string &subnet) override;
+  std::vector<std::shared_ptr<ClusterIpRange>> getClusterIpRangeList() override;
+  void addClusterIpRange(const std::string &subnet,
+                         const ClusterIpRangeJsonObject &conf) override;
+  void addClusterIpRangeList(
+      const std::vector<ClusterIpRangeJsonObject> &conf) override;
+  void replaceClusterIpRange(const std::string &subnet,
+                             const ClusterIpRangeJsonObject &conf) override;
+  void delClusterIpRange(const std::string &subnet) override;
+  void delClusterIpRangeList() override;
+
   /// <summary>
   /// Range of IPs of pods in this node
   /// </summary>
@@ -136,19 +131,73 @@ class K8switch : public polycube::service::Cube<Ports>,
   void delFwdTable(const std::string &address) override;
   void delFwdTableList() override;
 
+  /// <summary>
+  /// Table of the sessions of NodePort services
+  /// </summary>
+  std::shared_ptr<SessionTable> getSessionTable() override;
+  void addSessionTable(const SessionTableJsonObject &value) override;
+  void replaceSessionTable(const SessionTableJsonObject &conf) override;
+  void delSessionTable() override;
+
+  /// <summary>
+  /// Maximum number of entries of the services table (can be set only at
+  /// creation)
+  /// </summary>
+  uint32_t getServicesTableSize() override;
+
+  /// <summary>
+  /// Maximum number of entries of the forwarding table (can be set only at
+  /// creation)
+  /// </summary>
+  uint32_t getFwdTableSize() override;
+
   void reloadConfig();
   std::shared_ptr<Ports> getNodePortPort();
 
+  // true if the address belongs to the clusterIP subnet or to one of the ranges
+  bool isClusterIp(const std::string &ip);
+
+  // reads all the entries of the NodePort session table
+  std::vector<std::pair<nodeport_session_key, nodeport_session>>
+  getSessionEntries();
+  // value of a NodePort counter of the datapath, summed over all the cpus
+  uint64_t getNodePortStat(uint32_t index);
+  // number of ports in the free ports buffers of all the cpus
+  uint32_t getFreePorts();
+
  private:
+  void initFreePorts();
+  void returnFreePorts(const std::vector<uint16_t> &ports);
   void cleanupSessionTable();
+  static uint16_t sessionPort(const nodeport_session_key &key,
+                              const nodeport_session &value);
   uint32_t timestampToAge(const uint64_t timestamp);
   void tick();
   std::string getFlags();
+  void writeClusterIpSubnet(const std::string &cidr, bool add);
+  uint32_t getFwdTableIndex(const std::string &address);
 
   std::unique_ptr<std::thread> tick_thread;
   bool stop_;
 
-  const uint32_t sessionTableTimeout = 300;
+  uint32_t services_table_size_;
+  uint32_t fwd_table_size_;
+
+  uint32_t session_table_size_;
+  uint32_t session_table_timeout_;
+  std::shared_ptr<SessionTable> session_table_;
+
+  // sessions removed by the cleanup because expired or evicted by the lru map
+  std::atomic<uint64_t> sessions_expired_;
+  std::atomic<uint64_t> sessions_evicted_;
+
+  // copy of the free ports buffers, used to know which ports are free without
+  // reading the whole buffers from the datapath
+  std::vector<std::vector<uint16_t>> free_ports_;
+  uint16_t first_port_;
+  uint16_t last_port_;
+  // ports not found by the last cleanup, neither free nor used by a session
+  std::set<uint16_t> missing_ports_;
 
   uint32_t ip_to_dec(const std::string &ip);
   void parse_cidr(const std::string &cidr, uint32_t *subnet, uint32_t *netmask);
@@ -168,6 +217,9 @@ class K8switch : public polycube::service::Cube<Ports>,
   uint32_t cluster_ip_subnet_;
   uint32_t cluster_ip_mask_;
 
+  // additional clusterIP ranges, subnet and mask for each cidr
+  std::map<std::string, std::pair<uint32_t, uint32_t>> cluster_ip_ranges_;
+
   unsigned int ncpus;
   unsigned int buf_size;
 };
@@ -20,8 +20,28 @@
 #include <uapi/linux/tcp.h>
 #include <uapi/linux/udp.h>
 
+#ifndef SERVICES_MAP_DIM
 #define SERVICES_MAP_DIM 65536
+#endif
+
+#ifndef FWD_TABLE_DIM
+#define FWD_TABLE_DIM 256
+#endif
+
+#define CLUSTER_IP_RANGES_DIM 64
+
+#ifndef NODEPORT_SESSION_DIM
 #define NODEPORT_SESSION_DIM 65536
+#endif
+
+#ifndef NODEPORT_SESSION_TIMEOUT
+#define NODEPORT_SESSION_TIMEOUT 300  // seconds
+#endif
+
+#define NS_PER_SEC 1000000000ULL
+
+#define FREE_PORTS_BUFFER_SIZE 65536
+#define MAX_CPUS 1024
 
 #define IP_CSUM_OFFSET (sizeof(struct eth_hdr) + offsetof(struct iphdr, check))
 #define TCP_CSUM_OFFSET                            \
@@ -48,14 +68,20 @@
 #define VIRTUAL_CLIENT_SUBNET 0UL
 #endif
 
-#ifndef CLUSTER_IP_SUBNET
-#define CLUSTER_IP_SUBNET bpf_htonl(0x0a600000UL)  // 10.96.0.0/12
-#define CLUSTER_IP_MASK bpf_htonl(0xfff00000UL)    // /12 -> 255.240.0.0
-#endif
-
 #define KUBE_PROXY_FLAG (65535U)
 #define KUBE_PROXY_SERVICE (0x1)
 
+enum {
+  NODEPORT_DIR_IN = 0,
+  NODEPORT_DIR_OUT = 1,
+};
+
+enum {
+  NODEPORT_STATS_CREATED = 0,
+  NODEPORT_STATS_PORT_ALLOC_FAILURES = 1,
+  NODEPORT_STATS_N = 2,
+};
+
 enum {
   CLUSTER_IP_IN = 1,
   NODE_PORT_IN = 2,
@@ -143,6 +169,15 @@ struct backend {
  * where 'pool_size' is 4 for VIP 1.
  */
 
+// ranges of VIPs where clusterIP services are exposed
+struct cluster_ip_subnet_key {
+  u32 prefixlen;
+  __be32 ip;
+} __attribute__((packed));
+
+BPF_F_TABLE("lpm_trie", struct cluster_ip_subnet_key, u8, cluster_ip_subnets,
+            CLUSTER_IP_RANGES_DIM, BPF_F_NO_PREALLOC);
+
 // maps for ClusterIP services
 BPF_TABLE("hash", struct vip, struct backend, services, SERVICES_MAP_DIM);
 
@@ -150,16 +185,28 @@ BPF_TABLE("hash", struct vip, struct backend, services, SERVICES_MAP_DIM);
 BPF_TABLE("hash", struct backend, struct vip, cluster_ip_reverse,
           SERVICES_MAP_DIM);
 
-struct nodeport_session_in {
+/*
+ * Sessions of NodePort services. Each session has two entries:
+ * - NODEPORT_DIR_IN: the key is the session as received from the client,
+ *   the value is the session after the translation (virtual client IP and
+ *   port, backend IP and port);
+ * - NODEPORT_DIR_OUT: the key is the translated session, the value is the
+ *   original one, used to translate the traffic coming back from the backend.
+ * Timestamps are refreshed by the datapath, a session is expired when both
+ * its entries have not been used for NODEPORT_SESSION_TIMEOUT seconds.
+ * The table is lru, so new sessions can always be created, evicting the
+ * oldest ones if needed; the control plane periodically returns the ports
+ * of expired and evicted sessions to the free ports buffers.
+ */
+struct nodeport_session_key {
   __be32 ip_src;
   __be32 ip_dst;
   __be16 port_src;
   __be16 port_dst;
   __be16 proto;
-  u64 timestamp;
 } __attribute__((packed));
 
-struct nodeport_session_out {
+struct nodeport_session {
   __be64 mac_dst;  // : 48;
   __be64 mac_src;  // : 48;
   __be32 ip_src;
@@ -167,12 +214,26 @@ struct nodeport_session_out {
   __be16 port_src;
   __be16 port_dst;
   __be16 proto;
+  u16 dir;
   u64 timestamp;
 } __attribute__((packed));
-BPF_TABLE("hash", struct nodeport_session_in, struct nodeport_session_out,
-          nodeport_session_out, NODEPORT_SESSION_DIM);
-BPF_TABLE("hash", struct nodeport_session_out, struct nodeport_session_in,
-          nodeport_session_in, NODEPORT_SESSION_DIM);
+
+BPF_TABLE("lru_hash", struct nodeport_session_key, struct nodeport_session,
+          nodeport_sessions, 2 * NODEPORT_SESSION_DIM);
+
+// counters of the NodePort sessions, see NODEPORT_STATS_*
+BPF_TABLE("percpu_array", u32, u64, nodeport_stats, NODEPORT_STATS_N);
+
+static __always_inline void nodeport_stats_inc(u32 index) {
+  u64 *value = nodeport_stats.lookup(&index);
+  if (value) {
+    *value += 1;
+  }
+}
+
+static __always_inline bool nodeport_session_expired(u64 timestamp, u64 now) {
+  return now - timestamp > NODEPORT_SESSION_TIMEOUT * NS_PER_SEC;
+}
 
 // Saves IP to MAC assosiation for pods running in the local node
 struct pod {
@@ -180,47 +241,44 @@ struct pod {
   u16 port;
 };
 
-BPF_TABLE("array", u32, struct pod, fwd_table, 256);
-
-// buffer for circular array holding the free ports
-BPF_TABLE("percpu_array", u32, u64, free_ports_buffer, 65536);
+// The key is the host part of the pod IP address (0 is the gateway)
+BPF_TABLE("array", u32, struct pod, fwd_table, FWD_TABLE_DIM);
 
-struct cb_control {
-  u16 reader;
-  u16 writer;
-  u32 size;
-} __attribute__((packed));
-BPF_TABLE("array", u32, struct cb_control, free_ports_cb, 1024);
+/*
+ * Free ports are kept in a circular buffer for each cpu. The control plane
+ * writes the ports in the buffer and then moves the writer position, the
+ * datapath takes a port and moves the reader position. Positions are free
+ * running counters, the slot is position % FREE_PORTS_BUFFER_SIZE.
+ */
+BPF_TABLE("percpu_array", u32, u64, free_ports_buffer, FREE_PORTS_BUFFER_SIZE);
+BPF_TABLE("array", u32, u32, free_ports_reader, MAX_CPUS);
+BPF_TABLE("array", u32, u32, free_ports_writer, MAX_CPUS);
 
 // allocates and returns a free port to create a new session
 static __always_inline __be16 get_free_port(struct CTXTYPE *ctx) {
   u32 cpu_index = bpf_get_smp_processor_id();
-  // pcn_log(ctx, LOG_TRACE, "get port on core %u", cpu_index);
-  struct cb_control *ctrl = free_ports_cb.lookup(&cpu_index);
-  if (!ctrl) {
-    pcn_log(ctx, LOG_ERR, "Ctrl structure not found");
+  u32 *reader = free_ports_reader.lookup(&cpu_index);
+  u32 *writer = free_ports_writer.lookup(&cpu_index);
+  if (!reader || !writer) {
+    pcn_log(ctx, LOG_ERR, "Free ports control structures not found");
     return 0;
   }
 
-  // pcn_log(ctx, LOG_TRACE, "reader: %u, writer: %u, size: %u", ctrl->reader,
-  // ctrl->writer, ctrl->size);
-
-  if (ctrl->reader == ctrl->writer) {
+  if (*reader == *writer) {
     pcn_log(ctx, LOG_ERR, "There are not free ports for this core");
+    nodeport_stats_inc(NODEPORT_STATS_PORT_ALLOC_FAILURES);
     return 0;
   }
 
   // at this point we are sure the buffer is not empty, let's take an element
-  u32 reader = ctrl->reader;
-  ctrl->reader++;
-  ctrl->reader %= ctrl->size;
-
-  u64 *port = free_ports_buffer.lookup(&reader);
+  u32 slot = *reader % FREE_PORTS_BUFFER_SIZE;
+  u64 *port = free_ports_buffer.lookup(&slot);
   if (!port) {
-    pcn_log(ctx, LOG_ERR, "BUG: port not found at position %u", reader);
+    pcn_log(ctx, LOG_ERR, "BUG: port not found at position %u", slot);
     return 0;
   }
 
+  *reader += 1;
   return bpf_htons(*port);
 }
 
@@ -309,8 +367,11 @@ IP:;
     goto DROP;
 
   // Where is the packet going to?
-  if ((ip->daddr & CLUSTER_IP_MASK) ==
-      CLUSTER_IP_SUBNET) {  // a clusterIP service?
+  struct cluster_ip_subnet_key cluster_ip_key = {
+      .prefixlen = 32,
+      .ip = ip->daddr,
+  };
+  if (cluster_ip_subnets.lookup(&cluster_ip_key)) {  // a clusterIP service?
     pcn_log(ctx, LOG_TRACE, "Packet going to a ClusterIP service");
     type = CLUSTER_IP_IN;
   } else if ((ip->daddr & CLIENT_SUBNET_MASK) ==
@@ -438,20 +499,37 @@ IP:;
   }
 
   case NODE_PORT_IN: {
-    // original values of the packet
-    struct nodeport_session_out value = {
-        .mac_dst = eth->dst,
-        .mac_src = eth->src,
+    u64 now = bpf_ktime_get_ns();
+    __be16 new_sport;
+
+    // is there a session entry for this packet?
+    struct nodeport_session_key in_key = {
         .ip_src = ip->saddr,
         .ip_dst = ip->daddr,
         .port_src = *sport,
         .port_dst = *dport,
         .proto = ip_proto,
-        .timestamp = 0LL,
     };
+    struct nodeport_session *session = nodeport_sessions.lookup(&in_key);
+
+    if (session && nodeport_session_expired(session->timestamp, now)) {
+      struct nodeport_session_key out_key = {
+          .ip_src = session->ip_src,
+          .ip_dst = session->ip_dst,
+          .port_src = session->port_src,
+          .port_dst = session->port_dst,
+          .proto = session->proto,
+      };
+      struct nodeport_session *out = nodeport_sessions.lookup(&out_key);
+      if (!out || nodeport_session_expired(out->timestamp, now)) {
+        // the session is expired, the client is starting a new one with the
+        // same source port: it gets a new port, the one of the expired
+        // session is returned to the free ports by the control plane
+        pcn_log(ctx, LOG_TRACE, "Session expired");
+        session = NULL;
+      }
+    }
 
-    // is there a session entry for this packet?
-    struct nodeport_session_in *session = nodeport_session_in.lookup(&value);
     if (!session) {
       // no, try to choose a backend
       bck_value = get_cluster_ip_backend(ctx, ip->saddr, ip->daddr, *sport,
@@ -470,6 +548,25 @@ IP:;
       pcn_log(ctx, LOG_TRACE, "Found backend with ip: %I and port: %P",
               bck_value->ip, bck_value->port);
 
+      // select new source port
+      new_sport = get_free_port(ctx);
+      if (new_sport == 0) {
+        goto DROP;
+      }
+
+      // original values of the packet, used in the reverse direction
+      struct nodeport_session out_value = {
+          .mac_dst = eth->dst,
+          .mac_src = eth->src,
+          .ip_src = ip->saddr,
+          .ip_dst = ip->daddr,
+          .port_src = *sport,
+          .port_dst = *dport,
+          .proto = ip_proto,
+          .dir = NODEPORT_DIR_OUT,
+          .timestamp = now,
+      };
+
       // change destination IP for backend
       l3sum = pcn_csum_diff(&ip->daddr, 4, &bck_value->ip, 4, l3sum);
       ip->daddr = bck_value->ip;
@@ -480,13 +577,9 @@ IP:;
       *dport = bck_value->port;
       l4sum = pcn_csum_diff(&old_port, 4, &new_port, 4, l4sum);
 
-      // select new source port
       old_port = *sport;
-      new_port = get_free_port(ctx);
-      if (new_port == 0) {
-        goto DROP;
-      }
-      *sport = new_port;
+      new_port = new_sport;
+      *sport = new_sport;
       l4sum = pcn_csum_diff(&old_port, 4, &new_port, 4, l4sum);
 
       // rewrite source IP
@@ -494,26 +587,29 @@ IP:;
       ip->saddr = VIRTUAL_CLIENT_SUBNET + bpf_htonl(2UL);
       l3sum = pcn_csum_diff(&old, 4, &ip->saddr, 4, l3sum);
 
-      u64 timestamp = bpf_ktime_get_ns();
-
-      // new values of the packet, will be used in the reverse direction
-      struct nodeport_session_in key = {
+      // new values of the packet
+      struct nodeport_session_key out_key = {
           .ip_src = ip->saddr,
           .ip_dst = ip->daddr,
           .port_src = *sport,
           .port_dst = *dport,
           .proto = ip_proto,
-          .timestamp = 0LL,
+      };
+      struct nodeport_session in_value = {
+          .ip_src = ip->saddr,
+          .ip_dst = ip->daddr,
+          .port_src = *sport,
+          .port_dst = *dport,
+          .proto = ip_proto,
+          .dir = NODEPORT_DIR_IN,
+          .timestamp = now,
       };
 
-      // create incommming entry
-      key.timestamp = timestamp;
-      nodeport_session_in.update(&value, &key);
-
-      // create outgoing entry
-      key.timestamp = 0LL;
-      value.timestamp = timestamp;
-      nodeport_session_out.update(&key, &value);
+      // the outgoing entry is created first, so that the reply of the backend
+      // always finds it
+      nodeport_sessions.update(&out_key, &out_value);
+      nodeport_sessions.update(&in_key, &in_value);
+      nodeport_stats_inc(NODEPORT_STATS_CREATED);
     } else {
       pcn_log(ctx, LOG_TRACE, "Session found");
 
@@ -521,11 +617,9 @@ IP:;
       l3sum = pcn_csum_diff(&ip->daddr, 4, &session->ip_dst, 4, l3sum);
       ip->daddr = session->ip_dst;
 
-      // TODO: get address from session table?
       // rewrite source IP
-      __be32 old = ip->saddr;
-      ip->saddr = VIRTUAL_CLIENT_SUBNET + bpf_htonl(2UL);
-      l3sum = pcn_csum_diff(&old, 4, &ip->saddr, 4, l3sum);
+      l3sum = pcn_csum_diff(&ip->saddr, 4, &session->ip_src, 4, l3sum);
+      ip->saddr = session->ip_src;
 
       // change destination port to backend one
       __be32 old_port = *dport;
@@ -540,7 +634,7 @@ IP:;
       l4sum = pcn_csum_diff(&old_port, 4, &new_port, 4, l4sum);
 
       // update timestamp
-      session->timestamp = bpf_ktime_get_ns();
+      session->timestamp = now;
     }
 
     pcn_log(ctx, LOG_TRACE, "redirected to %I:%P --> %I:%P", ip->saddr, *sport,
@@ -551,23 +645,42 @@ IP:;
   break;
 
   case FROM_NODE_PORT_SERVICE: {
+    u64 now = bpf_ktime_get_ns();
+
     // lookup in session table, notice that source and destination are exchanged
-    struct nodeport_session_in key = {
+    struct nodeport_session_key key = {
         .ip_src = ip->daddr,
         .ip_dst = ip->saddr,
         .port_src = *dport,
         .port_dst = *sport,
         .proto = ip_proto,
-        .timestamp = 0LL,
     };
 
-    struct nodeport_session_out *value = nodeport_session_out.lookup(&key);
-    if (!value) {
+    struct nodeport_session *value = nodeport_sessions.lookup(&key);
+    if (!value || value->dir != NODEPORT_DIR_OUT) {
       pcn_log(ctx, LOG_ERR, "nodeport session lookup failed");
       goto DROP;
     }
 
-    value->timestamp = bpf_ktime_get_ns();
+    if (nodeport_session_expired(value->timestamp, now)) {
+      // the session is still alive if the client has been sending traffic
+      struct nodeport_session_key in_key = {
+          .ip_src = value->ip_src,
+          .ip_dst = value->ip_dst,
+          .port_src = value->port_src,
+          .port_dst = value->port_dst,
+          .proto = value->proto,
+      };
+      struct nodeport_session *in = nodeport_sessions.lookup(&in_key);
+      // the client may have started a new session with another port
+      if (!in || in->port_src != key.port_src ||
+          nodeport_session_expired(in->timestamp, now)) {
+        pcn_log(ctx, LOG_TRACE, "nodeport session expired");
+        goto DROP;
+      }
+    }
+
+    value->timestamp = now;
 
     // rewrite destination IP to real IP of the client
     l3sum = pcn_csum_diff(&ip->daddr, 4, &value->ip_src, 4, l3sum);
@@ -600,7 +713,6 @@ IP:;
 
     return pcn_pkt_redirect(ctx, md, NODEPORT_PORT);
   } break;
-
   default:
     goto DROP;
   }
@@ -38,8 +38,7 @@ Service::Service(K8switch &parent, const ServiceJsonObject &conf)
       kube_proxy_service_(false) {
   vip_ = conf.getVip();
 
-  uint32_t vip_dec_ = parent_.ip_to_dec(vip_);
-  if ((vip_dec_ & parent_.cluster_ip_mask_) == parent_.cluster_ip_subnet_) {
+  if (parent_.isClusterIp(vip_)) {
     type_ = ServiceType::CLUSTER_IP;
   } else {
     type_ = ServiceType::NODE_PORT;
@@ -55,12 +54,6 @@ Service::Service(K8switch &parent, const ServiceJsonObject &conf)
     setName(conf.getName());
   }
 
-  // FIXME: There is another option here instead of creating every backend at
-  // time
-  // We could just add the backend to the matrix map and call the
-  // updateConsistentHashMap
-  // only at the end. In this way it will be called only once.
-  // Now this function is called every time a new backend is added
   addBackendList(conf.getBackend());
 }
 
@@ -134,13 +127,12 @@ void Service::delBackend(const std::string &ip, const uint16_t &port) {
   // Check also if this backend was forcing *other* services to be handled
   // by kube-proxy
 
-  int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
-  int vect_size = bkd_size * BACKEND_REPLICAS;
-  backend_matrix_[key] = getEmptyIntVector(vect_size);
+  backend_matrix_.erase(key);
 
   service_backends_.erase(key);
 
   if (service_backends_.size()) {
+    removeBackendFromReverseMap(key);
     updateKernelServiceMap();
   } else {
     removeServiceFromKernelMap();
@@ -149,6 +141,19 @@ void Service::delBackend(const std::string &ip, const uint16_t &port) {
 
 void Service::addBackend(const std::string &ip, const uint16_t &port,
                          const ServiceBackendJsonObject &conf) {
+  doAddBackend(ip, port, conf);
+
+  if (!kube_proxy_service_) {
+    updateKernelServiceMap();
+  }
+}
+
+/*
+ * Adds the backend without updating the datapath, so that many backends can
+ * be added with a single update of the services map
+ */
+void Service::doAddBackend(const std::string &ip, const uint16_t &port,
+                           const ServiceBackendJsonObject &conf) {
   auto key = ServiceBackend::Key(ip, port);
   logger()->debug("{}:{}/{} Creating backend {}:{}", getVip(), getVport(),
                   ServiceJsonObject::ServiceProtoEnum_to_string(getProto()), ip,
@@ -207,8 +212,6 @@ void Service::addBackend(const std::string &ip, const uint16_t &port,
   int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
   int vect_size = bkd_size * BACKEND_REPLICAS;
   backend_matrix_[key] = getRandomIntVector(vect_size);
-
-  updateKernelServiceMap();
 }
 
 void Service::addBackendList(
@@ -216,7 +219,11 @@ void Service::addBackendList(
   for (auto &i : conf) {
     std::string ip_ = i.getIp();
     uint16_t port_ = i.getPort();
-    addBackend(ip_, port_, i);
+    doAddBackend(ip_, port_, i);
+  }
+
+  if (!kube_proxy_service_ && service_backends_.size()) {
+    updateKernelServiceMap();
   }
 }
 
@@ -255,45 +262,65 @@ void Service::replaceBackend(const std::string &ip, const uint16_t &port,
   throw std::runtime_error("Not implemented");
 }
 
+/*
+ * Key of the entry 'index' of this service in the datapath services map
+ */
+vip Service::getKernelKey(uint16_t index) {
+  vip key{
+      .ip = utils::ip_string_to_nbo_uint(getVip()),
+      .port = htons(getVport()),
+      .proto = htons(Service::convertProtoToNumber(getProto())),
+      .index = index,
+  };
+
+  return key;
+}
+
+backend Service::getKernelBackend(const ServiceBackend::Key &key) {
+  backend value{
+      .ip = utils::ip_string_to_nbo_uint(key.first),
+      .port = htons(key.second),
+      .proto = htons(Service::convertProtoToNumber(getProto())),
+  };
+
+  return value;
+}
+
 /*
  * This method removes all entries for a service in the datapath map
  */
 
 void Service::removeServiceFromKernelMap() {
-  if (service_backends_.size() == 0)
+  if (kernel_backends_.empty() && !kube_proxy_service_)
     return;
 
   logger()->trace("Removing all elements from service map");
-  auto services_table = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
 
-  for (uint16_t index = 0; index < backend_size_ * BACKEND_REPLICAS; index++) {
-    vip key{
-        .ip = utils::ip_string_to_nbo_uint(getVip()),
-        .port = htons(getVport()),
-        .proto = htons(Service::convertProtoToNumber(getProto())),
-        .index = index,
-    };
-
-    services_table.remove(key);
-
-    // logger()->trace("Remove service map with key: {0}", service_key);
+  std::vector<vip> keys;
+  for (uint16_t index = 0; index <= kernel_backends_.size(); index++) {
+    keys.push_back(getKernelKey(index));
   }
+  removeKernelEntries(EBPF_SERVICE_MAP, keys);
+  kernel_backends_.clear();
 
   // Remove elements in reverse lookup table if service is cluster IP
-  if (type_ == ServiceType::CLUSTER_IP) {
-    auto reverse_map =
-        parent_.get_hash_table<backend, vip>(EBPF_BACKEND_TO_SERVICE_MAP);
-    for (auto &bck : service_backends_) {
-      backend key{
-          .ip = utils::ip_string_to_nbo_uint(bck.second.getIp()),
-          .port = htons(bck.second.getPort()),
-          .proto = htons(Service::convertProtoToNumber(getProto())),
-      };
-      try {
-        reverse_map.remove(key);
-      } catch (...) {
-      }
-    }
+  std::vector<backend> reverse_keys;
+  for (auto &bck : kernel_reverse_) {
+    reverse_keys.push_back(getKernelBackend(bck));
+  }
+  removeKernelEntries(EBPF_BACKEND_TO_SERVICE_MAP, reverse_keys);
+  kernel_reverse_.clear();
+}
+
+void Service::removeBackendFromReverseMap(const ServiceBackend::Key &key) {
+  if (kernel_reverse_.erase(key) == 0)
+    return;
+
+  auto reverse_map =
+      parent_.get_hash_table<backend, vip>(EBPF_BACKEND_TO_SERVICE_MAP);
+  try {
+    reverse_map.remove(getKernelBackend(key));
+  } catch (...) {
   }
 }
 
@@ -303,65 +330,120 @@ void Service::removeServiceFromKernelMap() {
  * The map has :
  * 	-key = struct vip: {ip, port, proto, index}
  * 	-value = struct backend: {ip, port}
+ * Only the entries that changed since the last update are written, with a
+ * single batch operation. The pool size (index 0) is written after the new
+ * entries when the pool grows and before removing the old ones when it
+ * shrinks, so the datapath never selects an entry that does not exist.
  */
 
 void Service::updateKernelServiceMap() {
   auto consistent_array = getConsistentArray();
-  auto services_map = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
-  auto reverse_map =
-      parent_.get_hash_table<backend, vip>(EBPF_BACKEND_TO_SERVICE_MAP);
+
+  std::vector<vip> keys;
+  std::vector<backend> values;
 
   uint16_t index = 0;
+  for (const auto &key : consistent_array) {
+    index++;
 
-  vip key{
-      .ip = utils::ip_string_to_nbo_uint(getVip()),
-      .port = htons(getVport()),
-      .proto = htons(Service::convertProtoToNumber(getProto())),
-      .index = index,
-  };
+    if (service_backends_.count(key) == 0) {
+      throw std::runtime_error("Unable to build the backend pool");
+    }
+
+    if (index <= kernel_backends_.size() &&
+        kernel_backends_[index - 1] == key) {
+      continue;
+    }
+
+    keys.push_back(getKernelKey(index));
+    values.push_back(getKernelBackend(key));
+  }
 
   // This is a particular value that is used to indicate the size of the backend
   // pool.
   // In doesn't indicate a real backend
-  backend value{
+  backend pool_size{
       .ip = utils::ip_string_to_nbo_uint(getVip()),
-      .port = uint8_t(consistent_array.size()),
+      .port = uint16_t(consistent_array.size()),
       .proto = 0,
   };
-  // logger()->trace("Setting Service map with key: {0} and value: {1}",
-  //                service_key, service_value);
 
-  services_map.set(key, value);
+  bool shrinking = consistent_array.size() < kernel_backends_.size();
+  bool resized = consistent_array.size() != kernel_backends_.size();
 
-  for (const auto &key : consistent_array) {
-    index++;
+  if (shrinking) {
+    auto services_map = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
+    services_map.set(getKernelKey(0), pool_size);
+  }
+
+  updateKernelEntries(EBPF_SERVICE_MAP, keys, values);
+
+  if (shrinking) {
+    std::vector<vip> old_keys;
+    for (uint16_t i = consistent_array.size() + 1; i <= kernel_backends_.size();
+         i++) {
+      old_keys.push_back(getKernelKey(i));
+    }
+    removeKernelEntries(EBPF_SERVICE_MAP, old_keys);
+  } else if (resized) {
+    auto services_map = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
+    services_map.set(getKernelKey(0), pool_size);
+  }
+
+  kernel_backends_ = consistent_array;
+
+  if (type_ == ServiceType::CLUSTER_IP) {
+    std::vector<backend> reverse_keys;
+    std::vector<vip> reverse_values;
+    for (auto &bck : service_backends_) {
+      if (kernel_reverse_.count(bck.first)) {
+        continue;
+      }
+      reverse_keys.push_back(getKernelBackend(bck.first));
+      reverse_values.push_back(getKernelKey(0));
+      kernel_reverse_.insert(bck.first);
+    }
+    updateKernelEntries(EBPF_BACKEND_TO_SERVICE_MAP, reverse_keys,
+                        reverse_values);
+  }
 
-    // TODO: porttt
-    // auto backend = ServiceBackend::getEntry(*this, backend_ip, 8080);
-    auto &bck = service_backends_.at(key);
-
-    vip backend_key{
-        .ip = utils::ip_string_to_nbo_uint(getVip()),
-        .port = htons(getVport()),
-        .proto = htons(Service::convertProtoToNumber(getProto())),
-        .index = index,
-    };
-
-    backend backend_value{
-        .ip = utils::ip_string_to_nbo_uint(bck.getIp()),
-        .port = htons(bck.getPort()),
-        .proto = htons(Service::convertProtoToNumber(getProto())),
-    };
-
-    services_map.set(backend_key, backend_value);
-    if (type_ == ServiceType::CLUSTER_IP) {
-      reverse_map.set(backend_value, backend_key);
+  logger()->debug("Service map updated ({} entries written)", keys.size());
+}
+
+template <typename K, typename V>
+void Service::updateKernelEntries(const std::string &map, std::vector<K> &keys,
+                                  std::vector<V> &values) {
+  if (keys.empty())
+    return;
+
+  unsigned int count = keys.size();
+  if (parent_.get_raw_table(map).update_batch(keys.data(), values.data(),
+                                              &count) != 0) {
+    // batch operations are not supported (older kernels)
+    auto table = parent_.get_hash_table<K, V>(map);
+    for (size_t i = 0; i < keys.size(); i++) {
+      table.set(keys[i], values[i]);
     }
-    // logger()->trace("{2} Setting Service map with key: {0} and value: {1}",
-    //  backend_key, backend_value,index);
   }
+}
+
+template <typename K>
+void Service::removeKernelEntries(const std::string &map,
+                                  std::vector<K> &keys) {
+  if (keys.empty())
+    return;
 
-  logger()->debug("Service map updated");
+  unsigned int count = keys.size();
+  if (parent_.get_raw_table(map).remove_batch(keys.data(), &count) != 0) {
+    // batch operations are not supported or some keys were not found
+    auto table = parent_.get_raw_table(map);
+    for (auto &key : keys) {
+      try {
+        table.remove(&key);
+      } catch (...) {
+      }
+    }
+  }
 }
 
 /*
@@ -373,6 +455,20 @@ std::vector<ServiceBackend::Key> Service::getConsistentArray() {
   int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
   int array_rows = bkd_size * BACKEND_REPLICAS;
 
+  // the array grows with the number of backends, the rows of the backends
+  // created when it was smaller are extended with a random permutation of
+  // the new entries, so that the entries they already have are kept
+  for (auto &s : backend_matrix_) {
+    int old_size = s.second.size();
+    if (old_size >= array_rows) {
+      continue;
+    }
+    auto tail = getRandomIntVector(array_rows - old_size);
+    for (auto &i : tail) {
+      s.second.push_back(old_size + i);
+    }
+  }
+
   for (const auto &s : backend_matrix_) {
     backend_list.push_back(s.first);
     backend_matrix_list.push_back(s.second);
@@ -518,13 +614,6 @@ std::map<ServiceBackend::Key, int> Service::getWeightBackend() {
   return weight_back_pool;
 }
 
-std::vector<int> Service::getEmptyIntVector(int vect_size) {
-  // Initialize the entire vector with the value -2
-  std::vector<int> final_vect(vect_size, -2);
-
-  return final_vect;
-}
-
 std::vector<int> Service::getRandomIntVector(int vect_size) {
   std::vector<int> final_vect(vect_size);
   // Fill the vector with number starting from 0 to vect_size
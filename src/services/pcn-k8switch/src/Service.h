@@ -18,6 +18,7 @@
 #include "../interface/ServiceInterface.h"
 
 #include <spdlog/spdlog.h>
+#include <set>
 #include "ServiceBackend.h"
 
 class K8switch;
@@ -102,6 +103,11 @@ class Service : public ServiceInterface {
   std::map<ServiceBackend::Key, ServiceBackend> service_backends_;
   std::map<ServiceBackend::Key, std::vector<int>> backend_matrix_;
 
+  // backend of each entry of the service currently in the datapath (entry 1
+  // is the first element) and backends in the reverse map
+  std::vector<ServiceBackend::Key> kernel_backends_;
+  std::set<ServiceBackend::Key> kernel_reverse_;
+
   static const uint INITIAL_BACKEND_SIZE;
   static const uint BACKEND_REPLICAS;
   static const std::string EBPF_SERVICE_MAP;
@@ -125,13 +131,24 @@ class Service : public ServiceInterface {
   */
   bool kube_proxy_service_;
 
+  void doAddBackend(const std::string &ip, const uint16_t &port,
+                    const ServiceBackendJsonObject &conf);
+
   void updateKernelServiceMap();
   void removeServiceFromKernelMap();
+  void removeBackendFromReverseMap(const ServiceBackend::Key &key);
   void insertAsKubeProxyService();
 
+  vip getKernelKey(uint16_t index);
+  backend getKernelBackend(const ServiceBackend::Key &key);
+  template <typename K, typename V>
+  void updateKernelEntries(const std::string &map, std::vector<K> &keys,
+                           std::vector<V> &values);
+  template <typename K>
+  void removeKernelEntries(const std::string &map, std::vector<K> &keys);
+
   std::vector<ServiceBackend::Key> getConsistentArray();
   std::map<ServiceBackend::Key, int> getWeightBackend();
 
   std::vector<int> getRandomIntVector(int vect_size);
-  std::vector<int> getEmptyIntVector(int vect_size);
 };
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "SessionTable.h"
+#include "K8switch.h"
+
+using namespace polycube::service;
+
+SessionTable::SessionTable(K8switch &parent, const SessionTableJsonObject &conf)
+    : parent_(parent) {
+  update(conf);
+}
+
+SessionTable::~SessionTable() {}
+
+void SessionTable::update(const SessionTableJsonObject &conf) {
+  // This method updates all the object/parameter in SessionTable object
+  // specified in the conf JsonObject.
+  // You can modify this implementation.
+  if (conf.sizeIsSet()) {
+    setSize(conf.getSize());
+  }
+  if (conf.timeoutIsSet()) {
+    setTimeout(conf.getTimeout());
+  }
+}
+
+SessionTableJsonObject SessionTable::toJsonObject() {
+  SessionTableJsonObject conf;
+
+  conf.setSize(getSize());
+  conf.setTimeout(getTimeout());
+
+  // the session table is read only once for both values
+  uint64_t entries = getEntries();
+  conf.setActive(entries / 2);
+  conf.setOccupancy(entriesToOccupancy(entries));
+
+  conf.setCreated(getCreated());
+  conf.setExpired(getExpired());
+  conf.setEvicted(getEvicted());
+  conf.setFreePorts(getFreePorts());
+  conf.setPortAllocationFailures(getPortAllocationFailures());
+
+  return conf;
+}
+
+uint32_t SessionTable::getSize() {
+  return parent_.session_table_size_;
+}
+
+void SessionTable::setSize(const uint32_t &value) {
+  // the size of the datapath map is fixed when the code is loaded
+  if (value != parent_.session_table_size_) {
+    throw std::runtime_error(
+        "The session table size can be set only at creation");
+  }
+}
+
+uint32_t SessionTable::getTimeout() {
+  return parent_.session_table_timeout_;
+}
+
+void SessionTable::setTimeout(const uint32_t &value) {
+  // the timeout is also used by the datapath, it is fixed at creation
+  if (value != parent_.session_table_timeout_) {
+    throw std::runtime_error(
+        "The session table timeout can be set only at creation");
+  }
+}
+
+uint64_t SessionTable::getActive() {
+  return getEntries() / 2;
+}
+
+uint8_t SessionTable::getOccupancy() {
+  return entriesToOccupancy(getEntries());
+}
+
+uint64_t SessionTable::getCreated() {
+  return parent_.getNodePortStat(NODEPORT_STATS_CREATED);
+}
+
+uint64_t SessionTable::getExpired() {
+  // expired sessions are only removed by the cleanup
+  return parent_.sessions_expired_;
+}
+
+uint64_t SessionTable::getEvicted() {
+  return parent_.sessions_evicted_;
+}
+
+uint32_t SessionTable::getFreePorts() {
+  return parent_.getFreePorts();
+}
+
+uint64_t SessionTable::getPortAllocationFailures() {
+  return parent_.getNodePortStat(NODEPORT_STATS_PORT_ALLOC_FAILURES);
+}
+
+uint64_t SessionTable::getEntries() {
+  return parent_.getSessionEntries().size();
+}
+
+uint8_t SessionTable::entriesToOccupancy(uint64_t entries) {
+  uint64_t capacity = 2 * (uint64_t)parent_.session_table_size_;
+  return entries >= capacity ? 100 : entries * 100 / capacity;
+}
+
+std::shared_ptr<spdlog::logger> SessionTable::logger() {
+  return parent_.logger();
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/SessionTableInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class K8switch;
+
+using namespace io::swagger::server::model;
+
+/* definitions copied from datapath */
+enum {
+  NODEPORT_DIR_IN = 0,
+  NODEPORT_DIR_OUT = 1,
+};
+
+enum {
+  NODEPORT_STATS_CREATED = 0,
+  NODEPORT_STATS_PORT_ALLOC_FAILURES = 1,
+};
+
+struct nodeport_session_key {
+  uint32_t ip_src;
+  uint32_t ip_dst;
+  uint16_t port_src;
+  uint16_t port_dst;
+  uint16_t proto;
+} __attribute__((packed));
+
+struct nodeport_session {
+  uint64_t mac_dst;  // : 48;
+  uint64_t mac_src;  // : 48;
+  uint32_t ip_src;
+  uint32_t ip_dst;
+  uint16_t port_src;
+  uint16_t port_dst;
+  uint16_t proto;
+  uint16_t dir;
+  uint64_t timestamp;
+} __attribute__((packed));
+
+class SessionTable : public SessionTableInterface {
+ public:
+  SessionTable(K8switch &parent, const SessionTableJsonObject &conf);
+  virtual ~SessionTable();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const SessionTableJsonObject &conf) override;
+  SessionTableJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Maximum number of NodePort sessions (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() override;
+  void setSize(const uint32_t &value) override;
+
+  /// <summary>
+  /// Seconds after which an idle session expires (can be set only at creation)
+  /// </summary>
+  uint32_t getTimeout() override;
+  void setTimeout(const uint32_t &value) override;
+
+  /// <summary>
+  /// Number of NodePort sessions currently in the session table
+  /// </summary>
+  uint64_t getActive() override;
+
+  /// <summary>
+  /// Percentage of the session table in use
+  /// </summary>
+  uint8_t getOccupancy() override;
+
+  /// <summary>
+  /// Number of NodePort sessions created
+  /// </summary>
+  uint64_t getCreated() override;
+
+  /// <summary>
+  /// Number of sessions removed because they were idle for longer than the
+  /// timeout
+  /// </summary>
+  uint64_t getExpired() override;
+
+  /// <summary>
+  /// Number of sessions lost because the session table was full
+  /// </summary>
+  uint64_t getEvicted() override;
+
+  /// <summary>
+  /// Number of source ports available for new sessions
+  /// </summary>
+  uint32_t getFreePorts() override;
+
+  /// <summary>
+  /// Number of new sessions dropped because no source port was available
+  /// </summary>
+  uint64_t getPortAllocationFailures() override;
+
+ private:
+  // number of entries in the datapath map, each session uses two of them
+  uint64_t getEntries();
+  uint8_t entriesToOccupancy(uint64_t entries);
+
+  K8switch &parent_;
+};
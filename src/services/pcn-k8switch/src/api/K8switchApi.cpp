@@ -43,6 +43,58 @@ Response create_k8switch_by_id_handler(
   }
 }
 
+Response create_k8switch_cluster_ip_range_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_subnet;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "subnet")) {
+      unique_subnet = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ClusterIpRangeJsonObject unique_value { request_body };
+
+    unique_value.setSubnet(unique_subnet);
+    create_k8switch_cluster_ip_range_by_id(unique_name, unique_subnet, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_k8switch_cluster_ip_range_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ClusterIpRangeJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ClusterIpRangeJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ClusterIpRangeJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    create_k8switch_cluster_ip_range_list_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response create_k8switch_fwd_table_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -329,6 +381,25 @@ Response create_k8switch_service_list_by_id_handler(
   }
 }
 
+Response create_k8switch_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    create_k8switch_session_table_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_k8switch_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -343,6 +414,42 @@ Response delete_k8switch_by_id_handler(
   }
 }
 
+Response delete_k8switch_cluster_ip_range_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_subnet;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "subnet")) {
+      unique_subnet = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+    delete_k8switch_cluster_ip_range_by_id(unique_name, unique_subnet);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response delete_k8switch_cluster_ip_range_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_k8switch_cluster_ip_range_list_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_k8switch_fwd_table_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -562,6 +669,20 @@ Response delete_k8switch_service_list_by_id_handler(
   }
 }
 
+Response delete_k8switch_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_k8switch_session_table_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8switch_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -596,6 +717,50 @@ Response read_k8switch_client_subnet_by_id_handler(
   }
 }
 
+Response read_k8switch_cluster_ip_range_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_subnet;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "subnet")) {
+      unique_subnet = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_k8switch_cluster_ip_range_by_id(unique_name, unique_subnet);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_cluster_ip_range_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_cluster_ip_range_list_by_id(unique_name);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8switch_cluster_ip_subnet_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -707,6 +872,23 @@ Response read_k8switch_fwd_table_port_by_id_handler(
   }
 }
 
+Response read_k8switch_fwd_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_fwd_table_size_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8switch_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -1115,6 +1297,193 @@ Response read_k8switch_service_name_by_id_handler(
   }
 }
 
+Response read_k8switch_services_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_services_table_size_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_active_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_active_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_created_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_created_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_evicted_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_evicted_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_expired_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_expired_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_free_ports_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_free_ports_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_occupancy_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_occupancy_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_port_allocation_failures_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_port_allocation_failures_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_size_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_k8switch_session_table_timeout_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_k8switch_session_table_timeout_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_k8switch_virtual_client_subnet_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -1152,6 +1521,58 @@ Response replace_k8switch_by_id_handler(
   }
 }
 
+Response replace_k8switch_cluster_ip_range_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_subnet;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "subnet")) {
+      unique_subnet = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ClusterIpRangeJsonObject unique_value { request_body };
+
+    unique_value.setSubnet(unique_subnet);
+    replace_k8switch_cluster_ip_range_by_id(unique_name, unique_subnet, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_k8switch_cluster_ip_range_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ClusterIpRangeJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ClusterIpRangeJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ClusterIpRangeJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    replace_k8switch_cluster_ip_range_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response replace_k8switch_fwd_table_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1438,6 +1859,25 @@ Response replace_k8switch_service_list_by_id_handler(
   }
 }
 
+Response replace_k8switch_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    replace_k8switch_session_table_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_k8switch_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1476,6 +1916,58 @@ Response update_k8switch_client_subnet_by_id_handler(
   }
 }
 
+Response update_k8switch_cluster_ip_range_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_subnet;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "subnet")) {
+      unique_subnet = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ClusterIpRangeJsonObject unique_value { request_body };
+
+    unique_value.setSubnet(unique_subnet);
+    update_k8switch_cluster_ip_range_by_id(unique_name, unique_subnet, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_k8switch_cluster_ip_range_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ClusterIpRangeJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ClusterIpRangeJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ClusterIpRangeJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    update_k8switch_cluster_ip_range_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_k8switch_cluster_ip_subnet_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -2017,6 +2509,61 @@ Response update_k8switch_service_name_by_id_handler(
   }
 }
 
+Response update_k8switch_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    update_k8switch_session_table_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_k8switch_session_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_k8switch_session_table_size_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_k8switch_session_table_timeout_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_k8switch_session_table_timeout_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_k8switch_virtual_client_subnet_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -2036,6 +2583,15 @@ Response update_k8switch_virtual_client_subnet_by_id_handler(
 }
 
 
+Response k8switch_cluster_ip_range_list_by_id_help(
+  const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name { name };
+  nlohmann::json val = read_k8switch_cluster_ip_range_list_by_id_get_list(unique_name);
+
+  return { kOk, ::strdup(val.dump().c_str()) };
+}
+
 Response k8switch_fwd_table_list_by_id_help(
   const char *name, const Key *keys, size_t num_keys) {
   // Getting the path params
@@ -25,11 +25,13 @@
 #include "polycube/services/response.h"
 #include "polycube/services/shared_lib_elements.h"
 
+#include "ClusterIpRangeJsonObject.h"
 #include "FwdTableJsonObject.h"
 #include "K8switchJsonObject.h"
 #include "PortsJsonObject.h"
 #include "ServiceJsonObject.h"
 #include "ServiceBackendJsonObject.h"
+#include "SessionTableJsonObject.h"
 #include <vector>
 
 
@@ -38,6 +40,8 @@ extern "C" {
 #endif
 
 Response create_k8switch_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_k8switch_cluster_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_k8switch_cluster_ip_range_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8switch_fwd_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8switch_fwd_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8switch_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -46,7 +50,10 @@ Response create_k8switch_service_backend_by_id_handler(const char *name, const K
 Response create_k8switch_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8switch_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_k8switch_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_k8switch_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_k8switch_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_k8switch_cluster_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_k8switch_cluster_ip_range_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8switch_fwd_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8switch_fwd_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8switch_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -55,13 +62,17 @@ Response delete_k8switch_service_backend_by_id_handler(const char *name, const K
 Response delete_k8switch_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8switch_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_k8switch_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_k8switch_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_client_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_cluster_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_cluster_ip_range_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_cluster_ip_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_fwd_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_fwd_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_fwd_table_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_fwd_table_port_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_fwd_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -73,8 +84,21 @@ Response read_k8switch_service_backend_weight_by_id_handler(const char *name, co
 Response read_k8switch_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_services_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_active_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_created_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_evicted_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_expired_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_free_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_occupancy_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_port_allocation_failures_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_k8switch_session_table_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_k8switch_virtual_client_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_k8switch_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_k8switch_cluster_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_k8switch_cluster_ip_range_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8switch_fwd_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8switch_fwd_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8switch_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -83,8 +107,11 @@ Response replace_k8switch_service_backend_by_id_handler(const char *name, const
 Response replace_k8switch_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8switch_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_k8switch_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_k8switch_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_client_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8switch_cluster_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8switch_cluster_ip_range_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_cluster_ip_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_fwd_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_fwd_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -100,8 +127,12 @@ Response update_k8switch_service_backend_weight_by_id_handler(const char *name,
 Response update_k8switch_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8switch_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8switch_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_k8switch_session_table_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_k8switch_virtual_client_subnet_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
+Response k8switch_cluster_ip_range_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response k8switch_fwd_table_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response k8switch_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response k8switch_ports_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
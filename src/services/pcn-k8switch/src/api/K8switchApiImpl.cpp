@@ -90,6 +90,42 @@ std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_list_by_
   return r;
 }
 
+/**
+* @brief   Create cluster-ip-range by ID
+*
+* Create operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] subnet ID of subnet
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+create_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value) {
+  auto k8switch = get_cube(name);
+
+  k8switch->addClusterIpRange(subnet, value);
+}
+
+/**
+* @brief   Create cluster-ip-range by ID
+*
+* Create operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+create_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value) {
+  auto k8switch = get_cube(name);
+  k8switch->addClusterIpRangeList(value);
+}
+
 /**
 * @brief   Create fwd-table by ID
 *
@@ -245,6 +281,58 @@ create_k8switch_service_list_by_id(const std::string &name, const std::vector<Se
   k8switch->addServiceList(value);
 }
 
+/**
+* @brief   Create session-table by ID
+*
+* Create operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+create_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto k8switch = get_cube(name);
+
+  k8switch->addSessionTable(value);
+}
+
+/**
+* @brief   Delete cluster-ip-range by ID
+*
+* Delete operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] subnet ID of subnet
+*
+* Responses:
+*
+*/
+void
+delete_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet) {
+  auto k8switch = get_cube(name);
+
+  k8switch->delClusterIpRange(subnet);
+}
+
+/**
+* @brief   Delete cluster-ip-range by ID
+*
+* Delete operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_k8switch_cluster_ip_range_list_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  k8switch->delClusterIpRangeList();
+}
+
 /**
 * @brief   Delete fwd-table by ID
 *
@@ -392,6 +480,23 @@ delete_k8switch_service_list_by_id(const std::string &name) {
   k8switch->delServiceList();
 }
 
+/**
+* @brief   Delete session-table by ID
+*
+* Delete operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_k8switch_session_table_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+
+  k8switch->delSessionTable();
+}
+
 /**
 * @brief   Read k8switch by ID
 *
@@ -425,6 +530,44 @@ read_k8switch_client_subnet_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read cluster-ip-range by ID
+*
+* Read operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] subnet ID of subnet
+*
+* Responses:
+* ClusterIpRangeJsonObject
+*/
+ClusterIpRangeJsonObject
+read_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet) {
+  auto k8switch = get_cube(name);
+  return k8switch->getClusterIpRange(subnet)->toJsonObject();
+
+}
+
+/**
+* @brief   Read cluster-ip-range by ID
+*
+* Read operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::vector<ClusterIpRangeJsonObject>
+*/
+std::vector<ClusterIpRangeJsonObject>
+read_k8switch_cluster_ip_range_list_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto &&clusterIpRange = k8switch->getClusterIpRangeList();
+  std::vector<ClusterIpRangeJsonObject> m;
+  for(auto &i : clusterIpRange)
+    m.push_back(i->toJsonObject());
+  return m;
+}
+
 /**
 * @brief   Read cluster-ip-subnet by ID
 *
@@ -518,6 +661,23 @@ read_k8switch_fwd_table_port_by_id(const std::string &name, const std::string &a
 
 }
 
+/**
+* @brief   Read fwd-table-size by ID
+*
+* Read operation of resource: fwd-table-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8switch_fwd_table_size_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  return k8switch->getFwdTableSize();
+
+}
+
 /**
 * @brief   Read ports by ID
 *
@@ -731,6 +891,202 @@ read_k8switch_service_name_by_id(const std::string &name, const std::string &vip
 
 }
 
+/**
+* @brief   Read services-table-size by ID
+*
+* Read operation of resource: services-table-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8switch_services_table_size_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  return k8switch->getServicesTableSize();
+
+}
+
+/**
+* @brief   Read active by ID
+*
+* Read operation of resource: active*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8switch_session_table_active_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getActive();
+
+}
+
+/**
+* @brief   Read session-table by ID
+*
+* Read operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* SessionTableJsonObject
+*/
+SessionTableJsonObject
+read_k8switch_session_table_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  return k8switch->getSessionTable()->toJsonObject();
+
+}
+
+/**
+* @brief   Read created by ID
+*
+* Read operation of resource: created*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8switch_session_table_created_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getCreated();
+
+}
+
+/**
+* @brief   Read evicted by ID
+*
+* Read operation of resource: evicted*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8switch_session_table_evicted_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getEvicted();
+
+}
+
+/**
+* @brief   Read expired by ID
+*
+* Read operation of resource: expired*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8switch_session_table_expired_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getExpired();
+
+}
+
+/**
+* @brief   Read free-ports by ID
+*
+* Read operation of resource: free-ports*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8switch_session_table_free_ports_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getFreePorts();
+
+}
+
+/**
+* @brief   Read occupancy by ID
+*
+* Read operation of resource: occupancy*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint8_t
+*/
+uint8_t
+read_k8switch_session_table_occupancy_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getOccupancy();
+
+}
+
+/**
+* @brief   Read port-allocation-failures by ID
+*
+* Read operation of resource: port-allocation-failures*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_k8switch_session_table_port_allocation_failures_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getPortAllocationFailures();
+
+}
+
+/**
+* @brief   Read size by ID
+*
+* Read operation of resource: size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8switch_session_table_size_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getSize();
+
+}
+
+/**
+* @brief   Read timeout by ID
+*
+* Read operation of resource: timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_k8switch_session_table_timeout_by_id(const std::string &name) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+  return session_table->getTimeout();
+
+}
+
 /**
 * @brief   Read virtual-client-subnet by ID
 *
@@ -748,6 +1104,41 @@ read_k8switch_virtual_client_subnet_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Replace cluster-ip-range by ID
+*
+* Replace operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] subnet ID of subnet
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+replace_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value) {
+  auto k8switch = get_cube(name);
+
+  k8switch->replaceClusterIpRange(subnet, value);
+}
+
+/**
+* @brief   Replace cluster-ip-range by ID
+*
+* Replace operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+replace_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
 /**
 * @brief   Replace fwd-table by ID
 *
@@ -898,6 +1289,24 @@ replace_k8switch_service_list_by_id(const std::string &name, const std::vector<S
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Replace session-table by ID
+*
+* Replace operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+replace_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto k8switch = get_cube(name);
+
+  k8switch->replaceSessionTable(value);
+}
+
 /**
 * @brief   Update k8switch by ID
 *
@@ -934,6 +1343,42 @@ update_k8switch_client_subnet_by_id(const std::string &name, const std::string &
   k8switch->setClientSubnet(value);
 }
 
+/**
+* @brief   Update cluster-ip-range by ID
+*
+* Update operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] subnet ID of subnet
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+update_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value) {
+  auto k8switch = get_cube(name);
+  auto clusterIpRange = k8switch->getClusterIpRange(subnet);
+
+  clusterIpRange->update(value);
+}
+
+/**
+* @brief   Update cluster-ip-range by ID
+*
+* Update operation of resource: cluster-ip-range*
+*
+* @param[in] name ID of name
+* @param[in] value cluster-ip-rangebody object
+*
+* Responses:
+*
+*/
+void
+update_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
 /**
 * @brief   Update cluster-ip-subnet by ID
 *
@@ -1233,6 +1678,63 @@ update_k8switch_service_name_by_id(const std::string &name, const std::string &v
   service->setName(value);
 }
 
+/**
+* @brief   Update session-table by ID
+*
+* Update operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+update_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+
+  session_table->update(value);
+}
+
+/**
+* @brief   Update size by ID
+*
+* Update operation of resource: size*
+*
+* @param[in] name ID of name
+* @param[in] value Maximum number of NodePort sessions (can be set only at creation)
+*
+* Responses:
+*
+*/
+void
+update_k8switch_session_table_size_by_id(const std::string &name, const uint32_t &value) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+
+  session_table->setSize(value);
+}
+
+/**
+* @brief   Update timeout by ID
+*
+* Update operation of resource: timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Seconds after which an idle session expires (can be set only at creation)
+*
+* Responses:
+*
+*/
+void
+update_k8switch_session_table_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto k8switch = get_cube(name);
+  auto session_table = k8switch->getSessionTable();
+
+  session_table->setTimeout(value);
+}
+
 /**
 * @brief   Update virtual-client-subnet by ID
 *
@@ -1257,6 +1759,21 @@ update_k8switch_virtual_client_subnet_by_id(const std::string &name, const std::
  * help related
  */
 
+std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_cluster_ip_range_list_by_id_get_list(const std::string &name) {
+  std::vector<nlohmann::fifo_map<std::string, std::string>> r;
+  auto &&k8switch = get_cube(name);
+
+  auto &&clusterIpRange = k8switch->getClusterIpRangeList();
+  for(auto &i : clusterIpRange) {
+    nlohmann::fifo_map<std::string, std::string> keys;
+
+    keys["subnet"] = i->getSubnet();
+
+    r.push_back(keys);
+  }
+  return r;
+}
+
 std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_fwd_table_list_by_id_get_list(const std::string &name) {
   std::vector<nlohmann::fifo_map<std::string, std::string>> r;
   auto &&k8switch = get_cube(name);
@@ -26,11 +26,13 @@
 #include <mutex>
 #include "../K8switch.h"
 
+#include "ClusterIpRangeJsonObject.h"
 #include "FwdTableJsonObject.h"
 #include "K8switchJsonObject.h"
 #include "PortsJsonObject.h"
 #include "ServiceJsonObject.h"
 #include "ServiceBackendJsonObject.h"
+#include "SessionTableJsonObject.h"
 #include <vector>
 
 namespace io {
@@ -42,6 +44,8 @@ using namespace io::swagger::server::model;
 
 namespace K8switchApiImpl {
   void create_k8switch_by_id(const std::string &name, const K8switchJsonObject &value);
+  void create_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value);
+  void create_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value);
   void create_k8switch_fwd_table_by_id(const std::string &name, const std::string &address, const FwdTableJsonObject &value);
   void create_k8switch_fwd_table_list_by_id(const std::string &name, const std::vector<FwdTableJsonObject> &value);
   void create_k8switch_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
@@ -50,7 +54,10 @@ namespace K8switchApiImpl {
   void create_k8switch_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
   void create_k8switch_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void create_k8switch_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
+  void create_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
   void delete_k8switch_by_id(const std::string &name);
+  void delete_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet);
+  void delete_k8switch_cluster_ip_range_list_by_id(const std::string &name);
   void delete_k8switch_fwd_table_by_id(const std::string &name, const std::string &address);
   void delete_k8switch_fwd_table_list_by_id(const std::string &name);
   void delete_k8switch_ports_by_id(const std::string &name, const std::string &portsName);
@@ -59,13 +66,17 @@ namespace K8switchApiImpl {
   void delete_k8switch_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   void delete_k8switch_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   void delete_k8switch_service_list_by_id(const std::string &name);
+  void delete_k8switch_session_table_by_id(const std::string &name);
   K8switchJsonObject read_k8switch_by_id(const std::string &name);
   std::string read_k8switch_client_subnet_by_id(const std::string &name);
+  ClusterIpRangeJsonObject read_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet);
+  std::vector<ClusterIpRangeJsonObject> read_k8switch_cluster_ip_range_list_by_id(const std::string &name);
   std::string read_k8switch_cluster_ip_subnet_by_id(const std::string &name);
   FwdTableJsonObject read_k8switch_fwd_table_by_id(const std::string &name, const std::string &address);
   std::vector<FwdTableJsonObject> read_k8switch_fwd_table_list_by_id(const std::string &name);
   std::string read_k8switch_fwd_table_mac_by_id(const std::string &name, const std::string &address);
   std::string read_k8switch_fwd_table_port_by_id(const std::string &name, const std::string &address);
+  uint32_t read_k8switch_fwd_table_size_by_id(const std::string &name);
   std::vector<K8switchJsonObject> read_k8switch_list_by_id();
   PortsJsonObject read_k8switch_ports_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_k8switch_ports_list_by_id(const std::string &name);
@@ -77,8 +88,21 @@ namespace K8switchApiImpl {
   ServiceJsonObject read_k8switch_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   std::vector<ServiceJsonObject> read_k8switch_service_list_by_id(const std::string &name);
   std::string read_k8switch_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  uint32_t read_k8switch_services_table_size_by_id(const std::string &name);
+  uint64_t read_k8switch_session_table_active_by_id(const std::string &name);
+  SessionTableJsonObject read_k8switch_session_table_by_id(const std::string &name);
+  uint64_t read_k8switch_session_table_created_by_id(const std::string &name);
+  uint64_t read_k8switch_session_table_evicted_by_id(const std::string &name);
+  uint64_t read_k8switch_session_table_expired_by_id(const std::string &name);
+  uint32_t read_k8switch_session_table_free_ports_by_id(const std::string &name);
+  uint8_t read_k8switch_session_table_occupancy_by_id(const std::string &name);
+  uint64_t read_k8switch_session_table_port_allocation_failures_by_id(const std::string &name);
+  uint32_t read_k8switch_session_table_size_by_id(const std::string &name);
+  uint32_t read_k8switch_session_table_timeout_by_id(const std::string &name);
   std::string read_k8switch_virtual_client_subnet_by_id(const std::string &name);
   void replace_k8switch_by_id(const std::string &name, const K8switchJsonObject &value);
+  void replace_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value);
+  void replace_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value);
   void replace_k8switch_fwd_table_by_id(const std::string &name, const std::string &address, const FwdTableJsonObject &value);
   void replace_k8switch_fwd_table_list_by_id(const std::string &name, const std::vector<FwdTableJsonObject> &value);
   void replace_k8switch_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
@@ -87,8 +111,11 @@ namespace K8switchApiImpl {
   void replace_k8switch_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
   void replace_k8switch_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void replace_k8switch_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
+  void replace_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
   void update_k8switch_by_id(const std::string &name, const K8switchJsonObject &value);
   void update_k8switch_client_subnet_by_id(const std::string &name, const std::string &value);
+  void update_k8switch_cluster_ip_range_by_id(const std::string &name, const std::string &subnet, const ClusterIpRangeJsonObject &value);
+  void update_k8switch_cluster_ip_range_list_by_id(const std::string &name, const std::vector<ClusterIpRangeJsonObject> &value);
   void update_k8switch_cluster_ip_subnet_by_id(const std::string &name, const std::string &value);
   void update_k8switch_fwd_table_by_id(const std::string &name, const std::string &address, const FwdTableJsonObject &value);
   void update_k8switch_fwd_table_list_by_id(const std::string &name, const std::vector<FwdTableJsonObject> &value);
@@ -104,9 +131,13 @@ namespace K8switchApiImpl {
   void update_k8switch_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void update_k8switch_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
   void update_k8switch_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &value);
+  void update_k8switch_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
+  void update_k8switch_session_table_size_by_id(const std::string &name, const uint32_t &value);
+  void update_k8switch_session_table_timeout_by_id(const std::string &name, const uint32_t &value);
   void update_k8switch_virtual_client_subnet_by_id(const std::string &name, const std::string &value);
 
   /* help related */
+  std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_cluster_ip_range_list_by_id_get_list(const std::string &name);
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_fwd_table_list_by_id_get_list(const std::string &name);
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_list_by_id_get_list();
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_k8switch_ports_list_by_id_get_list(const std::string &name);
@@ -0,0 +1,38 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ClusterIpRangeInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/ClusterIpRangeJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class ClusterIpRangeInterface {
+public:
+
+  virtual void update(const ClusterIpRangeJsonObject &conf) = 0;
+  virtual ClusterIpRangeJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Range of VIPs where clusterIP services are exposed
+  /// </summary>
+  virtual std::string getSubnet() = 0;
+};
@@ -22,9 +22,11 @@
 
 #include "../serializer/K8switchJsonObject.h"
 
+#include "../ClusterIpRange.h"
 #include "../FwdTable.h"
 #include "../Ports.h"
 #include "../Service.h"
+#include "../SessionTable.h"
 
 using namespace io::swagger::server::model;
 
@@ -84,5 +86,34 @@ public:
   virtual void replaceFwdTable(const std::string &address, const FwdTableJsonObject &conf) = 0;
   virtual void delFwdTable(const std::string &address) = 0;
   virtual void delFwdTableList() = 0;
+
+  /// <summary>
+  /// Additional ranges of VIPs where clusterIP services are exposed
+  /// </summary>
+  virtual std::shared_ptr<ClusterIpRange> getClusterIpRange(const std::string &subnet) = 0;
+  virtual std::vector<std::shared_ptr<ClusterIpRange>> getClusterIpRangeList() = 0;
+  virtual void addClusterIpRange(const std::string &subnet, const ClusterIpRangeJsonObject &conf) = 0;
+  virtual void addClusterIpRangeList(const std::vector<ClusterIpRangeJsonObject> &conf) = 0;
+  virtual void replaceClusterIpRange(const std::string &subnet, const ClusterIpRangeJsonObject &conf) = 0;
+  virtual void delClusterIpRange(const std::string &subnet) = 0;
+  virtual void delClusterIpRangeList() = 0;
+
+  /// <summary>
+  /// Table of the sessions of NodePort services
+  /// </summary>
+  virtual std::shared_ptr<SessionTable> getSessionTable() = 0;
+  virtual void addSessionTable(const SessionTableJsonObject &value) = 0;
+  virtual void replaceSessionTable(const SessionTableJsonObject &conf) = 0;
+  virtual void delSessionTable() = 0;
+
+  /// <summary>
+  /// Maximum number of entries of the services table (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getServicesTableSize() = 0;
+
+  /// <summary>
+  /// Maximum number of entries of the forwarding table (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getFwdTableSize() = 0;
 };
 
@@ -0,0 +1,81 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/SessionTableJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class SessionTableInterface {
+public:
+
+  virtual void update(const SessionTableJsonObject &conf) = 0;
+  virtual SessionTableJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Maximum number of NodePort sessions (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getSize() = 0;
+  virtual void setSize(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Seconds after which an idle session expires (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getTimeout() = 0;
+  virtual void setTimeout(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Number of NodePort sessions currently in the session table
+  /// </summary>
+  virtual uint64_t getActive() = 0;
+
+  /// <summary>
+  /// Percentage of the session table in use
+  /// </summary>
+  virtual uint8_t getOccupancy() = 0;
+
+  /// <summary>
+  /// Number of NodePort sessions created
+  /// </summary>
+  virtual uint64_t getCreated() = 0;
+
+  /// <summary>
+  /// Number of sessions removed because they were idle for longer than the timeout
+  /// </summary>
+  virtual uint64_t getExpired() = 0;
+
+  /// <summary>
+  /// Number of sessions lost because the session table was full
+  /// </summary>
+  virtual uint64_t getEvicted() = 0;
+
+  /// <summary>
+  /// Number of source ports available for new sessions
+  /// </summary>
+  virtual uint32_t getFreePorts() = 0;
+
+  /// <summary>
+  /// Number of new sessions dropped because no source port was available
+  /// </summary>
+  virtual uint64_t getPortAllocationFailures() = 0;
+};
+
@@ -0,0 +1,70 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "ClusterIpRangeJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+ClusterIpRangeJsonObject::ClusterIpRangeJsonObject() {
+  m_subnetIsSet = false;
+}
+
+ClusterIpRangeJsonObject::ClusterIpRangeJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_subnetIsSet = false;
+
+
+  if (val.count("subnet")) {
+    setSubnet(val.at("subnet").get<std::string>());
+  }
+}
+
+nlohmann::json ClusterIpRangeJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_subnetIsSet) {
+    val["subnet"] = m_subnet;
+  }
+
+  return val;
+}
+
+std::string ClusterIpRangeJsonObject::getSubnet() const {
+  return m_subnet;
+}
+
+void ClusterIpRangeJsonObject::setSubnet(std::string value) {
+  m_subnet = value;
+  m_subnetIsSet = true;
+}
+
+bool ClusterIpRangeJsonObject::subnetIsSet() const {
+  return m_subnetIsSet;
+}
+
+
+}
+}
+}
+}
+
@@ -0,0 +1,60 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ClusterIpRangeJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  ClusterIpRangeJsonObject : public JsonObjectBase {
+public:
+  ClusterIpRangeJsonObject();
+  ClusterIpRangeJsonObject(const nlohmann::json &json);
+  ~ClusterIpRangeJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Range of VIPs where clusterIP services are exposed
+  /// </summary>
+  std::string getSubnet() const;
+  void setSubnet(std::string value);
+  bool subnetIsSet() const;
+
+private:
+  std::string m_subnet;
+  bool m_subnetIsSet;
+};
+
+}
+}
+}
+}
+
@@ -30,6 +30,12 @@ K8switchJsonObject::K8switchJsonObject() {
   m_virtualClientSubnetIsSet = false;
   m_serviceIsSet = false;
   m_fwdTableIsSet = false;
+  m_clusterIpRangeIsSet = false;
+  m_sessionTableIsSet = false;
+  m_servicesTableSize = 65536;
+  m_servicesTableSizeIsSet = true;
+  m_fwdTableSize = 256;
+  m_fwdTableSizeIsSet = true;
 }
 
 K8switchJsonObject::K8switchJsonObject(const nlohmann::json &val) :
@@ -41,6 +47,10 @@ K8switchJsonObject::K8switchJsonObject(const nlohmann::json &val) :
   m_virtualClientSubnetIsSet = false;
   m_serviceIsSet = false;
   m_fwdTableIsSet = false;
+  m_clusterIpRangeIsSet = false;
+  m_sessionTableIsSet = false;
+  m_servicesTableSizeIsSet = false;
+  m_fwdTableSizeIsSet = false;
 
 
   if (val.count("name")) {
@@ -85,6 +95,30 @@ K8switchJsonObject::K8switchJsonObject(const nlohmann::json &val) :
 
     m_fwdTableIsSet = true;
   }
+
+  if (val.count("cluster-ip-range")) {
+    for (auto& item : val["cluster-ip-range"]) {
+      ClusterIpRangeJsonObject newItem{ item };
+      m_clusterIpRange.push_back(newItem);
+    }
+
+    m_clusterIpRangeIsSet = true;
+  }
+
+  if (val.count("session-table")) {
+    if (!val["session-table"].is_null()) {
+      SessionTableJsonObject newItem { val["session-table"] };
+      setSessionTable(newItem);
+    }
+  }
+
+  if (val.count("services-table-size")) {
+    setServicesTableSize(val.at("services-table-size").get<uint32_t>());
+  }
+
+  if (val.count("fwd-table-size")) {
+    setFwdTableSize(val.at("fwd-table-size").get<uint32_t>());
+  }
 }
 
 nlohmann::json K8switchJsonObject::toJson() const {
@@ -142,6 +176,29 @@ nlohmann::json K8switchJsonObject::toJson() const {
     }
   }
 
+  {
+    nlohmann::json jsonArray;
+    for (auto& item : m_clusterIpRange) {
+      jsonArray.push_back(JsonObjectBase::toJson(item));
+    }
+
+    if (jsonArray.size() > 0) {
+      val["cluster-ip-range"] = jsonArray;
+    }
+  }
+
+  if (m_sessionTableIsSet) {
+    val["session-table"] = JsonObjectBase::toJson(m_sessionTable);
+  }
+
+  if (m_servicesTableSizeIsSet) {
+    val["services-table-size"] = m_servicesTableSize;
+  }
+
+  if (m_fwdTableSizeIsSet) {
+    val["fwd-table-size"] = m_fwdTableSize;
+  }
+
   return val;
 }
 
@@ -259,6 +316,67 @@ void K8switchJsonObject::unsetFwdTable() {
   m_fwdTableIsSet = false;
 }
 
+const std::vector<ClusterIpRangeJsonObject>& K8switchJsonObject::getClusterIpRange() const{
+  return m_clusterIpRange;
+}
+
+void K8switchJsonObject::addClusterIpRange(ClusterIpRangeJsonObject value) {
+  m_clusterIpRange.push_back(value);
+  m_clusterIpRangeIsSet = true;
+}
+
+
+bool K8switchJsonObject::clusterIpRangeIsSet() const {
+  return m_clusterIpRangeIsSet;
+}
+
+void K8switchJsonObject::unsetClusterIpRange() {
+  m_clusterIpRangeIsSet = false;
+}
+
+SessionTableJsonObject K8switchJsonObject::getSessionTable() const {
+  return m_sessionTable;
+}
+
+void K8switchJsonObject::setSessionTable(SessionTableJsonObject value) {
+  m_sessionTable = value;
+  m_sessionTableIsSet = true;
+}
+
+bool K8switchJsonObject::sessionTableIsSet() const {
+  return m_sessionTableIsSet;
+}
+
+void K8switchJsonObject::unsetSessionTable() {
+  m_sessionTableIsSet = false;
+}
+
+uint32_t K8switchJsonObject::getServicesTableSize() const {
+  return m_servicesTableSize;
+}
+
+void K8switchJsonObject::setServicesTableSize(uint32_t value) {
+  m_servicesTableSize = value;
+  m_servicesTableSizeIsSet = true;
+}
+
+bool K8switchJsonObject::servicesTableSizeIsSet() const {
+  return m_servicesTableSizeIsSet;
+}
+
+uint32_t K8switchJsonObject::getFwdTableSize() const {
+  return m_fwdTableSize;
+}
+
+void K8switchJsonObject::setFwdTableSize(uint32_t value) {
+  m_fwdTableSize = value;
+  m_fwdTableSizeIsSet = true;
+}
+
+bool K8switchJsonObject::fwdTableSizeIsSet() const {
+  return m_fwdTableSizeIsSet;
+}
+
 
 }
 }
@@ -26,6 +26,8 @@
 #include "ServiceJsonObject.h"
 #include "PortsJsonObject.h"
 #include "FwdTableJsonObject.h"
+#include "ClusterIpRangeJsonObject.h"
+#include "SessionTableJsonObject.h"
 #include <vector>
 #include "polycube/services/cube.h"
 
@@ -98,6 +100,36 @@ public:
   bool fwdTableIsSet() const;
   void unsetFwdTable();
 
+  /// <summary>
+  /// Additional ranges of VIPs where clusterIP services are exposed
+  /// </summary>
+  const std::vector<ClusterIpRangeJsonObject>& getClusterIpRange() const;
+  void addClusterIpRange(ClusterIpRangeJsonObject value);
+  bool clusterIpRangeIsSet() const;
+  void unsetClusterIpRange();
+
+  /// <summary>
+  /// Table of the sessions of NodePort services
+  /// </summary>
+  SessionTableJsonObject getSessionTable() const;
+  void setSessionTable(SessionTableJsonObject value);
+  bool sessionTableIsSet() const;
+  void unsetSessionTable();
+
+  /// <summary>
+  /// Maximum number of entries of the services table (can be set only at creation)
+  /// </summary>
+  uint32_t getServicesTableSize() const;
+  void setServicesTableSize(uint32_t value);
+  bool servicesTableSizeIsSet() const;
+
+  /// <summary>
+  /// Maximum number of entries of the forwarding table (can be set only at creation)
+  /// </summary>
+  uint32_t getFwdTableSize() const;
+  void setFwdTableSize(uint32_t value);
+  bool fwdTableSizeIsSet() const;
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -113,6 +145,14 @@ private:
   bool m_serviceIsSet;
   std::vector<FwdTableJsonObject> m_fwdTable;
   bool m_fwdTableIsSet;
+  std::vector<ClusterIpRangeJsonObject> m_clusterIpRange;
+  bool m_clusterIpRangeIsSet;
+  SessionTableJsonObject m_sessionTable;
+  bool m_sessionTableIsSet;
+  uint32_t m_servicesTableSize;
+  bool m_servicesTableSizeIsSet;
+  uint32_t m_fwdTableSize;
+  bool m_fwdTableSizeIsSet;
 };
 
 }
@@ -0,0 +1,292 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableJsonObject::SessionTableJsonObject() {
+  m_size = 65536;
+  m_sizeIsSet = true;
+  m_timeout = 300;
+  m_timeoutIsSet = true;
+  m_activeIsSet = false;
+  m_occupancyIsSet = false;
+  m_createdIsSet = false;
+  m_expiredIsSet = false;
+  m_evictedIsSet = false;
+  m_freePortsIsSet = false;
+  m_portAllocationFailuresIsSet = false;
+}
+
+SessionTableJsonObject::SessionTableJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_sizeIsSet = false;
+  m_timeoutIsSet = false;
+  m_activeIsSet = false;
+  m_occupancyIsSet = false;
+  m_createdIsSet = false;
+  m_expiredIsSet = false;
+  m_evictedIsSet = false;
+  m_freePortsIsSet = false;
+  m_portAllocationFailuresIsSet = false;
+
+
+  if (val.count("size")) {
+    setSize(val.at("size").get<uint32_t>());
+  }
+
+  if (val.count("timeout")) {
+    setTimeout(val.at("timeout").get<uint32_t>());
+  }
+
+  if (val.count("active")) {
+    setActive(val.at("active").get<uint64_t>());
+  }
+
+  if (val.count("occupancy")) {
+    setOccupancy(val.at("occupancy").get<uint8_t>());
+  }
+
+  if (val.count("created")) {
+    setCreated(val.at("created").get<uint64_t>());
+  }
+
+  if (val.count("expired")) {
+    setExpired(val.at("expired").get<uint64_t>());
+  }
+
+  if (val.count("evicted")) {
+    setEvicted(val.at("evicted").get<uint64_t>());
+  }
+
+  if (val.count("free-ports")) {
+    setFreePorts(val.at("free-ports").get<uint32_t>());
+  }
+
+  if (val.count("port-allocation-failures")) {
+    setPortAllocationFailures(val.at("port-allocation-failures").get<uint64_t>());
+  }
+}
+
+nlohmann::json SessionTableJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_sizeIsSet) {
+    val["size"] = m_size;
+  }
+
+  if (m_timeoutIsSet) {
+    val["timeout"] = m_timeout;
+  }
+
+  if (m_activeIsSet) {
+    val["active"] = m_active;
+  }
+
+  if (m_occupancyIsSet) {
+    val["occupancy"] = m_occupancy;
+  }
+
+  if (m_createdIsSet) {
+    val["created"] = m_created;
+  }
+
+  if (m_expiredIsSet) {
+    val["expired"] = m_expired;
+  }
+
+  if (m_evictedIsSet) {
+    val["evicted"] = m_evicted;
+  }
+
+  if (m_freePortsIsSet) {
+    val["free-ports"] = m_freePorts;
+  }
+
+  if (m_portAllocationFailuresIsSet) {
+    val["port-allocation-failures"] = m_portAllocationFailures;
+  }
+
+  return val;
+}
+
+uint32_t SessionTableJsonObject::getSize() const {
+  return m_size;
+}
+
+void SessionTableJsonObject::setSize(uint32_t value) {
+  m_size = value;
+  m_sizeIsSet = true;
+}
+
+bool SessionTableJsonObject::sizeIsSet() const {
+  return m_sizeIsSet;
+}
+
+void SessionTableJsonObject::unsetSize() {
+  m_sizeIsSet = false;
+}
+
+uint32_t SessionTableJsonObject::getTimeout() const {
+  return m_timeout;
+}
+
+void SessionTableJsonObject::setTimeout(uint32_t value) {
+  m_timeout = value;
+  m_timeoutIsSet = true;
+}
+
+bool SessionTableJsonObject::timeoutIsSet() const {
+  return m_timeoutIsSet;
+}
+
+void SessionTableJsonObject::unsetTimeout() {
+  m_timeoutIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getActive() const {
+  return m_active;
+}
+
+void SessionTableJsonObject::setActive(uint64_t value) {
+  m_active = value;
+  m_activeIsSet = true;
+}
+
+bool SessionTableJsonObject::activeIsSet() const {
+  return m_activeIsSet;
+}
+
+void SessionTableJsonObject::unsetActive() {
+  m_activeIsSet = false;
+}
+
+uint8_t SessionTableJsonObject::getOccupancy() const {
+  return m_occupancy;
+}
+
+void SessionTableJsonObject::setOccupancy(uint8_t value) {
+  m_occupancy = value;
+  m_occupancyIsSet = true;
+}
+
+bool SessionTableJsonObject::occupancyIsSet() const {
+  return m_occupancyIsSet;
+}
+
+void SessionTableJsonObject::unsetOccupancy() {
+  m_occupancyIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getCreated() const {
+  return m_created;
+}
+
+void SessionTableJsonObject::setCreated(uint64_t value) {
+  m_created = value;
+  m_createdIsSet = true;
+}
+
+bool SessionTableJsonObject::createdIsSet() const {
+  return m_createdIsSet;
+}
+
+void SessionTableJsonObject::unsetCreated() {
+  m_createdIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getExpired() const {
+  return m_expired;
+}
+
+void SessionTableJsonObject::setExpired(uint64_t value) {
+  m_expired = value;
+  m_expiredIsSet = true;
+}
+
+bool SessionTableJsonObject::expiredIsSet() const {
+  return m_expiredIsSet;
+}
+
+void SessionTableJsonObject::unsetExpired() {
+  m_expiredIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getEvicted() const {
+  return m_evicted;
+}
+
+void SessionTableJsonObject::setEvicted(uint64_t value) {
+  m_evicted = value;
+  m_evictedIsSet = true;
+}
+
+bool SessionTableJsonObject::evictedIsSet() const {
+  return m_evictedIsSet;
+}
+
+void SessionTableJsonObject::unsetEvicted() {
+  m_evictedIsSet = false;
+}
+
+uint32_t SessionTableJsonObject::getFreePorts() const {
+  return m_freePorts;
+}
+
+void SessionTableJsonObject::setFreePorts(uint32_t value) {
+  m_freePorts = value;
+  m_freePortsIsSet = true;
+}
+
+bool SessionTableJsonObject::freePortsIsSet() const {
+  return m_freePortsIsSet;
+}
+
+void SessionTableJsonObject::unsetFreePorts() {
+  m_freePortsIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getPortAllocationFailures() const {
+  return m_portAllocationFailures;
+}
+
+void SessionTableJsonObject::setPortAllocationFailures(uint64_t value) {
+  m_portAllocationFailures = value;
+  m_portAllocationFailuresIsSet = true;
+}
+
+bool SessionTableJsonObject::portAllocationFailuresIsSet() const {
+  return m_portAllocationFailuresIsSet;
+}
+
+void SessionTableJsonObject::unsetPortAllocationFailures() {
+  m_portAllocationFailuresIsSet = false;
+}
+
+
+}
+}
+}
+}
+
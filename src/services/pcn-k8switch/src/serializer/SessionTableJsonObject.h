@@ -0,0 +1,141 @@
+/**
+* k8switch API
+* k8switch API generated from k8switch.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableJsonObject : public JsonObjectBase {
+public:
+  SessionTableJsonObject();
+  SessionTableJsonObject(const nlohmann::json &json);
+  ~SessionTableJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Maximum number of NodePort sessions (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() const;
+  void setSize(uint32_t value);
+  bool sizeIsSet() const;
+  void unsetSize();
+
+  /// <summary>
+  /// Seconds after which an idle session expires (can be set only at creation)
+  /// </summary>
+  uint32_t getTimeout() const;
+  void setTimeout(uint32_t value);
+  bool timeoutIsSet() const;
+  void unsetTimeout();
+
+  /// <summary>
+  /// Number of NodePort sessions currently in the session table
+  /// </summary>
+  uint64_t getActive() const;
+  void setActive(uint64_t value);
+  bool activeIsSet() const;
+  void unsetActive();
+
+  /// <summary>
+  /// Percentage of the session table in use
+  /// </summary>
+  uint8_t getOccupancy() const;
+  void setOccupancy(uint8_t value);
+  bool occupancyIsSet() const;
+  void unsetOccupancy();
+
+  /// <summary>
+  /// Number of NodePort sessions created
+  /// </summary>
+  uint64_t getCreated() const;
+  void setCreated(uint64_t value);
+  bool createdIsSet() const;
+  void unsetCreated();
+
+  /// <summary>
+  /// Number of sessions removed because they were idle for longer than the timeout
+  /// </summary>
+  uint64_t getExpired() const;
+  void setExpired(uint64_t value);
+  bool expiredIsSet() const;
+  void unsetExpired();
+
+  /// <summary>
+  /// Number of sessions lost because the session table was full
+  /// </summary>
+  uint64_t getEvicted() const;
+  void setEvicted(uint64_t value);
+  bool evictedIsSet() const;
+  void unsetEvicted();
+
+  /// <summary>
+  /// Number of source ports available for new sessions
+  /// </summary>
+  uint32_t getFreePorts() const;
+  void setFreePorts(uint32_t value);
+  bool freePortsIsSet() const;
+  void unsetFreePorts();
+
+  /// <summary>
+  /// Number of new sessions dropped because no source port was available
+  /// </summary>
+  uint64_t getPortAllocationFailures() const;
+  void setPortAllocationFailures(uint64_t value);
+  bool portAllocationFailuresIsSet() const;
+  void unsetPortAllocationFailures();
+
+private:
+  uint32_t m_size;
+  bool m_sizeIsSet;
+  uint32_t m_timeout;
+  bool m_timeoutIsSet;
+  uint64_t m_active;
+  bool m_activeIsSet;
+  uint8_t m_occupancy;
+  bool m_occupancyIsSet;
+  uint64_t m_created;
+  bool m_createdIsSet;
+  uint64_t m_expired;
+  bool m_expiredIsSet;
+  uint64_t m_evicted;
+  bool m_evictedIsSet;
+  uint32_t m_freePorts;
+  bool m_freePortsIsSet;
+  uint64_t m_portAllocationFailures;
+  bool m_portAllocationFailuresIsSet;
+};
+
+}
+}
+}
+}
+
@@ -0,0 +1,76 @@
+#!/bin/bash
+
+# Measures the latency of endpoint (backend) updates in a k8switch with many
+# ClusterIP services: the services are created with a single request, then
+# backends are added to and removed from random services and the average and
+# worst latency of the requests is reported.
+# usage: bench_endpoint_updates.sh [services] [backends-per-service] [updates]
+
+services=${1:-10000}
+backends=${2:-3}
+updates=${3:-1000}
+
+api="localhost:9000/polycube/v1/k8switch/k1"
+
+function cleanup {
+  set +e
+  polycubectl k8switch del k1
+  rm -f $services_file
+}
+
+trap cleanup EXIT
+
+set -e
+
+services_file=$(mktemp)
+
+polycubectl k8switch add k1 cluster-ip-subnet=10.96.0.0/12 \
+  client-subnet=10.1.0.0/16 virtual-client-subnet=10.10.0.0/16 \
+  services-table-size=$((services * 32)) \
+  fwd-table-size=65536
+
+# each service takes 3 * max(10, backends) + 1 entries of the services table,
+# the table size above assumes at most 10 backends per service
+# service i is 10.96.x.y:80, its backends are 10.1.x.y:8080+j
+python3 - $services $backends > $services_file <<PYEOF
+import json, sys
+services, backends = int(sys.argv[1]), int(sys.argv[2])
+l = []
+for i in range(services):
+    ip = '%d.%d' % (i // 256, i % 256)
+    l.append({'vip': '10.96.' + ip, 'vport': 80, 'proto': 'TCP',
+              'backend': [{'ip': '10.1.' + ip, 'port': 8080 + j}
+                          for j in range(backends)]})
+print(json.dumps(l))
+PYEOF
+
+start=$(date +%s.%N)
+curl -s -f -X POST -H "Content-Type: application/json" \
+  "$api/service/" --upload-file $services_file > /dev/null
+end=$(date +%s.%N)
+echo "created $services services in $(echo "$end - $start" | bc) s"
+
+function request {
+  curl -s -f -o /dev/null -w "%{time_total}\n" -X $1 \
+    -H "Content-Type: application/json" "$2" ${3:+-d "$3"}
+}
+
+# every update adds a backend to a random service and removes it
+times=$(mktemp)
+for u in `seq 1 $updates`;
+do
+  i=$((RANDOM * 32768 + RANDOM))
+  i=$((i % services))
+  ip="$((i / 256)).$((i % 256))"
+  backend="$api/service/10.96.$ip/80/TCP/backend/10.1.$ip/9000/"
+  request POST $backend '{"weight": 1}' >> $times
+  request DELETE $backend >> $times
+done
+
+sort -n $times | awk '
+  { t[NR] = $1; sum += $1 }
+  END {
+    printf "%d backend updates: avg %.3f ms, p99 %.3f ms, max %.3f ms\n",
+      NR, sum / NR * 1000, t[int(NR * 0.99)] * 1000, t[NR] * 1000
+  }'
+rm -f $times
@@ -19,6 +19,8 @@
 #include "Backend.h"
 #include "Lbdsr.h"
 
+#include <algorithm>
+
 Backend::Backend(Lbdsr &parent, const BackendJsonObject &conf)
     : parent_(parent) {
   logger()->info("Creating Backend instance");
@@ -62,10 +64,15 @@ std::shared_ptr<spdlog::logger> Backend::logger() {
 }
 
 std::shared_ptr<BackendPool> Backend::getPool(const uint32_t &id) {
+  if (pools_.count(id) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
   std::string pool_mac = pools_[id];
   BackendPoolJsonObject conf;
   conf.setId(id);
   conf.setMac(pool_mac);
+  conf.setState(pool_states_[id]);
   return std::make_shared<BackendPool>(*this, conf);
 }
 
@@ -78,16 +85,31 @@ std::vector<std::shared_ptr<BackendPool>> Backend::getPoolList() {
 }
 
 void Backend::addPool(const uint32_t &id, const BackendPoolJsonObject &conf) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  if (id == 0 || id >= Service::MAX_POOLS) {
+    throw std::runtime_error("Invalid id " + std::to_string(id) +
+                             ", the range is from 1 to " +
+                             std::to_string(Service::MAX_POOLS - 1));
+  }
+
+  if (pools_.count(id) != 0) {
+    throw std::runtime_error("Backend pool " + std::to_string(id) +
+                             " already exists");
+  }
+
   try {
-    auto config_table = parent_.get_array_table<uint64_t>("config_table");
+    auto pool_macs = parent_.get_array_table<uint64_t>("pool_macs");
+
+    logger()->info("mac: {0}", conf.getMac());
 
+    pool_macs.set(id, utils::mac_string_to_nbo_uint(conf.getMac()));
     pools_[id] = conf.getMac();
 
     logger()->info("n backend servers {0}", pools_.size());
-    logger()->info("mac: {0}", conf.getMac());
 
-    config_table.set(0, pools_.size());
-    config_table.set(id, utils::mac_string_to_nbo_uint(conf.getMac()));
+    setPoolState(id, conf.stateIsSet() ? conf.getState()
+                                       : BackendPoolStateEnum::ACTIVE);
   } catch (std::exception &e) {
     logger()->error("[BackendPool] Error while creating the backend pool {0}",
                     id);
@@ -110,16 +132,70 @@ void Backend::replacePool(const uint32_t &id,
 }
 
 void Backend::delPool(const uint32_t &id) {
-  // TODO: should the ebpf map be cleanup?
-  if (pools_.count(id) != 0) {
-    pools_.erase(id);
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  if (pools_.count(id) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
+  pools_.erase(id);
+  pool_states_.erase(id);
+
+  // the server has no entries in the lookup tables anymore, then its
+  // sessions are removed from the datapath
+  parent_.updateServices();
+
+  auto pool_macs = parent_.get_array_table<uint64_t>("pool_macs");
+  pool_macs.set(id, 0);
+  auto backend_states = parent_.get_array_table<uint32_t>("backend_states");
+  backend_states.set(id, static_cast<uint32_t>(BackendPoolStateEnum::ACTIVE));
+}
+
+/*
+ * The state is written in the backend_states map, so that the datapath
+ * changes the server of the new sessions without being reloaded.
+ * The lookup tables are rebuilt before the state of a server that stops
+ * taking new sessions is written (and after the state of a server that
+ * becomes ACTIVE), so that the datapath always finds a server for them.
+ */
+void Backend::setPoolState(const uint32_t &id,
+                           const BackendPoolStateEnum &state) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  auto backend_states = parent_.get_array_table<uint32_t>("backend_states");
+
+  pool_states_[id] = state;
+  if (state == BackendPoolStateEnum::ACTIVE) {
+    backend_states.set(id, static_cast<uint32_t>(state));
+    parent_.updateServices();
+  } else {
+    parent_.updateServices();
+    backend_states.set(id, static_cast<uint32_t>(state));
   }
 }
 
 void Backend::delPoolList() {
-  // TODO: would it be possible to just call claer un pools_ ?
-  for (auto it = pools_.begin(); it != pools_.end();) {
-    uint32_t pool_id = it->first;
-    delPool(pool_id);
+  while (!pools_.empty()) {
+    delPool(pools_.begin()->first);
+  }
+}
+
+bool Backend::hasPool(uint32_t id) {
+  return pools_.count(id) != 0;
+}
+
+std::vector<uint32_t> Backend::getPoolIds() {
+  std::vector<uint32_t> ids;
+  for (auto &it : pools_) {
+    ids.push_back(it.first);
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+BackendPoolStateEnum Backend::getPoolState(uint32_t id) {
+  if (pool_states_.count(id) == 0) {
+    return BackendPoolStateEnum::ACTIVE;
   }
+  return pool_states_.at(id);
 }
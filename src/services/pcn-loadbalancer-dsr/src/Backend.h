@@ -55,7 +55,15 @@ class Backend : public BackendInterface {
   void delPool(const uint32_t &id) override;
   void delPoolList() override;
 
+  void setPoolState(const uint32_t &id, const BackendPoolStateEnum &state);
+
+  bool hasPool(uint32_t id);
+  // ids of the servers of the pool, sorted
+  std::vector<uint32_t> getPoolIds();
+  BackendPoolStateEnum getPoolState(uint32_t id);
+
  private:
   Lbdsr &parent_;
   std::unordered_map<uint32_t, std::string> pools_;
+  std::unordered_map<uint32_t, BackendPoolStateEnum> pool_states_;
 };
@@ -25,7 +25,7 @@ BackendPool::BackendPool(Backend &parent, const BackendPoolJsonObject &conf)
 
   id_ = conf.getId();
   mac_ = conf.getMac();
-  parent.addPool(id_, conf);
+  state_ = conf.stateIsSet() ? conf.getState() : BackendPoolStateEnum::ACTIVE;
 }
 
 BackendPool::~BackendPool() {}
@@ -35,9 +35,11 @@ void BackendPool::update(const BackendPoolJsonObject &conf) {
   // specified in the conf JsonObject.
   // You can modify this implementation.
 
-  id_ = conf.getId();
-  mac_ = conf.getMac();
-  parent_.replacePool(id_, conf);
+  // id is the key and mac is init-only, the state is the only leaf that can
+  // change
+  if (conf.stateIsSet()) {
+    setState(conf.getState());
+  }
 }
 
 BackendPoolJsonObject BackendPool::toJsonObject() {
@@ -47,6 +49,8 @@ BackendPoolJsonObject BackendPool::toJsonObject() {
 
   conf.setId(getId());
 
+  conf.setState(getState());
+
   return conf;
 }
 
@@ -60,6 +64,17 @@ uint32_t BackendPool::getId() {
   return this->id_;
 }
 
+BackendPoolStateEnum BackendPool::getState() {
+  // This method retrieves the state value.
+  return this->state_;
+}
+
+void BackendPool::setState(const BackendPoolStateEnum &value) {
+  // This method set the state value.
+  state_ = value;
+  parent_.setPoolState(id_, value);
+}
+
 std::shared_ptr<spdlog::logger> BackendPool::logger() {
   return parent_.logger();
 }
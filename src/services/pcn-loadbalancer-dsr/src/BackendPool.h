@@ -48,8 +48,15 @@ class BackendPool : public BackendPoolInterface {
   /// </summary>
   uint32_t getId() override;
 
+  /// <summary>
+  /// Administrative state of the backend server of the pool
+  /// </summary>
+  BackendPoolStateEnum getState() override;
+  void setState(const BackendPoolStateEnum &value) override;
+
  private:
   Backend &parent_;
   uint32_t id_;
   std::string mac_;
+  BackendPoolStateEnum state_;
 };
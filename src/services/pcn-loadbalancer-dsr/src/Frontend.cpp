@@ -30,6 +30,9 @@ Frontend::Frontend(Lbdsr &parent, const FrontendJsonObject &conf)
   if (conf.macIsSet()) {
     mac_ = conf.getMac();
   }
+
+  parent_.setFrontendMac(mac_);
+  parent_.setFrontendVip(vip_);
 }
 
 Frontend::Frontend(Lbdsr &parent) : parent_(parent) {}
@@ -67,14 +70,9 @@ std::string Frontend::getVip() {
 
 void Frontend::setVip(const std::string &value) {
   // This method set the vip value.
-
-  // convert value to hexbe string ip
   logger()->info("Set Vip request str: {0} ", value);
-  std::string vip_hexbe = utils::ip_string_to_hexbe_string(value);
-  logger()->trace("Set Vip request str: {0} hexbe: {1} ", value, vip_hexbe);
 
-  // if success set vip and vip_hexbe_string in parent
-  parent_.setVipHexbe(vip_hexbe);
+  parent_.setFrontendVip(value);
   this->vip_ = value;
 }
 
@@ -87,13 +85,8 @@ void Frontend::setMac(const std::string &value) {
   // This method set the mac value.
 
   try {
-    // convert value to hexbe string ip
     logger()->info("Set Mac request str: {0} ", value);
-    std::string mac_hexbe = utils::mac_string_to_hexbe_string(value);
-    logger()->trace("Set Mac request str: {0} hexbe: {1} ", value, mac_hexbe);
-
-    // if success set vip and mac_hexbe_string in parent
-    parent_.setMacHexbe(mac_hexbe);
+    parent_.setFrontendMac(value);
     this->mac_ = value;
   } catch (...) {
     throw std::runtime_error("no valid mac");
@@ -20,20 +20,52 @@
 #include "Lbdsr_dp.h"
 
 Lbdsr::Lbdsr(const std::string name, const LbdsrJsonObject &conf)
-    : Cube(conf.getBase(), {getCode(true)}, {}) {
+    : Cube(conf.getBase(),
+           {Lbdsr::buildLbdsrCode(lbdsr_code, conf.getSessionMode(),
+                                  conf.getSessionTableSize())},
+           {}),
+      frontend_mac_(0),
+      session_mode_(conf.getSessionMode()),
+      session_table_size_(conf.getSessionTableSize()),
+      grace_period_(conf.getGracePeriod()) {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [Lbdsr] [%n] [%l] %v");
-  logger()->info("Creating Lbdsr instance");
+  logger()->info(
+      "Creating Lbdsr instance in {0} session mode",
+      LbdsrJsonObject::LbdsrSessionModeEnum_to_string(session_mode_));
+
+  for (uint16_t slot = 0; slot < Service::MAX_SERVICES; slot++) {
+    free_maglev_slots_.insert(slot);
+  }
 
   if (conf.algorithmIsSet()) {
     setAlgorithm(conf.getAlgorithm());
   }
 
   addPortsList(conf.getPorts());
-  addFrontend(conf.getFrontend());
   addBackend(conf.getBackend());
+  addFrontend(conf.getFrontend());
+  addServiceList(conf.getService());
 }
 
-Lbdsr::~Lbdsr() {}
+Lbdsr::~Lbdsr() {
+  // the services use the pool, they are removed first
+  service_map_.clear();
+  frontend_service_.reset();
+}
+
+std::string Lbdsr::buildLbdsrCode(std::string const &lbdsr_code,
+                                  LbdsrSessionModeEnum session_mode,
+                                  uint32_t session_table_size) {
+  std::string stateless =
+      session_mode == LbdsrSessionModeEnum::STATELESS ? "1" : "0";
+  return "#define STATELESS_MODE " + stateless + "\n" +
+         "#define SESSION_TABLE_SIZE " + std::to_string(session_table_size) +
+         "\n" + "#define MAGLEV_TABLE_SIZE " +
+         std::to_string(Service::MAGLEV_TABLE_SIZE) + "\n" +
+         "#define MAX_SERVICES " + std::to_string(Service::MAX_SERVICES) +
+         "\n" + "#define MAX_POOLS " + std::to_string(Service::MAX_POOLS) +
+         "\n" + lbdsr_code;
+}
 
 void Lbdsr::update(const LbdsrJsonObject &conf) {
   // This method updates all the object/parameter in Lbdsr object specified in
@@ -50,6 +82,10 @@ void Lbdsr::update(const LbdsrJsonObject &conf) {
     setAlgorithm(conf.getAlgorithm());
   }
 
+  if (conf.gracePeriodIsSet()) {
+    setGracePeriod(conf.getGracePeriod());
+  }
+
   if (conf.portsIsSet()) {
     for (auto &i : conf.getPorts()) {
       auto name = i.getName();
@@ -62,6 +98,16 @@ void Lbdsr::update(const LbdsrJsonObject &conf) {
     auto m = getBackend();
     m->update(conf.getBackend());
   }
+
+  if (conf.serviceIsSet()) {
+    for (auto &i : conf.getService()) {
+      auto vip = i.getVip();
+      auto vport = i.getVport();
+      auto proto = i.getProto();
+      auto m = getService(vip, vport, proto);
+      m->update(i);
+    }
+  }
 }
 
 LbdsrJsonObject Lbdsr::toJsonObject() {
@@ -78,6 +124,14 @@ LbdsrJsonObject Lbdsr::toJsonObject() {
 
   conf.setBackend(getBackend()->toJsonObject());
 
+  conf.setSessionMode(getSessionMode());
+  conf.setSessionTableSize(getSessionTableSize());
+  conf.setGracePeriod(getGracePeriod());
+
+  for (auto &i : getServiceList()) {
+    conf.addService(i->toJsonObject());
+  }
+
   return conf;
 }
 
@@ -96,50 +150,43 @@ void Lbdsr::setAlgorithm(const std::string &value) {
   this->algorithm_ = value;
 }
 
-void Lbdsr::replaceAll(std::string &str, const std::string &from,
-                       const std::string &to) {
-  if (from.empty())
-    return;
-  size_t start_pos = 0;
-  while ((start_pos = str.find(from, start_pos)) != std::string::npos) {
-    str.replace(start_pos, from.length(), to);
-    start_pos += to.length();  // In case 'to' contains 'from', like replacing
-                               // 'x' with 'yx'
-  }
+LbdsrSessionModeEnum Lbdsr::getSessionMode() {
+  // This method retrieves the sessionMode value.
+  return session_mode_;
 }
 
-std::string Lbdsr::getCode(bool first = false) {
-  std::string code = lbdsr_code;
-
-  std::string vip_hexbe_str_default_ = "0x6400000a";
-  std::string mac_hexbe_str_default_ = "0xccbbaa010101";
-
-  if (!first) {
-    replaceAll(code, "_FRONTEND_IP", vip_hexbe_str_);
-  } else {
-    replaceAll(code, "_FRONTEND_IP", vip_hexbe_str_default_);
-  }
-
-  if (!first) {
-    replaceAll(code, "_FRONTEND_MAC", mac_hexbe_str_);
-  } else {
-    replaceAll(code, "_FRONTEND_MAC", mac_hexbe_str_default_);
-  }
+uint32_t Lbdsr::getSessionTableSize() {
+  // This method retrieves the sessionTableSize value.
+  return session_table_size_;
+}
 
-  replaceAll(code, "_FRONTEND_PORT", std::to_string((uint16_t)frontend_port_));
-  replaceAll(code, "_BACKEND_PORT", std::to_string((uint16_t)backend_port_));
+uint32_t Lbdsr::getGracePeriod() {
+  // This method retrieves the gracePeriod value.
+  return grace_period_;
+}
 
-  return code;
+void Lbdsr::setGracePeriod(const uint32_t &value) {
+  // This method set the gracePeriod value.
+  grace_period_ = value;
 }
 
-bool Lbdsr::reloadCode() {
-  logger()->debug("reloadCode {0} ", is_code_changed_);
-  if (is_code_changed_) {
-    logger()->info("reloading code ...");
-    reload(getCode());
-    is_code_changed_ = false;
-  }
-  return true;
+/*
+ * Ports and frontend mac are read by the datapath from the lb_config map, so
+ * that changing them does not require to reload the code.
+ */
+void Lbdsr::writeConfig() {
+  struct lb_config {
+    uint64_t frontend_mac;
+    uint16_t frontend_port;
+    uint16_t backend_port;
+  } __attribute__((packed)) config = {
+      .frontend_mac = frontend_mac_,
+      .frontend_port = (uint16_t)frontend_port_,
+      .backend_port = (uint16_t)backend_port_,
+  };
+
+  auto config_table = get_array_table<lb_config>("lb_config");
+  config_table.set(0, config);
 }
 
 void Lbdsr::setFrontendPort(std::string portName, int index) {
@@ -150,8 +197,7 @@ void Lbdsr::setFrontendPort(std::string portName, int index) {
   frontend_port_ = index;
   frontend_port_str_ = portName;
 
-  is_code_changed_ = true;
-  reloadCode();
+  writeConfig();
 }
 
 void Lbdsr::setBackendPort(std::string portName, int index) {
@@ -162,8 +208,7 @@ void Lbdsr::setBackendPort(std::string portName, int index) {
   backend_port_ = index;
   backend_port_str_ = portName;
 
-  is_code_changed_ = true;
-  reloadCode();
+  writeConfig();
 }
 
 void Lbdsr::rmPort(std::string portName) {
@@ -187,8 +232,7 @@ void Lbdsr::rmFrontendPort(std::string portName) {
   frontend_port_ = -1;
   frontend_port_str_ = "";
 
-  is_code_changed_ = true;
-  reloadCode();
+  writeConfig();
 }
 
 void Lbdsr::rmBackendPort(std::string portName) {
@@ -203,24 +247,35 @@ void Lbdsr::rmBackendPort(std::string portName) {
   backend_port_ = -1;
   backend_port_str_ = "";
 
-  is_code_changed_ = true;
-  reloadCode();
+  writeConfig();
 }
 
-void Lbdsr::setVipHexbe(std::string &value) {
-  if (vip_hexbe_str_ != value) {
-    vip_hexbe_str_ = value;
-    is_code_changed_ = true;
-    reloadCode();
+/*
+ * The frontend vip is an implicit service matching any port and protocol,
+ * balanced among all the servers of the pool: it is replaced when the vip
+ * changes.
+ */
+void Lbdsr::setFrontendVip(const std::string &vip) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  if (frontend_service_ != nullptr && frontend_service_->getVip() == vip) {
+    return;
   }
-}
 
-void Lbdsr::setMacHexbe(std::string &value) {
-  if (mac_hexbe_str_ != value) {
-    mac_hexbe_str_ = value;
-    is_code_changed_ = true;
-    reloadCode();
+  Service::ServiceKey key = Service::ServiceKey(
+      vip, 0, Service::convertProtoToNumber(ServiceProtoEnum::ALL));
+  if (service_map_.count(key) != 0) {
+    throw std::runtime_error("A service with vip " + vip +
+                             ", vport 0 and protocol ALL already exists");
   }
+
+  frontend_service_.reset();
+  frontend_service_.reset(new Service(*this, vip));
+}
+
+void Lbdsr::setFrontendMac(const std::string &mac) {
+  frontend_mac_ = utils::mac_string_to_nbo_uint(mac);
+  writeConfig();
 }
 
 std::shared_ptr<Ports> Lbdsr::getPorts(const std::string &name) {
@@ -281,6 +336,8 @@ void Lbdsr::replaceFrontend(const FrontendJsonObject &conf) {
 
 void Lbdsr::delFrontend() {
   if (frontend_ != nullptr) {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    frontend_service_.reset();
     frontend_ = nullptr;
   } else {
     throw std::runtime_error("There is no frontend in this LBDSR");
@@ -298,7 +355,9 @@ std::shared_ptr<Backend> Lbdsr::getBackend() {
 
 void Lbdsr::addBackend(const BackendJsonObject &value) {
   logger()->debug("[Backend] Received request to create new Backend");
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
   backend_ = std::make_shared<Backend>(*this, value);
+  updateServices();
 }
 
 void Lbdsr::replaceBackend(const BackendJsonObject &conf) {
@@ -308,9 +367,174 @@ void Lbdsr::replaceBackend(const BackendJsonObject &conf) {
 
 void Lbdsr::delBackend() {
   if (backend_ != nullptr) {
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
     backend_->delPoolList();
     backend_ = nullptr;
   } else {
     throw std::runtime_error("There is no backend in this LBDSR");
   }
-}
\ No newline at end of file
+}
+
+bool Lbdsr::hasPool(uint32_t id) {
+  return backend_ != nullptr && backend_->hasPool(id);
+}
+
+std::vector<uint32_t> Lbdsr::getPoolIds() {
+  if (backend_ == nullptr) {
+    return {};
+  }
+  return backend_->getPoolIds();
+}
+
+BackendPoolStateEnum Lbdsr::getPoolState(uint32_t id) {
+  if (backend_ == nullptr) {
+    return BackendPoolStateEnum::ACTIVE;
+  }
+  return backend_->getPoolState(id);
+}
+
+void Lbdsr::updateServices() {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  // the pool is being created, the services are updated once it is ready
+  if (backend_ == nullptr) {
+    return;
+  }
+
+  for (auto &it : service_map_) {
+    it.second.updateLookupTables();
+  }
+
+  if (frontend_service_ != nullptr) {
+    frontend_service_->updateLookupTables();
+  }
+}
+
+std::shared_ptr<Service> Lbdsr::getService(const std::string &vip,
+                                           const uint16_t &vport,
+                                           const ServiceProtoEnum &proto) {
+  Service::ServiceKey key =
+      Service::ServiceKey(vip, vport, Service::convertProtoToNumber(proto));
+
+  if (service_map_.count(key) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
+  return std::shared_ptr<Service>(&service_map_.at(key), [](Service *) {});
+}
+
+std::vector<std::shared_ptr<Service>> Lbdsr::getServiceList() {
+  std::vector<std::shared_ptr<Service>> services_vect;
+
+  for (auto &it : service_map_) {
+    Service::ServiceKey key = it.first;
+    services_vect.push_back(
+        getService(std::get<0>(key), std::get<1>(key),
+                   Service::convertNumberToProto(std::get<2>(key))));
+  }
+
+  return services_vect;
+}
+
+void Lbdsr::addService(const std::string &vip, const uint16_t &vport,
+                       const ServiceProtoEnum &proto,
+                       const ServiceJsonObject &conf) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  logger()->debug("[Service] Received request to create new service entry");
+  logger()->debug("[Service] Virtual IP: {0}, virtual port: {1}, protocol: {2}",
+                  vip, vport,
+                  ServiceJsonObject::ServiceProtoEnum_to_string(proto));
+
+  Service::ServiceKey key =
+      Service::ServiceKey(vip, vport, Service::convertProtoToNumber(proto));
+  if (service_map_.count(key) != 0) {
+    throw std::runtime_error("This service already exists");
+  }
+
+  if (frontend_service_ != nullptr && proto == ServiceProtoEnum::ALL &&
+      vport == 0 && frontend_service_->getVip() == vip) {
+    throw std::runtime_error(
+        "This service is the one of the frontend vip, that uses all the "
+        "servers of the pool");
+  }
+
+  // The service is built in place: its servers keep a reference to it
+  service_map_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                       std::forward_as_tuple(*this, conf));
+}
+
+void Lbdsr::addServiceList(const std::vector<ServiceJsonObject> &conf) {
+  for (auto &i : conf) {
+    std::string vip_ = i.getVip();
+    uint16_t vport_ = i.getVport();
+    ServiceProtoEnum proto_ = i.getProto();
+    addService(vip_, vport_, proto_, i);
+  }
+}
+
+void Lbdsr::replaceService(const std::string &vip, const uint16_t &vport,
+                           const ServiceProtoEnum &proto,
+                           const ServiceJsonObject &conf) {
+  delService(vip, vport, proto);
+  std::string vip_ = conf.getVip();
+  uint16_t vport_ = conf.getVport();
+  ServiceProtoEnum proto_ = conf.getProto();
+  addService(vip_, vport_, proto_, conf);
+}
+
+void Lbdsr::delService(const std::string &vip, const uint16_t &vport,
+                       const ServiceProtoEnum &proto) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  Service::ServiceKey key =
+      Service::ServiceKey(vip, vport, Service::convertProtoToNumber(proto));
+
+  if (service_map_.count(key) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
+  // the destructor removes the service from the datapath
+  service_map_.erase(key);
+}
+
+void Lbdsr::delServiceList() {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  service_map_.clear();
+}
+
+uint16_t Lbdsr::acquireMaglevSlot() {
+  if (free_maglev_slots_.empty()) {
+    throw std::runtime_error("Maximum number of services (" +
+                             std::to_string(Service::MAX_SERVICES) +
+                             ") reached");
+  }
+  uint16_t slot = *free_maglev_slots_.begin();
+  free_maglev_slots_.erase(free_maglev_slots_.begin());
+  return slot;
+}
+
+void Lbdsr::releaseMaglevSlot(uint16_t slot) {
+  free_maglev_slots_.insert(slot);
+}
+
+void Lbdsr::acquireVipAddress(uint32_t ip) {
+  if (vip_addresses_[ip]++ == 0) {
+    auto vip_addresses = get_hash_table<uint32_t, uint32_t>("vip_addresses");
+    vip_addresses.set(ip, 1);
+  }
+}
+
+void Lbdsr::releaseVipAddress(uint32_t ip) {
+  if (vip_addresses_.count(ip) == 0) {
+    return;
+  }
+  if (--vip_addresses_[ip] == 0) {
+    vip_addresses_.erase(ip);
+    auto vip_addresses = get_hash_table<uint32_t, uint32_t>("vip_addresses");
+    try {
+      vip_addresses.remove(ip);
+    } catch (...) {
+    }
+  }
+}
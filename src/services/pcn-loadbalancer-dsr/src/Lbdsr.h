@@ -24,9 +24,17 @@
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
 #include "Backend.h"
 #include "Frontend.h"
 #include "Ports.h"
+#include "Service.h"
+#include "hash_tuple.h"
 
 using namespace io::swagger::server::model;
 
@@ -34,6 +42,7 @@ class Lbdsr : public polycube::service::Cube<Ports>, public LbdsrInterface {
   friend class Ports;
   friend class Frontend;
   friend class Backend;
+  friend class Service;
 
  public:
   Lbdsr(const std::string name, const LbdsrJsonObject &conf);
@@ -79,10 +88,37 @@ class Lbdsr : public polycube::service::Cube<Ports>, public LbdsrInterface {
   void replaceBackend(const BackendJsonObject &conf) override;
   void delBackend() override;
 
-  void replaceAll(std::string &str, const std::string &from,
-                  const std::string &to);
-  std::string getCode(bool first);
-  bool reloadCode();
+  /// <summary>
+  /// Maximum number of sessions, in STATELESS mode of the sessions whose
+  /// server changed (can be set only at creation)
+  /// </summary>
+  uint32_t getSessionTableSize() override;
+
+  /// <summary>
+  /// Time the lookup tables replaced by an update of the pool are kept, in
+  /// STATELESS mode the TCP sessions without packets in this time may move to
+  /// another server; it applies to the following updates
+  /// </summary>
+  uint32_t getGracePeriod() override;
+  void setGracePeriod(const uint32_t &value) override;
+
+  /// <summary>
+  /// Services (i.e., virtual ip:protocol:port) exported to the clients
+  /// </summary>
+  std::shared_ptr<Service> getService(const std::string &vip,
+                                      const uint16_t &vport,
+                                      const ServiceProtoEnum &proto) override;
+  std::vector<std::shared_ptr<Service>> getServiceList() override;
+  void addService(const std::string &vip, const uint16_t &vport,
+                  const ServiceProtoEnum &proto,
+                  const ServiceJsonObject &conf) override;
+  void addServiceList(const std::vector<ServiceJsonObject> &conf) override;
+  void replaceService(const std::string &vip, const uint16_t &vport,
+                      const ServiceProtoEnum &proto,
+                      const ServiceJsonObject &conf) override;
+  void delService(const std::string &vip, const uint16_t &vport,
+                  const ServiceProtoEnum &proto) override;
+  void delServiceList() override;
 
   void rmPort(std::string portName);
   void setFrontendPort(std::string portName, int index);
@@ -90,8 +126,20 @@ class Lbdsr : public polycube::service::Cube<Ports>, public LbdsrInterface {
   void rmFrontendPort(std::string portName);
   void rmBackendPort(std::string portName);
 
-  void setVipHexbe(std::string &value);
-  void setMacHexbe(std::string &value);
+  void setFrontendVip(const std::string &vip);
+  void setFrontendMac(const std::string &mac);
+
+  /// <summary>
+  /// Session handling: STATEFUL keeps an entry of the session table for each
+  /// session, STATELESS selects the server hashing each packet and keeps in
+  /// the session table only the TCP sessions whose server changed after an
+  /// update of the pool (can be set only at creation)
+  /// </summary>
+  LbdsrSessionModeEnum getSessionMode() override;
+
+  static std::string buildLbdsrCode(std::string const &lbdsr_code,
+                                    LbdsrSessionModeEnum session_mode,
+                                    uint32_t session_table_size);
 
  private:
   std::shared_ptr<Backend> backend_ = nullptr;
@@ -104,12 +152,40 @@ class Lbdsr : public polycube::service::Cube<Ports>, public LbdsrInterface {
   std::string frontend_port_str_ = "";
   std::string backend_port_str_ = "";
 
-  std::string vip_hexbe_str_ = "0x6400000a";
-  std::string mac_hexbe_str_ = "0xccbbaa010101";
-
-  std::string vip_hexbe_str_default_ = "0x6400000a";
-  std::string mac_hexbe_str_default_ = "0xccbbaa010101";
-
-  // when code is reloaded it will be set to false
-  bool is_code_changed_ = false;
+  uint64_t frontend_mac_;
+  LbdsrSessionModeEnum session_mode_;
+  uint32_t session_table_size_;
+  // read by the services when they update their lookup tables
+  std::atomic<uint32_t> grace_period_;
+
+  // protects the services and the pool, that are used together when the
+  // lookup tables are built
+  std::recursive_mutex mutex_;
+
+  std::unordered_map<Service::ServiceKey, Service> service_map_;
+  // implicit service of the frontend vip, balanced among all the servers
+  std::unique_ptr<Service> frontend_service_;
+
+  // each service gets a slot for its lookup tables in the maglev_tables map
+  std::set<uint16_t> free_maglev_slots_;
+  uint16_t acquireMaglevSlot();
+  void releaseMaglevSlot(uint16_t slot);
+
+  // IPv4 vips (in network byte order) the ARP responder answers for, with
+  // the number of services using each of them
+  std::unordered_map<uint32_t, uint32_t> vip_addresses_;
+  void acquireVipAddress(uint32_t ip);
+  void releaseVipAddress(uint32_t ip);
+
+  // pool of the backend servers used by the services
+  bool hasPool(uint32_t id);
+  std::vector<uint32_t> getPoolIds();
+  BackendPoolStateEnum getPoolState(uint32_t id);
+
+  // rebuilds the lookup tables of all the services, after a change of the
+  // servers of the pool
+  void updateServices();
+
+  // writes ports and frontend mac in the lb_config map
+  void writeConfig();
 };
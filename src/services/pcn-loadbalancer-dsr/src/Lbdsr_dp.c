@@ -18,18 +18,39 @@
 #include <uapi/linux/bpf.h>
 #include <uapi/linux/filter.h>
 #include <uapi/linux/icmp.h>
+#include <uapi/linux/icmpv6.h>
 #include <uapi/linux/if_arp.h>
 #include <uapi/linux/if_ether.h>
 #include <uapi/linux/if_packet.h>
 #include <uapi/linux/in.h>
 #include <uapi/linux/ip.h>
+#include <uapi/linux/ipv6.h>
 #include <uapi/linux/pkt_cls.h>
 #include <uapi/linux/tcp.h>
 #include <uapi/linux/udp.h>
 
-#define SESSIONS_TABLE_DIM 10000
+// the following values are set by the control plane
+#ifndef SESSION_TABLE_SIZE
+#define SESSION_TABLE_SIZE 10000
+#endif
+
+#ifndef MAGLEV_TABLE_SIZE
+#define MAGLEV_TABLE_SIZE 4093
+#endif
 
-#define CONFIG_TABLE_DIM 5
+#ifndef MAX_SERVICES
+#define MAX_SERVICES 128
+#endif
+
+#ifndef MAX_POOLS
+#define MAX_POOLS 1024
+#endif
+
+// in stateless mode the session table only keeps the TCP sessions whose
+// server changed after an update of the pool, during a grace period
+#ifndef STATELESS_MODE
+#define STATELESS_MODE 0
+#endif
 
 // load balancing algorithm, uncomment only one
 #define LB_HASHING_SESSION  // hasing on (sip, dip, sport, dport, proto)
@@ -39,18 +60,13 @@
 #error "define only one lb algorithm"
 #endif
 
-// frontent and backend ports are 1st and 2nd one
-#define FRONTEND_PORT _FRONTEND_PORT
-#define BACKEND_PORT _BACKEND_PORT
-
-// frontend ip and mac addresses
-#define FRONTEND_IP _FRONTEND_IP    // 0x6400000a       // 10.0.0.100
-#define FRONTEND_MAC _FRONTEND_MAC  // 0xccbbaa010101  // 01:01:01:aa:bb:cc
-
 // address used as mac_src in outgoing traffic
 #define LB_MAC 0xddeeff020202
 #define PRINT_MAC(x) (bpf_htonll(x) >> 16)
 
+#define ICMPV6_ECHO_REQUEST 128
+#define ICMPV6_ECHO_REPLY 129
+
 struct arp_hdr {
   __be16 ar_hrd;        /* format of hardware address	*/
   __be16 ar_pro;        /* format of protocol address	*/
@@ -63,10 +79,11 @@ struct arp_hdr {
   __be32 ar_tip;        /* target IP address		*/
 } __attribute__((packed));
 
-// sessions table key
+// sessions table key. IPv4 addresses are stored as IPv4-mapped IPv6
+// addresses (::ffff:a.b.c.d)
 struct sessions_key {
-  __be32 ip_src;
-  __be32 ip_dst;
+  __be32 ip_src[4];
+  __be32 ip_dst[4];
   __be16 port_src;
   __be16 port_dst;
   __u8 proto;
@@ -75,6 +92,14 @@ struct sessions_key {
 // sessions table value
 struct sessions_value {
   __be64 mac;
+  u32 id;  // backend server the session is assigned to
+};
+
+// administrative state of the backend servers
+enum {
+  BACKEND_ACTIVE = 0,
+  BACKEND_DRAINING,
+  BACKEND_DOWN,
 };
 
 struct eth_hdr {
@@ -83,112 +108,259 @@ struct eth_hdr {
   __be16 proto;
 } __attribute__((packed));
 
-// sessions table contains already existing sessions.
+// ports and frontend MAC address, written by the control plane
+struct lb_config {
+  __be64 frontend_mac;
+  u16 frontend_port;
+  u16 backend_port;
+} __attribute__((packed));
+
+BPF_TABLE("array", u32, struct lb_config, lb_config, 1);
+
+// sessions table contains already existing sessions (in stateless mode, the
+// ones whose server changed).
 BPF_TABLE("lru_hash", struct sessions_key, struct sessions_value,
-          sessions_table, SESSIONS_TABLE_DIM);
+          sessions_table, SESSION_TABLE_SIZE);
+
+// key of the services table. A service with port 0 matches any port, a
+// service with proto 0 any protocol (and any port).
+struct vip {
+  __be32 ip[4];
+  __be16 port;
+  __u8 proto;
+  __u8 pad;
+};
+
+/*
+ * The value holds the first entry of the lookup tables of the service in the
+ * 'maglev_tables' map, where the control plane writes the ids of the servers
+ * of the service in proportion to their weights (Maglev consistent hashing):
+ *
+ *   server = maglev_tables[table + session_hash % MAGLEV_TABLE_SIZE]
+ *
+ * Each service has two buffers: the control plane fills the one not in use,
+ * then switches the service to it updating this table. Each buffer holds the
+ * lookup table of all the servers of the service, followed by the fallback
+ * one with the ACTIVE servers only, used for the new sessions when the server
+ * of the first table is not ACTIVE.
+ * The tables used before the last update (if any) are kept as well, for a
+ * grace period: in stateless mode the sessions that were already open stay on
+ * their server.
+ */
+#define NO_TABLE 0xffffffff
+
+struct service_tables {
+  u32 table;
+  u32 prev_table;    // NO_TABLE if there is none
+  u64 prev_expires;  // end of the grace period (bpf_ktime_get_ns)
+};
 
-// todo it should be a percpu_array, right now map is not populated corretly by
-// control plane
-// config table contains the list of backend server of the pool, and the number
-// of backend servers.
-// config_table[0] = #servers (e.g. 2)
-// config_table[1] = mac_address server1 (e.g. 01:01:01:ab:cd:ef)
-// config_table[2] = mac_address server2 (e.g. 02:02:02:ab:cd:ef)
+BPF_TABLE("hash", struct vip, struct service_tables, services, MAX_SERVICES);
+BPF_TABLE("array", u32, u32, maglev_tables,
+          MAX_SERVICES * 4 * MAGLEV_TABLE_SIZE);
 
-BPF_TABLE("array", u32, __be64, config_table, CONFIG_TABLE_DIM);
+// IPv4 addresses of the services, the load balancer answers to the ARP
+// requests for them
+BPF_TABLE("hash", __be32, u32, vip_addresses, MAX_SERVICES);
+
+// MAC address of each server of the pool, by id (0 if there is no server)
+BPF_TABLE("array", u32, __be64, pool_macs, MAX_POOLS);
+
+// state of each server of the pool, by id. DRAINING servers keep their
+// sessions, DOWN servers lose them as well.
+BPF_TABLE("array", u32, u32, backend_states, MAX_POOLS);
+
+static inline u32 get_backend_state(u32 id) {
+  u32 *state = backend_states.lookup(&id);
+  if (!state) {
+    return BACKEND_ACTIVE;
+  }
+  return *state;
+}
+
+static inline void ipv4_to_mapped(__be32 *dst, __be32 addr) {
+  dst[0] = 0;
+  dst[1] = 0;
+  dst[2] = bpf_htonl(0xffff);
+  dst[3] = addr;
+}
+
+// the most specific service of the destination of the session
+static inline struct service_tables *get_service(
+    struct sessions_key *sessions_key) {
+  struct vip key = {};
+  key.ip[0] = sessions_key->ip_dst[0];
+  key.ip[1] = sessions_key->ip_dst[1];
+  key.ip[2] = sessions_key->ip_dst[2];
+  key.ip[3] = sessions_key->ip_dst[3];
+  key.port = sessions_key->port_dst;
+  key.proto = sessions_key->proto;
+
+  struct service_tables *tables = services.lookup(&key);
+  if (tables) {
+    return tables;
+  }
+
+  key.port = 0;
+  tables = services.lookup(&key);
+  if (tables) {
+    return tables;
+  }
+
+  key.proto = 0;
+  return services.lookup(&key);
+}
 
 // implements arp responder on frontend interface
 static __always_inline int arp_responder(struct CTXTYPE *ctx,
                                          struct pkt_metadata *md,
+                                         struct lb_config *config,
                                          struct eth_hdr *eth,
                                          struct arp_hdr *arp) {
   __be32 target_ip = arp->ar_tip;
   __be32 sender = 0;
-  if (target_ip == FRONTEND_IP)
-    sender = FRONTEND_IP;
+  if (vip_addresses.lookup(&target_ip))
+    sender = target_ip;
   else
     return RX_DROP;
 
   pcn_log(ctx, LOG_DEBUG, "Somebody is asking for my address\n");
 
   // build arp response stating from arp request.
-  // use FRONTEND_MAC and FRONTEND_IP
+  // use the frontend mac and the requested vip
   __be64 remotemac = arp->ar_sha;
   __be32 remoteip = arp->ar_sip;
   arp->ar_op = bpf_htons(ARPOP_REPLY);
   arp->ar_tha = remotemac;
-  arp->ar_sha = FRONTEND_MAC;
+  arp->ar_sha = config->frontend_mac;
   arp->ar_sip = sender;
   arp->ar_tip = remoteip;
   eth->dst = remotemac;
-  eth->src = FRONTEND_MAC;
+  eth->src = config->frontend_mac;
 
   // response is sent back on frontend port
-  return pcn_pkt_redirect(ctx, md, FRONTEND_PORT);
+  return pcn_pkt_redirect(ctx, md, config->frontend_port);
+}
+
+static inline u32 get_server(u32 table, u32 hash) {
+  u32 id = table + hash % MAGLEV_TABLE_SIZE;
+  u32 *server = maglev_tables.lookup(&id);
+  if (!server) {
+    return 0;
+  }
+  return *server;
+}
+
+static inline __be64 get_server_mac(u32 id) {
+  __be64 *mac = pool_macs.lookup(&id);
+  if (!mac) {
+    return 0;
+  }
+  return *mac;
 }
 
 // lookup for existing sessions
 // hit: forward the packet
 // miss: apply load balancing algorithm, assign session to a backend server,
 // forward the packet.
-static inline struct sessions_value *get_sessions_value(__be32 ip_src,
-                                                        __be32 ip_dst,
-                                                        __be16 port_src,
-                                                        __be16 port_dst,
-                                                        __u8 proto) {
+// In stateless mode only the sessions whose server changed are kept: the
+// others are balanced again on each packet, through the same lookup table.
+// Returns the MAC address of the server, 0 if the packet has to be dropped.
+static inline __be64 get_backend_mac(struct sessions_key *sessions_key,
+                                     struct service_tables *tables,
+                                     u8 new_session) {
   // lookup in the sessions_table
-  struct sessions_key sessions_key = {};
-  sessions_key.ip_src = ip_src;
-  sessions_key.ip_dst = ip_dst;
-  sessions_key.port_src = port_src;
-  sessions_key.port_dst = port_dst;
-  sessions_key.proto = proto;
   struct sessions_value *sessions_value_p =
-      sessions_table.lookup(&sessions_key);
-  if (!sessions_value_p) {
-    // pcn_log(ctx, LOG_ERR, "miss session_table\n");
+      sessions_table.lookup(sessions_key);
+  if (sessions_value_p &&
+      get_backend_state(sessions_value_p->id) != BACKEND_DOWN) {
+    // pcn_log(ctx, LOG_DEBUG, "hit session_table");
+    return sessions_value_p->mac;
+  }
 
-    // create rule for sessions
-    struct sessions_value sessions_value = {};
+  // pcn_log(ctx, LOG_ERR, "miss session_table\n");
+
+  // create rule for sessions
+  struct sessions_value sessions_value = {};
 
 // define load balancing algorithm
 #ifdef LB_HASHING_SOURCE_IP
-    u32 check = jhash((const void *)&ip_src, sizeof(__be32), JHASH_INITVAL);
+  u32 check = jhash((const void *)sessions_key->ip_src,
+                    sizeof(sessions_key->ip_src), JHASH_INITVAL);
 #endif
 #ifdef LB_HASHING_SESSION
-    u32 check = jhash((const void *)&sessions_key, sizeof(struct sessions_key),
-                      JHASH_INITVAL);
+  u32 check = jhash((const void *)sessions_key, sizeof(struct sessions_key),
+                    JHASH_INITVAL);
 #endif
 
-    // lookup number of backend servers
-    // hint: we can re-inject the code each time number of backend servers
-    // changes. we can save a lookup.
-    u32 id = 0;
-    __be64 *n_backend_servers_p = config_table.lookup(&id);
-    if (!n_backend_servers_p) {
-      return 0;
+  // select backend server
+  u32 table = tables->table;
+  u32 server_id = get_server(table, check);
+  u32 state = get_backend_state(server_id);
+
+#if STATELESS_MODE
+  // the session is pinned to its server in the session table
+  u8 pin = 0;
+  if (tables->prev_table != NO_TABLE) {
+    if (bpf_ktime_get_ns() > tables->prev_expires) {
+      // the grace period after the last update is over
+      tables->prev_table = NO_TABLE;
+    } else {
+      u32 prev_id = get_server(tables->prev_table, check);
+      if (prev_id != server_id && !new_session) {
+        // the session was opened before the last update of the service
+        // (the ones opened later are already pinned), it stays on the
+        // server it had, if that one can still take it
+        if (get_server_mac(prev_id) != 0 &&
+            get_backend_state(prev_id) != BACKEND_DOWN) {
+          sessions_value.mac = get_server_mac(prev_id);
+          sessions_value.id = prev_id;
+          sessions_table.update(sessions_key, &sessions_value);
+          return sessions_value.mac;
+        }
+      } else if (prev_id != server_id &&
+                 sessions_key->proto == IPPROTO_TCP) {
+        // a new session, its next packets must not be taken for the ones
+        // of a session opened before the update
+        pin = 1;
+      }
     }
+  }
 
-    // select backend server index
-    id = check % *n_backend_servers_p + 1;
-
-    // lookup mac for backend server
-    __u64 *mac = config_table.lookup(&id);
-    if (!mac) {
-      return 0;
-    }
-    sessions_value.mac = *mac;
+  // sessions of DRAINING servers are not moved
+  if (state == BACKEND_DOWN ||
+      (state == BACKEND_DRAINING && new_session)) {
+    server_id = get_server(table + MAGLEV_TABLE_SIZE, check);
+  }
 
-    // pcn_log(ctx, LOG_TRACE, "+create new session+ (id = %d) (mac = %M)\n",
-    // id, *mac);
+  __be64 mac = get_server_mac(server_id);
+  if (pin && mac != 0) {
+    sessions_value.mac = mac;
+    sessions_value.id = server_id;
+    sessions_table.update(sessions_key, &sessions_value);
+  }
+  return mac;
+#else
+  if (state != BACKEND_ACTIVE) {
+    // new sessions are not sent to DRAINING or DOWN servers
+    server_id = get_server(table + MAGLEV_TABLE_SIZE, check);
+  }
 
-    // update sessions table
-    sessions_table.lookup_or_init(&sessions_key, &sessions_value);
-    sessions_value_p = &sessions_value;
-  } else {
-    // pcn_log(ctx, LOG_DEBUG, "hit session_table");
+  // lookup mac for backend server
+  __be64 mac = get_server_mac(server_id);
+  if (mac == 0) {
+    return 0;
   }
-  return sessions_value_p;
+  sessions_value.mac = mac;
+  sessions_value.id = server_id;
+
+  // pcn_log(ctx, LOG_TRACE, "+create new session+ (id = %d) (mac = %M)\n",
+  // server_id, mac);
+
+  // update sessions table
+  sessions_table.update(sessions_key, &sessions_value);
+  return sessions_value.mac;
+#endif
 }
 
 static __always_inline int handle_rx(struct CTXTYPE *ctx,
@@ -202,27 +374,45 @@ static __always_inline int handle_rx(struct CTXTYPE *ctx,
   pcn_log(ctx, LOG_TRACE, "(in_port = %P) (proto = %x)\n", md->in_port,
           eth->proto);
 
-  // allow only traffic from FRONTEND_PORT
-  if (md->in_port != FRONTEND_PORT)
+  u32 zero = 0;
+  struct lb_config *config = lb_config.lookup(&zero);
+  if (!config)
+    goto DROP;
+
+  // allow only traffic from the frontend port
+  if (md->in_port != config->frontend_port)
     goto DROP;
+
+  struct sessions_key sessions_key = {};
+  void *l4 = 0;
+  // only TCP tells apart the first packet of a session
+  u8 new_session = 1;
   switch (eth->proto) {
   case htons(ETH_P_IP):
     goto ip;
+  case htons(ETH_P_IPV6):
+    goto ipv6;
   case htons(ETH_P_ARP):
     goto arp;
   default:
     goto DROP;
   }
 
-ip:;
+ip : {
   // allow only packets directed to the lb frontend mac
-  if (eth->dst != FRONTEND_MAC) {
+  if (eth->dst != config->frontend_mac) {
     goto DROP;
   }
 
   struct iphdr *ip = data + sizeof(*eth);
   if (data + sizeof(*eth) + sizeof(*ip) > data_end)
     goto DROP;
+
+  ipv4_to_mapped(sessions_key.ip_src, ip->saddr);
+  ipv4_to_mapped(sessions_key.ip_dst, ip->daddr);
+  sessions_key.proto = ip->protocol;
+  l4 = data + sizeof(*eth) + sizeof(*ip);
+
   switch (ip->protocol) {
   case IPPROTO_UDP:
     goto udp;
@@ -233,66 +423,77 @@ ip:;
   default:
     goto DROP;
   }
+}
+
+ipv6 : {
+  if (eth->dst != config->frontend_mac) {
+    goto DROP;
+  }
+
+  // extension headers are not supported
+  struct ipv6hdr *ip6 = data + sizeof(*eth);
+  if (data + sizeof(*eth) + sizeof(*ip6) > data_end)
+    goto DROP;
+
+  __builtin_memcpy(sessions_key.ip_src, &ip6->saddr,
+                   sizeof(sessions_key.ip_src));
+  __builtin_memcpy(sessions_key.ip_dst, &ip6->daddr,
+                   sizeof(sessions_key.ip_dst));
+  sessions_key.proto = ip6->nexthdr;
+  l4 = data + sizeof(*eth) + sizeof(*ip6);
+
+  switch (ip6->nexthdr) {
+  case IPPROTO_UDP:
+    goto udp;
+  case IPPROTO_TCP:
+    goto tcp;
+  case IPPROTO_ICMPV6:
+    goto icmpv6;
+  default:
+    goto DROP;
+  }
+}
 
 arp : {
   struct arp_hdr *arp = data + sizeof(*eth);
   if (data + sizeof(*eth) + sizeof(*arp) > data_end)
     goto DROP;
   if (arp->ar_op == bpf_htons(ARPOP_REQUEST)) {
-    return arp_responder(ctx, md, eth, arp);
+    return arp_responder(ctx, md, config, eth, arp);
   }
   return RX_DROP;
 }
 
 udp : {
-  struct udphdr *udp = data + sizeof(*eth) + sizeof(*ip);
-  if (data + sizeof(*eth) + sizeof(*ip) + sizeof(*udp) > data_end)
+  struct udphdr *udp = l4;
+  if ((void *)udp + sizeof(*udp) > data_end)
     return RX_DROP;
 
   pcn_log(ctx, LOG_TRACE, "UDP packet. source:%P dest:%P\n",
           bpf_ntohs(udp->source), bpf_ntohs(udp->dest));
 
-  struct sessions_value *sessions_value_p = get_sessions_value(
-      ip->saddr, ip->daddr, udp->source, udp->dest, ip->protocol);
-  if (sessions_value_p) {
-    eth->dst = sessions_value_p->mac;
-    eth->src = LB_MAC;
-
-    pcn_log(ctx, LOG_TRACE, "UDP packet, redirect to (mac = %M)\n",
-            PRINT_MAC(eth->dst));
-
-    return pcn_pkt_redirect(ctx, md, BACKEND_PORT);
-  } else {
-    goto DROP;
-  }
+  sessions_key.port_src = udp->source;
+  sessions_key.port_dst = udp->dest;
+  goto balance;
 }
 
 tcp : {
-  struct tcphdr *tcp = data + sizeof(*eth) + sizeof(*ip);
-  if (data + sizeof(*eth) + sizeof(*ip) + sizeof(*tcp) > data_end)
+  struct tcphdr *tcp = l4;
+  if ((void *)tcp + sizeof(*tcp) > data_end)
     return RX_DROP;
 
   pcn_log(ctx, LOG_TRACE, "TCP packet, source: %P dest: %P\n",
           bpf_ntohs(tcp->source), bpf_ntohs(tcp->dest));
 
-  struct sessions_value *sessions_value_p = get_sessions_value(
-      ip->saddr, ip->daddr, tcp->source, tcp->dest, ip->protocol);
-  if (sessions_value_p) {
-    eth->dst = sessions_value_p->mac;
-    eth->src = LB_MAC;
-
-    pcn_log(ctx, LOG_TRACE, "TCP packet, redirect to (mac = %M)\n",
-            PRINT_MAC(eth->dst));
-
-    return pcn_pkt_redirect(ctx, md, BACKEND_PORT);
-  } else {
-    goto DROP;
-  }
+  sessions_key.port_src = tcp->source;
+  sessions_key.port_dst = tcp->dest;
+  new_session = tcp->syn && !tcp->ack;
+  goto balance;
 }
 
 icmp : {
-  struct icmphdr *icmp = data + sizeof(*eth) + sizeof(*ip);
-  if (data + sizeof(*eth) + sizeof(*ip) + sizeof(*icmp) > data_end)
+  struct icmphdr *icmp = l4;
+  if ((void *)icmp + sizeof(*icmp) > data_end)
     return RX_DROP;
 
   pcn_log(ctx, LOG_TRACE, "ICMP packet type: %d code: %d\n", icmp->type,
@@ -303,19 +504,39 @@ icmp : {
   // Only manage ICMP Request and Reply
   if (!((icmp->type == ICMP_ECHO) || (icmp->type == ICMP_ECHOREPLY)))
     goto DROP;
-  struct sessions_value *sessions_value_p =
-      get_sessions_value(ip->saddr, ip->daddr, 0, 0, ip->protocol);
-  if (sessions_value_p) {
-    eth->dst = sessions_value_p->mac;
-    eth->src = LB_MAC;
+  goto balance;
+}
+
+icmpv6 : {
+  struct icmp6hdr *icmp6 = l4;
+  if ((void *)icmp6 + sizeof(*icmp6) > data_end)
+    return RX_DROP;
+
+  // Only manage ICMPv6 Echo Request and Reply
+  if (!((icmp6->icmp6_type == ICMPV6_ECHO_REQUEST) ||
+        (icmp6->icmp6_type == ICMPV6_ECHO_REPLY)))
+    goto DROP;
+  goto balance;
+}
 
-    pcn_log(ctx, LOG_TRACE, "ICMP packet, redirect to (mac = %M)\n",
-            PRINT_MAC(eth->dst));
+balance : {
+  struct service_tables *tables = get_service(&sessions_key);
+  if (!tables) {
+    pcn_log(ctx, LOG_TRACE, "no service for the packet\n");
+    goto DROP;
+  }
 
-    return pcn_pkt_redirect(ctx, md, BACKEND_PORT);
-  } else {
+  __be64 mac = get_backend_mac(&sessions_key, tables, new_session);
+  if (!mac) {
     goto DROP;
   }
+
+  eth->dst = mac;
+  eth->src = LB_MAC;
+
+  pcn_log(ctx, LOG_TRACE, "redirect to (mac = %M)\n", PRINT_MAC(eth->dst));
+
+  return pcn_pkt_redirect(ctx, md, config->backend_port);
 }
 
 DROP:;
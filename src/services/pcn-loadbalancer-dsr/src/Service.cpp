@@ -0,0 +1,423 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "Service.h"
+#include "Lbdsr.h"
+#include "polycube/services/maglev.h"
+
+#include <arpa/inet.h>
+#include <time.h>
+#include <cstring>
+
+using namespace polycube::service;
+
+const std::string Service::EBPF_SERVICE_MAP = "services";
+const std::string Service::EBPF_MAGLEV_MAP = "maglev_tables";
+const uint32_t Service::MAGLEV_TABLE_SIZE = 4093;
+const uint16_t Service::MAX_SERVICES = 128;
+const uint32_t Service::MAX_POOLS = 1024;
+const uint32_t Service::NO_TABLE = 0xffffffff;
+
+Service::Service(Lbdsr &parent, const ServiceJsonObject &conf)
+    : parent_(parent),
+      all_pools_(false),
+      maglev_buffer_(0),
+      in_kernel_(false) {
+  logger()->info("Creating Service instance");
+
+  vip_ = conf.getVip();
+  vport_ = conf.getVport();
+  proto_ = conf.getProto();
+
+  if (conf.nameIsSet()) {
+    setName(conf.getName());
+  }
+
+  if ((proto_ == ServiceProtoEnum::ICMP || proto_ == ServiceProtoEnum::ALL) &&
+      vport_ != 0) {
+    throw std::runtime_error(
+        "ICMP and ALL services require 0 as virtual port");
+  }
+
+  init();
+
+  try {
+    for (auto &i : conf.getBackend()) {
+      service_backends_.emplace(std::piecewise_construct,
+                                std::forward_as_tuple(i.getId()),
+                                std::forward_as_tuple(*this, i));
+    }
+
+    // all the servers are added at once, the tables are built only here
+    updateLookupTables();
+  } catch (...) {
+    cleanup();
+    throw;
+  }
+}
+
+Service::Service(Lbdsr &parent, const std::string &vip)
+    : parent_(parent),
+      vip_(vip),
+      vport_(0),
+      proto_(ServiceProtoEnum::ALL),
+      all_pools_(true),
+      maglev_buffer_(0),
+      in_kernel_(false) {
+  logger()->info("Creating Service instance of the frontend vip {0}", vip);
+
+  init();
+
+  try {
+    updateLookupTables();
+  } catch (...) {
+    cleanup();
+    throw;
+  }
+}
+
+/*
+ * Builds the key of the service in the datapath and takes the resources of
+ * the service: a slot of the maglev_tables map and, for IPv4 services, the
+ * vip the ARP responder answers for.
+ */
+
+void Service::init() {
+  memset(&service_key_, 0, sizeof(service_key_));
+  service_key_.port = htons(vport_);
+  service_key_.proto = convertProtoToNumber(proto_);
+
+  if (inet_pton(AF_INET6, vip_.c_str(), service_key_.ip) != 1) {
+    uint32_t ipv4;
+    if (inet_pton(AF_INET, vip_.c_str(), &ipv4) != 1) {
+      throw std::runtime_error("Invalid vip " + vip_);
+    }
+    service_key_.ip[2] = htonl(0xffff);
+    service_key_.ip[3] = ipv4;
+  }
+
+  maglev_slot_ = parent_.acquireMaglevSlot();
+
+  if (isIpv4()) {
+    parent_.acquireVipAddress(service_key_.ip[3]);
+  }
+}
+
+Service::~Service() {
+  cleanup();
+}
+
+void Service::cleanup() {
+  removeServiceFromKernelMap();
+
+  if (isIpv4()) {
+    parent_.releaseVipAddress(service_key_.ip[3]);
+  }
+
+  parent_.releaseMaglevSlot(maglev_slot_);
+}
+
+bool Service::isIpv4() {
+  return service_key_.ip[0] == 0 && service_key_.ip[1] == 0 &&
+         service_key_.ip[2] == htonl(0xffff);
+}
+
+void Service::update(const ServiceJsonObject &conf) {
+  // This method updates all the object/parameter in Service object specified in
+  // the conf JsonObject.
+  // You can modify this implementation.
+
+  if (conf.nameIsSet()) {
+    setName(conf.getName());
+  }
+
+  if (conf.backendIsSet()) {
+    for (auto &i : conf.getBackend()) {
+      auto id = i.getId();
+      auto m = getBackend(id);
+      m->update(i);
+    }
+  }
+}
+
+ServiceJsonObject Service::toJsonObject() {
+  ServiceJsonObject conf;
+
+  conf.setName(getName());
+  conf.setVip(getVip());
+  conf.setVport(getVport());
+  conf.setProto(getProto());
+
+  for (auto &i : getBackendList()) {
+    conf.addServiceBackend(i->toJsonObject());
+  }
+
+  return conf;
+}
+
+std::string Service::getName() {
+  // This method retrieves the name value.
+  return service_name_;
+}
+
+void Service::setName(const std::string &value) {
+  // This method set the name value.
+  service_name_ = value;
+}
+
+std::string Service::getVip() {
+  // This method retrieves the vip value.
+  return vip_;
+}
+
+uint16_t Service::getVport() {
+  // This method retrieves the vport value.
+  return vport_;
+}
+
+ServiceProtoEnum Service::getProto() {
+  // This method retrieves the proto value.
+  return proto_;
+}
+
+void Service::removeServiceFromKernelMap() {
+  logger()->trace("Removing service from service map");
+
+  auto services_table =
+      parent_.get_hash_table<vip, service_tables>(EBPF_SERVICE_MAP);
+
+  try {
+    services_table.remove(service_key_);
+  } catch (...) {
+    // the service had no servers with a weight
+  }
+  in_kernel_ = false;
+}
+
+/*
+ * Builds the Maglev lookup tables of the service and writes them in the
+ * buffer of its slot that is not used by the datapath, then switches the
+ * service to it with a single update of the services map.
+ * The servers are identified by their id in the pool; servers that are not
+ * in the pool get no entries, and the fallback table only has the ACTIVE
+ * servers. It must be called every time the servers of the service, their
+ * weights or their states change.
+ * The tables replaced by the update are passed to the datapath as well, so
+ * that in stateless mode the sessions that were already open keep their
+ * server; they are dropped by the datapath after the grace-period of the
+ * cube, or before their buffer is written again.
+ */
+
+void Service::updateLookupTables() {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  std::vector<uint32_t> ids;
+  std::vector<MaglevBackend> servers;
+  std::vector<MaglevBackend> active_servers;
+
+  auto add_server = [&](uint32_t id, uint16_t weight) {
+    if (!parent_.hasPool(id)) {
+      weight = 0;
+    }
+    bool active = parent_.getPoolState(id) == BackendPoolStateEnum::ACTIVE;
+    ids.push_back(id);
+    servers.push_back({std::to_string(id), weight});
+    active_servers.push_back({std::to_string(id), active ? weight : 0});
+  };
+
+  if (all_pools_) {
+    for (auto id : parent_.getPoolIds()) {
+      add_server(id, 1);
+    }
+  } else {
+    // service_backends_ is sorted, so that the same set of servers always
+    // gives the same lookup table
+    for (auto &it : service_backends_) {
+      add_server(it.first, it.second.getWeight());
+    }
+  }
+
+  std::vector<int> table = maglevPopulate(servers, MAGLEV_TABLE_SIZE);
+  if (table.empty()) {
+    // No server can receive traffic
+    removeServiceFromKernelMap();
+    return;
+  }
+
+  std::vector<int> fallback = maglevPopulate(active_servers, MAGLEV_TABLE_SIZE);
+  if (fallback.empty()) {
+    // No server is ACTIVE, the new sessions are still sent to the servers
+    // that are not DOWN
+    fallback = table;
+  }
+
+  auto services_table =
+      parent_.get_hash_table<vip, service_tables>(EBPF_SERVICE_MAP);
+
+  uint32_t current =
+      (maglev_slot_ * 2 + maglev_buffer_) * 2 * MAGLEV_TABLE_SIZE;
+  if (in_kernel_) {
+    services_table.set(service_key_, {current, NO_TABLE, 0});
+  }
+
+  uint8_t buffer = maglev_buffer_ ^ 1;
+  uint32_t first = (maglev_slot_ * 2 + buffer) * 2 * MAGLEV_TABLE_SIZE;
+
+  std::vector<uint32_t> keys(2 * MAGLEV_TABLE_SIZE);
+  std::vector<uint32_t> values(2 * MAGLEV_TABLE_SIZE);
+  for (size_t i = 0; i < MAGLEV_TABLE_SIZE; i++) {
+    keys[i] = first + i;
+    values[i] = ids[table[i]];
+    keys[MAGLEV_TABLE_SIZE + i] = first + MAGLEV_TABLE_SIZE + i;
+    values[MAGLEV_TABLE_SIZE + i] = ids[fallback[i]];
+  }
+
+  unsigned int count = keys.size();
+  if (parent_.get_raw_table(EBPF_MAGLEV_MAP)
+          .update_batch(keys.data(), values.data(), &count) != 0) {
+    // batch operations are not supported (older kernels)
+    auto maglev_tables = parent_.get_array_table<uint32_t>(EBPF_MAGLEV_MAP);
+    for (size_t i = 0; i < keys.size(); i++) {
+      maglev_tables.set(keys[i], values[i]);
+    }
+  }
+
+  // same clock as bpf_ktime_get_ns()
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  uint64_t expires =
+      (now.tv_sec + parent_.getGracePeriod()) * 1000000000ULL + now.tv_nsec;
+  services_table.set(service_key_,
+                     {first, in_kernel_ ? current : NO_TABLE, expires});
+  maglev_buffer_ = buffer;
+  in_kernel_ = true;
+
+  logger()->debug("[Service] Lookup tables of service {0}, {1}, {2} updated",
+                  getVip(), getVport(),
+                  ServiceJsonObject::ServiceProtoEnum_to_string(getProto()));
+}
+
+uint8_t Service::convertProtoToNumber(const ServiceProtoEnum &proto) {
+  switch (proto) {
+  case ServiceProtoEnum::ICMP:
+    return 1;
+  case ServiceProtoEnum::TCP:
+    return 6;
+  case ServiceProtoEnum::UDP:
+    return 17;
+  case ServiceProtoEnum::ALL:
+    // the datapath uses 0 to match any protocol
+    return 0;
+  }
+}
+
+ServiceProtoEnum Service::convertNumberToProto(const uint8_t proto) {
+  if (proto == 1)
+    return ServiceProtoEnum::ICMP;
+
+  if (proto == 6)
+    return ServiceProtoEnum::TCP;
+
+  if (proto == 17)
+    return ServiceProtoEnum::UDP;
+
+  return ServiceProtoEnum::ALL;
+}
+
+std::shared_ptr<spdlog::logger> Service::logger() {
+  return parent_.logger();
+}
+
+std::shared_ptr<ServiceBackend> Service::getBackend(const uint32_t &id) {
+  if (service_backends_.count(id) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
+  return std::shared_ptr<ServiceBackend>(&service_backends_.at(id),
+                                         [](ServiceBackend *) {});
+}
+
+std::vector<std::shared_ptr<ServiceBackend>> Service::getBackendList() {
+  std::vector<std::shared_ptr<ServiceBackend>> backends_vect;
+  for (auto &it : service_backends_)
+    backends_vect.push_back(getBackend(it.first));
+
+  return backends_vect;
+}
+
+void Service::addBackend(const uint32_t &id,
+                         const ServiceBackendJsonObject &conf) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  if (all_pools_) {
+    throw std::runtime_error(
+        "The servers of the frontend vip are all the servers of the pool");
+  }
+
+  if (service_backends_.count(id) != 0) {
+    throw std::runtime_error("Server " + std::to_string(id) +
+                             " already exists in the service");
+  }
+
+  service_backends_.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(id),
+                            std::forward_as_tuple(*this, conf));
+
+  updateLookupTables();
+}
+
+void Service::addBackendList(
+    const std::vector<ServiceBackendJsonObject> &conf) {
+  for (auto &i : conf) {
+    uint32_t id_ = i.getId();
+    addBackend(id_, i);
+  }
+}
+
+void Service::replaceBackend(const uint32_t &id,
+                             const ServiceBackendJsonObject &conf) {
+  delBackend(id);
+  uint32_t id_ = conf.getId();
+  addBackend(id_, conf);
+}
+
+void Service::replaceBackendList(
+    const std::vector<ServiceBackendJsonObject> &conf) {
+  delBackendList();
+  addBackendList(conf);
+}
+
+void Service::delBackend(const uint32_t &id) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  if (service_backends_.count(id) == 0) {
+    throw std::runtime_error("There are no entries associated with that key");
+  }
+
+  service_backends_.erase(id);
+  updateLookupTables();
+}
+
+void Service::delBackendList() {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
+  if (!service_backends_.empty()) {
+    service_backends_.clear();
+    removeServiceFromKernelMap();
+  }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/ServiceInterface.h"
+
+#include <spdlog/spdlog.h>
+#include "ServiceBackend.h"
+
+#include <map>
+
+class Lbdsr;
+
+using namespace io::swagger::server::model;
+
+/* definitions copied from datapath */
+struct vip {
+  uint32_t ip[4];  // IPv4 addresses are mapped (::ffff:a.b.c.d)
+  uint16_t port;
+  uint8_t proto;
+  uint8_t pad;
+} __attribute__((packed));
+
+struct service_tables {
+  uint32_t table;
+  uint32_t prev_table;    // NO_TABLE if there is none
+  uint64_t prev_expires;  // CLOCK_MONOTONIC, ns
+} __attribute__((packed));
+
+class Service : public ServiceInterface {
+  friend class Lbdsr;
+  friend class ServiceBackend;
+
+ public:
+  Service(Lbdsr &parent, const ServiceJsonObject &conf);
+  // service whose servers are all the servers of the pool, with weight 1
+  Service(Lbdsr &parent, const std::string &vip);
+  virtual ~Service();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const ServiceJsonObject &conf) override;
+  ServiceJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Service name
+  /// </summary>
+  std::string getName() override;
+  void setName(const std::string &value) override;
+
+  /// <summary>
+  /// Virtual IP (vip) of the service where clients connect to (IPv4 or IPv6)
+  /// </summary>
+  std::string getVip() override;
+
+  /// <summary>
+  /// Port of the virtual server where clients connect to (0 matches any port,
+  /// it must be 0 for ICMP and ALL services)
+  /// </summary>
+  uint16_t getVport() override;
+
+  /// <summary>
+  /// Upper-layer protocol associated with the service
+  /// </summary>
+  ServiceProtoEnum getProto() override;
+
+  /// <summary>
+  /// Servers of the backend pool that serve the requests of this service
+  /// </summary>
+  std::shared_ptr<ServiceBackend> getBackend(const uint32_t &id) override;
+  std::vector<std::shared_ptr<ServiceBackend>> getBackendList() override;
+  void addBackend(const uint32_t &id,
+                  const ServiceBackendJsonObject &conf) override;
+  void addBackendList(
+      const std::vector<ServiceBackendJsonObject> &conf) override;
+  void replaceBackend(const uint32_t &id,
+                      const ServiceBackendJsonObject &conf) override;
+  void replaceBackendList(
+      const std::vector<ServiceBackendJsonObject> &conf) override;
+  void delBackend(const uint32_t &id) override;
+  void delBackendList() override;
+
+  typedef std::tuple<std::string, uint16_t, uint8_t> ServiceKey;
+
+  static ServiceProtoEnum convertNumberToProto(const uint8_t proto);
+  static uint8_t convertProtoToNumber(const ServiceProtoEnum &proto);
+
+  // entries of the Maglev lookup table of each service (prime)
+  static const uint32_t MAGLEV_TABLE_SIZE;
+  // max number of services, each of them has its own lookup tables
+  static const uint16_t MAX_SERVICES;
+  // size of the pool_macs and backend_states maps (max pool id + 1)
+  static const uint32_t MAX_POOLS;
+  static const uint32_t NO_TABLE;
+
+ private:
+  Lbdsr &parent_;
+  std::map<uint32_t, ServiceBackend> service_backends_;
+
+  static const std::string EBPF_SERVICE_MAP;
+  static const std::string EBPF_MAGLEV_MAP;
+
+  std::string service_name_;
+  std::string vip_;
+  uint16_t vport_;
+  ServiceProtoEnum proto_;
+  vip service_key_;
+  // true for the service of the frontend vip, that uses all the servers
+  bool all_pools_;
+
+  // slot of the service in the maglev_tables map, which holds two buffers
+  // for each slot: the one used by the datapath and the next one. Each buffer
+  // has the lookup table of all the servers followed by the fallback lookup
+  // table of the ACTIVE servers
+  uint16_t maglev_slot_;
+  uint8_t maglev_buffer_;
+  // true if the service is in the datapath, then the buffer in use holds its
+  // tables
+  bool in_kernel_;
+
+  void init();
+  void cleanup();
+  bool isIpv4();
+  void updateLookupTables();
+  void removeServiceFromKernelMap();
+};
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "ServiceBackend.h"
+#include "Lbdsr.h"
+
+ServiceBackend::ServiceBackend(Service &parent,
+                               const ServiceBackendJsonObject &conf)
+    : parent_(parent) {
+  logger()->info("Creating ServiceBackend instance");
+
+  id_ = conf.getId();
+  weight_ = conf.weightIsSet() ? conf.getWeight() : 1;
+}
+
+ServiceBackend::~ServiceBackend() {}
+
+void ServiceBackend::update(const ServiceBackendJsonObject &conf) {
+  // This method updates all the object/parameter in ServiceBackend object
+  // specified in the conf JsonObject.
+  // You can modify this implementation.
+
+  if (conf.weightIsSet()) {
+    setWeight(conf.getWeight());
+  }
+}
+
+ServiceBackendJsonObject ServiceBackend::toJsonObject() {
+  ServiceBackendJsonObject conf;
+
+  conf.setId(getId());
+  conf.setWeight(getWeight());
+
+  return conf;
+}
+
+uint32_t ServiceBackend::getId() {
+  // This method retrieves the id value.
+  return id_;
+}
+
+uint16_t ServiceBackend::getWeight() {
+  // This method retrieves the weight value.
+  return weight_;
+}
+
+void ServiceBackend::setWeight(const uint16_t &value) {
+  // This method set the weight value.
+  if (weight_ == value) {
+    return;
+  }
+  weight_ = value;
+  parent_.updateLookupTables();
+}
+
+std::shared_ptr<spdlog::logger> ServiceBackend::logger() {
+  return parent_.logger();
+}
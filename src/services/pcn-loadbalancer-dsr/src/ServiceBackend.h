@@ -0,0 +1,51 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/ServiceBackendInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class Service;
+
+using namespace io::swagger::server::model;
+
+class ServiceBackend : public ServiceBackendInterface {
+ public:
+  ServiceBackend(Service &parent, const ServiceBackendJsonObject &conf);
+  virtual ~ServiceBackend();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const ServiceBackendJsonObject &conf) override;
+  ServiceBackendJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// id of the server in the backend pool
+  /// </summary>
+  uint32_t getId() override;
+
+  /// <summary>
+  /// Weight of the server in the service
+  /// </summary>
+  uint16_t getWeight() override;
+  void setWeight(const uint16_t &value) override;
+
+ private:
+  Service &parent_;
+  uint32_t id_;
+  uint16_t weight_;
+};
@@ -185,6 +185,179 @@ Response create_lbdsr_ports_list_by_id_handler(
   }
 }
 
+Response create_lbdsr_service_backend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceBackendJsonObject unique_value { request_body };
+
+    unique_value.setId(unique_id);
+    create_lbdsr_service_backend_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_lbdsr_service_backend_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  // Getting the body param
+  std::vector<ServiceBackendJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceBackendJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceBackendJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    create_lbdsr_service_backend_list_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_lbdsr_service_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceJsonObject unique_value { request_body };
+
+    unique_value.setVip(unique_vip);
+    unique_value.setVport(unique_vport);
+    unique_value.setProto(unique_proto_);
+    create_lbdsr_service_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_lbdsr_service_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ServiceJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    create_lbdsr_service_list_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_lbdsr_backend_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -299,6 +472,145 @@ Response delete_lbdsr_ports_list_by_id_handler(
   }
 }
 
+Response delete_lbdsr_service_backend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    delete_lbdsr_service_backend_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response delete_lbdsr_service_backend_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    delete_lbdsr_service_backend_list_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response delete_lbdsr_service_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    delete_lbdsr_service_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response delete_lbdsr_service_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_lbdsr_service_list_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbdsr_algorithm_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -402,6 +714,31 @@ Response read_lbdsr_backend_pool_mac_by_id_handler(
   }
 }
 
+Response read_lbdsr_backend_pool_state_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_lbdsr_backend_pool_state_by_id(unique_name, unique_id);
+    nlohmann::json response_body;
+    response_body = BackendPoolJsonObject::BackendPoolStateEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbdsr_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -470,18 +807,35 @@ Response read_lbdsr_frontend_vip_by_id_handler(
   }
 }
 
-Response read_lbdsr_list_by_id_handler(
+Response read_lbdsr_grace_period_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
-
+  // Getting the path params
+  std::string unique_name { name };
 
   try {
 
-    auto x = read_lbdsr_list_by_id();
+    auto x = read_lbdsr_grace_period_by_id(unique_name);
     nlohmann::json response_body;
-    for (auto &i : x) {
-      response_body += i.toJson();
-    }
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbdsr_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+
+
+  try {
+
+    auto x = read_lbdsr_list_by_id();
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
     return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
@@ -557,187 +911,288 @@ Response read_lbdsr_ports_type_by_id_handler(
   }
 }
 
-Response replace_lbdsr_backend_by_id_handler(
+Response read_lbdsr_service_backend_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    BackendJsonObject unique_value { request_body };
 
-    replace_lbdsr_backend_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+    auto x = read_lbdsr_service_backend_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_backend_pool_by_id_handler(
+Response read_lbdsr_service_backend_list_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
-  uint32_t unique_id;
+  std::string unique_vip;
   for (size_t i = 0; i < num_keys; ++i) {
-    if (!strcmp(keys[i].name, "id")) {
-      unique_id = keys[i].value.uint32;
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
       break;
     }
   }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
 
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    BackendPoolJsonObject unique_value { request_body };
 
-    unique_value.setId(unique_id);
-    replace_lbdsr_backend_pool_by_id(unique_name, unique_id, unique_value);
-    return { kOk, nullptr };
+    auto x = read_lbdsr_service_backend_list_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_backend_pool_list_by_id_handler(
+Response read_lbdsr_service_backend_weight_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
-  // Getting the body param
-  std::vector<BackendPoolJsonObject> unique_value;
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
 
-  try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    std::vector<BackendPoolJsonObject> unique_value;
-    for (auto &j : request_body) {
-      BackendPoolJsonObject a { j };
-      unique_value.push_back(a);
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
     }
-    replace_lbdsr_backend_pool_list_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_lbdsr_service_backend_weight_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_by_id_handler(
+Response read_lbdsr_service_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    LbdsrJsonObject unique_value { request_body };
 
-    unique_value.setName(unique_name);
-    replace_lbdsr_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+    auto x = read_lbdsr_service_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_frontend_by_id_handler(
+Response read_lbdsr_service_list_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    FrontendJsonObject unique_value { request_body };
 
-    replace_lbdsr_frontend_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+    auto x = read_lbdsr_service_list_by_id(unique_name);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_ports_by_id_handler(
+Response read_lbdsr_service_name_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
-  std::string unique_portsName;
+  std::string unique_vip;
   for (size_t i = 0; i < num_keys; ++i) {
-    if (!strcmp(keys[i].name, "ports_name")) {
-      unique_portsName = std::string { keys[i].value.string };
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
       break;
     }
   }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
 
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    PortsJsonObject unique_value { request_body };
 
-    unique_value.setName(unique_portsName);
-    replace_lbdsr_ports_by_id(unique_name, unique_portsName, unique_value);
-    return { kOk, nullptr };
+    auto x = read_lbdsr_service_name_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response replace_lbdsr_ports_list_by_id_handler(
+Response read_lbdsr_session_mode_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
-  // Getting the body param
-  std::vector<PortsJsonObject> unique_value;
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // Getting the body param
-    std::vector<PortsJsonObject> unique_value;
-    for (auto &j : request_body) {
-      PortsJsonObject a { j };
-      unique_value.push_back(a);
-    }
-    replace_lbdsr_ports_list_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+
+    auto x = read_lbdsr_session_mode_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = LbdsrJsonObject::LbdsrSessionModeEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_algorithm_by_id_handler(
+Response read_lbdsr_session_table_size_by_id_handler(
   const char *name, const Key *keys,
-  size_t num_keys ,
-  const char *value) {
+  size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
 
   try {
-    auto request_body = nlohmann::json::parse(std::string { value });
-    // The conversion is done automatically by the json library
-    std::string unique_value = request_body;
-    update_lbdsr_algorithm_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+
+    auto x = read_lbdsr_session_table_size_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_backend_by_id_handler(
+Response replace_lbdsr_backend_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
@@ -749,14 +1204,14 @@ Response update_lbdsr_backend_by_id_handler(
     // Getting the body param
     BackendJsonObject unique_value { request_body };
 
-    update_lbdsr_backend_by_id(unique_name, unique_value);
+    replace_lbdsr_backend_by_id(unique_name, unique_value);
     return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_backend_pool_by_id_handler(
+Response replace_lbdsr_backend_pool_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
@@ -777,14 +1232,14 @@ Response update_lbdsr_backend_pool_by_id_handler(
     BackendPoolJsonObject unique_value { request_body };
 
     unique_value.setId(unique_id);
-    update_lbdsr_backend_pool_by_id(unique_name, unique_id, unique_value);
+    replace_lbdsr_backend_pool_by_id(unique_name, unique_id, unique_value);
     return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_backend_pool_list_by_id_handler(
+Response replace_lbdsr_backend_pool_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
@@ -801,14 +1256,14 @@ Response update_lbdsr_backend_pool_list_by_id_handler(
       BackendPoolJsonObject a { j };
       unique_value.push_back(a);
     }
-    update_lbdsr_backend_pool_list_by_id(unique_name, unique_value);
+    replace_lbdsr_backend_pool_list_by_id(unique_name, unique_value);
     return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_by_id_handler(
+Response replace_lbdsr_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
@@ -821,14 +1276,14 @@ Response update_lbdsr_by_id_handler(
     LbdsrJsonObject unique_value { request_body };
 
     unique_value.setName(unique_name);
-    update_lbdsr_by_id(unique_name, unique_value);
+    replace_lbdsr_by_id(unique_name, unique_value);
     return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_frontend_by_id_handler(
+Response replace_lbdsr_frontend_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
@@ -840,26 +1295,404 @@ Response update_lbdsr_frontend_by_id_handler(
     // Getting the body param
     FrontendJsonObject unique_value { request_body };
 
-    update_lbdsr_frontend_by_id(unique_name, unique_value);
+    replace_lbdsr_frontend_by_id(unique_name, unique_value);
     return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response update_lbdsr_frontend_mac_by_id_handler(
+Response replace_lbdsr_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
   const char *value) {
   // Getting the path params
   std::string unique_name { name };
+  std::string unique_portsName;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "ports_name")) {
+      unique_portsName = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
 
   try {
     auto request_body = nlohmann::json::parse(std::string { value });
-    // The conversion is done automatically by the json library
-    std::string unique_value = request_body;
-    update_lbdsr_frontend_mac_by_id(unique_name, unique_value);
-    return { kOk, nullptr };
+    // Getting the body param
+    PortsJsonObject unique_value { request_body };
+
+    unique_value.setName(unique_portsName);
+    replace_lbdsr_ports_by_id(unique_name, unique_portsName, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_lbdsr_ports_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<PortsJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<PortsJsonObject> unique_value;
+    for (auto &j : request_body) {
+      PortsJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    replace_lbdsr_ports_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_lbdsr_service_backend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceBackendJsonObject unique_value { request_body };
+
+    unique_value.setId(unique_id);
+    replace_lbdsr_service_backend_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_lbdsr_service_backend_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  // Getting the body param
+  std::vector<ServiceBackendJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceBackendJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceBackendJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    replace_lbdsr_service_backend_list_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_lbdsr_service_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceJsonObject unique_value { request_body };
+
+    unique_value.setVip(unique_vip);
+    unique_value.setVport(unique_vport);
+    unique_value.setProto(unique_proto_);
+    replace_lbdsr_service_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response replace_lbdsr_service_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ServiceJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    replace_lbdsr_service_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_algorithm_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    std::string unique_value = request_body;
+    update_lbdsr_algorithm_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_backend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    BackendJsonObject unique_value { request_body };
+
+    update_lbdsr_backend_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_backend_pool_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    BackendPoolJsonObject unique_value { request_body };
+
+    unique_value.setId(unique_id);
+    update_lbdsr_backend_pool_by_id(unique_name, unique_id, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_backend_pool_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<BackendPoolJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<BackendPoolJsonObject> unique_value;
+    for (auto &j : request_body) {
+      BackendPoolJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    update_lbdsr_backend_pool_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_backend_pool_state_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    BackendPoolStateEnum unique_value_ = BackendPoolJsonObject::string_to_BackendPoolStateEnum(request_body);
+    update_lbdsr_backend_pool_state_by_id(unique_name, unique_id, unique_value_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    LbdsrJsonObject unique_value { request_body };
+
+    unique_value.setName(unique_name);
+    update_lbdsr_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_frontend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    FrontendJsonObject unique_value { request_body };
+
+    update_lbdsr_frontend_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_frontend_mac_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    std::string unique_value = request_body;
+    update_lbdsr_frontend_mac_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
@@ -883,6 +1716,24 @@ Response update_lbdsr_frontend_vip_by_id_handler(
   }
 }
 
+Response update_lbdsr_grace_period_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_lbdsr_grace_period_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_lbdsr_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -983,6 +1834,273 @@ Response update_lbdsr_ports_type_by_id_handler(
   }
 }
 
+Response update_lbdsr_service_backend_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceBackendJsonObject unique_value { request_body };
+
+    unique_value.setId(unique_id);
+    update_lbdsr_service_backend_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_service_backend_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  // Getting the body param
+  std::vector<ServiceBackendJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceBackendJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceBackendJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    update_lbdsr_service_backend_list_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_service_backend_weight_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  uint32_t unique_id;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "id")) {
+      unique_id = keys[i].value.uint32;
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint16_t unique_value = request_body;
+    update_lbdsr_service_backend_weight_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_id, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_service_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    ServiceJsonObject unique_value { request_body };
+
+    unique_value.setVip(unique_vip);
+    unique_value.setVport(unique_vport);
+    unique_value.setProto(unique_proto_);
+    update_lbdsr_service_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_service_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  // Getting the body param
+  std::vector<ServiceJsonObject> unique_value;
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    std::vector<ServiceJsonObject> unique_value;
+    for (auto &j : request_body) {
+      ServiceJsonObject a { j };
+      unique_value.push_back(a);
+    }
+    update_lbdsr_service_list_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbdsr_service_name_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    std::string unique_value = request_body;
+    update_lbdsr_service_name_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 
 Response lbdsr_backend_pool_list_by_id_help(
   const char *name, const Key *keys, size_t num_keys) {
@@ -1010,6 +2128,49 @@ Response lbdsr_ports_list_by_id_help(
   return { kOk, ::strdup(val.dump().c_str()) };
 }
 
+Response lbdsr_service_backend_list_by_id_help(
+  const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  nlohmann::json val = read_lbdsr_service_backend_list_by_id_get_list(unique_name, unique_vip, unique_vport, unique_proto_);
+
+  return { kOk, ::strdup(val.dump().c_str()) };
+}
+
+Response lbdsr_service_list_by_id_help(
+  const char *name, const Key *keys, size_t num_keys) {
+  // Getting the path params
+  std::string unique_name { name };
+  nlohmann::json val = read_lbdsr_service_list_by_id_get_list(unique_name);
+
+  return { kOk, ::strdup(val.dump().c_str()) };
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,8 @@
 #include "FrontendJsonObject.h"
 #include "LbdsrJsonObject.h"
 #include "PortsJsonObject.h"
+#include "ServiceBackendJsonObject.h"
+#include "ServiceJsonObject.h"
 #include <vector>
 
 
@@ -44,6 +46,10 @@ Response create_lbdsr_by_id_handler(const char *name, const Key *keys, size_t nu
 Response create_lbdsr_frontend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbdsr_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbdsr_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbdsr_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbdsr_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbdsr_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbdsr_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_lbdsr_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbdsr_backend_pool_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbdsr_backend_pool_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -51,19 +57,33 @@ Response delete_lbdsr_by_id_handler(const char *name, const Key *keys, size_t nu
 Response delete_lbdsr_frontend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbdsr_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbdsr_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbdsr_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbdsr_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbdsr_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbdsr_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_algorithm_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_backend_pool_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_backend_pool_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_backend_pool_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_backend_pool_state_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_frontend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_frontend_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_frontend_vip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_grace_period_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbdsr_ports_type_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_backend_weight_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_session_mode_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbdsr_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_lbdsr_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbdsr_backend_pool_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbdsr_backend_pool_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -71,22 +91,36 @@ Response replace_lbdsr_by_id_handler(const char *name, const Key *keys, size_t n
 Response replace_lbdsr_frontend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbdsr_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbdsr_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbdsr_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbdsr_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbdsr_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbdsr_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_algorithm_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_backend_pool_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_backend_pool_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_backend_pool_state_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_frontend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_frontend_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_frontend_vip_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_grace_period_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbdsr_ports_type_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_backend_weight_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbdsr_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response lbdsr_backend_pool_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response lbdsr_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response lbdsr_ports_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
+Response lbdsr_service_backend_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
+Response lbdsr_service_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 
 
 #ifdef __cplusplus
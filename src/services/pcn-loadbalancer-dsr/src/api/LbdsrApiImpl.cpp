@@ -200,6 +200,88 @@ create_lbdsr_ports_list_by_id(const std::string &name, const std::vector<PortsJs
   lbdsr->addPortsList(value);
 }
 
+/**
+* @brief   Create backend by ID
+*
+* Create operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+create_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->addBackend(id, value);
+}
+
+/**
+* @brief   Create backend by ID
+*
+* Create operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+create_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  service->addBackendList(value);
+}
+
+/**
+* @brief   Create service by ID
+*
+* Create operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+create_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value) {
+  auto lbdsr = get_cube(name);
+
+  lbdsr->addService(vip, vport, proto, value);
+}
+
+/**
+* @brief   Create service by ID
+*
+* Create operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+create_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value) {
+  auto lbdsr = get_cube(name);
+  lbdsr->addServiceList(value);
+}
+
 /**
 * @brief   Delete backend by ID
 *
@@ -304,6 +386,84 @@ delete_lbdsr_ports_list_by_id(const std::string &name) {
   lbdsr->delPortsList();
 }
 
+/**
+* @brief   Delete backend by ID
+*
+* Delete operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+*
+* Responses:
+*
+*/
+void
+delete_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->delBackend(id);
+}
+
+/**
+* @brief   Delete backend by ID
+*
+* Delete operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+*
+*/
+void
+delete_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  service->delBackendList();
+}
+
+/**
+* @brief   Delete service by ID
+*
+* Delete operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+*
+*/
+void
+delete_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbdsr = get_cube(name);
+
+  lbdsr->delService(vip, vport, proto);
+}
+
+/**
+* @brief   Delete service by ID
+*
+* Delete operation of resource: service*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_lbdsr_service_list_by_id(const std::string &name) {
+  auto lbdsr = get_cube(name);
+  lbdsr->delServiceList();
+}
+
 /**
 * @brief   Read algorithm by ID
 *
@@ -398,6 +558,26 @@ read_lbdsr_backend_pool_mac_by_id(const std::string &name, const uint32_t &id) {
 
 }
 
+/**
+* @brief   Read state by ID
+*
+* Read operation of resource: state*
+*
+* @param[in] name ID of name
+* @param[in] id ID of id
+*
+* Responses:
+* BackendPoolStateEnum
+*/
+BackendPoolStateEnum
+read_lbdsr_backend_pool_state_by_id(const std::string &name, const uint32_t &id) {
+  auto lbdsr = get_cube(name);
+  auto backend = lbdsr->getBackend();
+  auto pool = backend->getPool(id);
+  return pool->getState();
+
+}
+
 /**
 * @brief   Read lbdsr by ID
 *
@@ -467,6 +647,23 @@ read_lbdsr_frontend_vip_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read grace-period by ID
+*
+* Read operation of resource: grace-period*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbdsr_grace_period_by_id(const std::string &name) {
+  auto lbdsr = get_cube(name);
+  return lbdsr->getGracePeriod();
+
+}
+
 /**
 * @brief   Read ports by ID
 *
@@ -524,6 +721,170 @@ read_lbdsr_ports_type_by_id(const std::string &name, const std::string &portsNam
 
 }
 
+/**
+* @brief   Read backend by ID
+*
+* Read operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+*
+* Responses:
+* ServiceBackendJsonObject
+*/
+ServiceBackendJsonObject
+read_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  return service->getBackend(id)->toJsonObject();
+
+}
+
+/**
+* @brief   Read backend by ID
+*
+* Read operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+* std::vector<ServiceBackendJsonObject>
+*/
+std::vector<ServiceBackendJsonObject>
+read_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  auto &&backend = service->getBackendList();
+  std::vector<ServiceBackendJsonObject> m;
+  for(auto &i : backend)
+    m.push_back(i->toJsonObject());
+  return m;
+}
+
+/**
+* @brief   Read weight by ID
+*
+* Read operation of resource: weight*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+*
+* Responses:
+* uint16_t
+*/
+uint16_t
+read_lbdsr_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  auto backend = service->getBackend(id);
+  return backend->getWeight();
+
+}
+
+/**
+* @brief   Read service by ID
+*
+* Read operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+* ServiceJsonObject
+*/
+ServiceJsonObject
+read_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbdsr = get_cube(name);
+  return lbdsr->getService(vip, vport, proto)->toJsonObject();
+
+}
+
+/**
+* @brief   Read service by ID
+*
+* Read operation of resource: service*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::vector<ServiceJsonObject>
+*/
+std::vector<ServiceJsonObject>
+read_lbdsr_service_list_by_id(const std::string &name) {
+  auto lbdsr = get_cube(name);
+  auto &&service = lbdsr->getServiceList();
+  std::vector<ServiceJsonObject> m;
+  for(auto &i : service)
+    m.push_back(i->toJsonObject());
+  return m;
+}
+
+/**
+* @brief   Read name by ID
+*
+* Read operation of resource: name*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+* std::string
+*/
+std::string
+read_lbdsr_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  return service->getName();
+
+}
+
+/**
+* @brief   Read session-mode by ID
+*
+* Read operation of resource: session-mode*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* LbdsrSessionModeEnum
+*/
+LbdsrSessionModeEnum
+read_lbdsr_session_mode_by_id(const std::string &name) {
+  auto lbdsr = get_cube(name);
+  return lbdsr->getSessionMode();
+
+}
+
+/**
+* @brief   Read session-table-size by ID
+*
+* Read operation of resource: session-table-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbdsr_session_table_size_by_id(const std::string &name) {
+  auto lbdsr = get_cube(name);
+  return lbdsr->getSessionTableSize();
+
+}
+
 /**
 * @brief   Replace backend by ID
 *
@@ -631,6 +992,88 @@ replace_lbdsr_ports_list_by_id(const std::string &name, const std::vector<PortsJ
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Replace backend by ID
+*
+* Replace operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+replace_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->replaceBackend(id, value);
+}
+
+/**
+* @brief   Replace backend by ID
+*
+* Replace operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+replace_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->replaceBackendList(value);
+}
+
+/**
+* @brief   Replace service by ID
+*
+* Replace operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+replace_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value) {
+  auto lbdsr = get_cube(name);
+
+  lbdsr->replaceService(vip, vport, proto, value);
+}
+
+/**
+* @brief   Replace service by ID
+*
+* Replace operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+replace_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
 /**
 * @brief   Update algorithm by ID
 *
@@ -705,6 +1148,27 @@ update_lbdsr_backend_pool_list_by_id(const std::string &name, const std::vector<
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Update state by ID
+*
+* Update operation of resource: state*
+*
+* @param[in] name ID of name
+* @param[in] id ID of id
+* @param[in] value Administrative state of the backend server of the pool
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_backend_pool_state_by_id(const std::string &name, const uint32_t &id, const BackendPoolStateEnum &value) {
+  auto lbdsr = get_cube(name);
+  auto backend = lbdsr->getBackend();
+  auto pool = backend->getPool(id);
+
+  pool->setState(value);
+}
+
 /**
 * @brief   Update lbdsr by ID
 *
@@ -780,6 +1244,24 @@ update_lbdsr_frontend_vip_by_id(const std::string &name, const std::string &valu
   frontend->setVip(value);
 }
 
+/**
+* @brief   Update grace-period by ID
+*
+* Update operation of resource: grace-period*
+*
+* @param[in] name ID of name
+* @param[in] value Time the lookup tables replaced by an update of the pool are kept, in STATELESS mode the TCP sessions without packets in this time may move to another server; it applies to the following updates
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_grace_period_by_id(const std::string &name, const uint32_t &value) {
+  auto lbdsr = get_cube(name);
+
+  lbdsr->setGracePeriod(value);
+}
+
 /**
 * @brief   Update lbdsr by ID
 *
@@ -851,6 +1333,133 @@ update_lbdsr_ports_type_by_id(const std::string &name, const std::string &portsN
   ports->setType(value);
 }
 
+/**
+* @brief   Update backend by ID
+*
+* Update operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  auto backend = service->getBackend(id);
+
+  backend->update(value);
+}
+
+/**
+* @brief   Update backend by ID
+*
+* Update operation of resource: backend*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value backendbody object
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
+/**
+* @brief   Update weight by ID
+*
+* Update operation of resource: weight*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] id ID of id
+* @param[in] value Weight of the server in the service
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const uint16_t &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+  auto backend = service->getBackend(id);
+
+  backend->setWeight(value);
+}
+
+/**
+* @brief   Update service by ID
+*
+* Update operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->update(value);
+}
+
+/**
+* @brief   Update service by ID
+*
+* Update operation of resource: service*
+*
+* @param[in] name ID of name
+* @param[in] value servicebody object
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value) {
+  throw std::runtime_error("Method not supported");
+}
+
+/**
+* @brief   Update name by ID
+*
+* Update operation of resource: name*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] value Service name
+*
+* Responses:
+*
+*/
+void
+update_lbdsr_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &value) {
+  auto lbdsr = get_cube(name);
+  auto service = lbdsr->getService(vip, vport, proto);
+
+  service->setName(value);
+}
+
 
 
 /*
@@ -888,6 +1497,39 @@ std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_ports_list_
   return r;
 }
 
+std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_service_backend_list_by_id_get_list(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  std::vector<nlohmann::fifo_map<std::string, std::string>> r;
+  auto &&lbdsr = get_cube(name);
+  auto &&service = lbdsr->getService(vip, vport, proto);
+
+  auto &&backend = service->getBackendList();
+  for(auto &i : backend) {
+    nlohmann::fifo_map<std::string, std::string> keys;
+
+    keys["id"] = std::to_string(i->getId());
+
+    r.push_back(keys);
+  }
+  return r;
+}
+
+std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_service_list_by_id_get_list(const std::string &name) {
+  std::vector<nlohmann::fifo_map<std::string, std::string>> r;
+  auto &&lbdsr = get_cube(name);
+
+  auto &&service = lbdsr->getServiceList();
+  for(auto &i : service) {
+    nlohmann::fifo_map<std::string, std::string> keys;
+
+    keys["vip"] = i->getVip();
+    keys["vport"] = std::to_string(i->getVport());
+    keys["proto"] = ServiceJsonObject::ServiceProtoEnum_to_string(i->getProto());
+
+    r.push_back(keys);
+  }
+  return r;
+}
+
 
 }
 
@@ -31,6 +31,8 @@
 #include "FrontendJsonObject.h"
 #include "LbdsrJsonObject.h"
 #include "PortsJsonObject.h"
+#include "ServiceBackendJsonObject.h"
+#include "ServiceJsonObject.h"
 #include <vector>
 
 namespace io {
@@ -48,6 +50,10 @@ namespace LbdsrApiImpl {
   void create_lbdsr_frontend_by_id(const std::string &name, const FrontendJsonObject &value);
   void create_lbdsr_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void create_lbdsr_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
+  void create_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value);
+  void create_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
+  void create_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
+  void create_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
   void delete_lbdsr_backend_by_id(const std::string &name);
   void delete_lbdsr_backend_pool_by_id(const std::string &name, const uint32_t &id);
   void delete_lbdsr_backend_pool_list_by_id(const std::string &name);
@@ -55,19 +61,33 @@ namespace LbdsrApiImpl {
   void delete_lbdsr_frontend_by_id(const std::string &name);
   void delete_lbdsr_ports_by_id(const std::string &name, const std::string &portsName);
   void delete_lbdsr_ports_list_by_id(const std::string &name);
+  void delete_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id);
+  void delete_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  void delete_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  void delete_lbdsr_service_list_by_id(const std::string &name);
   std::string read_lbdsr_algorithm_by_id(const std::string &name);
   BackendJsonObject read_lbdsr_backend_by_id(const std::string &name);
   BackendPoolJsonObject read_lbdsr_backend_pool_by_id(const std::string &name, const uint32_t &id);
   std::vector<BackendPoolJsonObject> read_lbdsr_backend_pool_list_by_id(const std::string &name);
   std::string read_lbdsr_backend_pool_mac_by_id(const std::string &name, const uint32_t &id);
+  BackendPoolStateEnum read_lbdsr_backend_pool_state_by_id(const std::string &name, const uint32_t &id);
   LbdsrJsonObject read_lbdsr_by_id(const std::string &name);
   FrontendJsonObject read_lbdsr_frontend_by_id(const std::string &name);
   std::string read_lbdsr_frontend_mac_by_id(const std::string &name);
   std::string read_lbdsr_frontend_vip_by_id(const std::string &name);
+  uint32_t read_lbdsr_grace_period_by_id(const std::string &name);
   std::vector<LbdsrJsonObject> read_lbdsr_list_by_id();
   PortsJsonObject read_lbdsr_ports_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_lbdsr_ports_list_by_id(const std::string &name);
   PortsTypeEnum read_lbdsr_ports_type_by_id(const std::string &name, const std::string &portsName);
+  ServiceBackendJsonObject read_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id);
+  std::vector<ServiceBackendJsonObject> read_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  uint16_t read_lbdsr_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id);
+  ServiceJsonObject read_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  std::vector<ServiceJsonObject> read_lbdsr_service_list_by_id(const std::string &name);
+  std::string read_lbdsr_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  LbdsrSessionModeEnum read_lbdsr_session_mode_by_id(const std::string &name);
+  uint32_t read_lbdsr_session_table_size_by_id(const std::string &name);
   void replace_lbdsr_backend_by_id(const std::string &name, const BackendJsonObject &value);
   void replace_lbdsr_backend_pool_by_id(const std::string &name, const uint32_t &id, const BackendPoolJsonObject &value);
   void replace_lbdsr_backend_pool_list_by_id(const std::string &name, const std::vector<BackendPoolJsonObject> &value);
@@ -75,23 +95,37 @@ namespace LbdsrApiImpl {
   void replace_lbdsr_frontend_by_id(const std::string &name, const FrontendJsonObject &value);
   void replace_lbdsr_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void replace_lbdsr_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
+  void replace_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value);
+  void replace_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
+  void replace_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
+  void replace_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
   void update_lbdsr_algorithm_by_id(const std::string &name, const std::string &value);
   void update_lbdsr_backend_by_id(const std::string &name, const BackendJsonObject &value);
   void update_lbdsr_backend_pool_by_id(const std::string &name, const uint32_t &id, const BackendPoolJsonObject &value);
   void update_lbdsr_backend_pool_list_by_id(const std::string &name, const std::vector<BackendPoolJsonObject> &value);
+  void update_lbdsr_backend_pool_state_by_id(const std::string &name, const uint32_t &id, const BackendPoolStateEnum &value);
   void update_lbdsr_by_id(const std::string &name, const LbdsrJsonObject &value);
   void update_lbdsr_frontend_by_id(const std::string &name, const FrontendJsonObject &value);
   void update_lbdsr_frontend_mac_by_id(const std::string &name, const std::string &value);
   void update_lbdsr_frontend_vip_by_id(const std::string &name, const std::string &value);
+  void update_lbdsr_grace_period_by_id(const std::string &name, const uint32_t &value);
   void update_lbdsr_list_by_id(const std::vector<LbdsrJsonObject> &value);
   void update_lbdsr_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void update_lbdsr_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void update_lbdsr_ports_type_by_id(const std::string &name, const std::string &portsName, const PortsTypeEnum &value);
+  void update_lbdsr_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const ServiceBackendJsonObject &value);
+  void update_lbdsr_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
+  void update_lbdsr_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const uint32_t &id, const uint16_t &value);
+  void update_lbdsr_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
+  void update_lbdsr_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
+  void update_lbdsr_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &value);
 
   /* help related */
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_backend_pool_list_by_id_get_list(const std::string &name);
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_list_by_id_get_list();
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_ports_list_by_id_get_list(const std::string &name);
+  std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_service_backend_list_by_id_get_list(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbdsr_service_list_by_id_get_list(const std::string &name);
 
 }
 }
@@ -40,5 +40,11 @@ public:
   /// MAC address of the backend server of the pool
   /// </summary>
   virtual std::string getMac() = 0;
+
+  /// <summary>
+  /// Administrative state of the backend server of the pool
+  /// </summary>
+  virtual BackendPoolStateEnum getState() = 0;
+  virtual void setState(const BackendPoolStateEnum &value) = 0;
 };
 
@@ -25,6 +25,7 @@
 #include "../Backend.h"
 #include "../Frontend.h"
 #include "../Ports.h"
+#include "../Service.h"
 
 using namespace io::swagger::server::model;
 
@@ -66,5 +67,32 @@ public:
   virtual void addBackend(const BackendJsonObject &value) = 0;
   virtual void replaceBackend(const BackendJsonObject &conf) = 0;
   virtual void delBackend() = 0;
+
+  /// <summary>
+  /// Maximum number of sessions, in STATELESS mode of the sessions whose server changed (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getSessionTableSize() = 0;
+
+  /// <summary>
+  /// Time the lookup tables replaced by an update of the pool are kept, in STATELESS mode the TCP sessions without packets in this time may move to another server; it applies to the following updates
+  /// </summary>
+  virtual uint32_t getGracePeriod() = 0;
+  virtual void setGracePeriod(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Services (i.e., virtual ip:protocol:port) exported to the clients
+  /// </summary>
+  virtual std::shared_ptr<Service> getService(const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) = 0;
+  virtual std::vector<std::shared_ptr<Service>> getServiceList() = 0;
+  virtual void addService(const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &conf) = 0;
+  virtual void addServiceList(const std::vector<ServiceJsonObject> &conf) = 0;
+  virtual void replaceService(const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &conf) = 0;
+  virtual void delService(const std::string &vip,const uint16_t &vport,const ServiceProtoEnum &proto) = 0;
+  virtual void delServiceList() = 0;
+
+  /// <summary>
+  /// Session handling: STATEFUL keeps an entry of the session table for each session, STATELESS selects the server hashing each packet and keeps in the session table only the TCP sessions whose server changed after an update of the pool (can be set only at creation)
+  /// </summary>
+  virtual LbdsrSessionModeEnum getSessionMode() = 0;
 };
 
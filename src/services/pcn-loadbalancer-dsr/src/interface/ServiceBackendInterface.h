@@ -0,0 +1,45 @@
+/**
+* lbdsr API
+* lbdsr API generated from lbdsr.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ServiceBackendInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/ServiceBackendJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class ServiceBackendInterface {
+public:
+
+  virtual void update(const ServiceBackendJsonObject &conf) = 0;
+  virtual ServiceBackendJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// id of the server in the backend pool
+  /// </summary>
+  virtual uint32_t getId() = 0;
+
+  /// <summary>
+  /// Weight of the server in the service
+  /// </summary>
+  virtual uint16_t getWeight() = 0;
+  virtual void setWeight(const uint16_t &value) = 0;
+};
+
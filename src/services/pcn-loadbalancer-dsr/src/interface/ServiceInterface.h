@@ -0,0 +1,68 @@
+/**
+* lbdsr API
+* lbdsr API generated from lbdsr.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ServiceInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/ServiceJsonObject.h"
+
+#include "../ServiceBackend.h"
+
+using namespace io::swagger::server::model;
+
+class ServiceInterface {
+public:
+
+  virtual void update(const ServiceJsonObject &conf) = 0;
+  virtual ServiceJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Service name
+  /// </summary>
+  virtual std::string getName() = 0;
+  virtual void setName(const std::string &value) = 0;
+
+  /// <summary>
+  /// Virtual IP (vip) of the service where clients connect to (IPv4 or IPv6)
+  /// </summary>
+  virtual std::string getVip() = 0;
+
+  /// <summary>
+  /// Port of the virtual server where clients connect to (0 matches any port, it must be 0 for ICMP and ALL services)
+  /// </summary>
+  virtual uint16_t getVport() = 0;
+
+  /// <summary>
+  /// Upper-layer protocol associated with the service. &#39;ALL&#39; matches any protocol and requires 0 as vport
+  /// </summary>
+  virtual ServiceProtoEnum getProto() = 0;
+
+  /// <summary>
+  /// Servers of the backend pool that serve the requests of this service
+  /// </summary>
+  virtual std::shared_ptr<ServiceBackend> getBackend(const uint32_t &id) = 0;
+  virtual std::vector<std::shared_ptr<ServiceBackend>> getBackendList() = 0;
+  virtual void addBackend(const uint32_t &id, const ServiceBackendJsonObject &conf) = 0;
+  virtual void addBackendList(const std::vector<ServiceBackendJsonObject> &conf) = 0;
+  virtual void replaceBackend(const uint32_t &id, const ServiceBackendJsonObject &conf) = 0;
+  virtual void replaceBackendList(const std::vector<ServiceBackendJsonObject> &conf) = 0;
+  virtual void delBackend(const uint32_t &id) = 0;
+  virtual void delBackendList() = 0;
+};
+
@@ -25,12 +25,15 @@ namespace model {
 BackendPoolJsonObject::BackendPoolJsonObject() {
   m_idIsSet = false;
   m_macIsSet = false;
+  m_state = BackendPoolStateEnum::ACTIVE;
+  m_stateIsSet = true;
 }
 
 BackendPoolJsonObject::BackendPoolJsonObject(const nlohmann::json &val) :
   JsonObjectBase(val) {
   m_idIsSet = false;
   m_macIsSet = false;
+  m_stateIsSet = false;
 
 
   if (val.count("id")) {
@@ -40,6 +43,10 @@ BackendPoolJsonObject::BackendPoolJsonObject(const nlohmann::json &val) :
   if (val.count("mac")) {
     setMac(val.at("mac").get<std::string>());
   }
+
+  if (val.count("state")) {
+    setState(string_to_BackendPoolStateEnum(val.at("state").get<std::string>()));
+  }
 }
 
 nlohmann::json BackendPoolJsonObject::toJson() const {
@@ -56,6 +63,10 @@ nlohmann::json BackendPoolJsonObject::toJson() const {
     val["mac"] = m_mac;
   }
 
+  if (m_stateIsSet) {
+    val["state"] = BackendPoolStateEnum_to_string(m_state);
+  }
+
   return val;
 }
 
@@ -89,6 +100,46 @@ bool BackendPoolJsonObject::macIsSet() const {
 
 
 
+BackendPoolStateEnum BackendPoolJsonObject::getState() const {
+  return m_state;
+}
+
+void BackendPoolJsonObject::setState(BackendPoolStateEnum value) {
+  m_state = value;
+  m_stateIsSet = true;
+}
+
+bool BackendPoolJsonObject::stateIsSet() const {
+  return m_stateIsSet;
+}
+
+void BackendPoolJsonObject::unsetState() {
+  m_stateIsSet = false;
+}
+
+std::string BackendPoolJsonObject::BackendPoolStateEnum_to_string(const BackendPoolStateEnum &value){
+  switch(value) {
+  case BackendPoolStateEnum::ACTIVE:
+    return std::string("active");
+  case BackendPoolStateEnum::DRAINING:
+    return std::string("draining");
+  case BackendPoolStateEnum::DOWN:
+    return std::string("down");
+  default:
+    throw std::runtime_error("Bad BackendPool state");
+  }
+}
+
+BackendPoolStateEnum BackendPoolJsonObject::string_to_BackendPoolStateEnum(const std::string &str){
+  if (JsonObjectBase::iequals("active", str))
+    return BackendPoolStateEnum::ACTIVE;
+  if (JsonObjectBase::iequals("draining", str))
+    return BackendPoolStateEnum::DRAINING;
+  if (JsonObjectBase::iequals("down", str))
+    return BackendPoolStateEnum::DOWN;
+  throw std::runtime_error("BackendPool state is invalid");
+}
+
 
 }
 }
@@ -29,6 +29,9 @@ namespace swagger {
 namespace server {
 namespace model {
 
+enum class BackendPoolStateEnum {
+  ACTIVE, DRAINING, DOWN
+};
 
 /// <summary>
 ///
@@ -55,11 +58,23 @@ public:
   void setMac(std::string value);
   bool macIsSet() const;
 
+  /// <summary>
+  /// Administrative state of the backend server of the pool
+  /// </summary>
+  BackendPoolStateEnum getState() const;
+  void setState(BackendPoolStateEnum value);
+  bool stateIsSet() const;
+  void unsetState();
+  static std::string BackendPoolStateEnum_to_string(const BackendPoolStateEnum &value);
+  static BackendPoolStateEnum string_to_BackendPoolStateEnum(const std::string &str);
+
 private:
   uint32_t m_id;
   bool m_idIsSet;
   std::string m_mac;
   bool m_macIsSet;
+  BackendPoolStateEnum m_state;
+  bool m_stateIsSet;
 };
 
 }
@@ -28,6 +28,13 @@ LbdsrJsonObject::LbdsrJsonObject() {
   m_algorithmIsSet = false;
   m_frontendIsSet = false;
   m_backendIsSet = false;
+  m_sessionTableSize = 10000;
+  m_sessionTableSizeIsSet = true;
+  m_gracePeriod = 30;
+  m_gracePeriodIsSet = true;
+  m_serviceIsSet = false;
+  m_sessionMode = LbdsrSessionModeEnum::STATEFUL;
+  m_sessionModeIsSet = true;
 }
 
 LbdsrJsonObject::LbdsrJsonObject(const nlohmann::json &val) :
@@ -37,6 +44,10 @@ LbdsrJsonObject::LbdsrJsonObject(const nlohmann::json &val) :
   m_algorithmIsSet = false;
   m_frontendIsSet = false;
   m_backendIsSet = false;
+  m_sessionTableSizeIsSet = false;
+  m_gracePeriodIsSet = false;
+  m_serviceIsSet = false;
+  m_sessionModeIsSet = false;
 
 
   if (val.count("name")) {
@@ -69,6 +80,27 @@ LbdsrJsonObject::LbdsrJsonObject(const nlohmann::json &val) :
       setBackend(newItem);
     }
   }
+
+  if (val.count("session-table-size")) {
+    setSessionTableSize(val.at("session-table-size").get<uint32_t>());
+  }
+
+  if (val.count("grace-period")) {
+    setGracePeriod(val.at("grace-period").get<uint32_t>());
+  }
+
+  if (val.count("service")) {
+    for (auto& item : val["service"]) {
+      ServiceJsonObject newItem{ item };
+      m_service.push_back(newItem);
+    }
+
+    m_serviceIsSet = true;
+  }
+
+  if (val.count("session-mode")) {
+    setSessionMode(string_to_LbdsrSessionModeEnum(val.at("session-mode").get<std::string>()));
+  }
 }
 
 nlohmann::json LbdsrJsonObject::toJson() const {
@@ -104,6 +136,29 @@ nlohmann::json LbdsrJsonObject::toJson() const {
     val["backend"] = JsonObjectBase::toJson(m_backend);
   }
 
+  if (m_sessionTableSizeIsSet) {
+    val["session-table-size"] = m_sessionTableSize;
+  }
+
+  if (m_gracePeriodIsSet) {
+    val["grace-period"] = m_gracePeriod;
+  }
+
+  {
+    nlohmann::json jsonArray;
+    for (auto& item : m_service) {
+      jsonArray.push_back(JsonObjectBase::toJson(item));
+    }
+
+    if (jsonArray.size() > 0) {
+      val["service"] = jsonArray;
+    }
+  }
+
+  if (m_sessionModeIsSet) {
+    val["session-mode"] = LbdsrSessionModeEnum_to_string(m_sessionMode);
+  }
+
   return val;
 }
 
@@ -191,6 +246,90 @@ void LbdsrJsonObject::unsetBackend() {
   m_backendIsSet = false;
 }
 
+uint32_t LbdsrJsonObject::getSessionTableSize() const {
+  return m_sessionTableSize;
+}
+
+void LbdsrJsonObject::setSessionTableSize(uint32_t value) {
+  m_sessionTableSize = value;
+  m_sessionTableSizeIsSet = true;
+}
+
+bool LbdsrJsonObject::sessionTableSizeIsSet() const {
+  return m_sessionTableSizeIsSet;
+}
+
+uint32_t LbdsrJsonObject::getGracePeriod() const {
+  return m_gracePeriod;
+}
+
+void LbdsrJsonObject::setGracePeriod(uint32_t value) {
+  m_gracePeriod = value;
+  m_gracePeriodIsSet = true;
+}
+
+bool LbdsrJsonObject::gracePeriodIsSet() const {
+  return m_gracePeriodIsSet;
+}
+
+void LbdsrJsonObject::unsetGracePeriod() {
+  m_gracePeriodIsSet = false;
+}
+
+const std::vector<ServiceJsonObject>& LbdsrJsonObject::getService() const{
+  return m_service;
+}
+
+void LbdsrJsonObject::addService(ServiceJsonObject value) {
+  m_service.push_back(value);
+  m_serviceIsSet = true;
+}
+
+
+bool LbdsrJsonObject::serviceIsSet() const {
+  return m_serviceIsSet;
+}
+
+void LbdsrJsonObject::unsetService() {
+  m_serviceIsSet = false;
+}
+
+LbdsrSessionModeEnum LbdsrJsonObject::getSessionMode() const {
+  return m_sessionMode;
+}
+
+void LbdsrJsonObject::setSessionMode(LbdsrSessionModeEnum value) {
+  m_sessionMode = value;
+  m_sessionModeIsSet = true;
+}
+
+bool LbdsrJsonObject::sessionModeIsSet() const {
+  return m_sessionModeIsSet;
+}
+
+void LbdsrJsonObject::unsetSessionMode() {
+  m_sessionModeIsSet = false;
+}
+
+std::string LbdsrJsonObject::LbdsrSessionModeEnum_to_string(const LbdsrSessionModeEnum &value){
+  switch(value) {
+  case LbdsrSessionModeEnum::STATEFUL:
+    return std::string("stateful");
+  case LbdsrSessionModeEnum::STATELESS:
+    return std::string("stateless");
+  default:
+    throw std::runtime_error("Bad Lbdsr sessionMode");
+  }
+}
+
+LbdsrSessionModeEnum LbdsrJsonObject::string_to_LbdsrSessionModeEnum(const std::string &str){
+  if (JsonObjectBase::iequals("stateful", str))
+    return LbdsrSessionModeEnum::STATEFUL;
+  if (JsonObjectBase::iequals("stateless", str))
+    return LbdsrSessionModeEnum::STATELESS;
+  throw std::runtime_error("Lbdsr sessionMode is invalid");
+}
+
 
 }
 }
@@ -26,6 +26,7 @@
 #include "FrontendJsonObject.h"
 #include "PortsJsonObject.h"
 #include "BackendJsonObject.h"
+#include "ServiceJsonObject.h"
 #include <vector>
 #include "polycube/services/cube.h"
 
@@ -34,6 +35,9 @@ namespace swagger {
 namespace server {
 namespace model {
 
+enum class LbdsrSessionModeEnum {
+  STATEFUL, STATELESS
+};
 
 /// <summary>
 ///
@@ -85,6 +89,39 @@ public:
   bool backendIsSet() const;
   void unsetBackend();
 
+  /// <summary>
+  /// Maximum number of sessions, in STATELESS mode of the sessions whose server changed (can be set only at creation)
+  /// </summary>
+  uint32_t getSessionTableSize() const;
+  void setSessionTableSize(uint32_t value);
+  bool sessionTableSizeIsSet() const;
+
+  /// <summary>
+  /// Time the lookup tables replaced by an update of the pool are kept, in STATELESS mode the TCP sessions without packets in this time may move to another server; it applies to the following updates
+  /// </summary>
+  uint32_t getGracePeriod() const;
+  void setGracePeriod(uint32_t value);
+  bool gracePeriodIsSet() const;
+  void unsetGracePeriod();
+
+  /// <summary>
+  /// Services (i.e., virtual ip:protocol:port) exported to the clients
+  /// </summary>
+  const std::vector<ServiceJsonObject>& getService() const;
+  void addService(ServiceJsonObject value);
+  bool serviceIsSet() const;
+  void unsetService();
+
+  /// <summary>
+  /// Session handling: STATEFUL keeps an entry of the session table for each session, STATELESS selects the server hashing each packet and keeps in the session table only the TCP sessions whose server changed after an update of the pool (can be set only at creation)
+  /// </summary>
+  LbdsrSessionModeEnum getSessionMode() const;
+  void setSessionMode(LbdsrSessionModeEnum value);
+  bool sessionModeIsSet() const;
+  void unsetSessionMode();
+  static std::string LbdsrSessionModeEnum_to_string(const LbdsrSessionModeEnum &value);
+  static LbdsrSessionModeEnum string_to_LbdsrSessionModeEnum(const std::string &str);
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -96,6 +133,14 @@ private:
   bool m_frontendIsSet;
   BackendJsonObject m_backend;
   bool m_backendIsSet;
+  uint32_t m_sessionTableSize;
+  bool m_sessionTableSizeIsSet;
+  uint32_t m_gracePeriod;
+  bool m_gracePeriodIsSet;
+  std::vector<ServiceJsonObject> m_service;
+  bool m_serviceIsSet;
+  LbdsrSessionModeEnum m_sessionMode;
+  bool m_sessionModeIsSet;
 };
 
 }
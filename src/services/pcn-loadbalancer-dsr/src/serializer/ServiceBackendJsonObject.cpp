@@ -0,0 +1,98 @@
+/**
+* lbdsr API
+* lbdsr API generated from lbdsr.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "ServiceBackendJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+ServiceBackendJsonObject::ServiceBackendJsonObject() {
+  m_idIsSet = false;
+  m_weight = 1;
+  m_weightIsSet = true;
+}
+
+ServiceBackendJsonObject::ServiceBackendJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_idIsSet = false;
+  m_weightIsSet = false;
+
+
+  if (val.count("id")) {
+    setId(val.at("id").get<uint32_t>());
+  }
+
+  if (val.count("weight")) {
+    setWeight(val.at("weight").get<uint16_t>());
+  }
+}
+
+nlohmann::json ServiceBackendJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_idIsSet) {
+    val["id"] = m_id;
+  }
+
+  if (m_weightIsSet) {
+    val["weight"] = m_weight;
+  }
+
+  return val;
+}
+
+uint32_t ServiceBackendJsonObject::getId() const {
+  return m_id;
+}
+
+void ServiceBackendJsonObject::setId(uint32_t value) {
+  m_id = value;
+  m_idIsSet = true;
+}
+
+bool ServiceBackendJsonObject::idIsSet() const {
+  return m_idIsSet;
+}
+
+uint16_t ServiceBackendJsonObject::getWeight() const {
+  return m_weight;
+}
+
+void ServiceBackendJsonObject::setWeight(uint16_t value) {
+  m_weight = value;
+  m_weightIsSet = true;
+}
+
+bool ServiceBackendJsonObject::weightIsSet() const {
+  return m_weightIsSet;
+}
+
+void ServiceBackendJsonObject::unsetWeight() {
+  m_weightIsSet = false;
+}
+
+
+}
+}
+}
+}
+
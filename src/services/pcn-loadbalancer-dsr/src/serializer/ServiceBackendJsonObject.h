@@ -0,0 +1,70 @@
+/**
+* lbdsr API
+* lbdsr API generated from lbdsr.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ServiceBackendJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  ServiceBackendJsonObject : public JsonObjectBase {
+public:
+  ServiceBackendJsonObject();
+  ServiceBackendJsonObject(const nlohmann::json &json);
+  ~ServiceBackendJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// id of the server in the backend pool
+  /// </summary>
+  uint32_t getId() const;
+  void setId(uint32_t value);
+  bool idIsSet() const;
+
+  /// <summary>
+  /// Weight of the server in the service
+  /// </summary>
+  uint16_t getWeight() const;
+  void setWeight(uint16_t value);
+  bool weightIsSet() const;
+  void unsetWeight();
+
+private:
+  uint32_t m_id;
+  bool m_idIsSet;
+  uint16_t m_weight;
+  bool m_weightIsSet;
+};
+
+}
+}
+}
+}
+
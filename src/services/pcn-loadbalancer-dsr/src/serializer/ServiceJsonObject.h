@@ -0,0 +1,105 @@
+/**
+* lbdsr API
+* lbdsr API generated from lbdsr.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* ServiceJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+#include "ServiceBackendJsonObject.h"
+#include <vector>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+enum class ServiceProtoEnum {
+  ICMP, TCP, UDP, ALL
+};
+
+/// <summary>
+///
+/// </summary>
+class  ServiceJsonObject : public JsonObjectBase {
+public:
+  ServiceJsonObject();
+  ServiceJsonObject(const nlohmann::json &json);
+  ~ServiceJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Service name
+  /// </summary>
+  std::string getName() const;
+  void setName(std::string value);
+  bool nameIsSet() const;
+  void unsetName();
+
+  /// <summary>
+  /// Virtual IP (vip) of the service where clients connect to (IPv4 or IPv6)
+  /// </summary>
+  std::string getVip() const;
+  void setVip(std::string value);
+  bool vipIsSet() const;
+
+  /// <summary>
+  /// Port of the virtual server where clients connect to (0 matches any port, it must be 0 for ICMP and ALL services)
+  /// </summary>
+  uint16_t getVport() const;
+  void setVport(uint16_t value);
+  bool vportIsSet() const;
+
+  /// <summary>
+  /// Upper-layer protocol associated with the service. &#39;ALL&#39; matches any protocol and requires 0 as vport
+  /// </summary>
+  ServiceProtoEnum getProto() const;
+  void setProto(ServiceProtoEnum value);
+  bool protoIsSet() const;
+  static std::string ServiceProtoEnum_to_string(const ServiceProtoEnum &value);
+  static ServiceProtoEnum string_to_ServiceProtoEnum(const std::string &str);
+
+  /// <summary>
+  /// Servers of the backend pool that serve the requests of this service
+  /// </summary>
+  const std::vector<ServiceBackendJsonObject>& getBackend() const;
+  void addServiceBackend(ServiceBackendJsonObject value);
+  bool backendIsSet() const;
+  void unsetBackend();
+
+private:
+  std::string m_name;
+  bool m_nameIsSet;
+  std::string m_vip;
+  bool m_vipIsSet;
+  uint16_t m_vport;
+  bool m_vportIsSet;
+  ServiceProtoEnum m_proto;
+  bool m_protoIsSet;
+  std::vector<ServiceBackendJsonObject> m_backend;
+  bool m_backendIsSet;
+};
+
+}
+}
+}
+}
+
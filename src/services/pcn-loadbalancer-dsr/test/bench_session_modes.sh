@@ -0,0 +1,83 @@
+#!/bin/bash
+
+# Compares the STATEFUL and STATELESS session modes under a SYN flood with
+# random source addresses: for each mode it reports the packets per second
+# forwarded to the servers and the memory of the session table.
+# It needs hping3 and bpftool.
+# usage: bench_session_modes.sh [seconds] [session-table-size]
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+duration=${1:-10}
+table_size=${2:-10000}
+
+function cleanup {
+  set +e
+  polycubectl simplebridge del br1
+  polycubectl lbdsr del lb1
+  sudo pkill -SIGTERM hping3
+  sleep 1
+  delete_veth 4
+  delete_link 2
+}
+
+trap cleanup EXIT
+
+set -e
+
+create_veth 4
+create_link 2
+
+function rx_packets {
+  local count=0
+  for i in `seq 1 3`;
+  do
+    c=$(sudo ip netns exec ns$i cat /sys/class/net/veth${i}_/statistics/rx_packets)
+    count=$((count + c))
+  done
+  echo $count
+}
+
+function bench {
+  local mode=$1
+
+  polycubectl simplebridge add br1
+  polycubectl lbdsr add lb1 session-mode=$mode session-table-size=$table_size
+
+  for i in `seq 1 4`;
+  do
+    simplebridge_add_port br1 veth$i
+  done
+  simplebridge_add_port br1 link12
+  simplebridge_add_port br1 link22
+
+  polycubectl lbdsr lb1 ports add link11 type=FRONTEND
+  polycubectl lbdsr lb1 ports add link21 type=BACKEND
+  polycubectl lbdsr lb1 ports link11 set peer=link11
+  polycubectl lbdsr lb1 ports link21 set peer=link21
+
+  for i in `seq 1 3`;
+  do
+    mac=$(sudo ip netns exec ns$i ifconfig | grep veth${i}_ | awk '{print $5}')
+    polycubectl lbdsr lb1 backend pool add $i mac=$mac
+  done
+
+  # resolve the vip before the flood
+  sudo ip netns exec ns4 ping -c 1 -W 1 10.0.0.100 > /dev/null || true
+
+  local before=$(rx_packets)
+  sudo ip netns exec ns4 timeout $duration \
+    hping3 --flood --rand-source -S -p 80 10.0.0.100 > /dev/null 2>&1 || true
+  local after=$(rx_packets)
+
+  local memlock=$(sudo bpftool map show -j | \
+    python3 -c "import json,sys; print(sum(m.get('bytes_memlock', 0) for m in json.load(sys.stdin) if m.get('name') == 'sessions_table'))")
+
+  echo "$mode: $(((after - before) / duration)) pps to the servers, session table $memlock bytes"
+
+  polycubectl lbdsr del lb1
+  polycubectl simplebridge del br1
+}
+
+bench STATEFUL
+bench STATELESS
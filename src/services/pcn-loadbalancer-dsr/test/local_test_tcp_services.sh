@@ -0,0 +1,91 @@
+#!/bin/bash
+
+#source "helpers.bash"
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function cleanup {
+  set +e
+  polycubectl simplebridge del br1
+  polycubectl lbdsr del lb1
+  sudo pkill -SIGTERM netcat
+  sleep 1
+  delete_veth 6
+  delete_link 2
+}
+
+trap cleanup EXIT
+
+set -x
+set -e
+
+create_veth 6
+create_link 2
+
+polycubectl simplebridge add br1 loglevel=TRACE
+polycubectl lbdsr add lb1 loglevel=TRACE
+
+# backend servers
+simplebridge_add_port br1 veth1
+simplebridge_add_port br1 veth2
+simplebridge_add_port br1 veth3
+
+# clients
+simplebridge_add_port br1 veth4
+simplebridge_add_port br1 veth5
+simplebridge_add_port br1 veth6
+
+#lbdsr ports
+simplebridge_add_port br1 link12
+simplebridge_add_port br1 link22
+
+#config lb
+polycubectl lbdsr lb1 ports add link11 type=FRONTEND
+polycubectl lbdsr lb1 ports add link21 type=BACKEND
+polycubectl lbdsr lb1 ports link11 set peer=link11
+polycubectl lbdsr lb1 ports link21 set peer=link21
+
+# configure webservers not to responde to arp requests, each of them serves
+# both the frontend vip and the vip of the service
+for i in `seq 1 3`;
+do
+  mac=$(sudo ip netns exec ns$i ifconfig | grep veth${i}_ | awk '{print $5}')
+  polycubectl lbdsr lb1 backend pool add $i mac=$mac
+  sudo ip netns exec ns$i sudo ifconfig lo 10.0.0.100 netmask 255.255.255.255 up
+  sudo ip netns exec ns$i sudo ip addr add 10.0.0.200/32 dev lo
+  sudo ip netns exec ns$i sudo sysctl -w net.ipv4.conf.all.arp_ignore=1
+  sudo ip netns exec ns$i sudo sysctl -w net.ipv4.conf.all.arp_announce=2
+done
+
+# the service on port 2021 of the second vip uses servers 1 and 2 only
+polycubectl lbdsr lb1 service add 10.0.0.200 2021 TCP name=service1
+polycubectl lbdsr lb1 service 10.0.0.200 2021 TCP backend add 1 weight=2
+polycubectl lbdsr lb1 service 10.0.0.200 2021 TCP backend add 2
+
+sudo ip netns exec ns1 netcat -l -k 2021 &
+sudo ip netns exec ns2 netcat -l -k 2021 &
+sudo ip netns exec ns3 netcat -l -k 2021 &
+
+sleep 1
+
+for i in `seq 4 6`;
+do
+  sudo ip netns exec ns$i netcat -nvz 10.0.0.100 2021
+  sudo ip netns exec ns$i netcat -nvz 10.0.0.200 2021
+done
+
+# there is no service on the other ports of the second vip
+set +e
+sudo ip netns exec ns4 netcat -nvz -w 2 10.0.0.200 2022
+if [ $? -eq 0 ]; then
+  exit 1
+fi
+set -e
+
+# the service is removed with its servers
+polycubectl lbdsr lb1 service del 10.0.0.200 2021 TCP
+set +e
+sudo ip netns exec ns4 netcat -nvz -w 2 10.0.0.200 2021
+if [ $? -eq 0 ]; then
+  exit 1
+fi
+set -e
@@ -0,0 +1,108 @@
+#!/bin/bash
+
+# STATELESS mode: new TCP connections opened right after an update of the
+# pool must complete on the server they were balanced to, and must not be
+# taken for connections opened before the update
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+Timeout=120
+
+function timeout_monitor() {
+   sleep "$Timeout"
+   sudo kill "$1"
+}
+
+function cleanup {
+  set +e
+  polycubectl simplebridge del br1
+  polycubectl lbdsr del lb1
+  delete_veth 9
+  delete_link 2
+  sudo pkill python
+  # kill timeout monitor when terminating:
+  sudo kill "$Timeout_monitor_pid"
+}
+
+trap cleanup EXIT
+
+set -x
+set -e
+
+timeout_monitor "$$" &
+Timeout_monitor_pid=$!
+
+create_veth 9
+create_link 2
+
+polycubectl simplebridge add br1
+polycubectl lbdsr add lb1 session-mode=STATELESS
+
+# backend servers
+for i in `seq 1 3`;
+do
+  simplebridge_add_port br1 veth$i
+done
+
+# clients
+for i in `seq 4 9`;
+do
+  simplebridge_add_port br1 veth$i
+done
+
+#lbdsr ports
+simplebridge_add_port br1 link12
+simplebridge_add_port br1 link22
+
+polycubectl lbdsr lb1 ports add link11 type=FRONTEND
+polycubectl lbdsr lb1 ports add link21 type=BACKEND
+polycubectl lbdsr lb1 ports link11 set peer=link11
+polycubectl lbdsr lb1 ports link21 set peer=link21
+
+# configure webservers not to responde to arp requests
+for i in `seq 1 3`;
+do
+  sudo ip netns exec ns$i sudo ifconfig lo 10.0.0.100 netmask 255.255.255.255 up
+  sudo ip netns exec ns$i sudo sysctl -w net.ipv4.conf.all.arp_ignore=1
+  sudo ip netns exec ns$i sudo sysctl -w net.ipv4.conf.all.arp_announce=2
+  sudo ip netns exec ns$i python "${BASH_SOURCE%/*}/server.py" &
+done
+
+mac1=$(sudo ip netns exec ns1 ifconfig | grep veth1_ | awk '{print $5}')
+mac2=$(sudo ip netns exec ns2 ifconfig | grep veth2_ | awk '{print $5}')
+mac3=$(sudo ip netns exec ns3 ifconfig | grep veth3_ | awk '{print $5}')
+polycubectl lbdsr lb1 backend pool add 1 mac=$mac1
+polycubectl lbdsr lb1 backend pool add 2 mac=$mac2
+
+sleep 3
+
+# no retries: a connection whose packets reach two servers fails
+function requests {
+  for i in `seq 4 9`;
+  do
+    for j in `seq 1 3`;
+    do
+      sudo ip netns exec ns$i wget -qO- -t 1 -T 5 10.0.0.100:8000 &> /dev/null
+    done
+  done
+}
+
+requests
+
+# the lookup table changes, about a third of the sessions move to the new
+# server
+polycubectl lbdsr lb1 backend pool add 3 mac=$mac3
+
+requests
+
+polycubectl lbdsr lb1 backend pool del 1
+
+requests
+
+# the grace period can be changed at runtime, also without keeping the
+# previous tables at all
+test $(polycubectl lbdsr lb1 grace-period show) -eq 30
+polycubectl lbdsr lb1 set grace-period=0
+polycubectl lbdsr lb1 backend pool add 1 mac=$mac1
+
+requests
@@ -0,0 +1,302 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "HealthCheck.h"
+#include "Lbrp.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+using namespace polycube::service;
+
+HealthCheck::HealthCheck(Lbrp &parent, const HealthCheckJsonObject &conf)
+    : parent_(parent), quit_thread_(false) {
+  logger()->info("Creating HealthCheck instance");
+
+  type_ = conf.getType();
+  interval_ = conf.getInterval();
+  timeout_ = conf.getTimeout();
+  http_path_ = conf.getHttpPath();
+  rise_ = conf.getRise();
+  fall_ = conf.getFall();
+
+  // the results of previous checks are not valid anymore
+  parent_.resetBackendHealth();
+
+  check_thread_ = std::thread(&HealthCheck::checkLoop, this);
+}
+
+HealthCheck::~HealthCheck() {
+  quit_thread_ = true;
+  check_thread_.join();
+}
+
+void HealthCheck::update(const HealthCheckJsonObject &conf) {
+  // This method updates all the object/parameter in HealthCheck object
+  // specified in the conf JsonObject.
+  // You can modify this implementation.
+  if (conf.intervalIsSet()) {
+    setInterval(conf.getInterval());
+  }
+  if (conf.timeoutIsSet()) {
+    setTimeout(conf.getTimeout());
+  }
+  if (conf.httpPathIsSet()) {
+    setHttpPath(conf.getHttpPath());
+  }
+  if (conf.riseIsSet()) {
+    setRise(conf.getRise());
+  }
+  if (conf.fallIsSet()) {
+    setFall(conf.getFall());
+  }
+  if (conf.typeIsSet()) {
+    setType(conf.getType());
+  }
+}
+
+HealthCheckJsonObject HealthCheck::toJsonObject() {
+  HealthCheckJsonObject conf;
+
+  conf.setType(getType());
+  conf.setInterval(getInterval());
+  conf.setTimeout(getTimeout());
+  conf.setHttpPath(getHttpPath());
+  conf.setRise(getRise());
+  conf.setFall(getFall());
+
+  return conf;
+}
+
+HealthCheckTypeEnum HealthCheck::getType() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return type_;
+}
+
+void HealthCheck::setType(const HealthCheckTypeEnum &value) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (type_ == value) {
+      return;
+    }
+    type_ = value;
+  }
+
+  // the results of the previous checks are not valid anymore
+  parent_.resetBackendHealth();
+}
+
+uint32_t HealthCheck::getInterval() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return interval_;
+}
+
+void HealthCheck::setInterval(const uint32_t &value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  interval_ = value;
+}
+
+uint32_t HealthCheck::getTimeout() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return timeout_;
+}
+
+void HealthCheck::setTimeout(const uint32_t &value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  timeout_ = value;
+}
+
+std::string HealthCheck::getHttpPath() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return http_path_;
+}
+
+void HealthCheck::setHttpPath(const std::string &value) {
+  if (value.empty() || value[0] != '/' ||
+      value.find_first_of(" \r\n") != std::string::npos) {
+    throw std::runtime_error("Invalid HTTP path " + value);
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  http_path_ = value;
+}
+
+uint8_t HealthCheck::getRise() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return rise_;
+}
+
+void HealthCheck::setRise(const uint8_t &value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  rise_ = value;
+}
+
+uint8_t HealthCheck::getFall() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return fall_;
+}
+
+void HealthCheck::setFall(const uint8_t &value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  fall_ = value;
+}
+
+void HealthCheck::checkLoop() {
+  uint32_t seconds = 0;
+  do {
+    sleep(1);
+    if (getType() == HealthCheckTypeEnum::NONE) {
+      seconds = 0;
+      continue;
+    }
+    if (++seconds >= getInterval()) {
+      seconds = 0;
+      checkBackends();
+    }
+  } while (!quit_thread_);
+}
+
+/*
+ * Backends are checked one at a time, so a round lasts up to the timeout
+ * multiplied by the number of servers that do not answer.
+ */
+void HealthCheck::checkBackends() {
+  HealthCheckTypeEnum type;
+  uint32_t timeout;
+  std::string http_path;
+  uint8_t rise, fall;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    type = type_;
+    timeout = timeout_;
+    http_path = http_path_;
+    rise = rise_;
+    fall = fall_;
+  }
+
+  // the same server can be a backend of several services
+  std::map<std::pair<uint32_t, uint16_t>, bool> results;
+  for (auto &it : parent_.getBackendStatusList()) {
+    if (quit_thread_) {
+      return;
+    }
+
+    auto &status = it.second;
+    if (status.port == 0) {
+      // backend of an ICMP service
+      continue;
+    }
+
+    auto server = std::make_pair(status.ip, status.port);
+    if (results.count(server) == 0) {
+      results[server] =
+          checkServer(type, status.ip, status.port, timeout, http_path);
+    }
+    parent_.updateBackendHealth(it.first, results[server], rise, fall);
+  }
+}
+
+// Waits for the given events on the socket until the deadline
+static bool waitSocket(int fd, short events,
+                       std::chrono::steady_clock::time_point deadline) {
+  auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+  if (remaining.count() <= 0) {
+    return false;
+  }
+
+  struct pollfd pfd = {.fd = fd, .events = events, .revents = 0};
+  return poll(&pfd, 1, remaining.count()) == 1 && (pfd.revents & events);
+}
+
+bool HealthCheck::checkServer(HealthCheckTypeEnum type, uint32_t ip,
+                              uint16_t port, uint32_t timeout,
+                              const std::string &http_path) {
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    logger()->error("[HealthCheck] Unable to create socket: {0}",
+                    std::strerror(errno));
+    return false;
+  }
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = ip;
+  addr.sin_port = htons(port);
+
+  bool success = false;
+  int err = 0;
+  socklen_t err_len = sizeof(err);
+  if ((connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0 ||
+       errno == EINPROGRESS) &&
+      waitSocket(fd, POLLOUT, deadline) &&
+      getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &err_len) == 0 && err == 0) {
+    success = true;
+  }
+
+  if (success && type == HealthCheckTypeEnum::HTTP) {
+    success = false;
+    std::string request = "GET " + http_path + " HTTP/1.0\r\nHost: " +
+                          utils::nbo_uint_to_ip_string(ip) +
+                          "\r\nConnection: close\r\n\r\n";
+
+    // only the status line of the response is needed
+    char response[64];
+    size_t len = 0;
+    if (send(fd, request.data(), request.size(), MSG_NOSIGNAL) ==
+        (ssize_t)request.size()) {
+      while (len < sizeof(response) - 1 &&
+             !memchr(response, '\n', len) &&
+             waitSocket(fd, POLLIN, deadline)) {
+        ssize_t n = recv(fd, response + len, sizeof(response) - 1 - len, 0);
+        if (n <= 0) {
+          break;
+        }
+        len += n;
+      }
+    }
+    response[len] = '\0';
+
+    int status = 0;
+    if (sscanf(response, "HTTP/%*d.%*d %d", &status) == 1) {
+      success = status >= 200 && status < 400;
+    }
+  }
+
+  close(fd);
+
+  logger()->trace("[HealthCheck] Check of {0}:{1} {2}",
+                  utils::nbo_uint_to_ip_string(ip), port,
+                  success ? "succeeded" : "failed");
+  return success;
+}
+
+std::shared_ptr<spdlog::logger> HealthCheck::logger() {
+  return parent_.logger();
+}
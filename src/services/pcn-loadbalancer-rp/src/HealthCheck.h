@@ -0,0 +1,102 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "../interface/HealthCheckInterface.h"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+class Lbrp;
+
+using namespace io::swagger::server::model;
+
+/*
+ * Checks periodically the backends of all the services (backends of ICMP
+ * services excepted), with a TCP connection or an HTTP request to the port of
+ * the backend. The result changes the state of the backend in the datapath.
+ */
+class HealthCheck : public HealthCheckInterface {
+ public:
+  HealthCheck(Lbrp &parent, const HealthCheckJsonObject &conf);
+  virtual ~HealthCheck();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const HealthCheckJsonObject &conf) override;
+  HealthCheckJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Type of health check (backends of ICMP services are not checked)
+  /// </summary>
+  HealthCheckTypeEnum getType() override;
+  void setType(const HealthCheckTypeEnum &value) override;
+
+  /// <summary>
+  /// Time between two checks of the same backend
+  /// </summary>
+  uint32_t getInterval() override;
+  void setInterval(const uint32_t &value) override;
+
+  /// <summary>
+  /// Time after which a check is considered failed
+  /// </summary>
+  uint32_t getTimeout() override;
+  void setTimeout(const uint32_t &value) override;
+
+  /// <summary>
+  /// Path requested by HTTP health checks
+  /// </summary>
+  std::string getHttpPath() override;
+  void setHttpPath(const std::string &value) override;
+
+  /// <summary>
+  /// Number of consecutive successful checks before a backend is considered UP
+  /// </summary>
+  uint8_t getRise() override;
+  void setRise(const uint8_t &value) override;
+
+  /// <summary>
+  /// Number of consecutive failed checks before a backend is considered DOWN
+  /// </summary>
+  uint8_t getFall() override;
+  void setFall(const uint8_t &value) override;
+
+ private:
+  Lbrp &parent_;
+
+  // the configuration is read by the check thread as well
+  std::mutex mutex_;
+  HealthCheckTypeEnum type_;
+  uint32_t interval_;
+  uint32_t timeout_;
+  std::string http_path_;
+  uint8_t rise_;
+  uint8_t fall_;
+
+  std::thread check_thread_;
+  std::atomic<bool> quit_thread_;
+
+  void checkLoop();
+  // checks all the backends once
+  void checkBackends();
+  bool checkServer(HealthCheckTypeEnum type, uint32_t ip, uint16_t port,
+                   uint32_t timeout, const std::string &http_path);
+};
@@ -22,19 +22,47 @@
 #include <tins/ethernetII.h>
 #include <tins/tins.h>
 
+#include <cerrno>
+#include <cstring>
+#include <numeric>
+
 using namespace Tins;
 using namespace polycube::service;
 
+// number of entries read by each batch operation on the session table
+#define SESSION_BATCH_SIZE 1024
+
 const std::string Lbrp::EBPF_IP_TO_FRONTEND_PORT_MAP = "ip_to_frontend_port";
+const std::string Lbrp::EBPF_SESSION_MAP = "session_table";
+const std::string Lbrp::EBPF_SESSION_STATS_MAP = "session_stats";
+const std::string Lbrp::EBPF_BACKEND_STATES_MAP = "backend_states";
 
 Lbrp::Lbrp(const std::string name, const LbrpJsonObject &conf)
-    : Cube(conf.getBase(), {Lbrp::buildLbrpCode(lbrp_code, conf.getPortMode())},
-           {}), lbrp_code_{Lbrp::buildLbrpCode(lbrp_code, conf.getPortMode())},
-      port_mode_{conf.getPortMode()} {
+    : Cube(conf.getBase(),
+           {Lbrp::buildLbrpCode(lbrp_code, conf.getPortMode(),
+                                conf.getSessionTable().getSize(),
+                                conf.getMaxServices())},
+           {}),
+      lbrp_code_{Lbrp::buildLbrpCode(lbrp_code, conf.getPortMode(),
+                                     conf.getSessionTable().getSize(),
+                                     conf.getMaxServices())},
+      port_mode_{conf.getPortMode()},
+      session_table_size_{conf.getSessionTable().getSize()},
+      max_services_{conf.getMaxServices()} {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [Lbrp] [%n] [%l] %v");
   logger()->info("Creating Lbrp instance in {0} port mode",
                  LbrpJsonObject::LbrpPortModeEnum_to_string(port_mode_));
 
+  for (uint32_t slot = 0; slot < max_services_; slot++) {
+    free_maglev_slots_.insert(slot);
+  }
+
+  for (uint16_t id = 0; id < Service::MAX_BACKENDS; id++) {
+    free_backend_ids_.insert(id);
+  }
+
+  addSessionTable(conf.getSessionTable());
+  addHealthCheck(conf.getHealthCheck());
   addServiceList(conf.getService());
   addSrcIpRewrite(conf.getSrcIpRewrite());
   addPortsList(conf.getPorts());
@@ -42,6 +70,8 @@ Lbrp::Lbrp(const std::string name, const LbrpJsonObject &conf)
 
 Lbrp::~Lbrp() {
   logger()->info("Destroying Lbrp instance");
+  // stop the health checks before the backends are removed
+  health_check_ = nullptr;
 }
 
 void Lbrp::update(const LbrpJsonObject &conf) {
@@ -72,6 +102,16 @@ void Lbrp::update(const LbrpJsonObject &conf) {
       m->update(i);
     }
   }
+
+  if (conf.sessionTableIsSet()) {
+    auto m = getSessionTable();
+    m->update(conf.getSessionTable());
+  }
+
+  if (conf.healthCheckIsSet()) {
+    auto m = getHealthCheck();
+    m->update(conf.getHealthCheck());
+  }
 }
 
 LbrpJsonObject Lbrp::toJsonObject() {
@@ -82,21 +122,40 @@ LbrpJsonObject Lbrp::toJsonObject() {
     conf.addService(i->toJsonObject());
   }
 
+  conf.setMaxServices(getMaxServices());
+
   conf.setSrcIpRewrite(getSrcIpRewrite()->toJsonObject());
 
   for (auto &i : getPortsList()) {
     conf.addPorts(i->toJsonObject());
   }
 
+  conf.setSessionTable(getSessionTable()->toJsonObject());
+
+  conf.setHealthCheck(getHealthCheck()->toJsonObject());
+
   return conf;
 }
 
 std::string Lbrp::buildLbrpCode(std::string const &lbrp_code,
-                                LbrpPortModeEnum port_mode) {
+                                LbrpPortModeEnum port_mode,
+                                uint32_t session_table_size,
+                                uint32_t max_services) {
+  // checked before the datapath is loaded, its maps are sized with it
+  if (max_services == 0 || max_services > Service::MAX_SERVICES) {
+    throw std::runtime_error("max-services must be between 1 and " +
+                             std::to_string(Service::MAX_SERVICES));
+  }
+  std::string maglev_defines =
+      "#define SESSION_TABLE_SIZE " + std::to_string(session_table_size) +
+      "\n" + "#define MAGLEV_TABLE_SIZE " +
+      std::to_string(Service::MAGLEV_TABLE_SIZE) + "\n" +
+      "#define MAX_MAGLEV_SERVICES " + std::to_string(max_services) + "\n" +
+      "#define MAX_BACKENDS " + std::to_string(Service::MAX_BACKENDS) + "\n";
   if (port_mode == LbrpPortModeEnum::SINGLE) {
-    return "#define SINGLE_PORT_MODE 1\n" + lbrp_code;
+    return "#define SINGLE_PORT_MODE 1\n" + maglev_defines + lbrp_code;
   }
-  return "#define SINGLE_PORT_MODE 0\n" + lbrp_code;
+  return "#define SINGLE_PORT_MODE 0\n" + maglev_defines + lbrp_code;
 }
 
 void Lbrp::flood_packet(Ports &port, PacketInMetadata &md,
@@ -347,6 +406,10 @@ void Lbrp::delPortsList() {
   }
 }
 
+uint32_t Lbrp::getMaxServices() {
+  return max_services_;
+}
+
 LbrpPortModeEnum Lbrp::getPortMode() {
   return port_mode_;
 }
@@ -379,6 +442,258 @@ void Lbrp::delSrcIpRewrite() {
   // what the hell means to remove entry in this case?
 }
 
+std::shared_ptr<SessionTable> Lbrp::getSessionTable() {
+  return session_table_;
+}
+
+void Lbrp::addSessionTable(const SessionTableJsonObject &value) {
+  session_table_ = std::make_shared<SessionTable>(*this, value);
+}
+
+void Lbrp::replaceSessionTable(const SessionTableJsonObject &conf) {
+  session_table_->update(conf);
+}
+
+void Lbrp::delSessionTable() {
+  throw std::runtime_error(
+      "[SessionTable]: Method delSessionTable not supported");
+}
+
+std::shared_ptr<HealthCheck> Lbrp::getHealthCheck() {
+  return health_check_;
+}
+
+void Lbrp::addHealthCheck(const HealthCheckJsonObject &value) {
+  health_check_ = std::make_shared<HealthCheck>(*this, value);
+}
+
+void Lbrp::replaceHealthCheck(const HealthCheckJsonObject &conf) {
+  // the running checks are stopped first
+  health_check_ = nullptr;
+  addHealthCheck(conf);
+}
+
+void Lbrp::delHealthCheck() {
+  // default values, health checks are disabled
+  replaceHealthCheck(HealthCheckJsonObject());
+}
+
+uint16_t Lbrp::addBackendStatus(const std::string &ip, uint16_t port,
+                                ServiceBackendStateEnum state) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  if (free_backend_ids_.empty()) {
+    logger()->error("[ServiceBackend] Maximum number of backends reached");
+    throw std::runtime_error("Maximum number of backends (" +
+                             std::to_string(Service::MAX_BACKENDS) +
+                             ") reached");
+  }
+  uint16_t id = *free_backend_ids_.begin();
+  free_backend_ids_.erase(free_backend_ids_.begin());
+
+  backend_status_[id] = BackendStatus{
+      .ip = utils::ip_string_to_nbo_uint(ip),
+      .port = port,
+      .state = state,
+      .health = ServiceBackendHealthEnum::UNKNOWN,
+      .successes = 0,
+      .failures = 0,
+  };
+
+  // the backend is not in the lookup tables yet
+  auto backend_states = get_array_table<uint32_t>(EBPF_BACKEND_STATES_MAP);
+  backend_states.set(id, static_cast<uint32_t>(getBackendState(id)));
+
+  return id;
+}
+
+void Lbrp::delBackendStatus(uint16_t id) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  backend_status_.erase(id);
+  free_backend_ids_.insert(id);
+}
+
+void Lbrp::setBackendStatusState(uint16_t id, ServiceBackendStateEnum state) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  auto old_state = getBackendState(id);
+  backend_status_.at(id).state = state;
+  applyBackendState(id, old_state);
+}
+
+void Lbrp::setBackendStatusPort(uint16_t id, uint16_t port) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  auto &status = backend_status_.at(id);
+  if (status.port == port) {
+    return;
+  }
+
+  // the health of the new port is not known yet
+  auto old_state = getBackendState(id);
+  status.port = port;
+  status.health = ServiceBackendHealthEnum::UNKNOWN;
+  status.successes = 0;
+  status.failures = 0;
+  applyBackendState(id, old_state);
+}
+
+ServiceBackendHealthEnum Lbrp::getBackendStatusHealth(uint16_t id) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  return backend_status_.at(id).health;
+}
+
+/*
+ * The backend is DOWN if it is administratively down or it failed the health
+ * checks, DRAINING if it is administratively draining.
+ */
+BackendState Lbrp::getBackendState(uint16_t id) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  auto &status = backend_status_.at(id);
+  if (status.state == ServiceBackendStateEnum::DOWN ||
+      status.health == ServiceBackendHealthEnum::DOWN) {
+    return BackendState::DOWN;
+  }
+  if (status.state == ServiceBackendStateEnum::DRAINING) {
+    return BackendState::DRAINING;
+  }
+  return BackendState::ACTIVE;
+}
+
+std::vector<std::pair<uint16_t, BackendStatus>> Lbrp::getBackendStatusList() {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  return std::vector<std::pair<uint16_t, BackendStatus>>(
+      backend_status_.begin(), backend_status_.end());
+}
+
+void Lbrp::updateBackendHealth(uint16_t id, bool success, uint8_t rise,
+                               uint8_t fall) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  auto it = backend_status_.find(id);
+  if (it == backend_status_.end()) {
+    // the backend was removed during the check
+    return;
+  }
+
+  auto &status = it->second;
+  auto health = status.health;
+  if (success) {
+    status.failures = 0;
+    if (status.successes < rise) {
+      status.successes++;
+    }
+    if (status.successes >= rise) {
+      health = ServiceBackendHealthEnum::UP;
+    }
+  } else {
+    status.successes = 0;
+    if (status.failures < fall) {
+      status.failures++;
+    }
+    if (status.failures >= fall) {
+      health = ServiceBackendHealthEnum::DOWN;
+    }
+  }
+
+  if (health != status.health) {
+    logger()->info("[HealthCheck] Backend {0}:{1} is {2}",
+                   utils::nbo_uint_to_ip_string(status.ip), status.port,
+                   ServiceBackendJsonObject::ServiceBackendHealthEnum_to_string(
+                       health));
+    auto old_state = getBackendState(id);
+    status.health = health;
+    applyBackendState(id, old_state);
+  }
+}
+
+void Lbrp::resetBackendHealth() {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+  for (auto &it : backend_status_) {
+    auto &status = it.second;
+    auto old_state = getBackendState(it.first);
+    status.health = ServiceBackendHealthEnum::UNKNOWN;
+    status.successes = 0;
+    status.failures = 0;
+    applyBackendState(it.first, old_state);
+  }
+}
+
+/*
+ * A backend that becomes ACTIVE can be selected as soon as its state is
+ * written, then it is added to the fallback lookup tables; a backend that is
+ * leaving the ACTIVE state is removed from the fallback lookup tables first.
+ * Sessions never see a fallback table with a backend that cannot take them.
+ */
+void Lbrp::applyBackendState(uint16_t id, BackendState old_state) {
+  auto state = getBackendState(id);
+  if (state == old_state) {
+    return;
+  }
+
+  auto backend_states = get_array_table<uint32_t>(EBPF_BACKEND_STATES_MAP);
+  if (state == BackendState::ACTIVE) {
+    backend_states.set(id, static_cast<uint32_t>(state));
+  }
+
+  for (auto &it : service_map_) {
+    auto &service = it.second;
+    for (auto &backend : service.service_backends_) {
+      if (backend.second.getStateId() == id) {
+        service.updateConsistentHashMap();
+        break;
+      }
+    }
+  }
+
+  if (state != BackendState::ACTIVE) {
+    backend_states.set(id, static_cast<uint32_t>(state));
+  }
+}
+
+std::vector<std::pair<sessions, vip>> Lbrp::getSessionEntries() {
+  std::vector<std::pair<sessions, vip>> entries;
+
+  // Batch operations read the table in a few syscalls instead of two for
+  // each entry, they are not supported by older kernels though
+  auto table = get_raw_table(EBPF_SESSION_MAP);
+  std::vector<sessions> keys(SESSION_BATCH_SIZE);
+  std::vector<vip> values(SESSION_BATCH_SIZE);
+  uint32_t in_batch = 0, out_batch = 0;
+  bool first = true;
+
+  while (true) {
+    unsigned int count = SESSION_BATCH_SIZE;
+    int ret = table.get_batch(keys.data(), values.data(), &count,
+                              first ? nullptr : &in_batch, &out_batch);
+    if (ret != 0 && errno != ENOENT) {
+      if (!first) {
+        throw std::runtime_error("Unable to read the session table: " +
+                                 std::string(std::strerror(errno)));
+      }
+      return get_hash_table<sessions, vip>(EBPF_SESSION_MAP).get_all();
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+      entries.emplace_back(keys[i], values[i]);
+    }
+
+    // ENOENT: no more entries
+    if (ret != 0) {
+      break;
+    }
+
+    in_batch = out_batch;
+    first = false;
+  }
+
+  return entries;
+}
+
+uint64_t Lbrp::getSessionsCreated() {
+  auto session_stats =
+      get_percpuarray_table<uint64_t>(EBPF_SESSION_STATS_MAP);
+  auto values = session_stats.get(0);
+  return std::accumulate(values.begin(), values.end(), (uint64_t)0);
+}
+
 std::shared_ptr<Service> Lbrp::getService(const std::string &vip,
                                           const uint16_t &vport,
                                           const ServiceProtoEnum &proto) {
@@ -419,6 +734,8 @@ std::vector<std::shared_ptr<Service>> Lbrp::getServiceList() {
 void Lbrp::addService(const std::string &vip, const uint16_t &vport,
                       const ServiceProtoEnum &proto,
                       const ServiceJsonObject &conf) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
   logger()->debug("[Service] Received request to create new service entry");
   logger()->debug("[Service] Virtual IP: {0}, virtual port: {1}, protocol: {2}",
                   vip, vport,
@@ -457,9 +774,26 @@ void Lbrp::addService(const std::string &vip, const uint16_t &vport,
     logger()->error("[Service] This service already exists");
     throw std::runtime_error("This service already exists");
   }
-  Service service = Service(*this,conf);
-  service_map_.insert(std::make_pair(key,service));
+  // The service is built in place: its backends keep a reference to it
+  service_map_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                       std::forward_as_tuple(*this, conf));
+}
+
+uint16_t Lbrp::acquireMaglevSlot() {
+  if (free_maglev_slots_.empty()) {
+    logger()->error("[Service] Maximum number of services ({0}) reached",
+                    max_services_);
+    throw std::runtime_error(
+        "Maximum number of services (" + std::to_string(max_services_) +
+        ") reached, the limit is set at creation with max-services");
+  }
+  uint16_t slot = *free_maglev_slots_.begin();
+  free_maglev_slots_.erase(free_maglev_slots_.begin());
+  return slot;
+}
 
+void Lbrp::releaseMaglevSlot(uint16_t slot) {
+  free_maglev_slots_.insert(slot);
 }
 
 void Lbrp::addServiceList(const std::vector<ServiceJsonObject> &conf) {
@@ -483,6 +817,8 @@ void Lbrp::replaceService(const std::string &vip, const uint16_t &vport,
 
 void Lbrp::delService(const std::string &vip, const uint16_t &vport,
                       const ServiceProtoEnum &proto) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
   if (proto == ServiceProtoEnum::ALL) {
     // Let's create 3 different services for TCP, UDP and ICMP
     // Let's start from TCP
@@ -24,10 +24,13 @@
 
 #include <spdlog/spdlog.h>
 
+#include "HealthCheck.h"
 #include "Ports.h"
 #include "Service.h"
+#include "SessionTable.h"
 #include "SrcIpRewrite.h"
 #include "hash_tuple.h"
+#include <map>
 #include <set>
 #include <mutex>
 
@@ -36,13 +39,32 @@ using polycube::service::CubeType;
 
 enum class SlowPathReason { ARP_REPLY = 0, FLOODING = 1 };
 
+/* definitions copied from datapath */
+enum class BackendState { ACTIVE = 0, DRAINING = 1, DOWN = 2 };
+
+// status of a backend, shared between the services and the health checks
+struct BackendStatus {
+  uint32_t ip;    // network byte order
+  uint16_t port;  // host byte order
+  ServiceBackendStateEnum state;
+  ServiceBackendHealthEnum health;
+  // consecutive health checks with the same result
+  uint8_t successes;
+  uint8_t failures;
+};
+
 class Lbrp : public polycube::service::Cube<Ports>, public LbrpInterface {
+  friend class HealthCheck;
   friend class Ports;
   friend class Service;
+  friend class SessionTable;
   friend class SrcIpRewrite;
 
  public:
-  static std::string buildLbrpCode(std::string const& lbrp_code, LbrpPortModeEnum port_mode);
+  static std::string buildLbrpCode(std::string const& lbrp_code,
+                                   LbrpPortModeEnum port_mode,
+                                   uint32_t session_table_size,
+                                   uint32_t max_services);
   Lbrp(const std::string name, const LbrpJsonObject &conf);
   virtual ~Lbrp();
 
@@ -81,6 +103,23 @@ class Lbrp : public polycube::service::Cube<Ports>, public LbrpInterface {
   void replaceSrcIpRewrite(const SrcIpRewriteJsonObject &conf) override;
   void delSrcIpRewrite() override;
 
+  /// <summary>
+  /// Table of the sessions handled by the load balancer
+  /// </summary>
+  std::shared_ptr<SessionTable> getSessionTable() override;
+  void addSessionTable(const SessionTableJsonObject &value) override;
+  void replaceSessionTable(const SessionTableJsonObject &conf) override;
+  void delSessionTable() override;
+
+  /// <summary>
+  /// Active health checks of the backend servers, performed by the control
+  /// plane
+  /// </summary>
+  std::shared_ptr<HealthCheck> getHealthCheck() override;
+  void addHealthCheck(const HealthCheckJsonObject &value) override;
+  void replaceHealthCheck(const HealthCheckJsonObject &conf) override;
+  void delHealthCheck() override;
+
   /// <summary>
   /// Entry of the ports table
   /// </summary>
@@ -105,16 +144,66 @@ class Lbrp : public polycube::service::Cube<Ports>, public LbrpInterface {
   LbrpPortModeEnum getPortMode() override;
   void setPortMode(const LbrpPortModeEnum &value) override;
 
+  /// <summary>
+  /// Maximum number of services (can be set only at creation)
+  /// </summary>
+  uint32_t getMaxServices() override;
+
   void reloadCodeWithNewPorts();
   void reloadCodeWithNewBackendPort(uint16_t backend_port_index);
   std::vector<std::shared_ptr<Ports>> getFrontendPorts();
   std::shared_ptr<Ports> getBackendPort();
 
+  // each service gets a slot for its lookup tables in the maglev_tables map
+  uint16_t acquireMaglevSlot();
+  void releaseMaglevSlot(uint16_t slot);
+
+  // each backend gets an entry in the backend_states map, the returned id
+  uint16_t addBackendStatus(const std::string &ip, uint16_t port,
+                            ServiceBackendStateEnum state);
+  void delBackendStatus(uint16_t id);
+  void setBackendStatusState(uint16_t id, ServiceBackendStateEnum state);
+  void setBackendStatusPort(uint16_t id, uint16_t port);
+  ServiceBackendHealthEnum getBackendStatusHealth(uint16_t id);
+  // state of the backend in the datapath
+  BackendState getBackendState(uint16_t id);
+
+  // reads all the entries of the session table
+  std::vector<std::pair<sessions, vip>> getSessionEntries();
+  // number of sessions created by the datapath
+  uint64_t getSessionsCreated();
+
  private:
   static const std::string EBPF_IP_TO_FRONTEND_PORT_MAP;
+  static const std::string EBPF_SESSION_MAP;
+  static const std::string EBPF_SESSION_STATS_MAP;
+  static const std::string EBPF_BACKEND_STATES_MAP;
   std::set<std::string> frontend_ip_set_;
+  // must outlive the services, which release their slot when destroyed
+  std::set<uint16_t> free_maglev_slots_;
+  std::set<uint16_t> free_backend_ids_;
+  // backends by entry of the backend_states map
+  std::map<uint16_t, BackendStatus> backend_status_;
+  // held while the services or the status of the backends are changed: the
+  // health check thread changes them as well
+  std::recursive_mutex mutex_;
   std::unordered_map<Service::ServiceKey, Service> service_map_;
   std::shared_ptr<SrcIpRewrite> src_ip_rewrite_;
+  uint32_t session_table_size_;
+  // the lookup tables of all the services are preallocated in the datapath
+  uint32_t max_services_;
+  std::shared_ptr<SessionTable> session_table_;
+  std::shared_ptr<HealthCheck> health_check_;
   LbrpPortModeEnum port_mode_;
   std::string lbrp_code_;
+
+  // Writes the new state of the backend in the datapath and updates the
+  // lookup tables of its services. Called with mutex_ held
+  void applyBackendState(uint16_t id, BackendState old_state);
+  // Updates the health of the backend with the result of a check
+  void updateBackendHealth(uint16_t id, bool success, uint8_t rise,
+                           uint8_t fall);
+  // Sets the health of all the backends to UNKNOWN (health checks disabled)
+  void resetBackendHealth();
+  std::vector<std::pair<uint16_t, BackendStatus>> getBackendStatusList();
 };
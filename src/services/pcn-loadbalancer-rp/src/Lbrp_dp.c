@@ -48,7 +48,6 @@
 */
 
 #define MAX_SERVICES 1024
-#define MAX_SESSIONS 65536
 #define MAX_FRONTENDS 1024
 
 #define IP_CSUM_OFFSET (sizeof(struct eth_hdr) + offsetof(struct iphdr, check))
@@ -67,6 +66,23 @@
 #define SINGLE_PORT_MODE 0
 #endif
 
+#ifndef SESSION_TABLE_SIZE
+#define SESSION_TABLE_SIZE 65536
+#endif
+
+#ifndef MAGLEV_TABLE_SIZE
+#define MAGLEV_TABLE_SIZE 4093
+#endif
+
+// set by the control plane from max-services
+#ifndef MAX_MAGLEV_SERVICES
+#define MAX_MAGLEV_SERVICES 128
+#endif
+
+#ifndef MAX_BACKENDS
+#define MAX_BACKENDS 4096
+#endif
+
 #ifndef BACKEND_PORT
 #define BACKEND_PORT 0
 #endif
@@ -121,56 +137,79 @@ struct backend {
   __be16 proto;
 } __attribute__((packed));
 
+struct maglev_entry {
+  __be32 ip;
+  __be16 port;
+  u16 state;  // entry of the backend in the backend_states table
+} __attribute__((packed));
+
+enum {
+  BACKEND_ACTIVE = 0,    // receives new sessions
+  BACKEND_DRAINING = 1,  // receives only packets of its sessions
+  BACKEND_DOWN = 2,      // receives no traffic
+};
+
 /*
- * This table contains multiple entries for each virtual service (i.e., virtual
- * IP / protocol / port).
- * When 'index' = 0, the value in the hash map is actually not a couple
- *   IP address / port but the number of backends (also called 'pool size')
- *   associated to that virtual service.
- * Then, for following entries (i.e., when 'index' > 0), the
- *   'struct backend' keeps the actual data (IP/port) for that backend.
+ * This table contains an entry for each virtual service (i.e., virtual
+ * IP / protocol / port), with 'index' = 0.
+ * The value is the first entry of the Maglev lookup table of that service in
+ * the 'maglev_tables' map.
  *
- * Example:
- *   VIP 1, index 0 -> Number of backends: 4
- *   VIP 1, index 1 -> Backend 2
- *   VIP 1, index 2 -> Backend 1
- *   VIP 1, index 3 -> Backend 2
- *   VIP 1, index 4 -> Backend 1
+ * The load balancing algorithm selects the backend based on an hash on the
+ * most significant fields (i.e., session id) of the packet:
  *
- *   VIP 2, index 0 -> Number of backends: 2
- *   VIP 2, index 1 -> Backend 1
- *   VIP 2, index 2 -> Backend 1
+ *   backend = maglev_tables[table + session_hash % MAGLEV_TABLE_SIZE]
  *
- *   where VIP 1 has 4 backends and VIP2 has 2 backend.
+ * The lookup tables are filled by the control plane with the Maglev
+ * consistent hashing algorithm, so that adding/removing a backend only moves
+ * few sessions among the other ones.
+ * Each service has two buffers: the control plane fills the one not in use,
+ * then switches the service to it updating this table.
+ * Each buffer holds two lookup tables: the one with all the backends, and
+ * the fallback one with the ACTIVE backends only, which is used when the
+ * backend selected in the first table cannot receive the packet:
  *
- * The number of backend in this table may be different from the number of
- * actual servers in order to keep session affinity when a server is
- * added/removed, without having to move the traffic from a backend#1
- * to a backend #2 (which will break the TCP session)
+ *   backend = maglev_tables[table + MAGLEV_TABLE_SIZE +
+ *                           session_hash % MAGLEV_TABLE_SIZE]
  *
- * The load balancing algorith will select the proper backend based on an hash
- * on the most significant fields (i.e., session id) of the packet:
- *
- *   __u32 backend_id = session_hash % pool_size + 1;
- *
- * where 'pool_size' is 4 for VIP 1.
+ * Since both tables are built with consistent hashing, sessions of ACTIVE
+ * backends are not moved when other backends are drained or go down.
  */
-BPF_TABLE("hash", struct vip, struct backend, services, MAX_SERVICES);
+BPF_TABLE("hash", struct vip, u32, services, MAX_SERVICES);
+BPF_TABLE("array", u32, struct maglev_entry, maglev_tables,
+          MAX_MAGLEV_SERVICES * 4 * MAGLEV_TABLE_SIZE);
+
+/*
+ * State of each backend, written by the control plane when the backend is
+ * drained or its health changes. A DRAINING backend still receives the
+ * packets of the sessions found in the session table.
+ */
+BPF_TABLE("array", u32, u32, backend_states, MAX_BACKENDS);
 
 /*
  *  Keeps the sessions handled by the load balancer in this table. This is
  *  needed to translate the session ID back for return traffic.
- *    __u32: key (hash the translated session: Hash(ipS | ipD=BCK | pS | pD |
- * pro) )
+ *    struct sessions: key (the translated session: ipS | ipD=BCK | pS | pD |
+ * pro)
  *    struct vip: value (virtual service ID, to be used to translate
  *         the return traffic)
  *
  *  If there's a match, the (return) source IP address/port is translated with
  *  the VIP; if there is no match, the traffic is left untouched.
- *  Note that the hash is calculated, in both directions, using the IP.dst
+ *  Note that the key is built, in both directions, using the IP.dst
  *  of the backend, not the original one (virtual IP address of the service).
+ *  The whole session is used as key, so that different sessions can never
+ *  share the same entry.
+ */
+BPF_TABLE("lru_hash", struct sessions, struct vip, session_table,
+          SESSION_TABLE_SIZE);
+
+/*
+ * Number of sessions added to the session table. Sessions are removed only
+ * when evicted by the lru table, so the control plane gets the number of
+ * evicted sessions from this counter and the number of entries in the table.
  */
-BPF_TABLE("lru_hash", __u32, struct vip, hash_session, MAX_SESSIONS);
+BPF_TABLE("percpu_array", int, u64, session_stats, 1);
 
 enum {
   FROM_FRONTEND = 0,
@@ -195,16 +234,40 @@ BPF_TABLE("hash", struct backend, struct vip, backend_to_service, MAX_SERVICES);
 
 BPF_TABLE("hash", __be32, u16, ip_to_frontend_port, MAX_FRONTENDS);
 
+/*
+ * Checks if the backend can receive the packet of the given session.
+ * The session key has the virtual service as destination.
+ */
+static inline bool backend_available(struct maglev_entry *bck,
+                                     struct sessions *key) {
+  u32 id = bck->state;
+  u32 *state = backend_states.lookup(&id);
+  if (!state || *state == BACKEND_ACTIVE) {
+    return true;
+  }
+  if (*state == BACKEND_DOWN) {
+    return false;
+  }
+
+  struct sessions session = *key;
+  session.ip_dst = bck->ip;
+  if (key->proto != ntohs(IPPROTO_ICMP)) {
+    session.port_dst = bck->port;
+  }
+  return session_table.lookup(&session) != NULL;
+}
+
 /*
  * This function is used to get the backend ip after the LoadBalancing.
- * For each packet that handled by the load balancer, we save the hash of
- * the session in the session table, to be used for the return traffic
+ * For each packet that handled by the load balancer, we save the session
+ * in the session table, to be used for the return traffic
  * (reverse proxy).
  */
-static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
-                                         __be32 ip_dst, __be16 port_src,
-                                         __be16 port_dst, __be16 proto,
-                                         __u32 pool_size) {
+static inline struct maglev_entry *get_bck_ip(struct CTXTYPE *ctx,
+                                              __be32 ip_src, __be32 ip_dst,
+                                              __be16 port_src,
+                                              __be16 port_dst, __be16 proto,
+                                              __u32 table) {
   // lookup in the sessions_table
   struct sessions sessions_key = {};
   sessions_key.ip_src = ip_src;
@@ -213,22 +276,11 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
   sessions_key.port_dst = port_dst;
   sessions_key.proto = proto;
 
-  if (!pool_size) {
-    return 0;
-  }
-
   // calculate the hashed session key
   u32 check = jhash((const void *)&sessions_key, sizeof(struct sessions),
                     JHASH_INITVAL);
-  // select the backend id
-  __u32 id = check % pool_size + 1;
-
-  struct vip v_key = {};
-
-  v_key.ip = ip_dst;
-  v_key.port = port_dst;
-  v_key.proto = proto;
-  v_key.index = id;
+  // select the entry of the lookup table
+  __u32 id = table + check % MAGLEV_TABLE_SIZE;
 
   pcn_log(
       ctx, LOG_TRACE,
@@ -236,8 +288,9 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
       ip_dst, port_dst, proto, id
   );
 
-  // Now, from the backend ID, let's get the actual backend server (IP/port)
-  struct backend *bck_value = services.lookup(&v_key);
+  // Now, from the lookup table entry, let's get the actual backend server
+  // (IP/port)
+  struct maglev_entry *bck_value = maglev_tables.lookup(&id);
   if (!bck_value) {
     pcn_log(
         ctx, LOG_ERR,
@@ -247,6 +300,15 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
     return 0;
   }
 
+  // If the backend is draining or down, the fallback table is used
+  if (!backend_available(bck_value, &sessions_key)) {
+    id += MAGLEV_TABLE_SIZE;
+    struct maglev_entry *fallback = maglev_tables.lookup(&id);
+    if (fallback) {
+      bck_value = fallback;
+    }
+  }
+
   pcn_log(ctx, LOG_TRACE,
           "Retrieved backend for the given index - (index: %d) (be_ip: %I, be_port: %P)",
           id, bck_value->ip, bck_value->port
@@ -260,7 +322,7 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
     return bck_value;
   }
 
-  // Calculate a second hash on the session, but this time we use the backend IP
+  // The session is saved using the backend as destination
   sessions_key.ip_dst = bck_value->ip;      // backend ip address
   sessions_key.port_dst = bck_value->port;  // backend port
 
@@ -268,8 +330,6 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
     sessions_key.port_dst = port_dst;
     sessions_key.port_src = port_src;
   }
-  check = jhash((const void *)&sessions_key, sizeof(struct sessions),
-                JHASH_INITVAL);
 
   struct vip v = {};
   v.ip = ip_dst;
@@ -277,10 +337,24 @@ static inline struct backend *get_bck_ip(struct CTXTYPE *ctx, __be32 ip_src,
   v.proto = proto;
   v.index = 0;
 
-  // update the session table with this entry. If the entry already exists,
-  // nothing happens.
-  // if the entry doesn't exist, it is added to the list
-  hash_session.update(&check, &v);  // hash-vip
+  // update the session table only if the entry doesn't exist yet (or it
+  // belongs to another service), so that packets of known sessions do not
+  // write the table
+  struct vip *cur = session_table.lookup(&sessions_key);
+  if (!cur) {
+    // the insert fails if another cpu added the same session meanwhile
+    if (session_table.insert(&sessions_key, &v) != 0) {
+      return bck_value;
+    }
+
+    int zero = 0;
+    u64 *created = session_stats.lookup(&zero);
+    if (created) {
+      *created += 1;
+    }
+  } else if (cur->ip != v.ip || cur->port != v.port || cur->proto != v.proto) {
+    session_table.update(&sessions_key, &v);
+  }
 
   return bck_value;
 }
@@ -463,10 +537,10 @@ LB:;
     // If there's a match, it means this is a VIP, so we need to apply the LB
     // logic
     // If doesn't match, just send the packet as is (no need to load balance)
-    struct backend *backend_value = services.lookup(&v_key);
+    u32 *table = services.lookup(&v_key);
     // The IP destination address is not a virtual service. Let's forward the
     // packet as is.
-    if (!backend_value) {
+    if (!table) {
       pcn_log(ctx, LOG_TRACE,
               "Failed service lookup: redirected as is to BACKEND port - (out_port: %d)",
               BACKEND_PORT);
@@ -474,8 +548,8 @@ LB:;
     }
 
     // Return the proper backend for this packet
-    struct backend *bck_value = get_bck_ip(ctx, ip->saddr, ip->daddr, source,
-                                           dest, ip_proto, backend_value->port);
+    struct maglev_entry *bck_value = get_bck_ip(
+        ctx, ip->saddr, ip->daddr, source, dest, ip_proto, *table);
 
     if (!bck_value) {
       pcn_log(ctx, LOG_TRACE,
@@ -572,14 +646,13 @@ LB:;
         sessions_key.port_src = source;
       }
 
-      __u32 check = jhash((const void *)&sessions_key, sizeof(struct sessions),
-                          JHASH_INITVAL);
-
-      pcn_log(ctx, LOG_TRACE, "Check in session table - (session_id: %lu)",
-              check);
+      pcn_log(ctx, LOG_TRACE,
+              "Check in session table - (src: %I:%P, dst: %I:%P)",
+              sessions_key.ip_src, sessions_key.port_src,
+              sessions_key.ip_dst, sessions_key.port_dst);
 
       // Let's check if the this session is present in the session table
-      struct vip *rev_proxy = hash_session.lookup(&check);
+      struct vip *rev_proxy = session_table.lookup(&sessions_key);
 
       // If this (return) packet belongs to a session that was handled by the
       // LB,
@@ -18,23 +18,28 @@
 
 #include "Service.h"
 #include "Lbrp.h"
+#include "polycube/services/maglev.h"
 
 #include <functional>
 #include <iostream>
-#include <random>
+#include <map>
 
 using namespace polycube::service;
 
 const std::string Service::EBPF_SERVICE_MAP = "services";
+const std::string Service::EBPF_MAGLEV_MAP = "maglev_tables";
 const std::string Service::EBPF_BACKEND_TO_SERVICE_MAP = "backend_to_service";
 const uint16_t Service::ICMP_EBPF_PORT = 0;
-const uint Service::INITIAL_BACKEND_SIZE = 10;
-const uint Service::BACKEND_REPLICAS = 3;
+const uint32_t Service::MAGLEV_TABLE_SIZE = 4093;
+const uint32_t Service::MAX_SERVICES = 1024;
+const uint16_t Service::MAX_BACKENDS = 4096;
 
 Service::Service(Lbrp &parent, const ServiceJsonObject &conf)
-    : parent_(parent), backend_size_(INITIAL_BACKEND_SIZE) {
+    : parent_(parent), maglev_buffer_(0) {
   logger()->info("Creating Service instance");
 
+  maglev_slot_ = parent_.acquireMaglevSlot();
+
   vip_ = conf.getVip();
   vport_ = conf.getVport();
   proto_ = conf.getProto();
@@ -45,14 +50,20 @@ Service::Service(Lbrp &parent, const ServiceJsonObject &conf)
 
   // FIXME: There is another option here instead of creating every backend at
   // time
-  // We could just add the backend to the matrix map and call the
-  // updateConsistentHashMap
+  // We could just add all the backends and call the updateConsistentHashMap
   // only at the end. In this way it will be called only once.
   // Now this function is called every time a new backend is added
-  addBackendList(conf.getBackend());
+  try {
+    addBackendList(conf.getBackend());
+  } catch (...) {
+    parent_.releaseMaglevSlot(maglev_slot_);
+    throw;
+  }
 }
 
-Service::~Service() {}
+Service::~Service() {
+  parent_.releaseMaglevSlot(maglev_slot_);
+}
 
 void Service::update(const ServiceJsonObject &conf) {
   // This method updates all the object/parameter in Service object specified in
@@ -84,6 +95,9 @@ ServiceJsonObject Service::toJsonObject() {
     conf.addServiceBackend(i->toJsonObject());
   }
 
+  // active-sessions is not set here: it requires a scan of the whole session
+  // table, so it is returned only when explicitly read
+
   return conf;
 }
 
@@ -112,270 +126,168 @@ uint16_t Service::getVport() {
   return vport_;
 }
 
+uint32_t Service::getActiveSessions() {
+  return countSessions(0);
+}
+
+uint32_t Service::countSessions(uint32_t backend_ip) {
+  uint32_t vip = utils::ip_string_to_nbo_uint(getVip());
+  uint16_t vport = htons(getVport());
+  uint16_t proto = htons(Service::convertProtoToNumber(getProto()));
+
+  uint32_t count = 0;
+  for (auto &entry : parent_.getSessionEntries()) {
+    auto &key = entry.first;
+    auto &value = entry.second;
+    if (value.ip != vip || value.port != vport || value.proto != proto) {
+      continue;
+    }
+    if (backend_ip != 0 && key.ip_dst != backend_ip) {
+      continue;
+    }
+    count++;
+  }
+
+  return count;
+}
+
 /*
- * This method removes all entries for a service in the datapath map
+ * This method removes the service from the datapath map, its lookup tables
+ * are not used anymore
  */
 
 void Service::removeServiceFromKernelMap() {
-  logger()->trace("Removing all elements from service map");
+  logger()->trace("Removing service from service map");
 
-  auto services_table = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
+  auto services_table = parent_.get_hash_table<vip, uint32_t>(EBPF_SERVICE_MAP);
 
-  for (uint16_t index = 0; index < backend_size_ * BACKEND_REPLICAS; index++) {
-    vip service_key{
-        .ip = utils::ip_string_to_nbo_uint(getVip()),
-        .port = htons(getVport()),
-        .proto = htons(Service::convertProtoToNumber(getProto())),
-        .index = index,
-    };
+  vip service_key{
+      .ip = utils::ip_string_to_nbo_uint(getVip()),
+      .port = htons(getVport()),
+      .proto = htons(Service::convertProtoToNumber(getProto())),
+      .index = 0,
+  };
 
+  try {
     services_table.remove(service_key);
-  }
-}
-
-void Service::removeBackendFromServiceMatrix(std::string backend_ip) {
-  int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
-  int vect_size = bkd_size * BACKEND_REPLICAS;
-  backend_matrix_[backend_ip] = getEmptyIntVector(vect_size);
-}
-
-void Service::addBackendToServiceMatrix(std::string backend_ip) {
-  int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
-  int vect_size = bkd_size * BACKEND_REPLICAS;
-  backend_matrix_[backend_ip] = getRandomIntVector(vect_size);
-  if (getProto() != ServiceProtoEnum::ICMP) {
-    // updatesrcIpRewriteMap(backend_ip);
-    // update_mapping_bcksIP(backend_ip);
+  } catch (...) {
+    // the service had no backends with a weight
   }
 }
 
 void Service::updateConsistentHashMap() {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
   logger()->debug(
       "[Service] Updating consistent hash map for service {0}, {1}, {2}",
       getVip(), getVport(),
       ServiceJsonObject::ServiceProtoEnum_to_string(getProto()));
 
-  std::vector<std::string> consistent_array = getConsistentArray();
+  // Backends are sorted, so that the same set of backends always gives the
+  // same lookup table
+  std::map<std::string, ServiceBackend *> sorted_backends;
+  for (auto &it : service_backends_) {
+    sorted_backends[it.first] = &it.second;
+  }
+
+  std::vector<ServiceBackend *> backends;
+  std::vector<MaglevBackend> maglev_backends;
+  std::vector<MaglevBackend> active_backends;
+  for (auto &it : sorted_backends) {
+    backends.push_back(it.second);
+    maglev_backends.push_back({it.first, it.second->getWeight()});
+
+    // DRAINING and DOWN backends take no new sessions
+    bool active = parent_.getBackendState(it.second->getStateId()) ==
+                  BackendState::ACTIVE;
+    active_backends.push_back({it.first, active ? it.second->getWeight() : 0});
+  }
+
+  std::vector<int> table = maglevPopulate(maglev_backends, MAGLEV_TABLE_SIZE);
+  if (table.empty()) {
+    // No backend can receive traffic
+    removeServiceFromKernelMap();
+    return;
+  }
 
-  updateKernelServiceMap(std::move(consistent_array));
+  std::vector<int> fallback =
+      maglevPopulate(active_backends, MAGLEV_TABLE_SIZE);
+  if (fallback.empty()) {
+    // No backend is ACTIVE, the new sessions are still sent to the backends
+    // that are not DOWN
+    fallback = table;
+  }
+
+  updateKernelServiceMap(backends, table, fallback);
 }
 
 /*
  * The following function is used to load and update services map in the
  * datapath.
  * The map has :
- * 	-key = struct vip: {ip, port, proto, index}
- * 	-value = struct backend: {ip, port}
+ * 	-key = struct vip: {ip, port, proto, index = 0}
+ * 	-value = first entry of the lookup table of the service in the
+ * 	 maglev_tables map
+ * The new lookup tables are written in the buffer that is not used by the
+ * datapath, then the service is switched to it with a single update, so that
+ * packets never see a partially written table. The fallback table follows the
+ * main one and is used when the backend of the main one cannot take the
+ * session.
  */
 
 void Service::updateKernelServiceMap(
-    const std::vector<std::string> consistent_array) {
-  auto services_table = parent_.get_hash_table<vip, backend>(EBPF_SERVICE_MAP);
+    const std::vector<ServiceBackend *> &backends,
+    const std::vector<int> &table, const std::vector<int> &fallback) {
+  auto services_table = parent_.get_hash_table<vip, uint32_t>(EBPF_SERVICE_MAP);
   auto backend_to_service =
       parent_.get_hash_table<backend, vip>(EBPF_BACKEND_TO_SERVICE_MAP);
-  uint16_t index = 0;
 
   vip service_key{
       .ip = utils::ip_string_to_nbo_uint(getVip()),
       .port = htons(getVport()),
       .proto = htons(Service::convertProtoToNumber(getProto())),
-      .index = index,
+      .index = 0,
   };
 
-  // This is a particular value that is used to indicate the size of the backend
-  // pool.
-  // In doesn't indicate a real backend
-  backend service_value{
-      .ip = utils::ip_string_to_nbo_uint(getVip()),
-      .port = uint16_t(consistent_array.size()),
-      .proto = 0,
-  };
-
-  services_table.set(service_key, service_value);
-
-  for (const auto &backend_ip : consistent_array) {
-    index++;
-
-    auto bck = getBackend(backend_ip);
-
-    vip key{
-        .ip = utils::ip_string_to_nbo_uint(getVip()),
-        .port = htons(getVport()),
-        .proto = htons(Service::convertProtoToNumber(getProto())),
-        .index = index,
-    };
-
+  std::vector<maglev_entry> backend_values;
+  for (auto bck : backends) {
     backend value{
         .ip = utils::ip_string_to_nbo_uint(bck->getIp()),
         .port = htons(bck->getPort()),
         .proto = htons(Service::convertProtoToNumber(getProto())),
     };
 
-    services_table.set(key, value);
-    backend_to_service.set(value, key);
+    backend_values.push_back({value.ip, value.port, bck->getStateId()});
+    backend_to_service.set(value, service_key);
   }
 
-  logger()->debug("[Service] Service map updated");
-}
+  uint8_t buffer = maglev_buffer_ ^ 1;
+  uint32_t first = (maglev_slot_ * 2 + buffer) * 2 * MAGLEV_TABLE_SIZE;
 
-/*
- * This method returns the consistent array of the service's backends
- */
-std::vector<std::string> Service::getConsistentArray() {
-  std::vector<std::string> backend_list;
-  std::vector<std::vector<int>> backend_matrix_list;
-  int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
-  int array_rows = bkd_size * BACKEND_REPLICAS;
-
-  for (const auto &s : backend_matrix_) {
-    backend_list.push_back(s.first);
-    backend_matrix_list.push_back(s.second);
+  std::vector<uint32_t> keys(2 * MAGLEV_TABLE_SIZE);
+  std::vector<maglev_entry> values(2 * MAGLEV_TABLE_SIZE);
+  for (size_t i = 0; i < MAGLEV_TABLE_SIZE; i++) {
+    keys[i] = first + i;
+    values[i] = backend_values[table[i]];
+    keys[MAGLEV_TABLE_SIZE + i] = first + MAGLEV_TABLE_SIZE + i;
+    values[MAGLEV_TABLE_SIZE + i] = backend_values[fallback[i]];
   }
 
-  // Declare the final backend list vector and initialize all elems to -1
-  std::vector<std::string> final_backend_list(array_rows, "-1");
-  // Retrieve how much entries for each backend
-  std::map<std::string, int> weight_backend_list = get_weight_backend();
-
-  int index = 0;
-  int count = 0;
-
-  /* We have to  scroll a matrix , starting from first column , first row [0,0].
-   *For each cell , i retrieve the number stored in that cell and lookup in the
-   *final_backend_list if it exists or
-   * not , if not , it is saved in this array(final_backend_list) and we go on
-   *in the matrix by checking the next cell [0,1] row0 column 1 ;
-   * if Yes, we ho to the next row -> [1,0] , retrieve the number in this cell ,
-   *lookup in the final_backend_list and so on ;
-   * All of this continue until the final_backend_list is filed;
-   * Each Matrix's column stores a range of number from 0 to bkd_size
-   * Matrix cells can have 2 types of number :
-   * 1) -2  -> go next colum (continue command to go next for loop and x++ keep
-   *allign matrix column and vector of backend's name)
-   * 2) X>0 -> check if u can store it in the final_backend_list
-   * final_backend_list has 2 types of numbers:
-   * 1) -1  -> u can store the number , in this case i check if the entry can be
-   *assigned to this backend by checking the number in
-   *weight_backend_list[backend_list.at(x)] ; if it is greater
-   *	than 0, it is stored and the number is decreased
-   *weight_backend_list[backend_list.at(x)]--;
-   * 2) X>0 -> go next row (index++)
-   */
-
-  for (int j = 0; j < array_rows; j++) {
-    int x = 0;
-    index = j;
-    for (const auto &elem : backend_matrix_list) {
-      if (count == array_rows) {
-        goto exit;
-      }
-
-    ret:
-      int num = elem[index];
-      if (num == -2) {
-        x++;
-        continue;
-      } else if (final_backend_list.at(num) != "-1") {
-        index++;
-        if (index >= array_rows) {
-          x++;
-          index = j;
-          continue;
-        }
-        goto ret;
-      } else if (final_backend_list.at(num) == "-1") {
-        if (weight_backend_list[backend_list.at(x)] > 0) {
-          final_backend_list[num] = backend_list.at(x);
-          count++;
-          index = j;
-          weight_backend_list[backend_list.at(x)]--;
-          x++;
-        } else {
-          x++;
-          index = j;
-        }
-      }
+  unsigned int count = keys.size();
+  if (parent_.get_raw_table(EBPF_MAGLEV_MAP)
+          .update_batch(keys.data(), values.data(), &count) != 0) {
+    // batch operations are not supported (older kernels)
+    auto maglev_tables =
+        parent_.get_array_table<maglev_entry>(EBPF_MAGLEV_MAP);
+    for (size_t i = 0; i < keys.size(); i++) {
+      maglev_tables.set(keys[i], values[i]);
     }
   }
 
-exit:
-  return final_backend_list;
-}
-
-/*
- * This function return a map<backend_ip,#entries_assigned> after checking
- backend's weights.
-    We need to calculate the common coefficient between all backends.
-    Then we multiply this coefficient for backend's weight in order to get the
- number of entries assigned to this backend.
- */
-std::map<std::string, int> Service::get_weight_backend() {
-  int bkd_size = std::max(backend_size_, (uint)service_backends_.size());
-  int vect_size = bkd_size * BACKEND_REPLICAS;
-  int total_weight = 0;
-  int sum_weight = 0;
-  std::map<std::string, int> weight_back_pool;
-
-  // Calculate the total of weights
-  for (auto &backend : service_backends_) {
-    sum_weight += backend.second.getWeight();
-  }
-  float coeff = (static_cast<float>(vect_size) / sum_weight);
-  logger()->debug("vec size {0} sum_weight {1} coeff {2} ", vect_size,
-                  sum_weight, coeff);
-
-  // Calculate ,for each backend, its number of entries
-  for (auto &backend : service_backends_) {
-    if (backend.second.getWeight() == 0)
-      continue;
-    int weight_backend = (backend.second.getWeight()) * (coeff);
-    if (weight_backend == 0)
-      weight_backend++;
-    weight_back_pool[backend.first] = weight_backend;
-    total_weight += weight_backend;
-    logger()->debug("backend {0} weight {1} ", backend.first, weight_backend);
-  }
+  services_table.set(service_key, first);
+  maglev_buffer_ = buffer;
 
-  int res = vect_size - total_weight;
-
-  // Allign all , if necessary
-  while (res > 0) {
-    for (auto &backend : service_backends_) {
-      if (backend.second.getWeight() == 0)
-        continue;
-
-      weight_back_pool[backend.first]++;
-      res--;
-
-      logger()->debug("backend {0} weight {1} ", backend.first,
-                      weight_back_pool[backend.first]);
-
-      if (res == 0)
-        break;
-    }
-  }
-
-  return weight_back_pool;
-}
-
-std::vector<int> Service::getEmptyIntVector(int vect_size) {
-  // Initialize the entire vector with the value -2
-  std::vector<int> final_vect(vect_size, -2);
-
-  return final_vect;
-}
-
-std::vector<int> Service::getRandomIntVector(int vect_size) {
-  std::vector<int> final_vect(vect_size);
-  // Fill the vector with number starting from 0 to vect_size
-  std::iota(std::begin(final_vect), std::end(final_vect), 0);
-
-  std::random_device rand;
-  std::mt19937 engine(rand());
-
-  std::shuffle(std::begin(final_vect), std::end(final_vect), engine);
-
-  return final_vect;
+  logger()->debug("[Service] Service map updated");
 }
 
 uint8_t Service::convertProtoToNumber(const ServiceProtoEnum &proto) {
@@ -441,6 +353,8 @@ std::vector<std::shared_ptr<ServiceBackend>> Service::getBackendList() {
 
 void Service::addBackend(const std::string &ip,
                          const ServiceBackendJsonObject &conf) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
   logger()->debug(
       "[ServiceBackend] Received request to create new backend for service "
       "{0}, {1}, {2}",
@@ -484,7 +398,6 @@ void Service::addBackend(const std::string &ip,
     throw;
   }
 
-  addBackendToServiceMatrix(ip);
   updateConsistentHashMap();
 }
 
@@ -509,6 +422,8 @@ void Service::replaceBackendList(const std::vector<ServiceBackendJsonObject> &co
 }
 
 void Service::delBackend(const std::string &ip) {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
   logger()->trace(
       "[ServiceBackend] Received request to remove backend for service {0}, "
       "{1}, {2}",
@@ -523,11 +438,9 @@ void Service::delBackend(const std::string &ip) {
   }
 
   service_backends_.erase(ip);
-  removeBackendFromServiceMatrix(ip);
 
   if (service_backends_.empty()) {
-    // If there are no backends let's remove all entries from the eBPF map
-    backend_matrix_.clear();
+    // If there are no backends let's remove the service from the eBPF map
     removeServiceFromKernelMap();
   } else {
     updateConsistentHashMap();
@@ -535,9 +448,10 @@ void Service::delBackend(const std::string &ip) {
 }
 
 void Service::delBackendList() {
+  std::lock_guard<std::recursive_mutex> guard(parent_.mutex_);
+
   if (!service_backends_.empty()) {
     service_backends_.clear();
-    backend_matrix_.clear();
     removeServiceFromKernelMap();
   }
 }
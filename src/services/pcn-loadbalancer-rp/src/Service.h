@@ -39,7 +39,14 @@ struct backend {
   uint16_t proto;
 } __attribute__((packed));
 
+struct maglev_entry {
+  uint32_t ip;
+  uint16_t port;
+  uint16_t state;  // entry of the backend in the backend_states table
+} __attribute__((packed));
+
 class Service : public ServiceInterface {
+  friend class Lbrp;
   friend class ServiceBackend;
 
  public:
@@ -87,6 +94,11 @@ class Service : public ServiceInterface {
   void delBackend(const std::string &ip) override;
   void delBackendList() override;
 
+  /// <summary>
+  /// Number of sessions of this service currently in the session table
+  /// </summary>
+  uint32_t getActiveSessions() override;
+
   typedef std::tuple<std::string, uint16_t, uint8_t> ServiceKey;
 
   void removeServiceFromKernelMap();
@@ -95,29 +107,40 @@ class Service : public ServiceInterface {
   static uint8_t convertProtoToNumber(const ServiceProtoEnum &proto);
 
   static const uint16_t ICMP_EBPF_PORT;
+  // entries of the Maglev lookup table of each service (prime)
+  static const uint32_t MAGLEV_TABLE_SIZE;
+  // upper bound of the max-services parameter, i.e. of the number of services,
+  // each of them has its own lookup tables
+  static const uint32_t MAX_SERVICES;
+  // max number of backends of all the services, each of them has its own
+  // entry in the backend_states map
+  static const uint16_t MAX_BACKENDS;
 
  private:
   Lbrp &parent_;
   std::unordered_map<std::string, ServiceBackend> service_backends_;
-  std::map<std::string, std::vector<int>> backend_matrix_;
 
-  static const uint INITIAL_BACKEND_SIZE;
-  static const uint BACKEND_REPLICAS;
   static const std::string EBPF_SERVICE_MAP;
+  static const std::string EBPF_MAGLEV_MAP;
   static const std::string EBPF_BACKEND_TO_SERVICE_MAP;
 
   std::string service_name_;
   std::string vip_;
   uint16_t vport_;
   ServiceProtoEnum proto_;
-  uint backend_size_;
+
+  // slot of the service in the maglev_tables map, which holds two buffers
+  // for each slot: the one used by the datapath and the next one. Each buffer
+  // has the lookup table of all the backends followed by the fallback lookup
+  // table of the ACTIVE backends
+  uint16_t maglev_slot_;
+  uint8_t maglev_buffer_;
 
   void updateConsistentHashMap();
-  std::vector<std::string> getConsistentArray();
-  void updateKernelServiceMap(const std::vector<std::string> consistent_array);
-  void addBackendToServiceMatrix(std::string backend_ip);
-  void removeBackendFromServiceMatrix(std::string backend_ip);
-  std::vector<int> getRandomIntVector(int vect_size);
-  std::vector<int> getEmptyIntVector(int vect_size);
-  std::map<std::string, int> get_weight_backend();
+  // counts the sessions of the service handled by the given backend (by all
+  // the backends if 0)
+  uint32_t countSessions(uint32_t backend_ip);
+  void updateKernelServiceMap(
+      const std::vector<ServiceBackend *> &backends,
+      const std::vector<int> &table, const std::vector<int> &fallback);
 };
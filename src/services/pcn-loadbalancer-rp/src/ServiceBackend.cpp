@@ -32,15 +32,24 @@ ServiceBackend::ServiceBackend(Service &parent,
     weight_ = conf.getWeight();
     logger()->debug("[ServiceBackend] Set weight {0}", getWeight());
   } else {
-    setWeight(1);  // default weight
+    weight_ = 1;  // default weight
     logger()->debug("[ServiceBackend] Set default weight {0}", getWeight());
   }
 
   ip_ = conf.getIp();
   port_ = conf.getPort();
+
+  state_ = ServiceBackendStateEnum::ACTIVE;
+  if (conf.stateIsSet()) {
+    state_ = conf.getState();
+  }
+
+  state_id_ = parent_.parent_.addBackendStatus(ip_, port_, state_);
 }
 
-ServiceBackend::~ServiceBackend() {}
+ServiceBackend::~ServiceBackend() {
+  parent_.parent_.delBackendStatus(state_id_);
+}
 
 void ServiceBackend::update(const ServiceBackendJsonObject &conf) {
   // This method updates all the object/parameter in ServiceBackend object
@@ -59,6 +68,10 @@ void ServiceBackend::update(const ServiceBackendJsonObject &conf) {
   if (conf.portIsSet()) {
     setPort(conf.getPort());
   }
+
+  if (conf.stateIsSet()) {
+    setState(conf.getState());
+  }
 }
 
 ServiceBackendJsonObject ServiceBackend::toJsonObject() {
@@ -68,6 +81,8 @@ ServiceBackendJsonObject ServiceBackend::toJsonObject() {
   conf.setName(getName());
   conf.setWeight(getWeight());
   conf.setPort(getPort());
+  conf.setState(getState());
+  conf.setHealth(getHealth());
 
   return conf;
 }
@@ -95,6 +110,9 @@ uint16_t ServiceBackend::getWeight() {
 void ServiceBackend::setWeight(const uint16_t &value) {
   // This method set the weight value.
   weight_ = value;
+
+  // The share of the lookup table of each backend depends on the weights
+  parent_.updateConsistentHashMap();
 }
 
 uint16_t ServiceBackend::getPort() {
@@ -105,11 +123,44 @@ uint16_t ServiceBackend::getPort() {
 void ServiceBackend::setPort(const uint16_t &value) {
   // This method set the port value.
   port_ = value;
+  parent_.parent_.setBackendStatusPort(state_id_, port_);
 
   // This will update the kernel map with the new port for the backend
   parent_.updateConsistentHashMap();
 }
 
+uint32_t ServiceBackend::getActiveSessions() {
+  return parent_.countSessions(
+      polycube::service::utils::ip_string_to_nbo_uint(ip_));
+}
+
+ServiceBackendStateEnum ServiceBackend::getState() {
+  // This method retrieves the state value.
+  return state_;
+}
+
+/*
+ * Only the fallback lookup tables depend on the state: the main ones keep the
+ * backend, so that it gets back the same flows when it becomes active again.
+ */
+void ServiceBackend::setState(const ServiceBackendStateEnum &value) {
+  // This method set the state value.
+  if (state_ == value) {
+    return;
+  }
+  state_ = value;
+  parent_.parent_.setBackendStatusState(state_id_, state_);
+}
+
+ServiceBackendHealthEnum ServiceBackend::getHealth() {
+  // This method retrieves the health value.
+  return parent_.parent_.getBackendStatusHealth(state_id_);
+}
+
+uint16_t ServiceBackend::getStateId() {
+  return state_id_;
+}
+
 std::shared_ptr<spdlog::logger> ServiceBackend::logger() {
   return parent_.logger();
 }
@@ -56,10 +56,31 @@ class ServiceBackend : public ServiceBackendInterface {
   uint16_t getPort() override;
   void setPort(const uint16_t &value) override;
 
+  /// <summary>
+  /// Number of sessions currently handled by this backend server
+  /// </summary>
+  uint32_t getActiveSessions() override;
+
+  /// <summary>
+  /// Administrative state of the backend server
+  /// </summary>
+  ServiceBackendStateEnum getState() override;
+  void setState(const ServiceBackendStateEnum &value) override;
+
+  /// <summary>
+  /// Result of the health checks of the backend server
+  /// </summary>
+  ServiceBackendHealthEnum getHealth() override;
+
+  // entry of the backend in the backend_states map
+  uint16_t getStateId();
+
  private:
   Service &parent_;
   uint16_t weight_;
   uint16_t port_;
   std::string ip_;
   std::string name_;
+  ServiceBackendStateEnum state_;
+  uint16_t state_id_;
 };
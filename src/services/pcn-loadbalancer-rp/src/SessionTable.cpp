@@ -0,0 +1,143 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "SessionTable.h"
+#include "Lbrp.h"
+
+#include <fstream>
+
+using namespace polycube::service;
+
+SessionTable::SessionTable(Lbrp &parent, const SessionTableJsonObject &conf)
+    : parent_(parent) {
+  if (conf.sizeIsSet()) {
+    setSize(conf.getSize());
+  }
+}
+
+SessionTable::~SessionTable() {}
+
+void SessionTable::update(const SessionTableJsonObject &conf) {
+  // This method updates all the object/parameter in SessionTable object
+  // specified in the conf JsonObject.
+  // You can modify this implementation.
+  if (conf.sizeIsSet()) {
+    setSize(conf.getSize());
+  }
+}
+
+SessionTableJsonObject SessionTable::toJsonObject() {
+  SessionTableJsonObject conf;
+
+  conf.setSize(getSize());
+
+  // all the counters are computed from the same read of the session table
+  uint64_t created = getCreated();
+  uint64_t active = getActive();
+  conf.setActive(active);
+  conf.setCreated(created);
+  conf.setEvicted(created > active ? created - active : 0);
+
+  return conf;
+}
+
+uint32_t SessionTable::getSize() {
+  return parent_.session_table_size_;
+}
+
+void SessionTable::setSize(const uint32_t &value) {
+  // the size of the datapath map is fixed when the code is loaded
+  if (value != parent_.session_table_size_) {
+    throw std::runtime_error(
+        "The session table size can be set only at creation");
+  }
+}
+
+uint64_t SessionTable::getActive() {
+  return parent_.getSessionEntries().size();
+}
+
+uint64_t SessionTable::getCreated() {
+  return parent_.getSessionsCreated();
+}
+
+uint64_t SessionTable::getEvicted() {
+  // Sessions are never removed by the control plane, the ones created and no
+  // longer in the table have been evicted by the lru map.
+  // The counter is read first, so that sessions created meanwhile are not
+  // counted as evicted.
+  uint64_t created = getCreated();
+  uint64_t active = getActive();
+  return created > active ? created - active : 0;
+}
+
+SessionTableDumpOutputJsonObject SessionTable::dump(
+    SessionTableDumpInputJsonObject input) {
+  uint32_t vip = 0;
+  if (input.vipIsSet()) {
+    vip = utils::ip_string_to_nbo_uint(input.getVip());
+  }
+
+  uint32_t backend_ip = 0;
+  if (input.backendIpIsSet()) {
+    backend_ip = utils::ip_string_to_nbo_uint(input.getBackendIp());
+  }
+
+  std::ofstream file(input.getFile());
+  if (!file) {
+    throw std::runtime_error("Unable to open file " + input.getFile());
+  }
+
+  nlohmann::json sessions = nlohmann::json::array();
+  for (auto &entry : parent_.getSessionEntries()) {
+    auto &key = entry.first;
+    auto &value = entry.second;
+
+    if (vip != 0 && value.ip != vip) {
+      continue;
+    }
+    if (backend_ip != 0 && key.ip_dst != backend_ip) {
+      continue;
+    }
+
+    // for ICMP sessions the client port is the echo identifier
+    nlohmann::json session;
+    session["client-ip"] = utils::nbo_uint_to_ip_string(key.ip_src);
+    session["client-port"] = ntohs(key.port_src);
+    session["vip"] = utils::nbo_uint_to_ip_string(value.ip);
+    session["vport"] = ntohs(value.port);
+    session["backend-ip"] = utils::nbo_uint_to_ip_string(key.ip_dst);
+    session["backend-port"] = ntohs(key.port_dst);
+    session["proto"] = ServiceJsonObject::ServiceProtoEnum_to_string(
+        Service::convertNumberToProto(ntohs(key.proto)));
+    sessions.push_back(session);
+  }
+
+  file << sessions.dump(2) << std::endl;
+
+  logger()->info("Dumped {0} sessions to {1}", sessions.size(),
+                 input.getFile());
+
+  SessionTableDumpOutputJsonObject output;
+  output.setEntries(sessions.size());
+  return output;
+}
+
+std::shared_ptr<spdlog::logger> SessionTable::logger() {
+  return parent_.logger();
+}
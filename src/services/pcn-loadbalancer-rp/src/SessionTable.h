@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/SessionTableInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class Lbrp;
+
+using namespace io::swagger::server::model;
+
+/* definitions copied from datapath */
+struct sessions {
+  uint32_t ip_src;
+  uint32_t ip_dst;
+  uint16_t port_src;
+  uint16_t port_dst;
+  uint16_t proto;
+} __attribute__((packed));
+
+class SessionTable : public SessionTableInterface {
+ public:
+  SessionTable(Lbrp &parent, const SessionTableJsonObject &conf);
+  virtual ~SessionTable();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const SessionTableJsonObject &conf) override;
+  SessionTableJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Maximum number of sessions (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() override;
+  void setSize(const uint32_t &value) override;
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  uint64_t getActive() override;
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  uint64_t getCreated() override;
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  uint64_t getEvicted() override;
+
+  SessionTableDumpOutputJsonObject dump(
+      SessionTableDumpInputJsonObject input) override;
+
+ private:
+  Lbrp &parent_;
+};
@@ -43,6 +43,25 @@ Response create_lbrp_by_id_handler(
   }
 }
 
+Response create_lbrp_health_check_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    HealthCheckJsonObject unique_value { request_body };
+
+    create_lbrp_health_check_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response create_lbrp_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -268,6 +287,47 @@ Response create_lbrp_service_list_by_id_handler(
   }
 }
 
+Response create_lbrp_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    create_lbrp_session_table_by_id(unique_name, unique_value);
+    return { kCreated, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response create_lbrp_session_table_dump_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableDumpInputJsonObject unique_value { request_body };
+
+
+    auto x = create_lbrp_session_table_dump_by_id(unique_name, unique_value);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kCreated, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response create_lbrp_src_ip_rewrite_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -301,6 +361,20 @@ Response delete_lbrp_by_id_handler(
   }
 }
 
+Response delete_lbrp_health_check_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_lbrp_health_check_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_lbrp_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -476,6 +550,20 @@ Response delete_lbrp_service_list_by_id_handler(
   }
 }
 
+Response delete_lbrp_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    delete_lbrp_session_table_by_id(unique_name);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response delete_lbrp_src_ip_rewrite_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -507,6 +595,125 @@ Response read_lbrp_by_id_handler(
   }
 }
 
+Response read_lbrp_health_check_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_fall_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_fall_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_http_path_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_http_path_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_interval_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_interval_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_rise_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_rise_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_timeout_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_timeout_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_health_check_type_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_health_check_type_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = HealthCheckJsonObject::HealthCheckTypeEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbrp_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -525,6 +732,23 @@ Response read_lbrp_list_by_id_handler(
   }
 }
 
+Response read_lbrp_max_services_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_max_services_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbrp_port_mode_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -636,6 +860,98 @@ Response read_lbrp_ports_type_by_id_handler(
   }
 }
 
+Response read_lbrp_service_active_sessions_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+
+    auto x = read_lbrp_service_active_sessions_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_service_backend_active_sessions_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  std::string unique_ip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "ip")) {
+      unique_ip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_lbrp_service_backend_active_sessions_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_ip);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbrp_service_backend_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -686,6 +1002,56 @@ Response read_lbrp_service_backend_by_id_handler(
   }
 }
 
+Response read_lbrp_service_backend_health_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  std::string unique_ip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "ip")) {
+      unique_ip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_lbrp_service_backend_health_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_ip);
+    nlohmann::json response_body;
+    response_body = ServiceBackendJsonObject::ServiceBackendHealthEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbrp_service_backend_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -830,6 +1196,56 @@ Response read_lbrp_service_backend_port_by_id_handler(
   }
 }
 
+Response read_lbrp_service_backend_state_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  std::string unique_ip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "ip")) {
+      unique_ip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+
+    auto x = read_lbrp_service_backend_state_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_ip);
+    nlohmann::json response_body;
+    response_body = ServiceBackendJsonObject::ServiceBackendStateEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_lbrp_service_backend_weight_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -922,7 +1338,102 @@ Response read_lbrp_service_by_id_handler(
   }
 }
 
-Response read_lbrp_service_list_by_id_handler(
+Response read_lbrp_service_list_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_service_list_by_id(unique_name);
+    nlohmann::json response_body;
+    for (auto &i : x) {
+      response_body += i.toJson();
+    }
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_service_name_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+
+  try {
+
+    auto x = read_lbrp_service_name_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_session_table_active_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_session_table_active_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_lbrp_session_table_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x.toJson();
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response read_lbrp_session_table_created_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
   // Getting the path params
@@ -930,51 +1441,41 @@ Response read_lbrp_service_list_by_id_handler(
 
   try {
 
-    auto x = read_lbrp_service_list_by_id(unique_name);
+    auto x = read_lbrp_session_table_created_by_id(unique_name);
     nlohmann::json response_body;
-    for (auto &i : x) {
-      response_body += i.toJson();
-    }
+    response_body = x;
     return { kOk, ::strdup(response_body.dump().c_str()) };
   } catch(const std::exception &e) {
     return { kGenericError, ::strdup(e.what()) };
   }
 }
 
-Response read_lbrp_service_name_by_id_handler(
+Response read_lbrp_session_table_evicted_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
   // Getting the path params
   std::string unique_name { name };
-  std::string unique_vip;
-  for (size_t i = 0; i < num_keys; ++i) {
-    if (!strcmp(keys[i].name, "vip")) {
-      unique_vip = std::string { keys[i].value.string };
-      break;
-    }
-  }
 
-  uint16_t unique_vport;
-  for (size_t i = 0; i < num_keys; ++i) {
-    if (!strcmp(keys[i].name, "vport")) {
-      unique_vport = keys[i].value.uint16;
-      break;
-    }
-  }
+  try {
 
-  std::string unique_proto;
-  for (size_t i = 0; i < num_keys; ++i) {
-    if (!strcmp(keys[i].name, "proto")) {
-      unique_proto = std::string { keys[i].value.string };
-      break;
-    }
+    auto x = read_lbrp_session_table_evicted_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = x;
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
   }
-  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+}
 
+Response read_lbrp_session_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
 
   try {
 
-    auto x = read_lbrp_service_name_by_id(unique_name, unique_vip, unique_vport, unique_proto_);
+    auto x = read_lbrp_session_table_size_by_id(unique_name);
     nlohmann::json response_body;
     response_body = x;
     return { kOk, ::strdup(response_body.dump().c_str()) };
@@ -1054,6 +1555,25 @@ Response replace_lbrp_by_id_handler(
   }
 }
 
+Response replace_lbrp_health_check_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    HealthCheckJsonObject unique_value { request_body };
+
+    replace_lbrp_health_check_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response replace_lbrp_ports_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1279,6 +1799,25 @@ Response replace_lbrp_service_list_by_id_handler(
   }
 }
 
+Response replace_lbrp_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    replace_lbrp_session_table_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response replace_lbrp_src_ip_rewrite_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1318,6 +1857,132 @@ Response update_lbrp_by_id_handler(
   }
 }
 
+Response update_lbrp_health_check_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    HealthCheckJsonObject unique_value { request_body };
+
+    update_lbrp_health_check_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_fall_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint8_t unique_value = request_body;
+    update_lbrp_health_check_fall_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_http_path_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    std::string unique_value = request_body;
+    update_lbrp_health_check_http_path_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_interval_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_lbrp_health_check_interval_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_rise_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint8_t unique_value = request_body;
+    update_lbrp_health_check_rise_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_timeout_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_lbrp_health_check_timeout_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_health_check_type_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    HealthCheckTypeEnum unique_value_ = HealthCheckJsonObject::string_to_HealthCheckTypeEnum(request_body);
+    update_lbrp_health_check_type_by_id(unique_name, unique_value_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_lbrp_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1665,6 +2330,56 @@ Response update_lbrp_service_backend_port_by_id_handler(
   }
 }
 
+Response update_lbrp_service_backend_state_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+  std::string unique_vip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vip")) {
+      unique_vip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+  uint16_t unique_vport;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "vport")) {
+      unique_vport = keys[i].value.uint16;
+      break;
+    }
+  }
+
+  std::string unique_proto;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "proto")) {
+      unique_proto = std::string { keys[i].value.string };
+      break;
+    }
+  }
+  auto unique_proto_ = ServiceJsonObject::string_to_ServiceProtoEnum(unique_proto);
+
+  std::string unique_ip;
+  for (size_t i = 0; i < num_keys; ++i) {
+    if (!strcmp(keys[i].name, "ip")) {
+      unique_ip = std::string { keys[i].value.string };
+      break;
+    }
+  }
+
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    ServiceBackendStateEnum unique_value_ = ServiceBackendJsonObject::string_to_ServiceBackendStateEnum(request_body);
+    update_lbrp_service_backend_state_by_id(unique_name, unique_vip, unique_vport, unique_proto_, unique_ip, unique_value_);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_lbrp_service_backend_weight_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -1830,6 +2545,43 @@ Response update_lbrp_service_name_by_id_handler(
   }
 }
 
+Response update_lbrp_session_table_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // Getting the body param
+    SessionTableJsonObject unique_value { request_body };
+
+    update_lbrp_session_table_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
+Response update_lbrp_session_table_size_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ,
+  const char *value) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+    auto request_body = nlohmann::json::parse(std::string { value });
+    // The conversion is done automatically by the json library
+    uint32_t unique_value = request_body;
+    update_lbrp_session_table_size_by_id(unique_name, unique_value);
+    return { kOk, nullptr };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response update_lbrp_src_ip_rewrite_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ,
@@ -30,6 +30,10 @@
 #include "ServiceJsonObject.h"
 #include "ServiceBackendJsonObject.h"
 #include "SrcIpRewriteJsonObject.h"
+#include "SessionTableDumpInputJsonObject.h"
+#include "SessionTableDumpOutputJsonObject.h"
+#include "SessionTableJsonObject.h"
+#include "HealthCheckJsonObject.h"
 #include <vector>
 
 
@@ -38,48 +42,79 @@ extern "C" {
 #endif
 
 Response create_lbrp_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbrp_health_check_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbrp_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_lbrp_session_table_dump_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_lbrp_src_ip_rewrite_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_lbrp_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbrp_health_check_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_lbrp_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_lbrp_src_ip_rewrite_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_fall_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_http_path_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_rise_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_health_check_type_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_max_services_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_port_mode_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_ports_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_ports_type_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_service_active_sessions_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_service_backend_active_sessions_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_service_backend_health_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_backend_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_backend_port_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_service_backend_state_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_backend_weight_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_session_table_active_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_session_table_created_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_session_table_evicted_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_lbrp_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_src_ip_rewrite_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_src_ip_rewrite_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_lbrp_src_ip_rewrite_new_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_lbrp_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbrp_health_check_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_service_backend_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_lbrp_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_lbrp_src_ip_rewrite_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_fall_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_http_path_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_rise_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_health_check_type_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_port_mode_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -90,10 +125,13 @@ Response update_lbrp_service_backend_by_id_handler(const char *name, const Key *
 Response update_lbrp_service_backend_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_backend_name_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_backend_port_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_service_backend_state_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_backend_weight_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_service_name_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_lbrp_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_src_ip_rewrite_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_src_ip_rewrite_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_lbrp_src_ip_rewrite_new_ip_range_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
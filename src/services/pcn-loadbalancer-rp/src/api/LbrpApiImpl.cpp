@@ -90,6 +90,24 @@ std::vector<nlohmann::fifo_map<std::string, std::string>> read_lbrp_list_by_id_g
   return r;
 }
 
+/**
+* @brief   Create health-check by ID
+*
+* Create operation of resource: health-check*
+*
+* @param[in] name ID of name
+* @param[in] value healthcheckbody object
+*
+* Responses:
+*
+*/
+void
+create_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value) {
+  auto lbrp = get_cube(name);
+
+  lbrp->addHealthCheck(value);
+}
+
 /**
 * @brief   Create ports by ID
 *
@@ -208,6 +226,43 @@ create_lbrp_service_list_by_id(const std::string &name, const std::vector<Servic
   lbrp->addServiceList(value);
 }
 
+/**
+* @brief   Create session-table by ID
+*
+* Create operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+create_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto lbrp = get_cube(name);
+
+  lbrp->addSessionTable(value);
+}
+
+/**
+* @brief   Create dump by ID
+*
+* Create operation of resource: dump*
+*
+* @param[in] name ID of name
+* @param[in] value dumpbody object
+*
+* Responses:
+* SessionTableDumpOutputJsonObject
+*/
+SessionTableDumpOutputJsonObject
+create_lbrp_session_table_dump_by_id(const std::string &name, const SessionTableDumpInputJsonObject &value) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+return session_table->dump(value);
+
+}
+
 /**
 * @brief   Create src-ip-rewrite by ID
 *
@@ -226,6 +281,23 @@ create_lbrp_src_ip_rewrite_by_id(const std::string &name, const SrcIpRewriteJson
   lbrp->addSrcIpRewrite(value);
 }
 
+/**
+* @brief   Delete health-check by ID
+*
+* Delete operation of resource: health-check*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_lbrp_health_check_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+
+  lbrp->delHealthCheck();
+}
+
 /**
 * @brief   Delete ports by ID
 *
@@ -338,6 +410,23 @@ delete_lbrp_service_list_by_id(const std::string &name) {
   lbrp->delServiceList();
 }
 
+/**
+* @brief   Delete session-table by ID
+*
+* Delete operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_lbrp_session_table_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+
+  lbrp->delSessionTable();
+}
+
 /**
 * @brief   Delete src-ip-rewrite by ID
 *
@@ -371,6 +460,148 @@ read_lbrp_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read health-check by ID
+*
+* Read operation of resource: health-check*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* HealthCheckJsonObject
+*/
+HealthCheckJsonObject
+read_lbrp_health_check_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  return lbrp->getHealthCheck()->toJsonObject();
+
+}
+
+/**
+* @brief   Read fall by ID
+*
+* Read operation of resource: fall*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint8_t
+*/
+uint8_t
+read_lbrp_health_check_fall_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getFall();
+
+}
+
+/**
+* @brief   Read http-path by ID
+*
+* Read operation of resource: http-path*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::string
+*/
+std::string
+read_lbrp_health_check_http_path_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getHttpPath();
+
+}
+
+/**
+* @brief   Read interval by ID
+*
+* Read operation of resource: interval*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_health_check_interval_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getInterval();
+
+}
+
+/**
+* @brief   Read rise by ID
+*
+* Read operation of resource: rise*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint8_t
+*/
+uint8_t
+read_lbrp_health_check_rise_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getRise();
+
+}
+
+/**
+* @brief   Read timeout by ID
+*
+* Read operation of resource: timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_health_check_timeout_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getTimeout();
+
+}
+
+/**
+* @brief   Read type by ID
+*
+* Read operation of resource: type*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* HealthCheckTypeEnum
+*/
+HealthCheckTypeEnum
+read_lbrp_health_check_type_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+  return health_check->getType();
+
+}
+
+/**
+* @brief   Read max-services by ID
+*
+* Read operation of resource: max-services*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_max_services_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  return lbrp->getMaxServices();
+
+}
+
 /**
 * @brief   Read port_mode by ID
 *
@@ -464,6 +695,50 @@ read_lbrp_ports_type_by_id(const std::string &name, const std::string &portsName
 
 }
 
+/**
+* @brief   Read active-sessions by ID
+*
+* Read operation of resource: active-sessions*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_service_active_sessions_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto) {
+  auto lbrp = get_cube(name);
+  auto service = lbrp->getService(vip, vport, proto);
+  return service->getActiveSessions();
+
+}
+
+/**
+* @brief   Read active-sessions by ID
+*
+* Read operation of resource: active-sessions*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] ip ID of ip
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_service_backend_active_sessions_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip) {
+  auto lbrp = get_cube(name);
+  auto service = lbrp->getService(vip, vport, proto);
+  auto backend = service->getBackend(ip);
+  return backend->getActiveSessions();
+
+}
+
 /**
 * @brief   Read backend by ID
 *
@@ -486,6 +761,29 @@ read_lbrp_service_backend_by_id(const std::string &name, const std::string &vip,
 
 }
 
+/**
+* @brief   Read health by ID
+*
+* Read operation of resource: health*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] ip ID of ip
+*
+* Responses:
+* ServiceBackendHealthEnum
+*/
+ServiceBackendHealthEnum
+read_lbrp_service_backend_health_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip) {
+  auto lbrp = get_cube(name);
+  auto service = lbrp->getService(vip, vport, proto);
+  auto backend = service->getBackend(ip);
+  return backend->getHealth();
+
+}
+
 /**
 * @brief   Read backend by ID
 *
@@ -556,6 +854,29 @@ read_lbrp_service_backend_port_by_id(const std::string &name, const std::string
 
 }
 
+/**
+* @brief   Read state by ID
+*
+* Read operation of resource: state*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] ip ID of ip
+*
+* Responses:
+* ServiceBackendStateEnum
+*/
+ServiceBackendStateEnum
+read_lbrp_service_backend_state_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip) {
+  auto lbrp = get_cube(name);
+  auto service = lbrp->getService(vip, vport, proto);
+  auto backend = service->getBackend(ip);
+  return backend->getState();
+
+}
+
 /**
 * @brief   Read weight by ID
 *
@@ -640,6 +961,95 @@ read_lbrp_service_name_by_id(const std::string &name, const std::string &vip, co
 
 }
 
+/**
+* @brief   Read active by ID
+*
+* Read operation of resource: active*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_lbrp_session_table_active_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+  return session_table->getActive();
+
+}
+
+/**
+* @brief   Read session-table by ID
+*
+* Read operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* SessionTableJsonObject
+*/
+SessionTableJsonObject
+read_lbrp_session_table_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  return lbrp->getSessionTable()->toJsonObject();
+
+}
+
+/**
+* @brief   Read created by ID
+*
+* Read operation of resource: created*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_lbrp_session_table_created_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+  return session_table->getCreated();
+
+}
+
+/**
+* @brief   Read evicted by ID
+*
+* Read operation of resource: evicted*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_lbrp_session_table_evicted_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+  return session_table->getEvicted();
+
+}
+
+/**
+* @brief   Read size by ID
+*
+* Read operation of resource: size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_lbrp_session_table_size_by_id(const std::string &name) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+  return session_table->getSize();
+
+}
+
 /**
 * @brief   Read src-ip-rewrite by ID
 *
@@ -693,6 +1103,24 @@ read_lbrp_src_ip_rewrite_new_ip_range_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Replace health-check by ID
+*
+* Replace operation of resource: health-check*
+*
+* @param[in] name ID of name
+* @param[in] value healthcheckbody object
+*
+* Responses:
+*
+*/
+void
+replace_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value) {
+  auto lbrp = get_cube(name);
+
+  lbrp->replaceHealthCheck(value);
+}
+
 /**
 * @brief   Replace ports by ID
 *
@@ -810,6 +1238,24 @@ replace_lbrp_service_list_by_id(const std::string &name, const std::vector<Servi
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Replace session-table by ID
+*
+* Replace operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+replace_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto lbrp = get_cube(name);
+
+  lbrp->replaceSessionTable(value);
+}
+
 /**
 * @brief   Replace src-ip-rewrite by ID
 *
@@ -846,6 +1292,139 @@ update_lbrp_by_id(const std::string &name, const LbrpJsonObject &value) {
   lbrp->update(value);
 }
 
+/**
+* @brief   Update health-check by ID
+*
+* Update operation of resource: health-check*
+*
+* @param[in] name ID of name
+* @param[in] value healthcheckbody object
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->update(value);
+}
+
+/**
+* @brief   Update fall by ID
+*
+* Update operation of resource: fall*
+*
+* @param[in] name ID of name
+* @param[in] value Number of consecutive failed checks before a backend is considered DOWN
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_fall_by_id(const std::string &name, const uint8_t &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setFall(value);
+}
+
+/**
+* @brief   Update http-path by ID
+*
+* Update operation of resource: http-path*
+*
+* @param[in] name ID of name
+* @param[in] value Path requested by HTTP health checks
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_http_path_by_id(const std::string &name, const std::string &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setHttpPath(value);
+}
+
+/**
+* @brief   Update interval by ID
+*
+* Update operation of resource: interval*
+*
+* @param[in] name ID of name
+* @param[in] value Time between two checks of the same backend
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_interval_by_id(const std::string &name, const uint32_t &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setInterval(value);
+}
+
+/**
+* @brief   Update rise by ID
+*
+* Update operation of resource: rise*
+*
+* @param[in] name ID of name
+* @param[in] value Number of consecutive successful checks before a backend is considered UP
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_rise_by_id(const std::string &name, const uint8_t &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setRise(value);
+}
+
+/**
+* @brief   Update timeout by ID
+*
+* Update operation of resource: timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Time after which a check is considered failed
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setTimeout(value);
+}
+
+/**
+* @brief   Update type by ID
+*
+* Update operation of resource: type*
+*
+* @param[in] name ID of name
+* @param[in] value Type of health check (backends of ICMP services are not checked)
+*
+* Responses:
+*
+*/
+void
+update_lbrp_health_check_type_by_id(const std::string &name, const HealthCheckTypeEnum &value) {
+  auto lbrp = get_cube(name);
+  auto health_check = lbrp->getHealthCheck();
+
+  health_check->setType(value);
+}
+
 /**
 * @brief   Update lbrp by ID
 *
@@ -1046,6 +1625,30 @@ update_lbrp_service_backend_port_by_id(const std::string &name, const std::strin
   backend->setPort(value);
 }
 
+/**
+* @brief   Update state by ID
+*
+* Update operation of resource: state*
+*
+* @param[in] name ID of name
+* @param[in] vip ID of vip
+* @param[in] vport ID of vport
+* @param[in] proto ID of proto
+* @param[in] ip ID of ip
+* @param[in] value Administrative state of the backend server
+*
+* Responses:
+*
+*/
+void
+update_lbrp_service_backend_state_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const ServiceBackendStateEnum &value) {
+  auto lbrp = get_cube(name);
+  auto service = lbrp->getService(vip, vport, proto);
+  auto backend = service->getBackend(ip);
+
+  backend->setState(value);
+}
+
 /**
 * @brief   Update weight by ID
 *
@@ -1130,6 +1733,44 @@ update_lbrp_service_name_by_id(const std::string &name, const std::string &vip,
   service->setName(value);
 }
 
+/**
+* @brief   Update session-table by ID
+*
+* Update operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+update_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+
+  session_table->update(value);
+}
+
+/**
+* @brief   Update size by ID
+*
+* Update operation of resource: size*
+*
+* @param[in] name ID of name
+* @param[in] value Maximum number of sessions (can be set only at creation)
+*
+* Responses:
+*
+*/
+void
+update_lbrp_session_table_size_by_id(const std::string &name, const uint32_t &value) {
+  auto lbrp = get_cube(name);
+  auto session_table = lbrp->getSessionTable();
+
+  session_table->setSize(value);
+}
+
 /**
 * @brief   Update src-ip-rewrite by ID
 *
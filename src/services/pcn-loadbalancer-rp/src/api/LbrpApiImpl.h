@@ -31,6 +31,10 @@
 #include "ServiceJsonObject.h"
 #include "ServiceBackendJsonObject.h"
 #include "SrcIpRewriteJsonObject.h"
+#include "SessionTableDumpInputJsonObject.h"
+#include "SessionTableDumpOutputJsonObject.h"
+#include "SessionTableJsonObject.h"
+#include "HealthCheckJsonObject.h"
 #include <vector>
 
 namespace io {
@@ -42,48 +46,79 @@ using namespace io::swagger::server::model;
 
 namespace LbrpApiImpl {
   void create_lbrp_by_id(const std::string &name, const LbrpJsonObject &value);
+  void create_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value);
   void create_lbrp_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void create_lbrp_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void create_lbrp_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const ServiceBackendJsonObject &value);
   void create_lbrp_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
   void create_lbrp_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void create_lbrp_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
+  void create_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
+  SessionTableDumpOutputJsonObject create_lbrp_session_table_dump_by_id(const std::string &name, const SessionTableDumpInputJsonObject &value);
   void create_lbrp_src_ip_rewrite_by_id(const std::string &name, const SrcIpRewriteJsonObject &value);
   void delete_lbrp_by_id(const std::string &name);
+  void delete_lbrp_health_check_by_id(const std::string &name);
   void delete_lbrp_ports_by_id(const std::string &name, const std::string &portsName);
   void delete_lbrp_ports_list_by_id(const std::string &name);
   void delete_lbrp_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   void delete_lbrp_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   void delete_lbrp_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   void delete_lbrp_service_list_by_id(const std::string &name);
+  void delete_lbrp_session_table_by_id(const std::string &name);
   void delete_lbrp_src_ip_rewrite_by_id(const std::string &name);
   LbrpJsonObject read_lbrp_by_id(const std::string &name);
+  HealthCheckJsonObject read_lbrp_health_check_by_id(const std::string &name);
+  uint8_t read_lbrp_health_check_fall_by_id(const std::string &name);
+  std::string read_lbrp_health_check_http_path_by_id(const std::string &name);
+  uint32_t read_lbrp_health_check_interval_by_id(const std::string &name);
+  uint8_t read_lbrp_health_check_rise_by_id(const std::string &name);
+  uint32_t read_lbrp_health_check_timeout_by_id(const std::string &name);
+  HealthCheckTypeEnum read_lbrp_health_check_type_by_id(const std::string &name);
   std::vector<LbrpJsonObject> read_lbrp_list_by_id();
+  uint32_t read_lbrp_max_services_by_id(const std::string &name);
   LbrpPortModeEnum read_lbrp_port_mode_by_id(const std::string &name);
   PortsJsonObject read_lbrp_ports_by_id(const std::string &name, const std::string &portsName);
   std::string read_lbrp_ports_ip_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_lbrp_ports_list_by_id(const std::string &name);
   PortsTypeEnum read_lbrp_ports_type_by_id(const std::string &name, const std::string &portsName);
+  uint32_t read_lbrp_service_active_sessions_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  uint32_t read_lbrp_service_backend_active_sessions_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   ServiceBackendJsonObject read_lbrp_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
+  ServiceBackendHealthEnum read_lbrp_service_backend_health_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   std::vector<ServiceBackendJsonObject> read_lbrp_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   std::string read_lbrp_service_backend_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   uint16_t read_lbrp_service_backend_port_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
+  ServiceBackendStateEnum read_lbrp_service_backend_state_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   uint16_t read_lbrp_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip);
   ServiceJsonObject read_lbrp_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
   std::vector<ServiceJsonObject> read_lbrp_service_list_by_id(const std::string &name);
   std::string read_lbrp_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto);
+  uint64_t read_lbrp_session_table_active_by_id(const std::string &name);
+  SessionTableJsonObject read_lbrp_session_table_by_id(const std::string &name);
+  uint64_t read_lbrp_session_table_created_by_id(const std::string &name);
+  uint64_t read_lbrp_session_table_evicted_by_id(const std::string &name);
+  uint32_t read_lbrp_session_table_size_by_id(const std::string &name);
   SrcIpRewriteJsonObject read_lbrp_src_ip_rewrite_by_id(const std::string &name);
   std::string read_lbrp_src_ip_rewrite_ip_range_by_id(const std::string &name);
   std::string read_lbrp_src_ip_rewrite_new_ip_range_by_id(const std::string &name);
   void replace_lbrp_by_id(const std::string &name, const LbrpJsonObject &value);
+  void replace_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value);
   void replace_lbrp_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void replace_lbrp_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void replace_lbrp_service_backend_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const ServiceBackendJsonObject &value);
   void replace_lbrp_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
   void replace_lbrp_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void replace_lbrp_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
+  void replace_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
   void replace_lbrp_src_ip_rewrite_by_id(const std::string &name, const SrcIpRewriteJsonObject &value);
   void update_lbrp_by_id(const std::string &name, const LbrpJsonObject &value);
+  void update_lbrp_health_check_by_id(const std::string &name, const HealthCheckJsonObject &value);
+  void update_lbrp_health_check_fall_by_id(const std::string &name, const uint8_t &value);
+  void update_lbrp_health_check_http_path_by_id(const std::string &name, const std::string &value);
+  void update_lbrp_health_check_interval_by_id(const std::string &name, const uint32_t &value);
+  void update_lbrp_health_check_rise_by_id(const std::string &name, const uint8_t &value);
+  void update_lbrp_health_check_timeout_by_id(const std::string &name, const uint32_t &value);
+  void update_lbrp_health_check_type_by_id(const std::string &name, const HealthCheckTypeEnum &value);
   void update_lbrp_list_by_id(const std::vector<LbrpJsonObject> &value);
   void update_lbrp_port_mode_by_id(const std::string &name, const LbrpPortModeEnum &value);
   void update_lbrp_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
@@ -94,10 +129,13 @@ namespace LbrpApiImpl {
   void update_lbrp_service_backend_list_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::vector<ServiceBackendJsonObject> &value);
   void update_lbrp_service_backend_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const std::string &value);
   void update_lbrp_service_backend_port_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const uint16_t &value);
+  void update_lbrp_service_backend_state_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const ServiceBackendStateEnum &value);
   void update_lbrp_service_backend_weight_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &ip, const uint16_t &value);
   void update_lbrp_service_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &value);
   void update_lbrp_service_list_by_id(const std::string &name, const std::vector<ServiceJsonObject> &value);
   void update_lbrp_service_name_by_id(const std::string &name, const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const std::string &value);
+  void update_lbrp_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
+  void update_lbrp_session_table_size_by_id(const std::string &name, const uint32_t &value);
   void update_lbrp_src_ip_rewrite_by_id(const std::string &name, const SrcIpRewriteJsonObject &value);
   void update_lbrp_src_ip_rewrite_ip_range_by_id(const std::string &name, const std::string &value);
   void update_lbrp_src_ip_rewrite_new_ip_range_by_id(const std::string &name, const std::string &value);
@@ -0,0 +1,70 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* HealthCheckInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/HealthCheckJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class HealthCheckInterface {
+public:
+
+  virtual void update(const HealthCheckJsonObject &conf) = 0;
+  virtual HealthCheckJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Type of health check (backends of ICMP services are not checked)
+  /// </summary>
+  virtual HealthCheckTypeEnum getType() = 0;
+  virtual void setType(const HealthCheckTypeEnum &value) = 0;
+
+  /// <summary>
+  /// Time between two checks of the same backend
+  /// </summary>
+  virtual uint32_t getInterval() = 0;
+  virtual void setInterval(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Time after which a check is considered failed
+  /// </summary>
+  virtual uint32_t getTimeout() = 0;
+  virtual void setTimeout(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Path requested by HTTP health checks
+  /// </summary>
+  virtual std::string getHttpPath() = 0;
+  virtual void setHttpPath(const std::string &value) = 0;
+
+  /// <summary>
+  /// Number of consecutive successful checks before a backend is considered UP
+  /// </summary>
+  virtual uint8_t getRise() = 0;
+  virtual void setRise(const uint8_t &value) = 0;
+
+  /// <summary>
+  /// Number of consecutive failed checks before a backend is considered DOWN
+  /// </summary>
+  virtual uint8_t getFall() = 0;
+  virtual void setFall(const uint8_t &value) = 0;
+};
+
@@ -22,8 +22,10 @@
 
 #include "../serializer/LbrpJsonObject.h"
 
+#include "../HealthCheck.h"
 #include "../Ports.h"
 #include "../Service.h"
+#include "../SessionTable.h"
 #include "../SrcIpRewrite.h"
 
 using namespace io::swagger::server::model;
@@ -51,6 +53,7 @@ public:
   /// 'MULTI' allows to manage multiple FRONTEND port.
   /// </summary>
   virtual LbrpPortModeEnum getPortMode() = 0;
+  virtual uint32_t getMaxServices() = 0;
   virtual void setPortMode(const LbrpPortModeEnum &value) = 0;
 
   /// <summary>
@@ -72,5 +75,21 @@ public:
   virtual void replaceService(const std::string &vip, const uint16_t &vport, const ServiceProtoEnum &proto, const ServiceJsonObject &conf) = 0;
   virtual void delService(const std::string &vip,const uint16_t &vport,const ServiceProtoEnum &proto) = 0;
   virtual void delServiceList() = 0;
+
+  /// <summary>
+  ///
+  /// </summary>
+  virtual std::shared_ptr<SessionTable> getSessionTable() = 0;
+  virtual void addSessionTable(const SessionTableJsonObject &value) = 0;
+  virtual void replaceSessionTable(const SessionTableJsonObject &conf) = 0;
+  virtual void delSessionTable() = 0;
+
+  /// <summary>
+  /// Active health checks of the backend servers, performed by the control plane
+  /// </summary>
+  virtual std::shared_ptr<HealthCheck> getHealthCheck() = 0;
+  virtual void addHealthCheck(const HealthCheckJsonObject &value) = 0;
+  virtual void replaceHealthCheck(const HealthCheckJsonObject &conf) = 0;
+  virtual void delHealthCheck() = 0;
 };
 
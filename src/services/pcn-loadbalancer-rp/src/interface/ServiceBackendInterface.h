@@ -53,5 +53,21 @@ public:
   /// </summary>
   virtual uint16_t getWeight() = 0;
   virtual void setWeight(const uint16_t &value) = 0;
+
+  /// <summary>
+  /// Number of sessions currently handled by this backend server
+  /// </summary>
+  virtual uint32_t getActiveSessions() = 0;
+
+  /// <summary>
+  /// Administrative state of the backend server
+  /// </summary>
+  virtual ServiceBackendStateEnum getState() = 0;
+  virtual void setState(const ServiceBackendStateEnum &value) = 0;
+
+  /// <summary>
+  /// Result of the health checks of the backend server
+  /// </summary>
+  virtual ServiceBackendHealthEnum getHealth() = 0;
 };
 
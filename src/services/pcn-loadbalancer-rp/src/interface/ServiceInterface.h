@@ -64,5 +64,10 @@ public:
   virtual void replaceBackendList(const std::vector<ServiceBackendJsonObject> &conf) = 0;
   virtual void delBackend(const std::string &ip) = 0;
   virtual void delBackendList() = 0;
+
+  /// <summary>
+  /// Number of sessions of this service currently in the session table
+  /// </summary>
+  virtual uint32_t getActiveSessions() = 0;
 };
 
@@ -0,0 +1,58 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/SessionTableJsonObject.h"
+#include "../serializer/SessionTableDumpInputJsonObject.h"
+#include "../serializer/SessionTableDumpOutputJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class SessionTableInterface {
+public:
+
+  virtual void update(const SessionTableJsonObject &conf) = 0;
+  virtual SessionTableJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Maximum number of sessions (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getSize() = 0;
+  virtual void setSize(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  virtual uint64_t getActive() = 0;
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  virtual uint64_t getCreated() = 0;
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  virtual uint64_t getEvicted() = 0;
+  virtual SessionTableDumpOutputJsonObject dump(SessionTableDumpInputJsonObject input) = 0;
+};
+
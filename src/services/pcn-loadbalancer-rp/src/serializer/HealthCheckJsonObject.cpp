@@ -0,0 +1,238 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "HealthCheckJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+HealthCheckJsonObject::HealthCheckJsonObject() {
+  m_interval = 5;
+  m_intervalIsSet = true;
+  m_timeout = 1000;
+  m_timeoutIsSet = true;
+  m_httpPath = "/";
+  m_httpPathIsSet = true;
+  m_rise = 2;
+  m_riseIsSet = true;
+  m_fall = 3;
+  m_fallIsSet = true;
+  m_type = HealthCheckTypeEnum::NONE;
+  m_typeIsSet = true;
+}
+
+HealthCheckJsonObject::HealthCheckJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_intervalIsSet = false;
+  m_timeoutIsSet = false;
+  m_httpPathIsSet = false;
+  m_riseIsSet = false;
+  m_fallIsSet = false;
+  m_typeIsSet = false;
+
+
+  if (val.count("interval")) {
+    setInterval(val.at("interval").get<uint32_t>());
+  }
+
+  if (val.count("timeout")) {
+    setTimeout(val.at("timeout").get<uint32_t>());
+  }
+
+  if (val.count("http-path")) {
+    setHttpPath(val.at("http-path").get<std::string>());
+  }
+
+  if (val.count("rise")) {
+    setRise(val.at("rise").get<uint8_t>());
+  }
+
+  if (val.count("fall")) {
+    setFall(val.at("fall").get<uint8_t>());
+  }
+
+  if (val.count("type")) {
+    setType(string_to_HealthCheckTypeEnum(val.at("type").get<std::string>()));
+  }
+}
+
+nlohmann::json HealthCheckJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_intervalIsSet) {
+    val["interval"] = m_interval;
+  }
+
+  if (m_timeoutIsSet) {
+    val["timeout"] = m_timeout;
+  }
+
+  if (m_httpPathIsSet) {
+    val["http-path"] = m_httpPath;
+  }
+
+  if (m_riseIsSet) {
+    val["rise"] = m_rise;
+  }
+
+  if (m_fallIsSet) {
+    val["fall"] = m_fall;
+  }
+
+  if (m_typeIsSet) {
+    val["type"] = HealthCheckTypeEnum_to_string(m_type);
+  }
+
+  return val;
+}
+
+uint32_t HealthCheckJsonObject::getInterval() const {
+  return m_interval;
+}
+
+void HealthCheckJsonObject::setInterval(uint32_t value) {
+  m_interval = value;
+  m_intervalIsSet = true;
+}
+
+bool HealthCheckJsonObject::intervalIsSet() const {
+  return m_intervalIsSet;
+}
+
+void HealthCheckJsonObject::unsetInterval() {
+  m_intervalIsSet = false;
+}
+
+uint32_t HealthCheckJsonObject::getTimeout() const {
+  return m_timeout;
+}
+
+void HealthCheckJsonObject::setTimeout(uint32_t value) {
+  m_timeout = value;
+  m_timeoutIsSet = true;
+}
+
+bool HealthCheckJsonObject::timeoutIsSet() const {
+  return m_timeoutIsSet;
+}
+
+void HealthCheckJsonObject::unsetTimeout() {
+  m_timeoutIsSet = false;
+}
+
+std::string HealthCheckJsonObject::getHttpPath() const {
+  return m_httpPath;
+}
+
+void HealthCheckJsonObject::setHttpPath(std::string value) {
+  m_httpPath = value;
+  m_httpPathIsSet = true;
+}
+
+bool HealthCheckJsonObject::httpPathIsSet() const {
+  return m_httpPathIsSet;
+}
+
+void HealthCheckJsonObject::unsetHttpPath() {
+  m_httpPathIsSet = false;
+}
+
+uint8_t HealthCheckJsonObject::getRise() const {
+  return m_rise;
+}
+
+void HealthCheckJsonObject::setRise(uint8_t value) {
+  m_rise = value;
+  m_riseIsSet = true;
+}
+
+bool HealthCheckJsonObject::riseIsSet() const {
+  return m_riseIsSet;
+}
+
+void HealthCheckJsonObject::unsetRise() {
+  m_riseIsSet = false;
+}
+
+uint8_t HealthCheckJsonObject::getFall() const {
+  return m_fall;
+}
+
+void HealthCheckJsonObject::setFall(uint8_t value) {
+  m_fall = value;
+  m_fallIsSet = true;
+}
+
+bool HealthCheckJsonObject::fallIsSet() const {
+  return m_fallIsSet;
+}
+
+void HealthCheckJsonObject::unsetFall() {
+  m_fallIsSet = false;
+}
+
+HealthCheckTypeEnum HealthCheckJsonObject::getType() const {
+  return m_type;
+}
+
+void HealthCheckJsonObject::setType(HealthCheckTypeEnum value) {
+  m_type = value;
+  m_typeIsSet = true;
+}
+
+bool HealthCheckJsonObject::typeIsSet() const {
+  return m_typeIsSet;
+}
+
+void HealthCheckJsonObject::unsetType() {
+  m_typeIsSet = false;
+}
+
+std::string HealthCheckJsonObject::HealthCheckTypeEnum_to_string(const HealthCheckTypeEnum &value){
+  switch(value) {
+  case HealthCheckTypeEnum::NONE:
+    return std::string("none");
+  case HealthCheckTypeEnum::TCP:
+    return std::string("tcp");
+  case HealthCheckTypeEnum::HTTP:
+    return std::string("http");
+  default:
+    throw std::runtime_error("Bad HealthCheck type");
+  }
+}
+
+HealthCheckTypeEnum HealthCheckJsonObject::string_to_HealthCheckTypeEnum(const std::string &str){
+  if (JsonObjectBase::iequals("none", str))
+    return HealthCheckTypeEnum::NONE;
+  if (JsonObjectBase::iequals("tcp", str))
+    return HealthCheckTypeEnum::TCP;
+  if (JsonObjectBase::iequals("http", str))
+    return HealthCheckTypeEnum::HTTP;
+  throw std::runtime_error("HealthCheck type is invalid");
+}
+
+
+}
+}
+}
+}
+
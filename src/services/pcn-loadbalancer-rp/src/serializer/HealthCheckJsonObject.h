@@ -0,0 +1,116 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* HealthCheckJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+enum class HealthCheckTypeEnum {
+  NONE, TCP, HTTP
+};
+
+/// <summary>
+///
+/// </summary>
+class  HealthCheckJsonObject : public JsonObjectBase {
+public:
+  HealthCheckJsonObject();
+  HealthCheckJsonObject(const nlohmann::json &json);
+  ~HealthCheckJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Time between two checks of the same backend
+  /// </summary>
+  uint32_t getInterval() const;
+  void setInterval(uint32_t value);
+  bool intervalIsSet() const;
+  void unsetInterval();
+
+  /// <summary>
+  /// Time after which a check is considered failed
+  /// </summary>
+  uint32_t getTimeout() const;
+  void setTimeout(uint32_t value);
+  bool timeoutIsSet() const;
+  void unsetTimeout();
+
+  /// <summary>
+  /// Path requested by HTTP health checks
+  /// </summary>
+  std::string getHttpPath() const;
+  void setHttpPath(std::string value);
+  bool httpPathIsSet() const;
+  void unsetHttpPath();
+
+  /// <summary>
+  /// Number of consecutive successful checks before a backend is considered UP
+  /// </summary>
+  uint8_t getRise() const;
+  void setRise(uint8_t value);
+  bool riseIsSet() const;
+  void unsetRise();
+
+  /// <summary>
+  /// Number of consecutive failed checks before a backend is considered DOWN
+  /// </summary>
+  uint8_t getFall() const;
+  void setFall(uint8_t value);
+  bool fallIsSet() const;
+  void unsetFall();
+
+  /// <summary>
+  /// Type of health check (backends of ICMP services are not checked)
+  /// </summary>
+  HealthCheckTypeEnum getType() const;
+  void setType(HealthCheckTypeEnum value);
+  bool typeIsSet() const;
+  void unsetType();
+  static std::string HealthCheckTypeEnum_to_string(const HealthCheckTypeEnum &value);
+  static HealthCheckTypeEnum string_to_HealthCheckTypeEnum(const std::string &str);
+
+private:
+  uint32_t m_interval;
+  bool m_intervalIsSet;
+  uint32_t m_timeout;
+  bool m_timeoutIsSet;
+  std::string m_httpPath;
+  bool m_httpPathIsSet;
+  uint8_t m_rise;
+  bool m_riseIsSet;
+  uint8_t m_fall;
+  bool m_fallIsSet;
+  HealthCheckTypeEnum m_type;
+  bool m_typeIsSet;
+};
+
+}
+}
+}
+}
+
@@ -27,8 +27,12 @@ LbrpJsonObject::LbrpJsonObject() {
   m_portsIsSet = false;
   m_portMode = LbrpPortModeEnum::SINGLE;
   m_portModeIsSet = true;
+  m_maxServices = 128;
+  m_maxServicesIsSet = true;
   m_srcIpRewriteIsSet = false;
   m_serviceIsSet = false;
+  m_sessionTableIsSet = false;
+  m_healthCheckIsSet = false;
 }
 
 LbrpJsonObject::LbrpJsonObject(const nlohmann::json &val) :
@@ -36,8 +40,11 @@ LbrpJsonObject::LbrpJsonObject(const nlohmann::json &val) :
   m_nameIsSet = false;
   m_portsIsSet = false;
   m_portModeIsSet = false;
+  m_maxServicesIsSet = false;
   m_srcIpRewriteIsSet = false;
   m_serviceIsSet = false;
+  m_sessionTableIsSet = false;
+  m_healthCheckIsSet = false;
 
 
   if (val.count("name")) {
@@ -57,6 +64,10 @@ LbrpJsonObject::LbrpJsonObject(const nlohmann::json &val) :
     setPortMode(string_to_LbrpPortModeEnum(val.at("port_mode").get<std::string>()));
   }
 
+  if (val.count("max-services")) {
+    setMaxServices(val.at("max-services").get<uint32_t>());
+  }
+
   if (val.count("src-ip-rewrite")) {
     if (!val["src-ip-rewrite"].is_null()) {
       SrcIpRewriteJsonObject newItem { val["src-ip-rewrite"] };
@@ -72,6 +83,20 @@ LbrpJsonObject::LbrpJsonObject(const nlohmann::json &val) :
 
     m_serviceIsSet = true;
   }
+
+  if (val.count("session-table")) {
+    if (!val["session-table"].is_null()) {
+      SessionTableJsonObject newItem { val["session-table"] };
+      setSessionTable(newItem);
+    }
+  }
+
+  if (val.count("health-check")) {
+    if (!val["health-check"].is_null()) {
+      HealthCheckJsonObject newItem { val["health-check"] };
+      setHealthCheck(newItem);
+    }
+  }
 }
 
 nlohmann::json LbrpJsonObject::toJson() const {
@@ -99,6 +124,10 @@ nlohmann::json LbrpJsonObject::toJson() const {
     val["port_mode"] = LbrpPortModeEnum_to_string(m_portMode);
   }
 
+  if (m_maxServicesIsSet) {
+    val["max-services"] = m_maxServices;
+  }
+
   if (m_srcIpRewriteIsSet) {
     val["src-ip-rewrite"] = JsonObjectBase::toJson(m_srcIpRewrite);
   }
@@ -114,6 +143,14 @@ nlohmann::json LbrpJsonObject::toJson() const {
     }
   }
 
+  if (m_sessionTableIsSet) {
+    val["session-table"] = JsonObjectBase::toJson(m_sessionTable);
+  }
+
+  if (m_healthCheckIsSet) {
+    val["health-check"] = JsonObjectBase::toJson(m_healthCheck);
+  }
+
   return val;
 }
 
@@ -168,6 +205,23 @@ void LbrpJsonObject::unsetPortMode() {
   m_portModeIsSet = false;
 }
 
+uint32_t LbrpJsonObject::getMaxServices() const {
+  return m_maxServices;
+}
+
+void LbrpJsonObject::setMaxServices(uint32_t value) {
+  m_maxServices = value;
+  m_maxServicesIsSet = true;
+}
+
+bool LbrpJsonObject::maxServicesIsSet() const {
+  return m_maxServicesIsSet;
+}
+
+void LbrpJsonObject::unsetMaxServices() {
+  m_maxServicesIsSet = false;
+}
+
 std::string LbrpJsonObject::LbrpPortModeEnum_to_string(const LbrpPortModeEnum &value){
   switch(value) {
   case LbrpPortModeEnum::SINGLE:
@@ -221,6 +275,40 @@ void LbrpJsonObject::unsetService() {
   m_serviceIsSet = false;
 }
 
+SessionTableJsonObject LbrpJsonObject::getSessionTable() const {
+  return m_sessionTable;
+}
+
+void LbrpJsonObject::setSessionTable(SessionTableJsonObject value) {
+  m_sessionTable = value;
+  m_sessionTableIsSet = true;
+}
+
+bool LbrpJsonObject::sessionTableIsSet() const {
+  return m_sessionTableIsSet;
+}
+
+void LbrpJsonObject::unsetSessionTable() {
+  m_sessionTableIsSet = false;
+}
+
+HealthCheckJsonObject LbrpJsonObject::getHealthCheck() const {
+  return m_healthCheck;
+}
+
+void LbrpJsonObject::setHealthCheck(HealthCheckJsonObject value) {
+  m_healthCheck = value;
+  m_healthCheckIsSet = true;
+}
+
+bool LbrpJsonObject::healthCheckIsSet() const {
+  return m_healthCheckIsSet;
+}
+
+void LbrpJsonObject::unsetHealthCheck() {
+  m_healthCheckIsSet = false;
+}
+
 
 }
 }
@@ -26,6 +26,8 @@
 #include "ServiceJsonObject.h"
 #include "SrcIpRewriteJsonObject.h"
 #include "PortsJsonObject.h"
+#include "SessionTableJsonObject.h"
+#include "HealthCheckJsonObject.h"
 #include <vector>
 #include "polycube/services/cube.h"
 
@@ -76,6 +78,14 @@ public:
   static std::string LbrpPortModeEnum_to_string(const LbrpPortModeEnum &value);
   static LbrpPortModeEnum string_to_LbrpPortModeEnum(const std::string &str);
 
+  /// <summary>
+  /// Maximum number of services (can be set only at creation)
+  /// </summary>
+  uint32_t getMaxServices() const;
+  void setMaxServices(uint32_t value);
+  bool maxServicesIsSet() const;
+  void unsetMaxServices();
+
   /// <summary>
   /// If configured, when a client request arrives to the LB, the source IP
   /// address is replaced with another IP address from the 'new' range
@@ -93,6 +103,22 @@ public:
   bool serviceIsSet() const;
   void unsetService();
 
+  /// <summary>
+  /// Table of the sessions handled by the load balancer
+  /// </summary>
+  SessionTableJsonObject getSessionTable() const;
+  void setSessionTable(SessionTableJsonObject value);
+  bool sessionTableIsSet() const;
+  void unsetSessionTable();
+
+  /// <summary>
+  /// Active health checks of the backend servers, performed by the control plane
+  /// </summary>
+  HealthCheckJsonObject getHealthCheck() const;
+  void setHealthCheck(HealthCheckJsonObject value);
+  bool healthCheckIsSet() const;
+  void unsetHealthCheck();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -100,10 +126,16 @@ private:
   bool m_portsIsSet;
   LbrpPortModeEnum m_portMode;
   bool m_portModeIsSet;
+  uint32_t m_maxServices;
+  bool m_maxServicesIsSet;
   SrcIpRewriteJsonObject m_srcIpRewrite;
   bool m_srcIpRewriteIsSet;
   std::vector<ServiceJsonObject> m_service;
   bool m_serviceIsSet;
+  SessionTableJsonObject m_sessionTable;
+  bool m_sessionTableIsSet;
+  HealthCheckJsonObject m_healthCheck;
+  bool m_healthCheckIsSet;
 };
 
 }
@@ -27,6 +27,10 @@ ServiceBackendJsonObject::ServiceBackendJsonObject() {
   m_ipIsSet = false;
   m_portIsSet = false;
   m_weightIsSet = false;
+  m_activeSessionsIsSet = false;
+  m_state = ServiceBackendStateEnum::ACTIVE;
+  m_stateIsSet = true;
+  m_healthIsSet = false;
 }
 
 ServiceBackendJsonObject::ServiceBackendJsonObject(const nlohmann::json &val) :
@@ -35,6 +39,9 @@ ServiceBackendJsonObject::ServiceBackendJsonObject(const nlohmann::json &val) :
   m_ipIsSet = false;
   m_portIsSet = false;
   m_weightIsSet = false;
+  m_activeSessionsIsSet = false;
+  m_stateIsSet = false;
+  m_healthIsSet = false;
 
 
   if (val.count("name")) {
@@ -52,6 +59,18 @@ ServiceBackendJsonObject::ServiceBackendJsonObject(const nlohmann::json &val) :
   if (val.count("weight")) {
     setWeight(val.at("weight").get<uint16_t>());
   }
+
+  if (val.count("active-sessions")) {
+    setActiveSessions(val.at("active-sessions").get<uint32_t>());
+  }
+
+  if (val.count("state")) {
+    setState(string_to_ServiceBackendStateEnum(val.at("state").get<std::string>()));
+  }
+
+  if (val.count("health")) {
+    setHealth(string_to_ServiceBackendHealthEnum(val.at("health").get<std::string>()));
+  }
 }
 
 nlohmann::json ServiceBackendJsonObject::toJson() const {
@@ -76,6 +95,18 @@ nlohmann::json ServiceBackendJsonObject::toJson() const {
     val["weight"] = m_weight;
   }
 
+  if (m_activeSessionsIsSet) {
+    val["active-sessions"] = m_activeSessions;
+  }
+
+  if (m_stateIsSet) {
+    val["state"] = ServiceBackendStateEnum_to_string(m_state);
+  }
+
+  if (m_healthIsSet) {
+    val["health"] = ServiceBackendHealthEnum_to_string(m_health);
+  }
+
   return val;
 }
 
@@ -143,6 +174,103 @@ void ServiceBackendJsonObject::unsetWeight() {
   m_weightIsSet = false;
 }
 
+uint32_t ServiceBackendJsonObject::getActiveSessions() const {
+  return m_activeSessions;
+}
+
+void ServiceBackendJsonObject::setActiveSessions(uint32_t value) {
+  m_activeSessions = value;
+  m_activeSessionsIsSet = true;
+}
+
+bool ServiceBackendJsonObject::activeSessionsIsSet() const {
+  return m_activeSessionsIsSet;
+}
+
+void ServiceBackendJsonObject::unsetActiveSessions() {
+  m_activeSessionsIsSet = false;
+}
+
+ServiceBackendStateEnum ServiceBackendJsonObject::getState() const {
+  return m_state;
+}
+
+void ServiceBackendJsonObject::setState(ServiceBackendStateEnum value) {
+  m_state = value;
+  m_stateIsSet = true;
+}
+
+bool ServiceBackendJsonObject::stateIsSet() const {
+  return m_stateIsSet;
+}
+
+void ServiceBackendJsonObject::unsetState() {
+  m_stateIsSet = false;
+}
+
+std::string ServiceBackendJsonObject::ServiceBackendStateEnum_to_string(const ServiceBackendStateEnum &value){
+  switch(value) {
+  case ServiceBackendStateEnum::ACTIVE:
+    return std::string("active");
+  case ServiceBackendStateEnum::DRAINING:
+    return std::string("draining");
+  case ServiceBackendStateEnum::DOWN:
+    return std::string("down");
+  default:
+    throw std::runtime_error("Bad ServiceBackend state");
+  }
+}
+
+ServiceBackendStateEnum ServiceBackendJsonObject::string_to_ServiceBackendStateEnum(const std::string &str){
+  if (JsonObjectBase::iequals("active", str))
+    return ServiceBackendStateEnum::ACTIVE;
+  if (JsonObjectBase::iequals("draining", str))
+    return ServiceBackendStateEnum::DRAINING;
+  if (JsonObjectBase::iequals("down", str))
+    return ServiceBackendStateEnum::DOWN;
+  throw std::runtime_error("ServiceBackend state is invalid");
+}
+
+ServiceBackendHealthEnum ServiceBackendJsonObject::getHealth() const {
+  return m_health;
+}
+
+void ServiceBackendJsonObject::setHealth(ServiceBackendHealthEnum value) {
+  m_health = value;
+  m_healthIsSet = true;
+}
+
+bool ServiceBackendJsonObject::healthIsSet() const {
+  return m_healthIsSet;
+}
+
+void ServiceBackendJsonObject::unsetHealth() {
+  m_healthIsSet = false;
+}
+
+std::string ServiceBackendJsonObject::ServiceBackendHealthEnum_to_string(const ServiceBackendHealthEnum &value){
+  switch(value) {
+  case ServiceBackendHealthEnum::UNKNOWN:
+    return std::string("unknown");
+  case ServiceBackendHealthEnum::UP:
+    return std::string("up");
+  case ServiceBackendHealthEnum::DOWN:
+    return std::string("down");
+  default:
+    throw std::runtime_error("Bad ServiceBackend health");
+  }
+}
+
+ServiceBackendHealthEnum ServiceBackendJsonObject::string_to_ServiceBackendHealthEnum(const std::string &str){
+  if (JsonObjectBase::iequals("unknown", str))
+    return ServiceBackendHealthEnum::UNKNOWN;
+  if (JsonObjectBase::iequals("up", str))
+    return ServiceBackendHealthEnum::UP;
+  if (JsonObjectBase::iequals("down", str))
+    return ServiceBackendHealthEnum::DOWN;
+  throw std::runtime_error("ServiceBackend health is invalid");
+}
+
 
 }
 }
@@ -29,6 +29,12 @@ namespace swagger {
 namespace server {
 namespace model {
 
+enum class ServiceBackendStateEnum {
+  ACTIVE, DRAINING, DOWN
+};
+enum class ServiceBackendHealthEnum {
+  UNKNOWN, UP, DOWN
+};
 
 /// <summary>
 ///
@@ -71,6 +77,34 @@ public:
   bool weightIsSet() const;
   void unsetWeight();
 
+  /// <summary>
+  /// Number of sessions currently handled by this backend server
+  /// </summary>
+  uint32_t getActiveSessions() const;
+  void setActiveSessions(uint32_t value);
+  bool activeSessionsIsSet() const;
+  void unsetActiveSessions();
+
+  /// <summary>
+  /// Administrative state of the backend server
+  /// </summary>
+  ServiceBackendStateEnum getState() const;
+  void setState(ServiceBackendStateEnum value);
+  bool stateIsSet() const;
+  void unsetState();
+  static std::string ServiceBackendStateEnum_to_string(const ServiceBackendStateEnum &value);
+  static ServiceBackendStateEnum string_to_ServiceBackendStateEnum(const std::string &str);
+
+  /// <summary>
+  /// Result of the health checks of the backend server
+  /// </summary>
+  ServiceBackendHealthEnum getHealth() const;
+  void setHealth(ServiceBackendHealthEnum value);
+  bool healthIsSet() const;
+  void unsetHealth();
+  static std::string ServiceBackendHealthEnum_to_string(const ServiceBackendHealthEnum &value);
+  static ServiceBackendHealthEnum string_to_ServiceBackendHealthEnum(const std::string &str);
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -80,6 +114,12 @@ private:
   bool m_portIsSet;
   uint16_t m_weight;
   bool m_weightIsSet;
+  uint32_t m_activeSessions;
+  bool m_activeSessionsIsSet;
+  ServiceBackendStateEnum m_state;
+  bool m_stateIsSet;
+  ServiceBackendHealthEnum m_health;
+  bool m_healthIsSet;
 };
 
 }
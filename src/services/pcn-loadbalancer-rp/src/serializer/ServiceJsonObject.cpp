@@ -28,6 +28,7 @@ ServiceJsonObject::ServiceJsonObject() {
   m_vportIsSet = false;
   m_protoIsSet = false;
   m_backendIsSet = false;
+  m_activeSessionsIsSet = false;
 }
 
 ServiceJsonObject::ServiceJsonObject(const nlohmann::json &val) :
@@ -37,6 +38,7 @@ ServiceJsonObject::ServiceJsonObject(const nlohmann::json &val) :
   m_vportIsSet = false;
   m_protoIsSet = false;
   m_backendIsSet = false;
+  m_activeSessionsIsSet = false;
 
 
   if (val.count("name")) {
@@ -63,6 +65,10 @@ ServiceJsonObject::ServiceJsonObject(const nlohmann::json &val) :
 
     m_backendIsSet = true;
   }
+
+  if (val.count("active-sessions")) {
+    setActiveSessions(val.at("active-sessions").get<uint32_t>());
+  }
 }
 
 nlohmann::json ServiceJsonObject::toJson() const {
@@ -98,6 +104,10 @@ nlohmann::json ServiceJsonObject::toJson() const {
     }
   }
 
+  if (m_activeSessionsIsSet) {
+    val["active-sessions"] = m_activeSessions;
+  }
+
   return val;
 }
 
@@ -207,6 +217,23 @@ void ServiceJsonObject::unsetBackend() {
   m_backendIsSet = false;
 }
 
+uint32_t ServiceJsonObject::getActiveSessions() const {
+  return m_activeSessions;
+}
+
+void ServiceJsonObject::setActiveSessions(uint32_t value) {
+  m_activeSessions = value;
+  m_activeSessionsIsSet = true;
+}
+
+bool ServiceJsonObject::activeSessionsIsSet() const {
+  return m_activeSessionsIsSet;
+}
+
+void ServiceJsonObject::unsetActiveSessions() {
+  m_activeSessionsIsSet = false;
+}
+
 
 }
 }
@@ -85,6 +85,14 @@ public:
   bool backendIsSet() const;
   void unsetBackend();
 
+  /// <summary>
+  /// Number of sessions of this service currently in the session table
+  /// </summary>
+  uint32_t getActiveSessions() const;
+  void setActiveSessions(uint32_t value);
+  bool activeSessionsIsSet() const;
+  void unsetActiveSessions();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -96,6 +104,8 @@ private:
   bool m_protoIsSet;
   std::vector<ServiceBackendJsonObject> m_backend;
   bool m_backendIsSet;
+  uint32_t m_activeSessions;
+  bool m_activeSessionsIsSet;
 };
 
 }
@@ -0,0 +1,128 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableDumpInputJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableDumpInputJsonObject::SessionTableDumpInputJsonObject() {
+  m_fileIsSet = false;
+  m_vipIsSet = false;
+  m_backendIpIsSet = false;
+}
+
+SessionTableDumpInputJsonObject::SessionTableDumpInputJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_fileIsSet = false;
+  m_vipIsSet = false;
+  m_backendIpIsSet = false;
+
+
+  if (val.count("file")) {
+    setFile(val.at("file").get<std::string>());
+  }
+
+  if (val.count("vip")) {
+    setVip(val.at("vip").get<std::string>());
+  }
+
+  if (val.count("backend-ip")) {
+    setBackendIp(val.at("backend-ip").get<std::string>());
+  }
+}
+
+nlohmann::json SessionTableDumpInputJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_fileIsSet) {
+    val["file"] = m_file;
+  }
+
+  if (m_vipIsSet) {
+    val["vip"] = m_vip;
+  }
+
+  if (m_backendIpIsSet) {
+    val["backend-ip"] = m_backendIp;
+  }
+
+  return val;
+}
+
+std::string SessionTableDumpInputJsonObject::getFile() const {
+  return m_file;
+}
+
+void SessionTableDumpInputJsonObject::setFile(std::string value) {
+  m_file = value;
+  m_fileIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::fileIsSet() const {
+  return m_fileIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetFile() {
+  m_fileIsSet = false;
+}
+
+std::string SessionTableDumpInputJsonObject::getVip() const {
+  return m_vip;
+}
+
+void SessionTableDumpInputJsonObject::setVip(std::string value) {
+  m_vip = value;
+  m_vipIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::vipIsSet() const {
+  return m_vipIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetVip() {
+  m_vipIsSet = false;
+}
+
+std::string SessionTableDumpInputJsonObject::getBackendIp() const {
+  return m_backendIp;
+}
+
+void SessionTableDumpInputJsonObject::setBackendIp(std::string value) {
+  m_backendIp = value;
+  m_backendIpIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::backendIpIsSet() const {
+  return m_backendIpIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetBackendIp() {
+  m_backendIpIsSet = false;
+}
+
+
+}
+}
+}
+}
+
@@ -0,0 +1,81 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableDumpInputJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableDumpInputJsonObject : public JsonObjectBase {
+public:
+  SessionTableDumpInputJsonObject();
+  SessionTableDumpInputJsonObject(const nlohmann::json &json);
+  ~SessionTableDumpInputJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// File where the sessions are written (JSON format)
+  /// </summary>
+  std::string getFile() const;
+  void setFile(std::string value);
+  bool fileIsSet() const;
+  void unsetFile();
+
+  /// <summary>
+  /// Only dump sessions of services with this virtual IP address
+  /// </summary>
+  std::string getVip() const;
+  void setVip(std::string value);
+  bool vipIsSet() const;
+  void unsetVip();
+
+  /// <summary>
+  /// Only dump sessions handled by the backend server with this IP address
+  /// </summary>
+  std::string getBackendIp() const;
+  void setBackendIp(std::string value);
+  bool backendIpIsSet() const;
+  void unsetBackendIp();
+
+private:
+  std::string m_file;
+  bool m_fileIsSet;
+  std::string m_vip;
+  bool m_vipIsSet;
+  std::string m_backendIp;
+  bool m_backendIpIsSet;
+};
+
+}
+}
+}
+}
+
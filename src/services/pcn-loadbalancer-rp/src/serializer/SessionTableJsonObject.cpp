@@ -0,0 +1,156 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableJsonObject::SessionTableJsonObject() {
+  m_size = 65536;
+  m_sizeIsSet = true;
+  m_activeIsSet = false;
+  m_createdIsSet = false;
+  m_evictedIsSet = false;
+}
+
+SessionTableJsonObject::SessionTableJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_sizeIsSet = false;
+  m_activeIsSet = false;
+  m_createdIsSet = false;
+  m_evictedIsSet = false;
+
+
+  if (val.count("size")) {
+    setSize(val.at("size").get<uint32_t>());
+  }
+
+  if (val.count("active")) {
+    setActive(val.at("active").get<uint64_t>());
+  }
+
+  if (val.count("created")) {
+    setCreated(val.at("created").get<uint64_t>());
+  }
+
+  if (val.count("evicted")) {
+    setEvicted(val.at("evicted").get<uint64_t>());
+  }
+}
+
+nlohmann::json SessionTableJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_sizeIsSet) {
+    val["size"] = m_size;
+  }
+
+  if (m_activeIsSet) {
+    val["active"] = m_active;
+  }
+
+  if (m_createdIsSet) {
+    val["created"] = m_created;
+  }
+
+  if (m_evictedIsSet) {
+    val["evicted"] = m_evicted;
+  }
+
+  return val;
+}
+
+uint32_t SessionTableJsonObject::getSize() const {
+  return m_size;
+}
+
+void SessionTableJsonObject::setSize(uint32_t value) {
+  m_size = value;
+  m_sizeIsSet = true;
+}
+
+bool SessionTableJsonObject::sizeIsSet() const {
+  return m_sizeIsSet;
+}
+
+void SessionTableJsonObject::unsetSize() {
+  m_sizeIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getActive() const {
+  return m_active;
+}
+
+void SessionTableJsonObject::setActive(uint64_t value) {
+  m_active = value;
+  m_activeIsSet = true;
+}
+
+bool SessionTableJsonObject::activeIsSet() const {
+  return m_activeIsSet;
+}
+
+void SessionTableJsonObject::unsetActive() {
+  m_activeIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getCreated() const {
+  return m_created;
+}
+
+void SessionTableJsonObject::setCreated(uint64_t value) {
+  m_created = value;
+  m_createdIsSet = true;
+}
+
+bool SessionTableJsonObject::createdIsSet() const {
+  return m_createdIsSet;
+}
+
+void SessionTableJsonObject::unsetCreated() {
+  m_createdIsSet = false;
+}
+
+uint64_t SessionTableJsonObject::getEvicted() const {
+  return m_evicted;
+}
+
+void SessionTableJsonObject::setEvicted(uint64_t value) {
+  m_evicted = value;
+  m_evictedIsSet = true;
+}
+
+bool SessionTableJsonObject::evictedIsSet() const {
+  return m_evictedIsSet;
+}
+
+void SessionTableJsonObject::unsetEvicted() {
+  m_evictedIsSet = false;
+}
+
+
+}
+}
+}
+}
+
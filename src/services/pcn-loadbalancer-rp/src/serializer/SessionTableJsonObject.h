@@ -0,0 +1,91 @@
+/**
+* lbrp API
+* lbrp API generated from lbrp.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableJsonObject : public JsonObjectBase {
+public:
+  SessionTableJsonObject();
+  SessionTableJsonObject(const nlohmann::json &json);
+  ~SessionTableJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Maximum number of sessions (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() const;
+  void setSize(uint32_t value);
+  bool sizeIsSet() const;
+  void unsetSize();
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  uint64_t getActive() const;
+  void setActive(uint64_t value);
+  bool activeIsSet() const;
+  void unsetActive();
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  uint64_t getCreated() const;
+  void setCreated(uint64_t value);
+  bool createdIsSet() const;
+  void unsetCreated();
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  uint64_t getEvicted() const;
+  void setEvicted(uint64_t value);
+  bool evictedIsSet() const;
+  void unsetEvicted();
+
+private:
+  uint32_t m_size;
+  bool m_sizeIsSet;
+  uint64_t m_active;
+  bool m_activeIsSet;
+  uint64_t m_created;
+  bool m_createdIsSet;
+  uint64_t m_evicted;
+  bool m_evictedIsSet;
+};
+
+}
+}
+}
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * Measures how many flows change backend when a backend is added to or
+ * removed from a service, with the Maglev lookup table used by the datapath.
+ * Ideally only the flows of the removed backend (or the ones taken by the new
+ * backend) move; the "extra" column counts the other ones.
+ *
+ * usage: maglev_disruption [table size] [flows]
+ */
+
+#include "polycube/services/maglev.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace polycube::service;
+
+static std::vector<MaglevBackend> makeBackends(int n) {
+  std::vector<MaglevBackend> backends;
+  for (int i = 0; i < n; i++) {
+    backends.push_back({"10.0." + std::to_string(i / 250) + "." +
+                            std::to_string(i % 250 + 1),
+                        1});
+  }
+  return backends;
+}
+
+static std::string owner(const std::vector<MaglevBackend> &backends,
+                         const std::vector<int> &table, uint32_t hash) {
+  return backends[table[hash % table.size()]].name;
+}
+
+// Returns the fraction of flows that moved to a backend that was not
+// involved in the change
+static double measure(const char *what, int n,
+                      const std::vector<MaglevBackend> &before,
+                      const std::vector<MaglevBackend> &after,
+                      const std::string &changed, uint32_t size,
+                      const std::vector<uint32_t> &flows) {
+  auto table_before = maglevPopulate(before, size);
+  auto table_after = maglevPopulate(after, size);
+
+  uint64_t moved = 0, extra = 0;
+  for (uint32_t hash : flows) {
+    std::string old_backend = owner(before, table_before, hash);
+    std::string new_backend = owner(after, table_after, hash);
+    if (old_backend == new_backend) {
+      continue;
+    }
+    moved++;
+    if (old_backend != changed && new_backend != changed) {
+      extra++;
+    }
+  }
+
+  double moved_pct = 100.0 * moved / flows.size();
+  double extra_pct = 100.0 * extra / flows.size();
+  printf("%-8s %6d %10.2f%% %10.2f%% %10.2f%%\n", what, n, 100.0 / n,
+         moved_pct, extra_pct);
+  return extra_pct;
+}
+
+int main(int argc, char **argv) {
+  uint32_t size = argc > 1 ? atoi(argv[1]) : 4093;
+  int nflows = argc > 2 ? atoi(argv[2]) : 1000000;
+  if (!isPrime(size)) {
+    fprintf(stderr, "table size must be prime\n");
+    return 1;
+  }
+
+  std::mt19937 engine(42);
+  std::vector<uint32_t> flows(nflows);
+  for (auto &flow : flows) {
+    flow = engine();
+  }
+
+  printf("table size %u, %d flows\n", size, nflows);
+  printf("%-8s %6s %11s %11s %11s\n", "change", "pool", "ideal", "moved",
+         "extra");
+
+  double worst = 0;
+  for (int n : {2, 5, 10, 20, 50, 100}) {
+    auto backends = makeBackends(n);
+
+    // remove a backend in the middle of the list
+    auto removed = backends;
+    std::string victim = removed[n / 2].name;
+    removed.erase(removed.begin() + n / 2);
+    worst = std::max(
+        worst, measure("remove", n, backends, removed, victim, size, flows));
+
+    // add a new backend
+    auto added = makeBackends(n + 1);
+    worst = std::max(worst, measure("add", n + 1, backends, added,
+                                    added.back().name, size, flows));
+  }
+
+  printf("worst extra disruption %.2f%%\n", worst);
+  // a few percent at most with a table much larger than the pool
+  return worst < 5.0 ? 0 : 1;
+}
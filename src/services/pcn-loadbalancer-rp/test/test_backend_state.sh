@@ -0,0 +1,109 @@
+#!/bin/bash
+
+# test the backend states: new sessions must not be sent to a DRAINING backend,
+# which keeps its current sessions. Then the health checks must detect a
+# backend that stops answering (an HTTP server on the host stands in for the
+# backend)
+
+# include helper.bash file: used to provide some common function across testing scripts
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function cleanup {
+  set +e
+  polycubectl lbrp del lb0
+  for i in `seq 1 2`; do
+          sudo ip link del veth${i}
+          sudo ip netns del ns${i}
+  done
+  kill $server_pid
+}
+trap cleanup EXIT
+
+set -x
+set -e
+
+function sessions {
+  polycubectl lb0 service 10.0.0.1 80 UDP backend $1 active-sessions show
+}
+
+function health {
+  polycubectl lb0 service 10.0.0.2 8080 TCP backend $1 health show
+}
+
+polycubectl lbrp add lb0 port_mode=SINGLE
+
+for i in `seq 1 2`; do
+  create_veth ${i}
+  sudo ip netns exec ns${i} ip addr add 192.178.1.${i}/24 dev veth${i}_
+  if [[ "$i" -eq 2 ]]; then
+    polycubectl lb0 ports add to_ns${i} type=BACKEND peer=veth${i}
+  else
+    polycubectl lb0 ports add to_ns${i} type=FRONTEND peer=veth${i}
+  fi
+done
+
+# both the backends are in ns2
+sudo ip netns exec ns2 ip addr add 192.178.1.3/24 dev veth2_
+sudo ip netns exec ns1 ip route add default via 192.178.1.2
+
+polycubectl lb0 service add 10.0.0.1 80 UDP name=my-service
+polycubectl lb0 service 10.0.0.1 80 UDP backend add 192.178.1.2 port=80 name=backend1
+polycubectl lb0 service 10.0.0.1 80 UDP backend add 192.178.1.3 port=80 name=backend2
+
+for port in `seq 50000 50015`; do
+  sudo ip netns exec ns1 nping --udp -c 1 -p 80 --source-port $port 10.0.0.1 > /dev/null
+done
+
+sessions1=$(sessions 192.178.1.2)
+sessions2=$(sessions 192.178.1.3)
+if [ "$sessions1" -eq 0 ] || [ "$sessions2" -eq 0 ]; then
+  exit 1
+fi
+
+polycubectl lb0 service 10.0.0.1 80 UDP backend 192.178.1.2 set state=DRAINING
+
+# known sessions keep their backend, new ones go to the active backend
+for port in `seq 50000 50031`; do
+  sudo ip netns exec ns1 nping --udp -c 1 -p 80 --source-port $port 10.0.0.1 > /dev/null
+done
+
+if [ "$(sessions 192.178.1.2)" -ne "$sessions1" ]; then
+  exit 1
+fi
+if [ "$(sessions 192.178.1.3)" -ne $((sessions2 + 16)) ]; then
+  exit 1
+fi
+
+# health checks
+python3 -m http.server 18080 --bind 127.0.0.1 > /dev/null 2>&1 &
+server_pid=$!
+sleep 1
+
+polycubectl lb0 service add 10.0.0.2 8080 TCP
+polycubectl lb0 service 10.0.0.2 8080 TCP backend add 127.0.0.1 port=18080
+# nothing listens on this one
+polycubectl lb0 service 10.0.0.2 8080 TCP backend add 127.0.0.2 port=18081
+
+if [ "$(health 127.0.0.1)" != "unknown" ]; then
+  exit 1
+fi
+
+polycubectl lb0 health-check set type=HTTP interval=1 rise=1 fall=2
+sleep 4
+
+if [ "$(health 127.0.0.1)" != "up" ] || [ "$(health 127.0.0.2)" != "down" ]; then
+  exit 1
+fi
+
+kill $server_pid
+sleep 4
+
+if [ "$(health 127.0.0.1)" != "down" ]; then
+  exit 1
+fi
+
+# disabling the checks resets the health
+polycubectl lb0 health-check set type=NONE
+if [ "$(health 127.0.0.1)" != "unknown" ]; then
+  exit 1
+fi
@@ -0,0 +1,23 @@
+#!/bin/bash
+
+# Disruption benchmark of the Maglev lookup table: builds the tables used by
+# the datapath for pools of different sizes, and checks that adding/removing
+# a backend moves few flows among the other backends.
+# It does not need polycubed.
+
+set -x
+set -e
+
+dir=$(dirname "${BASH_SOURCE[0]}")
+bin=$(mktemp)
+
+function cleanup {
+  rm -f $bin
+}
+trap cleanup EXIT
+
+libpolycube=$dir/../../../libs/polycube
+g++ -std=c++11 -O2 -I$libpolycube/include $dir/maglev_disruption.cpp \
+  $libpolycube/src/maglev.cpp -o $bin
+
+$bin
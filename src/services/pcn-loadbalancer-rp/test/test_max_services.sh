@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# test the max-services parameter: the cube holds at most max-services
+# services, adding one more must fail, and the slot of a deleted service can
+# be used again
+
+function cleanup {
+  set +e
+  polycubectl lbrp del lb0
+  polycubectl lbrp del lb1
+}
+trap cleanup EXIT
+
+set -x
+set -e
+
+# the default is 128
+polycubectl lbrp add lb1
+max=$(polycubectl lb1 max-services show)
+if [ "$max" -ne 128 ]; then
+  echo "Wrong default max-services: $max"
+  exit 1
+fi
+
+# out of range values are rejected
+if polycubectl lbrp add lb0 max-services=2048; then
+  echo "max-services above 1024 accepted"
+  exit 1
+fi
+
+polycubectl lbrp add lb0 max-services=2
+polycubectl lb0 service add 10.0.0.1 80 UDP
+polycubectl lb0 service add 10.0.0.1 80 TCP
+
+if polycubectl lb0 service add 10.0.0.2 80 UDP; then
+  echo "Service added beyond max-services"
+  exit 1
+fi
+
+polycubectl lb0 service del 10.0.0.1 80 UDP
+polycubectl lb0 service add 10.0.0.2 80 UDP
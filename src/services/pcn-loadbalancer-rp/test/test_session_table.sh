@@ -0,0 +1,81 @@
+#!/bin/bash
+
+# test the session table: each UDP flow must create its own session, counted
+# for the service and for the backend that handles it, and the sessions dump
+# must contain only the filtered sessions
+
+# include helper.bash file: used to provide some common function across testing scripts
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function cleanup {
+  set +e
+  polycubectl lbrp del lb0
+  for i in `seq 1 2`; do
+          sudo ip link del veth${i}
+          sudo ip netns del ns${i}
+  done
+  rm -f $dump_file
+}
+trap cleanup EXIT
+
+dump_file=/tmp/lb0_sessions.json
+
+set -x
+set -e
+
+polycubectl lbrp add lb0 port_mode=SINGLE session-table.size=4096
+
+for i in `seq 1 2`; do
+  create_veth ${i}
+  sudo ip netns exec ns${i} ip addr add 192.178.1.${i}/24 dev veth${i}_
+  if [[ "$i" -eq 2 ]]; then
+    polycubectl lb0 ports add to_ns${i} type=BACKEND peer=veth${i}
+  else
+    polycubectl lb0 ports add to_ns${i} type=FRONTEND peer=veth${i}
+  fi
+done
+
+sudo ip netns exec ns1 ip route add default via 192.178.1.2
+
+polycubectl lb0 service add 10.0.0.1 80 UDP name=my-service
+polycubectl lb0 service 10.0.0.1 80 UDP backend add 192.178.1.2 port=80 weight=1 name=backend1
+
+# the session table size can be set only when the cube is created
+size=$(polycubectl lb0 session-table size show)
+if [ "$size" -ne 4096 ]; then
+  exit 1
+fi
+if polycubectl lb0 session-table set size=8192; then
+  exit 1
+fi
+
+for port in `seq 50000 50003`; do
+  sudo ip netns exec ns1 nping --udp -c 2 -p 80 --source-port $port 10.0.0.1 > /dev/null
+done
+
+created=$(polycubectl lb0 session-table created show)
+if [ "$created" -ne 4 ]; then
+  exit 1
+fi
+
+active=$(polycubectl lb0 service 10.0.0.1 80 UDP active-sessions show)
+if [ "$active" -ne 4 ]; then
+  exit 1
+fi
+
+active=$(polycubectl lb0 service 10.0.0.1 80 UDP backend 192.178.1.2 active-sessions show)
+if [ "$active" -ne 4 ]; then
+  exit 1
+fi
+
+polycubectl lb0 session-table dump file=$dump_file backend-ip=192.178.1.2
+entries=$(grep -c '"client-port"' $dump_file)
+if [ "$entries" -ne 4 ]; then
+  exit 1
+fi
+
+polycubectl lb0 session-table dump file=$dump_file backend-ip=192.178.1.3
+entries=$(grep -c '"client-port"' $dump_file || true)
+if [ "$entries" -ne 0 ]; then
+  exit 1
+fi
@@ -22,17 +22,60 @@
 #include "Nat_dp_egress.h"
 #include "Nat_dp_ingress.h"
 
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace polycube::service;
+
+#define NAT_FIRST_DYNAMIC_PORT 1024
+#define NAT_LAST_DYNAMIC_PORT 65535
+
+// number of entries read by each batch operation on the session tables
+#define NAT_SESSION_BATCH_SIZE 1024
+// interval (seconds) between two scans of the session tables
+#define NAT_SESSION_SWEEP_INTERVAL 5
+// size (pages) of the per-cpu buffers of the port block allocations
+#define NAT_PORT_BLOCK_EVENT_PAGES 8
+
 Nat::Nat(const std::string name, const NatJsonObject &conf)
-    : TransparentCube(
-          conf.getBase(),
-          {generate_code() + nat_code_common + nat_code_ingress + nat_code},
-          {generate_code() + nat_code_common + nat_code_egress + nat_code}) {
+    : TransparentCube(conf.getBase(),
+                      {generate_code(conf.getSessionTable().getSize()) +
+                       nat_code_common + nat_code_ingress + nat_code},
+                      {generate_code(conf.getSessionTable().getSize()) +
+                       nat_code_common + nat_code_egress + nat_code}),
+      quit_thread_(false),
+      sessions_expired_(0),
+      sessions_evicted_(0),
+      now_(0) {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [Nat] [%n] [%l] %v");
   logger()->info("Creating Nat instance");
 
+  session_table_size_ = conf.getSessionTable().getSize();
+  addSessionTable(conf.getSessionTable());
+
   addRule(conf.getRule());
   //addNattingTableList(conf.getNattingTable());
 
+  initPortRanges();
+
+  port_block_events_ = get_perf_buffer(
+      "port_block_events",
+      [this](void *data, int size) { logPortBlockAllocation(data, size); },
+      [this](uint64_t lost) {
+        logger()->warn("{0} port block allocations not logged", lost);
+      },
+      NAT_PORT_BLOCK_EVENT_PAGES, 0, ProgramType::EGRESS);
+
+  updateTimestamp();
+  session_timer_thread_ = std::thread(&Nat::sessionTimer, this);
+
   ParameterEventCallback cb = [&](const std::string &parameter, const std::string &value) {
     external_ip_ = utils::get_ip_from_string(value);
     logger()->debug("parent IP has been updated to {}", external_ip_);
@@ -45,6 +88,360 @@ Nat::Nat(const std::string name, const NatJsonObject &conf)
 
 Nat::~Nat() {
   unsubscribe_parent_parameter("ip");
+  quitAndJoin();
+}
+
+void Nat::quitAndJoin() {
+  quit_thread_ = true;
+  session_timer_thread_.join();
+}
+
+void Nat::sessionTimer() {
+  unsigned int seconds = 0;
+  do {
+    sleep(1);
+    updateTimestamp();
+    port_block_events_.poll(0);
+    if (++seconds % NAT_SESSION_SWEEP_INTERVAL == 0) {
+      sweepSessions();
+      sweepMappings();
+      sweepHairpinSessions();
+      sweepPortBlocks();
+    }
+  } while (!quit_thread_);
+}
+
+/*
+ * Sessions are refreshed by the datapath using the time written in the
+ * timestamp table, so that the bpf_ktime helper is not called for each packet.
+ */
+void Nat::updateTimestamp() {
+  try {
+    struct timespec now_timespec;
+    clock_gettime(CLOCK_MONOTONIC, &now_timespec);
+    auto timestamp_table =
+        get_array_table<uint32_t>("timestamp", 0, ProgramType::INGRESS);
+    timestamp_table.set(0, now_timespec.tv_sec);
+    now_ = now_timespec.tv_sec;
+  } catch (...) {
+    logger()->error("Error while updating the timestamp table");
+  }
+}
+
+// key of the ingress session table entry paired with an egress one
+static st_k session_ingress_key(const st_k &key, const st_v &value) {
+  st_k reverse;
+  reverse.src_ip = key.dst_ip;
+  reverse.dst_ip = value.new_ip;
+  // for ICMP both "ports" are equal to the ICMP ID
+  reverse.src_port =
+      key.proto == IPPROTO_ICMP ? value.new_port : key.dst_port;
+  reverse.dst_port = value.new_port;
+  reverse.proto = key.proto;
+  return reverse;
+}
+
+// key of the egress session table entry paired with an ingress one
+static st_k session_egress_key(const st_k &key, const st_v &value) {
+  st_k forward;
+  forward.src_ip = value.new_ip;
+  forward.dst_ip = key.src_ip;
+  forward.src_port = value.new_port;
+  forward.dst_port =
+      key.proto == IPPROTO_ICMP ? value.new_port : key.src_port;
+  forward.proto = key.proto;
+  return forward;
+}
+
+// key of the mapping paired with another one, valid in both directions
+static eim_k mapping_reverse_key(const eim_k &key, const eim_v &value) {
+  eim_k reverse;
+  reverse.ip = value.ip;
+  reverse.port = value.port;
+  reverse.proto = key.proto;
+  return reverse;
+}
+
+// key of the hairpin session of the other direction, valid in both of them
+static st_k hairpin_reverse_key(const st_k &key, const hp_v &value) {
+  st_k reverse;
+  reverse.src_ip = value.new_dst_ip;
+  reverse.dst_ip = value.new_src_ip;
+  reverse.src_port = value.new_dst_port;
+  reverse.dst_port = value.new_src_port;
+  reverse.proto = key.proto;
+  return reverse;
+}
+
+template <typename K>
+static std::string key_bytes(const K &key) {
+  return std::string(reinterpret_cast<const char *>(&key), sizeof(key));
+}
+
+/*
+ * Removes the pairs of entries (one per direction) that have been idle for
+ * longer than their timeout, and the entries whose counterpart in the other
+ * direction has been evicted from the lru table when it was full.
+ * Both the sessions and the endpoint-independent mappings are stored this way.
+ */
+template <typename K, typename V>
+static void sweep_pairs(HashTable<K, V> &egress_table,
+                        HashTable<K, V> &ingress_table,
+                        const std::vector<std::pair<K, V>> &egress_entries,
+                        const std::vector<std::pair<K, V>> &ingress_entries,
+                        std::function<K(const K &, const V &)> ingress_key_of,
+                        std::function<K(const K &, const V &)> egress_key_of,
+                        std::function<uint32_t(const K &)> timeout_of,
+                        uint32_t now, uint64_t &expired, uint64_t &evicted) {
+  std::unordered_map<std::string, size_t> ingress_index;
+  for (size_t i = 0; i < ingress_entries.size(); i++) {
+    ingress_index[key_bytes(ingress_entries[i].first)] = i;
+  }
+  std::vector<bool> paired(ingress_entries.size(), false);
+
+  for (auto &entry : egress_entries) {
+    auto &key = entry.first;
+    auto &value = entry.second;
+    K reverse_key = ingress_key_of(key, value);
+    V reverse_value;
+
+    auto it = ingress_index.find(key_bytes(reverse_key));
+    if (it != ingress_index.end()) {
+      paired[it->second] = true;
+      reverse_value = ingress_entries[it->second].second;
+    } else {
+      // the entry could have been created after the ingress table was read
+      try {
+        reverse_value = ingress_table.get(reverse_key);
+      } catch (...) {
+        try {
+          egress_table.remove(key);
+          evicted++;
+        } catch (...) {
+        }
+        continue;
+      }
+    }
+
+    // fields of packed structs cannot be bound to references
+    uint32_t egress_ts = value.timestamp, ingress_ts = reverse_value.timestamp;
+    uint32_t last_seen = std::max(egress_ts, ingress_ts);
+    if (now <= last_seen || now - last_seen <= timeout_of(key)) {
+      continue;
+    }
+
+    try {
+      egress_table.remove(key);
+      ingress_table.remove(reverse_key);
+      expired++;
+    } catch (...) {
+    }
+  }
+
+  for (size_t i = 0; i < ingress_entries.size(); i++) {
+    if (paired[i]) {
+      continue;
+    }
+    auto &key = ingress_entries[i].first;
+    try {
+      egress_table.get(egress_key_of(key, ingress_entries[i].second));
+    } catch (...) {
+      try {
+        ingress_table.remove(key);
+        evicted++;
+      } catch (...) {
+      }
+    }
+  }
+}
+
+void Nat::sweepSessions() {
+  uint64_t expired = 0, evicted = 0;
+
+  try {
+    auto egress_table = get_hash_table<st_k, st_v>("egress_session_table", 0,
+                                                   ProgramType::INGRESS);
+    auto ingress_table = get_hash_table<st_k, st_v>("ingress_session_table",
+                                                    0, ProgramType::INGRESS);
+    // ingress first: entries created in the meantime are found by lookup
+    auto ingress_entries = getSessionEntries("ingress_session_table");
+    auto egress_entries = getSessionEntries("egress_session_table");
+
+    sweep_pairs<st_k, st_v>(
+        egress_table, ingress_table, egress_entries, ingress_entries,
+        session_ingress_key, session_egress_key,
+        [&](const st_k &key) { return session_table_->getTimeout(key.proto); },
+        now_, expired, evicted);
+  } catch (std::exception &e) {
+    logger()->error("Error while sweeping the session tables: {0}", e.what());
+  }
+
+  sessions_expired_ += expired;
+  sessions_evicted_ += evicted;
+
+  if (expired > 0 || evicted > 0) {
+    logger()->debug("Removed {0} expired and {1} evicted sessions", expired,
+                    evicted);
+  }
+}
+
+void Nat::sweepMappings() {
+  uint64_t expired = 0, evicted = 0;
+
+  try {
+    auto egress_table =
+        get_hash_table<eim_k, eim_v>("eim_egress", 0, ProgramType::INGRESS);
+    auto ingress_table =
+        get_hash_table<eim_k, eim_v>("eim_ingress", 0, ProgramType::INGRESS);
+    auto ingress_entries = getMappingEntries("eim_ingress");
+    auto egress_entries = getMappingEntries("eim_egress");
+
+    sweep_pairs<eim_k, eim_v>(
+        egress_table, ingress_table, egress_entries, ingress_entries,
+        mapping_reverse_key, mapping_reverse_key,
+        [&](const eim_k &key) { return session_table_->getTimeout(key.proto); },
+        now_, expired, evicted);
+  } catch (std::exception &e) {
+    logger()->error("Error while sweeping the mapping tables: {0}", e.what());
+  }
+
+  if (expired > 0 || evicted > 0) {
+    logger()->debug("Removed {0} expired and {1} evicted mappings", expired,
+                    evicted);
+  }
+}
+
+/*
+ * Both directions of the hairpin sessions are in the same table, so each pair
+ * is seen twice: the second time its entries are already gone.
+ */
+void Nat::sweepHairpinSessions() {
+  uint64_t expired = 0, evicted = 0;
+
+  try {
+    auto table = get_hash_table<st_k, hp_v>("hairpin_session_table", 0,
+                                            ProgramType::EGRESS);
+    auto entries = getHairpinEntries();
+
+    sweep_pairs<st_k, hp_v>(
+        table, table, entries, entries, hairpin_reverse_key,
+        hairpin_reverse_key,
+        [&](const st_k &key) { return session_table_->getTimeout(key.proto); },
+        now_, expired, evicted);
+  } catch (std::exception &e) {
+    logger()->error("Error while sweeping the hairpin sessions: {0}",
+                    e.what());
+  }
+
+  sessions_expired_ += expired;
+  sessions_evicted_ += evicted;
+
+  if (expired > 0 || evicted > 0) {
+    logger()->debug("Removed {0} expired and {1} evicted hairpin sessions",
+                    expired, evicted);
+  }
+}
+
+static uint64_t port_block_user(uint32_t internal_ip, uint32_t external_ip) {
+  return (uint64_t)internal_ip << 32 | external_ip;
+}
+
+/*
+ * A block is released when its internal address has no more sessions or
+ * mappings on the external address of the block. Blocks used by the datapath
+ * during the last sweep interval are kept, since the session that is being
+ * created may not be in the session table yet.
+ */
+void Nat::sweepPortBlocks() {
+  try {
+    auto blocks = getPortBlockEntries();
+    if (blocks.empty()) {
+      return;
+    }
+
+    std::unordered_set<uint64_t> users;
+    for (auto &entry : getSessionEntries("egress_session_table")) {
+      users.insert(port_block_user(entry.first.src_ip, entry.second.new_ip));
+    }
+    for (auto &entry : getMappingEntries("eim_egress")) {
+      users.insert(port_block_user(entry.first.ip, entry.second.ip));
+    }
+
+    auto table = get_hash_table<pb_k, pb_v>("port_blocks", 0,
+                                            ProgramType::EGRESS);
+    for (auto &entry : blocks) {
+      auto &key = entry.first;
+      if (users.count(port_block_user(key.internal_ip, key.external_ip)) ||
+          now_ - entry.second.timestamp <= NAT_SESSION_SWEEP_INTERVAL) {
+        continue;
+      }
+      // the block may have been used after it was read
+      pb_v value;
+      try {
+        value = table.get(key);
+      } catch (...) {
+        continue;
+      }
+      if (now_ - value.timestamp <= NAT_SESSION_SWEEP_INTERVAL) {
+        continue;
+      }
+      releasePortBlock(key, value);
+    }
+  } catch (std::exception &e) {
+    logger()->error("Error while sweeping the port blocks: {0}", e.what());
+  }
+}
+
+void Nat::releasePortBlocks() {
+  try {
+    for (auto &entry : getPortBlockEntries()) {
+      releasePortBlock(entry.first, entry.second);
+    }
+  } catch (std::exception &e) {
+    logger()->error("Error while releasing the port blocks: {0}", e.what());
+  }
+}
+
+/*
+ * The block is removed from the allocated ones first, so that the datapath
+ * allocates a new block to the address instead of using the released one.
+ * The owner entry is removed afterwards, making the block free.
+ */
+void Nat::releasePortBlock(const pb_k &key, const pb_v &value) {
+  auto blocks = get_hash_table<pb_k, pb_v>("port_blocks", 0,
+                                           ProgramType::EGRESS);
+  auto owners = get_hash_table<pbo_k, uint32_t>("port_block_owners", 0,
+                                                ProgramType::EGRESS);
+  try {
+    blocks.remove(key);
+  } catch (...) {
+    // already released by another thread
+    return;
+  }
+
+  pbo_k owner_key{
+      .external_ip = key.external_ip, .first = value.first, .pad = 0,
+  };
+  try {
+    owners.remove(owner_key);
+  } catch (...) {
+    logger()->warn("Port block {0} of {1} has no owner", value.first,
+                   utils::nbo_uint_to_ip_string(key.external_ip));
+  }
+
+  logger()->info("Port block {0}-{1} of {2} released by {3}", value.first,
+                 value.last, utils::nbo_uint_to_ip_string(key.external_ip),
+                 utils::nbo_uint_to_ip_string(key.internal_ip));
+}
+
+void Nat::logPortBlockAllocation(void *data, int size) {
+  if (size < (int)sizeof(pb_event)) {
+    return;
+  }
+  auto event = static_cast<const pb_event *>(data);
+  logger()->info("Port block {0}-{1} of {2} allocated to {3}", event->first,
+                 event->last, utils::nbo_uint_to_ip_string(event->external_ip),
+                 utils::nbo_uint_to_ip_string(event->internal_ip));
 }
 
 void Nat::update(const NatJsonObject &conf) {
@@ -57,6 +454,10 @@ void Nat::update(const NatJsonObject &conf) {
     auto m = getRule();
     m->update(conf.getRule());
   }
+  if (conf.sessionTableIsSet()) {
+    auto m = getSessionTable();
+    m->update(conf.getSessionTable());
+  }
   if (conf.nattingTableIsSet()) {
     for (auto &i : conf.getNattingTable()) {
       auto internalSrc = i.getInternalSrc();
@@ -76,10 +477,13 @@ NatJsonObject Nat::toJsonObject() {
   conf.setBase(TransparentCube::to_json());
 
   conf.setRule(getRule()->toJsonObject());
+  conf.setSessionTable(getSessionTable()->toJsonObject());
 
   for (auto &i : getNattingTableList()) {
     conf.addNattingTable(i->toJsonObject());
   }
+
+  conf.setStats(getStats()->toJsonObject());
   return conf;
 }
 
@@ -89,9 +493,15 @@ void Nat::packet_in(polycube::service::Direction direction,
   logger()->info("packet in event");
 }
 
-std::string Nat::generate_code() {
+std::string Nat::generate_code(uint32_t session_table_size) {
   std::ostringstream defines;
 
+  defines << "#define NAT_MAP_DIM " << session_table_size << std::endl;
+  defines << "#define NAT_FIRST_DYNAMIC_PORT " << NAT_FIRST_DYNAMIC_PORT
+          << std::endl;
+  defines << "#define NAT_LAST_DYNAMIC_PORT " << NAT_LAST_DYNAMIC_PORT
+          << std::endl;
+
   defines << "#define NAT_SRC (" << (int)NattingTableOriginatingRuleEnum::SNAT
           << ")" << std::endl;
   defines << "#define NAT_DST (" << (int)NattingTableOriginatingRuleEnum::DNAT
@@ -102,9 +512,42 @@ std::string Nat::generate_code() {
   defines << "#define NAT_PFW ("
           << (int)NattingTableOriginatingRuleEnum::PORTFORWARDING << ")"
           << std::endl;
+
+  defines << "#define NAT_STATS_PORT_ALLOC_FAILURES ("
+          << (int)StatsCounter::PORT_ALLOC_FAILURES << ")" << std::endl;
+  defines << "#define NAT_STATS_PORT_COLLISIONS ("
+          << (int)StatsCounter::PORT_COLLISIONS << ")" << std::endl;
+  defines << "#define NAT_STATS_SESSIONS_CREATED ("
+          << (int)StatsCounter::SESSIONS_CREATED << ")" << std::endl;
+  defines << "#define NAT_STATS_DIM (" << (int)StatsCounter::DIM << ")"
+          << std::endl;
   return defines.str() /*+ nat_code*/;
 }
 
+void Nat::initPortRanges() {
+  // Split the dynamic port space among the cpus, so that each of them can
+  // allocate ports without synchronizing with the others
+  unsigned int ncpus = polycube::get_possible_cpu_count();
+  uint32_t ports = NAT_LAST_DYNAMIC_PORT - NAT_FIRST_DYNAMIC_PORT + 1;
+  uint32_t ports_per_cpu = ports / ncpus;
+
+  std::vector<port_range> ranges;
+  for (unsigned int i = 0; i < ncpus; i++) {
+    port_range range;
+    range.first = NAT_FIRST_DYNAMIC_PORT + i * ports_per_cpu;
+    range.last = (i == ncpus - 1) ? NAT_LAST_DYNAMIC_PORT
+                                  : range.first + ports_per_cpu - 1;
+    ranges.push_back(range);
+  }
+
+  auto port_ranges =
+      get_percpuarray_table<port_range>("port_range", 0, ProgramType::EGRESS);
+  port_ranges.set(0, ranges);
+
+  logger()->debug("Port range {0}-{1} split among {2} cpus",
+                  NAT_FIRST_DYNAMIC_PORT, NAT_LAST_DYNAMIC_PORT, ncpus);
+}
+
 std::string Nat::getExternalIpString() {
   return external_ip_;
 }
@@ -190,8 +633,7 @@ std::shared_ptr<NattingTable> Nat::getNattingTable(
 std::vector<std::shared_ptr<NattingTable>> Nat::getNattingTableList() {
   std::vector<std::shared_ptr<NattingTable>> entries;
   try {
-    auto table = get_hash_table<st_k, st_v>("egress_session_table");
-    auto map_entries = table.get_all();
+    auto map_entries = getSessionEntries("egress_session_table");
     for (auto &pair : map_entries) {
       auto key = pair.first;
       auto value = pair.second;
@@ -247,6 +689,129 @@ void Nat::delNattingTableList() {
   egress_table.remove_all();
   auto ingress_table = get_hash_table<st_k, st_v>("ingress_session_table");
   ingress_table.remove_all();
+  // endpoint-independent mappings are flushed as well
+  auto eim_egress = get_hash_table<eim_k, eim_v>("eim_egress");
+  eim_egress.remove_all();
+  auto eim_ingress = get_hash_table<eim_k, eim_v>("eim_ingress");
+  eim_ingress.remove_all();
+  auto hairpin_table = get_hash_table<st_k, hp_v>(
+      "hairpin_session_table", 0, ProgramType::EGRESS);
+  hairpin_table.remove_all();
 
   logger()->info("Flushed natting tables");
+
+  releasePortBlocks();
+}
+
+// Reads all the entries of a hash table using batch operations, which need
+// a few syscalls instead of two for each entry. Returns false if they are not
+// supported (older kernels).
+template <typename K, typename V>
+static bool get_batch_entries(RawTable table,
+                              std::vector<std::pair<K, V>> &entries) {
+  std::vector<K> keys(NAT_SESSION_BATCH_SIZE);
+  std::vector<V> values(NAT_SESSION_BATCH_SIZE);
+  uint32_t in_batch = 0, out_batch = 0;
+  bool first = true;
+
+  while (true) {
+    unsigned int count = NAT_SESSION_BATCH_SIZE;
+    int ret = table.get_batch(keys.data(), values.data(), &count,
+                              first ? nullptr : &in_batch, &out_batch);
+    if (ret != 0 && errno != ENOENT) {
+      if (!first) {
+        throw std::runtime_error(std::string("Batch read failed: ") +
+                                 std::strerror(errno));
+      }
+      return false;
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+      entries.emplace_back(keys[i], values[i]);
+    }
+
+    // ENOENT: no more entries
+    if (ret != 0) {
+      return true;
+    }
+
+    in_batch = out_batch;
+    first = false;
+  }
+}
+
+std::vector<std::pair<st_k, st_v>> Nat::getSessionEntries(
+    const std::string &table_name) {
+  std::vector<std::pair<st_k, st_v>> entries;
+  if (get_batch_entries(get_raw_table(table_name, 0, ProgramType::INGRESS),
+                        entries)) {
+    return entries;
+  }
+  return get_hash_table<st_k, st_v>(table_name, 0, ProgramType::INGRESS)
+      .get_all();
+}
+
+std::vector<std::pair<eim_k, eim_v>> Nat::getMappingEntries(
+    const std::string &table_name) {
+  std::vector<std::pair<eim_k, eim_v>> entries;
+  if (get_batch_entries(get_raw_table(table_name, 0, ProgramType::INGRESS),
+                        entries)) {
+    return entries;
+  }
+  return get_hash_table<eim_k, eim_v>(table_name, 0, ProgramType::INGRESS)
+      .get_all();
+}
+
+std::vector<std::pair<st_k, hp_v>> Nat::getHairpinEntries() {
+  std::vector<std::pair<st_k, hp_v>> entries;
+  if (get_batch_entries(
+          get_raw_table("hairpin_session_table", 0, ProgramType::EGRESS),
+          entries)) {
+    return entries;
+  }
+  return get_hash_table<st_k, hp_v>("hairpin_session_table", 0,
+                                    ProgramType::EGRESS)
+      .get_all();
+}
+
+std::vector<std::pair<pb_k, pb_v>> Nat::getPortBlockEntries() {
+  std::vector<std::pair<pb_k, pb_v>> entries;
+  if (get_batch_entries(get_raw_table("port_blocks", 0, ProgramType::EGRESS),
+                        entries)) {
+    return entries;
+  }
+  return get_hash_table<pb_k, pb_v>("port_blocks", 0, ProgramType::EGRESS)
+      .get_all();
+}
+
+std::shared_ptr<SessionTable> Nat::getSessionTable() {
+  return session_table_;
+}
+
+void Nat::addSessionTable(const SessionTableJsonObject &value) {
+  session_table_ = std::make_shared<SessionTable>(*this, value);
+}
+
+void Nat::replaceSessionTable(const SessionTableJsonObject &conf) {
+  session_table_->update(conf);
+}
+
+void Nat::delSessionTable() {
+  throw std::runtime_error("[SessionTable]: Method delSessionTable not supported");
+}
+
+std::shared_ptr<Stats> Nat::getStats() {
+  StatsJsonObject sjo;
+  return std::shared_ptr<Stats>(new Stats(*this, sjo));
+}
+
+void Nat::addStats(const StatsJsonObject &value) {}
+
+void Nat::replaceStats(const StatsJsonObject &conf) {
+  throw std::runtime_error(
+      "[Stats]: Method replaceStats not supported. Read Only");
+}
+
+void Nat::delStats() {
+  throw std::runtime_error("[Stats]: Method delStats not supported. Read Only");
 }
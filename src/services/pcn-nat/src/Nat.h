@@ -22,10 +22,15 @@
 #include "polycube/services/transparent_cube.h"
 #include "polycube/services/utils.h"
 
+#include <atomic>
+#include <thread>
+
 #include <spdlog/spdlog.h>
 
 #include "NattingTable.h"
 #include "Rule.h"
+#include "SessionTable.h"
+#include "Stats.h"
 
 using namespace io::swagger::server::model;
 
@@ -51,15 +56,68 @@ struct sm_k {
 struct sm_v {
   uint32_t external_ip;
   uint8_t entry_type;
+  uint8_t endpoint_independent;
+  uint16_t port_block_size;
+} __attribute__((packed));
+
+struct eim_k {
+  uint32_t ip;
+  uint16_t port;
+  uint8_t proto;
+} __attribute__((packed));
+
+struct eim_v {
+  uint32_t ip;
+  uint16_t port;
+  uint32_t timestamp;
+} __attribute__((packed));
+
+struct hp_v {
+  uint32_t new_src_ip;
+  uint32_t new_dst_ip;
+  uint16_t new_src_port;
+  uint16_t new_dst_port;
+  uint32_t timestamp;
+} __attribute__((packed));
+
+struct port_range {
+  uint16_t first;
+  uint16_t last;
+} __attribute__((packed));
+
+struct pb_k {
+  uint32_t internal_ip;
+  uint32_t external_ip;
+} __attribute__((packed));
+
+struct pb_v {
+  uint16_t first;
+  uint16_t last;
+  uint32_t timestamp;
+} __attribute__((packed));
+
+struct pbo_k {
+  uint32_t external_ip;
+  uint16_t first;
+  uint16_t pad;
+} __attribute__((packed));
+
+struct pb_event {
+  uint32_t internal_ip;
+  uint32_t external_ip;
+  uint16_t first;
+  uint16_t last;
 } __attribute__((packed));
 
 class Nat : public polycube::service::TransparentCube, public NatInterface {
   friend class Rule;
+  friend class SessionTable;
+  friend class Stats;
 
  public:
   Nat(const std::string name, const NatJsonObject &conf);
   virtual ~Nat();
-  std::string generate_code();
+  std::string generate_code(uint32_t session_table_size);
 
   void update(const NatJsonObject &conf) override;
   NatJsonObject toJsonObject() override;
@@ -104,13 +162,70 @@ class Nat : public polycube::service::TransparentCube, public NatInterface {
                        const std::string &proto) override;
   void delNattingTableList() override;
 
+  /// <summary>
+  ///
+  /// </summary>
+  std::shared_ptr<SessionTable> getSessionTable() override;
+  void addSessionTable(const SessionTableJsonObject &value) override;
+  void replaceSessionTable(const SessionTableJsonObject &conf) override;
+  void delSessionTable() override;
+
+  /// <summary>
+  ///
+  /// </summary>
+  std::shared_ptr<Stats> getStats() override;
+  void addStats(const StatsJsonObject &value) override;
+  void replaceStats(const StatsJsonObject &conf) override;
+  void delStats() override;
+
   std::string getExternalIpString();
 
   std::string proto_from_int_to_string(const uint8_t proto);
   uint8_t proto_from_string_to_int(const std::string &proto);
 
+  // reads all the entries of a session table using batch operations
+  std::vector<std::pair<st_k, st_v>> getSessionEntries(
+      const std::string &table_name);
+  // reads all the endpoint-independent mappings of a table
+  std::vector<std::pair<eim_k, eim_v>> getMappingEntries(
+      const std::string &table_name);
+  // reads all the hairpin sessions (one entry for each direction)
+  std::vector<std::pair<st_k, hp_v>> getHairpinEntries();
+  // reads the port blocks allocated to the internal addresses
+  std::vector<std::pair<pb_k, pb_v>> getPortBlockEntries();
+  // releases all the port blocks, e.g. when their size changes
+  void releasePortBlocks();
+
  private:
+  void initPortRanges();
+
+  void quitAndJoin();
+  void sessionTimer();
+  void updateTimestamp();
+  void sweepSessions();
+  void sweepMappings();
+  void sweepHairpinSessions();
+  void sweepPortBlocks();
+  void releasePortBlock(const pb_k &key, const pb_v &value);
+  void logPortBlockAllocation(void *data, int size);
+
   std::shared_ptr<Rule> rule_;
+  std::shared_ptr<SessionTable> session_table_;
 
   std::string external_ip_;
+
+  // size of the session tables, fixed when the datapath is loaded
+  uint32_t session_table_size_;
+
+  // allocations of port blocks, read by the session timer thread
+  polycube::service::PerfBuffer port_block_events_;
+
+  std::thread session_timer_thread_;
+  std::atomic<bool> quit_thread_;
+
+  // updated by the sweeper, the other counters live in the datapath
+  std::atomic<uint64_t> sessions_expired_;
+  std::atomic<uint64_t> sessions_evicted_;
+  // time (seconds) written in the timestamp table by the last update
+  std::atomic<uint32_t> now_;
 };
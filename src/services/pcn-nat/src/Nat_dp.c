@@ -1,3 +1,182 @@
+static inline void nat_stats_inc(u32 counter) {
+  u64 *value = nat_stats.lookup(&counter);
+  if (value)
+    *value += 1;
+}
+
+static inline u32 get_timestamp() {
+  u32 i = 0;
+  u32 *ts = timestamp.lookup(&i);
+  if (ts)
+    return *ts;
+  return 0;
+}
+
+// ICMP errors carry the IP header and the first 8 bytes of the packet that
+// caused them
+static inline int is_icmp_error(u8 type) {
+  return type == ICMP_DEST_UNREACH || type == ICMP_TIME_EXCEEDED ||
+         type == ICMP_PARAMETERPROB;
+}
+
+// Applies a difference computed by pcn_csum_diff() to a checksum
+static inline __sum16 nat_csum_update(__sum16 check, __wsum diff) {
+  u32 sum = (u16)~check;
+  sum += diff;
+  if (sum < diff)
+    sum++;
+  sum = (sum & 0xffff) + (sum >> 16);
+  sum = (sum & 0xffff) + (sum >> 16);
+  return (__sum16)~sum;
+}
+
+/*
+ * Translates an ICMP error using the session of the packet embedded in it.
+ * Ingress: the outer destination and the embedded source (address and port)
+ * are translated back to the internal endpoint.
+ * Egress: the outer source and the embedded destination are translated to the
+ * external endpoint.
+ * The checksums of the embedded headers are updated as well, so that the
+ * error can be matched by the socket of the endpoint.
+ * Errors that do not belong to any session are forwarded unchanged.
+ */
+static inline int nat_icmp_error(struct CTXTYPE *ctx, struct iphdr *ip,
+                                 struct icmphdr *icmp) {
+  void *data_end = (void *)(long)ctx->data_end;
+
+  struct iphdr *inner = (void *)icmp + sizeof(*icmp);
+  if ( (void *)inner + sizeof(*inner) > data_end )
+    return RX_OK;
+  uint8_t inner_len = 4 * inner->ihl;
+  if (inner_len < sizeof(*inner))
+    return RX_OK;
+  __be16 *inner_ports = (void *)inner + inner_len;
+  if ( (void *)inner_ports + 8 > data_end )
+    return RX_OK;
+
+  uint8_t proto = inner->protocol;
+  uint16_t srcPort = 0;
+  uint16_t dstPort = 0;
+  uint8_t csum_offset = 0;
+  switch (proto) {
+  case IPPROTO_TCP:
+    srcPort = inner_ports[0];
+    dstPort = inner_ports[1];
+    csum_offset = offsetof(struct tcphdr, check);
+    break;
+  case IPPROTO_UDP:
+    srcPort = inner_ports[0];
+    dstPort = inner_ports[1];
+    csum_offset = offsetof(struct udphdr, check);
+    break;
+  case IPPROTO_ICMP:
+    // ICMP ID, used as both "ports"
+    srcPort = inner_ports[2];
+    dstPort = inner_ports[2];
+    csum_offset = offsetof(struct icmphdr, checksum);
+    break;
+  default:
+    return RX_OK;
+  }
+
+  // The embedded packet went in the opposite direction: its session is
+  // the one of the replies
+  struct st_k key = {0, 0, 0, 0, 0};
+  key.src_ip = inner->daddr;
+  key.dst_ip = inner->saddr;
+  key.src_port = dstPort;
+  key.dst_port = srcPort;
+  key.proto = proto;
+
+  uint32_t new_ip = 0;
+  uint32_t new_port = 0;
+#if NATTYPE == NATTYPE_EGRESS
+  struct st_v *value = egress_session_table.lookup(&key);
+#elif NATTYPE == NATTYPE_INGRESS
+  struct st_v *value = ingress_session_table.lookup(&key);
+#else
+#error "Invalid NATTYPE"
+#endif
+  if (value != NULL) {
+    new_ip = value->new_ip;
+    new_port = value->new_port;
+  } else {
+    // Check the endpoint-independent mappings
+#if NATTYPE == NATTYPE_EGRESS
+    struct eim_k mapping_key = {inner->daddr, dstPort, proto};
+    struct eim_v *mapping = eim_egress.lookup(&mapping_key);
+#else
+    struct eim_k mapping_key = {inner->saddr, srcPort, proto};
+    struct eim_v *mapping = eim_ingress.lookup(&mapping_key);
+#endif
+    if (mapping == NULL) {
+      pcn_log(ctx, LOG_TRACE, "ICMP error without session: %I -> %I",
+              ip->saddr, ip->daddr);
+      return RX_OK;
+    }
+    new_ip = mapping->ip;
+    new_port = mapping->port;
+  }
+
+#if NATTYPE == NATTYPE_EGRESS
+  uint32_t old_outer_ip = ip->saddr;
+  uint32_t old_ip = inner->daddr;
+  uint32_t old_port = dstPort;
+  ip->saddr = new_ip;
+  inner->daddr = new_ip;
+  if (proto == IPPROTO_ICMP)
+    inner_ports[2] = new_port;
+  else
+    inner_ports[1] = new_port;
+#else
+  uint32_t old_outer_ip = ip->daddr;
+  uint32_t old_ip = inner->saddr;
+  uint32_t old_port = srcPort;
+  ip->daddr = new_ip;
+  inner->saddr = new_ip;
+  if (proto == IPPROTO_ICMP)
+    inner_ports[2] = new_port;
+  else
+    inner_ports[0] = new_port;
+#endif
+
+  uint32_t l3sum = pcn_csum_diff(&old_ip, 4, &new_ip, 4, 0);
+  uint32_t l4sum = pcn_csum_diff(&old_port, 4, &new_port, 4, 0);
+
+  // Everything changed in the embedded headers is part of the ICMP payload
+  uint32_t icmp_sum = pcn_csum_diff(&old_port, 4, &new_port, 4, l3sum);
+
+  // Embedded IP checksum
+  uint32_t old_check = inner->check;
+  uint32_t new_check = nat_csum_update(inner->check, l3sum);
+  inner->check = new_check;
+  icmp_sum = pcn_csum_diff(&old_check, 4, &new_check, 4, icmp_sum);
+
+  // Embedded L4 checksum, if it is part of the error (and used, for UDP)
+  __sum16 *l4_check = (void *)inner_ports + csum_offset;
+  if ( (void *)l4_check + sizeof(*l4_check) <= data_end &&
+      !(proto == IPPROTO_UDP && *l4_check == 0) ) {
+    if (proto != IPPROTO_ICMP)
+      l4sum = pcn_csum_diff(&old_ip, 4, &new_ip, 4, l4sum);  // pseudo header
+    old_check = *l4_check;
+    new_check = nat_csum_update(*l4_check, l4sum);
+    if (proto == IPPROTO_UDP && new_check == 0)
+      new_check = 0xffff;
+    *l4_check = new_check;
+    icmp_sum = pcn_csum_diff(&old_check, 4, &new_check, 4, icmp_sum);
+  }
+
+  pcn_log(ctx, LOG_TRACE, "Natted ICMP error: embedded %I:%P -> %I:%P",
+          old_ip, old_port, new_ip, new_port);
+
+  // The ICMP checksum does not cover the outer addresses
+  uint32_t outer_sum = pcn_csum_diff(&old_outer_ip, 4, &new_ip, 4, 0);
+  pcn_l4_csum_replace(ctx, ICMP_CSUM_OFFSET, 0, icmp_sum, 0);
+  pcn_l3_csum_replace(ctx, IP_CSUM_OFFSET, 0, outer_sum, 0);
+
+  return RX_OK;
+}
+
 static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
   // NAT processing happens in 4 steps:
   // 1) packet parsing
@@ -48,6 +227,11 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
   // Status data
   uint8_t update_session_table = 1;
 
+#if NATTYPE == NATTYPE_EGRESS
+  // Hairpin data
+  struct hp_v hairpin = {0, 0, 0, 0, 0};
+#endif
+
   struct iphdr *ip = data + sizeof(*eth);
   if ( (void *)ip + sizeof(*ip) > data_end )
     goto DROP;
@@ -91,6 +275,11 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     pcn_log(ctx, LOG_TRACE, "Packet is ICMP: type %d, id %d", icmp->type,
             icmp->un.echo.id);
 
+    if (is_icmp_error(icmp->type)) {
+      // Errors are translated using the session of the packet they carry
+      return nat_icmp_error(ctx, ip, icmp);
+    }
+
     // Consider the ICMP ID as a "port" number for easier handling
     srcPort = icmp->un.echo.id;
     dstPort = icmp->un.echo.id;
@@ -117,6 +306,11 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     // Session table hit
     pcn_log(ctx, LOG_TRACE, "Egress session table: hit");
 
+    // Refresh the session, avoiding useless writes on the shared entry
+    u32 now = get_timestamp();
+    if (value->timestamp != now)
+      value->timestamp = now;
+
     newIp = value->new_ip;
     newPort = value->new_port;
     rule_type = NAT_SRC;
@@ -126,6 +320,104 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     goto apply_nat;
   }
   pcn_log(ctx, LOG_TRACE, "Egress session table: miss");
+
+  {
+    // Check the hairpin sessions
+    struct hp_v *hairpin_value = hairpin_session_table.lookup(&key);
+    if (hairpin_value != NULL) {
+      pcn_log(ctx, LOG_TRACE, "Hairpin session table: hit");
+
+      u32 now = get_timestamp();
+      if (hairpin_value->timestamp != now)
+        hairpin_value->timestamp = now;
+
+      hairpin = *hairpin_value;
+      goto apply_hairpin;
+    }
+  }
+
+  {
+    // Check if the destination is the external address of a DNAT/PORTFORWARDING
+    // rule: the packet has to come back to the inside
+    struct dp_k hairpin_key = {0, 0, 0};
+    hairpin_key.mask = 56;  // 32 (IP) + 16 (Port) + 8 (Proto)
+    hairpin_key.external_ip = dstIp;
+    hairpin_key.external_port = dstPort;
+    hairpin_key.proto = proto;
+    struct dp_v *rule = hairpin_rules.lookup(&hairpin_key);
+    if (rule != NULL) {
+      pcn_log(ctx, LOG_TRACE, "Hairpin rule table: hit");
+
+      // The destination is translated as the ingress program would do, the
+      // source to the external address, so that the replies of the server
+      // come back through the NAT as well
+      hairpin.new_dst_ip = rule->internal_ip;
+      hairpin.new_dst_port = rule->internal_port;
+      if (hairpin.new_dst_port == 0) {
+        // Matching rule is DNAT, keep the same port number
+        hairpin.new_dst_port = dstPort;
+      }
+      hairpin.new_src_ip = dstIp;
+
+      struct sm_v snat = {dstIp, NAT_SRC, 0, 0};
+      hairpin.new_src_port =
+          get_free_port(ctx, &snat, srcIp, srcPort, hairpin.new_dst_ip,
+                        hairpin.new_dst_port, proto);
+      if (hairpin.new_src_port == 0) {
+        pcn_log(ctx, LOG_DEBUG, "No free port for %I, dropping", dstIp);
+        goto DROP;
+      }
+      if (proto == IPPROTO_ICMP) {
+        // The ICMP ID is the only "port"
+        hairpin.new_dst_port = hairpin.new_src_port;
+      }
+      hairpin.timestamp = get_timestamp();
+
+      // Session table entry for the replies of the server
+      struct st_k reverse_key = {0, 0, 0, 0, 0};
+      reverse_key.src_ip = hairpin.new_dst_ip;
+      reverse_key.dst_ip = hairpin.new_src_ip;
+      reverse_key.src_port = hairpin.new_dst_port;
+      reverse_key.dst_port = hairpin.new_src_port;
+      reverse_key.proto = proto;
+
+      struct hp_v reverse_value = {0, 0, 0, 0, 0};
+      reverse_value.new_src_ip = dstIp;
+      reverse_value.new_dst_ip = srcIp;
+      reverse_value.new_src_port = dstPort;
+      reverse_value.new_dst_port = srcPort;
+      reverse_value.timestamp = hairpin.timestamp;
+
+      hairpin_session_table.update(&key, &hairpin);
+      hairpin_session_table.update(&reverse_key, &reverse_value);
+      nat_stats_inc(NAT_STATS_SESSIONS_CREATED);
+
+      pcn_log(ctx, LOG_DEBUG, "New hairpin connection: %I:%P -> %I:%P", srcIp,
+              srcPort, dstIp, dstPort);
+      goto apply_hairpin;
+    }
+  }
+
+  {
+    // Check the endpoint-independent mappings, used instead of the sessions
+    struct eim_k mapping_key = {srcIp, srcPort, proto};
+    struct eim_v *mapping = eim_egress.lookup(&mapping_key);
+    if (mapping != NULL) {
+      pcn_log(ctx, LOG_TRACE, "Egress mapping table: hit");
+
+      u32 now = get_timestamp();
+      if (mapping->timestamp != now)
+        mapping->timestamp = now;
+
+      newIp = mapping->ip;
+      newPort = mapping->port;
+      rule_type = NAT_SRC;
+
+      update_session_table = 0;
+
+      goto apply_nat;
+    }
+  }
 //  } else {
 #elif NATTYPE == NATTYPE_INGRESS
   // Packet is outside -> inside, check ingress session table
@@ -134,6 +426,11 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     // Session table hit
     pcn_log(ctx, LOG_TRACE, "Ingress session table: hit");
 
+    // Refresh the session, avoiding useless writes on the shared entry
+    u32 now = get_timestamp();
+    if (value->timestamp != now)
+      value->timestamp = now;
+
     newIp = value->new_ip;
     newPort = value->new_port;
     rule_type = NAT_DST;
@@ -143,6 +440,28 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     goto apply_nat;
   }
   pcn_log(ctx, LOG_TRACE, "Ingress session table: miss");
+
+  {
+    // Check the endpoint-independent mappings: incoming packets are accepted
+    // from any remote endpoint
+    struct eim_k mapping_key = {dstIp, dstPort, proto};
+    struct eim_v *mapping = eim_ingress.lookup(&mapping_key);
+    if (mapping != NULL) {
+      pcn_log(ctx, LOG_TRACE, "Ingress mapping table: hit");
+
+      u32 now = get_timestamp();
+      if (mapping->timestamp != now)
+        mapping->timestamp = now;
+
+      newIp = mapping->ip;
+      newPort = mapping->port;
+      rule_type = NAT_DST;
+
+      update_session_table = 0;
+
+      goto apply_nat;
+    }
+  }
 //  }
 #else
 #error "Invalid NATTYPE"
@@ -160,8 +479,31 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
       pcn_log(ctx, LOG_TRACE, "Egress rule table: hit");
 
       newIp = value->external_ip;
-      newPort = get_free_port();
+      newPort =
+          get_free_port(ctx, value, srcIp, srcPort, dstIp, dstPort, proto);
       rule_type = value->entry_type;
+      if (newPort == 0) {
+        pcn_log(ctx, LOG_DEBUG, "No free port for %I, dropping", newIp);
+        goto DROP;
+      }
+
+      if (value->endpoint_independent) {
+        // A single mapping is used for all the destinations, instead of a
+        // session for each of them
+        u32 now = get_timestamp();
+        struct eim_k mapping_key = {srcIp, srcPort, proto};
+        struct eim_v mapping = {newIp, newPort, now};
+        eim_egress.update(&mapping_key, &mapping);
+
+        struct eim_k reverse_mapping_key = {newIp, newPort, proto};
+        struct eim_v reverse_mapping = {srcIp, srcPort, now};
+        eim_ingress.update(&reverse_mapping_key, &reverse_mapping);
+
+        pcn_log(ctx, LOG_DEBUG, "New mapping: %I:%P -> %I:%P", srcIp, srcPort,
+                newIp, newPort);
+
+        update_session_table = 0;
+      }
 
       goto apply_nat;
     }
@@ -201,16 +543,90 @@ static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
   // -> Forward packet as it is
   goto proceed;
 
+#if NATTYPE == NATTYPE_EGRESS
+apply_hairpin:;
+  {
+    // Both the addresses and the ports are replaced
+    uint32_t old_value = srcIp;
+    uint32_t new_value = hairpin.new_src_ip;
+    uint32_t l3sum = pcn_csum_diff(&old_value, 4, &new_value, 4, 0);
+    old_value = dstIp;
+    new_value = hairpin.new_dst_ip;
+    l3sum = pcn_csum_diff(&old_value, 4, &new_value, 4, l3sum);
+
+    old_value = srcPort;
+    new_value = hairpin.new_src_port;
+    uint32_t l4sum = pcn_csum_diff(&old_value, 4, &new_value, 4, 0);
+    if (proto != IPPROTO_ICMP) {
+      old_value = dstPort;
+      new_value = hairpin.new_dst_port;
+      l4sum = pcn_csum_diff(&old_value, 4, &new_value, 4, l4sum);
+    }
+
+    // The packet is sent back to the parent as if it was coming from the
+    // next hop
+    __be64 mac = eth->dst;
+    eth->dst = eth->src;
+    eth->src = mac;
+
+    ip->saddr = hairpin.new_src_ip;
+    ip->daddr = hairpin.new_dst_ip;
+
+    uint8_t header_len = 4 * ip->ihl;
+    switch (proto) {
+    case IPPROTO_TCP: {
+      struct tcphdr *tcp = data + sizeof(*eth) + header_len;
+      if ( (void *)tcp + sizeof(*tcp) > data_end )
+        goto DROP;
+      tcp->source = hairpin.new_src_port;
+      tcp->dest = hairpin.new_dst_port;
+      pcn_l4_csum_replace(ctx, TCP_CSUM_OFFSET, 0, l3sum, IS_PSEUDO | 0);
+      pcn_l4_csum_replace(ctx, TCP_CSUM_OFFSET, 0, l4sum, 0);
+      break;
+    }
+    case IPPROTO_UDP: {
+      struct udphdr *udp = data + sizeof(*eth) + header_len;
+      if ( (void *)udp + sizeof(*udp) > data_end )
+        goto DROP;
+      udp->source = hairpin.new_src_port;
+      udp->dest = hairpin.new_dst_port;
+      pcn_l4_csum_replace(ctx, UDP_CSUM_OFFSET, 0, l3sum, IS_PSEUDO | 0);
+      pcn_l4_csum_replace(ctx, UDP_CSUM_OFFSET, 0, l4sum, 0);
+      break;
+    }
+    case IPPROTO_ICMP: {
+      struct icmphdr *icmp = data + sizeof(*eth) + header_len;
+      if ( (void *)icmp + sizeof(*icmp) > data_end )
+        goto DROP;
+      icmp->un.echo.id = hairpin.new_src_port;
+      pcn_l4_csum_replace(ctx, ICMP_CSUM_OFFSET, 0, l4sum, 0);
+      break;
+    }
+    }
+    pcn_l3_csum_replace(ctx, IP_CSUM_OFFSET, 0, l3sum, 0);
+
+    pcn_log(ctx, LOG_TRACE, "Natted hairpin packet: %I:%P -> %I:%P",
+            hairpin.new_src_ip, hairpin.new_src_port, hairpin.new_dst_ip,
+            hairpin.new_dst_port);
+
+    return pcn_pkt_hairpin(ctx, md);
+  }
+#endif
+
 apply_nat:;
   if (update_session_table == 1) {
     // No session table exist for the packet, but a rule matched
     // -> Update the session tables in both directions
 
     struct st_k forward_key = {0, 0, 0, 0, 0};
-    struct st_v forward_value = {0, 0};
+    struct st_v forward_value = {0, 0, 0, 0};
 
     struct st_k reverse_key = {0, 0, 0, 0, 0};
-    struct st_v reverse_value = {0, 0};
+    struct st_v reverse_value = {0, 0, 0, 0};
+
+    u32 now = get_timestamp();
+    forward_value.timestamp = now;
+    reverse_value.timestamp = now;
 
     if (rule_type == NAT_SRC || rule_type == NAT_MSQ) {
       // A rule matched in the inside -> outside direction
@@ -283,6 +699,7 @@ apply_nat:;
     }
     egress_session_table.update(&forward_key, &forward_value);
     ingress_session_table.update(&reverse_key, &reverse_value);
+    nat_stats_inc(NAT_STATS_SESSIONS_CREATED);
 
     pcn_log(ctx, LOG_TRACE,
             "Using ingress key: srcIp %I, dstIp %I, srcPort %P, dstPort %P",
@@ -28,7 +28,6 @@
 #include <uapi/linux/pkt_cls.h>
 #include <uapi/linux/tcp.h>
 #include <uapi/linux/udp.h>
-#define NAT_MAP_DIM 32768
 #define IP_CSUM_OFFSET (sizeof(struct eth_hdr) + offsetof(struct iphdr, check))
 #define UDP_CSUM_OFFSET                            \
   (sizeof(struct eth_hdr) + sizeof(struct iphdr) + \
@@ -65,4 +64,37 @@ struct st_v {
   uint32_t new_ip;
   uint16_t new_port;
   uint8_t originating_rule_type;
+  uint32_t timestamp;  // last time the session was used (seconds)
 } __attribute__((packed));
+
+// Endpoint-independent mappings
+// egress: internal ip/port -> external ip/port
+// ingress: external ip/port -> internal ip/port
+struct eim_k {
+  uint32_t ip;
+  uint16_t port;
+  uint8_t proto;
+} __attribute__((packed));
+struct eim_v {
+  uint32_t ip;
+  uint16_t port;
+  uint32_t timestamp;  // last time the mapping was used (seconds)
+} __attribute__((packed));
+
+// DNAT + PORTFORWARDING rules
+// (egress programs use them to detect hairpin traffic)
+struct dp_k {
+  u32 mask;
+  __be32 external_ip;
+  __be16 external_port;
+  uint8_t proto;
+};
+struct dp_v {
+  __be32 internal_ip;
+  __be16 internal_port;
+  uint8_t entry_type;
+};
+
+// defined in Nat_dp.c, after the maps they use
+static inline void nat_stats_inc(u32 counter);
+static inline u32 get_timestamp();
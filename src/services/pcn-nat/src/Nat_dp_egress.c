@@ -4,6 +4,10 @@ BPF_TABLE("extern", struct st_k, struct st_v, egress_session_table,
           NAT_MAP_DIM);
 BPF_TABLE("extern", struct st_k, struct st_v, ingress_session_table,
           NAT_MAP_DIM);
+BPF_TABLE("extern", struct eim_k, struct eim_v, eim_egress, NAT_MAP_DIM);
+BPF_TABLE("extern", struct eim_k, struct eim_v, eim_ingress, NAT_MAP_DIM);
+BPF_TABLE("extern", u32, u64, nat_stats, NAT_STATS_DIM);
+BPF_TABLE("extern", u32, u32, timestamp, 1);
 // only needed in egress
 // SNAT + MASQUERADE rules
 struct sm_k {
@@ -13,26 +17,212 @@ struct sm_k {
 struct sm_v {
   __be32 external_ip;
   uint8_t entry_type;
+  uint8_t endpoint_independent;
+  u16 port_block_size;  // 0: no port blocks
 };
 BPF_F_TABLE("lpm_trie", struct sm_k, struct sm_v, sm_rules, 1024,
             BPF_F_NO_PREALLOC);
 // Port numbers
-struct free_port_entry {
-  u16 first_free_port;
-  struct bpf_spin_lock lock;
+// The dynamic port space is split among the cpus by the control plane, so
+// that each cpu allocates from its own range without any locking
+struct port_range {
+  u16 first;
+  u16 last;
+} __attribute__((packed));
+BPF_TABLE("percpu_array", u32, struct port_range, port_range, 1);
+// Next port to try for each external IP, on each cpu
+BPF_TABLE("percpu_hash", __be32, u16, port_cursor, 1024);
+// Max number of ports tried before giving up
+#define NAT_PORT_MAX_ATTEMPTS 8
+// Port blocks
+// With port blocks each internal address gets its ports from a block of the
+// dynamic port space allocated to it, the first time it is translated with an
+// external address. Blocks are owned by a single internal address until the
+// control plane releases them, when the address has no more sessions.
+struct pb_k {
+  __be32 internal_ip;
+  __be32 external_ip;
+};
+struct pb_v {
+  u16 first;
+  u16 last;
+  uint32_t timestamp;  // last time a port was allocated from the block
 };
-BPF_TABLE("array", u32, struct free_port_entry, first_free_port, 1);
-static inline __be16 get_free_port() {
-  u32 i = 0;
+BPF_TABLE("hash", struct pb_k, struct pb_v, port_blocks, NAT_MAP_DIM);
+// Owners of the allocated blocks of each external address: the blocks
+// missing from this table are the free ones
+struct pbo_k {
+  __be32 external_ip;
+  u16 first;
+  u16 pad;
+};
+BPF_TABLE("hash", struct pbo_k, __be32, port_block_owners, NAT_MAP_DIM);
+// Allocations, logged by the control plane
+struct pb_event {
+  __be32 internal_ip;
+  __be32 external_ip;
+  u16 first;
+  u16 last;
+};
+BPF_PERF_OUTPUT(port_block_events);
+// Max number of blocks tried before giving up
+#define NAT_PORT_BLOCK_MAX_ATTEMPTS 16
+
+// Hairpin
+// Packets sent from the inside to the external address of a DNAT/port
+// forwarding rule are translated here in a single pass (destination to the
+// internal server, source to the external address), and sent back to the
+// parent as if they were received from the port the nat is attached to.
+BPF_F_TABLE("lpm_trie", struct dp_k, struct dp_v, hairpin_rules, 1024,
+            BPF_F_NO_PREALLOC);
+// Hairpin sessions, one entry for each direction
+struct hp_v {
+  __be32 new_src_ip;
+  __be32 new_dst_ip;
+  __be16 new_src_port;
+  __be16 new_dst_port;
+  uint32_t timestamp;  // last time the session was used (seconds)
+} __attribute__((packed));
+BPF_TABLE("lru_hash", struct st_k, struct hp_v, hairpin_session_table,
+          NAT_MAP_DIM);
+
+// Returns the block of internal_ip on the external address of the rule,
+// allocating a free one the first time; 0 if no free block was found
+static inline struct pb_v *get_port_block(struct CTXTYPE *ctx,
+                                          struct sm_v *rule,
+                                          __be32 internal_ip) {
+  struct pb_k key = {internal_ip, rule->external_ip};
+  u32 now = get_timestamp();
+
+  struct pb_v *block = port_blocks.lookup(&key);
+  if (block != NULL) {
+    // the control plane does not release blocks that have just been used
+    if (block->timestamp != now)
+      block->timestamp = now;
+    return block;
+  }
+
+  u32 block_size = rule->port_block_size;
+  u32 blocks =
+      (NAT_LAST_DYNAMIC_PORT - NAT_FIRST_DYNAMIC_PORT + 1) / block_size;
+  if (blocks == 0)
+    return NULL;
+
+  // addresses of a network smaller than the number of blocks get distinct
+  // blocks at the first attempt
+  u32 index = bpf_ntohl(internal_ip) % blocks;
+#pragma unroll
+  for (int attempt = 0; attempt < NAT_PORT_BLOCK_MAX_ATTEMPTS; attempt++) {
+    struct pbo_k owner_key = {rule->external_ip, 0, 0};
+    owner_key.first = NAT_FIRST_DYNAMIC_PORT + index * block_size;
+    index = index + 1 < blocks ? index + 1 : 0;
+
+    // claimed atomically, the other cpus find the block in use
+    if (port_block_owners.insert(&owner_key, &internal_ip) != 0)
+      continue;
+
+    struct pb_v new_block = {owner_key.first,
+                             owner_key.first + block_size - 1, now};
+    if (port_blocks.insert(&key, &new_block) != 0) {
+      // another cpu allocated a block to the same address in the meantime
+      port_block_owners.delete(&owner_key);
+      return port_blocks.lookup(&key);
+    }
+
+    struct pb_event event = {internal_ip, rule->external_ip, new_block.first,
+                             new_block.last};
+    port_block_events.perf_submit(ctx, &event, sizeof(event));
+    return port_blocks.lookup(&key);
+  }
+  return NULL;
+}
+
+// Returns 1 if the port is already used by another session (or mapping)
+// translated with external_ip
+static inline int port_in_use(__be32 external_ip, __be16 port,
+                              __be32 remote_ip, __be16 remote_port, u8 proto,
+                              u8 endpoint_independent) {
+  // endpoint-independent mappings own the port for any remote endpoint
+  struct eim_k mapping_key = {external_ip, port, proto};
+  if (eim_ingress.lookup(&mapping_key) != NULL)
+    return 1;
+  if (endpoint_independent)
+    return 0;
+
+  // Key of the session table entry the reply packets would hit
+  struct st_k reverse_key = {0, 0, 0, 0, 0};
+  reverse_key.src_ip = remote_ip;
+  reverse_key.dst_ip = external_ip;
+  // ICMP sessions use the ICMP ID as both ports
+  reverse_key.src_port = proto == IPPROTO_ICMP ? port : remote_port;
+  reverse_key.dst_port = port;
+  reverse_key.proto = proto;
+  if (ingress_session_table.lookup(&reverse_key) != NULL)
+    return 1;
+  // replies of hairpin sessions have the same key
+  return hairpin_session_table.lookup(&reverse_key) != NULL;
+}
+
+// Returns a port (in network byte order) that is not used by any other
+// session from external_ip to the same remote endpoint (to any endpoint for
+// endpoint-independent mappings), 0 if none was found
+static inline __be16 get_free_port(struct CTXTYPE *ctx, struct sm_v *rule,
+                                   __be32 internal_ip, __be16 internal_port,
+                                   __be32 remote_ip, __be16 remote_port,
+                                   u8 proto) {
+  __be32 external_ip = rule->external_ip;
+  u16 first, last, cursor;
+  u16 *next = NULL;
+
+  if (rule->port_block_size != 0) {
+    struct pb_v *block = get_port_block(ctx, rule, internal_ip);
+    if (block == NULL) {
+      nat_stats_inc(NAT_STATS_PORT_ALLOC_FAILURES);
+      return 0;
+    }
+    first = block->first;
+    last = block->last;
+    // spread the sessions of the same address over its block
+    cursor = first + bpf_ntohs(internal_port) % (last - first + 1);
+  } else {
+    u32 i = 0;
+    struct port_range *range = port_range.lookup(&i);
+    if (!range || range->first == 0 || range->last < range->first)
+      return 0;
+    first = range->first;
+    last = range->last;
+
+    cursor = first;
+    next = port_cursor.lookup(&external_ip);
+    if (next)
+      cursor = *next;
+  }
+
   u16 port = 0;
-  struct free_port_entry *entry = first_free_port.lookup(&i);
-  if (!entry)
+#pragma unroll
+  for (int attempt = 0; attempt < NAT_PORT_MAX_ATTEMPTS; attempt++) {
+    if (cursor < first || cursor > last)
+      cursor = first;
+    u16 candidate = cursor++;
+
+    if (!port_in_use(external_ip, bpf_htons(candidate), remote_ip, remote_port,
+                     proto, rule->endpoint_independent)) {
+      port = candidate;
+      break;
+    }
+    nat_stats_inc(NAT_STATS_PORT_COLLISIONS);
+  }
+
+  if (rule->port_block_size == 0) {
+    if (next)
+      *next = cursor;
+    else
+      port_cursor.update(&external_ip, &cursor);
+  }
+
+  if (port == 0) {
+    nat_stats_inc(NAT_STATS_PORT_ALLOC_FAILURES);
     return 0;
-  bpf_spin_lock(&entry->lock);
-  if (entry->first_free_port < 1024 || entry->first_free_port == 65535)
-    entry->first_free_port = 1024;
-  port = entry->first_free_port;
-  entry->first_free_port++;
-  bpf_spin_unlock(&entry->lock);
+  }
   return bpf_htons(port);
-}
\ No newline at end of file
+}
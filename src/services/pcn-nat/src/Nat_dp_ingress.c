@@ -4,18 +4,17 @@ BPF_TABLE_SHARED("lru_hash", struct st_k, struct st_v, egress_session_table,
                  NAT_MAP_DIM);
 BPF_TABLE_SHARED("lru_hash", struct st_k, struct st_v, ingress_session_table,
                  NAT_MAP_DIM);
+// endpoint-independent mappings also used by egress programs
+BPF_TABLE_SHARED("lru_hash", struct eim_k, struct eim_v, eim_egress,
+                 NAT_MAP_DIM);
+BPF_TABLE_SHARED("lru_hash", struct eim_k, struct eim_v, eim_ingress,
+                 NAT_MAP_DIM);
+// counters also used by egress programs
+BPF_TABLE_SHARED("percpu_array", u32, u64, nat_stats, NAT_STATS_DIM);
+// current time (seconds), updated by the control plane to avoid calling
+// bpf_ktime_get_ns() for every packet
+BPF_TABLE_SHARED("array", u32, u32, timestamp, 1);
 // only needed in ingress
 // DNAT + PORTFORWARDING rules
-struct dp_k {
-  u32 mask;
-  __be32 external_ip;
-  __be16 external_port;
-  uint8_t proto;
-};
-struct dp_v {
-  __be32 internal_ip;
-  __be16 internal_port;
-  uint8_t entry_type;
-};
 BPF_F_TABLE("lpm_trie", struct dp_k, struct dp_v, dp_rules, 1024,
             BPF_F_NO_PREALLOC);
\ No newline at end of file
@@ -45,6 +45,7 @@ struct st_v {
   uint32_t new_ip;
   uint16_t new_port;
   uint8_t originating_rule_type;
+  uint32_t timestamp;
 } __attribute__((packed));
 
 class NattingTable : public NattingTableInterface {
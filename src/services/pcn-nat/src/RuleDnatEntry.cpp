@@ -101,6 +101,11 @@ void RuleDnatEntry::injectToDatapath() {
   };
 
   dp_rules.set(key, value);
+
+  // used by the egress program to translate hairpin traffic
+  auto hairpin_rules = parent_.parent_.getParent().get_hash_table<dp_k, dp_v>(
+      "hairpin_rules", 0, ProgramType::EGRESS);
+  hairpin_rules.set(key, value);
 }
 
 void RuleDnatEntry::removeFromDatapath() {
@@ -112,4 +117,8 @@ void RuleDnatEntry::removeFromDatapath() {
   };
 
   dp_rules.remove(key);
+
+  auto hairpin_rules = parent_.parent_.getParent().get_hash_table<dp_k, dp_v>(
+      "hairpin_rules", 0, ProgramType::EGRESS);
+  hairpin_rules.remove(key);
 }
@@ -23,11 +23,16 @@ using namespace polycube::service;
 
 RuleMasquerade::RuleMasquerade(Rule &parent) : parent_(parent) {
   enabled = false;
+  endpointIndependent = false;
+  portBlockSize = 0;
 }
 
 RuleMasquerade::RuleMasquerade(Rule &parent,
                                const RuleMasqueradeJsonObject &conf)
     : parent_(parent) {
+  enabled = false;
+  endpointIndependent = false;
+  portBlockSize = 0;
   update(conf);
 }
 
@@ -37,6 +42,13 @@ void RuleMasquerade::update(const RuleMasqueradeJsonObject &conf) {
   // This method updates all the object/parameter in RuleMasquerade object
   // specified in the conf JsonObject.
   // You can modify this implementation.
+  // the mapping mode must be known before the rule is injected
+  if (conf.endpointIndependentIsSet()) {
+    setEndpointIndependent(conf.getEndpointIndependent());
+  }
+  if (conf.portBlockSizeIsSet()) {
+    setPortBlockSize(conf.getPortBlockSize());
+  }
   if (conf.enabledIsSet()) {
     setEnabled(conf.getEnabled());
   } else {
@@ -47,6 +59,8 @@ void RuleMasquerade::update(const RuleMasqueradeJsonObject &conf) {
 RuleMasqueradeJsonObject RuleMasquerade::toJsonObject() {
   RuleMasqueradeJsonObject conf;
   conf.setEnabled(getEnabled());
+  conf.setEndpointIndependent(getEndpointIndependent());
+  conf.setPortBlockSize(getPortBlockSize());
   return conf;
 }
 
@@ -62,6 +76,8 @@ bool RuleMasquerade::inject(uint32_t ip) {
     sm_v value{
         .external_ip = ip,
         .entry_type = (uint8_t)NattingTableOriginatingRuleEnum::MASQUERADE,
+        .endpoint_independent = endpointIndependent,
+        .port_block_size = portBlockSize,
     };
     sm_rules.set(key, value);
   } catch (std::exception &e) {
@@ -133,6 +149,40 @@ bool RuleMasquerade::getEnabled() {
   return enabled;
 }
 
+void RuleMasquerade::reinject() {
+  if (!enabled) {
+    return;
+  }
+
+  if (!inject(utils::ip_string_to_nbo_uint(
+          parent_.getParent().getExternalIpString()))) {
+    throw std::runtime_error("Unable to update the masquerade rule");
+  }
+}
+
+bool RuleMasquerade::getEndpointIndependent() {
+  return endpointIndependent;
+}
+
+void RuleMasquerade::setEndpointIndependent(const bool &value) {
+  endpointIndependent = value;
+  reinject();
+}
+
+uint16_t RuleMasquerade::getPortBlockSize() {
+  return portBlockSize;
+}
+
+void RuleMasquerade::setPortBlockSize(const uint16_t &value) {
+  if (value == portBlockSize) {
+    return;
+  }
+  portBlockSize = value;
+  // the blocks already allocated have the old size
+  parent_.getParent().releasePortBlocks();
+  reinject();
+}
+
 std::shared_ptr<spdlog::logger> RuleMasquerade::logger() {
   return parent_.logger();
 }
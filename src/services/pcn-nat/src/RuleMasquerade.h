@@ -41,8 +41,23 @@ class RuleMasquerade : public RuleMasqueradeInterface {
   bool getEnabled() override;
   void setEnabled(const bool &value) override;
 
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  bool getEndpointIndependent() override;
+  void setEndpointIndependent(const bool &value) override;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  uint16_t getPortBlockSize() override;
+  void setPortBlockSize(const uint16_t &value) override;
+
  private:
   bool inject(uint32_t ip); // injects the rule in datapath
+  void reinject(); // updates the rule in datapath if enabled
   Rule &parent_;
   bool enabled;
+  bool endpointIndependent;
+  uint16_t portBlockSize;
 };
@@ -192,6 +192,11 @@ void RulePortForwardingEntry::injectToDatapath() {
   }
 
   dp_rules.set(key, value);
+
+  // used by the egress program to translate hairpin traffic
+  auto hairpin_rules = parent_.parent_.getParent().get_hash_table<dp_k, dp_v>(
+      "hairpin_rules", 0, ProgramType::EGRESS);
+  hairpin_rules.set(key, value);
 }
 
 void RulePortForwardingEntry::removeFromDatapath() {
@@ -219,4 +224,8 @@ void RulePortForwardingEntry::removeFromDatapath() {
   }
 
   dp_rules.remove(key);
+
+  auto hairpin_rules = parent_.parent_.getParent().get_hash_table<dp_k, dp_v>(
+      "hairpin_rules", 0, ProgramType::EGRESS);
+  hairpin_rules.remove(key);
 }
@@ -34,6 +34,12 @@ void RuleSnat::update(const RuleSnatJsonObject &conf) {
   // This method updates all the object/parameter in RuleSnat object specified
   // in the conf JsonObject.
   // You can modify this implementation.
+  if (conf.endpointIndependentIsSet()) {
+    setEndpointIndependent(conf.getEndpointIndependent());
+  }
+  if (conf.portBlockSizeIsSet()) {
+    setPortBlockSize(conf.getPortBlockSize());
+  }
   if (conf.entryIsSet()) {
     for (auto &i : conf.getEntry()) {
       auto id = i.getId();
@@ -48,6 +54,8 @@ RuleSnatJsonObject RuleSnat::toJsonObject() {
   for (auto &i : getEntryList()) {
     conf.addRuleSnatEntry(i->toJsonObject());
   }
+  conf.setEndpointIndependent(getEndpointIndependent());
+  conf.setPortBlockSize(getPortBlockSize());
   return conf;
 }
 
@@ -65,6 +73,33 @@ RuleSnatAppendOutputJsonObject RuleSnat::append(
   return output;
 }
 
+bool RuleSnat::getEndpointIndependent() {
+  return endpointIndependent;
+}
+
+void RuleSnat::setEndpointIndependent(const bool &value) {
+  endpointIndependent = value;
+  for (auto &it : rules_) {
+    it->injectToDatapath();
+  }
+}
+
+uint16_t RuleSnat::getPortBlockSize() {
+  return portBlockSize;
+}
+
+void RuleSnat::setPortBlockSize(const uint16_t &value) {
+  if (value == portBlockSize) {
+    return;
+  }
+  portBlockSize = value;
+  // the blocks already allocated have the old size
+  parent_.getParent().releasePortBlocks();
+  for (auto &it : rules_) {
+    it->injectToDatapath();
+  }
+}
+
 std::shared_ptr<spdlog::logger> RuleSnat::logger() {
   return parent_.logger();
 }
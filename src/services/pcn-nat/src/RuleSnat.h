@@ -54,7 +54,22 @@ class RuleSnat : public RuleSnatInterface {
   RuleSnatAppendOutputJsonObject append(
       RuleSnatAppendInputJsonObject input) override;
 
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  bool getEndpointIndependent() override;
+  void setEndpointIndependent(const bool &value) override;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  uint16_t getPortBlockSize() override;
+  void setPortBlockSize(const uint16_t &value) override;
+
  private:
   Rule &parent_;
   std::vector<std::shared_ptr<RuleSnatEntry>> rules_;
+  // applied to all the entries
+  bool endpointIndependent = false;
+  uint16_t portBlockSize = 0;
 };
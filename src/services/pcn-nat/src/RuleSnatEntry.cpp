@@ -96,6 +96,8 @@ void RuleSnatEntry::injectToDatapath() {
   sm_v value{
       .external_ip = externalIp,
       .entry_type = (uint8_t)NattingTableOriginatingRuleEnum::SNAT,
+      .endpoint_independent = parent_.endpointIndependent,
+      .port_block_size = parent_.portBlockSize,
   };
 
   sm_rules.set(key, value);
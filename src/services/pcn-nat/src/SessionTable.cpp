@@ -0,0 +1,179 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "SessionTable.h"
+#include "Nat.h"
+#include "IpAddr.h"
+
+#include <fstream>
+
+using namespace polycube::service;
+
+SessionTable::SessionTable(Nat &parent, const SessionTableJsonObject &conf)
+    : parent_(parent) {
+  if (conf.sizeIsSet()) {
+    setSize(conf.getSize());
+  }
+  setTcpTimeout(conf.getTcpTimeout());
+  setUdpTimeout(conf.getUdpTimeout());
+  setIcmpTimeout(conf.getIcmpTimeout());
+}
+
+SessionTable::~SessionTable() {}
+
+void SessionTable::update(const SessionTableJsonObject &conf) {
+  // This method updates all the object/parameter in SessionTable object
+  // specified in the conf JsonObject.
+  // You can modify this implementation.
+  if (conf.sizeIsSet()) {
+    setSize(conf.getSize());
+  }
+  if (conf.tcpTimeoutIsSet()) {
+    setTcpTimeout(conf.getTcpTimeout());
+  }
+  if (conf.udpTimeoutIsSet()) {
+    setUdpTimeout(conf.getUdpTimeout());
+  }
+  if (conf.icmpTimeoutIsSet()) {
+    setIcmpTimeout(conf.getIcmpTimeout());
+  }
+}
+
+SessionTableJsonObject SessionTable::toJsonObject() {
+  SessionTableJsonObject conf;
+
+  conf.setSize(getSize());
+  conf.setTcpTimeout(getTcpTimeout());
+  conf.setUdpTimeout(getUdpTimeout());
+  conf.setIcmpTimeout(getIcmpTimeout());
+
+  return conf;
+}
+
+uint32_t SessionTable::getSize() {
+  return parent_.session_table_size_;
+}
+
+void SessionTable::setSize(const uint32_t &value) {
+  // the size of the datapath maps is fixed when the code is loaded
+  if (value != parent_.session_table_size_) {
+    throw std::runtime_error(
+        "The session table size can be set only at creation");
+  }
+}
+
+uint32_t SessionTable::getTcpTimeout() {
+  return tcp_timeout_;
+}
+
+void SessionTable::setTcpTimeout(const uint32_t &value) {
+  tcp_timeout_ = value;
+}
+
+uint32_t SessionTable::getUdpTimeout() {
+  return udp_timeout_;
+}
+
+void SessionTable::setUdpTimeout(const uint32_t &value) {
+  udp_timeout_ = value;
+}
+
+uint32_t SessionTable::getIcmpTimeout() {
+  return icmp_timeout_;
+}
+
+void SessionTable::setIcmpTimeout(const uint32_t &value) {
+  icmp_timeout_ = value;
+}
+
+uint32_t SessionTable::getTimeout(uint8_t proto) {
+  switch (proto) {
+  case IPPROTO_TCP:
+    return tcp_timeout_;
+  case IPPROTO_UDP:
+    return udp_timeout_;
+  default:
+    return icmp_timeout_;
+  }
+}
+
+SessionTableDumpOutputJsonObject SessionTable::dump(
+    SessionTableDumpInputJsonObject input) {
+  uint32_t src_net = 0, src_mask = 0;
+  if (input.internalSrcIsSet()) {
+    struct IpAddr addr;
+    addr.fromString(input.getInternalSrc());
+    src_net = addr.ip;
+    src_mask = addr.netmask == 0 ? 0 : ntohl(0xffffffff << (32 - addr.netmask));
+  }
+
+  uint32_t external_ip = 0;
+  if (input.externalIpIsSet()) {
+    external_ip = utils::ip_string_to_nbo_uint(input.getExternalIp());
+  }
+
+  int proto = -1;
+  if (input.protoIsSet()) {
+    proto = parent_.proto_from_string_to_int(input.getProto());
+    if (proto == 0xff) {
+      throw std::runtime_error("Invalid protocol " + input.getProto());
+    }
+  }
+
+  std::ofstream file(input.getFile());
+  if (!file) {
+    throw std::runtime_error("Unable to open file " + input.getFile());
+  }
+
+  nlohmann::json sessions = nlohmann::json::array();
+  for (auto &entry : parent_.getSessionEntries("egress_session_table")) {
+    auto &key = entry.first;
+    auto &value = entry.second;
+
+    if ((key.src_ip & src_mask) != src_net) {
+      continue;
+    }
+    if (external_ip != 0 && value.new_ip != external_ip) {
+      continue;
+    }
+    if (proto != -1 && key.proto != proto) {
+      continue;
+    }
+
+    NattingTable session(
+        parent_, utils::nbo_uint_to_ip_string(key.src_ip),
+        utils::nbo_uint_to_ip_string(key.dst_ip), ntohs(key.src_port),
+        ntohs(key.dst_port), key.proto,
+        utils::nbo_uint_to_ip_string(value.new_ip), ntohs(value.new_port),
+        value.originating_rule_type);
+    sessions.push_back(session.toJsonObject().toJson());
+  }
+
+  file << sessions.dump(2) << std::endl;
+
+  logger()->info("Dumped {0} sessions to {1}", sessions.size(),
+                 input.getFile());
+
+  SessionTableDumpOutputJsonObject output;
+  output.setEntries(sessions.size());
+  return output;
+}
+
+std::shared_ptr<spdlog::logger> SessionTable::logger() {
+  return parent_.logger();
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/SessionTableInterface.h"
+
+#include <atomic>
+
+#include <spdlog/spdlog.h>
+
+class Nat;
+
+using namespace io::swagger::server::model;
+
+class SessionTable : public SessionTableInterface {
+ public:
+  SessionTable(Nat &parent, const SessionTableJsonObject &conf);
+  virtual ~SessionTable();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const SessionTableJsonObject &conf) override;
+  SessionTableJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Maximum number of sessions in each direction (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() override;
+  void setSize(const uint32_t &value) override;
+
+  /// <summary>
+  /// Idle timeout of TCP sessions (in seconds)
+  /// </summary>
+  uint32_t getTcpTimeout() override;
+  void setTcpTimeout(const uint32_t &value) override;
+
+  /// <summary>
+  /// Idle timeout of UDP sessions (in seconds)
+  /// </summary>
+  uint32_t getUdpTimeout() override;
+  void setUdpTimeout(const uint32_t &value) override;
+
+  /// <summary>
+  /// Idle timeout of ICMP sessions (in seconds)
+  /// </summary>
+  uint32_t getIcmpTimeout() override;
+  void setIcmpTimeout(const uint32_t &value) override;
+
+  SessionTableDumpOutputJsonObject dump(
+      SessionTableDumpInputJsonObject input) override;
+
+  // returns the idle timeout of the sessions of a given L4 protocol
+  uint32_t getTimeout(uint8_t proto);
+
+ private:
+  Nat &parent_;
+  // read by the session sweeper thread
+  std::atomic<uint32_t> tcp_timeout_;
+  std::atomic<uint32_t> udp_timeout_;
+  std::atomic<uint32_t> icmp_timeout_;
+};
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Modify these methods with your own implementation
+
+#include "Stats.h"
+#include "Nat.h"
+
+#include <numeric>
+
+using namespace polycube::service;
+
+Stats::Stats(Nat &parent, const StatsJsonObject &conf) : parent_(parent) {}
+
+Stats::~Stats() {}
+
+void Stats::update(const StatsJsonObject &conf) {
+  // This method updates all the object/parameter in Stats object specified in
+  // the conf JsonObject.
+  // You can modify this implementation.
+}
+
+StatsJsonObject Stats::toJsonObject() {
+  StatsJsonObject conf;
+
+  conf.setPortAllocFailures(getPortAllocFailures());
+
+  conf.setPortCollisions(getPortCollisions());
+
+  conf.setSessionsActive(getSessionsActive());
+
+  conf.setSessionsCreated(getSessionsCreated());
+
+  conf.setSessionsExpired(getSessionsExpired());
+
+  conf.setSessionsEvicted(getSessionsEvicted());
+
+  conf.setMappingsActive(getMappingsActive());
+
+  conf.setPortBlocksActive(getPortBlocksActive());
+
+  return conf;
+}
+
+uint64_t Stats::getPortAllocFailures() {
+  return getCounter(StatsCounter::PORT_ALLOC_FAILURES);
+}
+
+uint64_t Stats::getPortCollisions() {
+  return getCounter(StatsCounter::PORT_COLLISIONS);
+}
+
+uint64_t Stats::getSessionsActive() {
+  try {
+    // hairpin sessions have an entry for each direction
+    return parent_.getSessionEntries("egress_session_table").size() +
+           parent_.getHairpinEntries().size() / 2;
+  } catch (std::exception &e) {
+    logger()->error("Unable to read the session table: {0}", e.what());
+    throw std::runtime_error("Unable to read the nat statistics");
+  }
+}
+
+uint64_t Stats::getSessionsCreated() {
+  return getCounter(StatsCounter::SESSIONS_CREATED);
+}
+
+uint64_t Stats::getSessionsExpired() {
+  return parent_.sessions_expired_;
+}
+
+uint64_t Stats::getSessionsEvicted() {
+  return parent_.sessions_evicted_;
+}
+
+uint64_t Stats::getMappingsActive() {
+  try {
+    return parent_.getMappingEntries("eim_egress").size();
+  } catch (std::exception &e) {
+    logger()->error("Unable to read the mapping table: {0}", e.what());
+    throw std::runtime_error("Unable to read the nat statistics");
+  }
+}
+
+uint64_t Stats::getPortBlocksActive() {
+  try {
+    return parent_.getPortBlockEntries().size();
+  } catch (std::exception &e) {
+    logger()->error("Unable to read the port blocks: {0}", e.what());
+    throw std::runtime_error("Unable to read the nat statistics");
+  }
+}
+
+uint64_t Stats::getCounter(StatsCounter counter) {
+  uint64_t value = 0;
+
+  try {
+    // the counters map is shared between the ingress and egress programs
+    auto nat_stats = parent_.get_percpuarray_table<uint64_t>(
+        "nat_stats", 0, ProgramType::INGRESS);
+    auto values = nat_stats.get(static_cast<uint32_t>(counter));
+    value = std::accumulate(values.begin(), values.end(), value);
+  } catch (std::exception &e) {
+    logger()->error("Unable to read counter {0}: {1}",
+                    static_cast<uint32_t>(counter), e.what());
+    throw std::runtime_error("Unable to read the nat statistics");
+  }
+
+  return value;
+}
+
+std::shared_ptr<spdlog::logger> Stats::logger() {
+  return parent_.logger();
+}
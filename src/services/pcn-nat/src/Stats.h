@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "../interface/StatsInterface.h"
+
+#include <spdlog/spdlog.h>
+
+class Nat;
+
+using namespace io::swagger::server::model;
+
+/* indexes of the counters in the nat_stats datapath map,
+ * exported to the datapath as NAT_STATS_* defines by Nat::generate_code() */
+enum class StatsCounter : uint32_t {
+  PORT_ALLOC_FAILURES = 0,
+  PORT_COLLISIONS,
+  SESSIONS_CREATED,
+  DIM
+};
+
+class Stats : public StatsInterface {
+ public:
+  Stats(Nat &parent, const StatsJsonObject &conf);
+  virtual ~Stats();
+
+  std::shared_ptr<spdlog::logger> logger();
+  void update(const StatsJsonObject &conf) override;
+  StatsJsonObject toJsonObject() override;
+
+  /// <summary>
+  /// Number of connections dropped because no free port was found
+  /// </summary>
+  uint64_t getPortAllocFailures() override;
+
+  /// <summary>
+  /// Number of candidate ports discarded because already in use by another session
+  /// </summary>
+  uint64_t getPortCollisions() override;
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  uint64_t getSessionsActive() override;
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  uint64_t getSessionsCreated() override;
+
+  /// <summary>
+  /// Number of sessions removed because idle for longer than their timeout
+  /// </summary>
+  uint64_t getSessionsExpired() override;
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  uint64_t getSessionsEvicted() override;
+
+  /// <summary>
+  /// Number of endpoint-independent mappings currently in the mapping table
+  /// </summary>
+  uint64_t getMappingsActive() override;
+
+  /// <summary>
+  /// Number of port blocks currently allocated to internal addresses
+  /// </summary>
+  uint64_t getPortBlocksActive() override;
+
+ private:
+  uint64_t getCounter(StatsCounter counter);
+
+  Nat &parent_;
+};
@@ -43,6 +43,10 @@
 #include "RuleSnatAppendInputJsonObject.h"
 #include "RuleSnatAppendOutputJsonObject.h"
 #include "RuleSnatEntryJsonObject.h"
+#include "StatsJsonObject.h"
+#include "SessionTableDumpInputJsonObject.h"
+#include "SessionTableDumpOutputJsonObject.h"
+#include "SessionTableJsonObject.h"
 #include <vector>
 
 
@@ -69,6 +73,8 @@ Response create_nat_rule_snat_append_by_id_handler(const char *name, const Key *
 Response create_nat_rule_snat_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_nat_rule_snat_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response create_nat_rule_snat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_nat_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response create_nat_session_table_dump_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_nat_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_nat_natting_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_nat_natting_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -83,6 +89,7 @@ Response delete_nat_rule_port_forwarding_entry_list_by_id_handler(const char *na
 Response delete_nat_rule_snat_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_nat_rule_snat_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_nat_rule_snat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response delete_nat_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_natting_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -98,6 +105,8 @@ Response read_nat_rule_dnat_entry_internal_ip_by_id_handler(const char *name, co
 Response read_nat_rule_dnat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_masquerade_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_masquerade_enabled_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_rule_masquerade_endpoint_independent_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_rule_masquerade_port_block_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_port_forwarding_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_port_forwarding_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_port_forwarding_entry_external_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -107,10 +116,26 @@ Response read_nat_rule_port_forwarding_entry_internal_port_by_id_handler(const c
 Response read_nat_rule_port_forwarding_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_port_forwarding_entry_proto_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_snat_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_rule_snat_endpoint_independent_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_snat_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_snat_entry_external_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_snat_entry_internal_net_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_nat_rule_snat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_rule_snat_port_block_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_session_table_icmp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_session_table_tcp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_session_table_udp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_mappings_active_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_port_alloc_failures_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_port_blocks_active_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_port_collisions_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_sessions_active_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_sessions_created_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_sessions_evicted_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_nat_stats_sessions_expired_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_nat_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_nat_natting_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_nat_natting_table_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -125,6 +150,7 @@ Response replace_nat_rule_port_forwarding_entry_list_by_id_handler(const char *n
 Response replace_nat_rule_snat_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_nat_rule_snat_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_nat_rule_snat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response replace_nat_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_natting_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -140,6 +166,8 @@ Response update_nat_rule_dnat_entry_internal_ip_by_id_handler(const char *name,
 Response update_nat_rule_dnat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_masquerade_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_masquerade_enabled_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_rule_masquerade_endpoint_independent_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_rule_masquerade_port_block_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_port_forwarding_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_port_forwarding_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_port_forwarding_entry_external_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -149,10 +177,17 @@ Response update_nat_rule_port_forwarding_entry_internal_port_by_id_handler(const
 Response update_nat_rule_port_forwarding_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_port_forwarding_entry_proto_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_snat_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_rule_snat_endpoint_independent_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_snat_entry_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_snat_entry_external_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_snat_entry_internal_net_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_nat_rule_snat_entry_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_rule_snat_port_block_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_session_table_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_session_table_icmp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_session_table_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_session_table_tcp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_nat_session_table_udp_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response nat_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 Response nat_natting_table_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
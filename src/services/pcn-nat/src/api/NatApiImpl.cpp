@@ -442,6 +442,43 @@ create_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vector
   snat->addEntryList(value);
 }
 
+/**
+* @brief   Create session-table by ID
+*
+* Create operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+create_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto nat = get_cube(name);
+
+  nat->addSessionTable(value);
+}
+
+/**
+* @brief   Create dump by ID
+*
+* Create operation of resource: dump*
+*
+* @param[in] name ID of name
+* @param[in] value dumpbody object
+*
+* Responses:
+* SessionTableDumpOutputJsonObject
+*/
+SessionTableDumpOutputJsonObject
+create_nat_session_table_dump_by_id(const std::string &name, const SessionTableDumpInputJsonObject &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+return session_table->dump(value);
+
+}
+
 /**
 * @brief   Delete natting-table by ID
 *
@@ -683,6 +720,23 @@ delete_nat_rule_snat_entry_list_by_id(const std::string &name) {
   snat->delEntryList();
 }
 
+/**
+* @brief   Delete session-table by ID
+*
+* Delete operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+*
+*/
+void
+delete_nat_session_table_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+
+  nat->delSessionTable();
+}
+
 /**
 * @brief   Read nat by ID
 *
@@ -966,6 +1020,42 @@ read_nat_rule_masquerade_enabled_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read endpoint-independent by ID
+*
+* Read operation of resource: endpoint-independent*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* bool
+*/
+bool
+read_nat_rule_masquerade_endpoint_independent_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto masquerade = rule->getMasquerade();  return masquerade->getEndpointIndependent();
+
+}
+
+/**
+* @brief   Read port-block-size by ID
+*
+* Read operation of resource: port-block-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint16_t
+*/
+uint16_t
+read_nat_rule_masquerade_port_block_size_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto masquerade = rule->getMasquerade();  return masquerade->getPortBlockSize();
+
+}
+
 /**
 * @brief   Read port-forwarding by ID
 *
@@ -1149,6 +1239,24 @@ read_nat_rule_snat_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read endpoint-independent by ID
+*
+* Read operation of resource: endpoint-independent*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* bool
+*/
+bool
+read_nat_rule_snat_endpoint_independent_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto snat = rule->getSnat();  return snat->getEndpointIndependent();
+
+}
+
 /**
 * @brief   Read entry by ID
 *
@@ -1233,6 +1341,272 @@ read_nat_rule_snat_entry_list_by_id(const std::string &name) {
   return m;
 }
 
+/**
+* @brief   Read port-block-size by ID
+*
+* Read operation of resource: port-block-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint16_t
+*/
+uint16_t
+read_nat_rule_snat_port_block_size_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto snat = rule->getSnat();  return snat->getPortBlockSize();
+
+}
+
+/**
+* @brief   Read session-table by ID
+*
+* Read operation of resource: session-table*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* SessionTableJsonObject
+*/
+SessionTableJsonObject
+read_nat_session_table_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  return nat->getSessionTable()->toJsonObject();
+
+}
+
+/**
+* @brief   Read icmp-timeout by ID
+*
+* Read operation of resource: icmp-timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_nat_session_table_icmp_timeout_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+  return session_table->getIcmpTimeout();
+
+}
+
+/**
+* @brief   Read size by ID
+*
+* Read operation of resource: size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_nat_session_table_size_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+  return session_table->getSize();
+
+}
+
+/**
+* @brief   Read tcp-timeout by ID
+*
+* Read operation of resource: tcp-timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_nat_session_table_tcp_timeout_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+  return session_table->getTcpTimeout();
+
+}
+
+/**
+* @brief   Read udp-timeout by ID
+*
+* Read operation of resource: udp-timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_nat_session_table_udp_timeout_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+  return session_table->getUdpTimeout();
+
+}
+
+/**
+* @brief   Read stats by ID
+*
+* Read operation of resource: stats*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* StatsJsonObject
+*/
+StatsJsonObject
+read_nat_stats_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  return nat->getStats()->toJsonObject();
+
+}
+
+/**
+* @brief   Read mappings-active by ID
+*
+* Read operation of resource: mappings-active*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_mappings_active_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();  return stats->getMappingsActive();
+
+}
+
+/**
+* @brief   Read port-alloc-failures by ID
+*
+* Read operation of resource: port-alloc-failures*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_port_alloc_failures_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getPortAllocFailures();
+
+}
+
+/**
+* @brief   Read port-blocks-active by ID
+*
+* Read operation of resource: port-blocks-active*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_port_blocks_active_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();  return stats->getPortBlocksActive();
+
+}
+
+/**
+* @brief   Read port-collisions by ID
+*
+* Read operation of resource: port-collisions*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_port_collisions_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getPortCollisions();
+
+}
+
+/**
+* @brief   Read sessions-active by ID
+*
+* Read operation of resource: sessions-active*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_sessions_active_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getSessionsActive();
+
+}
+
+/**
+* @brief   Read sessions-created by ID
+*
+* Read operation of resource: sessions-created*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_sessions_created_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getSessionsCreated();
+
+}
+
+/**
+* @brief   Read sessions-evicted by ID
+*
+* Read operation of resource: sessions-evicted*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_sessions_evicted_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getSessionsEvicted();
+
+}
+
+/**
+* @brief   Read sessions-expired by ID
+*
+* Read operation of resource: sessions-expired*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_nat_stats_sessions_expired_by_id(const std::string &name) {
+  auto nat = get_cube(name);
+  auto stats = nat->getStats();
+  return stats->getSessionsExpired();
+
+}
+
 /**
 * @brief   Replace natting-table by ID
 *
@@ -1477,6 +1851,24 @@ replace_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vecto
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Replace session-table by ID
+*
+* Replace operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+replace_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto nat = get_cube(name);
+
+  nat->replaceSessionTable(value);
+}
+
 /**
 * @brief   Update nat by ID
 *
@@ -1783,6 +2175,44 @@ update_nat_rule_masquerade_enabled_by_id(const std::string &name, const bool &va
   masquerade->setEnabled(value);
 }
 
+/**
+* @brief   Update endpoint-independent by ID
+*
+* Update operation of resource: endpoint-independent*
+*
+* @param[in] name ID of name
+* @param[in] value Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+*
+* Responses:
+*
+*/
+void
+update_nat_rule_masquerade_endpoint_independent_by_id(const std::string &name, const bool &value) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto masquerade = rule->getMasquerade();
+  masquerade->setEndpointIndependent(value);
+}
+
+/**
+* @brief   Update port-block-size by ID
+*
+* Update operation of resource: port-block-size*
+*
+* @param[in] name ID of name
+* @param[in] value Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+*
+* Responses:
+*
+*/
+void
+update_nat_rule_masquerade_port_block_size_by_id(const std::string &name, const uint16_t &value) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto masquerade = rule->getMasquerade();
+  masquerade->setPortBlockSize(value);
+}
+
 /**
 * @brief   Update port-forwarding by ID
 *
@@ -1971,6 +2401,25 @@ update_nat_rule_snat_by_id(const std::string &name, const RuleSnatJsonObject &va
   snat->update(value);
 }
 
+/**
+* @brief   Update endpoint-independent by ID
+*
+* Update operation of resource: endpoint-independent*
+*
+* @param[in] name ID of name
+* @param[in] value Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+*
+* Responses:
+*
+*/
+void
+update_nat_rule_snat_endpoint_independent_by_id(const std::string &name, const bool &value) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto snat = rule->getSnat();
+  snat->setEndpointIndependent(value);
+}
+
 /**
 * @brief   Update entry by ID
 *
@@ -2053,6 +2502,120 @@ update_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vector
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Update port-block-size by ID
+*
+* Update operation of resource: port-block-size*
+*
+* @param[in] name ID of name
+* @param[in] value Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+*
+* Responses:
+*
+*/
+void
+update_nat_rule_snat_port_block_size_by_id(const std::string &name, const uint16_t &value) {
+  auto nat = get_cube(name);
+  auto rule = nat->getRule();
+  auto snat = rule->getSnat();
+  snat->setPortBlockSize(value);
+}
+
+/**
+* @brief   Update session-table by ID
+*
+* Update operation of resource: session-table*
+*
+* @param[in] name ID of name
+* @param[in] value sessiontablebody object
+*
+* Responses:
+*
+*/
+void
+update_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+
+  session_table->update(value);
+}
+
+/**
+* @brief   Update icmp-timeout by ID
+*
+* Update operation of resource: icmp-timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Idle timeout of ICMP sessions (in seconds)
+*
+* Responses:
+*
+*/
+void
+update_nat_session_table_icmp_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+
+  session_table->setIcmpTimeout(value);
+}
+
+/**
+* @brief   Update size by ID
+*
+* Update operation of resource: size*
+*
+* @param[in] name ID of name
+* @param[in] value Maximum number of sessions in each direction (can be set only at creation)
+*
+* Responses:
+*
+*/
+void
+update_nat_session_table_size_by_id(const std::string &name, const uint32_t &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+
+  session_table->setSize(value);
+}
+
+/**
+* @brief   Update tcp-timeout by ID
+*
+* Update operation of resource: tcp-timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Idle timeout of TCP sessions (in seconds)
+*
+* Responses:
+*
+*/
+void
+update_nat_session_table_tcp_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+
+  session_table->setTcpTimeout(value);
+}
+
+/**
+* @brief   Update udp-timeout by ID
+*
+* Update operation of resource: udp-timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Idle timeout of UDP sessions (in seconds)
+*
+* Responses:
+*
+*/
+void
+update_nat_session_table_udp_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto nat = get_cube(name);
+  auto session_table = nat->getSessionTable();
+
+  session_table->setUdpTimeout(value);
+}
+
 
 
 /*
@@ -44,6 +44,10 @@
 #include "RuleSnatAppendInputJsonObject.h"
 #include "RuleSnatAppendOutputJsonObject.h"
 #include "RuleSnatEntryJsonObject.h"
+#include "StatsJsonObject.h"
+#include "SessionTableDumpInputJsonObject.h"
+#include "SessionTableDumpOutputJsonObject.h"
+#include "SessionTableJsonObject.h"
 #include <vector>
 
 namespace io {
@@ -73,6 +77,8 @@ namespace NatApiImpl {
   void create_nat_rule_snat_by_id(const std::string &name, const RuleSnatJsonObject &value);
   void create_nat_rule_snat_entry_by_id(const std::string &name, const uint32_t &id, const RuleSnatEntryJsonObject &value);
   void create_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vector<RuleSnatEntryJsonObject> &value);
+  void create_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
+  SessionTableDumpOutputJsonObject create_nat_session_table_dump_by_id(const std::string &name, const SessionTableDumpInputJsonObject &value);
   void delete_nat_by_id(const std::string &name);
   void delete_nat_natting_table_by_id(const std::string &name, const std::string &internalSrc, const std::string &internalDst, const uint16_t &internalSport, const uint16_t &internalDport, const std::string &proto);
   void delete_nat_natting_table_list_by_id(const std::string &name);
@@ -87,6 +93,7 @@ namespace NatApiImpl {
   void delete_nat_rule_snat_by_id(const std::string &name);
   void delete_nat_rule_snat_entry_by_id(const std::string &name, const uint32_t &id);
   void delete_nat_rule_snat_entry_list_by_id(const std::string &name);
+  void delete_nat_session_table_by_id(const std::string &name);
   NatJsonObject read_nat_by_id(const std::string &name);
   std::vector<NatJsonObject> read_nat_list_by_id();
   NattingTableJsonObject read_nat_natting_table_by_id(const std::string &name, const std::string &internalSrc, const std::string &internalDst, const uint16_t &internalSport, const uint16_t &internalDport, const std::string &proto);
@@ -102,6 +109,8 @@ namespace NatApiImpl {
   std::vector<RuleDnatEntryJsonObject> read_nat_rule_dnat_entry_list_by_id(const std::string &name);
   RuleMasqueradeJsonObject read_nat_rule_masquerade_by_id(const std::string &name);
   bool read_nat_rule_masquerade_enabled_by_id(const std::string &name);
+  bool read_nat_rule_masquerade_endpoint_independent_by_id(const std::string &name);
+  uint16_t read_nat_rule_masquerade_port_block_size_by_id(const std::string &name);
   RulePortForwardingJsonObject read_nat_rule_port_forwarding_by_id(const std::string &name);
   RulePortForwardingEntryJsonObject read_nat_rule_port_forwarding_entry_by_id(const std::string &name, const uint32_t &id);
   std::string read_nat_rule_port_forwarding_entry_external_ip_by_id(const std::string &name, const uint32_t &id);
@@ -111,10 +120,26 @@ namespace NatApiImpl {
   std::vector<RulePortForwardingEntryJsonObject> read_nat_rule_port_forwarding_entry_list_by_id(const std::string &name);
   std::string read_nat_rule_port_forwarding_entry_proto_by_id(const std::string &name, const uint32_t &id);
   RuleSnatJsonObject read_nat_rule_snat_by_id(const std::string &name);
+  bool read_nat_rule_snat_endpoint_independent_by_id(const std::string &name);
   RuleSnatEntryJsonObject read_nat_rule_snat_entry_by_id(const std::string &name, const uint32_t &id);
   std::string read_nat_rule_snat_entry_external_ip_by_id(const std::string &name, const uint32_t &id);
   std::string read_nat_rule_snat_entry_internal_net_by_id(const std::string &name, const uint32_t &id);
   std::vector<RuleSnatEntryJsonObject> read_nat_rule_snat_entry_list_by_id(const std::string &name);
+  uint16_t read_nat_rule_snat_port_block_size_by_id(const std::string &name);
+  SessionTableJsonObject read_nat_session_table_by_id(const std::string &name);
+  uint32_t read_nat_session_table_icmp_timeout_by_id(const std::string &name);
+  uint32_t read_nat_session_table_size_by_id(const std::string &name);
+  uint32_t read_nat_session_table_tcp_timeout_by_id(const std::string &name);
+  uint32_t read_nat_session_table_udp_timeout_by_id(const std::string &name);
+  StatsJsonObject read_nat_stats_by_id(const std::string &name);
+  uint64_t read_nat_stats_mappings_active_by_id(const std::string &name);
+  uint64_t read_nat_stats_port_alloc_failures_by_id(const std::string &name);
+  uint64_t read_nat_stats_port_blocks_active_by_id(const std::string &name);
+  uint64_t read_nat_stats_port_collisions_by_id(const std::string &name);
+  uint64_t read_nat_stats_sessions_active_by_id(const std::string &name);
+  uint64_t read_nat_stats_sessions_created_by_id(const std::string &name);
+  uint64_t read_nat_stats_sessions_evicted_by_id(const std::string &name);
+  uint64_t read_nat_stats_sessions_expired_by_id(const std::string &name);
   void replace_nat_by_id(const std::string &name, const NatJsonObject &value);
   void replace_nat_natting_table_by_id(const std::string &name, const std::string &internalSrc, const std::string &internalDst, const uint16_t &internalSport, const uint16_t &internalDport, const std::string &proto, const NattingTableJsonObject &value);
   void replace_nat_natting_table_list_by_id(const std::string &name, const std::vector<NattingTableJsonObject> &value);
@@ -129,6 +154,7 @@ namespace NatApiImpl {
   void replace_nat_rule_snat_by_id(const std::string &name, const RuleSnatJsonObject &value);
   void replace_nat_rule_snat_entry_by_id(const std::string &name, const uint32_t &id, const RuleSnatEntryJsonObject &value);
   void replace_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vector<RuleSnatEntryJsonObject> &value);
+  void replace_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
   void update_nat_by_id(const std::string &name, const NatJsonObject &value);
   void update_nat_list_by_id(const std::vector<NatJsonObject> &value);
   void update_nat_natting_table_by_id(const std::string &name, const std::string &internalSrc, const std::string &internalDst, const uint16_t &internalSport, const uint16_t &internalDport, const std::string &proto, const NattingTableJsonObject &value);
@@ -144,6 +170,8 @@ namespace NatApiImpl {
   void update_nat_rule_dnat_entry_list_by_id(const std::string &name, const std::vector<RuleDnatEntryJsonObject> &value);
   void update_nat_rule_masquerade_by_id(const std::string &name, const RuleMasqueradeJsonObject &value);
   void update_nat_rule_masquerade_enabled_by_id(const std::string &name, const bool &value);
+  void update_nat_rule_masquerade_endpoint_independent_by_id(const std::string &name, const bool &value);
+  void update_nat_rule_masquerade_port_block_size_by_id(const std::string &name, const uint16_t &value);
   void update_nat_rule_port_forwarding_by_id(const std::string &name, const RulePortForwardingJsonObject &value);
   void update_nat_rule_port_forwarding_entry_by_id(const std::string &name, const uint32_t &id, const RulePortForwardingEntryJsonObject &value);
   void update_nat_rule_port_forwarding_entry_external_ip_by_id(const std::string &name, const uint32_t &id, const std::string &value);
@@ -153,10 +181,17 @@ namespace NatApiImpl {
   void update_nat_rule_port_forwarding_entry_list_by_id(const std::string &name, const std::vector<RulePortForwardingEntryJsonObject> &value);
   void update_nat_rule_port_forwarding_entry_proto_by_id(const std::string &name, const uint32_t &id, const std::string &value);
   void update_nat_rule_snat_by_id(const std::string &name, const RuleSnatJsonObject &value);
+  void update_nat_rule_snat_endpoint_independent_by_id(const std::string &name, const bool &value);
   void update_nat_rule_snat_entry_by_id(const std::string &name, const uint32_t &id, const RuleSnatEntryJsonObject &value);
   void update_nat_rule_snat_entry_external_ip_by_id(const std::string &name, const uint32_t &id, const std::string &value);
   void update_nat_rule_snat_entry_internal_net_by_id(const std::string &name, const uint32_t &id, const std::string &value);
   void update_nat_rule_snat_entry_list_by_id(const std::string &name, const std::vector<RuleSnatEntryJsonObject> &value);
+  void update_nat_rule_snat_port_block_size_by_id(const std::string &name, const uint16_t &value);
+  void update_nat_session_table_by_id(const std::string &name, const SessionTableJsonObject &value);
+  void update_nat_session_table_icmp_timeout_by_id(const std::string &name, const uint32_t &value);
+  void update_nat_session_table_size_by_id(const std::string &name, const uint32_t &value);
+  void update_nat_session_table_tcp_timeout_by_id(const std::string &name, const uint32_t &value);
+  void update_nat_session_table_udp_timeout_by_id(const std::string &name, const uint32_t &value);
 
   /* help related */
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_nat_list_by_id_get_list();
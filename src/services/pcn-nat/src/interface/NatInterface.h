@@ -24,6 +24,8 @@
 
 #include "../NattingTable.h"
 #include "../Rule.h"
+#include "../SessionTable.h"
+#include "../Stats.h"
 
 using namespace io::swagger::server::model;
 
@@ -51,5 +53,21 @@ public:
   virtual void replaceNattingTable(const std::string &internalSrc, const std::string &internalDst, const uint16_t &internalSport, const uint16_t &internalDport, const std::string &proto, const NattingTableJsonObject &conf) = 0;
   virtual void delNattingTable(const std::string &internalSrc,const std::string &internalDst,const uint16_t &internalSport,const uint16_t &internalDport,const std::string &proto) = 0;
   virtual void delNattingTableList() = 0;
+
+  /// <summary>
+  ///
+  /// </summary>
+  virtual std::shared_ptr<SessionTable> getSessionTable() = 0;
+  virtual void addSessionTable(const SessionTableJsonObject &value) = 0;
+  virtual void replaceSessionTable(const SessionTableJsonObject &conf) = 0;
+  virtual void delSessionTable() = 0;
+
+  /// <summary>
+  ///
+  /// </summary>
+  virtual std::shared_ptr<Stats> getStats() = 0;
+  virtual void addStats(const StatsJsonObject &value) = 0;
+  virtual void replaceStats(const StatsJsonObject &conf) = 0;
+  virtual void delStats() = 0;
 };
 
@@ -42,5 +42,17 @@ public:
   virtual void setEnabled(const bool &value) = 0;
   virtual RuleMasqueradeEnableOutputJsonObject enable() = 0;
   virtual RuleMasqueradeDisableOutputJsonObject disable() = 0;
+
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  virtual bool getEndpointIndependent() = 0;
+  virtual void setEndpointIndependent(const bool &value) = 0;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  virtual uint16_t getPortBlockSize() = 0;
+  virtual void setPortBlockSize(const uint16_t &value) = 0;
 };
 
@@ -45,5 +45,17 @@ public:
   virtual void delEntry(const uint32_t &id) = 0;
   virtual void delEntryList() = 0;
   virtual RuleSnatAppendOutputJsonObject append(RuleSnatAppendInputJsonObject input) = 0;
+
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  virtual bool getEndpointIndependent() = 0;
+  virtual void setEndpointIndependent(const bool &value) = 0;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  virtual uint16_t getPortBlockSize() = 0;
+  virtual void setPortBlockSize(const uint16_t &value) = 0;
 };
 
@@ -0,0 +1,61 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/SessionTableJsonObject.h"
+#include "../serializer/SessionTableDumpInputJsonObject.h"
+#include "../serializer/SessionTableDumpOutputJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class SessionTableInterface {
+public:
+
+  virtual void update(const SessionTableJsonObject &conf) = 0;
+  virtual SessionTableJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Maximum number of sessions in each direction (can be set only at creation)
+  /// </summary>
+  virtual uint32_t getSize() = 0;
+  virtual void setSize(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Idle timeout of TCP sessions (in seconds)
+  /// </summary>
+  virtual uint32_t getTcpTimeout() = 0;
+  virtual void setTcpTimeout(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Idle timeout of UDP sessions (in seconds)
+  /// </summary>
+  virtual uint32_t getUdpTimeout() = 0;
+  virtual void setUdpTimeout(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Idle timeout of ICMP sessions (in seconds)
+  /// </summary>
+  virtual uint32_t getIcmpTimeout() = 0;
+  virtual void setIcmpTimeout(const uint32_t &value) = 0;
+  virtual SessionTableDumpOutputJsonObject dump(SessionTableDumpInputJsonObject input) = 0;
+};
+
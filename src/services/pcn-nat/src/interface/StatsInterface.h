@@ -0,0 +1,74 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* StatsInterface.h
+*
+*
+*/
+
+#pragma once
+
+#include "../serializer/StatsJsonObject.h"
+
+
+using namespace io::swagger::server::model;
+
+class StatsInterface {
+public:
+
+  virtual void update(const StatsJsonObject &conf) = 0;
+  virtual StatsJsonObject toJsonObject() = 0;
+
+  /// <summary>
+  /// Number of connections dropped because no free port was found
+  /// </summary>
+  virtual uint64_t getPortAllocFailures() = 0;
+
+  /// <summary>
+  /// Number of candidate ports discarded because already in use by another session
+  /// </summary>
+  virtual uint64_t getPortCollisions() = 0;
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  virtual uint64_t getSessionsActive() = 0;
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  virtual uint64_t getSessionsCreated() = 0;
+
+  /// <summary>
+  /// Number of sessions removed because idle for longer than their timeout
+  /// </summary>
+  virtual uint64_t getSessionsExpired() = 0;
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  virtual uint64_t getSessionsEvicted() = 0;
+
+  /// <summary>
+  /// Number of endpoint-independent mappings currently in the mapping table
+  /// </summary>
+  virtual uint64_t getMappingsActive() = 0;
+
+  /// <summary>
+  /// Number of port blocks currently allocated to internal addresses
+  /// </summary>
+  virtual uint64_t getPortBlocksActive() = 0;
+};
+
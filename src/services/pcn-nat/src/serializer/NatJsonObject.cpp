@@ -26,6 +26,8 @@ NatJsonObject::NatJsonObject() {
   m_nameIsSet = false;
   m_ruleIsSet = false;
   m_nattingTableIsSet = false;
+  m_sessionTableIsSet = false;
+  m_statsIsSet = false;
 }
 
 NatJsonObject::NatJsonObject(const nlohmann::json &val) :
@@ -33,6 +35,8 @@ NatJsonObject::NatJsonObject(const nlohmann::json &val) :
   m_nameIsSet = false;
   m_ruleIsSet = false;
   m_nattingTableIsSet = false;
+  m_sessionTableIsSet = false;
+  m_statsIsSet = false;
 
 
   if (val.count("name")) {
@@ -54,6 +58,20 @@ NatJsonObject::NatJsonObject(const nlohmann::json &val) :
 
     m_nattingTableIsSet = true;
   }
+
+  if (val.count("session-table")) {
+    if (!val["session-table"].is_null()) {
+      SessionTableJsonObject newItem { val["session-table"] };
+      setSessionTable(newItem);
+    }
+  }
+
+  if (val.count("stats")) {
+    if (!val["stats"].is_null()) {
+      StatsJsonObject newItem { val["stats"] };
+      setStats(newItem);
+    }
+  }
 }
 
 nlohmann::json NatJsonObject::toJson() const {
@@ -81,6 +99,14 @@ nlohmann::json NatJsonObject::toJson() const {
     }
   }
 
+  if (m_sessionTableIsSet) {
+    val["session-table"] = JsonObjectBase::toJson(m_sessionTable);
+  }
+
+  if (m_statsIsSet) {
+    val["stats"] = JsonObjectBase::toJson(m_stats);
+  }
+
   return val;
 }
 
@@ -134,6 +160,40 @@ void NatJsonObject::unsetNattingTable() {
   m_nattingTableIsSet = false;
 }
 
+SessionTableJsonObject NatJsonObject::getSessionTable() const {
+  return m_sessionTable;
+}
+
+void NatJsonObject::setSessionTable(SessionTableJsonObject value) {
+  m_sessionTable = value;
+  m_sessionTableIsSet = true;
+}
+
+bool NatJsonObject::sessionTableIsSet() const {
+  return m_sessionTableIsSet;
+}
+
+void NatJsonObject::unsetSessionTable() {
+  m_sessionTableIsSet = false;
+}
+
+StatsJsonObject NatJsonObject::getStats() const {
+  return m_stats;
+}
+
+void NatJsonObject::setStats(StatsJsonObject value) {
+  m_stats = value;
+  m_statsIsSet = true;
+}
+
+bool NatJsonObject::statsIsSet() const {
+  return m_statsIsSet;
+}
+
+void NatJsonObject::unsetStats() {
+  m_statsIsSet = false;
+}
+
 
 }
 }
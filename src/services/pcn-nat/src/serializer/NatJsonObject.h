@@ -26,6 +26,8 @@
 #include "RuleJsonObject.h"
 #include <vector>
 #include "NattingTableJsonObject.h"
+#include "SessionTableJsonObject.h"
+#include "StatsJsonObject.h"
 #include "polycube/services/cube.h"
 
 namespace io {
@@ -68,6 +70,22 @@ public:
   bool nattingTableIsSet() const;
   void unsetNattingTable();
 
+  /// <summary>
+  ///
+  /// </summary>
+  SessionTableJsonObject getSessionTable() const;
+  void setSessionTable(SessionTableJsonObject value);
+  bool sessionTableIsSet() const;
+  void unsetSessionTable();
+
+  /// <summary>
+  ///
+  /// </summary>
+  StatsJsonObject getStats() const;
+  void setStats(StatsJsonObject value);
+  bool statsIsSet() const;
+  void unsetStats();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -75,6 +93,10 @@ private:
   bool m_ruleIsSet;
   std::vector<NattingTableJsonObject> m_nattingTable;
   bool m_nattingTableIsSet;
+  SessionTableJsonObject m_sessionTable;
+  bool m_sessionTableIsSet;
+  StatsJsonObject m_stats;
+  bool m_statsIsSet;
 };
 
 }
@@ -24,16 +24,30 @@ namespace model {
 
 RuleMasqueradeJsonObject::RuleMasqueradeJsonObject() {
   m_enabledIsSet = false;
+  m_endpointIndependent = false;
+  m_endpointIndependentIsSet = true;
+  m_portBlockSize = 0;
+  m_portBlockSizeIsSet = true;
 }
 
 RuleMasqueradeJsonObject::RuleMasqueradeJsonObject(const nlohmann::json &val) :
   JsonObjectBase(val) {
   m_enabledIsSet = false;
+  m_endpointIndependentIsSet = false;
+  m_portBlockSizeIsSet = false;
 
 
   if (val.count("enabled")) {
     setEnabled(val.at("enabled").get<bool>());
   }
+
+  if (val.count("endpoint-independent")) {
+    setEndpointIndependent(val.at("endpoint-independent").get<bool>());
+  }
+
+  if (val.count("port-block-size")) {
+    setPortBlockSize(val.at("port-block-size").get<uint16_t>());
+  }
 }
 
 nlohmann::json RuleMasqueradeJsonObject::toJson() const {
@@ -46,6 +60,14 @@ nlohmann::json RuleMasqueradeJsonObject::toJson() const {
     val["enabled"] = m_enabled;
   }
 
+  if (m_endpointIndependentIsSet) {
+    val["endpoint-independent"] = m_endpointIndependent;
+  }
+
+  if (m_portBlockSizeIsSet) {
+    val["port-block-size"] = m_portBlockSize;
+  }
+
   return val;
 }
 
@@ -66,6 +88,32 @@ void RuleMasqueradeJsonObject::unsetEnabled() {
   m_enabledIsSet = false;
 }
 
+bool RuleMasqueradeJsonObject::getEndpointIndependent() const {
+  return m_endpointIndependent;
+}
+
+void RuleMasqueradeJsonObject::setEndpointIndependent(bool value) {
+  m_endpointIndependent = value;
+  m_endpointIndependentIsSet = true;
+}
+
+bool RuleMasqueradeJsonObject::endpointIndependentIsSet() const {
+  return m_endpointIndependentIsSet;
+}
+
+uint16_t RuleMasqueradeJsonObject::getPortBlockSize() const {
+  return m_portBlockSize;
+}
+
+void RuleMasqueradeJsonObject::setPortBlockSize(uint16_t value) {
+  m_portBlockSize = value;
+  m_portBlockSizeIsSet = true;
+}
+
+bool RuleMasqueradeJsonObject::portBlockSizeIsSet() const {
+  return m_portBlockSizeIsSet;
+}
+
 
 }
 }
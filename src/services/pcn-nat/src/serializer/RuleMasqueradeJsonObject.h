@@ -49,9 +49,27 @@ public:
   bool enabledIsSet() const;
   void unsetEnabled();
 
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  bool getEndpointIndependent() const;
+  void setEndpointIndependent(bool value);
+  bool endpointIndependentIsSet() const;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  uint16_t getPortBlockSize() const;
+  void setPortBlockSize(uint16_t value);
+  bool portBlockSizeIsSet() const;
+
 private:
   bool m_enabled;
   bool m_enabledIsSet;
+  bool m_endpointIndependent;
+  bool m_endpointIndependentIsSet;
+  uint16_t m_portBlockSize;
+  bool m_portBlockSizeIsSet;
 };
 
 }
@@ -24,11 +24,17 @@ namespace model {
 
 RuleSnatJsonObject::RuleSnatJsonObject() {
   m_entryIsSet = false;
+  m_endpointIndependent = false;
+  m_endpointIndependentIsSet = true;
+  m_portBlockSize = 0;
+  m_portBlockSizeIsSet = true;
 }
 
 RuleSnatJsonObject::RuleSnatJsonObject(const nlohmann::json &val) :
   JsonObjectBase(val) {
   m_entryIsSet = false;
+  m_endpointIndependentIsSet = false;
+  m_portBlockSizeIsSet = false;
 
 
   if (val.count("entry")) {
@@ -39,6 +45,14 @@ RuleSnatJsonObject::RuleSnatJsonObject(const nlohmann::json &val) :
 
     m_entryIsSet = true;
   }
+
+  if (val.count("endpoint-independent")) {
+    setEndpointIndependent(val.at("endpoint-independent").get<bool>());
+  }
+
+  if (val.count("port-block-size")) {
+    setPortBlockSize(val.at("port-block-size").get<uint16_t>());
+  }
 }
 
 nlohmann::json RuleSnatJsonObject::toJson() const {
@@ -58,6 +72,14 @@ nlohmann::json RuleSnatJsonObject::toJson() const {
     }
   }
 
+  if (m_endpointIndependentIsSet) {
+    val["endpoint-independent"] = m_endpointIndependent;
+  }
+
+  if (m_portBlockSizeIsSet) {
+    val["port-block-size"] = m_portBlockSize;
+  }
+
   return val;
 }
 
@@ -79,6 +101,32 @@ void RuleSnatJsonObject::unsetEntry() {
   m_entryIsSet = false;
 }
 
+bool RuleSnatJsonObject::getEndpointIndependent() const {
+  return m_endpointIndependent;
+}
+
+void RuleSnatJsonObject::setEndpointIndependent(bool value) {
+  m_endpointIndependent = value;
+  m_endpointIndependentIsSet = true;
+}
+
+bool RuleSnatJsonObject::endpointIndependentIsSet() const {
+  return m_endpointIndependentIsSet;
+}
+
+uint16_t RuleSnatJsonObject::getPortBlockSize() const {
+  return m_portBlockSize;
+}
+
+void RuleSnatJsonObject::setPortBlockSize(uint16_t value) {
+  m_portBlockSize = value;
+  m_portBlockSizeIsSet = true;
+}
+
+bool RuleSnatJsonObject::portBlockSizeIsSet() const {
+  return m_portBlockSizeIsSet;
+}
+
 
 }
 }
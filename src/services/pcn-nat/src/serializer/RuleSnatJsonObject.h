@@ -51,9 +51,27 @@ public:
   bool entryIsSet() const;
   void unsetEntry();
 
+  /// <summary>
+  /// Translate an internal address and port to the same external port whatever the destination, and accept incoming traffic from any host on that port
+  /// </summary>
+  bool getEndpointIndependent() const;
+  void setEndpointIndependent(bool value);
+  bool endpointIndependentIsSet() const;
+
+  /// <summary>
+  /// Number of external ports reserved to each internal address (0 to allocate ports from the whole range)
+  /// </summary>
+  uint16_t getPortBlockSize() const;
+  void setPortBlockSize(uint16_t value);
+  bool portBlockSizeIsSet() const;
+
 private:
   std::vector<RuleSnatEntryJsonObject> m_entry;
   bool m_entryIsSet;
+  bool m_endpointIndependent;
+  bool m_endpointIndependentIsSet;
+  uint16_t m_portBlockSize;
+  bool m_portBlockSizeIsSet;
 };
 
 }
@@ -0,0 +1,155 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableDumpInputJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableDumpInputJsonObject::SessionTableDumpInputJsonObject() {
+  m_fileIsSet = false;
+  m_internalSrcIsSet = false;
+  m_externalIpIsSet = false;
+  m_protoIsSet = false;
+}
+
+SessionTableDumpInputJsonObject::SessionTableDumpInputJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_fileIsSet = false;
+  m_internalSrcIsSet = false;
+  m_externalIpIsSet = false;
+  m_protoIsSet = false;
+
+
+  if (val.count("file")) {
+    setFile(val.at("file").get<std::string>());
+  }
+
+  if (val.count("internal-src")) {
+    setInternalSrc(val.at("internal-src").get<std::string>());
+  }
+
+  if (val.count("external-ip")) {
+    setExternalIp(val.at("external-ip").get<std::string>());
+  }
+
+  if (val.count("proto")) {
+    setProto(val.at("proto").get<std::string>());
+  }
+}
+
+nlohmann::json SessionTableDumpInputJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_fileIsSet) {
+    val["file"] = m_file;
+  }
+
+  if (m_internalSrcIsSet) {
+    val["internal-src"] = m_internalSrc;
+  }
+
+  if (m_externalIpIsSet) {
+    val["external-ip"] = m_externalIp;
+  }
+
+  if (m_protoIsSet) {
+    val["proto"] = m_proto;
+  }
+
+  return val;
+}
+
+std::string SessionTableDumpInputJsonObject::getFile() const {
+  return m_file;
+}
+
+void SessionTableDumpInputJsonObject::setFile(std::string value) {
+  m_file = value;
+  m_fileIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::fileIsSet() const {
+  return m_fileIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetFile() {
+  m_fileIsSet = false;
+}
+
+std::string SessionTableDumpInputJsonObject::getInternalSrc() const {
+  return m_internalSrc;
+}
+
+void SessionTableDumpInputJsonObject::setInternalSrc(std::string value) {
+  m_internalSrc = value;
+  m_internalSrcIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::internalSrcIsSet() const {
+  return m_internalSrcIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetInternalSrc() {
+  m_internalSrcIsSet = false;
+}
+
+std::string SessionTableDumpInputJsonObject::getExternalIp() const {
+  return m_externalIp;
+}
+
+void SessionTableDumpInputJsonObject::setExternalIp(std::string value) {
+  m_externalIp = value;
+  m_externalIpIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::externalIpIsSet() const {
+  return m_externalIpIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetExternalIp() {
+  m_externalIpIsSet = false;
+}
+
+std::string SessionTableDumpInputJsonObject::getProto() const {
+  return m_proto;
+}
+
+void SessionTableDumpInputJsonObject::setProto(std::string value) {
+  m_proto = value;
+  m_protoIsSet = true;
+}
+
+bool SessionTableDumpInputJsonObject::protoIsSet() const {
+  return m_protoIsSet;
+}
+
+void SessionTableDumpInputJsonObject::unsetProto() {
+  m_protoIsSet = false;
+}
+
+
+}
+}
+}
+}
+
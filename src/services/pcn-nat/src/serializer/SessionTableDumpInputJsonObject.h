@@ -0,0 +1,91 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableDumpInputJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableDumpInputJsonObject : public JsonObjectBase {
+public:
+  SessionTableDumpInputJsonObject();
+  SessionTableDumpInputJsonObject(const nlohmann::json &json);
+  ~SessionTableDumpInputJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// :string:File where the sessions are written (JSON format)
+  /// </summary>
+  std::string getFile() const;
+  void setFile(std::string value);
+  bool fileIsSet() const;
+  void unsetFile();
+
+  /// <summary>
+  /// :string:Only dump sessions whose internal source address belongs to this network
+  /// </summary>
+  std::string getInternalSrc() const;
+  void setInternalSrc(std::string value);
+  bool internalSrcIsSet() const;
+  void unsetInternalSrc();
+
+  /// <summary>
+  /// :string:Only dump sessions translated with this external IP address
+  /// </summary>
+  std::string getExternalIp() const;
+  void setExternalIp(std::string value);
+  bool externalIpIsSet() const;
+  void unsetExternalIp();
+
+  /// <summary>
+  /// :string:Only dump sessions of this L4 protocol (tcp, udp, icmp)
+  /// </summary>
+  std::string getProto() const;
+  void setProto(std::string value);
+  bool protoIsSet() const;
+  void unsetProto();
+
+private:
+  std::string m_file;
+  bool m_fileIsSet;
+  std::string m_internalSrc;
+  bool m_internalSrcIsSet;
+  std::string m_externalIp;
+  bool m_externalIpIsSet;
+  std::string m_proto;
+  bool m_protoIsSet;
+};
+
+}
+}
+}
+}
+
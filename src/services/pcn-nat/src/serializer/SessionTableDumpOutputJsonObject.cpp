@@ -0,0 +1,74 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableDumpOutputJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableDumpOutputJsonObject::SessionTableDumpOutputJsonObject() {
+  m_entriesIsSet = false;
+}
+
+SessionTableDumpOutputJsonObject::SessionTableDumpOutputJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_entriesIsSet = false;
+
+
+  if (val.count("entries")) {
+    setEntries(val.at("entries").get<uint32_t>());
+  }
+}
+
+nlohmann::json SessionTableDumpOutputJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_entriesIsSet) {
+    val["entries"] = m_entries;
+  }
+
+  return val;
+}
+
+uint32_t SessionTableDumpOutputJsonObject::getEntries() const {
+  return m_entries;
+}
+
+void SessionTableDumpOutputJsonObject::setEntries(uint32_t value) {
+  m_entries = value;
+  m_entriesIsSet = true;
+}
+
+bool SessionTableDumpOutputJsonObject::entriesIsSet() const {
+  return m_entriesIsSet;
+}
+
+void SessionTableDumpOutputJsonObject::unsetEntries() {
+  m_entriesIsSet = false;
+}
+
+
+}
+}
+}
+}
+
@@ -0,0 +1,61 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableDumpOutputJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableDumpOutputJsonObject : public JsonObjectBase {
+public:
+  SessionTableDumpOutputJsonObject();
+  SessionTableDumpOutputJsonObject(const nlohmann::json &json);
+  ~SessionTableDumpOutputJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Number of sessions written to the file
+  /// </summary>
+  uint32_t getEntries() const;
+  void setEntries(uint32_t value);
+  bool entriesIsSet() const;
+  void unsetEntries();
+
+private:
+  uint32_t m_entries;
+  bool m_entriesIsSet;
+};
+
+}
+}
+}
+}
+
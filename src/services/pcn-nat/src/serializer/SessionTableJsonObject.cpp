@@ -0,0 +1,159 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "SessionTableJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+SessionTableJsonObject::SessionTableJsonObject() {
+  m_size = 32768;
+  m_sizeIsSet = true;
+  m_tcpTimeout = 7440;
+  m_tcpTimeoutIsSet = true;
+  m_udpTimeout = 300;
+  m_udpTimeoutIsSet = true;
+  m_icmpTimeout = 30;
+  m_icmpTimeoutIsSet = true;
+}
+
+SessionTableJsonObject::SessionTableJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_sizeIsSet = false;
+  m_tcpTimeoutIsSet = false;
+  m_udpTimeoutIsSet = false;
+  m_icmpTimeoutIsSet = false;
+
+
+  if (val.count("size")) {
+    setSize(val.at("size").get<uint32_t>());
+  }
+
+  if (val.count("tcp-timeout")) {
+    setTcpTimeout(val.at("tcp-timeout").get<uint32_t>());
+  }
+
+  if (val.count("udp-timeout")) {
+    setUdpTimeout(val.at("udp-timeout").get<uint32_t>());
+  }
+
+  if (val.count("icmp-timeout")) {
+    setIcmpTimeout(val.at("icmp-timeout").get<uint32_t>());
+  }
+}
+
+nlohmann::json SessionTableJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_sizeIsSet) {
+    val["size"] = m_size;
+  }
+
+  if (m_tcpTimeoutIsSet) {
+    val["tcp-timeout"] = m_tcpTimeout;
+  }
+
+  if (m_udpTimeoutIsSet) {
+    val["udp-timeout"] = m_udpTimeout;
+  }
+
+  if (m_icmpTimeoutIsSet) {
+    val["icmp-timeout"] = m_icmpTimeout;
+  }
+
+  return val;
+}
+
+uint32_t SessionTableJsonObject::getSize() const {
+  return m_size;
+}
+
+void SessionTableJsonObject::setSize(uint32_t value) {
+  m_size = value;
+  m_sizeIsSet = true;
+}
+
+bool SessionTableJsonObject::sizeIsSet() const {
+  return m_sizeIsSet;
+}
+
+void SessionTableJsonObject::unsetSize() {
+  m_sizeIsSet = false;
+}
+
+uint32_t SessionTableJsonObject::getTcpTimeout() const {
+  return m_tcpTimeout;
+}
+
+void SessionTableJsonObject::setTcpTimeout(uint32_t value) {
+  m_tcpTimeout = value;
+  m_tcpTimeoutIsSet = true;
+}
+
+bool SessionTableJsonObject::tcpTimeoutIsSet() const {
+  return m_tcpTimeoutIsSet;
+}
+
+void SessionTableJsonObject::unsetTcpTimeout() {
+  m_tcpTimeoutIsSet = false;
+}
+
+uint32_t SessionTableJsonObject::getUdpTimeout() const {
+  return m_udpTimeout;
+}
+
+void SessionTableJsonObject::setUdpTimeout(uint32_t value) {
+  m_udpTimeout = value;
+  m_udpTimeoutIsSet = true;
+}
+
+bool SessionTableJsonObject::udpTimeoutIsSet() const {
+  return m_udpTimeoutIsSet;
+}
+
+void SessionTableJsonObject::unsetUdpTimeout() {
+  m_udpTimeoutIsSet = false;
+}
+
+uint32_t SessionTableJsonObject::getIcmpTimeout() const {
+  return m_icmpTimeout;
+}
+
+void SessionTableJsonObject::setIcmpTimeout(uint32_t value) {
+  m_icmpTimeout = value;
+  m_icmpTimeoutIsSet = true;
+}
+
+bool SessionTableJsonObject::icmpTimeoutIsSet() const {
+  return m_icmpTimeoutIsSet;
+}
+
+void SessionTableJsonObject::unsetIcmpTimeout() {
+  m_icmpTimeoutIsSet = false;
+}
+
+
+}
+}
+}
+}
+
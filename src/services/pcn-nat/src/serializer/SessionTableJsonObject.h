@@ -0,0 +1,91 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* SessionTableJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  SessionTableJsonObject : public JsonObjectBase {
+public:
+  SessionTableJsonObject();
+  SessionTableJsonObject(const nlohmann::json &json);
+  ~SessionTableJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Maximum number of sessions in each direction (can be set only at creation)
+  /// </summary>
+  uint32_t getSize() const;
+  void setSize(uint32_t value);
+  bool sizeIsSet() const;
+  void unsetSize();
+
+  /// <summary>
+  /// Idle timeout of TCP sessions (in seconds)
+  /// </summary>
+  uint32_t getTcpTimeout() const;
+  void setTcpTimeout(uint32_t value);
+  bool tcpTimeoutIsSet() const;
+  void unsetTcpTimeout();
+
+  /// <summary>
+  /// Idle timeout of UDP sessions (in seconds)
+  /// </summary>
+  uint32_t getUdpTimeout() const;
+  void setUdpTimeout(uint32_t value);
+  bool udpTimeoutIsSet() const;
+  void unsetUdpTimeout();
+
+  /// <summary>
+  /// Idle timeout of ICMP sessions (in seconds)
+  /// </summary>
+  uint32_t getIcmpTimeout() const;
+  void setIcmpTimeout(uint32_t value);
+  bool icmpTimeoutIsSet() const;
+  void unsetIcmpTimeout();
+
+private:
+  uint32_t m_size;
+  bool m_sizeIsSet;
+  uint32_t m_tcpTimeout;
+  bool m_tcpTimeoutIsSet;
+  uint32_t m_udpTimeout;
+  bool m_udpTimeoutIsSet;
+  uint32_t m_icmpTimeout;
+  bool m_icmpTimeoutIsSet;
+};
+
+}
+}
+}
+}
+
@@ -0,0 +1,263 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+
+
+#include "StatsJsonObject.h"
+#include <regex>
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+StatsJsonObject::StatsJsonObject() {
+  m_portAllocFailuresIsSet = false;
+  m_portCollisionsIsSet = false;
+  m_sessionsActiveIsSet = false;
+  m_sessionsCreatedIsSet = false;
+  m_sessionsExpiredIsSet = false;
+  m_sessionsEvictedIsSet = false;
+  m_mappingsActiveIsSet = false;
+  m_portBlocksActiveIsSet = false;
+}
+
+StatsJsonObject::StatsJsonObject(const nlohmann::json &val) :
+  JsonObjectBase(val) {
+  m_portAllocFailuresIsSet = false;
+  m_portCollisionsIsSet = false;
+  m_sessionsActiveIsSet = false;
+  m_sessionsCreatedIsSet = false;
+  m_sessionsExpiredIsSet = false;
+  m_sessionsEvictedIsSet = false;
+  m_mappingsActiveIsSet = false;
+  m_portBlocksActiveIsSet = false;
+
+
+  if (val.count("port-alloc-failures")) {
+    setPortAllocFailures(val.at("port-alloc-failures").get<uint64_t>());
+  }
+
+  if (val.count("port-collisions")) {
+    setPortCollisions(val.at("port-collisions").get<uint64_t>());
+  }
+
+  if (val.count("sessions-active")) {
+    setSessionsActive(val.at("sessions-active").get<uint64_t>());
+  }
+
+  if (val.count("sessions-created")) {
+    setSessionsCreated(val.at("sessions-created").get<uint64_t>());
+  }
+
+  if (val.count("sessions-expired")) {
+    setSessionsExpired(val.at("sessions-expired").get<uint64_t>());
+  }
+
+  if (val.count("sessions-evicted")) {
+    setSessionsEvicted(val.at("sessions-evicted").get<uint64_t>());
+  }
+
+  if (val.count("mappings-active")) {
+    setMappingsActive(val.at("mappings-active").get<uint64_t>());
+  }
+
+  if (val.count("port-blocks-active")) {
+    setPortBlocksActive(val.at("port-blocks-active").get<uint64_t>());
+  }
+}
+
+nlohmann::json StatsJsonObject::toJson() const {
+  nlohmann::json val = nlohmann::json::object();
+  if (!getBase().is_null()) {
+    val.update(getBase());
+  }
+
+  if (m_portAllocFailuresIsSet) {
+    val["port-alloc-failures"] = m_portAllocFailures;
+  }
+
+  if (m_portCollisionsIsSet) {
+    val["port-collisions"] = m_portCollisions;
+  }
+
+  if (m_sessionsActiveIsSet) {
+    val["sessions-active"] = m_sessionsActive;
+  }
+
+  if (m_sessionsCreatedIsSet) {
+    val["sessions-created"] = m_sessionsCreated;
+  }
+
+  if (m_sessionsExpiredIsSet) {
+    val["sessions-expired"] = m_sessionsExpired;
+  }
+
+  if (m_sessionsEvictedIsSet) {
+    val["sessions-evicted"] = m_sessionsEvicted;
+  }
+
+  if (m_mappingsActiveIsSet) {
+    val["mappings-active"] = m_mappingsActive;
+  }
+
+  if (m_portBlocksActiveIsSet) {
+    val["port-blocks-active"] = m_portBlocksActive;
+  }
+
+  return val;
+}
+
+uint64_t StatsJsonObject::getPortAllocFailures() const {
+  return m_portAllocFailures;
+}
+
+void StatsJsonObject::setPortAllocFailures(uint64_t value) {
+  m_portAllocFailures = value;
+  m_portAllocFailuresIsSet = true;
+}
+
+bool StatsJsonObject::portAllocFailuresIsSet() const {
+  return m_portAllocFailuresIsSet;
+}
+
+void StatsJsonObject::unsetPortAllocFailures() {
+  m_portAllocFailuresIsSet = false;
+}
+
+uint64_t StatsJsonObject::getPortCollisions() const {
+  return m_portCollisions;
+}
+
+void StatsJsonObject::setPortCollisions(uint64_t value) {
+  m_portCollisions = value;
+  m_portCollisionsIsSet = true;
+}
+
+bool StatsJsonObject::portCollisionsIsSet() const {
+  return m_portCollisionsIsSet;
+}
+
+void StatsJsonObject::unsetPortCollisions() {
+  m_portCollisionsIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSessionsActive() const {
+  return m_sessionsActive;
+}
+
+void StatsJsonObject::setSessionsActive(uint64_t value) {
+  m_sessionsActive = value;
+  m_sessionsActiveIsSet = true;
+}
+
+bool StatsJsonObject::sessionsActiveIsSet() const {
+  return m_sessionsActiveIsSet;
+}
+
+void StatsJsonObject::unsetSessionsActive() {
+  m_sessionsActiveIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSessionsCreated() const {
+  return m_sessionsCreated;
+}
+
+void StatsJsonObject::setSessionsCreated(uint64_t value) {
+  m_sessionsCreated = value;
+  m_sessionsCreatedIsSet = true;
+}
+
+bool StatsJsonObject::sessionsCreatedIsSet() const {
+  return m_sessionsCreatedIsSet;
+}
+
+void StatsJsonObject::unsetSessionsCreated() {
+  m_sessionsCreatedIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSessionsExpired() const {
+  return m_sessionsExpired;
+}
+
+void StatsJsonObject::setSessionsExpired(uint64_t value) {
+  m_sessionsExpired = value;
+  m_sessionsExpiredIsSet = true;
+}
+
+bool StatsJsonObject::sessionsExpiredIsSet() const {
+  return m_sessionsExpiredIsSet;
+}
+
+void StatsJsonObject::unsetSessionsExpired() {
+  m_sessionsExpiredIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSessionsEvicted() const {
+  return m_sessionsEvicted;
+}
+
+void StatsJsonObject::setSessionsEvicted(uint64_t value) {
+  m_sessionsEvicted = value;
+  m_sessionsEvictedIsSet = true;
+}
+
+bool StatsJsonObject::sessionsEvictedIsSet() const {
+  return m_sessionsEvictedIsSet;
+}
+
+void StatsJsonObject::unsetSessionsEvicted() {
+  m_sessionsEvictedIsSet = false;
+}
+
+uint64_t StatsJsonObject::getMappingsActive() const {
+  return m_mappingsActive;
+}
+
+void StatsJsonObject::setMappingsActive(uint64_t value) {
+  m_mappingsActive = value;
+  m_mappingsActiveIsSet = true;
+}
+
+bool StatsJsonObject::mappingsActiveIsSet() const {
+  return m_mappingsActiveIsSet;
+}
+
+void StatsJsonObject::unsetMappingsActive() {
+  m_mappingsActiveIsSet = false;
+}
+
+uint64_t StatsJsonObject::getPortBlocksActive() const {
+  return m_portBlocksActive;
+}
+
+void StatsJsonObject::setPortBlocksActive(uint64_t value) {
+  m_portBlocksActive = value;
+  m_portBlocksActiveIsSet = true;
+}
+
+bool StatsJsonObject::portBlocksActiveIsSet() const {
+  return m_portBlocksActiveIsSet;
+}
+
+void StatsJsonObject::unsetPortBlocksActive() {
+  m_portBlocksActiveIsSet = false;
+}
+
+
+}
+}
+}
+}
+
@@ -0,0 +1,131 @@
+/**
+* nat API
+* nat API generated from nat.yang
+*
+* OpenAPI spec version: 1.0.0
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/polycube-network/swagger-codegen.git
+* branch polycube
+*/
+
+
+/* Do not edit this file manually */
+
+/*
+* StatsJsonObject.h
+*
+*
+*/
+
+#pragma once
+
+
+#include "JsonObjectBase.h"
+
+
+namespace io {
+namespace swagger {
+namespace server {
+namespace model {
+
+
+/// <summary>
+///
+/// </summary>
+class  StatsJsonObject : public JsonObjectBase {
+public:
+  StatsJsonObject();
+  StatsJsonObject(const nlohmann::json &json);
+  ~StatsJsonObject() final = default;
+  nlohmann::json toJson() const final;
+
+
+  /// <summary>
+  /// Number of connections dropped because no free port was found
+  /// </summary>
+  uint64_t getPortAllocFailures() const;
+  void setPortAllocFailures(uint64_t value);
+  bool portAllocFailuresIsSet() const;
+  void unsetPortAllocFailures();
+
+  /// <summary>
+  /// Number of candidate ports discarded because already in use by another session
+  /// </summary>
+  uint64_t getPortCollisions() const;
+  void setPortCollisions(uint64_t value);
+  bool portCollisionsIsSet() const;
+  void unsetPortCollisions();
+
+  /// <summary>
+  /// Number of sessions currently in the session table
+  /// </summary>
+  uint64_t getSessionsActive() const;
+  void setSessionsActive(uint64_t value);
+  bool sessionsActiveIsSet() const;
+  void unsetSessionsActive();
+
+  /// <summary>
+  /// Number of sessions created
+  /// </summary>
+  uint64_t getSessionsCreated() const;
+  void setSessionsCreated(uint64_t value);
+  bool sessionsCreatedIsSet() const;
+  void unsetSessionsCreated();
+
+  /// <summary>
+  /// Number of sessions removed because idle for longer than their timeout
+  /// </summary>
+  uint64_t getSessionsExpired() const;
+  void setSessionsExpired(uint64_t value);
+  bool sessionsExpiredIsSet() const;
+  void unsetSessionsExpired();
+
+  /// <summary>
+  /// Number of sessions evicted because the session table was full
+  /// </summary>
+  uint64_t getSessionsEvicted() const;
+  void setSessionsEvicted(uint64_t value);
+  bool sessionsEvictedIsSet() const;
+  void unsetSessionsEvicted();
+
+  /// <summary>
+  /// Number of endpoint-independent mappings currently in the mapping table
+  /// </summary>
+  uint64_t getMappingsActive() const;
+  void setMappingsActive(uint64_t value);
+  bool mappingsActiveIsSet() const;
+  void unsetMappingsActive();
+
+  /// <summary>
+  /// Number of port blocks currently allocated to internal addresses
+  /// </summary>
+  uint64_t getPortBlocksActive() const;
+  void setPortBlocksActive(uint64_t value);
+  bool portBlocksActiveIsSet() const;
+  void unsetPortBlocksActive();
+
+private:
+  uint64_t m_portAllocFailures;
+  bool m_portAllocFailuresIsSet;
+  uint64_t m_portCollisions;
+  bool m_portCollisionsIsSet;
+  uint64_t m_sessionsActive;
+  bool m_sessionsActiveIsSet;
+  uint64_t m_sessionsCreated;
+  bool m_sessionsCreatedIsSet;
+  uint64_t m_sessionsExpired;
+  bool m_sessionsExpiredIsSet;
+  uint64_t m_sessionsEvicted;
+  bool m_sessionsEvictedIsSet;
+  uint64_t m_mappingsActive;
+  bool m_mappingsActiveIsSet;
+  uint64_t m_portBlocksActive;
+  bool m_portBlocksActiveIsSet;
+};
+
+}
+}
+}
+}
+
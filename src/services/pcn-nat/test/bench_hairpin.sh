@@ -0,0 +1,95 @@
+#! /bin/bash
+
+#                 ===nat hairpin forwarding rate benchmark===
+#
+# Same topology as test_tcp_hairpin.sh. Sends a burst of UDP packets from ns1
+# with the pktgen kernel module, first to the internal address of the server
+# (plain routing, as a reference) and then to the external address of the
+# dnat rule (hairpin), and prints the packets per second received by the
+# server in both cases.
+#
+# usage: bench_hairpin.sh [packets] [packet size]
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+PACKETS=${1:-1000000}
+PKT_SIZE=${2:-64}
+
+veth1_ip=10.0.1.1
+veth2_ip=10.0.2.1
+veth3_ip=10.0.3.1
+to_veth1_ip=10.0.1.254
+to_veth2_ip=10.0.2.254
+to_veth3_ip=10.0.3.254
+external_ip=10.0.5.1
+udp_port=3000
+
+set -e
+
+function cleanup {
+  set +e
+  delete_veth 3
+  polycubectl nat del nat1
+  polycubectl router del r1
+}
+trap cleanup EXIT
+
+create_veth_net 3
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+polycubectl router r1 ports add to_veth3 ip=$to_veth3_ip/24 peer=veth3
+polycubectl router r1 route add 0.0.0.0/0 $veth2_ip
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 rule dnat append external-ip=$external_ip internal-ip=$veth3_ip
+
+# resolve the server and let the router learn its address
+sudo ip netns exec ns1 ping -c 1 $veth3_ip > /dev/null
+
+sudo modprobe pktgen
+r1_mac=$(polycubectl r1 ports to_veth1 show mac)
+
+function pgset {
+  sudo ip netns exec ns1 sh -c "echo \"$2\" > /proc/net/pktgen/$1"
+}
+
+function rx_packets {
+  sudo ip netns exec ns3 cat /sys/class/net/veth3_/statistics/rx_packets
+}
+
+# usage: measure <label> <destination>
+function measure {
+  pgset kpktgend_0 "rem_device_all"
+  pgset kpktgend_0 "add_device veth1_"
+  pgset veth1_ "count $PACKETS"
+  pgset veth1_ "pkt_size $PKT_SIZE"
+  pgset veth1_ "delay 0"
+  pgset veth1_ "src_min $veth1_ip"
+  pgset veth1_ "src_max $veth1_ip"
+  pgset veth1_ "dst $2"
+  pgset veth1_ "dst_mac $r1_mac"
+  pgset veth1_ "udp_src_min 50000"
+  pgset veth1_ "udp_src_max 50000"
+  pgset veth1_ "udp_dst_min $udp_port"
+  pgset veth1_ "udp_dst_max $udp_port"
+
+  before=$(rx_packets)
+  start=$(date +%s.%N)
+  pgset pgctrl "start"
+  end=$(date +%s.%N)
+  sleep 1
+  received=$(( $(rx_packets) - before ))
+
+  echo "$1: $received/$PACKETS packets received," \
+       "$(echo "$received / ($end - $start)" | bc) pps"
+}
+
+measure "routing" $veth3_ip
+measure "hairpin" $external_ip
+
+polycubectl nat1 stats show
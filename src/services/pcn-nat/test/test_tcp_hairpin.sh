@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+
+#         TOPOLOGY
+#
+#                                  +----------+
+#         veth1 (10.0.1.1)---------|    r1    |--------- veth2 (10.0.2.1)
+#                               ^  +----------+  ^
+#                               |       |        |
+#                        to_veth1       |     to_veth2 (nat)
+#                                       |
+#                                  to_veth3
+#                                       |
+#                               veth3 (10.0.3.1)
+#
+
+# test hairpin: a TCP connection from veth1 towards the external address of
+# a dnat rule must be translated and sent back to the server behind it
+# (veth3), without leaving the router
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function test_tcp {
+  sudo ip netns exec ns3 netcat -l -w 5 $tcp_port&
+  sleep 2
+  sudo ip netns exec ns1 netcat -w 5 -nvz $external_ip $tcp_port
+  sleep 4
+}
+
+function test_tcp_fail {
+  sudo ip netns exec ns3 netcat -l -w 5 $tcp_port&
+  sleep 2
+  test_fail sudo ip netns exec ns1 netcat -w 5 -nvz $external_ip $tcp_port
+  sleep 4
+}
+
+function cleanup {
+  set +e
+  delete_veth 3
+  polycubectl nat del nat1
+  polycubectl router del r1
+  sudo pkill -SIGTERM netcat
+}
+trap cleanup EXIT
+
+veth2_ip=10.0.2.1
+veth3_ip=10.0.3.1
+to_veth1_ip=10.0.1.254
+to_veth2_ip=10.0.2.254
+to_veth3_ip=10.0.3.254
+# not owned by the router: packets to the router addresses never reach the nat
+external_ip=10.0.5.1
+tcp_port=60123
+
+set -x
+set -e
+
+create_veth_net 3
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+polycubectl router r1 ports add to_veth3 ip=$to_veth3_ip/24 peer=veth3
+polycubectl router r1 route add 0.0.0.0/0 $veth2_ip
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 rule dnat append external-ip=$external_ip internal-ip=$veth3_ip
+
+test_tcp
+
+# the replies of the server came back through the nat
+sessions=$(polycubectl nat1 stats sessions-active show)
+if [ "$sessions" -ne 1 ]; then
+  exit 1
+fi
+
+polycubectl nat1 rule dnat entry del 0
+polycubectl nat1 natting-table del
+
+test_tcp_fail
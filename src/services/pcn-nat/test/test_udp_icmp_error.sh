@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+
+#         TOPOLOGY
+#
+#                                  +----------+
+#         veth1 (10.0.1.1)---------|    r1    |--------- veth2 (10.0.2.1)
+#                               ^  +----------+  ^
+#                               |                |
+#                             to_veth1        to_veth2 (nat)
+#
+
+# test ICMP errors: the port unreachable sent by veth2 for a natted UDP
+# datagram must be translated, embedded header included, so that the socket
+# of veth1 gets "connection refused"
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function test_udp_refused {
+  sudo ip netns exec ns1 python3 -c "
+import socket, sys
+s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+s.settimeout(3)
+s.connect(('$veth2_ip', $udp_port))
+s.send(b'x')
+try:
+    s.recv(1)
+except ConnectionRefusedError:
+    sys.exit(0)
+sys.exit(1)
+"
+}
+
+function cleanup {
+  set +e
+  delete_veth 2
+  polycubectl nat del nat1
+  polycubectl router del r1
+}
+trap cleanup EXIT
+
+veth2_ip=10.0.2.1
+to_veth2_ip=10.0.2.254
+to_veth1_ip=10.0.1.254
+# nobody listens on this port in ns2
+udp_port=3999
+
+set -x
+set -e
+
+create_veth_net 2
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 rule snat append internal-net=10.0.1.0/24 external-ip=$to_veth2_ip
+
+test_udp_refused
+
+# with endpoint-independent mappings as well
+polycubectl nat1 natting-table del
+polycubectl nat1 rule snat set endpoint-independent=true
+
+test_udp_refused
@@ -0,0 +1,88 @@
+#!/usr/bin/env bash
+
+#         TOPOLOGY
+#
+#                                  +----------+
+#         veth1 (10.0.1.1)---------|    r1    |--------- veth2 (10.0.2.1)
+#                               ^  +----------+  ^
+#                               |                |
+#                             to_veth1        to_veth2 (nat)
+#
+
+# test session timeouts: idle UDP sessions must be removed from the natting
+# table, and the sessions dump must contain only the filtered sessions
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function test_udp_sessions {
+  for port in `seq 50000 50003`;
+  do
+    sudo ip netns exec ns1 nping --udp -c 1 -p $udp_port --source-port $port $veth2_ip > /dev/null
+  done
+
+  created=$(polycubectl nat1 stats sessions-created show)
+  if [ "$created" -ne 4 ]; then
+    exit 1
+  fi
+
+  polycubectl nat1 session-table dump file=$dump_file proto=udp
+  entries=$(grep -c '"external-port"' $dump_file)
+  if [ "$entries" -ne 4 ]; then
+    exit 1
+  fi
+
+  polycubectl nat1 session-table dump file=$dump_file proto=tcp
+  entries=$(grep -c '"external-port"' $dump_file || true)
+  if [ "$entries" -ne 0 ]; then
+    exit 1
+  fi
+
+  # wait for the timeout and for the sweeper to run
+  sleep $((udp_timeout + 10))
+
+  active=$(polycubectl nat1 stats sessions-active show)
+  if [ "$active" -ne 0 ]; then
+    exit 1
+  fi
+
+  expired=$(polycubectl nat1 stats sessions-expired show)
+  if [ "$expired" -ne 4 ]; then
+    exit 1
+  fi
+}
+
+function cleanup {
+  set +e
+  delete_veth 2
+  polycubectl nat del nat1
+  polycubectl router del r1
+  rm -f $dump_file
+}
+trap cleanup EXIT
+
+veth1_ip=10.0.1.1
+veth2_ip=10.0.2.1
+to_veth2_ip=10.0.2.254
+to_veth1_ip=10.0.1.254
+udp_port=3000
+udp_timeout=5
+dump_file=/tmp/nat1_sessions.json
+
+set -x
+set -e
+
+create_veth_net 2
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 session-table set udp-timeout=$udp_timeout
+
+polycubectl nat1 rule snat append internal-net=10.0.1.0/24 external-ip=$to_veth2_ip
+
+test_udp_sessions
@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+
+#         TOPOLOGY
+#
+#                                  +----------+
+#         veth1 (10.0.1.1)---------|    r1    |--------- veth2 (10.0.2.1)
+#           (10.0.1.2)          ^  +----------+  ^
+#                               |                |
+#                             to_veth1        to_veth2 (nat)
+#
+
+# test port blocks: each internal address must get its own block, and the
+# sessions of an address must be translated with ports of its block
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function test_port_blocks {
+  for src in $veth1_ip $veth1_ip2;
+  do
+    for port in `seq 50000 50003`;
+    do
+      sudo ip netns exec ns1 nping --udp -c 1 -S $src -p $udp_port --source-port $port $veth2_ip > /dev/null
+    done
+  done
+
+  blocks=$(polycubectl nat1 stats port-blocks-active show)
+  if [ "$blocks" -ne 2 ]; then
+    exit 1
+  fi
+
+  # the ports of the two addresses must belong to two distinct blocks
+  used=$(polycubectl nat1 natting-table show -format=json | grep '"external-port"' | tr -dc '0-9\n' | awk -v size=$block_size '{ print int(($1 - 1024) / size) }' | sort -u | wc -l)
+  if [ "$used" -ne 2 ]; then
+    exit 1
+  fi
+
+  # flushing the natting table releases the blocks
+  polycubectl nat1 natting-table del
+  blocks=$(polycubectl nat1 stats port-blocks-active show)
+  if [ "$blocks" -ne 0 ]; then
+    exit 1
+  fi
+}
+
+function cleanup {
+  set +e
+  delete_veth 2
+  polycubectl nat del nat1
+  polycubectl router del r1
+}
+trap cleanup EXIT
+
+veth1_ip=10.0.1.1
+veth1_ip2=10.0.1.2
+veth2_ip=10.0.2.1
+to_veth2_ip=10.0.2.254
+to_veth1_ip=10.0.1.254
+udp_port=3000
+block_size=64
+
+set -x
+set -e
+
+create_veth_net 2
+sudo ip netns exec ns1 ip addr add $veth1_ip2/24 dev veth1_
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 rule snat set port-block-size=$block_size
+polycubectl nat1 rule snat append internal-net=10.0.1.0/24 external-ip=$to_veth2_ip
+
+test_port_blocks
@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+
+#         TOPOLOGY
+#
+#                                  +----------+
+#         veth1 (10.0.1.1)---------|    r1    |--------- veth2 (10.0.2.1)
+#                               ^  +----------+  ^
+#                               |                |
+#                             to_veth1        to_veth2 (nat)
+#
+
+# test port allocation: many UDP sessions towards the same endpoint must be
+# translated with distinct external ports
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function test_udp_sessions {
+  for port in `seq 50000 50063`;
+  do
+    sudo ip netns exec ns1 nping --udp -c 1 -p $udp_port --source-port $port $veth2_ip > /dev/null
+  done
+
+  # every session must have its own external port
+  sessions=$(polycubectl nat1 natting-table show -format=json | grep -c '"external-port"')
+  ports=$(polycubectl nat1 natting-table show -format=json | grep '"external-port"' | sort -u | wc -l)
+  if [ "$sessions" -ne "$ports" ]; then
+    exit 1
+  fi
+
+  failures=$(polycubectl nat1 stats port-alloc-failures show)
+  if [ "$failures" -ne 0 ]; then
+    exit 1
+  fi
+}
+
+function cleanup {
+  set +e
+  delete_veth 2
+  polycubectl nat del nat1
+  polycubectl router del r1
+}
+trap cleanup EXIT
+
+veth1_ip=10.0.1.1
+veth2_ip=10.0.2.1
+to_veth2_ip=10.0.2.254
+to_veth1_ip=10.0.1.254
+udp_port=3000
+
+set -x
+set -e
+
+create_veth_net 2
+
+polycubectl nat add nat1
+polycubectl router add r1
+
+polycubectl router r1 ports add to_veth1 ip=$to_veth1_ip/24 peer=veth1
+polycubectl router r1 ports add to_veth2 ip=$to_veth2_ip/24 peer=veth2
+
+polycubectl attach nat1 r1:to_veth2 position=first
+
+polycubectl nat1 rule snat append internal-net=10.0.1.0/24 external-ip=$to_veth2_ip
+
+test_udp_sessions
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CaptureStream.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "CaptureWriter.h"
+
+#define MAX_REQUEST_SIZE 8192
+
+const std::chrono::milliseconds CaptureStream::POLL_TIMEOUT(100);
+const std::chrono::seconds CaptureStream::IO_TIMEOUT(10);
+
+CaptureStream::CaptureStream(PacketRing &ring, const std::string &address,
+                             uint16_t port, header_cb header)
+    : ring_(ring), header_(header), stop_(false) {
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1)
+    throw std::runtime_error("Invalid stream address " + address);
+
+  listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (listen_fd_ < 0)
+    throw std::runtime_error(std::string("Cannot create stream socket: ") +
+                             std::strerror(errno));
+
+  int one = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  if (::bind(listen_fd_, (struct sockaddr *) &addr, sizeof(addr)) < 0 ||
+      ::listen(listen_fd_, 16) < 0) {
+    std::string error = std::strerror(errno);
+    ::close(listen_fd_);
+    throw std::runtime_error("Cannot listen on " + address + ":" +
+                             std::to_string(port) + ": " + error);
+  }
+
+  acceptor_ = std::thread(&CaptureStream::acceptLoop, this);
+}
+
+CaptureStream::~CaptureStream() {
+  stop_ = true;
+  acceptor_.join();
+  ::close(listen_fd_);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (int fd : clients_)
+    ::shutdown(fd, SHUT_RDWR);
+  ring_.wakeUp();
+  cv_.wait(lock, [this] { return clients_.empty(); });
+}
+
+void CaptureStream::acceptLoop() {
+  struct pollfd pfd = {listen_fd_, POLLIN, 0};
+  while (!stop_) {
+    if (::poll(&pfd, 1, POLL_TIMEOUT.count()) <= 0)
+      continue;
+
+    int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0)
+      continue;
+
+    struct timeval tv = {IO_TIMEOUT.count(), 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (clients_.size() >= MAX_CLIENTS) {
+      static const char reply[] =
+          "HTTP/1.1 503 Service Unavailable\r\n"
+          "Content-Length: 0\r\n"
+          "Connection: close\r\n\r\n";
+      sendAll(fd, reply, sizeof(reply) - 1);
+      ::close(fd);
+      continue;
+    }
+    clients_.insert(fd);
+    ring_.setStreaming(true);
+    std::thread(&CaptureStream::serve, this, fd).detach();
+  }
+}
+
+void CaptureStream::serve(int fd) {
+  std::string request;
+  if (readRequest(fd, request)) {
+    if (request.compare(0, 4, "GET ") != 0) {
+      static const char reply[] =
+          "HTTP/1.1 405 Method Not Allowed\r\n"
+          "Allow: GET\r\n"
+          "Content-Length: 0\r\n"
+          "Connection: close\r\n\r\n";
+      sendAll(fd, reply, sizeof(reply) - 1);
+    } else {
+      static const char reply[] =
+          "HTTP/1.1 200 OK\r\n"
+          "Content-Type: application/vnd.tcpdump.pcap\r\n"
+          "Transfer-Encoding: chunked\r\n"
+          "Cache-Control: no-cache\r\n"
+          "Connection: close\r\n\r\n";
+
+      // the stream starts with the packets captured from now on
+      uint64_t seq = ring_.tail();
+      std::vector<struct ring_record> records(BATCH_SIZE);
+      std::vector<char> chunk = header_();
+      bool ok = sendAll(fd, reply, sizeof(reply) - 1) && sendChunk(fd, chunk);
+
+      while (ok && !stop_) {
+        size_t n = ring_.read(seq, records, POLL_TIMEOUT);
+        if (n == 0)
+          continue;
+
+        chunk.clear();
+        for (size_t i = 0; i < n; i++) {
+          struct pcap_record_hdr hdr;
+          hdr.ts_sec = (uint32_t) records[i].ts.tv_sec;
+          hdr.ts_usec = (uint32_t) records[i].ts.tv_usec;
+          hdr.caplen = records[i].data.size();
+          hdr.len = records[i].packet_len;
+
+          const char *h = reinterpret_cast<const char *>(&hdr);
+          chunk.insert(chunk.end(), h, h + sizeof(hdr));
+          chunk.insert(chunk.end(), records[i].data.begin(),
+                       records[i].data.end());
+        }
+        ok = sendChunk(fd, chunk);
+      }
+
+      // last chunk, the response ends when the stream is stopped
+      if (ok)
+        sendAll(fd, "0\r\n\r\n", 5);
+    }
+  }
+
+  // the socket is closed under the lock, once it is no longer in the set:
+  // the destructor cannot shut down a descriptor reused in the meantime
+  std::lock_guard<std::mutex> lock(mutex_);
+  clients_.erase(fd);
+  ::close(fd);
+  ring_.setStreaming(!clients_.empty());
+  cv_.notify_all();
+}
+
+// reads the request headers, the body is not expected
+bool CaptureStream::readRequest(int fd, std::string &request) {
+  char buf[1024];
+  while (request.find("\r\n\r\n") == std::string::npos) {
+    if (request.size() > MAX_REQUEST_SIZE)
+      return false;
+    ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    request.append(buf, n);
+  }
+  return true;
+}
+
+bool CaptureStream::sendAll(int fd, const char *data, size_t len) {
+  while (len > 0) {
+    ssize_t n = ::send(fd, data, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool CaptureStream::sendChunk(int fd, const std::vector<char> &data) {
+  char size[32];
+  int len = snprintf(size, sizeof(size), "%zx\r\n", data.size());
+  return sendAll(fd, size, len) && sendAll(fd, data.data(), data.size()) &&
+         sendAll(fd, "\r\n", 2);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PacketRing.h"
+
+/*
+ * HTTP endpoint streaming the packets captured in network mode.
+ * Each client receives a chunked response with a pcap file that never ends:
+ * the file header followed by the packets pushed in the ring since the
+ * client connected, so that it can be read with e.g.
+ *   curl -sN http://<address>:<port>/ | tcpdump -r -
+ * The packets are sent in batches, a client that does not keep up loses the
+ * packets overwritten in the ring.
+ * At most MAX_CLIENTS clients are served at the same time, the others receive
+ * a 503 response.
+ */
+class CaptureStream {
+ public:
+  typedef std::function<std::vector<char>()> header_cb;
+
+  CaptureStream(PacketRing &ring, const std::string &address, uint16_t port,
+                header_cb header);
+  ~CaptureStream();
+
+ private:
+  static const size_t BATCH_SIZE = 256;
+  static const size_t MAX_CLIENTS = 16;
+  static const std::chrono::milliseconds POLL_TIMEOUT;
+  // a client that does not send its request or does not read the stream
+  // within this time is disconnected
+  static const std::chrono::seconds IO_TIMEOUT;
+
+  void acceptLoop();
+  void serve(int fd);
+  static bool readRequest(int fd, std::string &request);
+  static bool sendAll(int fd, const char *data, size_t len);
+  static bool sendChunk(int fd, const std::vector<char> &data);
+
+  PacketRing &ring_;
+  header_cb header_;
+  int listen_fd_;
+  std::atomic<bool> stop_;
+  std::thread acceptor_;
+
+  // the client threads are detached, the destructor waits for them to
+  // remove their socket from the set
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::set<int> clients_;
+};
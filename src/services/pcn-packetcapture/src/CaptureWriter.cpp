@@ -0,0 +1,223 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CaptureWriter.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+const std::chrono::milliseconds CaptureWriter::FLUSH_INTERVAL(500);
+
+CaptureWriter::CaptureWriter(const std::string &base,
+                             const std::string &extension,
+                             const std::vector<char> &header, bool compress,
+                             error_cb error)
+    : base_(base),
+      extension_(compress ? extension + ".gz" : extension),
+      header_(header),
+      compress_(compress),
+      error_(error) {
+  active_.reserve(BUFFER_SIZE);
+  pending_.reserve(BUFFER_SIZE);
+  last_hand_over_ = std::chrono::steady_clock::now();
+
+  // the first file is opened here so that errors reach the caller
+  openFile();
+  writer_ = std::thread(&CaptureWriter::writerLoop, this);
+}
+
+CaptureWriter::~CaptureWriter() {
+  // write what is still buffered
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !pending_full_; });
+    std::swap(active_, pending_);
+    std::swap(active_records_, pending_records_);
+    pending_full_ = !pending_.empty();
+    stop_ = true;
+  }
+  cv_.notify_one();
+  writer_.join();
+
+  if (fd_ >= 0)
+    ::close(fd_);
+}
+
+bool CaptureWriter::write(const struct iovec *iov, int iovcnt) {
+  size_t len = 0;
+  for (int i = 0; i < iovcnt; i++)
+    len += iov[i].iov_len;
+  if (len > BUFFER_SIZE || failed_)
+    return false;
+
+  if (active_.size() + len > BUFFER_SIZE && !handOver())
+    return false;
+
+  for (int i = 0; i < iovcnt; i++) {
+    const char *d = static_cast<const char *>(iov[i].iov_base);
+    active_.insert(active_.end(), d, d + iov[i].iov_len);
+  }
+  active_records_++;
+  return true;
+}
+
+void CaptureWriter::flushStale() {
+  if (!active_.empty() &&
+      std::chrono::steady_clock::now() - last_hand_over_ > FLUSH_INTERVAL)
+    handOver();
+}
+
+// passes the active buffer to the writer thread, fails if it is still busy
+// with the previous one
+bool CaptureWriter::handOver() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_full_)
+      return false;
+    std::swap(active_, pending_);
+    std::swap(active_records_, pending_records_);
+    pending_full_ = true;
+  }
+  cv_.notify_one();
+  last_hand_over_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+void CaptureWriter::setRotation(uint64_t size, uint32_t interval) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  rotate_size_ = size;
+  rotate_interval_ = std::chrono::seconds(interval);
+}
+
+std::string CaptureWriter::getFileName() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return file_name_;
+}
+
+void CaptureWriter::writerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this] { return pending_full_ || stop_; });
+    if (!pending_full_)
+      break;
+
+    bool rotate =
+        (rotate_size_ > 0 && file_size_ >= rotate_size_) ||
+        (rotate_interval_.count() > 0 &&
+         std::chrono::steady_clock::now() - file_opened_ >= rotate_interval_);
+
+    // the buffer is not touched by the capture thread until pending_full_
+    // is cleared, the lock is not needed to write it
+    lock.unlock();
+    if (failed_) {
+      error_(pending_records_, "No dump file open after a previous error");
+    } else {
+      try {
+        if (rotate) {
+          file_index_++;
+          openFile();
+        }
+        writeBlock(pending_);
+      } catch (const std::exception &e) {
+        // the records of this buffer are lost, after a write error the next
+        // one is tried again
+        error_(pending_records_, e.what());
+      }
+    }
+    pending_.clear();
+    pending_records_ = 0;
+    lock.lock();
+
+    pending_full_ = false;
+    cv_.notify_all();
+    if (stop_)
+      break;
+  }
+}
+
+void CaptureWriter::openFile() {
+  std::string name = base_;
+  if (file_index_ > 0)
+    name += "_" + std::to_string(file_index_);
+  name += "." + extension_;
+
+  if (fd_ >= 0)
+    ::close(fd_);
+  fd_ = ::open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    // the previous file is closed, nothing else can be written
+    failed_ = true;
+    throw std::runtime_error("Cannot open dump file " + name + ": " +
+                             std::strerror(errno));
+  }
+
+  file_size_ = 0;
+  file_opened_ = std::chrono::steady_clock::now();
+  writeBlock(header_);
+
+  // the file name is read by the control plane
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_name_ = name;
+}
+
+// writes the data to the current file, as a gzip member if compression is
+// enabled
+void CaptureWriter::writeBlock(const std::vector<char> &data) {
+  if (!compress_) {
+    writeAll(data.data(), data.size());
+    return;
+  }
+
+  z_stream zs;
+  memset(&zs, 0, sizeof(zs));
+  // 15 bits window, +16 for the gzip wrapper
+  if (deflateInit2(&zs, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    throw std::runtime_error("Cannot initialize the dump compression");
+
+  compressed_.resize(deflateBound(&zs, data.size()));
+  zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+  zs.avail_in = data.size();
+  zs.next_out = reinterpret_cast<Bytef *>(compressed_.data());
+  zs.avail_out = compressed_.size();
+  int ret = deflate(&zs, Z_FINISH);
+  size_t len = zs.total_out;
+  deflateEnd(&zs);
+  if (ret != Z_STREAM_END)
+    throw std::runtime_error("Cannot compress the dump");
+
+  writeAll(compressed_.data(), len);
+}
+
+void CaptureWriter::writeAll(const char *data, size_t len) {
+  while (len > 0) {
+    ssize_t n = ::write(fd_, data, len);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      throw std::runtime_error(std::string("Cannot write dump file: ") +
+                               std::strerror(errno));
+    }
+    data += n;
+    len -= n;
+    file_size_ += n;
+  }
+}
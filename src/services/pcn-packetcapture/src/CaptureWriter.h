@@ -0,0 +1,117 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* pcap record header, with 32 bits timestamps as in the file format */
+struct pcap_record_hdr {
+  uint32_t ts_sec;
+  uint32_t ts_usec;
+  uint32_t caplen;
+  uint32_t len;
+};
+
+/*
+ * Writes the captured packets to dump files.
+ * The records are appended to an in-memory buffer by the capture thread and
+ * written in large chunks by a dedicated thread, while the capture goes on
+ * in a second buffer. When both buffers are full the records are dropped, so
+ * the capture never waits for the disk.
+ * The files are named <base>.<extension>, <base>_1.<extension>, ... and a new
+ * one is started when the current one exceeds the rotation size or age,
+ * checked each time a buffer is written. Each file begins with the header
+ * given by the caller.
+ * With compression enabled each buffer is written as a separate gzip member:
+ * the members are decompressed in sequence by gzip and zlib based readers.
+ * The records of a buffer that cannot be written are reported to the error
+ * callback. After a new file cannot be opened nothing else is written, and
+ * the following records are dropped.
+ */
+class CaptureWriter {
+ public:
+  // called by the writer thread with the number of records lost
+  typedef std::function<void(size_t records, const std::string &error)>
+      error_cb;
+
+  CaptureWriter(const std::string &base, const std::string &extension,
+                const std::vector<char> &header, bool compress,
+                error_cb error);
+  ~CaptureWriter();
+
+  // appends a record made of the given pieces, returns false if it has been
+  // dropped
+  bool write(const struct iovec *iov, int iovcnt);
+  // hands the buffered records to the writer if they are waiting since more
+  // than FLUSH_INTERVAL, so that the file is updated also at low rates
+  void flushStale();
+
+  // 0 disables the rotation
+  void setRotation(uint64_t size, uint32_t interval);
+  std::string getFileName();
+
+ private:
+  static const size_t BUFFER_SIZE = 4 * 1024 * 1024;
+  static const std::chrono::milliseconds FLUSH_INTERVAL;
+
+  bool handOver();
+  void writerLoop();
+  void openFile();
+  void writeBlock(const std::vector<char> &data);
+  void writeAll(const char *data, size_t len);
+
+  std::string base_;
+  std::string extension_;
+  std::vector<char> header_;
+  bool compress_;
+  error_cb error_;
+  // set by the writer thread when a file cannot be opened
+  std::atomic<bool> failed_{false};
+
+  // filled by the capture thread, only handOver() needs the lock
+  std::vector<char> active_;
+  size_t active_records_ = 0;
+  std::chrono::steady_clock::time_point last_hand_over_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<char> pending_;
+  size_t pending_records_ = 0;
+  bool pending_full_ = false;
+  bool stop_ = false;
+  uint64_t rotate_size_ = 0;
+  std::chrono::seconds rotate_interval_{0};
+  std::string file_name_;
+
+  // used by the writer thread only
+  int fd_ = -1;
+  unsigned file_index_ = 0;
+  uint64_t file_size_ = 0;
+  std::chrono::steady_clock::time_point file_opened_;
+  std::vector<char> compressed_;
+
+  std::thread writer_;
+};
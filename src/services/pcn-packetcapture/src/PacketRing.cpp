@@ -0,0 +1,108 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PacketRing.h"
+
+#include <algorithm>
+
+PacketRing::PacketRing(size_t capacity) : slots_(capacity) {}
+
+void PacketRing::push(const struct timeval &ts, uint32_t packet_len,
+                      const uint8_t *data, uint32_t capture_len) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tail_ - head_ == slots_.size()) {
+      head_++;
+      if (!streaming_)
+        dropped_++;
+    }
+
+    auto &slot = slots_[tail_ % slots_.size()];
+    slot.ts = ts;
+    slot.packet_len = packet_len;
+    slot.data.assign(data, data + capture_len);
+    tail_++;
+  }
+  cv_.notify_all();
+}
+
+bool PacketRing::pop(struct ring_record &record) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (head_ == tail_)
+    return false;
+
+  auto &slot = slots_[head_ % slots_.size()];
+  record.ts = slot.ts;
+  record.packet_len = slot.packet_len;
+  record.data = slot.data;
+  head_++;
+  return true;
+}
+
+uint64_t PacketRing::tail() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tail_;
+}
+
+size_t PacketRing::read(uint64_t &seq, std::vector<struct ring_record> &out,
+                        std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (seq == tail_)
+    cv_.wait_for(lock, timeout);
+
+  // the packets overwritten since the last read are lost for this reader
+  uint64_t oldest = tail_ > slots_.size() ? tail_ - slots_.size() : 0;
+  oldest = std::max(oldest, first_);
+  if (seq < oldest) {
+    dropped_ += oldest - seq;
+    seq = oldest;
+  }
+
+  size_t n = 0;
+  for (; n < out.size() && seq < tail_; n++, seq++) {
+    auto &slot = slots_[seq % slots_.size()];
+    out[n].ts = slot.ts;
+    out[n].packet_len = slot.packet_len;
+    out[n].data.assign(slot.data.begin(), slot.data.end());
+  }
+  return n;
+}
+
+void PacketRing::wakeUp() {
+  cv_.notify_all();
+}
+
+void PacketRing::setCapacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  slots_.clear();
+  slots_.resize(capacity);
+  head_ = first_ = tail_;
+}
+
+size_t PacketRing::getCapacity() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slots_.size();
+}
+
+uint64_t PacketRing::getDropped() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return dropped_;
+}
+
+void PacketRing::setStreaming(bool streaming) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streaming_ = streaming;
+}
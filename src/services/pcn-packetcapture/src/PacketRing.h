@@ -0,0 +1,84 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sys/time.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+struct ring_record {
+  struct timeval ts;
+  uint32_t packet_len;
+  std::vector<uint8_t> data;
+};
+
+/*
+ * Bounded queue of the packets captured in network mode.
+ * When the ring is full the oldest packet is overwritten, so the capture
+ * never waits for the readers and the memory used is bounded.
+ * The packets are read by the REST API, which consumes them, and by the
+ * stream clients, each one following the ring with its own cursor: a
+ * client that falls behind by more than the capacity skips the overwritten
+ * packets.
+ * The slots are reused, their buffers are not reallocated once they have
+ * grown to the size of the captured packets.
+ */
+class PacketRing {
+ public:
+  explicit PacketRing(size_t capacity);
+
+  void push(const struct timeval &ts, uint32_t packet_len, const uint8_t *data,
+            uint32_t capture_len);
+
+  // removes the oldest unread packet, returns false if there is none
+  bool pop(struct ring_record &record);
+
+  // sequence number of the next packet pushed, where a stream starts
+  uint64_t tail();
+
+  // copies in out, up to its size, the packets from seq on, waiting up to
+  // timeout for the first one, and advances seq; returns the number of
+  // packets copied
+  size_t read(uint64_t &seq, std::vector<struct ring_record> &out,
+              std::chrono::milliseconds timeout);
+
+  // wakes up the readers waiting in read()
+  void wakeUp();
+
+  // the packets in the ring are discarded
+  void setCapacity(size_t capacity);
+  size_t getCapacity();
+
+  uint64_t getDropped();
+  void setStreaming(bool streaming);
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<struct ring_record> slots_;
+  uint64_t head_ = 0;  // next packet for pop()
+  uint64_t tail_ = 0;  // next packet pushed
+  uint64_t first_ = 0; // first packet pushed after the last resize
+  uint64_t dropped_ = 0;
+  // the packets not popped are not counted as dropped while a stream is
+  // reading them
+  bool streaming_ = false;
+};
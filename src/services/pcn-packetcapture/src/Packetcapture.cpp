@@ -28,18 +28,26 @@
 #include "Packetcapture_dp_egress.h"
 #define BILLION 1000000000
 
-typedef u_int bpf_u_int32;
-
-struct pcap_pt{
-    bpf_u_int32 ts_sec;
-    bpf_u_int32 ts_usec;
-    bpf_u_int32 len;
-    bpf_u_int32 caplen;
-};
+/* size in pages of the capture buffer of each cpu */
+#define CAPTURE_BUFFER_PAGES 256
+/* ms */
+#define CAPTURE_POLL_TIMEOUT 100
+/* packets, replaced by the ring-size of the configuration */
+#define DEFAULT_RING_SIZE 16384
+
+/* definitions copied from datapath */
+struct capture_hdr {
+  uint64_t timestamp;
+  uint32_t packet_len;
+  uint32_t capture_len;
+  uint8_t epoch;
+} __attribute__((packed));
 
 Packetcapture::Packetcapture(const std::string name, const PacketcaptureJsonObject &conf)
   : TransparentCube(conf.getBase(), { packetcapture_code_ingress }, { packetcapture_code_egress }),
-    PacketcaptureBase(name) {
+    PacketcaptureBase(name), capturing(false), ring(DEFAULT_RING_SIZE),
+    captured_packets(0),
+    dropped_kernel(0), dropped_writer(0) {
 
   /*
    * The timestamp of the packet is acquired in the fast path using:
@@ -89,12 +97,57 @@ Packetcapture::Packetcapture(const std::string name, const PacketcaptureJsonObje
 
   setNetworkmode(conf.getNetworkmode());
 
+  if (conf.formatIsSet()) {
+    setFormat(conf.getFormat());
+  }
+
+  if (conf.compressionIsSet()) {
+    setCompression(conf.getCompression());
+  }
+
+  if (conf.ringSizeIsSet()) {
+    setRingSize(conf.getRingSize());
+  }
+
+  if (conf.rotateSizeIsSet()) {
+    setRotateSize(conf.getRotateSize());
+  }
+
+  if (conf.rotateIntervalIsSet()) {
+    setRotateInterval(conf.getRotateInterval());
+  }
+
   CapStatus = (uint8_t) conf.getCapture();
   updateFilter();
   cubeType = BaseCube::get_type();
   bootstrap = false;
-  writeHeader = true;
   dt = "";
+
+  /*
+   * The datapath sends the captured packets, already truncated to snaplen,
+   * through a perf buffer per direction instead of the controller channel.
+   * Both are read by a dedicated thread.
+   */
+  for (auto type : {ProgramType::INGRESS, ProgramType::EGRESS}) {
+    Direction direction = type == ProgramType::INGRESS ? Direction::INGRESS
+                                                       : Direction::EGRESS;
+    capture_buffers.push_back(get_perf_buffer("capture_buffer",
+        [this, direction](void *data, int size) {
+          handleRecord(direction, data, size);
+        },
+        [this](uint64_t lost) { dropped_kernel += lost; },
+        CAPTURE_BUFFER_PAGES, 0, type));
+  }
+  capturing = true;
+  capture_thread = std::thread(&Packetcapture::captureLoop, this);
+
+  if (conf.streamAddressIsSet()) {
+    stream_address = conf.getStreamAddress();
+  }
+  if (conf.streamPortIsSet()) {
+    stream_port = conf.getStreamPort();
+  }
+  updateStream();
 }
 
 std::string Packetcapture::replaceAll(std::string str, const std::string &from, const std::string &to) {
@@ -108,12 +161,7 @@ std::string Packetcapture::replaceAll(std::string str, const std::string &from,
     return str;
 }
 
-void Packetcapture::writeDump(const std::vector<uint8_t> &packet){
-
-  PacketJsonObject pj;
-  auto p = std::shared_ptr<Packet>(new Packet(*this, pj));
-  std::streamsize len;
-
+std::string Packetcapture::dumpBaseName() {
   if (dt == "") {
     time_t now = time(0);
     tm *ltm = localtime(&now);
@@ -145,101 +193,169 @@ void Packetcapture::writeDump(const std::vector<uint8_t> &packet){
   }
 
   if (dumpFlag == true) {
-    if (writeHeader == true) {
-      myFile.open(temp_folder + ".pcap", std::ios::binary | std::ios::trunc);
-    } else {
-      myFile.open(temp_folder + ".pcap", std::ios::binary | std::ios::app);
+    return temp_folder;
+  }
+  return temp_folder + "capture_" + dt + "_" + random_number;
+}
+
+std::vector<char> Packetcapture::pcapFileHeader() {
+  struct pcap_file_header pcap_header;
+  pcap_header.magic = global_header->getMagic();
+  pcap_header.version_major = global_header->getVersionMajor();
+  pcap_header.version_minor = global_header->getVersionMinor();
+  pcap_header.thiszone = global_header->getThiszone();   //timestamp are always in GMT
+  pcap_header.sigfigs = global_header->getSigfigs();
+  pcap_header.snaplen = getSnaplen();
+  pcap_header.linktype = global_header->getLinktype();
+
+  auto h = reinterpret_cast<const char *>(&pcap_header);
+  return std::vector<char>(h, h + sizeof(pcap_header));
+}
+
+std::unique_ptr<CaptureWriter> Packetcapture::createWriter() {
+  std::vector<char> header;
+  std::string extension;
+
+  if (dump_format == PacketcaptureFormatEnum::PCAPNG) {
+    /* interface 0 describes the ingress direction, interface 1 the egress */
+    std::string if_name = attach_point.empty() ? get_name() : attach_point;
+    header = Pcapng::fileHeader(global_header->getLinktype(), getSnaplen(),
+                                {{if_name, get_name() + " ingress"},
+                                 {if_name, get_name() + " egress"}});
+    extension = "pcapng";
+  } else {
+    header = pcapFileHeader();
+    extension = "pcap";
+  }
+
+  /* called by the writer thread for the records it could not write */
+  auto error = [this](size_t records, const std::string &what) {
+    dropped_writer += records;
+    logger()->error("{0}, {1} records dropped", what, records);
+  };
+
+  return std::unique_ptr<CaptureWriter>(new CaptureWriter(
+      dumpBaseName(), extension, header, compression, error));
+}
+
+void Packetcapture::writeDump(Direction direction, uint64_t timestamp,
+                              uint32_t packet_len, const uint8_t *data,
+                              uint32_t capture_len) {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+
+  if (!writer) {
+    if (dump_failed) {
+      dropped_writer++;
+      return;
     }
+
+    try {
+      writer = createWriter();
+    } catch (const std::exception &e) {
+      /* the dump is retried after the next change of the dump file */
+      logger()->error("{0}", e.what());
+      dump_failed = true;
+      dropped_writer++;
+      return;
+    }
+    writer->setRotation((uint64_t) rotate_size << 20, rotate_interval);
+  }
+
+  bool written;
+  if (dump_format == PacketcaptureFormatEnum::PCAPNG) {
+    bool ingress = direction == Direction::INGRESS;
+    struct Pcapng::epb_hdr pkt_hdr;
+    char trailer[Pcapng::EPB_TRAILER_MAX];
+    size_t trailer_len = Pcapng::enhancedPacket(ingress ? 0 : 1, timestamp,
+        capture_len, packet_len,
+        ingress ? Pcapng::FLAG_INBOUND : Pcapng::FLAG_OUTBOUND,
+        &pkt_hdr, trailer);
+
+    struct iovec iov[3] = {{&pkt_hdr, sizeof(pkt_hdr)},
+                           {(void *) data, capture_len},
+                           {trailer, trailer_len}};
+    written = writer->write(iov, 3);
   } else {
-    myFile.open(temp_folder + "capture_" + dt + "_" + random_number + ".pcap", std::ios::binary | std::ios::app);
+    struct pcap_record_hdr pkt_hdr;
+    pkt_hdr.ts_sec = (uint32_t) (timestamp / BILLION);
+    pkt_hdr.ts_usec = (uint32_t) (timestamp % BILLION / 1000);
+    pkt_hdr.caplen = capture_len;
+    pkt_hdr.len = packet_len;
+
+    struct iovec iov[2] = {{&pkt_hdr, sizeof(pkt_hdr)},
+                           {(void *) data, capture_len}};
+    written = writer->write(iov, 2);
+  }
+
+  if (!written) {
+    dropped_writer++;
   }
+}
 
-  if (writeHeader == true) {
-    struct pcap_file_header *pcap_header = new struct pcap_file_header;
-    pcap_header->magic = global_header->getMagic();
-    pcap_header->version_major = global_header->getVersionMajor();
-    pcap_header->version_minor = global_header->getVersionMinor();
-    pcap_header->thiszone = global_header->getThiszone();   //timestamp are always in GMT
-    pcap_header->sigfigs = global_header->getSigfigs();
-    pcap_header->snaplen = getSnaplen();
-    pcap_header->linktype = global_header->getLinktype();
+void Packetcapture::captureLoop() {
+  while (capturing) {
+    // a single wait on the readers of both buffers, so that records of a
+    // direction are not delayed by the timeout of the other one
+    polycube::service::PerfBuffer::poll(capture_buffers, CAPTURE_POLL_TIMEOUT);
 
-    myFile.write(reinterpret_cast<const char*>(pcap_header), sizeof(*pcap_header));
-    writeHeader = false;
+    std::lock_guard<std::mutex> guard(writer_mutex);
+    if (writer) {
+      writer->flushStale();
+    }
+  }
+}
+
+void Packetcapture::handleRecord(Direction direction, void *data, int size) {
+  auto hdr = static_cast<const struct capture_hdr *>(data);
+  if (size < (int) sizeof(*hdr) ||
+      hdr->capture_len > size - sizeof(*hdr)) {
+    logger()->debug("Malformed capture record of {0} bytes", size);
+    return;
   }
+  auto packet = static_cast<const uint8_t *>(data) + sizeof(*hdr);
 
-  struct timeval tp;
-  if (ts) {
+  /* nanoseconds since epoch */
+  std::chrono::nanoseconds timestamp(hdr->timestamp);
+  if (!hdr->epoch) {
       /*
        * Here the packet capture time offset must be added to the system boot time stored in epoch format.
-       * See line 64 of this file to see system boot time stored in epoch algorithm
+       * See the constructor to see system boot time stored in epoch algorithm
        */
-      std::chrono::system_clock::duration tp_dur = (timeP + temp_offset).time_since_epoch();
-      to_timeval(tp_dur, tp);
-  } else {
-      to_timeval(temp_offset, tp);
+      timestamp += std::chrono::duration_cast<std::chrono::nanoseconds>(
+          timeP.time_since_epoch());
   }
 
-  p->setTimestampSeconds((uint32_t) tp.tv_sec);
-  p->setTimestampMicroseconds((uint32_t) tp.tv_usec);
-  p->setPacketlen((uint32_t) packet.size());
-  if (p->getPacketlen() > getSnaplen()) {
-    p->setCapturelen(getSnaplen());
+  captured_packets++;
+  if (network_mode_flag) {
+    struct timeval tp;
+    std::chrono::system_clock::duration tp_dur =
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(timestamp);
+    to_timeval(tp_dur, tp);
+    addPacket(tp, hdr->packet_len, packet, hdr->capture_len);    /* store the packet in the FIFO queue*/
   } else {
-    p->setCapturelen(p->getPacketlen());
+    writeDump(direction, timestamp.count(), hdr->packet_len, packet,
+              hdr->capture_len);
   }
-  p->setRawPacketData(packet);
-
-  struct pcap_pt *pkt_hdr = new struct pcap_pt;
-  pkt_hdr->ts_sec = p->getTimestampSeconds();
-  pkt_hdr->ts_usec = p->getTimestampMicroseconds();
-  pkt_hdr->len = p->getPacketlen();
-  pkt_hdr->caplen = p->getCapturelen();
-  getSnaplen() < p->getRawPacketData().size() ? len = getSnaplen() : len = p->getRawPacketData().size();
-
-  myFile.write(reinterpret_cast<const char*>(pkt_hdr), sizeof(*pkt_hdr));
-  myFile.write(reinterpret_cast<const char*>(&p->getRawPacketData()[0]), len );
-  myFile.close();
 }
 
 Packetcapture::~Packetcapture() {
   logger()->info("Destroying Packetcapture instance");
+  stream.reset();
+  capturing = false;
+  if (capture_thread.joinable()) {
+    capture_thread.join();
+  }
+  capture_buffers.clear();
+
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  writer.reset();
 }
 
 void Packetcapture::packet_in(polycube::service::Direction direction,
     polycube::service::PacketInMetadata &md,
     const std::vector<uint8_t> &packet) {
 
-  Tins::EthernetII pkt(&packet[0], packet.size());
-  uint64_t t;
-  ts = false;
-
-  switch (direction) {
-    case polycube::service::Direction::INGRESS:
-    t = (((uint64_t) (md.metadata[1]) << 32) | (uint64_t) md.metadata[0]);
-    if (md.metadata[2] == 0) {
-        ts = true;
-    }
-    temp_offset = std::chrono::nanoseconds(t);
-    if (getNetworkmode() == true) {
-      addPacket(packet);    /* store the packet in the FIFO queue*/
-    } else {
-      writeDump(packet);
-    }
-    break;
-    case polycube::service::Direction::EGRESS:
-    t = (((uint64_t) (md.metadata[1]) << 32) | (uint64_t) md.metadata[0]);
-    if (md.metadata[2] == 0) {
-        ts = true;
-    }
-    temp_offset = std::chrono::nanoseconds(t);
-    if (getNetworkmode() == true) {
-      addPacket(packet);    /* store the packet in the FIFO queue*/
-    } else {
-      writeDump(packet);
-    }
-    break;
-  }
+  /* packets are captured through the capture buffers, see captureLoop() */
 }
 
 PacketcaptureCaptureEnum Packetcapture::getCapture() {
@@ -276,25 +392,29 @@ std::string Packetcapture::getDump() {
 
   if (network_mode_flag) {
     dump << "the service is running in network mode";
-  } else if (temp_folder != "" || dumpFlag == true) {
-      char *cwdr_ptr = get_current_dir_name();
-      std::string wdr(cwdr_ptr);
-      if (dumpFlag == true) {
-        dump << "capture dump in " << temp_folder + ".pcap" << std::endl;
-      } else {
-        dump << "capture dump in " << temp_folder << "capture_" + dt + "_" + random_number + ".pcap" << std::endl;
-      }
   } else {
-    dump << "no packets captured";
+    std::lock_guard<std::mutex> guard(writer_mutex);
+    if (writer) {
+      dump << "capture dump in " << writer->getFileName() << std::endl;
+    } else if (dumpFlag == true) {
+      dump << "capture dump in " << temp_folder
+           << (dump_format == PacketcaptureFormatEnum::PCAPNG ? ".pcapng" : ".pcap")
+           << (compression ? ".gz" : "") << std::endl;
+    } else {
+      dump << "no packets captured";
+    }
   }
 
   return dump.str();
 }
 
 void Packetcapture::setDump(const std::string &value) {
+    std::lock_guard<std::mutex> guard(writer_mutex);
     dumpFlag = true;
     temp_folder = value;
-    writeHeader = true;
+    dt = "";
+    dump_failed = false;
+    writer.reset();
 }
 
 bool Packetcapture::getNetworkmode() {
@@ -305,48 +425,26 @@ void Packetcapture::setNetworkmode(const bool &value) {
   network_mode_flag = value;
 }
 
-/* return the first packet in the queue if exist */
+/* return the oldest packet in the ring if exist */
 std::shared_ptr<Packet> Packetcapture::getPacket() {
-  if (packets_captured.size() != 0) {
-    auto p = packets_captured.front();
-    if (network_mode_flag) {                            /* pop this element */
-      packets_captured.erase(packets_captured.begin());
-      if (getSnaplen() < p->getPacketlen()) {
-        p->packet.resize(getSnaplen());
-      }
-    }
-    return p;
-  }
   PacketJsonObject pj;
   auto p = std::shared_ptr<Packet>(new Packet(*this, pj));
+
+  struct ring_record record;
+  if (ring.pop(record)) {
+    p->setTimestampSeconds((uint32_t) record.ts.tv_sec);
+    p->setTimestampMicroseconds((uint32_t) record.ts.tv_usec);
+    p->setPacketlen(record.packet_len);
+    p->setCapturelen(record.data.size());
+    p->setRawPacketData(record.data);
+  }
   return p;
 }
 
-void Packetcapture::addPacket(const std::vector<uint8_t> &packet) {
-    PacketJsonObject pj;
-    auto p = std::shared_ptr<Packet>(new Packet(*this, pj));
-
-    struct timeval tp;
-    if (ts) {
-        /*
-         * Here the packet capture time offset must be added to the system boot time stored in epoch format.
-         * See line 64 of this file to see system boot time stored in epoch algorithm
-         */
-        std::chrono::system_clock::duration tp_dur = (timeP + temp_offset).time_since_epoch();
-        to_timeval(tp_dur, tp);
-    } else {
-        to_timeval(temp_offset, tp);
-    }
-    p->setTimestampSeconds((uint32_t) tp.tv_sec);
-    p->setTimestampMicroseconds((uint32_t) tp.tv_usec);
-    p->setPacketlen((uint32_t) packet.size());
-    if (p->getPacketlen() > getSnaplen()) {
-      p->setCapturelen(getSnaplen());
-    } else {
-      p->setCapturelen(p->getPacketlen());
-    }
-    p->setRawPacketData(packet);
-    packets_captured.push_back(p);
+void Packetcapture::addPacket(const struct timeval &tv, uint32_t packet_len,
+                              const uint8_t *data, uint32_t capture_len) {
+  /* when the ring is full the oldest packet is dropped */
+  ring.push(tv, packet_len, data, capture_len);
 }
 
 void Packetcapture::addPacket(const PacketJsonObject &value) {
@@ -362,7 +460,15 @@ void Packetcapture::delPacket() {
 }
 
 void Packetcapture::attach() {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  try {
+    attach_point = get_parent_parameter("peer");
+  } catch (const std::exception &e) {
+    attach_point = "";
+  }
   dt = std::string("");
+  dump_failed = false;
+  writer.reset();
   logger()->debug("{0} attached", this->get_name());
 }
 
@@ -370,8 +476,9 @@ void Packetcapture::updateFilter() {
     if (bootstrap)
         filterCode = "return RX_OK;"; // Default filter captures no packets (the eBPF datapath simply returns ok)
 
-    std::string codeINGRESS = replaceAll(packetcapture_code_ingress, "//CUSTOM_FILTER_CODE", filterCode);
-    std::string codeEGRESS = replaceAll(packetcapture_code_egress, "//CUSTOM_FILTER_CODE", filterCode);
+    std::string snaplen = "#define CAPTURE_SNAPLEN " + std::to_string(getSnaplen()) + "\n";
+    std::string codeINGRESS = snaplen + replaceAll(packetcapture_code_ingress, "//CUSTOM_FILTER_CODE", filterCode);
+    std::string codeEGRESS = snaplen + replaceAll(packetcapture_code_egress, "//CUSTOM_FILTER_CODE", filterCode);
 
     if (CapStatus == 3 || CapStatus == 2) {
       reload(codeINGRESS,0,ProgramType::INGRESS);
@@ -413,16 +520,7 @@ void Packetcapture::to_timeval(std::chrono::system_clock::duration& d, struct ti
 void Packetcapture::setFilter(const std::string &value) {
     logger()->info("Inserted filter: {0}", value);
     if (value == "all") {
-        if (cubeType == polycube::CubeType::TC) {
-            filterCode = "if (ctx->tstamp == 0) {\n\tpkt_timestamp = bpf_ktime_get_ns();\n\tmdata[0] = *(&pkt_timestamp);\n\t"
-                         "mdata[1] = (*(&pkt_timestamp)) >> 32;\n\tmdata[2] = 0;\n} else {\n\tmdata[0] = *(&ctx->tstamp);\n\t"
-                         "mdata[1] = (*(&ctx->tstamp)) >> 32;\n\tmdata[2] = 1;\n}\npcn_pkt_controller_with_metadata(ctx, md, reason, mdata);\n"
-                         "return RX_OK;";
-        } else { /* CubeType::XDP_DRV or CubeType::XDP_SKB */
-            filterCode = "pkt_timestamp = bpf_ktime_get_ns();\nmdata[0] = *(&pkt_timestamp);\n"
-                         "mdata[1] = (*(&pkt_timestamp)) >> 32;\nmdata[2] = 0;\npcn_pkt_controller_with_metadata(ctx, md, reason, mdata);\n"
-                         "return RX_OK;";
-        }
+        filterCode = "capture_packet(ctx);\nreturn RX_OK;";
     } else {
         memset(&cbpf, 0, sizeof(cbpf));
         filterCompile(value, &cbpf);
@@ -441,6 +539,145 @@ uint32_t Packetcapture::getSnaplen() {
 
 void Packetcapture::setSnaplen(const uint32_t &value) {
     global_header->setSnaplen(value);
+    if (!bootstrap) {
+        /* the packets are truncated in the datapath */
+        updateFilter();
+    }
+}
+
+PacketcaptureFormatEnum Packetcapture::getFormat() {
+  return dump_format;
+}
+
+void Packetcapture::setFormat(const PacketcaptureFormatEnum &value) {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  if (dump_format == value) {
+    return;
+  }
+  /* the next packet starts a new file in the new format */
+  dump_format = value;
+  dt = "";
+  dump_failed = false;
+  writer.reset();
+}
+
+bool Packetcapture::getCompression() {
+  return compression;
+}
+
+void Packetcapture::setCompression(const bool &value) {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  if (compression == value) {
+    return;
+  }
+  compression = value;
+  dt = "";
+  dump_failed = false;
+  writer.reset();
+}
+
+uint32_t Packetcapture::getRingSize() {
+  return ring.getCapacity();
+}
+
+void Packetcapture::setRingSize(const uint32_t &value) {
+  if (value == 0) {
+    throw std::runtime_error("The ring size must be greater than 0");
+  }
+  if (value != ring.getCapacity()) {
+    ring.setCapacity(value);
+  }
+}
+
+std::string Packetcapture::getStreamAddress() {
+  return stream_address;
+}
+
+void Packetcapture::setStreamAddress(const std::string &value) {
+  if (value == stream_address) {
+    return;
+  }
+  std::string old = stream_address;
+  stream_address = value;
+  try {
+    updateStream();
+  } catch (const std::exception &e) {
+    stream_address = old;
+    updateStream();
+    throw;
+  }
+}
+
+uint16_t Packetcapture::getStreamPort() {
+  return stream_port;
+}
+
+void Packetcapture::setStreamPort(const uint16_t &value) {
+  if (value == stream_port) {
+    return;
+  }
+  uint16_t old = stream_port;
+  stream_port = value;
+  try {
+    updateStream();
+  } catch (const std::exception &e) {
+    stream_port = old;
+    updateStream();
+    throw;
+  }
+}
+
+/* (re)starts the streaming endpoint on the configured address */
+void Packetcapture::updateStream() {
+  stream.reset();
+  if (stream_port == 0) {
+    return;
+  }
+
+  stream.reset(new CaptureStream(ring, stream_address, stream_port,
+                                 [this]() { return pcapFileHeader(); }));
+  logger()->info("Streaming the capture on {0}:{1}", stream_address,
+                 stream_port);
+}
+
+uint32_t Packetcapture::getRotateSize() {
+  return rotate_size;
+}
+
+void Packetcapture::setRotateSize(const uint32_t &value) {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  rotate_size = value;
+  if (writer) {
+    writer->setRotation((uint64_t) rotate_size << 20, rotate_interval);
+  }
+}
+
+uint32_t Packetcapture::getRotateInterval() {
+  return rotate_interval;
+}
+
+void Packetcapture::setRotateInterval(const uint32_t &value) {
+  std::lock_guard<std::mutex> guard(writer_mutex);
+  rotate_interval = value;
+  if (writer) {
+    writer->setRotation((uint64_t) rotate_size << 20, rotate_interval);
+  }
+}
+
+uint64_t Packetcapture::getCapturedPackets() {
+  return captured_packets;
+}
+
+uint64_t Packetcapture::getDroppedKernel() {
+  return dropped_kernel;
+}
+
+uint64_t Packetcapture::getDroppedNetwork() {
+  return ring.getDropped();
+}
+
+uint64_t Packetcapture::getDroppedWriter() {
+  return dropped_writer;
 }
 
 void Packetcapture::filterCompile(std::string str, struct sock_fprog * cbpf) {
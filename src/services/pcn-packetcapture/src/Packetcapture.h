@@ -20,9 +20,17 @@
 #include <list>
 #include <fstream>
 #include <chrono>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "../base/PacketcaptureBase.h"
 #include "Packet.h"
 #include "Globalheader.h"
+#include "CaptureWriter.h"
+#include "Pcapng.h"
+#include "PacketRing.h"
+#include "CaptureStream.h"
 #include <tins/ethernetII.h>
 #include <tins/tins.h>
 #include <linux/filter.h>
@@ -34,28 +42,60 @@ using polycube::service::Direction;
 class Packetcapture : public PacketcaptureBase {
 
  std::shared_ptr<Globalheader> global_header;
- std::list<std::shared_ptr<Packet>> packets_captured;
  uint8_t CapStatus;
  bool network_mode_flag;
- bool writeHeader;
- std::ofstream myFile;
  std::string dt;
  std::string temp_folder;
  std::string random_number;
  std::chrono::system_clock::time_point timeP;
- std::chrono::nanoseconds temp_offset;
  std::string filter;
  bool bootstrap = true; /* variable used to set default filter when the service is created */
  bool dumpFlag = false; /* variable used to know if the user set a custom dump folder */
- bool ts = false;  /* true when service not TC type or sk_buff->tstamp == 0 see line 412 in cbpf2c.cpp */
  polycube::service::CubeType cubeType;
 
 private:
     struct sock_fprog cbpf;
     std::string filterCode;
 
+    /* capture records are read from the perf buffers by the capture thread */
+    std::vector<polycube::service::PerfBuffer> capture_buffers;
+    std::thread capture_thread;
+    std::atomic<bool> capturing;
+
+    /* the writer is created with the first packet dumped after an attach or
+     * a change of the dump file */
+    std::mutex writer_mutex;
+    std::unique_ptr<CaptureWriter> writer;
+    bool dump_failed = false;
+    PacketcaptureFormatEnum dump_format = PacketcaptureFormatEnum::PCAP;
+    bool compression = false;
+    /* interface the cube is attached to, named in the pcapng file */
+    std::string attach_point;
+    uint32_t rotate_size = 0;
+    uint32_t rotate_interval = 0;
+
+    /* packets captured in network mode, read through the API or streamed */
+    PacketRing ring;
+    std::string stream_address = "127.0.0.1";
+    uint16_t stream_port = 0;
+    std::unique_ptr<CaptureStream> stream;
+
+    std::atomic<uint64_t> captured_packets;
+    std::atomic<uint64_t> dropped_kernel;
+    std::atomic<uint64_t> dropped_writer;
+
+    void captureLoop();
+    void handleRecord(Direction direction, void *data, int size);
+    void writeDump(Direction direction, uint64_t timestamp, uint32_t packet_len,
+                   const uint8_t *data, uint32_t capture_len);
+    std::unique_ptr<CaptureWriter> createWriter();
+    std::vector<char> pcapFileHeader();
+    void updateStream();
+    std::string dumpBaseName();
+
 public:
- void addPacket(const std::vector<uint8_t> &packet);
+ void addPacket(const struct timeval &tv, uint32_t packet_len,
+                const uint8_t *data, uint32_t capture_len);
  void to_timeval(std::chrono::system_clock::duration& d, struct timeval& tv);
 
  public:
@@ -119,8 +159,69 @@ public:
   uint32_t getSnaplen() override;
   void setSnaplen(const uint32_t &value) override;
 
+  /// <summary>
+  /// Format of the dump file, PCAPNG records the direction and nanosecond timestamps
+  /// </summary>
+  PacketcaptureFormatEnum getFormat() override;
+  void setFormat(const PacketcaptureFormatEnum &value) override;
+
+  /// <summary>
+  /// Compress the dump file with gzip
+  /// </summary>
+  bool getCompression() override;
+  void setCompression(const bool &value) override;
+
+  /// <summary>
+  /// Number of packets kept in network mode, when full the oldest packet is dropped
+  /// </summary>
+  uint32_t getRingSize() override;
+  void setRingSize(const uint32_t &value) override;
+
+  /// <summary>
+  /// Address of the HTTP endpoint streaming the packets captured in network mode
+  /// </summary>
+  std::string getStreamAddress() override;
+  void setStreamAddress(const std::string &value) override;
+
+  /// <summary>
+  /// TCP port of the HTTP endpoint streaming the packets captured in network mode, 0 disables it
+  /// </summary>
+  uint16_t getStreamPort() override;
+  void setStreamPort(const uint16_t &value) override;
+
+  /// <summary>
+  /// Size in MB of a dump file after which a new file is started, 0 disables the rotation
+  /// </summary>
+  uint32_t getRotateSize() override;
+  void setRotateSize(const uint32_t &value) override;
+
+  /// <summary>
+  /// Time in seconds after which a new dump file is started, 0 disables the rotation
+  /// </summary>
+  uint32_t getRotateInterval() override;
+  void setRotateInterval(const uint32_t &value) override;
+
+  /// <summary>
+  /// Number of packets captured
+  /// </summary>
+  uint64_t getCapturedPackets() override;
+
+  /// <summary>
+  /// Number of packets lost because the kernel buffer was full
+  /// </summary>
+  uint64_t getDroppedKernel() override;
+
+  /// <summary>
+  /// Number of packets dropped because the writer could not keep up
+  /// </summary>
+  uint64_t getDroppedWriter() override;
+
+  /// <summary>
+  /// Number of packets dropped in network mode because they were not read in time
+  /// </summary>
+  uint64_t getDroppedNetwork() override;
+
   void updateFilter();
-  void writeDump(const std::vector<uint8_t> &packet);
 
   void filterCompile(std::string str, struct sock_fprog *cbpf);
 
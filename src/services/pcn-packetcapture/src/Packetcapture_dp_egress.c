@@ -32,15 +32,52 @@
 #include <uapi/linux/tcp.h>
 #include <uapi/linux/udp.h>
 
+#ifndef CAPTURE_SNAPLEN
+#define CAPTURE_SNAPLEN 262144
+#endif
+
+/*
+ * Header of the records sent to the control plane, it is followed by the
+ * first capture_len bytes of the packet. The packet is truncated here, so
+ * only the bytes that are dumped are copied to the buffer.
+ */
+struct capture_hdr {
+  uint64_t timestamp;
+  uint32_t packet_len;
+  uint32_t capture_len;
+  uint8_t epoch;  // 1 if timestamp is since the epoch, 0 if since the boot
+} __attribute__((packed));
+
+BPF_PERF_OUTPUT(capture_buffer);
+
+static __always_inline void capture_packet(struct CTXTYPE *ctx) {
+  struct capture_hdr hdr = {};
+
+#ifdef POLYCUBE_XDP
+  hdr.packet_len = ctx->data_end - ctx->data;
+  hdr.timestamp = bpf_ktime_get_ns();
+#else
+  hdr.packet_len = ctx->len;
+  if (ctx->tstamp == 0) {
+    hdr.timestamp = bpf_ktime_get_ns();
+  } else {
+    hdr.timestamp = ctx->tstamp;
+    hdr.epoch = 1;
+  }
+#endif
+
+  hdr.capture_len = hdr.packet_len;
+  if (hdr.capture_len > CAPTURE_SNAPLEN)
+    hdr.capture_len = CAPTURE_SNAPLEN;
+
+  capture_buffer.perf_submit_skb(ctx, hdr.capture_len, &hdr, sizeof(hdr));
+}
 
 static __always_inline int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
     unsigned int key = 0;
     void *data = (void *)(long)ctx->data;
     void *data_end = (void *)(long)ctx->data_end;
-    u16 reason = 1;
     uint32_t a, x, m[16];
-    u32 mdata[3];
-    uint64_t pkt_timestamp;
 
     //CUSTOM_FILTER_CODE
 
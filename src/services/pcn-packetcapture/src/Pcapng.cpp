@@ -0,0 +1,116 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Pcapng.h"
+
+#include <cstring>
+
+#define SHB_TYPE 0x0A0D0D0A
+#define IDB_TYPE 0x00000001
+#define EPB_TYPE 0x00000006
+#define BYTE_ORDER_MAGIC 0x1A2B3C4D
+
+#define OPT_ENDOFOPT 0
+#define IF_NAME 2
+#define IF_DESCRIPTION 3
+#define IF_TSRESOL 9
+#define EPB_FLAGS 2
+
+#define PAD4(x) (((x) + 3) & ~3)
+
+template <typename T>
+static void append(std::vector<char> &v, const T &value) {
+  const char *p = reinterpret_cast<const char *>(&value);
+  v.insert(v.end(), p, p + sizeof(value));
+}
+
+void Pcapng::addOption(std::vector<char> &block, uint16_t code,
+                       const void *value, uint16_t len) {
+  append(block, code);
+  append(block, len);
+  const char *p = static_cast<const char *>(value);
+  block.insert(block.end(), p, p + len);
+  block.resize(PAD4(block.size()), 0);
+}
+
+/* adds the block type and the total length around the body */
+void Pcapng::addBlock(std::vector<char> &out, uint32_t type,
+                      const std::vector<char> &body) {
+  uint32_t total_len = body.size() + 3 * sizeof(uint32_t);
+  append(out, type);
+  append(out, total_len);
+  out.insert(out.end(), body.begin(), body.end());
+  append(out, total_len);
+}
+
+std::vector<char> Pcapng::fileHeader(uint16_t linktype, uint32_t snaplen,
+                                     const std::vector<Interface> &interfaces) {
+  std::vector<char> out;
+
+  std::vector<char> shb;
+  append(shb, (uint32_t)BYTE_ORDER_MAGIC);
+  append(shb, (uint16_t)1);  // major version
+  append(shb, (uint16_t)0);  // minor version
+  append(shb, (int64_t)-1);  // section length not specified
+  addBlock(out, SHB_TYPE, shb);
+
+  for (auto &i : interfaces) {
+    std::vector<char> idb;
+    append(idb, linktype);
+    append(idb, (uint16_t)0);  // reserved
+    append(idb, snaplen);
+    addOption(idb, IF_NAME, i.name.c_str(), i.name.size());
+    addOption(idb, IF_DESCRIPTION, i.description.c_str(),
+              i.description.size());
+    uint8_t tsresol = 9;  // 10^-9 s
+    addOption(idb, IF_TSRESOL, &tsresol, sizeof(tsresol));
+    addOption(idb, OPT_ENDOFOPT, nullptr, 0);
+    addBlock(out, IDB_TYPE, idb);
+  }
+
+  return out;
+}
+
+size_t Pcapng::enhancedPacket(uint32_t interface_id, uint64_t timestamp,
+                              uint32_t caplen, uint32_t len, uint32_t flags,
+                              struct epb_hdr *hdr, char *trailer) {
+  size_t padding = PAD4(caplen) - caplen;
+  size_t trailer_len = padding;
+  memset(trailer, 0, padding);
+
+  uint16_t opt[2] = {EPB_FLAGS, sizeof(flags)};
+  memcpy(trailer + trailer_len, opt, sizeof(opt));
+  trailer_len += sizeof(opt);
+  memcpy(trailer + trailer_len, &flags, sizeof(flags));
+  trailer_len += sizeof(flags);
+
+  uint16_t end[2] = {OPT_ENDOFOPT, 0};
+  memcpy(trailer + trailer_len, end, sizeof(end));
+  trailer_len += sizeof(end);
+
+  hdr->type = EPB_TYPE;
+  hdr->total_len = sizeof(*hdr) + caplen + trailer_len + sizeof(uint32_t);
+  hdr->interface_id = interface_id;
+  hdr->ts_high = timestamp >> 32;
+  hdr->ts_low = timestamp & 0xffffffff;
+  hdr->caplen = caplen;
+  hdr->len = len;
+
+  memcpy(trailer + trailer_len, &hdr->total_len, sizeof(hdr->total_len));
+  trailer_len += sizeof(hdr->total_len);
+
+  return trailer_len;
+}
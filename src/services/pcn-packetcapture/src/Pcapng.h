@@ -0,0 +1,70 @@
+/*
+ * Copyright 2019 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Blocks of the pcapng format (https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html)
+ * used by the capture dump: a Section Header Block and an Interface
+ * Description Block per capture direction at the beginning of each file,
+ * followed by an Enhanced Packet Block per packet.
+ */
+class Pcapng {
+ public:
+  struct Interface {
+    std::string name;
+    std::string description;
+  };
+
+  /* EPB flags, direction of the packet */
+  static const uint32_t FLAG_INBOUND = 1;
+  static const uint32_t FLAG_OUTBOUND = 2;
+
+  /* fixed part of an Enhanced Packet Block, followed by the packet data */
+  struct epb_hdr {
+    uint32_t type;
+    uint32_t total_len;
+    uint32_t interface_id;
+    uint32_t ts_high;
+    uint32_t ts_low;
+    uint32_t caplen;
+    uint32_t len;
+  };
+
+  /* longest EPB trailer: padding, flags option, end of options and total
+   * length */
+  static const size_t EPB_TRAILER_MAX = 3 + 8 + 4 + 4;
+
+  /* SHB and one IDB per interface, timestamps are in nanoseconds */
+  static std::vector<char> fileHeader(uint16_t linktype, uint32_t snaplen,
+                                      const std::vector<Interface> &interfaces);
+
+  /* fills the EPB header and the trailer that follows the packet data,
+   * returns the length of the trailer */
+  static size_t enhancedPacket(uint32_t interface_id, uint64_t timestamp,
+                               uint32_t caplen, uint32_t len, uint32_t flags,
+                               struct epb_hdr *hdr, char *trailer);
+
+ private:
+  static void addOption(std::vector<char> &block, uint16_t code,
+                        const void *value, uint16_t len);
+  static void addBlock(std::vector<char> &out, uint32_t type,
+                       const std::vector<char> &body);
+};
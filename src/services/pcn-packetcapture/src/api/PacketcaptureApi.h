@@ -40,8 +40,14 @@ Response delete_packetcapture_packet_by_id_handler(const char *name, const Key *
 Response read_packetcapture_anonimize_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_capture_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_captured_packets_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_compression_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_dropped_kernel_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_dropped_network_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_dropped_writer_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_dump_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_filter_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_format_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_globalheader_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_globalheader_linktype_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_globalheader_magic_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -58,15 +64,22 @@ Response read_packetcapture_packet_packetlen_by_id_handler(const char *name, con
 Response read_packetcapture_packet_rawdata_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_packet_timestamp_microseconds_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_packet_timestamp_seconds_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_ring_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_rotate_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_rotate_size_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_packetcapture_snaplen_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_stream_address_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_packetcapture_stream_port_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_packetcapture_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_packetcapture_globalheader_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response replace_packetcapture_packet_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_anonimize_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_capture_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_compression_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_dump_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_filter_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_format_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_globalheader_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_globalheader_linktype_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_globalheader_magic_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
@@ -83,7 +96,12 @@ Response update_packetcapture_packet_packetlen_by_id_handler(const char *name, c
 Response update_packetcapture_packet_rawdata_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_packet_timestamp_microseconds_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_packet_timestamp_seconds_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_ring_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_rotate_interval_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_rotate_size_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_packetcapture_snaplen_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_stream_address_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_packetcapture_stream_port_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response packetcapture_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 
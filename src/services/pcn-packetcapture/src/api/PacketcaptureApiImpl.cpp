@@ -205,6 +205,91 @@ read_packetcapture_capture_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read captured-packets by ID
+*
+* Read operation of resource: captured-packets*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_packetcapture_captured_packets_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getCapturedPackets();
+
+}
+
+/**
+* @brief   Read compression by ID
+*
+* Read operation of resource: compression*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* bool
+*/
+bool
+read_packetcapture_compression_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getCompression();
+
+}
+
+/**
+* @brief   Read dropped-kernel by ID
+*
+* Read operation of resource: dropped-kernel*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_packetcapture_dropped_kernel_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getDroppedKernel();
+
+}
+
+/**
+* @brief   Read dropped-network by ID
+*
+* Read operation of resource: dropped-network*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_packetcapture_dropped_network_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getDroppedNetwork();
+
+}
+
+/**
+* @brief   Read dropped-writer by ID
+*
+* Read operation of resource: dropped-writer*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_packetcapture_dropped_writer_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getDroppedWriter();
+
+}
+
 /**
 * @brief   Read dump by ID
 *
@@ -239,6 +324,23 @@ read_packetcapture_filter_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read format by ID
+*
+* Read operation of resource: format*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* PacketcaptureFormatEnum
+*/
+PacketcaptureFormatEnum
+read_packetcapture_format_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getFormat();
+
+}
+
 /**
 * @brief   Read globalheader by ID
 *
@@ -506,6 +608,57 @@ read_packetcapture_packet_timestamp_seconds_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read ring-size by ID
+*
+* Read operation of resource: ring-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_packetcapture_ring_size_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getRingSize();
+
+}
+
+/**
+* @brief   Read rotate-interval by ID
+*
+* Read operation of resource: rotate-interval*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_packetcapture_rotate_interval_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getRotateInterval();
+
+}
+
+/**
+* @brief   Read rotate-size by ID
+*
+* Read operation of resource: rotate-size*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_packetcapture_rotate_size_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getRotateSize();
+
+}
+
 /**
 * @brief   Read snaplen by ID
 *
@@ -523,6 +676,40 @@ read_packetcapture_snaplen_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read stream-address by ID
+*
+* Read operation of resource: stream-address*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* std::string
+*/
+std::string
+read_packetcapture_stream_address_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getStreamAddress();
+
+}
+
+/**
+* @brief   Read stream-port by ID
+*
+* Read operation of resource: stream-port*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint16_t
+*/
+uint16_t
+read_packetcapture_stream_port_by_id(const std::string &name) {
+  auto packetcapture = get_cube(name);
+  return packetcapture->getStreamPort();
+
+}
+
 /**
 * @brief   Replace globalheader by ID
 *
@@ -613,6 +800,24 @@ update_packetcapture_capture_by_id(const std::string &name, const PacketcaptureC
   return packetcapture->setCapture(value);
 }
 
+/**
+* @brief   Update compression by ID
+*
+* Update operation of resource: compression*
+*
+* @param[in] name ID of name
+* @param[in] value Compress the dump file with gzip
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_compression_by_id(const std::string &name, const bool &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setCompression(value);
+}
+
 /**
 * @brief   Update dump by ID
 *
@@ -649,6 +854,24 @@ update_packetcapture_filter_by_id(const std::string &name, const std::string &va
   return packetcapture->setFilter(value);
 }
 
+/**
+* @brief   Update format by ID
+*
+* Update operation of resource: format*
+*
+* @param[in] name ID of name
+* @param[in] value Format of the dump file, PCAPNG records the direction and nanosecond timestamps
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_format_by_id(const std::string &name, const PacketcaptureFormatEnum &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setFormat(value);
+}
+
 /**
 * @brief   Update globalheader by ID
 *
@@ -948,6 +1171,60 @@ update_packetcapture_packet_timestamp_seconds_by_id(const std::string &name, con
   return packet->setTimestampSeconds(value);
 }
 
+/**
+* @brief   Update ring-size by ID
+*
+* Update operation of resource: ring-size*
+*
+* @param[in] name ID of name
+* @param[in] value Number of packets kept in network mode, when full the oldest packet is dropped
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_ring_size_by_id(const std::string &name, const uint32_t &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setRingSize(value);
+}
+
+/**
+* @brief   Update rotate-interval by ID
+*
+* Update operation of resource: rotate-interval*
+*
+* @param[in] name ID of name
+* @param[in] value Time in seconds after which a new dump file is started, 0 disables the rotation
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_rotate_interval_by_id(const std::string &name, const uint32_t &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setRotateInterval(value);
+}
+
+/**
+* @brief   Update rotate-size by ID
+*
+* Update operation of resource: rotate-size*
+*
+* @param[in] name ID of name
+* @param[in] value Size in MB of a dump file after which a new file is started, 0 disables the rotation
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_rotate_size_by_id(const std::string &name, const uint32_t &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setRotateSize(value);
+}
+
 /**
 * @brief   Update snaplen by ID
 *
@@ -966,6 +1243,42 @@ update_packetcapture_snaplen_by_id(const std::string &name, const uint32_t &valu
   return packetcapture->setSnaplen(value);
 }
 
+/**
+* @brief   Update stream-address by ID
+*
+* Update operation of resource: stream-address*
+*
+* @param[in] name ID of name
+* @param[in] value Address of the HTTP endpoint streaming the packets captured in network mode
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_stream_address_by_id(const std::string &name, const std::string &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setStreamAddress(value);
+}
+
+/**
+* @brief   Update stream-port by ID
+*
+* Update operation of resource: stream-port*
+*
+* @param[in] name ID of name
+* @param[in] value TCP port of the HTTP endpoint streaming the packets captured in network mode, 0 disables it
+*
+* Responses:
+*
+*/
+void
+update_packetcapture_stream_port_by_id(const std::string &name, const uint16_t &value) {
+  auto packetcapture = get_cube(name);
+
+  packetcapture->setStreamPort(value);
+}
+
 
 
 /*
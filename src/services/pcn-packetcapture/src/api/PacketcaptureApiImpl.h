@@ -43,8 +43,14 @@ namespace PacketcaptureApiImpl {
   bool read_packetcapture_anonimize_by_id(const std::string &name);
   PacketcaptureJsonObject read_packetcapture_by_id(const std::string &name);
   PacketcaptureCaptureEnum read_packetcapture_capture_by_id(const std::string &name);
+  uint64_t read_packetcapture_captured_packets_by_id(const std::string &name);
+  bool read_packetcapture_compression_by_id(const std::string &name);
+  uint64_t read_packetcapture_dropped_kernel_by_id(const std::string &name);
+  uint64_t read_packetcapture_dropped_network_by_id(const std::string &name);
+  uint64_t read_packetcapture_dropped_writer_by_id(const std::string &name);
   std::string read_packetcapture_dump_by_id(const std::string &name);
   std::string read_packetcapture_filter_by_id(const std::string &name);
+  PacketcaptureFormatEnum read_packetcapture_format_by_id(const std::string &name);
   GlobalheaderJsonObject read_packetcapture_globalheader_by_id(const std::string &name);
   uint32_t read_packetcapture_globalheader_linktype_by_id(const std::string &name);
   uint32_t read_packetcapture_globalheader_magic_by_id(const std::string &name);
@@ -61,15 +67,22 @@ namespace PacketcaptureApiImpl {
   std::string read_packetcapture_packet_rawdata_by_id(const std::string &name);
   uint32_t read_packetcapture_packet_timestamp_microseconds_by_id(const std::string &name);
   uint32_t read_packetcapture_packet_timestamp_seconds_by_id(const std::string &name);
+  uint32_t read_packetcapture_ring_size_by_id(const std::string &name);
+  uint32_t read_packetcapture_rotate_interval_by_id(const std::string &name);
+  uint32_t read_packetcapture_rotate_size_by_id(const std::string &name);
   uint32_t read_packetcapture_snaplen_by_id(const std::string &name);
+  std::string read_packetcapture_stream_address_by_id(const std::string &name);
+  uint16_t read_packetcapture_stream_port_by_id(const std::string &name);
   void replace_packetcapture_by_id(const std::string &name, const PacketcaptureJsonObject &value);
   void replace_packetcapture_globalheader_by_id(const std::string &name, const GlobalheaderJsonObject &value);
   void replace_packetcapture_packet_by_id(const std::string &name, const PacketJsonObject &value);
   void update_packetcapture_anonimize_by_id(const std::string &name, const bool &value);
   void update_packetcapture_by_id(const std::string &name, const PacketcaptureJsonObject &value);
   void update_packetcapture_capture_by_id(const std::string &name, const PacketcaptureCaptureEnum &value);
+  void update_packetcapture_compression_by_id(const std::string &name, const bool &value);
   void update_packetcapture_dump_by_id(const std::string &name, const std::string &value);
   void update_packetcapture_filter_by_id(const std::string &name, const std::string &value);
+  void update_packetcapture_format_by_id(const std::string &name, const PacketcaptureFormatEnum &value);
   void update_packetcapture_globalheader_by_id(const std::string &name, const GlobalheaderJsonObject &value);
   void update_packetcapture_globalheader_linktype_by_id(const std::string &name, const uint32_t &value);
   void update_packetcapture_globalheader_magic_by_id(const std::string &name, const uint32_t &value);
@@ -86,10 +99,15 @@ namespace PacketcaptureApiImpl {
   void update_packetcapture_packet_rawdata_by_id(const std::string &name, const std::string &value);
   void update_packetcapture_packet_timestamp_microseconds_by_id(const std::string &name, const uint32_t &value);
   void update_packetcapture_packet_timestamp_seconds_by_id(const std::string &name, const uint32_t &value);
+  void update_packetcapture_ring_size_by_id(const std::string &name, const uint32_t &value);
+  void update_packetcapture_rotate_interval_by_id(const std::string &name, const uint32_t &value);
+  void update_packetcapture_rotate_size_by_id(const std::string &name, const uint32_t &value);
   void update_packetcapture_snaplen_by_id(const std::string &name, const uint32_t &value);
 
   /* help related */
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_packetcapture_list_by_id_get_list();
+  void update_packetcapture_stream_address_by_id(const std::string &name, const std::string &value);
+  void update_packetcapture_stream_port_by_id(const std::string &name, const uint16_t &value);
 
 }
 }
@@ -48,6 +48,34 @@ void PacketcaptureBase::update(const PacketcaptureJsonObject &conf) {
     auto m = getPacket();
     m->update(conf.getPacket());
   }
+
+  if (conf.rotateSizeIsSet()) {
+    setRotateSize(conf.getRotateSize());
+  }
+
+  if (conf.rotateIntervalIsSet()) {
+    setRotateInterval(conf.getRotateInterval());
+  }
+
+  if (conf.compressionIsSet()) {
+    setCompression(conf.getCompression());
+  }
+
+  if (conf.formatIsSet()) {
+    setFormat(conf.getFormat());
+  }
+
+  if (conf.ringSizeIsSet()) {
+    setRingSize(conf.getRingSize());
+  }
+
+  if (conf.streamAddressIsSet()) {
+    setStreamAddress(conf.getStreamAddress());
+  }
+
+  if (conf.streamPortIsSet()) {
+    setStreamPort(conf.getStreamPort());
+  }
 }
 
 PacketcaptureJsonObject PacketcaptureBase::toJsonObject() {
@@ -63,6 +91,17 @@ PacketcaptureJsonObject PacketcaptureBase::toJsonObject() {
   conf.setFilter(getFilter());
   conf.setGlobalheader(getGlobalheader()->toJsonObject());
   conf.setPacket(getPacket()->toJsonObject());
+  conf.setRotateSize(getRotateSize());
+  conf.setRotateInterval(getRotateInterval());
+  conf.setCapturedPackets(getCapturedPackets());
+  conf.setDroppedKernel(getDroppedKernel());
+  conf.setDroppedWriter(getDroppedWriter());
+  conf.setCompression(getCompression());
+  conf.setFormat(getFormat());
+  conf.setRingSize(getRingSize());
+  conf.setStreamAddress(getStreamAddress());
+  conf.setStreamPort(getStreamPort());
+  conf.setDroppedNetwork(getDroppedNetwork());
 
   return conf;
 }
@@ -77,6 +77,68 @@ class PacketcaptureBase: public virtual polycube::service::TransparentCube {
   virtual std::string getFilter() = 0;
   virtual void setFilter(const std::string &value) = 0;
 
+  /// <summary>
+  /// Size in MB of a dump file after which a new file is started, 0 disables the rotation
+  /// </summary>
+  virtual uint32_t getRotateSize() = 0;
+  virtual void setRotateSize(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Time in seconds after which a new dump file is started, 0 disables the rotation
+  /// </summary>
+  virtual uint32_t getRotateInterval() = 0;
+  virtual void setRotateInterval(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Number of packets captured
+  /// </summary>
+  virtual uint64_t getCapturedPackets() = 0;
+
+  /// <summary>
+  /// Number of packets lost because the kernel buffer was full
+  /// </summary>
+  virtual uint64_t getDroppedKernel() = 0;
+
+  /// <summary>
+  /// Number of packets dropped because the writer could not keep up
+  /// </summary>
+  virtual uint64_t getDroppedWriter() = 0;
+
+  /// <summary>
+  /// Compress the dump file with gzip
+  /// </summary>
+  virtual bool getCompression() = 0;
+  virtual void setCompression(const bool &value) = 0;
+
+  /// <summary>
+  /// Format of the dump file, PCAPNG records the direction and nanosecond timestamps
+  /// </summary>
+  virtual PacketcaptureFormatEnum getFormat() = 0;
+  virtual void setFormat(const PacketcaptureFormatEnum &value) = 0;
+
+  /// <summary>
+  /// Number of packets kept in network mode, when full the oldest packet is dropped
+  /// </summary>
+  virtual uint32_t getRingSize() = 0;
+  virtual void setRingSize(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Address of the HTTP endpoint streaming the packets captured in network mode
+  /// </summary>
+  virtual std::string getStreamAddress() = 0;
+  virtual void setStreamAddress(const std::string &value) = 0;
+
+  /// <summary>
+  /// TCP port of the HTTP endpoint streaming the packets captured in network mode, 0 disables it
+  /// </summary>
+  virtual uint16_t getStreamPort() = 0;
+  virtual void setStreamPort(const uint16_t &value) = 0;
+
+  /// <summary>
+  /// Number of packets dropped in network mode because they were not read in time
+  /// </summary>
+  virtual uint64_t getDroppedNetwork() = 0;
+
   /// <summary>
   ///
   /// </summary>
@@ -9,6 +9,8 @@
 #include <linux/filter.h>
 #include <map>
 #include <cstring>
+#include <algorithm>
+#include <vector>
 
 #ifndef BPF_MEMWORDS
 # define BPF_MEMWORDS	16
@@ -39,16 +41,462 @@
 #define BPF_MISC_TAX	(BPF_MISC |  BPF_TAX)
 #define BPF_MISC_TXA	(BPF_MISC |  BPF_TXA)
 
+/* largest packet offset the verifier accepts in a direct packet access */
+#define MAX_PACKET_OFF	0xffff
+
 
 std::string cbpf2c::ToC(struct sock_fprog * cbpf, polycube::service::CubeType cubeType) {
     /* First I validate the cBPF code */
     if (cbpf_validate(cbpf) == 0)
         std::cout<<"Not a valid cBPF program!"<<std::endl;
-    std::string ret = bpf_dump_all(cbpf, cubeType);
+
+    std::string ret;
+    if (optimized_ToC(cbpf, cubeType, ret))
+        return ret;
+
+    /* instruction by instruction translation, emulating the cBPF machine */
+    ret = bpf_dump_all(cbpf, cubeType);
     return ret;
 }
 
 
+namespace {
+
+/* value of a register of the cBPF machine, if it is known at translation time */
+struct cbpf_reg {
+    bool known;
+    uint32_t value;
+};
+
+/* registers and packet bytes already bounds checked at the start of a block */
+struct cbpf_state {
+    bool reached;
+    cbpf_reg a, x, m[BPF_MEMWORDS];
+    uint32_t checked;
+};
+
+/* the state at the start of a block is the one common to all its predecessors */
+void cbpf_merge(struct cbpf_state &to, const struct cbpf_state &from) {
+    if (!to.reached) {
+        to = from;
+        return;
+    }
+
+    auto meet = [](struct cbpf_reg &r, const struct cbpf_reg &other) {
+        if (!other.known || r.value != other.value)
+            r.known = false;
+    };
+    meet(to.a, from.a);
+    meet(to.x, from.x);
+    for (int i = 0; i < BPF_MEMWORDS; i++)
+        meet(to.m[i], from.m[i]);
+    to.checked = std::min(to.checked, from.checked);
+}
+
+bool cbpf_alu_fold(uint16_t op, uint32_t a, uint32_t v, uint32_t &res) {
+    switch (op) {
+    case BPF_ADD: res = a + v; return true;
+    case BPF_SUB: res = a - v; return true;
+    case BPF_MUL: res = a * v; return true;
+    case BPF_DIV: if (v == 0) return false; res = a / v; return true;
+    case BPF_MOD: if (v == 0) return false; res = a % v; return true;
+    case BPF_AND: res = a & v; return true;
+    case BPF_OR:  res = a | v; return true;
+    case BPF_XOR: res = a ^ v; return true;
+    case BPF_LSH: if (v >= 32) return false; res = a << v; return true;
+    case BPF_RSH: if (v >= 32) return false; res = a >> v; return true;
+    case BPF_NEG: res = -a; return true;
+    }
+    return false;
+}
+
+const char *cbpf_alu_op(uint16_t op) {
+    switch (op) {
+    case BPF_ADD: return "+";
+    case BPF_SUB: return "-";
+    case BPF_MUL: return "*";
+    case BPF_DIV: return "/";
+    case BPF_MOD: return "%";
+    case BPF_AND: return "&";
+    case BPF_OR:  return "|";
+    case BPF_XOR: return "^";
+    case BPF_LSH: return "<<";
+    default:      return ">>";
+    }
+}
+
+bool cbpf_jump_fold(uint16_t op, uint32_t a, uint32_t v) {
+    switch (op) {
+    case BPF_JEQ: return a == v;
+    case BPF_JGT: return a > v;
+    case BPF_JGE: return a >= v;
+    default:      return (a & v) != 0;
+    }
+}
+
+const char *cbpf_jump_op(uint16_t op) {
+    switch (op) {
+    case BPF_JEQ: return "==";
+    case BPF_JGT: return ">";
+    case BPF_JGE: return ">=";
+    default:      return "&";
+    }
+}
+
+uint32_t cbpf_load_size(uint16_t code) {
+    switch (BPF_SIZE(code)) {
+    case BPF_B: return 1;
+    case BPF_H: return 2;
+    default:    return 4;
+    }
+}
+
+/* C expression reading size bytes of the packet at the given offset */
+std::string cbpf_load(uint32_t size, const std::string &offset) {
+    switch (size) {
+    case 1:  return "*(uint8_t *)(data + " + offset + ")";
+    case 2:  return "ntohs(*(uint16_t *)(data + " + offset + "))";
+    default: return "ntohl(*(uint32_t *)(data + " + offset + "))";
+    }
+}
+
+std::string cbpf_hex(uint32_t v) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "0x%x", v);
+    return buf;
+}
+
+/* code of a block, the jump at its end is added when the blocks are laid out */
+struct cbpf_block {
+    int start;
+    bool reached;
+    uint32_t check;     // packet length checked at the start of the block, 0 if none
+    std::string body;
+    enum { END, GOTO, COND } exit;
+    std::string cond;
+    int jt, jf;
+};
+
+} // namespace
+
+
+bool cbpf2c::optimized_ToC(const struct sock_fprog *bpf, polycube::service::CubeType cubeType, std::string &code) {
+    const struct sock_filter *insn = bpf->filter;
+    int len = bpf->len;
+
+    /* blocks start at the beginning, at the jump targets and after the jumps */
+    std::vector<bool> leader(len + 1, false);
+    leader[0] = true;
+    for (int i = 0; i < len; i++) {
+        uint16_t c = insn[i].code;
+        switch (BPF_CLASS(c)) {
+        case BPF_LD:
+        case BPF_LDX:
+            /* negative offsets select ancillary data or the link/network layer */
+            if ((BPF_MODE(c) == BPF_ABS || BPF_MODE(c) == BPF_IND) && (int32_t) insn[i].k < 0)
+                return false;
+            break;
+        case BPF_JMP:
+            if (BPF_OP(c) == BPF_JA) {
+                leader[i + 1 + insn[i].k] = true;
+            } else {
+                leader[i + 1 + insn[i].jt] = true;
+                leader[i + 1 + insn[i].jf] = true;
+            }
+            leader[i + 1] = true;
+            break;
+        case BPF_RET:
+            leader[i + 1] = true;
+            break;
+        }
+    }
+
+    std::vector<struct cbpf_block> blocks;
+    std::vector<int> block_of(len, -1);
+    for (int i = 0; i < len; i++) {
+        if (leader[i]) {
+            struct cbpf_block b = {};
+            b.start = i;
+            blocks.push_back(b);
+        }
+        block_of[i] = blocks.size() - 1;
+    }
+
+    /*
+     * Jumps only go forward, so the blocks are visited in order and the state
+     * at the start of each block is complete when the block is reached.
+     */
+    std::vector<struct cbpf_state> in(blocks.size());
+    for (auto &st : in)
+        st = {};
+    in[0].reached = true;
+    in[0].a = {true, 0};
+    in[0].x = {true, 0};
+
+    int checks = 0;
+    for (size_t bi = 0; bi < blocks.size(); bi++) {
+        struct cbpf_block &b = blocks[bi];
+        if (!in[bi].reached)
+            continue;
+        b.reached = true;
+
+        struct cbpf_state st = in[bi];
+        uint32_t need = 0;  // bytes read at fixed offsets in the block
+        bool fails = false; // the block always ends with an out of bounds load
+        std::vector<int> next;
+        std::string &out = b.body;
+        b.exit = cbpf_block::END;
+
+        int i = b.start;
+        for (; i < len && !fails; i++) {
+            const struct sock_filter &f = insn[i];
+            uint16_t c = f.code;
+
+            /* fixed offset loads are covered by the check at the start of the block */
+            auto fixed_load = [&](uint32_t off, uint32_t size) -> std::string {
+                if (off > MAX_PACKET_OFF - size) {
+                    fails = true;
+                    return "";
+                }
+                need = std::max(need, off + size);
+                return cbpf_load(size, std::to_string(off));
+            };
+
+            switch (BPF_CLASS(c)) {
+            case BPF_LD:
+            case BPF_LDX: {
+                bool to_a = BPF_CLASS(c) == BPF_LD;
+                struct cbpf_reg &r = to_a ? st.a : st.x;
+                const char *name = to_a ? "a" : "x";
+                std::string value;
+
+                switch (BPF_MODE(c)) {
+                case BPF_IMM:
+                    r = {true, f.k};
+                    break;
+                case BPF_MEM:
+                    r = st.m[f.k];
+                    if (!r.known)
+                        value = "m[" + std::to_string(f.k) + "]";
+                    break;
+                case BPF_LEN:
+                    r.known = false;
+                    if (cubeType == polycube::service::CubeType::TC)
+                        value = "ctx->len";
+                    else
+                        value = "data_end - data";
+                    break;
+                case BPF_ABS:
+                    r.known = false;
+                    value = fixed_load(f.k, cbpf_load_size(c));
+                    break;
+                case BPF_IND: {
+                    uint32_t size = cbpf_load_size(c);
+                    r.known = false;
+                    if (st.x.known) {
+                        /* x is constant, the offset is fixed */
+                        if (st.x.value > MAX_PACKET_OFF)
+                            fails = true;
+                        else
+                            value = fixed_load(st.x.value + f.k, size);
+                    } else if (f.k > MAX_PACKET_OFF - size) {
+                        fails = true;
+                    } else {
+                        /* the verifier needs the variable offset to be bounded */
+                        std::string off = "x + " + std::to_string(f.k);
+                        out += "\tif (x > " + std::to_string(MAX_PACKET_OFF - size - f.k) +
+                               " || data + " + off + " + " + std::to_string(size) + " > data_end)\n"
+                               "\t\treturn RX_OK;\n";
+                        checks++;
+                        value = cbpf_load(size, off);
+                    }
+                    break;
+                }
+                case BPF_MSH:
+                    r.known = false;
+                    value = fixed_load(f.k, 1);
+                    if (!fails)
+                        value = "(" + value + " & 0xf) << 2";
+                    break;
+                }
+
+                if (fails)
+                    break;
+                if (r.known)
+                    out += std::string("\t") + name + " = " + cbpf_hex(r.value) + ";\n";
+                else
+                    out += std::string("\t") + name + " = " + value + ";\n";
+                break;
+            }
+
+            case BPF_ST:
+            case BPF_STX: {
+                const struct cbpf_reg &r = BPF_CLASS(c) == BPF_ST ? st.a : st.x;
+                st.m[f.k] = r;
+                out += "\tm[" + std::to_string(f.k) + "] = " +
+                       (r.known ? cbpf_hex(r.value) : std::string(BPF_CLASS(c) == BPF_ST ? "a" : "x")) + ";\n";
+                break;
+            }
+
+            case BPF_ALU: {
+                uint16_t op = BPF_OP(c);
+                struct cbpf_reg v = BPF_SRC(c) == BPF_K ? cbpf_reg{true, f.k} : st.x;
+                uint32_t res;
+
+                if ((op == BPF_DIV || op == BPF_MOD) && v.known && v.value == 0) {
+                    /* division by zero terminates the filter */
+                    fails = true;
+                    break;
+                }
+                if (st.a.known && (v.known || op == BPF_NEG) &&
+                    cbpf_alu_fold(op, st.a.value, v.value, res)) {
+                    st.a = {true, res};
+                    out += "\ta = " + cbpf_hex(res) + ";\n";
+                    break;
+                }
+
+                st.a.known = false;
+                if (op == BPF_NEG) {
+                    out += "\ta = -a;\n";
+                    break;
+                }
+                if ((op == BPF_DIV || op == BPF_MOD) && !v.known)
+                    out += "\tif (x == 0)\n\t\treturn RX_OK;\n";
+                out += std::string("\ta ") + cbpf_alu_op(op) + "= " +
+                       (v.known ? cbpf_hex(v.value) : "x") + ";\n";
+                break;
+            }
+
+            case BPF_MISC:
+                if (BPF_MISCOP(c) == BPF_TAX) {
+                    st.x = st.a;
+                    out += "\tx = " + (st.x.known ? cbpf_hex(st.x.value) : "a") + ";\n";
+                } else {
+                    st.a = st.x;
+                    out += "\ta = " + (st.a.known ? cbpf_hex(st.a.value) : "x") + ";\n";
+                }
+                break;
+
+            case BPF_JMP: {
+                uint16_t op = BPF_OP(c);
+                if (op == BPF_JA) {
+                    b.exit = cbpf_block::GOTO;
+                    b.jt = i + 1 + f.k;
+                    next.push_back(b.jt);
+                    break;
+                }
+
+                int jt = i + 1 + f.jt, jf = i + 1 + f.jf;
+                struct cbpf_reg v = BPF_SRC(c) == BPF_K ? cbpf_reg{true, f.k} : st.x;
+                if (jt == jf || (st.a.known && v.known)) {
+                    /* only one of the branches can be taken */
+                    b.exit = cbpf_block::GOTO;
+                    b.jt = (jt == jf || cbpf_jump_fold(op, st.a.value, v.value)) ? jt : jf;
+                    next.push_back(b.jt);
+                    break;
+                }
+
+                b.exit = cbpf_block::COND;
+                b.cond = std::string("a ") + cbpf_jump_op(op) + " " +
+                         (v.known ? cbpf_hex(v.value) : "x");
+                if (op == BPF_JSET)
+                    b.cond = "(" + b.cond + ") != 0";
+                b.jt = jt;
+                b.jf = jf;
+                next.push_back(jt);
+                next.push_back(jf);
+                break;
+            }
+
+            case BPF_RET: {
+                struct cbpf_reg r = BPF_RVAL(c) == BPF_K ? cbpf_reg{true, f.k} :
+                                    BPF_RVAL(c) == BPF_A ? st.a : st.x;
+                if (!r.known)
+                    out += std::string("\tif (") + (BPF_RVAL(c) == BPF_A ? "a" : "x") + " != 0)\n\t\tcapture_packet(ctx);\n";
+                else if (r.value != 0)
+                    out += "\tcapture_packet(ctx);\n";
+                out += "\treturn RX_OK;\n";
+                break;
+            }
+            }
+
+            if (BPF_CLASS(c) == BPF_JMP || BPF_CLASS(c) == BPF_RET)
+                break;
+            if (i + 1 < len && leader[i + 1]) {
+                /* the next instruction starts another block */
+                b.exit = cbpf_block::GOTO;
+                b.jt = i + 1;
+                next.push_back(i + 1);
+                break;
+            }
+        }
+
+        if (fails) {
+            /* the packet is too short for a load of the block, it does not match */
+            out = "\treturn RX_OK;\n";
+            b.exit = cbpf_block::END;
+            continue;
+        }
+
+        if (need > st.checked) {
+            b.check = need;
+            st.checked = need;
+            checks++;
+        }
+        for (int t : next) {
+            st.reached = true;
+            cbpf_merge(in[block_of[t]], st);
+        }
+    }
+
+    /* layout: jumps to the block that follows are removed */
+    std::vector<int> order;
+    for (auto &b : blocks) {
+        if (b.reached)
+            order.push_back(b.start);
+    }
+
+    std::vector<bool> referenced(len, false);
+    std::vector<std::string> jumps(blocks.size());
+    for (size_t k = 0; k < order.size(); k++) {
+        struct cbpf_block &b = blocks[block_of[order[k]]];
+        int follow = k + 1 < order.size() ? order[k + 1] : -1;
+        std::string &j = jumps[block_of[b.start]];
+
+        if (b.exit == cbpf_block::GOTO && b.jt != follow) {
+            j = "\tgoto L" + std::to_string(b.jt) + ";\n";
+            referenced[b.jt] = true;
+        } else if (b.exit == cbpf_block::COND) {
+            if (b.jf == follow) {
+                j = "\tif (" + b.cond + ")\n\t\tgoto L" + std::to_string(b.jt) + ";\n";
+                referenced[b.jt] = true;
+            } else if (b.jt == follow) {
+                j = "\tif (!(" + b.cond + "))\n\t\tgoto L" + std::to_string(b.jf) + ";\n";
+                referenced[b.jf] = true;
+            } else {
+                j = "\tif (" + b.cond + ")\n\t\tgoto L" + std::to_string(b.jt) + ";\n"
+                    "\tgoto L" + std::to_string(b.jf) + ";\n";
+                referenced[b.jt] = referenced[b.jf] = true;
+            }
+        }
+    }
+
+    code = "/* " + std::to_string(len) + " cBPF instructions, " +
+           std::to_string(order.size()) + " of " + std::to_string(blocks.size()) +
+           " blocks reachable, " + std::to_string(checks) + " bounds checks */\n";
+    for (int start : order) {
+        struct cbpf_block &b = blocks[block_of[start]];
+        if (referenced[start])
+            code += "L" + std::to_string(start) + ":\n";
+        if (b.check)
+            code += "\tif (data + " + std::to_string(b.check) + " > data_end)\n\t\treturn RX_OK;\n";
+        code += b.body;
+        code += jumps[block_of[start]];
+    }
+    return true;
+}
+
+
 std::string cbpf2c::bpf_dump_all(struct sock_fprog *bpf, polycube::service::CubeType cubeType) {
     int i;
     std::string ret = "";
@@ -409,14 +857,7 @@ char *cbpf2c::_cbpf_dump(const struct sock_filter bpf, int n, polycube::service:
                 if (strcmp(operand, "0x0") == 0) {
                   snprintf(ret, sizeof(ret), "L%d:\t%s RX_OK;", n, op);
                 } else if (strcmp(operand, "0xffffffff") == 0) {
-                  if (cubeType == polycube::CubeType::TC) {
-                    snprintf(ret, sizeof(ret), "L%d:\tif (ctx->tstamp == 0) {\n\t\tpkt_timestamp = bpf_ktime_get_ns();\n\t\tmdata[0] = *(&pkt_timestamp);\n\t\t"
-                                                "mdata[1] = (*(&pkt_timestamp)) >> 32;\n\t\tmdata[2] = 0;\n\t} else {\n\t\tmdata[0] = *(&ctx->tstamp);\n\t\t"
-                                                "mdata[1] = (*(&ctx->tstamp)) >> 32;\n\t\tmdata[2] = 1;\n\t}\n\tpcn_pkt_controller_with_metadata(ctx, md, reason, mdata);\n", n);
-                  } else { /* CubeType::XDP_DRV or CubeType::XDP_SKB */
-                    snprintf(ret, sizeof(ret), "L%d:\tpkt_timestamp = bpf_ktime_get_ns();\n\tmdata[0] = *(&pkt_timestamp);\n\t"
-                    "mdata[1] = (*(&pkt_timestamp)) >> 32;\n\tmdata[2] = 0;\n\tpcn_pkt_controller_with_metadata(ctx, md, reason, mdata);\n", n);
-                  }
+                  snprintf(ret, sizeof(ret), "L%d:\tcapture_packet(ctx);\n\treturn RX_OK;\n", n);
                 } else {
                   snprintf(ret, sizeof(ret), "L%d:\t unimp\n", n);
                 }
@@ -12,6 +12,15 @@ public:
 
   static std::string ToC(struct sock_fprog * cbpf, polycube::service::CubeType cubeType);
 
+  /*
+   * Translates the whole program into C, folding the constant values of the
+   * registers, removing the branches that cannot be taken and checking the
+   * packet bounds once per block instead of once per load.
+   * Returns false if the program uses instructions that are only supported
+   * by the instruction by instruction translation (ancillary loads).
+   */
+  static bool optimized_ToC(const struct sock_fprog *bpf, polycube::service::CubeType cubeType, std::string &code);
+
   static int cbpf_validate(const struct sock_fprog *bpf);
 
   static std::string bpf_dump_all(struct sock_fprog *bpf, polycube::service::CubeType cubeType);
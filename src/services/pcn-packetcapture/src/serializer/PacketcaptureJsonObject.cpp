@@ -30,6 +30,24 @@ PacketcaptureJsonObject::PacketcaptureJsonObject() {
   m_filterIsSet = false;
   m_globalheaderIsSet = false;
   m_packetIsSet = false;
+  m_rotateSize = 0;
+  m_rotateSizeIsSet = true;
+  m_rotateInterval = 0;
+  m_rotateIntervalIsSet = true;
+  m_capturedPacketsIsSet = false;
+  m_droppedKernelIsSet = false;
+  m_droppedWriterIsSet = false;
+  m_compression = false;
+  m_compressionIsSet = true;
+  m_format = PacketcaptureFormatEnum::PCAP;
+  m_formatIsSet = true;
+  m_ringSize = 16384;
+  m_ringSizeIsSet = true;
+  m_streamAddress = "127.0.0.1";
+  m_streamAddressIsSet = true;
+  m_streamPort = 0;
+  m_streamPortIsSet = true;
+  m_droppedNetworkIsSet = false;
 }
 
 PacketcaptureJsonObject::PacketcaptureJsonObject(const nlohmann::json &val) :
@@ -43,6 +61,17 @@ PacketcaptureJsonObject::PacketcaptureJsonObject(const nlohmann::json &val) :
   m_filterIsSet = false;
   m_globalheaderIsSet = false;
   m_packetIsSet = false;
+  m_rotateSizeIsSet = false;
+  m_rotateIntervalIsSet = false;
+  m_capturedPacketsIsSet = false;
+  m_droppedKernelIsSet = false;
+  m_droppedWriterIsSet = false;
+  m_compressionIsSet = false;
+  m_formatIsSet = false;
+  m_ringSizeIsSet = false;
+  m_streamAddressIsSet = false;
+  m_streamPortIsSet = false;
+  m_droppedNetworkIsSet = false;
 
 
   if (val.count("name")) {
@@ -86,6 +115,50 @@ PacketcaptureJsonObject::PacketcaptureJsonObject(const nlohmann::json &val) :
       setPacket(newItem);
     }
   }
+
+  if (val.count("rotate-size")) {
+    setRotateSize(val.at("rotate-size").get<uint32_t>());
+  }
+
+  if (val.count("rotate-interval")) {
+    setRotateInterval(val.at("rotate-interval").get<uint32_t>());
+  }
+
+  if (val.count("captured-packets")) {
+    setCapturedPackets(val.at("captured-packets").get<uint64_t>());
+  }
+
+  if (val.count("dropped-kernel")) {
+    setDroppedKernel(val.at("dropped-kernel").get<uint64_t>());
+  }
+
+  if (val.count("dropped-writer")) {
+    setDroppedWriter(val.at("dropped-writer").get<uint64_t>());
+  }
+
+  if (val.count("compression")) {
+    setCompression(val.at("compression").get<bool>());
+  }
+
+  if (val.count("format")) {
+    setFormat(string_to_PacketcaptureFormatEnum(val.at("format").get<std::string>()));
+  }
+
+  if (val.count("ring-size")) {
+    setRingSize(val.at("ring-size").get<uint32_t>());
+  }
+
+  if (val.count("stream-address")) {
+    setStreamAddress(val.at("stream-address").get<std::string>());
+  }
+
+  if (val.count("stream-port")) {
+    setStreamPort(val.at("stream-port").get<uint16_t>());
+  }
+
+  if (val.count("dropped-network")) {
+    setDroppedNetwork(val.at("dropped-network").get<uint64_t>());
+  }
 }
 
 nlohmann::json PacketcaptureJsonObject::toJson() const {
@@ -130,6 +203,50 @@ nlohmann::json PacketcaptureJsonObject::toJson() const {
     val["packet"] = JsonObjectBase::toJson(m_packet);
   }
 
+  if (m_rotateSizeIsSet) {
+    val["rotate-size"] = m_rotateSize;
+  }
+
+  if (m_rotateIntervalIsSet) {
+    val["rotate-interval"] = m_rotateInterval;
+  }
+
+  if (m_capturedPacketsIsSet) {
+    val["captured-packets"] = m_capturedPackets;
+  }
+
+  if (m_droppedKernelIsSet) {
+    val["dropped-kernel"] = m_droppedKernel;
+  }
+
+  if (m_droppedWriterIsSet) {
+    val["dropped-writer"] = m_droppedWriter;
+  }
+
+  if (m_compressionIsSet) {
+    val["compression"] = m_compression;
+  }
+
+  if (m_formatIsSet) {
+    val["format"] = PacketcaptureFormatEnum_to_string(m_format);
+  }
+
+  if (m_ringSizeIsSet) {
+    val["ring-size"] = m_ringSize;
+  }
+
+  if (m_streamAddressIsSet) {
+    val["stream-address"] = m_streamAddress;
+  }
+
+  if (m_streamPortIsSet) {
+    val["stream-port"] = m_streamPort;
+  }
+
+  if (m_droppedNetworkIsSet) {
+    val["dropped-network"] = m_droppedNetwork;
+  }
+
   return val;
 }
 
@@ -310,6 +427,184 @@ void PacketcaptureJsonObject::unsetPacket() {
   m_packetIsSet = false;
 }
 
+uint32_t PacketcaptureJsonObject::getRotateSize() const {
+  return m_rotateSize;
+}
+
+void PacketcaptureJsonObject::setRotateSize(uint32_t value) {
+  m_rotateSize = value;
+  m_rotateSizeIsSet = true;
+}
+
+bool PacketcaptureJsonObject::rotateSizeIsSet() const {
+  return m_rotateSizeIsSet;
+}
+
+uint32_t PacketcaptureJsonObject::getRotateInterval() const {
+  return m_rotateInterval;
+}
+
+void PacketcaptureJsonObject::setRotateInterval(uint32_t value) {
+  m_rotateInterval = value;
+  m_rotateIntervalIsSet = true;
+}
+
+bool PacketcaptureJsonObject::rotateIntervalIsSet() const {
+  return m_rotateIntervalIsSet;
+}
+
+uint64_t PacketcaptureJsonObject::getCapturedPackets() const {
+  return m_capturedPackets;
+}
+
+void PacketcaptureJsonObject::setCapturedPackets(uint64_t value) {
+  m_capturedPackets = value;
+  m_capturedPacketsIsSet = true;
+}
+
+bool PacketcaptureJsonObject::capturedPacketsIsSet() const {
+  return m_capturedPacketsIsSet;
+}
+
+void PacketcaptureJsonObject::unsetCapturedPackets() {
+  m_capturedPacketsIsSet = false;
+}
+
+uint64_t PacketcaptureJsonObject::getDroppedKernel() const {
+  return m_droppedKernel;
+}
+
+void PacketcaptureJsonObject::setDroppedKernel(uint64_t value) {
+  m_droppedKernel = value;
+  m_droppedKernelIsSet = true;
+}
+
+bool PacketcaptureJsonObject::droppedKernelIsSet() const {
+  return m_droppedKernelIsSet;
+}
+
+void PacketcaptureJsonObject::unsetDroppedKernel() {
+  m_droppedKernelIsSet = false;
+}
+
+uint64_t PacketcaptureJsonObject::getDroppedWriter() const {
+  return m_droppedWriter;
+}
+
+void PacketcaptureJsonObject::setDroppedWriter(uint64_t value) {
+  m_droppedWriter = value;
+  m_droppedWriterIsSet = true;
+}
+
+bool PacketcaptureJsonObject::droppedWriterIsSet() const {
+  return m_droppedWriterIsSet;
+}
+
+void PacketcaptureJsonObject::unsetDroppedWriter() {
+  m_droppedWriterIsSet = false;
+}
+
+bool PacketcaptureJsonObject::getCompression() const {
+  return m_compression;
+}
+
+void PacketcaptureJsonObject::setCompression(bool value) {
+  m_compression = value;
+  m_compressionIsSet = true;
+}
+
+bool PacketcaptureJsonObject::compressionIsSet() const {
+  return m_compressionIsSet;
+}
+
+PacketcaptureFormatEnum PacketcaptureJsonObject::getFormat() const {
+  return m_format;
+}
+
+void PacketcaptureJsonObject::setFormat(PacketcaptureFormatEnum value) {
+  m_format = value;
+  m_formatIsSet = true;
+}
+
+bool PacketcaptureJsonObject::formatIsSet() const {
+  return m_formatIsSet;
+}
+
+std::string PacketcaptureJsonObject::PacketcaptureFormatEnum_to_string(const PacketcaptureFormatEnum &value){
+  switch(value) {
+    case PacketcaptureFormatEnum::PCAP:
+      return std::string("pcap");
+    case PacketcaptureFormatEnum::PCAPNG:
+      return std::string("pcapng");
+    default:
+      throw std::runtime_error("Bad Packetcapture format");
+  }
+}
+
+PacketcaptureFormatEnum PacketcaptureJsonObject::string_to_PacketcaptureFormatEnum(const std::string &str){
+  if (JsonObjectBase::iequals("pcap", str))
+    return PacketcaptureFormatEnum::PCAP;
+  if (JsonObjectBase::iequals("pcapng", str))
+    return PacketcaptureFormatEnum::PCAPNG;
+  throw std::runtime_error("Packetcapture format is invalid");
+}
+
+uint32_t PacketcaptureJsonObject::getRingSize() const {
+  return m_ringSize;
+}
+
+void PacketcaptureJsonObject::setRingSize(uint32_t value) {
+  m_ringSize = value;
+  m_ringSizeIsSet = true;
+}
+
+bool PacketcaptureJsonObject::ringSizeIsSet() const {
+  return m_ringSizeIsSet;
+}
+
+std::string PacketcaptureJsonObject::getStreamAddress() const {
+  return m_streamAddress;
+}
+
+void PacketcaptureJsonObject::setStreamAddress(std::string value) {
+  m_streamAddress = value;
+  m_streamAddressIsSet = true;
+}
+
+bool PacketcaptureJsonObject::streamAddressIsSet() const {
+  return m_streamAddressIsSet;
+}
+
+uint16_t PacketcaptureJsonObject::getStreamPort() const {
+  return m_streamPort;
+}
+
+void PacketcaptureJsonObject::setStreamPort(uint16_t value) {
+  m_streamPort = value;
+  m_streamPortIsSet = true;
+}
+
+bool PacketcaptureJsonObject::streamPortIsSet() const {
+  return m_streamPortIsSet;
+}
+
+uint64_t PacketcaptureJsonObject::getDroppedNetwork() const {
+  return m_droppedNetwork;
+}
+
+void PacketcaptureJsonObject::setDroppedNetwork(uint64_t value) {
+  m_droppedNetwork = value;
+  m_droppedNetworkIsSet = true;
+}
+
+bool PacketcaptureJsonObject::droppedNetworkIsSet() const {
+  return m_droppedNetworkIsSet;
+}
+
+void PacketcaptureJsonObject::unsetDroppedNetwork() {
+  m_droppedNetworkIsSet = false;
+}
+
 
 }
 }
@@ -30,6 +30,9 @@ namespace model {
 enum class PacketcaptureCaptureEnum {
   INGRESS, EGRESS, BIDIRECTIONAL, OFF
 };
+enum class PacketcaptureFormatEnum {
+  PCAP, PCAPNG
+};
 
 /// <summary>
 ///
@@ -115,6 +118,89 @@ public:
   bool packetIsSet() const;
   void unsetPacket();
 
+  /// <summary>
+  /// Size in MB of a dump file after which a new file is started, 0 disables the rotation
+  /// </summary>
+  uint32_t getRotateSize() const;
+  void setRotateSize(uint32_t value);
+  bool rotateSizeIsSet() const;
+
+  /// <summary>
+  /// Time in seconds after which a new dump file is started, 0 disables the rotation
+  /// </summary>
+  uint32_t getRotateInterval() const;
+  void setRotateInterval(uint32_t value);
+  bool rotateIntervalIsSet() const;
+
+  /// <summary>
+  /// Number of packets captured
+  /// </summary>
+  uint64_t getCapturedPackets() const;
+  void setCapturedPackets(uint64_t value);
+  bool capturedPacketsIsSet() const;
+  void unsetCapturedPackets();
+
+  /// <summary>
+  /// Number of packets lost because the kernel buffer was full
+  /// </summary>
+  uint64_t getDroppedKernel() const;
+  void setDroppedKernel(uint64_t value);
+  bool droppedKernelIsSet() const;
+  void unsetDroppedKernel();
+
+  /// <summary>
+  /// Number of packets dropped because the writer could not keep up
+  /// </summary>
+  uint64_t getDroppedWriter() const;
+  void setDroppedWriter(uint64_t value);
+  bool droppedWriterIsSet() const;
+  void unsetDroppedWriter();
+
+  /// <summary>
+  /// Compress the dump file with gzip
+  /// </summary>
+  bool getCompression() const;
+  void setCompression(bool value);
+  bool compressionIsSet() const;
+
+  /// <summary>
+  /// Format of the dump file, PCAPNG records the direction and nanosecond timestamps
+  /// </summary>
+  PacketcaptureFormatEnum getFormat() const;
+  void setFormat(PacketcaptureFormatEnum value);
+  bool formatIsSet() const;
+  static std::string PacketcaptureFormatEnum_to_string(const PacketcaptureFormatEnum &value);
+  static PacketcaptureFormatEnum string_to_PacketcaptureFormatEnum(const std::string &str);
+
+  /// <summary>
+  /// Number of packets kept in network mode, when full the oldest packet is dropped
+  /// </summary>
+  uint32_t getRingSize() const;
+  void setRingSize(uint32_t value);
+  bool ringSizeIsSet() const;
+
+  /// <summary>
+  /// Address of the HTTP endpoint streaming the packets captured in network mode
+  /// </summary>
+  std::string getStreamAddress() const;
+  void setStreamAddress(std::string value);
+  bool streamAddressIsSet() const;
+
+  /// <summary>
+  /// TCP port of the HTTP endpoint streaming the packets captured in network mode, 0 disables it
+  /// </summary>
+  uint16_t getStreamPort() const;
+  void setStreamPort(uint16_t value);
+  bool streamPortIsSet() const;
+
+  /// <summary>
+  /// Number of packets dropped in network mode because they were not read in time
+  /// </summary>
+  uint64_t getDroppedNetwork() const;
+  void setDroppedNetwork(uint64_t value);
+  bool droppedNetworkIsSet() const;
+  void unsetDroppedNetwork();
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -134,6 +220,28 @@ private:
   bool m_globalheaderIsSet;
   PacketJsonObject m_packet;
   bool m_packetIsSet;
+  uint32_t m_rotateSize;
+  bool m_rotateSizeIsSet;
+  uint32_t m_rotateInterval;
+  bool m_rotateIntervalIsSet;
+  uint64_t m_capturedPackets;
+  bool m_capturedPacketsIsSet;
+  uint64_t m_droppedKernel;
+  bool m_droppedKernelIsSet;
+  uint64_t m_droppedWriter;
+  bool m_droppedWriterIsSet;
+  bool m_compression;
+  bool m_compressionIsSet;
+  PacketcaptureFormatEnum m_format;
+  bool m_formatIsSet;
+  uint32_t m_ringSize;
+  bool m_ringSizeIsSet;
+  std::string m_streamAddress;
+  bool m_streamAddressIsSet;
+  uint16_t m_streamPort;
+  bool m_streamPortIsSet;
+  uint64_t m_droppedNetwork;
+  bool m_droppedNetworkIsSet;
 };
 
 }
@@ -0,0 +1,69 @@
+#! /bin/bash
+
+#                 ===packetcapture capture rate benchmark===
+#
+# Attaches a pcn-packetcapture instance to "br1: toveth1", as in
+# test_packetcapture.sh, and sends a burst of packets from ns1 with the pktgen
+# kernel module. At the end it prints the capture counters and the size of the
+# dump.
+#
+# usage: bench_capture.sh [packets] [packet size] [snaplen]
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+PACKETS=${1:-1000000}
+PKT_SIZE=${2:-64}
+SNAPLEN=${3:-262144}
+
+set -e
+
+function cleanup {
+  set +e
+  polycubectl detach packetcapture_service br1:toveth1
+  polycubectl del packetcapture_service
+  polycubectl del br1
+  delete_veth 2
+}
+trap cleanup EXIT
+
+create_veth 2
+
+polycubectl packetcapture add packetcapture_service capture=ingress snaplen=$SNAPLEN
+polycubectl packetcapture_service set filter=all
+polycubectl simplebridge add br1
+polycubectl br1 ports add toveth1
+polycubectl connect br1:toveth1 veth1
+polycubectl br1 ports add toveth2 peer=veth2
+sleep 2
+polycubectl attach packetcapture_service br1:toveth1
+
+sudo modprobe pktgen
+veth2_mac=$(sudo ip netns exec ns2 cat /sys/class/net/veth2_/address)
+
+function pgset {
+  sudo ip netns exec ns1 sh -c "echo \"$2\" > /proc/net/pktgen/$1"
+}
+
+pgset kpktgend_0 "rem_device_all"
+pgset kpktgend_0 "add_device veth1_"
+pgset veth1_ "count $PACKETS"
+pgset veth1_ "pkt_size $PKT_SIZE"
+pgset veth1_ "delay 0"
+pgset veth1_ "dst 10.0.0.2"
+pgset veth1_ "dst_mac $veth2_mac"
+
+start=$(date +%s.%N)
+pgset pgctrl "start"
+end=$(date +%s.%N)
+# let the writer flush the last packets
+sleep 2
+
+echo "sent $PACKETS packets of $PKT_SIZE bytes in $(echo "$end - $start" | bc) s"
+sudo ip netns exec ns1 cat /proc/net/pktgen/veth1_ | grep -E "pps|errors" || true
+polycubectl packetcapture_service show captured-packets
+polycubectl packetcapture_service show dropped-kernel
+polycubectl packetcapture_service show dropped-writer
+
+dump=$(polycubectl packetcapture_service show dump | cut -d ' ' -f 4-)
+ls -l $dump
+sudo rm -f $dump
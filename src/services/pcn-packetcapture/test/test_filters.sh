@@ -0,0 +1,100 @@
+#! /bin/bash
+
+#                 ===packetcapture filters test===
+#
+# Same topology of test_packetcapture.sh. For each filter, the traffic on
+# veth1 is recorded by tcpdump without filters while the service captures
+# it with the filter; then libpcap applies the same filter to the stored
+# trace and the number of packets matched must be the same of the dump.
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+TMP_DIR=$(mktemp -d)
+
+FILTERS=(
+  "ip"
+  "arp"
+  "icmp"
+  "tcp"
+  "udp"
+  "ip6"
+  "host 10.0.0.2"
+  "src host 10.0.0.1 and icmp"
+  "net 10.0.0.0/24"
+  "tcp port 80"
+  "tcp dst port 8080 or udp port 53"
+  "portrange 1-1024"
+  "icmp[icmptype] == icmp-echoreply"
+  "ip[2:2] > 80"
+  "tcp[tcpflags] & tcp-syn != 0"
+  "greater 100"
+  "not ip"
+)
+
+set -e
+set -x
+
+function cleanup {
+  set +e
+  sudo kill $TCPDUMP_PID
+  rm -rf $TMP_DIR
+  polycubectl del packetcapture_service
+  polycubectl del br1
+  delete_veth 2
+  echo "FAIL"
+}
+trap cleanup EXIT
+
+# icmp, udp and tcp traffic from ns1 to ns2, the connections are refused
+function traffic {
+  sudo ip netns exec ns1 ping 10.0.0.2 -c 2 -i 0.2
+  sudo ip netns exec ns1 ping 10.0.0.2 -c 1 -s 500
+  sudo ip netns exec ns1 bash -c 'echo test > /dev/udp/10.0.0.2/53' || true
+  sudo ip netns exec ns1 bash -c 'echo test > /dev/udp/10.0.0.2/5000' || true
+  sudo ip netns exec ns1 bash -c 'echo > /dev/tcp/10.0.0.2/80' || true
+  sudo ip netns exec ns1 bash -c 'echo > /dev/tcp/10.0.0.2/8080' || true
+  sudo ip netns exec ns1 ip neigh flush all
+  sudo ip netns exec ns1 ping 10.0.0.2 -c 1
+}
+
+create_veth 2
+
+polycubectl packetcapture add packetcapture_service capture=bidirectional
+polycubectl simplebridge add br1
+polycubectl br1 ports add toveth1
+polycubectl connect br1:toveth1 veth1
+polycubectl br1 ports add toveth2 peer=veth2
+sleep 2
+polycubectl attach packetcapture_service br1:toveth1
+
+for i in "${!FILTERS[@]}"; do
+  filter=${FILTERS[$i]}
+  polycubectl packetcapture_service set filter="$filter"
+  polycubectl packetcapture_service set dump="$TMP_DIR/dump_$i"
+
+  sudo tcpdump -i veth1 -U -w $TMP_DIR/trace_$i.pcap &
+  TCPDUMP_PID=$!
+  sleep 1
+  traffic
+  sleep 1
+  sudo kill $TCPDUMP_PID
+  wait $TCPDUMP_PID || true
+
+  # the writer is closed, so the dump is complete
+  polycubectl packetcapture_service set dump="$TMP_DIR/unused"
+
+  expected=$(tcpdump -r $TMP_DIR/trace_$i.pcap "$filter" 2> /dev/null | wc -l)
+  captured=$(tcpdump -r $TMP_DIR/dump_$i.pcap 2> /dev/null | wc -l)
+  echo "filter '$filter': expected $expected captured $captured"
+  test $expected -eq $captured
+done
+
+rm -rf $TMP_DIR
+polycubectl detach packetcapture_service br1:toveth1
+polycubectl del packetcapture_service
+polycubectl del br1
+delete_veth 2
+
+set +x
+trap - EXIT
+echo "SUCCESS"
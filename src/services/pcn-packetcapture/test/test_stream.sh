@@ -0,0 +1,59 @@
+#! /bin/bash
+
+#                 ===packetcapture stream test===
+#
+# Same topology of test_packetcapture.sh, the service runs in network mode
+# and the captured packets are read from the streaming endpoint with curl.
+# It is checked that the stream is a pcap file with the packets of the ping.
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+STREAM_FILE=/tmp/packetcapture_stream.pcap
+
+set -e
+set -x
+
+function cleanup {
+  set +e
+  kill $CURL_PID
+  rm -f $STREAM_FILE
+  polycubectl del packetcapture_service
+  polycubectl del br1
+  delete_veth 2
+  echo "FAIL"
+}
+trap cleanup EXIT
+
+create_veth 2
+
+polycubectl packetcapture add packetcapture_service capture=bidirectional networkmode=true stream-port=9099
+polycubectl simplebridge add br1
+polycubectl br1 ports add toveth1
+polycubectl connect br1:toveth1 veth1
+polycubectl br1 ports add toveth2 peer=veth2
+sleep 2
+polycubectl attach packetcapture_service br1:toveth1
+
+curl -sN http://127.0.0.1:9099/ > $STREAM_FILE &
+CURL_PID=$!
+sleep 1
+
+sudo ip netns exec ns1 ping 10.0.0.2 -c 3 -i 0.2
+sleep 1
+kill $CURL_PID
+
+# pcap global header (24 bytes) and at least 3 requests and 3 replies
+test $(stat -c %s $STREAM_FILE) -gt $((24 + 6 * (16 + 98)))
+if command -v tcpdump > /dev/null; then
+  test $(tcpdump -nr $STREAM_FILE icmp | wc -l) -ge 6
+fi
+
+rm -f $STREAM_FILE
+polycubectl detach packetcapture_service br1:toveth1
+polycubectl del packetcapture_service
+polycubectl del br1
+delete_veth 2
+
+set +x
+trap - EXIT
+echo "SUCCESS"
@@ -16,12 +16,15 @@
 
 #include "Pbforwarder.h"
 #include "Pbforwarder_dp_action.h"
+#include "Pbforwarder_dp_classifier.h"
 #include "Pbforwarder_dp_matching.h"
 #include "Pbforwarder_dp_parsing.h"
 
 Pbforwarder::Pbforwarder(const std::string name,
                          const PbforwarderJsonObject &conf)
-    : Cube(conf.getBase(), generate_code_vector(), {}) {
+    : Cube(conf.getBase(), generate_code_vector(conf.getClassifier()), {}),
+      classifier_(conf.getClassifier()),
+      tuple_slots_(MAX_TUPLES, TupleSlot{0, 0}) {
   logger()->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [Pbforwarder] [%n] [%l] %v");
   logger()->info("Creating Pbforwarder instance");
 
@@ -58,6 +61,7 @@ void Pbforwarder::update(const PbforwarderJsonObject &conf) {
 PbforwarderJsonObject Pbforwarder::toJsonObject() {
   PbforwarderJsonObject conf;
   conf.setBase(Cube::to_json());
+  conf.setClassifier(getClassifier());
 
   for (auto &i : getRulesList()) {
     conf.addRules(i->toJsonObject());
@@ -76,6 +80,11 @@ std::string Pbforwarder::generate_code() {
 
 // overriden method to allow code generation at initialization
 std::string Pbforwarder::generate_code_matching(bool bootstrap) {
+  if (classifier_ == PbforwarderClassifierEnum::TUPLE_SPACE) {
+    // the tuples are read from a map, the code never changes
+    return pbforwarder_code_classifier;
+  }
+
   std::string init_define;
   if (bootstrap) {
     init_define = std::string("#define RULES 0 \n#define LEVEL 2\n");
@@ -99,10 +108,15 @@ std::string Pbforwarder::generate_code_parsing(bool bootstrap) {
   return init_define + pbforwarder_code_parsing;
 }
 
-std::vector<std::string> Pbforwarder::generate_code_vector() {
+std::vector<std::string> Pbforwarder::generate_code_vector(
+    PbforwarderClassifierEnum classifier) {
   std::vector<std::string> codes;
   codes.push_back(generate_code_parsing(true));
-  codes.push_back(generate_code_matching(true));
+  if (classifier == PbforwarderClassifierEnum::TUPLE_SPACE) {
+    codes.push_back(pbforwarder_code_classifier);
+  } else {
+    codes.push_back(generate_code_matching(true));
+  }
   codes.push_back(pbforwarder_code_action);
   return codes;
 }
@@ -198,22 +212,163 @@ void Pbforwarder::replaceRules(const uint32_t &id,
 
 void Pbforwarder::delRules(const uint32_t &id) {
   rules_.erase(id);
+  if (classifier_ == PbforwarderClassifierEnum::TUPLE_SPACE) {
+    classifierRemove(id);
+    return;
+  }
+
   auto rules_table = get_hash_table<uint32_t, rule>("rules", 1);
   rules_table.remove(id);
   if (nr_rules == id) {
     nr_rules--;
-    reload(generate_code_parsing(), 1);
+    reload(generate_code_parsing(), 0);
     reload(generate_code_matching(), 1);
   }
 }
 
 void Pbforwarder::delRulesList() {
   rules_.clear();
+  if (classifier_ == PbforwarderClassifierEnum::TUPLE_SPACE) {
+    classifierClear();
+    match_level = 2;
+    reload(generate_code_parsing(), 0);
+    return;
+  }
+
   auto rules_table = get_hash_table<uint32_t, rule>("rules", 1);
   rules_table.remove_all();
 
   match_level = 2;
   nr_rules = 0;
-  reload(generate_code_parsing(), 1);
+  reload(generate_code_parsing(), 0);
   reload(generate_code_matching(), 1);
-}
\ No newline at end of file
+}
+PbforwarderClassifierEnum Pbforwarder::getClassifier() {
+  return classifier_;
+}
+
+classifier_key Pbforwarder::classifierKey(const rule &r, uint16_t tuple) {
+  classifier_key key;
+  std::memset(&key, 0, sizeof(key));
+
+  key.tuple = tuple;
+  if (IS_SET(r.flags, 0))
+    key.srcMac = r.srcMac;
+  if (IS_SET(r.flags, 1))
+    key.dstMac = r.dstMac;
+  if (IS_SET(r.flags, 2))
+    key.vlanid = r.vlanid;
+  if (IS_SET(r.flags, 3))
+    key.srcIp = r.srcIp;
+  if (IS_SET(r.flags, 4))
+    key.dstIp = r.dstIp;
+  if (IS_SET(r.flags, 5))
+    key.lvl4_proto = r.lvl4_proto;
+  if (IS_SET(r.flags, 6))
+    key.src_port = r.src_port;
+  if (IS_SET(r.flags, 7))
+    key.dst_port = r.dst_port;
+  if (IS_SET(r.flags, 8))
+    key.inport = r.inport;
+
+  return key;
+}
+
+// writes the entry of the rule with the lowest id among the ones sharing the
+// key, the datapath does the same choice across tuples
+void Pbforwarder::classifierWrite(const classifier_key &key) {
+  auto classifier_table =
+      get_hash_table<classifier_key, classifier_value>("classifier", 1);
+
+  auto it = classifier_keys_.find(key);
+  if (it->second.empty()) {
+    classifier_keys_.erase(it);
+    classifier_table.remove(key);
+    return;
+  }
+
+  uint32_t id = *it->second.begin();
+  const rule &r = installed_rules_.at(id);
+  classifier_value value{id, r.action, r.outport};
+  classifier_table.set(key, value);
+}
+
+int Pbforwarder::classifierSlot(uint32_t flags) {
+  for (int i = 0; i < MAX_TUPLES; i++) {
+    if (tuple_slots_[i].rules > 0 && tuple_slots_[i].flags == flags)
+      return i;
+  }
+  return -1;
+}
+
+void Pbforwarder::classifierInstall(uint32_t id, const rule &r) {
+  auto tuples_table = get_array_table<tuple_mask>("tuples", 1);
+
+  // check that there is room for the tuple before touching the tables, the
+  // slot of the old version of the rule is freed if it is the only user
+  auto old = installed_rules_.find(id);
+  bool room = classifierSlot(r.flags) >= 0 ||
+              (old != installed_rules_.end() &&
+               tuple_slots_[classifierSlot(old->second.flags)].rules == 1);
+  for (int i = 0; i < MAX_TUPLES && !room; i++) {
+    room = tuple_slots_[i].rules == 0;
+  }
+  if (!room) {
+    throw std::runtime_error(
+        "Too many different sets of matched fields in the rules, the "
+        "maximum is " +
+        std::to_string(MAX_TUPLES));
+  }
+
+  classifierRemove(id);
+
+  int slot = classifierSlot(r.flags);
+  bool new_slot = slot < 0;
+  if (new_slot) {
+    for (slot = 0; tuple_slots_[slot].rules > 0; slot++) {
+    }
+    tuple_slots_[slot].flags = r.flags;
+  }
+  tuple_slots_[slot].rules++;
+
+  installed_rules_[id] = r;
+  auto key = classifierKey(r, slot);
+  classifier_keys_[key].insert(id);
+  classifierWrite(key);
+
+  // the tuple is enabled after its first entry is in place
+  if (new_slot)
+    tuples_table.set(slot, tuple_mask{r.flags, 1});
+}
+
+void Pbforwarder::classifierRemove(uint32_t id) {
+  auto it = installed_rules_.find(id);
+  if (it == installed_rules_.end())
+    return;
+
+  auto tuples_table = get_array_table<tuple_mask>("tuples", 1);
+  int slot = classifierSlot(it->second.flags);
+
+  // the tuple is disabled before its last entry goes away
+  if (tuple_slots_[slot].rules == 1)
+    tuples_table.set(slot, tuple_mask{0, 0});
+  tuple_slots_[slot].rules--;
+
+  auto key = classifierKey(it->second, slot);
+  classifier_keys_[key].erase(id);
+  classifierWrite(key);
+  installed_rules_.erase(it);
+}
+
+void Pbforwarder::classifierClear() {
+  auto tuples_table = get_array_table<tuple_mask>("tuples", 1);
+  for (int i = 0; i < MAX_TUPLES; i++) {
+    tuples_table.set(i, tuple_mask{0, 0});
+    tuple_slots_[i] = TupleSlot{0, 0};
+  }
+
+  get_hash_table<classifier_key, classifier_value>("classifier", 1)
+      .remove_all();
+  classifier_keys_.clear();
+  installed_rules_.clear();
+}
@@ -24,11 +24,47 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstring>
+#include <set>
+
 #include "Ports.h"
 #include "Rules.h"
 
 using namespace io::swagger::server::model;
 
+/* definitions copied from the classifier datapath */
+#define MAX_TUPLES 16
+
+struct tuple_mask {
+  uint32_t flags;
+  uint32_t used;
+};
+
+struct classifier_key {
+  uint64_t srcMac;
+  uint64_t dstMac;
+  uint32_t srcIp;
+  uint32_t dstIp;
+  uint16_t vlanid;
+  uint16_t lvl4_proto;
+  uint16_t src_port;
+  uint16_t dst_port;
+  uint16_t inport;
+  uint16_t tuple;
+} __attribute__((packed));
+
+struct classifier_value {
+  uint32_t id;
+  uint16_t action;
+  uint16_t outport;
+};
+
+struct ClassifierKeyLess {
+  bool operator()(const classifier_key &a, const classifier_key &b) const {
+    return std::memcmp(&a, &b, sizeof(classifier_key)) < 0;
+  }
+};
+
 class Pbforwarder : public polycube::service::Cube<Ports>,
                     public PbforwarderInterface {
   friend class Ports;
@@ -38,7 +74,8 @@ class Pbforwarder : public polycube::service::Cube<Ports>,
   Pbforwarder(const std::string name, const PbforwarderJsonObject &conf);
   virtual ~Pbforwarder() override;
   std::string generate_code();
-  std::vector<std::string> generate_code_vector();
+  std::vector<std::string> generate_code_vector(
+      PbforwarderClassifierEnum classifier);
   void packet_in(Ports &port, polycube::service::PacketInMetadata &md,
                  const std::vector<uint8_t> &packet) override;
 
@@ -56,6 +93,11 @@ class Pbforwarder : public polycube::service::Cube<Ports>,
   void delRules(const uint32_t &id) override;
   void delRulesList() override;
 
+  /// <summary>
+  /// Algorithm used to match the packets against the rules
+  /// </summary>
+  PbforwarderClassifierEnum getClassifier() override;
+
   /// <summary>
   /// Entry of the ports table
   /// </summary>
@@ -72,8 +114,28 @@ class Pbforwarder : public polycube::service::Cube<Ports>,
   std::string generate_code_parsing(bool bootstrap = false);
 
  private:
+  // tuple space classifier: each rule is stored in the tuple of its flags,
+  // a key shared by more rules is written with the action of the lowest id
+  void classifierInstall(uint32_t id, const rule &r);
+  void classifierRemove(uint32_t id);
+  void classifierClear();
+  int classifierSlot(uint32_t flags);
+  classifier_key classifierKey(const rule &r, uint16_t tuple);
+  void classifierWrite(const classifier_key &key);
+
+  struct TupleSlot {
+    uint32_t flags;
+    uint32_t rules;  // number of rules using the slot, 0 if free
+  };
+
   std::map<uint32_t, Rules> rules_;
 
+  PbforwarderClassifierEnum classifier_;
+  std::vector<TupleSlot> tuple_slots_;
+  std::map<uint32_t, rule> installed_rules_;
+  std::map<classifier_key, std::set<uint32_t>, ClassifierKeyLess>
+      classifier_keys_;
+
   int match_level = 2;
   int nr_rules = 0;
 };
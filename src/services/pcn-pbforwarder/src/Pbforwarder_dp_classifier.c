@@ -0,0 +1,170 @@
+/*
+ * Copyright 2017 The Polycube Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Tuple space classifier: the rules are grouped in tuples by the set of
+ * fields they match (the flags bitmap), and each tuple is an exact match hash
+ * lookup on the masked packet fields. The cost per packet depends on the
+ * number of tuples in use, not on the number of rules.
+ */
+
+#include <bcc/helpers.h>
+// #include <uapi/linux/in.h>
+#define IPPROTO_TCP 6
+#define IPPROTO_UDP 17
+
+#ifndef MAX_TUPLES
+#define MAX_TUPLES 16
+#endif
+
+#ifndef CLASSIFIER_DIM
+#define CLASSIFIER_DIM 16384
+#endif
+
+struct packetHeaders {
+  uint64_t srcMac;
+  uint64_t dstMac;
+  uint16_t vlan;
+  bool vlan_present;
+  bool ip;
+  uint32_t srcIp;
+  uint32_t dstIp;
+  uint8_t l4proto;
+  uint16_t srcPort;
+  uint16_t dstPort;
+};
+
+BPF_TABLE("extern", int, struct packetHeaders, packet, 1);
+
+#define BITS_PER_WORD (sizeof(uint32_t) * 8)
+#define BIT_OFFSET(b) ((b) % BITS_PER_WORD)
+#define GET_BIT(word, n) (word & (1ULL << BIT_OFFSET(n)))
+
+struct tuple_mask {
+  uint32_t flags;  // fields matched by the rules of the tuple
+  uint32_t used;
+};
+
+BPF_TABLE("array", uint32_t, struct tuple_mask, tuples, MAX_TUPLES);
+
+// Packet fields masked by the flags of a tuple, the fields not matched by the
+// tuple are zero
+struct classifier_key {
+  uint64_t srcMac;
+  uint64_t dstMac;
+  uint32_t srcIp;
+  uint32_t dstIp;
+  uint16_t vlanid;
+  uint16_t lvl4_proto;
+  uint16_t src_port;
+  uint16_t dst_port;
+  uint16_t inport;
+  uint16_t tuple;
+} __attribute__((packed));
+
+struct classifier_value {
+  uint32_t id;  // lowest id among the rules with this key
+  uint16_t action;
+  uint16_t outport;
+};
+
+BPF_TABLE("hash", struct classifier_key, struct classifier_value, classifier,
+          CLASSIFIER_DIM);
+
+struct action {
+  uint16_t action;
+  uint16_t outport;
+};
+
+BPF_TABLE_SHARED("percpu_array", int, struct action, action, 1);
+
+static __always_inline int handle_rx(struct CTXTYPE *ctx,
+                                     struct pkt_metadata *md) {
+  pcn_log(ctx, LOG_TRACE, "Classifier receiving packet");
+
+  int j = 0;
+  struct packetHeaders *pkt = 0;
+  pkt = packet.lookup(&j);
+  if (pkt == NULL)
+    return RX_DROP;
+
+  struct action *act = 0;
+  int act_k = 0;
+  act = action.lookup(&act_k);
+  if (act == NULL)
+    return RX_DROP;
+
+  // The rule with the lowest id among the ones matched in all tuples wins
+  struct classifier_value *match = NULL;
+
+#pragma unroll
+  for (int i = 0; i < MAX_TUPLES; i++) {
+    uint32_t t_key = i;
+    struct tuple_mask *t = tuples.lookup(&t_key);
+    if (t == NULL || !t->used)
+      continue;
+    uint32_t flags = t->flags;
+
+    struct classifier_key key = {};
+    key.tuple = i;
+    /* Ethernet layer */
+    if (GET_BIT(flags, 0))
+      key.srcMac = pkt->srcMac;
+    if (GET_BIT(flags, 1))
+      key.dstMac = pkt->dstMac;
+    if (GET_BIT(flags, 2)) {
+      if (!pkt->vlan_present)
+        continue;
+      key.vlanid = pkt->vlan;
+    }
+    /* IP Layer */
+    if (GET_BIT(flags, 3) || GET_BIT(flags, 4)) {
+      if (pkt->ip != 1)
+        continue;
+      if (GET_BIT(flags, 3))
+        key.srcIp = pkt->srcIp;
+      if (GET_BIT(flags, 4))
+        key.dstIp = pkt->dstIp;
+    }
+    /* Transport Layer */
+    if (GET_BIT(flags, 5)) {
+      key.lvl4_proto = pkt->l4proto;
+      if (GET_BIT(flags, 6))
+        key.src_port = pkt->srcPort;
+      if (GET_BIT(flags, 7))
+        key.dst_port = pkt->dstPort;
+    }
+    /* Input port */
+    if (GET_BIT(flags, 8))
+      key.inport = md->in_port;
+
+    struct classifier_value *value = classifier.lookup(&key);
+    if (value && (match == NULL || value->id < match->id))
+      match = value;
+  }
+
+  if (match == NULL) {
+    pcn_log(ctx, LOG_DEBUG, "No rules matched. Dropping.");
+    return RX_DROP;
+  }
+
+  pcn_log(ctx, LOG_DEBUG, "Matched rule %d", match->id);
+  act->action = match->action;
+  act->outport = match->outport;
+  call_ingress_program(ctx, 2);
+
+  return RX_DROP;
+}
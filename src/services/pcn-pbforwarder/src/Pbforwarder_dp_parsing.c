@@ -81,6 +81,7 @@ static __always_inline int handle_rx(struct CTXTYPE *ctx,
   struct tcphdr *tcp = NULL;
   struct udphdr *udp = NULL;
   pkt->ip = 0;
+  pkt->l4proto = 0;
 #if LEVEL > 2
   if (ether_type == bpf_htons(ETH_P_IP)) {
     ip = data + sizeof(*ethernet);
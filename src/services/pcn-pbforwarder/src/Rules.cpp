@@ -398,6 +398,26 @@ void Rules::updateRuleMapAndReload() {
     parent_.match_level = 4;
   }
 
+  if (parent_.classifier_ == PbforwarderClassifierEnum::TUPLE_SPACE) {
+    // the classifier code reads the tuples from a map, only the parser has
+    // to be reloaded when the rule needs a deeper level
+    try {
+      parent_.classifierInstall(id, to_rule());
+      if (parent_.match_level != oldMatchLevel)
+        parent_.reload(parent_.generate_code_parsing(), 0);
+    } catch (std::runtime_error re) {
+      parent_.match_level = oldMatchLevel;
+      parent_.logger()->error("[{0}] Can't insert the rule {1}: {2}",
+                              parent_.Cube::get_name(), id, re.what());
+      throw;
+    }
+    auto it = parent_.rules_.find(id);
+    if (it == parent_.rules_.end()) {
+      parent_.rules_.insert(std::pair<uint32_t, Rules>(id, *this));
+    }
+    return;
+  }
+
   auto rules_table = parent_.get_hash_table<uint32_t, rule>("rules", 1);
   rules_table.set(id, to_rule());
 
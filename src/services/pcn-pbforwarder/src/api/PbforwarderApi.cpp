@@ -250,6 +250,23 @@ Response read_pbforwarder_by_id_handler(
   }
 }
 
+Response read_pbforwarder_classifier_by_id_handler(
+  const char *name, const Key *keys,
+  size_t num_keys ) {
+  // Getting the path params
+  std::string unique_name { name };
+
+  try {
+
+    auto x = read_pbforwarder_classifier_by_id(unique_name);
+    nlohmann::json response_body;
+    response_body = PbforwarderJsonObject::PbforwarderClassifierEnum_to_string(x);
+    return { kOk, ::strdup(response_body.dump().c_str()) };
+  } catch(const std::exception &e) {
+    return { kGenericError, ::strdup(e.what()) };
+  }
+}
+
 Response read_pbforwarder_list_by_id_handler(
   const char *name, const Key *keys,
   size_t num_keys ) {
@@ -46,6 +46,7 @@ Response delete_pbforwarder_ports_list_by_id_handler(const char *name, const Key
 Response delete_pbforwarder_rules_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response delete_pbforwarder_rules_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_pbforwarder_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_pbforwarder_classifier_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_pbforwarder_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_pbforwarder_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_pbforwarder_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
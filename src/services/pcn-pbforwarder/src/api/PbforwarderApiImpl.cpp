@@ -246,6 +246,23 @@ read_pbforwarder_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read classifier by ID
+*
+* Read operation of resource: classifier*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* PbforwarderClassifierEnum
+*/
+PbforwarderClassifierEnum
+read_pbforwarder_classifier_by_id(const std::string &name) {
+  auto pbforwarder = get_cube(name);
+  return pbforwarder->getClassifier();
+
+}
+
 /**
 * @brief   Read ports by ID
 *
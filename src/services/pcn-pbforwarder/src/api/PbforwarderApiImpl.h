@@ -50,6 +50,7 @@ namespace PbforwarderApiImpl {
   void delete_pbforwarder_rules_by_id(const std::string &name, const uint32_t &id);
   void delete_pbforwarder_rules_list_by_id(const std::string &name);
   PbforwarderJsonObject read_pbforwarder_by_id(const std::string &name);
+  PbforwarderClassifierEnum read_pbforwarder_classifier_by_id(const std::string &name);
   std::vector<PbforwarderJsonObject> read_pbforwarder_list_by_id();
   PortsJsonObject read_pbforwarder_ports_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_pbforwarder_ports_list_by_id(const std::string &name);
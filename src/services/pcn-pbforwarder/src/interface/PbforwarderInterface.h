@@ -54,5 +54,10 @@ public:
   virtual void replaceRules(const uint32_t &id, const RulesJsonObject &conf) = 0;
   virtual void delRules(const uint32_t &id) = 0;
   virtual void delRulesList() = 0;
+
+  /// <summary>
+  /// Algorithm used to match the packets against the rules
+  /// </summary>
+  virtual PbforwarderClassifierEnum getClassifier() = 0;
 };
 
@@ -26,6 +26,8 @@ PbforwarderJsonObject::PbforwarderJsonObject() {
   m_nameIsSet = false;
   m_portsIsSet = false;
   m_rulesIsSet = false;
+  m_classifier = PbforwarderClassifierEnum::TUPLE_SPACE;
+  m_classifierIsSet = true;
 }
 
 PbforwarderJsonObject::PbforwarderJsonObject(const nlohmann::json &val) :
@@ -33,6 +35,7 @@ PbforwarderJsonObject::PbforwarderJsonObject(const nlohmann::json &val) :
   m_nameIsSet = false;
   m_portsIsSet = false;
   m_rulesIsSet = false;
+  m_classifierIsSet = false;
 
 
   if (val.count("name")) {
@@ -56,6 +59,10 @@ PbforwarderJsonObject::PbforwarderJsonObject(const nlohmann::json &val) :
 
     m_rulesIsSet = true;
   }
+
+  if (val.count("classifier")) {
+    setClassifier(string_to_PbforwarderClassifierEnum(val.at("classifier").get<std::string>()));
+  }
 }
 
 nlohmann::json PbforwarderJsonObject::toJson() const {
@@ -90,6 +97,10 @@ nlohmann::json PbforwarderJsonObject::toJson() const {
     }
   }
 
+  if (m_classifierIsSet) {
+    val["classifier"] = PbforwarderClassifierEnum_to_string(m_classifier);
+  }
+
   return val;
 }
 
@@ -144,6 +155,42 @@ void PbforwarderJsonObject::unsetRules() {
   m_rulesIsSet = false;
 }
 
+PbforwarderClassifierEnum PbforwarderJsonObject::getClassifier() const {
+  return m_classifier;
+}
+
+void PbforwarderJsonObject::setClassifier(PbforwarderClassifierEnum value) {
+  m_classifier = value;
+  m_classifierIsSet = true;
+}
+
+bool PbforwarderJsonObject::classifierIsSet() const {
+  return m_classifierIsSet;
+}
+
+void PbforwarderJsonObject::unsetClassifier() {
+  m_classifierIsSet = false;
+}
+
+std::string PbforwarderJsonObject::PbforwarderClassifierEnum_to_string(const PbforwarderClassifierEnum &value){
+  switch(value) {
+  case PbforwarderClassifierEnum::LINEAR:
+    return std::string("linear");
+  case PbforwarderClassifierEnum::TUPLE_SPACE:
+    return std::string("tuple_space");
+  default:
+    throw std::runtime_error("Bad Pbforwarder classifier");
+  }
+}
+
+PbforwarderClassifierEnum PbforwarderJsonObject::string_to_PbforwarderClassifierEnum(const std::string &str){
+  if (JsonObjectBase::iequals("linear", str))
+    return PbforwarderClassifierEnum::LINEAR;
+  if (JsonObjectBase::iequals("tuple_space", str))
+    return PbforwarderClassifierEnum::TUPLE_SPACE;
+  throw std::runtime_error("Pbforwarder classifier is invalid");
+}
+
 
 }
 }
@@ -33,6 +33,9 @@ namespace swagger {
 namespace server {
 namespace model {
 
+enum class PbforwarderClassifierEnum {
+  LINEAR, TUPLE_SPACE
+};
 
 /// <summary>
 ///
@@ -68,6 +71,16 @@ public:
   bool rulesIsSet() const;
   void unsetRules();
 
+  /// <summary>
+  /// Algorithm used to match the packets against the rules
+  /// </summary>
+  PbforwarderClassifierEnum getClassifier() const;
+  void setClassifier(PbforwarderClassifierEnum value);
+  bool classifierIsSet() const;
+  void unsetClassifier();
+  static std::string PbforwarderClassifierEnum_to_string(const PbforwarderClassifierEnum &value);
+  static PbforwarderClassifierEnum string_to_PbforwarderClassifierEnum(const std::string &str);
+
 private:
   std::string m_name;
   bool m_nameIsSet;
@@ -75,6 +88,8 @@ private:
   bool m_portsIsSet;
   std::vector<RulesJsonObject> m_rules;
   bool m_rulesIsSet;
+  PbforwarderClassifierEnum m_classifier;
+  bool m_classifierIsSet;
 };
 
 }
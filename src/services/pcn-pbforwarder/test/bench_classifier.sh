@@ -0,0 +1,48 @@
+#!/bin/bash
+
+# Compares the LINEAR and TUPLE_SPACE classifiers with the same rule set:
+# RULES-3 rules that never match and three matching rules at the end.
+# usage: bench_classifier.sh [RULES] [PACKETS]
+# The LINEAR classifier unrolls one check per rule, a few hundred rules are
+# enough to exceed the size limits of the eBPF programs.
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+RULES=${1:-100}
+PACKETS=${2:-10000}
+
+function pbfeanup {
+  set +e
+  polycubectl pbforwarder del pbf1
+  del_veths 2
+}
+trap pbfeanup EXIT
+
+set -e
+
+# setup
+create_veth 2
+
+# Get the MAC addresses of the namespaces
+veth1_mac=`LANG=C sudo ip netns exec ns1 ifconfig -a | grep -Po 'ether \K[a-fA-F0-9:]{17}|[a-fA-F0-9]{12}$'`
+veth2_mac=`LANG=C sudo ip netns exec ns2 ifconfig -a | grep -Po 'ether \K[a-fA-F0-9:]{17}|[a-fA-F0-9]{12}$'`
+
+for classifier in LINEAR TUPLE_SPACE; do
+  polycubectl pbforwarder add pbf1 classifier=$classifier
+
+  pbforwarder_add_port pbf1 veth1
+  pbforwarder_add_port pbf1 veth2
+
+  # Add a bunch of not meaningful rules, mixing levels to use more tuples
+  pbforwarder_add_rules_l2 0 $((RULES/2 - 1)) pbf1
+  pbforwarder_add_rules_l3 $((RULES/2)) $((RULES - 4)) pbf1
+
+  polycubectl pbforwarder pbf1 rules add $((RULES - 3)) dst_mac=FF:FF:FF:FF:FF:FF action=FORWARD out_port=veth2
+  polycubectl pbforwarder pbf1 rules add $((RULES - 2)) dst_mac=$veth1_mac action=FORWARD out_port=veth1
+  polycubectl pbforwarder pbf1 rules add $((RULES - 1)) dst_mac=$veth2_mac action=FORWARD out_port=veth2
+
+  echo "classifier $classifier, $RULES rules"
+  sudo ip netns exec ns1 ping 10.0.0.2 -f -q -c $PACKETS | tail -n 2
+
+  polycubectl pbforwarder del pbf1
+done
@@ -107,6 +107,19 @@ Ports::Ports(polycube::service::Cube<Ports> &parent,
     PortsSecondaryip::createInControlPlane(*this, addr.getIp(), addr);
   }
 
+  /*
+  * Add the IPv6 addresses of the port. The link local address is derived from
+  * the mac and it is always present, while the global address is optional
+  */
+  link_local_ = get_ipv6_link_local_from_mac(mac_);
+  if (conf.ipv6IsSet())
+    ipv6_ = conf.getIpv6();
+  updatePort6InDataPath();
+
+  parent_.add_link_local_route6(link_local_, index);
+  if (!ipv6_.empty())
+    parent_.add_local_route6(ipv6_, getName(), index);
+
   // lambda function to align IP and Netmask between Port and ExtIface
   ParameterEventCallback f_ip;
   f_ip = [&](const std::string param_name, const std::string new_ip) {
@@ -314,6 +327,37 @@ void Ports::delSecondaryipList() {
   PortsBase::delSecondaryipList();
 }
 
+std::string Ports::getIpv6() {
+  // This method retrieves the ipv6 value.
+  return ipv6_;
+}
+
+void Ports::setIpv6(const std::string &value) {
+  // This method set the ipv6 value.
+  if (ipv6_ == value) {
+    return;
+  }
+
+  if (!value.empty() && !is_ipv6(value))
+    throw std::runtime_error("Address " + value + " is not an IPv6 address");
+
+  uint16_t index = this->index();
+
+  /* Update routes in the routing table */
+  if (!ipv6_.empty()) {
+    parent_.remove_local_route6(ipv6_, getName());
+  }
+  ipv6_ = value;
+  updatePort6InDataPath();
+  if (!ipv6_.empty()) {
+    parent_.add_local_route6(ipv6_, getName(), index);
+  }
+
+  logger()->debug(
+      "Updated IPv6 port: {0} (index: {2}) [ipv6: {1}]",
+      getName(), ipv6_, index);
+}
+
 std::string Ports::getMac() {
   // This method retrieves the mac value.
   return mac_;
@@ -361,6 +405,12 @@ void Ports::doSetMac(const std::string &new_mac) {
       getName(), new_mac, getIp(), index);
 
   mac_ = new_mac;
+
+  /* The link local address depends on the mac */
+  parent_.remove_link_local_route6(link_local_);
+  link_local_ = get_ipv6_link_local_from_mac(mac_);
+  updatePort6InDataPath();
+  parent_.add_link_local_route6(link_local_, index);
 }
 
 void Ports::updatePortInDataPath() {
@@ -396,3 +446,18 @@ void Ports::updatePortInDataPath() {
 
   router_port.set(index, value);
 }
+
+void Ports::updatePort6InDataPath() {
+  std::string ip_address;
+  uint32_t prefixlen;
+
+  r_port6 value{};
+  if (!ipv6_.empty()) {
+    split_ipv6_and_prefix(ipv6_, ip_address, prefixlen);
+    value.ip = ipv6_string_to_nbo(ip_address);
+  }
+  value.link_local = ipv6_string_to_nbo(link_local_);
+
+  auto router_port6 = parent_.get_hash_table<uint16_t, r_port6>("router_port6");
+  router_port6.set(index(), value);
+}
@@ -37,6 +37,12 @@ struct r_port {
   uint64_t mac : 48;
 } __attribute__((packed));
 
+/* IPv6 addresses of a Router Port, definition in datapath */
+struct r_port6 {
+  ip6_addr ip;
+  ip6_addr link_local;
+} __attribute__((packed));
+
 using namespace polycube::service::model;
 using namespace polycube::service::utils;
 
@@ -67,6 +73,12 @@ class Ports : public PortsBase {
   void delSecondaryip(const std::string &ip) override;
   void delSecondaryipList() override;
 
+  /// <summary>
+  /// IPv6 address and prefix of the port
+  /// </summary>
+  std::string getIpv6() override;
+  void setIpv6(const std::string &value) override;
+
   /// <summary>
   /// MAC address of the port
   /// </summary>
@@ -76,9 +88,12 @@ class Ports : public PortsBase {
 
  protected:
   void updatePortInDataPath();
+  void updatePort6InDataPath();
 
  private:
   std::string mac_;
   std::string ip_;
+  std::string ipv6_;
+  std::string link_local_;
   std::set<PortsSecondaryip> secondary_ips_;
 };
@@ -51,7 +51,7 @@ class Route : public RouteBase {
   virtual ~Route();
 
   /// <summary>
-  /// Destination network IP
+  /// Destination network IP (IPv4 or IPv6)
   /// </summary>
   std::string getNetwork() override;
 
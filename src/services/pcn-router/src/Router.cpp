@@ -23,9 +23,18 @@ enum {
   SLOWPATH_ARP_REPLY = 1,
   SLOWPATH_ARP_LOOKUP_MISS,
   SLOWPATH_TTL_EXCEEDED,
-  SLOWPATH_PKT_FOR_ROUTER
+  SLOWPATH_PKT_FOR_ROUTER,
+  SLOWPATH_NDP_REPLY,
+  SLOWPATH_NDP_LOOKUP_MISS,
+  SLOWPATH_HOP_LIMIT_EXCEEDED,
+  SLOWPATH_NO_ROUTE6,
+  SLOWPATH_PKT_FOR_ROUTER6
 };
 
+/* RFC 4443: an ICMPv6 error must fit in the minimum IPv6 MTU (1280 bytes) */
+#define ICMPV6_ERROR_MAX_PAYLOAD (1280 - 40 - 8)
+#define NDP_HOP_LIMIT 255
+
 Router::Router(const std::string name, const RouterJsonObject &conf)
   : Cube(conf.getBase(), { router_code }, {}),
     RouterBase(name),
@@ -100,6 +109,26 @@ void Router::packet_in(Ports &port,
     handle_router_pkt(port, md, packet);
     break;
 
+  case SLOWPATH_NDP_LOOKUP_MISS:
+    generate_ndp_solicitation(port, md, packet);
+    break;
+
+  case SLOWPATH_NDP_REPLY:
+    generate_ndp_reply(port, md, packet);
+    break;
+
+  case SLOWPATH_HOP_LIMIT_EXCEEDED:
+    generate_icmp6_error(port, md, packet, ICMPv6::TIME_EXCEEDED, 0);
+    break;
+
+  case SLOWPATH_NO_ROUTE6:
+    generate_icmp6_error(port, md, packet, ICMPv6::DEST_UNREACHABLE, 0);
+    break;
+
+  case SLOWPATH_PKT_FOR_ROUTER6:
+    handle_router_pkt6(port, md, packet);
+    break;
+
   default:
     logger()->error("Not valid reason {0} received", md.reason);
   }
@@ -154,11 +183,17 @@ void Router::delPorts(const std::string &name) {
   if(port->getIp().empty() == false)
     remove_local_route(port->getIp(), name);
 
+  if (!port->getIpv6().empty())
+    remove_local_route6(port->getIpv6(), name);
+  remove_link_local_route6(get_ipv6_link_local_from_mac(port->getMac()));
+
   auto router_port = get_hash_table<uint16_t, r_port>("router_port");
+  auto router_port6 = get_hash_table<uint16_t, r_port6>("router_port6");
 
   // remove the port from the datapath
   uint16_t index = port->index();
   router_port.remove(index);
+  router_port6.remove(index);
   logger()->debug("Removed from 'router_port' - key: {0}", int_to_hex(index));
 
   // call default implementation in base class
@@ -240,6 +275,9 @@ void Router::delRouteList() {
 }
 
 std::shared_ptr<ArpTable> Router::getArpTable(const std::string &address) {
+  if (is_ipv6(address))
+    return getNdpTable(address);
+
   uint32_t ip_key = ip_string_to_nbo_uint(address);
 
   try {
@@ -286,9 +324,59 @@ std::vector<std::shared_ptr<ArpTable>> Router::getArpTableList() {
     throw std::runtime_error("Unable to get the ARP table list");
   }
 
+  // IPv6 neighbors are returned as well
+  auto ndp_entries = getNdpTableList();
+  arp_table_entries.insert(arp_table_entries.end(), ndp_entries.begin(),
+                           ndp_entries.end());
+
   return arp_table_entries;
 }
 
+std::shared_ptr<ArpTable> Router::getNdpTable(const std::string &address) {
+  try {
+    auto ndp_table = get_hash_table<ip6_addr, arp_entry>("ndp_table");
+
+    arp_entry entry = ndp_table.get(ipv6_string_to_nbo(address));
+    std::string mac = nbo_uint_to_mac_string(entry.mac);
+    auto port = get_port(entry.port);
+
+    return std::make_shared<ArpTable>(
+        ArpTable(*this, mac, address, port->name()));
+  } catch (std::exception &e) {
+    logger()->error("Unable to find neighbor entry for address {0}. {1}",
+                    address, e.what());
+    throw std::runtime_error("Neighbor entry not found");
+  }
+}
+
+std::vector<std::shared_ptr<ArpTable>> Router::getNdpTableList() {
+  std::vector<std::shared_ptr<ArpTable>> ndp_table_entries;
+
+  // The neighbor cache is read from the data path
+  try {
+    auto ndp_table = get_hash_table<ip6_addr, arp_entry>("ndp_table");
+    auto ndp_entries = ndp_table.get_all();
+
+    for (auto &entry : ndp_entries) {
+      std::string ip = nbo_to_ipv6_string(entry.first);
+      std::string mac = nbo_uint_to_mac_string(entry.second.mac);
+
+      auto port = get_port(entry.second.port);
+
+      logger()->debug("Returning entry [ip: {0} - mac: {1} - interface: {2}]",
+                      ip, mac, port->name());
+
+      ndp_table_entries.push_back(
+          std::make_shared<ArpTable>(ArpTable(*this, mac, ip, port->name())));
+    }
+  } catch (std::exception &e) {
+    logger()->error("Error while trying to get the neighbor cache");
+    throw std::runtime_error("Unable to get the neighbor cache");
+  }
+
+  return ndp_table_entries;
+}
+
 void Router::addArpTable(const std::string &address,
                          const ArpTableJsonObject &conf) {
   logger()->debug("Creating ARP entry [ip: {0} - mac: {1} - interface: {2}",
@@ -297,6 +385,13 @@ void Router::addArpTable(const std::string &address,
   uint64_t mac = mac_string_to_nbo_uint(conf.getMac());
   uint32_t index = get_port(conf.getInterface())->index();
 
+  if (is_ipv6(address)) {
+    auto ndp_table = get_hash_table<ip6_addr, arp_entry>("ndp_table");
+    ndp_table.set(ipv6_string_to_nbo(address),
+                  arp_entry{.mac = mac, .port = index});
+    return;
+  }
+
   // FIXME: Check if entry already exists?
   auto arp_table = get_hash_table<uint32_t, arp_entry>("arp_table");
   arp_table.set(ip_string_to_nbo_uint(address),
@@ -327,6 +422,16 @@ void Router::delArpTable(const std::string &address) {
     throw std::runtime_error("ARP table entry not found");
   }
 
+  if (is_ipv6(address)) {
+    auto ndp_table = get_hash_table<ip6_addr, arp_entry>("ndp_table");
+    try {
+      ndp_table.remove(ipv6_string_to_nbo(address));
+    } catch (...) {
+      throw std::runtime_error("Neighbor entry not found");
+    }
+    return;
+  }
+
   uint32_t key = ip_string_to_nbo_uint(address);
 
   auto arp_table = get_hash_table<uint32_t, arp_entry>("arp_table");
@@ -352,11 +457,26 @@ void Router::delArpTableList() {
 * Given a nexthop, selects the proper interface of the router to reach it
 */
 std::string Router::search_interface_from_nexthop(const std::string &nexthop) {
+  bool ipv6 = is_ipv6(nexthop);
   for (auto item : routes_) {
     auto &network_ = std::get<0>(item.first);
     auto &nexthop_ = std::get<1>(item.first);
     // ignore non directly reachable routes
-    if (nexthop_ != "local" && nexthop_ != "0.0.0.0") {
+    if (nexthop_ != "local" && nexthop_ != "0.0.0.0" && nexthop_ != "::") {
+      continue;
+    }
+    // ignore routes of the other address family
+    if (is_ipv6(network_) != ipv6) {
+      continue;
+    }
+
+    if (ipv6) {
+      std::string ip_route;
+      uint32_t prefixlen;
+      split_ipv6_and_prefix(network_, ip_route, prefixlen);
+      if (ipv6_address_in_subnet(nexthop, ip_route, prefixlen)) {
+        return item.second.getInterface();
+      }
       continue;
     }
 
@@ -382,9 +502,6 @@ void Router::add_active_nexthop_in_ebpf_map(const std::string &network,
   int index = port_id;
   std::string new_nexthop = nexthop;
   int32_t min = INT32_MAX;
-  std::string ip_route;
-  std::string netmask_route;
-  split_ip_and_prefix(network, ip_route, netmask_route);
 
   // Iterate over the current elements of the routing table
 
@@ -416,6 +533,15 @@ void Router::add_active_nexthop_in_ebpf_map(const std::string &network,
     index = get_port(search_interface_from_nexthop(new_nexthop))->index();
   }
 
+  if (is_ipv6(network)) {
+    set_route6_in_ebpf_map(network, new_nexthop, index);
+    return;
+  }
+
+  std::string ip_route;
+  std::string netmask_route;
+  split_ip_and_prefix(network, ip_route, netmask_route);
+
   // the key in the datapath is given by "network" and "mask length".
   // then, if the nexthop changes, we just replace its value.
   // Please, note that the pathcost is not provided to the datapath, which only
@@ -480,6 +606,11 @@ void Router::remove_all_routes() {
           "Removed route from control plane [network: {0} - nexthop: {1}]",
           network, nexthop);
 
+      if (is_ipv6(network)) {
+        find_new_active_nexthop6(network);
+        continue;
+      }
+
       // retrieve the entry from the fast path for the "netmask" "network", and
       // get the nexthop in order to check whether the route is also in the fast
       // path
@@ -640,6 +771,7 @@ void Router::remove_local_route(const std::string &interface_ip,
   for (auto it = routes_.begin(); it != routes_.end();) {
     if (it->second.getNexthop() !=
             "local" /*"local" are those networks directly connected*/ &&
+        !is_ipv6(it->second.getNexthop()) &&
         address_in_subnet(it->second.getNexthop(), netmask_route,
                           network)) {
       //  it->second.getInterface() == port_name) {
@@ -683,6 +815,11 @@ void Router::remove_local_route(const std::string &interface_ip,
 */
 void Router::find_new_active_nexthop(const std::string &network,
                                      const std::string &nexthop) {
+  if (is_ipv6(network)) {
+    find_new_active_nexthop6(network);
+    return;
+  }
+
   std::string ip_route;
   std::string netmask_route;
   split_ip_and_prefix(network, ip_route, netmask_route);
@@ -752,6 +889,205 @@ void Router::find_new_active_nexthop(const std::string &network,
     logger()->debug("Route not found in the data path");
 }
 
+/*
+* IPv6 routing table management
+*/
+
+/*
+* Write the route towards network in the IPv6 routing table of the datapath
+*/
+void Router::set_route6_in_ebpf_map(const std::string &network,
+                                    const std::string &nexthop,
+                                    int port_index) {
+  std::string ip_route;
+  uint32_t prefixlen;
+  split_ipv6_and_prefix(network, ip_route, prefixlen);
+
+  auto routing_table6 = get_hash_table<rt6_k, rt6_v>("routing_table6");
+
+  rt6_k key{
+      .netmask_len = prefixlen,
+      .network = ipv6_string_to_nbo(ip_route),
+  };
+
+  rt6_v value{
+      .port = uint32_t(port_index),
+      .nexthop = {},
+      .type = TYPE_NOLOCALINTERFACE,
+  };
+  // a directly connected network has no nexthop
+  if (nexthop != "local" && nexthop != "::")
+    value.nexthop = ipv6_string_to_nbo(nexthop);
+
+  routing_table6.set(key, value);
+}
+
+/*
+* Looks for the best route towards an IPv6 network in the control plane.
+* If it is found, the route in the fastpath is updated, otherwise it is removed.
+* Differently from IPv4, the datapath is not read back: the lookup on a lpm
+* map may return a shorter prefix covering the network.
+*/
+void Router::find_new_active_nexthop6(const std::string &network) {
+  int32_t min = INT32_MAX;
+  std::string new_nexthop;
+  std::string new_interface;
+  for (auto &elem : routes_) {
+    if (elem.second.getNetwork() != network)
+      continue;
+
+    if (elem.second.getNexthop() == "local") {
+      // a network directly connected is always active
+      new_nexthop = "::";
+      new_interface = elem.second.getInterface();
+      break;
+    }
+
+    if (elem.second.pathcostIsSet() && elem.second.getPathcost() < min) {
+      new_nexthop = elem.second.getNexthop();
+      new_interface = elem.second.getInterface();
+      min = elem.second.getPathcost();
+    }
+  }
+
+  if (new_nexthop.empty()) {
+    std::string ip_route;
+    uint32_t prefixlen;
+    split_ipv6_and_prefix(network, ip_route, prefixlen);
+    auto routing_table6 = get_hash_table<rt6_k, rt6_v>("routing_table6");
+    rt6_k key{
+        .netmask_len = prefixlen,
+        .network = ipv6_string_to_nbo(ip_route),
+    };
+    try {
+      routing_table6.remove(key);
+    } catch (...) {
+      logger()->debug("Route not found in the data path");
+    }
+    return;
+  }
+
+  set_route6_in_ebpf_map(network, new_nexthop,
+                         get_port(new_interface)->index());
+}
+
+/*
+* Add the routes related to an IPv6 address of a port: the address/128 is
+* local, while the network is directly reachable through the interface
+*/
+void Router::add_local_route6(const std::string &interface_ip,
+                              const std::string &port_name,
+                              const int port_index) {
+  std::string ip_route;
+  uint32_t prefixlen;
+  split_ipv6_and_prefix(interface_ip, ip_route, prefixlen);
+
+  add_link_local_route6(ip_route, port_index);
+
+  logger()->info(
+      "Added route [network: {0}/128 - nexthop: {1} - interface: {2}]",
+      ip_route, "::", port_name);
+
+  if (prefixlen == 128)
+    return;
+
+  std::string network = get_ipv6_network_from_ip(ip_route, prefixlen);
+  std::string route = network + "/" + std::to_string(prefixlen);
+  std::string nexthop("local");
+  std::tuple<string, string> keyF(route, nexthop);
+  uint32_t pathcost = 0;
+
+  routes_.emplace(std::piecewise_construct, std::forward_as_tuple(keyF),
+                  std::forward_as_tuple(*this, route, nexthop,
+                                        port_name, pathcost));
+  set_route6_in_ebpf_map(route, nexthop, port_index);
+
+  logger()->info(
+      "Added route [network: {0} - nexthop: {1} - interface: {2}]",
+      route, "::", port_name);
+}
+
+/*
+* Remove the routes related to an IPv6 address of a port, together with the
+* routes having the nexthop in the network of such an address
+*/
+void Router::remove_local_route6(const std::string &interface_ip,
+                                 const std::string &port_name) {
+  std::string ip_route;
+  uint32_t prefixlen;
+  split_ipv6_and_prefix(interface_ip, ip_route, prefixlen);
+
+  if (prefixlen != 128) {
+    std::string network = get_ipv6_network_from_ip(ip_route, prefixlen);
+    std::string route = network + "/" + std::to_string(prefixlen);
+
+    logger()->debug("Removing routes involving the port {0} and the network {1}",
+                    port_name, route);
+
+    std::set<std::string> changed_networks;
+    for (auto it = routes_.begin(); it != routes_.end();) {
+      std::string cur_nexthop = it->second.getNexthop();
+      bool local = cur_nexthop == "local" &&
+                   it->second.getInterface() == port_name &&
+                   it->second.getNetwork() == route;
+      bool through = cur_nexthop != "local" && is_ipv6(cur_nexthop) &&
+                     ipv6_address_in_subnet(cur_nexthop, network, prefixlen);
+      if (local || through) {
+        logger()->debug(
+            "Removed route from the control plane [network: {0} "
+            "- nexthop: {1} - interface: {2}]",
+            it->second.getNetwork(), cur_nexthop, it->second.getInterface());
+        changed_networks.insert(it->second.getNetwork());
+        routes_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+
+    // Remove or update the routes in the data path
+    for (auto &changed : changed_networks)
+      find_new_active_nexthop6(changed);
+  }
+
+  remove_link_local_route6(ip_route);
+}
+
+/*
+* Add the address/128 local route, used for link local addresses as well
+*/
+void Router::add_link_local_route6(const std::string &link_local,
+                                   const int port_index) {
+  auto routing_table6 = get_hash_table<rt6_k, rt6_v>("routing_table6");
+
+  rt6_k key{
+      .netmask_len = 128,
+      .network = ipv6_string_to_nbo(link_local),
+  };
+
+  rt6_v value{
+      .port = uint32_t(port_index),
+      .nexthop = {},
+      .type = TYPE_LOCALINTERFACE,
+  };
+
+  routing_table6.set(key, value);
+}
+
+void Router::remove_link_local_route6(const std::string &link_local) {
+  auto routing_table6 = get_hash_table<rt6_k, rt6_v>("routing_table6");
+
+  rt6_k key{
+      .netmask_len = 128,
+      .network = ipv6_string_to_nbo(link_local),
+  };
+
+  try {
+    routing_table6.remove(key);
+  } catch (...) {
+    logger()->debug("Route to {0} not found in the data path", link_local);
+  }
+}
+
 /*
 * Methods to manage packets coming from the fast path
 */
@@ -943,6 +1279,223 @@ void Router::generate_arp_reply(Port &port, PacketInMetadata &md,
   mu.unlock();
 }
 
+/*
+* IPv6 packets coming from the fast path
+*/
+
+/*
+* Address used by the router as source of the IPv6 packets generated on a port
+*/
+std::string Router::get_ipv6_source_address(Ports &port) {
+  if (port.getIpv6().empty())
+    return get_ipv6_link_local_from_mac(port.getMac());
+
+  std::string ip;
+  uint32_t prefixlen;
+  split_ipv6_and_prefix(port.getIpv6(), ip, prefixlen);
+  return ip;
+}
+
+void Router::handle_router_pkt6(Ports &port, PacketInMetadata &md,
+                                const std::vector<uint8_t> &packet) {
+  EthernetII p(&packet[0], packet.size());
+  IPv6 &ip6 = p.rfind_pdu<IPv6>();
+  ICMPv6 *icmp = p.find_pdu<ICMPv6>();
+
+  /*To implement: handle other type of pkts */
+  if (!icmp)
+    return;
+
+  if (icmp->type() == ICMPv6::ECHO_REQUEST) {
+    logger()->info("new ipv6 echo request arrived from {0} to {1}",
+                   ip6.src_addr().to_string(), ip6.dst_addr().to_string());
+
+    EthernetII echoreply_packet(p.src_addr(), p.dst_addr());
+    IPv6 ip_header(ip6.src_addr(), ip6.dst_addr());
+    ip_header.hop_limit(64);
+    echoreply_packet /= ip_header;
+
+    ICMPv6 echoreply = *icmp;
+    echoreply.type(ICMPv6::ECHO_REPLY);
+    echoreply_packet /= echoreply;
+
+    port.send_packet_out(echoreply_packet);
+  } else if (icmp->type() == ICMPv6::NEIGHBOUR_SOLICIT) {
+    // solicitations not handled by the fast path, e.g. with a nonce option
+    IPv6Address target = icmp->target_addr();
+    std::string own_ip = port.getIpv6().empty() ? "" : get_ipv6_source_address(port);
+    if (target.to_string() != own_ip &&
+        target.to_string() != get_ipv6_link_local_from_mac(port.getMac()))
+      return;
+
+    // duplicate address detection, the address is already ours
+    if (ip6.src_addr() == IPv6Address()) {
+      logger()->warn("duplicate address detection for {0} on port {1}",
+                     target.to_string(), port.name());
+      return;
+    }
+
+    // register the soliciting neighbor
+    auto ndp_table = get_hash_table<ip6_addr, arp_entry>("ndp_table");
+    ndp_table.set(ipv6_string_to_nbo(ip6.src_addr().to_string()),
+                  arp_entry{.mac = mac_string_to_nbo_uint(p.src_addr().to_string()),
+                            .port = uint32_t(port.index())});
+
+    HWAddress<6> port_mac(port.getMac());
+    EthernetII na_packet(p.src_addr(), port_mac);
+    IPv6 ip_header(ip6.src_addr(), target);
+    ip_header.hop_limit(NDP_HOP_LIMIT);
+    na_packet /= ip_header;
+
+    ICMPv6 na(ICMPv6::NEIGHBOUR_ADVERT);
+    na.target_addr(target);
+    na.router(1);
+    na.solicited(1);
+    na.override(1);
+    na.target_link_layer_addr(port_mac);
+    na_packet /= na;
+
+    port.send_packet_out(na_packet);
+  }
+}
+
+void Router::generate_icmp6_error(Ports &port, PacketInMetadata &md,
+                                  const std::vector<uint8_t> &packet,
+                                  ICMPv6::Types type, uint8_t code) {
+  EthernetII p(&packet[0], packet.size());
+  IPv6 &ip6 = p.rfind_pdu<IPv6>();
+
+  /* RFC 4443: no errors are sent to multicast or unspecified sources, nor in
+   * response to other errors */
+  if (ip6.src_addr().is_multicast() || ip6.src_addr() == IPv6Address())
+    return;
+  ICMPv6 *icmp = p.find_pdu<ICMPv6>();
+  if (icmp && icmp->type() < ICMPv6::ECHO_REQUEST)
+    return;
+
+  IPv6Address dst_ip(ip6.src_addr());
+  IPv6Address src_ip(get_ipv6_source_address(port));
+
+  logger()->info("send ICMPv6 packet type {0} code {1} to host {2}",
+                 int(type), int(code), dst_ip.to_string());
+
+  // the invoking packet, as much as fits in the minimum MTU
+  PDU::serialization_type original = ip6.serialize();
+  size_t len = std::min<size_t>(original.size(), ICMPV6_ERROR_MAX_PAYLOAD);
+
+  EthernetII icmp_packet(p.src_addr(), p.dst_addr());
+  IPv6 ip_header(dst_ip, src_ip);
+  ip_header.hop_limit(64);
+  icmp_packet /= ip_header;
+
+  ICMPv6 error(type);
+  error.code(code);
+  error.inner_pdu(RawPDU(&original[0], len));
+  icmp_packet /= error;
+
+  port.send_packet_out(icmp_packet);
+}
+
+void Router::generate_ndp_solicitation(Port &port, PacketInMetadata &md,
+                                       const std::vector<uint8_t> &packet) {
+  EthernetII p(&packet[0], packet.size());
+  IPv6 &ip6 = p.rfind_pdu<IPv6>();
+
+  int index = md.metadata[0];  // out port index
+  auto port_out = get_port(index);
+
+  /* target is the nexthop of the route or the destination host if the route is
+   * local */
+  std::string target = ip6.dst_addr().to_string();
+  auto routing_table6 = get_hash_table<rt6_k, rt6_v>("routing_table6");
+  try {
+    rt6_v value = routing_table6.get(
+        rt6_k{.netmask_len = 128, .network = ipv6_string_to_nbo(target)});
+    ip6_addr zero{};
+    if (memcmp(&value.nexthop, &zero, sizeof(zero)))
+      target = nbo_to_ipv6_string(value.nexthop);
+  } catch (...) {
+    logger()->debug("No route towards {0}", target);
+    return;
+  }
+
+  // save packet using the target for send it after the neighbor advertisement
+  mu.lock();
+  auto iter = ndp_request_map.find(target);
+  if (iter == ndp_request_map.end()) {  // no queue present, create one
+    CircularBuffer q;
+    q.enQueue(packet);
+    ndp_request_map[target] = q;
+  } else {  // queue exists, add element
+    iter->second.enQueue(packet);
+  }
+  mu.unlock();
+
+  /* prepare the neighbor solicitation, sent to the solicited-node multicast
+   * address of the target from the link local address of the port */
+  ip6_addr t = ipv6_string_to_nbo(target);
+  ip6_addr snm = ipv6_string_to_nbo("ff02::1:ff00:0");
+  snm.addr[13] = t.addr[13];
+  snm.addr[14] = t.addr[14];
+  snm.addr[15] = t.addr[15];
+  uint8_t snm_mac[6] = {0x33, 0x33, 0xff, t.addr[13], t.addr[14], t.addr[15]};
+
+  HWAddress<6> src_mac_addr(port_out->getMac());
+  IPv6Address src_ip_addr(get_ipv6_link_local_from_mac(port_out->getMac()));
+
+  logger()->debug(
+      "sending neighbor solicitation on port {0} 'who has {1} tell {2}'",
+      port_out->name(), target, src_ip_addr.to_string());
+
+  EthernetII ns_packet(HWAddress<6>(snm_mac), src_mac_addr);
+  IPv6 ip_header(IPv6Address(nbo_to_ipv6_string(snm)), src_ip_addr);
+  ip_header.hop_limit(NDP_HOP_LIMIT);
+  ns_packet /= ip_header;
+
+  ICMPv6 ns(ICMPv6::NEIGHBOUR_SOLICIT);
+  ns.target_addr(IPv6Address(target));
+  ns.source_link_layer_addr(src_mac_addr);
+  ns_packet /= ns;
+
+  port_out->send_packet_out(ns_packet);
+}
+
+void Router::generate_ndp_reply(Port &port, PacketInMetadata &md,
+                                const std::vector<uint8_t> &packet) {
+  EthernetII na(&packet[0], packet.size());
+  ICMPv6 &icmp = na.rfind_pdu<ICMPv6>();
+
+  std::string target = icmp.target_addr().to_string();
+  logger()->info("Neighbor advertisement '{0} is at {1}'", target,
+                 na.src_addr().to_string());
+
+  // send all the packets waiting for the neighbor
+  std::lock_guard<std::mutex> guard(mu);
+  auto iter = ndp_request_map.find(target);
+  if (iter == ndp_request_map.end()) {
+    logger()->info("no packet found for neighbor advertisement");
+    return;
+  }
+
+  CircularBuffer q = iter->second;
+  ndp_request_map.erase(iter);
+  while (!q.isEmpty()) {
+    std::vector<uint8_t> pending = q.deQueue();
+    EthernetII ethframe(&pending[0], pending.size());
+
+    // the packet was not forwarded by the fast path yet
+    IPv6 &ip6 = ethframe.rfind_pdu<IPv6>();
+    if (ip6.hop_limit() <= 1)
+      continue;
+    ip6.hop_limit(ip6.hop_limit() - 1);
+
+    ethframe.src_addr(na.dst_addr());
+    ethframe.dst_addr(na.src_addr());
+
+    port.send_packet_out(ethframe);
+  }
+}
+
 /* Netlink */
 void Router::netlink_notification_route_added(int ifindex, const std::string &info_route) {
   std::lock_guard<std::mutex> guard(router_mutex);
@@ -50,6 +50,19 @@ struct rt_v {
   uint8_t type;
 } __attribute__((packed));
 
+/* IPv6 Routing Table Key */
+struct rt6_k {
+  uint32_t netmask_len;
+  ip6_addr network;
+} __attribute__((packed));
+
+/* IPv6 Routing Table Value */
+struct rt6_v {
+  uint32_t port;
+  ip6_addr nexthop;
+  uint8_t type;
+} __attribute__((packed));
+
 class Router : public RouterBase {
   friend class Ports;
   friend class Route;
@@ -125,6 +138,19 @@ class Router : public RouterBase {
 
   void remove_all_routes();
 
+  // IPv6 counterparts of the methods above
+
+  void add_local_route6(const std::string &interface_ip,
+                        const std::string &port_name, const int port_index);
+
+  void remove_local_route6(const std::string &interface_ip,
+                           const std::string &port_name);
+
+  void add_link_local_route6(const std::string &link_local,
+                             const int port_index);
+
+  void remove_link_local_route6(const std::string &link_local);
+
 
   /* SHADOW */
 
@@ -151,6 +177,9 @@ class Router : public RouterBase {
   // Circular buffer
   std::map<unsigned int, CircularBuffer> arp_request_map;
 
+  // Packets waiting for a neighbor advertisement, keyed by the ipv6 address
+  std::map<std::string, CircularBuffer> ndp_request_map;
+
   // The following methods have been added by hand
 
   // Methods to manage packets coming from the fast path
@@ -165,6 +194,18 @@ class Router : public RouterBase {
   void generate_arp_reply(Port &port, PacketInMetadata &md,
                           const std::vector<uint8_t> &packet);
 
+  // IPv6 packets coming from the fast path
+  void handle_router_pkt6(Ports &port, PacketInMetadata &md,
+                          const std::vector<uint8_t> &packet);
+  void generate_icmp6_error(Ports &port, PacketInMetadata &md,
+                            const std::vector<uint8_t> &packet,
+                            ICMPv6::Types type, uint8_t code);
+  void generate_ndp_solicitation(Port &port, PacketInMetadata &md,
+                                 const std::vector<uint8_t> &packet);
+  void generate_ndp_reply(Port &port, PacketInMetadata &md,
+                          const std::vector<uint8_t> &packet);
+  std::string get_ipv6_source_address(Ports &port);
+
   // Methods to manage the routing table
   void find_new_active_nexthop(const std::string &network,
                                const std::string &nexthop);
@@ -174,4 +215,10 @@ class Router : public RouterBase {
                       const int port_index);
   void remove_linux_route(const std::string &network, const std::string &prefix,
                       const std::string &nexthop, const std::string &port_name);
+
+  void set_route6_in_ebpf_map(const std::string &network,
+                              const std::string &nexthop, int port_index);
+  void find_new_active_nexthop6(const std::string &network);
+  std::shared_ptr<ArpTable> getNdpTable(const std::string &address);
+  std::vector<std::shared_ptr<ArpTable>> getNdpTableList();
 };
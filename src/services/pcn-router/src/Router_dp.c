@@ -19,11 +19,13 @@
 #include <uapi/linux/bpf.h>
 #include <uapi/linux/filter.h>
 #include <uapi/linux/icmp.h>
+#include <uapi/linux/icmpv6.h>
 #include <uapi/linux/if_arp.h>
 #include <uapi/linux/if_ether.h>
 #include <uapi/linux/if_packet.h>
 #include <uapi/linux/in.h>
 #include <uapi/linux/ip.h>
+#include <uapi/linux/ipv6.h>
 #include <uapi/linux/pkt_cls.h>
 #include <uapi/linux/udp.h>
 
@@ -31,6 +33,8 @@
 #define ROUTING_TABLE_DIM 256
 #define ROUTER_PORT_N 32
 #define ARP_TABLE_DIM 1024
+#define ROUTING_TABLE6_DIM 256
+#define NDP_TABLE_DIM 1024
 #define MAX_SECONDARY_ADDRESSES 5 // also defined in Ports.h
 #define TYPE_NOLOCALINTERFACE 0  // used to compare the 'type' field in the rt_v
 #define TYPE_LOCALINTERFACE 1
@@ -39,11 +43,22 @@
   (sizeof(struct eth_hdr) + sizeof(struct iphdr) + \
    offsetof(struct icmphdr, checksum))
 #define MAC_MULTICAST_MASK 0x1ULL  // network byte order
+#define NDISC_NEIGHBOUR_SOLICITATION 135
+#define NDISC_NEIGHBOUR_ADVERTISEMENT 136
+#define ND_OPT_SOURCE_LL_ADDR 1
+#define ND_OPT_TARGET_LL_ADDR 2
+#define ND_NA_FLAGS 0xe0000000  // router, solicited, override
+#define NDP_HOP_LIMIT 255
 enum {
   SLOWPATH_ARP_REPLY = 1,
   SLOWPATH_ARP_LOOKUP_MISS,
   SLOWPATH_TTL_EXCEEDED,
-  SLOWPATH_PKT_FOR_ROUTER
+  SLOWPATH_PKT_FOR_ROUTER,
+  SLOWPATH_NDP_REPLY,
+  SLOWPATH_NDP_LOOKUP_MISS,
+  SLOWPATH_HOP_LIMIT_EXCEEDED,
+  SLOWPATH_NO_ROUTE6,
+  SLOWPATH_PKT_FOR_ROUTER6
 };
 /* Routing Table Key */
 struct rt_k {
@@ -85,6 +100,36 @@ struct arp_entry {
 } __attribute__((packed));
 BPF_TABLE("hash", u32, struct arp_entry, arp_table, ARP_TABLE_DIM);
 
+/* IPv6 address, kept as four words to make comparisons cheap */
+struct ip6_addr {
+  __be32 addr[4];
+};
+/* IPv6 Routing Table Key */
+struct rt6_k {
+  u32 netmask_len;
+  struct ip6_addr network;
+};
+/* IPv6 Routing Table Value, also defined in Router.h */
+struct rt6_v {
+  u32 port;
+  struct ip6_addr nexthop;
+  u8 type;
+} __attribute__((packed));
+/* IPv6 addresses of a Router Port, also defined in Ports.h
+the link local address is derived from the port mac (EUI-64)
+*/
+struct r_port6 {
+  struct ip6_addr ip;
+  struct ip6_addr link_local;
+};
+BPF_F_TABLE("lpm_trie", struct rt6_k, struct rt6_v, routing_table6,
+            ROUTING_TABLE6_DIM, BPF_F_NO_PREALLOC);
+BPF_TABLE("hash", u16, struct r_port6, router_port6, ROUTER_PORT_N);
+/*
+Neighbor cache, the IPv6 counterpart of the arp table.
+*/
+BPF_TABLE("hash", struct ip6_addr, struct arp_entry, ndp_table, NDP_TABLE_DIM);
+
 struct eth_hdr {
   __be64 dst : 48;
   __be64 src : 48;
@@ -101,6 +146,25 @@ struct arp_hdr {
   __be64 ar_tha : 48;   /* target hardware address	*/
   __be32 ar_tip;        /* target IP address		*/
 } __attribute__((packed));
+/* Neighbor solicitation/advertisement carrying a single link-layer address
+option, that is the format used for address resolution */
+struct nd_msg {
+  u8 type;
+  u8 code;
+  __sum16 checksum;
+  __be32 flags;
+  struct ip6_addr target;
+  u8 opt_type;
+  u8 opt_len;  // in units of 8 bytes
+  __be64 opt_mac : 48;
+} __attribute__((packed));
+/* IPv6 pseudo-header used in the ICMPv6 checksum */
+struct ip6_pseudo_hdr {
+  struct ip6_addr saddr;
+  struct ip6_addr daddr;
+  __be32 len;
+  __be32 nexthdr;
+};
 /*the function checks if the packet is an ICMP ECHO REQUEST and source mac is
 * not equal to in_port mac, if it is true sends the
 * packet to the slowpath. The slowpath searchs if the destination ip is one of
@@ -265,6 +329,145 @@ static inline int notify_arp_reply_to_slowpath(struct CTXTYPE *ctx,
 static inline int is_ether_mcast(__be64 mac_address) {
   return (mac_address & (__be64)MAC_MULTICAST_MASK);
 }
+static inline int ip6_addr_equal(struct ip6_addr *a, struct ip6_addr *b) {
+  return a->addr[0] == b->addr[0] && a->addr[1] == b->addr[1] &&
+         a->addr[2] == b->addr[2] && a->addr[3] == b->addr[3];
+}
+static inline int ip6_addr_is_zero(struct ip6_addr *a) {
+  return !(a->addr[0] | a->addr[1] | a->addr[2] | a->addr[3]);
+}
+static inline int ip6_addr_is_mcast(struct ip6_addr *a) {
+  return (bpf_ntohl(a->addr[0]) & 0xff000000) == 0xff000000;
+}
+static inline int ip6_addr_is_link_local(struct ip6_addr *a) {
+  return (bpf_ntohl(a->addr[0]) & 0xffc00000) == 0xfe800000;
+}
+/* ICMPv6 checksum of a neighbor discovery message, both the pseudo-header and
+* the message are on the stack, so the same code works for TC and XDP
+*/
+static inline __sum16 nd_checksum(struct ip6_pseudo_hdr *ph,
+                                  struct nd_msg *nd) {
+  __u32 sum = 0;
+  __be16 *buf = (__be16 *)ph;
+#pragma unroll
+  for (int i = 0; i < sizeof(*ph) / 2; i++)
+    sum += buf[i];
+  buf = (__be16 *)nd;
+#pragma unroll
+  for (int i = 0; i < sizeof(*nd) / 2; i++)
+    sum += buf[i];
+  sum = (sum & 0xffff) + (sum >> 16);
+  sum = (sum & 0xffff) + (sum >> 16);
+  return ~sum;
+}
+/*when a neighbor solicitation is received, the router controls if the target
+* is one of the addresses of the ingress port,
+* if it is true, it answers with a neighbor advertisement on the same port
+*/
+static inline int send_ndp_advertisement(struct CTXTYPE *ctx,
+                                         struct pkt_metadata *md,
+                                         struct eth_hdr *eth,
+                                         struct ipv6hdr *ip6,
+                                         struct nd_msg *nd,
+                                         struct r_port6 *in_port6,
+                                         __be64 mac_port) {
+  struct nd_msg na = *nd;
+  if (!ip6_addr_equal(&na.target, &in_port6->ip) &&
+      !ip6_addr_equal(&na.target, &in_port6->link_local))
+    return RX_DROP;
+
+  pcn_log(ctx, LOG_DEBUG, "somebody is soliciting my ipv6 address");
+
+  struct ip6_pseudo_hdr ph = {};
+  __builtin_memcpy(&ph.daddr, &ip6->saddr, sizeof(ph.daddr));
+  ph.saddr = na.target;
+  ph.len = bpf_htonl(sizeof(na));
+  ph.nexthdr = bpf_htonl(IPPROTO_ICMPV6);
+
+  /* register the soliciting neighbor */
+  __be64 remotemac = na.opt_mac;
+  struct arp_entry entry;
+  entry.mac = remotemac;
+  entry.port = md->in_port;
+  ndp_table.update(&ph.daddr, &entry);
+
+  na.type = NDISC_NEIGHBOUR_ADVERTISEMENT;
+  na.code = 0;
+  na.flags = bpf_htonl(ND_NA_FLAGS);
+  na.opt_type = ND_OPT_TARGET_LL_ADDR;
+  na.opt_mac = mac_port;
+  na.checksum = 0;
+  na.checksum = nd_checksum(&ph, &na);
+
+  *nd = na;
+  __builtin_memcpy(&ip6->saddr, &ph.saddr, sizeof(ph.saddr));
+  __builtin_memcpy(&ip6->daddr, &ph.daddr, sizeof(ph.daddr));
+  ip6->hop_limit = NDP_HOP_LIMIT;
+  eth->dst = remotemac;
+  eth->src = mac_port;
+  return pcn_pkt_redirect(ctx, md, md->in_port);
+}
+static inline int notify_ndp_reply_to_slowpath(struct CTXTYPE *ctx,
+                                               struct pkt_metadata *md,
+                                               struct nd_msg *nd) {
+  pcn_log(ctx, LOG_DEBUG, "packet is neighbor advertisement");
+
+  struct ip6_addr ip_ = nd->target;
+  struct arp_entry entry;
+  entry.mac = nd->opt_mac;
+  entry.port = md->in_port;
+  ndp_table.update(&ip_, &entry);
+  // notify the slowpath. New neighbor advertisement received, the target
+  // address is read from the packet
+  u32 mdata[3];
+  mdata[0] = md->in_port;
+  pcn_pkt_controller_with_metadata(ctx, md, SLOWPATH_NDP_REPLY, mdata);
+  return RX_DROP;
+}
+/* the ipv6 counterpart of the metadata based slowpath calls, the addresses do
+* not fit in the metadata and are read by the slowpath from the packet
+*/
+static inline int send_ipv6_to_slowpath(struct CTXTYPE *ctx,
+                                        struct pkt_metadata *md, u16 reason,
+                                        u32 port) {
+  u32 mdata[3];
+  mdata[0] = port;
+  pcn_pkt_controller_with_metadata(ctx, md, reason, mdata);
+  return RX_DROP;
+}
+static inline int send_ipv6_packet_to_output_interface(
+    struct CTXTYPE *ctx, struct pkt_metadata *md, struct eth_hdr *eth,
+    struct ipv6hdr *ip6, struct rt6_v *rt6_entry_p) {
+  struct ip6_addr dst_ip;
+  if (ip6_addr_is_zero(&rt6_entry_p->nexthop))
+    // Next Hop is local, directly lookup in ndp table for the destination ip.
+    __builtin_memcpy(&dst_ip, &ip6->daddr, sizeof(dst_ip));
+  else
+    // Next Hop not local, lookup in ndp table for the next hop ip address.
+    dst_ip = rt6_entry_p->nexthop;
+
+  u16 out_port = rt6_entry_p->port;
+  struct r_port *r_port_p = router_port.lookup(&out_port);
+  if (!r_port_p) {
+    pcn_log(ctx, LOG_ERR, "out port '%d' not found", out_port);
+    return RX_DROP;
+  }
+
+  struct arp_entry *entry = ndp_table.lookup(&dst_ip);
+  if (!entry) {
+    pcn_log(ctx, LOG_DEBUG, "ndp lookup failed. Send to controller");
+    return send_ipv6_to_slowpath(ctx, md, SLOWPATH_NDP_LOOKUP_MISS, out_port);
+  }
+
+  pcn_log(ctx, LOG_TRACE, "in: %d out: %d REDIRECT", md->in_port, out_port);
+
+  eth->dst = entry->mac;
+  eth->src = r_port_p->mac;
+  /* Decrement Hop Limit, no checksum in the IPv6 header */
+  ip6->hop_limit--;
+
+  return pcn_pkt_redirect(ctx, md, out_port);
+}
 static int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
   void *data = (void *)(long)ctx->data;
   void *data_end = (void *)(long)ctx->data_end;
@@ -298,6 +501,8 @@ unicast address of the router port.  If not, drop the packet.
     goto IP;  // ipv4 packet
   case htons(ETH_P_ARP):
     goto ARP;  // arp packet
+  case htons(ETH_P_IPV6):
+    goto IP6;  // ipv6 packet
   default:
     goto DROP;
   }
@@ -347,6 +552,82 @@ ARP:;  // arp packet
   } else if (arp->ar_op == bpf_htons(ARPOP_REPLY))  // arp reply
     return notify_arp_reply_to_slowpath(ctx, md, arp);
   return RX_DROP;
+IP6:;  // ipv6 packet
+  struct ipv6hdr *ip6 = data + sizeof(*eth);
+  if (data + sizeof(*eth) + sizeof(*ip6) > data_end)
+    goto DROP;
+
+  pcn_log(ctx, LOG_TRACE, "hop limit: %u", ip6->hop_limit);
+
+  if (ip6->nexthdr == IPPROTO_ICMPV6) {
+    struct nd_msg *nd = data + sizeof(*eth) + sizeof(*ip6);
+    if ((void *)nd + sizeof(struct icmp6hdr) > data_end)
+      goto DROP;
+    if (nd->type == NDISC_NEIGHBOUR_SOLICITATION ||
+        nd->type == NDISC_NEIGHBOUR_ADVERTISEMENT) {
+      // RFC 4861, neighbor discovery messages are never forwarded
+      if (ip6->hop_limit != NDP_HOP_LIMIT)
+        goto DROP;
+      struct r_port6 *in_port6 = router_port6.lookup(&in_port_index);
+      if (!in_port6)
+        goto DROP;
+      /* messages carrying other options than the link-layer address (e.g.
+       * duplicate address detection) are left to the slowpath */
+      if ((void *)(nd + 1) > data_end ||
+          ip6->payload_len != bpf_htons(sizeof(*nd)) ||
+          nd->opt_len != 1) {
+#ifdef SHADOW
+        return pcn_pkt_redirect_ns(ctx, md, md->in_port);
+#endif
+        return send_ipv6_to_slowpath(ctx, md, SLOWPATH_PKT_FOR_ROUTER6,
+                                     md->in_port);
+      }
+      if (nd->type == NDISC_NEIGHBOUR_SOLICITATION &&
+          nd->opt_type == ND_OPT_SOURCE_LL_ADDR) {
+#ifdef SHADOW
+        return pcn_pkt_redirect_ns(ctx, md, md->in_port);
+#endif
+        return send_ndp_advertisement(ctx, md, eth, ip6, nd, in_port6,
+                                      in_port->mac);
+      }
+      if (nd->type == NDISC_NEIGHBOUR_ADVERTISEMENT &&
+          nd->opt_type == ND_OPT_TARGET_LL_ADDR)
+        return notify_ndp_reply_to_slowpath(ctx, md, nd);
+      goto DROP;
+    }
+  }
+
+  struct rt6_k k6 = {128};
+  __builtin_memcpy(&k6.network, &ip6->daddr, sizeof(k6.network));
+  // multicast is not routed
+  if (ip6_addr_is_mcast(&k6.network))
+    goto DROP;
+
+  struct rt6_v *rt6_entry_p = routing_table6.lookup(&k6);
+  if (!rt6_entry_p) {
+    pcn_log(ctx, LOG_TRACE, "no ipv6 routing table match");
+    // link local destinations that are not ours are silently dropped
+    if (ip6_addr_is_link_local(&k6.network))
+      goto DROP;
+    return send_ipv6_to_slowpath(ctx, md, SLOWPATH_NO_ROUTE6, md->in_port);
+  }
+  /* Check if the pkt destination is one local interface of the router */
+  if (rt6_entry_p->type == TYPE_LOCALINTERFACE) {
+#ifdef SHADOW
+    return pcn_pkt_redirect_ns(ctx, md, md->in_port);
+#endif
+    return send_ipv6_to_slowpath(ctx, md, SLOWPATH_PKT_FOR_ROUTER6,
+                                 md->in_port);
+  }
+  if (ip6_addr_is_link_local(&k6.network))
+    goto DROP;
+  if (ip6->hop_limit <= 1) {
+    pcn_log(ctx, LOG_DEBUG, "packet DROP (hop limit = %u)", ip6->hop_limit);
+    return send_ipv6_to_slowpath(ctx, md, SLOWPATH_HOP_LIMIT_EXCEEDED,
+                                 md->in_port);
+  }
+  // redirect packet to out interface
+  return send_ipv6_packet_to_output_interface(ctx, md, eth, ip6, rt6_entry_p);
 DROP:
   pcn_log(ctx, LOG_TRACE, "in: %d out: -- DROP", md->in_port);
   return RX_DROP;
@@ -17,6 +17,8 @@
 #include "Utils.h"
 #include "Router.h"
 
+#include <arpa/inet.h>
+
 /*utility methods*/
 
 std::string int_to_hex(int t) {
@@ -96,3 +98,69 @@ bool is_netmask_valid(const std::string &netmask) {
     return true;
   }
 }
+
+bool is_ipv6(const std::string &ip) {
+  return ip.find(':') != std::string::npos;
+}
+
+ip6_addr ipv6_string_to_nbo(const std::string &ip) {
+  ip6_addr addr;
+  if (inet_pton(AF_INET6, ip.c_str(), addr.addr) != 1)
+    throw std::runtime_error("IPv6 address " + ip + " is not in a valid format");
+  return addr;
+}
+
+std::string nbo_to_ipv6_string(const ip6_addr &ip) {
+  char buffer[INET6_ADDRSTRLEN];
+  inet_ntop(AF_INET6, ip.addr, buffer, sizeof(buffer));
+  return std::string(buffer);
+}
+
+void split_ipv6_and_prefix(const std::string &ip_and_prefix, std::string &ip,
+                           uint32_t &prefixlen) {
+  auto pos = ip_and_prefix.find('/');
+  if (pos == std::string::npos) {
+    ip = ip_and_prefix;
+    prefixlen = 128;
+    return;
+  }
+  ip = ip_and_prefix.substr(0, pos);
+  prefixlen = std::stoul(ip_and_prefix.substr(pos + 1));
+  if (prefixlen > 128)
+    throw std::runtime_error("IPv6 prefix length is not valid");
+}
+
+std::string get_ipv6_network_from_ip(const std::string &ip,
+                                     uint32_t prefixlen) {
+  ip6_addr addr = ipv6_string_to_nbo(ip);
+  for (int i = 0; i < 16; i++) {
+    int bits = (int)prefixlen - i * 8;
+    if (bits >= 8)
+      continue;
+    addr.addr[i] &= bits <= 0 ? 0 : (uint8_t)(0xff << (8 - bits));
+  }
+  return nbo_to_ipv6_string(addr);
+}
+
+bool ipv6_address_in_subnet(const std::string &ip, const std::string &network,
+                            uint32_t prefixlen) {
+  return get_ipv6_network_from_ip(ip, prefixlen) ==
+         get_ipv6_network_from_ip(network, prefixlen);
+}
+
+std::string get_ipv6_link_local_from_mac(const std::string &mac) {
+  uint64_t mac_nbo = mac_string_to_nbo_uint(mac);
+  uint8_t *m = (uint8_t *)&mac_nbo;
+  ip6_addr addr = {};
+  addr.addr[0] = 0xfe;
+  addr.addr[1] = 0x80;
+  addr.addr[8] = m[0] ^ 0x02;
+  addr.addr[9] = m[1];
+  addr.addr[10] = m[2];
+  addr.addr[11] = 0xff;
+  addr.addr[12] = 0xfe;
+  addr.addr[13] = m[3];
+  addr.addr[14] = m[4];
+  addr.addr[15] = m[5];
+  return nbo_to_ipv6_string(addr);
+}
@@ -14,10 +14,18 @@
  * limitations under the License.
  */
 
+#pragma once
+
 /*utility methods*/
 
+#include <cstdint>
 #include <string>
 
+/* IPv6 address in network byte order, as stored in the datapath */
+struct ip6_addr {
+  uint8_t addr[16];
+};
+
 /* Take in ingress any int and return the hex in the form "0x.." */
 std::string int_to_hex(int t);
 
@@ -33,3 +41,27 @@ std::string get_network_from_ip(const std::string &ip,
                                 const std::string &netmask);
 
 bool is_netmask_valid(const std::string &netmask);
+
+/* IPv6 helpers */
+
+/* Return true if the address (or prefix) is an IPv6 one */
+bool is_ipv6(const std::string &ip);
+
+/* Convert an IPv6 address from/to the network byte order representation */
+ip6_addr ipv6_string_to_nbo(const std::string &ip);
+std::string nbo_to_ipv6_string(const ip6_addr &ip);
+
+/* Take in ingress an IPv6 address with prefix ("2001:db8::1/64") and split it
+*  in the address and the prefix length */
+void split_ipv6_and_prefix(const std::string &ip_and_prefix, std::string &ip,
+                           uint32_t &prefixlen);
+
+/* Take in ingress an IPv6 address and a prefix length and return the network */
+std::string get_ipv6_network_from_ip(const std::string &ip, uint32_t prefixlen);
+
+/* Return true if the IPv6 address is part of the network/prefixlen */
+bool ipv6_address_in_subnet(const std::string &ip, const std::string &network,
+                            uint32_t prefixlen);
+
+/* Return the EUI-64 based link local address of a port with the given mac */
+std::string get_ipv6_link_local_from_mac(const std::string &mac);
@@ -59,6 +59,7 @@ Response read_router_by_id_handler(const char *name, const Key *keys, size_t num
 Response read_router_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_router_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_router_ports_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_router_ports_ipv6_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_router_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_router_ports_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_router_ports_secondaryip_by_id_handler(const char *name, const Key *keys, size_t num_keys);
@@ -84,6 +85,7 @@ Response update_router_by_id_handler(const char *name, const Key *keys, size_t n
 Response update_router_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_router_ports_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_router_ports_ip_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_router_ports_ipv6_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_router_ports_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_router_ports_mac_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_router_ports_secondaryip_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
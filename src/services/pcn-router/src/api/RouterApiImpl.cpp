@@ -504,6 +504,25 @@ read_router_ports_ip_by_id(const std::string &name, const std::string &portsName
 
 }
 
+/**
+* @brief   Read ipv6 by ID
+*
+* Read operation of resource: ipv6*
+*
+* @param[in] name ID of name
+* @param[in] portsName ID of ports_name
+*
+* Responses:
+* std::string
+*/
+std::string
+read_router_ports_ipv6_by_id(const std::string &name, const std::string &portsName) {
+  auto router = get_cube(name);
+  auto ports = router->getPorts(portsName);
+  return ports->getIpv6();
+
+}
+
 /**
 * @brief   Read ports by ID
 *
@@ -957,6 +976,26 @@ update_router_ports_ip_by_id(const std::string &name, const std::string &portsNa
   return ports->setIp(value);
 }
 
+/**
+* @brief   Update ipv6 by ID
+*
+* Update operation of resource: ipv6*
+*
+* @param[in] name ID of name
+* @param[in] portsName ID of ports_name
+* @param[in] value IPv6 address and prefix of the port
+*
+* Responses:
+*
+*/
+void
+update_router_ports_ipv6_by_id(const std::string &name, const std::string &portsName, const std::string &value) {
+  auto router = get_cube(name);
+  auto ports = router->getPorts(portsName);
+
+  return ports->setIpv6(value);
+}
+
 /**
 * @brief   Update ports by ID
 *
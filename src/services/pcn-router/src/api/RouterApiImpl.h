@@ -62,6 +62,7 @@ namespace RouterApiImpl {
   std::vector<RouterJsonObject> read_router_list_by_id();
   PortsJsonObject read_router_ports_by_id(const std::string &name, const std::string &portsName);
   std::string read_router_ports_ip_by_id(const std::string &name, const std::string &portsName);
+  std::string read_router_ports_ipv6_by_id(const std::string &name, const std::string &portsName);
   std::vector<PortsJsonObject> read_router_ports_list_by_id(const std::string &name);
   std::string read_router_ports_mac_by_id(const std::string &name, const std::string &portsName);
   PortsSecondaryipJsonObject read_router_ports_secondaryip_by_id(const std::string &name, const std::string &portsName, const std::string &ip);
@@ -87,6 +88,7 @@ namespace RouterApiImpl {
   void update_router_list_by_id(const std::vector<RouterJsonObject> &value);
   void update_router_ports_by_id(const std::string &name, const std::string &portsName, const PortsJsonObject &value);
   void update_router_ports_ip_by_id(const std::string &name, const std::string &portsName, const std::string &value);
+  void update_router_ports_ipv6_by_id(const std::string &name, const std::string &portsName, const std::string &value);
   void update_router_ports_list_by_id(const std::string &name, const std::vector<PortsJsonObject> &value);
   void update_router_ports_mac_by_id(const std::string &name, const std::string &portsName, const std::string &value);
   void update_router_ports_secondaryip_by_id(const std::string &name, const std::string &portsName, const std::string &ip, const PortsSecondaryipJsonObject &value);
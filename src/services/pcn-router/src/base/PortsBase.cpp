@@ -32,6 +32,9 @@ void PortsBase::update(const PortsJsonObject &conf) {
       m->update(i);
     }
   }
+  if (conf.ipv6IsSet()) {
+    setIpv6(conf.getIpv6());
+  }
   if (conf.macIsSet()) {
     setMac(conf.getMac());
   }
@@ -46,6 +49,7 @@ PortsJsonObject PortsBase::toJsonObject() {
   for(auto &i : getSecondaryipList()) {
     conf.addPortsSecondaryip(i->toJsonObject());
   }
+  conf.setIpv6(getIpv6());
   conf.setMac(getMac());
 
   return conf;
@@ -61,6 +61,12 @@ class PortsBase: public polycube::service::Port {
   virtual void delSecondaryip(const std::string &ip) = 0;
   virtual void delSecondaryipList();
 
+  /// <summary>
+  /// IPv6 address and prefix of the port
+  /// </summary>
+  virtual std::string getIpv6() = 0;
+  virtual void setIpv6(const std::string &value) = 0;
+
   /// <summary>
   /// MAC address of the port
   /// </summary>
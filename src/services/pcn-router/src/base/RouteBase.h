@@ -39,7 +39,7 @@ class RouteBase {
   virtual RouteJsonObject toJsonObject();
 
   /// <summary>
-  /// Destination network IP
+  /// Destination network IP (IPv4 or IPv6)
   /// </summary>
   virtual std::string getNetwork() = 0;
 
@@ -21,6 +21,7 @@ PortsJsonObject::PortsJsonObject() {
   m_nameIsSet = false;
   m_ipIsSet = false;
   m_secondaryipIsSet = false;
+  m_ipv6IsSet = false;
   m_macIsSet = false;
 }
 
@@ -29,6 +30,7 @@ PortsJsonObject::PortsJsonObject(const nlohmann::json &val) :
   m_nameIsSet = false;
   m_ipIsSet = false;
   m_secondaryipIsSet = false;
+  m_ipv6IsSet = false;
   m_macIsSet = false;
 
 
@@ -49,6 +51,10 @@ PortsJsonObject::PortsJsonObject(const nlohmann::json &val) :
     m_secondaryipIsSet = true;
   }
 
+  if (val.count("ipv6")) {
+    setIpv6(val.at("ipv6").get<std::string>());
+  }
+
   if (val.count("mac")) {
     setMac(val.at("mac").get<std::string>());
   }
@@ -79,6 +85,10 @@ nlohmann::json PortsJsonObject::toJson() const {
     }
   }
 
+  if (m_ipv6IsSet) {
+    val["ipv6"] = m_ipv6;
+  }
+
   if (m_macIsSet) {
     val["mac"] = m_mac;
   }
@@ -136,6 +146,23 @@ void PortsJsonObject::unsetSecondaryip() {
   m_secondaryipIsSet = false;
 }
 
+std::string PortsJsonObject::getIpv6() const {
+  return m_ipv6;
+}
+
+void PortsJsonObject::setIpv6(std::string value) {
+  m_ipv6 = value;
+  m_ipv6IsSet = true;
+}
+
+bool PortsJsonObject::ipv6IsSet() const {
+  return m_ipv6IsSet;
+}
+
+void PortsJsonObject::unsetIpv6() {
+  m_ipv6IsSet = false;
+}
+
 std::string PortsJsonObject::getMac() const {
   return m_mac;
 }
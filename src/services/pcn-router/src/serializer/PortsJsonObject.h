@@ -61,6 +61,14 @@ public:
   bool secondaryipIsSet() const;
   void unsetSecondaryip();
 
+  /// <summary>
+  /// IPv6 address and prefix of the port
+  /// </summary>
+  std::string getIpv6() const;
+  void setIpv6(std::string value);
+  bool ipv6IsSet() const;
+  void unsetIpv6();
+
   /// <summary>
   /// MAC address of the port
   /// </summary>
@@ -76,6 +84,8 @@ private:
   bool m_ipIsSet;
   std::vector<PortsSecondaryipJsonObject> m_secondaryip;
   bool m_secondaryipIsSet;
+  std::string m_ipv6;
+  bool m_ipv6IsSet;
   std::string m_mac;
   bool m_macIsSet;
 };
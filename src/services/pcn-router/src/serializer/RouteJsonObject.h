@@ -37,7 +37,7 @@ public:
 
 
   /// <summary>
-  /// Destination network IP
+  /// Destination network IP (IPv4 or IPv6)
   /// </summary>
   std::string getNetwork() const;
   void setNetwork(std::string value);
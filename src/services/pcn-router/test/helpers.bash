@@ -201,3 +201,27 @@ function delete_link {
   	sudo ip link del link${i}1
   done
 }
+
+function create_veth_net6 {
+  for i in `seq 1 $1`;
+  do
+    sudo ip netns exec ns${i} ip -6 addr add 2001:db8:${i}::1/64 dev veth${i}_ nodad
+    sudo ip netns exec ns${i} ip -6 route add default via 2001:db8:${i}::254 dev veth${i}_
+  done
+}
+
+function router_add_ipv6_as_gateway { #$3 network number
+  polycubectl router $1 ports to_$2 set ipv6=2001:db8:$3::254/64
+}
+
+function ping6_cycle {
+  for i in `seq 1 $1`;
+  do
+    for j in `seq 1 $1`;
+    do
+      if [ "$i" -ne "$j" ]; then
+        sudo ip netns exec ns$i ping -6 2001:db8:$j::1 -c 2 -i 0.5
+      fi
+    done
+  done
+}
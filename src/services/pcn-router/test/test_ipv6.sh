@@ -0,0 +1,65 @@
+#! /bin/bash
+# 			  TOPOLOGY
+#
+#
+#
+#                         +------+
+#             veth1 ------|  r1  |------- veth2
+#                         +------+
+#                             |
+#                             |
+#                             |
+#                           veth3
+
+
+source "${BASH_SOURCE%/*}/helpers.bash"
+
+function cleanup {
+  set +e
+  del_routers 1
+  delete_veth 3
+}
+trap cleanup EXIT
+
+TYPE="TC"
+
+if [ -n "$1" ]; then
+  TYPE=$1
+fi
+
+# Create 3 namespaces, each one with both an IPv4 and an IPv6 address.
+# - "ns1", 10.0.1.1/24 and 2001:db8:1::1/64 (default gateway 2001:db8:1::254)
+# - "ns2", 10.0.2.1/24 and 2001:db8:2::1/64 (default gateway 2001:db8:2::254)
+# - "ns3", 10.0.3.1/24 and 2001:db8:3::1/64 (default gateway 2001:db8:3::254)
+set -x
+create_veth_net 3
+create_veth_net6 3
+
+set -e
+
+# Create the router r1
+polycubectl router add r1 type=$TYPE
+
+# Attaches the three ports to the router
+router_add_port_as_gateway r1 veth1 1
+router_add_port_as_gateway r1 veth2 2
+router_add_port_as_gateway r1 veth3 3
+router_add_ipv6_as_gateway r1 veth1 1
+router_add_ipv6_as_gateway r1 veth2 2
+router_add_ipv6_as_gateway r1 veth3 3
+
+# The router answers to the echo requests on its IPv6 addresses
+sudo ip netns exec ns1 ping -6 2001:db8:1::254 -c 2 -i 0.5
+
+# All the namespaces try to ping each other, both with IPv4 and IPv6
+ping_cycle 3
+ping6_cycle 3
+
+# The neighbors have been learnt by the router
+polycubectl router r1 arp-table show | grep 2001:db8:1::1
+
+# Hop limit exceeded: the router generates an ICMPv6 time exceeded
+sudo ip netns exec ns1 ping -6 2001:db8:2::1 -c 1 -t 1 -w 2 | grep -i "time exceeded"
+
+# No route: the router generates an ICMPv6 destination unreachable
+sudo ip netns exec ns1 ping -6 2001:db8:99::1 -c 1 -w 2 | grep -i "unreachable"
@@ -13,6 +13,17 @@
 #include "Synflood.h"
 
 #include <fstream>
+#include <numeric>
+
+/* Indexes of the counters of the datapath, see Synflood_dp.c */
+enum {
+  SYN_RECEIVED,
+  SYN_PASSED,
+  SYN_COOKIES_SENT,
+  SYN_COOKIES_VALID,
+  SYN_RATE_LIMITED,
+  SYN_DROPPED,
+};
 
 Stats::Stats(Synflood &parent, const StatsJsonObject &conf)
     : StatsBase(parent) {
@@ -41,6 +52,12 @@ StatsJsonObject Stats::toJsonObject() {
   conf.setTcpoutrsts(TcpOutRsts);
   conf.setDeliverratio(std::to_string(deliverRatio));
   conf.setResponseratio(std::to_string(responseRatio));
+  conf.setSynreceived(getSynreceived());
+  conf.setSynpassed(getSynpassed());
+  conf.setSyncookiessent(getSyncookiessent());
+  conf.setSyncookiesvalid(getSyncookiesvalid());
+  conf.setSynratelimited(getSynratelimited());
+  conf.setSyndropped(getSyndropped());
   conf.setLastupdate(getLastupdate());
 
   return conf;
@@ -102,10 +119,41 @@ std::string Stats::getResponseratio() {
   }
 }
 
+uint64_t Stats::getSynreceived() {
+  return getCounter(SYN_RECEIVED);
+}
+
+uint64_t Stats::getSynpassed() {
+  return getCounter(SYN_PASSED);
+}
+
+uint64_t Stats::getSyncookiessent() {
+  return getCounter(SYN_COOKIES_SENT);
+}
+
+uint64_t Stats::getSyncookiesvalid() {
+  return getCounter(SYN_COOKIES_VALID);
+}
+
+uint64_t Stats::getSynratelimited() {
+  return getCounter(SYN_RATE_LIMITED);
+}
+
+uint64_t Stats::getSyndropped() {
+  return getCounter(SYN_DROPPED);
+}
+
 uint64_t Stats::getLastupdate() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 }
 
+uint64_t Stats::getCounter(int index) {
+  auto counters = parent_.get_percpuarray_table<uint64_t>("counters", 0,
+                                                          ProgramType::INGRESS);
+  auto values = counters.get(index);
+  return std::accumulate(values.begin(), values.end(), uint64_t(0));
+}
+
 void Stats::updateAllValues() {
   getValue(STATISTICS::ALL_SYNFLOOD_STATS);
 }
@@ -53,6 +53,36 @@ class Stats : public StatsBase {
   /// </summary>
   std::string getResponseratio() override;
 
+  /// <summary>
+  /// Number of SYNs received
+  /// </summary>
+  uint64_t getSynreceived() override;
+
+  /// <summary>
+  /// Number of SYNs passed to the host
+  /// </summary>
+  uint64_t getSynpassed() override;
+
+  /// <summary>
+  /// Number of SYN-ACKs sent with a SYN cookie
+  /// </summary>
+  uint64_t getSyncookiessent() override;
+
+  /// <summary>
+  /// Number of ACKs received with a valid SYN cookie, i.e., of verified sources
+  /// </summary>
+  uint64_t getSyncookiesvalid() override;
+
+  /// <summary>
+  /// Number of SYNs dropped because their unverified source exceeded the rate limit
+  /// </summary>
+  uint64_t getSynratelimited() override;
+
+  /// <summary>
+  /// Number of SYNs of unverified sources dropped because they cannot be answered (IP options or payload)
+  /// </summary>
+  uint64_t getSyndropped() override;
+
   /// <summary>
   /// last update (time from epoch in milliseconds)
   /// </summary>
@@ -66,6 +96,7 @@ class Stats : public StatsBase {
   std::string IpInReceives;
   std::string IpOutRequests;
 
+  uint64_t getCounter(int index);
   void updateAllValues();
   void getValue(STATISTICS statistic_type);
 };
@@ -6,16 +6,44 @@
 */
 
 
-// TODO: Modify these methods with your own implementation
-
-
 #include "Synflood.h"
 #include "Synflood_dp.h"
 
+#include <random>
+
+/* definitions copied from datapath */
+struct synflood_config {
+  uint32_t secret[2];
+  uint32_t mitigation;
+  uint32_t syn_threshold;
+  uint32_t syn_rate_limit;
+  uint32_t pad;
+  uint64_t admission_timeout;
+};
+
 Synflood::Synflood(const std::string name, const SynfloodJsonObject &conf)
   : TransparentCube(conf.getBase(), { synflood_code }, {}),
-    SynfloodBase(name) {
+    SynfloodBase(name), mitigation_(false), syn_cookie_threshold_(1000),
+    syn_rate_limit_(0), admission_timeout_(60) {
   logger()->debug("Creating Synflood instance");
+
+  std::random_device rd;
+  secret_ = {rd(), rd()};
+
+  if (conf.mitigationIsSet()) {
+    mitigation_ = conf.getMitigation();
+  }
+  if (conf.synCookieThresholdIsSet()) {
+    syn_cookie_threshold_ = conf.getSynCookieThreshold();
+  }
+  if (conf.synRateLimitIsSet()) {
+    syn_rate_limit_ = conf.getSynRateLimit();
+  }
+  if (conf.admissionTimeoutIsSet()) {
+    setAdmissionTimeout(conf.getAdmissionTimeout());
+  }
+
+  updateConfig();
 }
 
 
@@ -29,6 +57,62 @@ void Synflood::packet_in(polycube::service::Direction direction,
   logger()->debug("Packet received");
 }
 
+bool Synflood::getMitigation() {
+  return mitigation_;
+}
+
+void Synflood::setMitigation(const bool &value) {
+  mitigation_ = value;
+  updateConfig();
+}
+
+uint32_t Synflood::getSynCookieThreshold() {
+  return syn_cookie_threshold_;
+}
+
+void Synflood::setSynCookieThreshold(const uint32_t &value) {
+  syn_cookie_threshold_ = value;
+  updateConfig();
+}
+
+uint32_t Synflood::getSynRateLimit() {
+  return syn_rate_limit_;
+}
+
+void Synflood::setSynRateLimit(const uint32_t &value) {
+  syn_rate_limit_ = value;
+  updateConfig();
+}
+
+uint32_t Synflood::getAdmissionTimeout() {
+  return admission_timeout_;
+}
+
+void Synflood::setAdmissionTimeout(const uint32_t &value) {
+  if (value == 0) {
+    throw std::runtime_error("admission-timeout must be greater than 0");
+  }
+  admission_timeout_ = value;
+  updateConfig();
+}
+
+void Synflood::updateConfig() {
+  synflood_config config = {};
+  config.secret[0] = secret_[0];
+  config.secret[1] = secret_[1];
+  config.mitigation = mitigation_;
+  // the datapath tracks the rate of the SYNs received by every cpu
+  if (syn_cookie_threshold_ > 0) {
+    uint32_t ncpus = polycube::get_possible_cpu_count();
+    config.syn_threshold = (syn_cookie_threshold_ + ncpus - 1) / ncpus;
+  }
+  config.syn_rate_limit = syn_rate_limit_;
+  config.admission_timeout = admission_timeout_ * 1000000000ULL;
+
+  get_array_table<synflood_config>("config", 0, ProgramType::INGRESS)
+      .set(0, config);
+}
+
 std::shared_ptr<Stats> Synflood::getStats() {
   StatsJsonObject sjo;
   return std::make_shared<Stats>(*this, sjo);
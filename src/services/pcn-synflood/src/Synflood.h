@@ -21,6 +21,7 @@
 #include <array>
 
 using namespace polycube::service::model;
+using polycube::service::ProgramType;
 
 class Synflood : public SynfloodBase {
  public:
@@ -31,6 +32,30 @@ class Synflood : public SynfloodBase {
                  polycube::service::PacketInMetadata &md,
                  const std::vector<uint8_t> &packet) override;
 
+  /// <summary>
+  /// Verify the sources of the SYNs with SYN cookies before passing their SYNs to the host
+  /// </summary>
+  bool getMitigation() override;
+  void setMitigation(const bool &value) override;
+
+  /// <summary>
+  /// Rate of the SYNs received by the service above which the mitigation is active, 0 to always verify the sources
+  /// </summary>
+  uint32_t getSynCookieThreshold() override;
+  void setSynCookieThreshold(const uint32_t &value) override;
+
+  /// <summary>
+  /// Maximum rate of the SYNs accepted from a single unverified source, 0 disables the limit
+  /// </summary>
+  uint32_t getSynRateLimit() override;
+  void setSynRateLimit(const uint32_t &value) override;
+
+  /// <summary>
+  /// Time a verified source can open connections without being verified again, restarted by each SYN of the source
+  /// </summary>
+  uint32_t getAdmissionTimeout() override;
+  void setAdmissionTimeout(const uint32_t &value) override;
+
   /// <summary>
   ///
   /// </summary>
@@ -38,4 +63,15 @@ class Synflood : public SynfloodBase {
   void addStats(const StatsJsonObject &value) override;
   void replaceStats(const StatsJsonObject &conf) override;
   void delStats() override;
+
+ private:
+  // writes the configuration in the datapath
+  void updateConfig();
+
+  bool mitigation_;
+  uint32_t syn_cookie_threshold_;
+  uint32_t syn_rate_limit_;
+  uint32_t admission_timeout_;
+  // key of the SYN cookies
+  std::array<uint32_t, 2> secret_;
 };
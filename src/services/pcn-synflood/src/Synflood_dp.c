@@ -6,6 +6,157 @@
 */
 
 
+#include <linux/jhash.h>
+#include <uapi/linux/if_ether.h>
+#include <uapi/linux/in.h>
+#include <uapi/linux/ip.h>
+#include <uapi/linux/tcp.h>
+
+#define IP_CSUM_OFFSET (sizeof(struct ethhdr) + offsetof(struct iphdr, check))
+#define TCP_CSUM_OFFSET \
+  (sizeof(struct ethhdr) + sizeof(struct iphdr) + offsetof(struct tcphdr, check))
+
+#define TCP_FLAG_SYN 0x02
+#define TCP_FLAG_RST 0x04
+#define TCP_FLAG_ACK 0x10
+
+#define REPLY_TTL 64
+#define NS_PER_SEC 1000000000ULL
+
+/* The cookies depend on a time slot of 2^36 ns (about 69 seconds), the ACKs
+ * are accepted in the slot of the SYN-ACK and in the following one */
+#define COOKIE_SLOT_SHIFT 36
+
+#define MAX_SOURCES 65536
+#define MAX_VERIFIED_SOURCES 65536
+
+/* Written by the control plane, replaced as a whole when it changes */
+struct synflood_config {
+  u32 secret[2];          // key of the cookies, random
+  u32 mitigation;         // whether the sources are verified with SYN cookies
+  u32 syn_threshold;      // SYNs/s per cpu above which the mitigation is active, 0 always
+  u32 syn_rate_limit;     // SYNs/s accepted from an unverified source, 0 unlimited
+  u32 pad;
+  u64 admission_timeout;  // ns a verified source stays admitted after its last SYN
+};
+
+/* Per-source state of the unverified sources, the rate is tracked over
+ * windows of one second */
+struct source {
+  u64 window;  // start of the current window
+  u64 syns;    // SYNs received in the current window
+};
+
+/* Per-cpu SYN rate, to activate the mitigation only under attack */
+struct syn_rate {
+  u64 window;
+  u64 syns;
+  u64 last_syns;  // SYNs received in the previous window
+};
+
+enum {
+  SYN_RECEIVED,       // SYNs received
+  SYN_PASSED,         // SYNs passed to the host
+  SYN_COOKIES_SENT,   // SYN-ACKs sent with a cookie
+  SYN_COOKIES_VALID,  // ACKs with a valid cookie, their sources are admitted
+  SYN_RATE_LIMITED,   // SYNs dropped because their unverified source exceeded the rate limit
+  SYN_DROPPED,        // SYNs of unverified sources that cannot be answered
+  COUNTERS_SIZE,
+};
+
+BPF_ARRAY(config, struct synflood_config, 1);
+BPF_TABLE("lru_hash", __be32, struct source, sources, MAX_SOURCES);
+/* Verified sources, with the last time they have been verified or one of their
+ * SYNs passed. Kept apart from the unverified ones, whose addresses can be
+ * spoofed at will: only a valid cookie inserts an entry, so a flood of SYNs
+ * cannot evict the admitted clients */
+BPF_TABLE("lru_hash", __be32, u64, verified_sources, MAX_VERIFIED_SOURCES);
+BPF_TABLE("percpu_array", int, struct syn_rate, syn_rates, 1);
+BPF_TABLE("percpu_array", int, u64, counters, COUNTERS_SIZE);
+
+static __always_inline void count_event(int counter) {
+  u64 *value = counters.lookup(&counter);
+  if (value)
+    *value += 1;
+}
+
+/* Updates the SYN rate of the cpu if syn is set, returns whether the mitigation
+ * is active */
+static __always_inline bool under_attack(struct synflood_config *cfg, u64 now, bool syn) {
+  if (cfg->syn_threshold == 0)
+    return true;
+
+  int zero = 0;
+  struct syn_rate *rate = syn_rates.lookup(&zero);
+  if (!rate)
+    return true;
+
+  if (now - rate->window >= NS_PER_SEC) {
+    // the previous window counts only if it has just ended
+    rate->last_syns = now - rate->window < 2 * NS_PER_SEC ? rate->syns : 0;
+    rate->window = now;
+    rate->syns = 0;
+  }
+  if (syn)
+    rate->syns += 1;
+
+  return rate->syns > cfg->syn_threshold || rate->last_syns > cfg->syn_threshold;
+}
+
+static __always_inline u32 syn_cookie(struct synflood_config *cfg, struct iphdr *ip,
+                                      struct tcphdr *tcp, u32 isn, u64 slot) {
+  u32 ports = ((u32)tcp->source << 16) | tcp->dest;
+  u32 hash = jhash_3words(ip->saddr, ip->daddr, ports, cfg->secret[0] ^ (u32)slot);
+  return jhash_2words(hash, isn, cfg->secret[1]);
+}
+
+/* Turns the packet into a reply to its sender, with the given sequence and
+ * acknowledgment numbers and flags, and sends it back */
+static __always_inline int reply(struct CTXTYPE *ctx, struct pkt_metadata *md,
+                                 struct ethhdr *eth, struct iphdr *ip,
+                                 struct tcphdr *tcp, u32 seq, u32 ack_seq,
+                                 u16 flags) {
+  u8 mac[ETH_ALEN];
+  __builtin_memcpy(mac, eth->h_source, ETH_ALEN);
+  __builtin_memcpy(eth->h_source, eth->h_dest, ETH_ALEN);
+  __builtin_memcpy(eth->h_dest, mac, ETH_ALEN);
+
+  // swapping addresses and ports does not change the checksums
+  __be32 addr = ip->saddr;
+  ip->saddr = ip->daddr;
+  ip->daddr = addr;
+  __be16 port = tcp->source;
+  tcp->source = tcp->dest;
+  tcp->dest = port;
+
+  __be16 *ttl = (__be16 *)&ip->ttl;
+  __be16 old_ttl = *ttl;
+  ip->ttl = REPLY_TTL;
+  __be16 new_ttl = *ttl;
+
+  __be32 old_seq = tcp->seq;
+  __be32 old_ack_seq = tcp->ack_seq;
+  tcp->seq = bpf_htonl(seq);
+  tcp->ack_seq = bpf_htonl(ack_seq);
+
+  // the flags share a 16 bit word with the data offset
+  __be16 *flags_word = (__be16 *)tcp + 6;
+  __be16 old_flags = *flags_word;
+  __be16 new_flags = bpf_htons((bpf_ntohs(old_flags) & 0xf000) | flags);
+  *flags_word = new_flags;
+
+  __be32 new_seq = tcp->seq;
+  __be32 new_ack_seq = tcp->ack_seq;
+
+  // the helpers may invalidate the packet pointers
+  pcn_l3_csum_replace(ctx, IP_CSUM_OFFSET, old_ttl, new_ttl, 2);
+  pcn_l4_csum_replace(ctx, TCP_CSUM_OFFSET, old_seq, new_seq, 4);
+  pcn_l4_csum_replace(ctx, TCP_CSUM_OFFSET, old_ack_seq, new_ack_seq, 4);
+  pcn_l4_csum_replace(ctx, TCP_CSUM_OFFSET, old_flags, new_flags, 2);
+
+  return pcn_pkt_reflect(ctx, md);
+}
+
 /*
  * This function is called each time a packet arrives to the cube.
  * ctx contains the packet and md some additional metadata for the packet.
@@ -16,5 +167,115 @@
  */
 static __always_inline
 int handle_rx(struct CTXTYPE *ctx, struct pkt_metadata *md) {
-  return RX_OK;
+  void *data = (void *)(long)ctx->data;
+  void *data_end = (void *)(long)ctx->data_end;
+
+  struct ethhdr *eth = data;
+  if ((void *)(eth + 1) > data_end)
+    return RX_OK;
+  if (eth->h_proto != bpf_htons(ETH_P_IP))
+    return RX_OK;
+
+  struct iphdr *ip = (void *)(eth + 1);
+  if ((void *)(ip + 1) > data_end)
+    return RX_OK;
+  if (ip->protocol != IPPROTO_TCP)
+    return RX_OK;
+
+  u32 ip_len = ip->ihl * 4;
+  if (ip_len < sizeof(*ip))
+    return RX_OK;
+  struct tcphdr *tcp = (void *)ip + ip_len;
+  if ((void *)(tcp + 1) > data_end)
+    return RX_OK;
+
+  bool syn = tcp->syn && !tcp->ack;
+  bool ack = tcp->ack && !tcp->syn && !tcp->rst && !tcp->fin;
+  if (!syn && !ack)
+    return RX_OK;
+
+  int zero = 0;
+  struct synflood_config *cfg = config.lookup(&zero);
+  if (!cfg)
+    return RX_OK;
+
+  u64 now = bpf_ktime_get_ns();
+  bool active = cfg->mitigation && under_attack(cfg, now, syn);
+  // only the replies to packets without IP options and payload are supported
+  bool answerable = ip_len == sizeof(*ip) &&
+                    bpf_ntohs(ip->tot_len) == sizeof(*ip) + tcp->doff * 4;
+
+  __be32 saddr = ip->saddr;
+  u64 *admitted = verified_sources.lookup(&saddr);
+  if (admitted && now - *admitted >= cfg->admission_timeout) {
+    verified_sources.delete(&saddr);
+    admitted = NULL;
+  }
+
+  if (syn) {
+    count_event(SYN_RECEIVED);
+
+    if (admitted) {
+      *admitted = now;
+      count_event(SYN_PASSED);
+      return RX_OK;
+    }
+
+    struct source *src = sources.lookup(&saddr);
+    if (!src) {
+      struct source new_src = {.window = now};
+      sources.update(&saddr, &new_src);
+      src = sources.lookup(&saddr);
+      if (!src)
+        return RX_OK;
+    }
+
+    if (now - src->window >= NS_PER_SEC) {
+      src->window = now;
+      src->syns = 0;
+    }
+    src->syns += 1;
+    if (cfg->syn_rate_limit && src->syns > cfg->syn_rate_limit) {
+      count_event(SYN_RATE_LIMITED);
+      return RX_DROP;
+    }
+
+    if (!active) {
+      count_event(SYN_PASSED);
+      return RX_OK;
+    }
+
+    if (!answerable) {
+      count_event(SYN_DROPPED);
+      return RX_DROP;
+    }
+
+    u32 isn = bpf_ntohl(tcp->seq);
+    u32 cookie = syn_cookie(cfg, ip, tcp, isn, now >> COOKIE_SLOT_SHIFT);
+    count_event(SYN_COOKIES_SENT);
+    return reply(ctx, md, eth, ip, tcp, cookie, isn + 1,
+                 TCP_FLAG_SYN | TCP_FLAG_ACK);
+  }
+
+  // the ACKs of the admitted sources and the ones received while the
+  // mitigation is not active belong to the connections of the host
+  if (!active || admitted)
+    return RX_OK;
+
+  u32 isn = bpf_ntohl(tcp->seq) - 1;
+  u32 cookie = bpf_ntohl(tcp->ack_seq) - 1;
+  u64 slot = now >> COOKIE_SLOT_SHIFT;
+  if (cookie != syn_cookie(cfg, ip, tcp, isn, slot) &&
+      cookie != syn_cookie(cfg, ip, tcp, isn, slot - 1))
+    return RX_OK;
+
+  count_event(SYN_COOKIES_VALID);
+  verified_sources.update(&saddr, &now);
+  sources.delete(&saddr);
+
+  // the host does not know the connection, the client is reset and connects
+  // again, this time to the host
+  if (!answerable)
+    return RX_DROP;
+  return reply(ctx, md, eth, ip, tcp, cookie + 1, 0, TCP_FLAG_RST);
 }
@@ -32,17 +32,31 @@ extern "C" {
 
 Response create_synflood_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response delete_synflood_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_admission_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_list_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_mitigation_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_deliverratio_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_lastupdate_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_responseratio_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_syncookiessent_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_syncookiesvalid_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_syndropped_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_synpassed_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_synratelimited_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_stats_synreceived_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_tcpattemptfails_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response read_synflood_stats_tcpoutrsts_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_syn_cookie_threshold_by_id_handler(const char *name, const Key *keys, size_t num_keys);
+Response read_synflood_syn_rate_limit_by_id_handler(const char *name, const Key *keys, size_t num_keys);
 Response replace_synflood_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_synflood_admission_timeout_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_synflood_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 Response update_synflood_list_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_synflood_mitigation_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_synflood_syn_cookie_threshold_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
+Response update_synflood_syn_rate_limit_by_id_handler(const char *name, const Key *keys, size_t num_keys, const char *value);
 
 Response synflood_list_by_id_help(const char *name, const Key *keys, size_t num_keys);
 
@@ -85,6 +85,23 @@ std::vector<nlohmann::fifo_map<std::string, std::string>> read_synflood_list_by_
   return r;
 }
 
+/**
+* @brief   Read admission-timeout by ID
+*
+* Read operation of resource: admission-timeout*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_synflood_admission_timeout_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  return synflood->getAdmissionTimeout();
+
+}
+
 /**
 * @brief   Read synflood by ID
 *
@@ -101,6 +118,23 @@ read_synflood_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read mitigation by ID
+*
+* Read operation of resource: mitigation*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* bool
+*/
+bool
+read_synflood_mitigation_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  return synflood->getMitigation();
+
+}
+
 /**
 * @brief   Read stats by ID
 *
@@ -172,6 +206,114 @@ read_synflood_stats_responseratio_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read syncookiessent by ID
+*
+* Read operation of resource: syncookiessent*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_syncookiessent_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSyncookiessent();
+
+}
+
+/**
+* @brief   Read syncookiesvalid by ID
+*
+* Read operation of resource: syncookiesvalid*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_syncookiesvalid_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSyncookiesvalid();
+
+}
+
+/**
+* @brief   Read syndropped by ID
+*
+* Read operation of resource: syndropped*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_syndropped_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSyndropped();
+
+}
+
+/**
+* @brief   Read synpassed by ID
+*
+* Read operation of resource: synpassed*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_synpassed_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSynpassed();
+
+}
+
+/**
+* @brief   Read synratelimited by ID
+*
+* Read operation of resource: synratelimited*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_synratelimited_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSynratelimited();
+
+}
+
+/**
+* @brief   Read synreceived by ID
+*
+* Read operation of resource: synreceived*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint64_t
+*/
+uint64_t
+read_synflood_stats_synreceived_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  auto stats = synflood->getStats();
+  return stats->getSynreceived();
+
+}
+
 /**
 * @brief   Read tcpattemptfails by ID
 *
@@ -208,6 +350,58 @@ read_synflood_stats_tcpoutrsts_by_id(const std::string &name) {
 
 }
 
+/**
+* @brief   Read syn-cookie-threshold by ID
+*
+* Read operation of resource: syn-cookie-threshold*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_synflood_syn_cookie_threshold_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  return synflood->getSynCookieThreshold();
+
+}
+
+/**
+* @brief   Read syn-rate-limit by ID
+*
+* Read operation of resource: syn-rate-limit*
+*
+* @param[in] name ID of name
+*
+* Responses:
+* uint32_t
+*/
+uint32_t
+read_synflood_syn_rate_limit_by_id(const std::string &name) {
+  auto synflood = get_cube(name);
+  return synflood->getSynRateLimit();
+
+}
+
+/**
+* @brief   Update admission-timeout by ID
+*
+* Update operation of resource: admission-timeout*
+*
+* @param[in] name ID of name
+* @param[in] value Time a verified source stays admitted after its last SYN
+*
+* Responses:
+*
+*/
+void
+update_synflood_admission_timeout_by_id(const std::string &name, const uint32_t &value) {
+  auto synflood = get_cube(name);
+
+  return synflood->setAdmissionTimeout(value);
+}
+
 /**
 * @brief   Update synflood by ID
 *
@@ -241,6 +435,60 @@ update_synflood_list_by_id(const std::vector<SynfloodJsonObject> &value) {
   throw std::runtime_error("Method not supported");
 }
 
+/**
+* @brief   Update mitigation by ID
+*
+* Update operation of resource: mitigation*
+*
+* @param[in] name ID of name
+* @param[in] value Whether the sources are verified with SYN cookies
+*
+* Responses:
+*
+*/
+void
+update_synflood_mitigation_by_id(const std::string &name, const bool &value) {
+  auto synflood = get_cube(name);
+
+  return synflood->setMitigation(value);
+}
+
+/**
+* @brief   Update syn-cookie-threshold by ID
+*
+* Update operation of resource: syn-cookie-threshold*
+*
+* @param[in] name ID of name
+* @param[in] value Rate of SYNs above which the mitigation is active
+*
+* Responses:
+*
+*/
+void
+update_synflood_syn_cookie_threshold_by_id(const std::string &name, const uint32_t &value) {
+  auto synflood = get_cube(name);
+
+  return synflood->setSynCookieThreshold(value);
+}
+
+/**
+* @brief   Update syn-rate-limit by ID
+*
+* Update operation of resource: syn-rate-limit*
+*
+* @param[in] name ID of name
+* @param[in] value Maximum rate of SYNs accepted from a single source
+*
+* Responses:
+*
+*/
+void
+update_synflood_syn_rate_limit_by_id(const std::string &name, const uint32_t &value) {
+  auto synflood = get_cube(name);
+
+  return synflood->setSynRateLimit(value);
+}
+
 
 
 /*
@@ -35,17 +35,31 @@ using namespace polycube::service::model;
 namespace SynfloodApiImpl {
   void create_synflood_by_id(const std::string &name, const SynfloodJsonObject &value);
   void delete_synflood_by_id(const std::string &name);
+  uint32_t read_synflood_admission_timeout_by_id(const std::string &name);
   SynfloodJsonObject read_synflood_by_id(const std::string &name);
   std::vector<SynfloodJsonObject> read_synflood_list_by_id();
+  bool read_synflood_mitigation_by_id(const std::string &name);
   StatsJsonObject read_synflood_stats_by_id(const std::string &name);
   std::string read_synflood_stats_deliverratio_by_id(const std::string &name);
   uint64_t read_synflood_stats_lastupdate_by_id(const std::string &name);
   std::string read_synflood_stats_responseratio_by_id(const std::string &name);
+  uint64_t read_synflood_stats_syncookiessent_by_id(const std::string &name);
+  uint64_t read_synflood_stats_syncookiesvalid_by_id(const std::string &name);
+  uint64_t read_synflood_stats_syndropped_by_id(const std::string &name);
+  uint64_t read_synflood_stats_synpassed_by_id(const std::string &name);
+  uint64_t read_synflood_stats_synratelimited_by_id(const std::string &name);
+  uint64_t read_synflood_stats_synreceived_by_id(const std::string &name);
   std::string read_synflood_stats_tcpattemptfails_by_id(const std::string &name);
   std::string read_synflood_stats_tcpoutrsts_by_id(const std::string &name);
+  uint32_t read_synflood_syn_cookie_threshold_by_id(const std::string &name);
+  uint32_t read_synflood_syn_rate_limit_by_id(const std::string &name);
   void replace_synflood_by_id(const std::string &name, const SynfloodJsonObject &value);
+  void update_synflood_admission_timeout_by_id(const std::string &name, const uint32_t &value);
   void update_synflood_by_id(const std::string &name, const SynfloodJsonObject &value);
   void update_synflood_list_by_id(const std::vector<SynfloodJsonObject> &value);
+  void update_synflood_mitigation_by_id(const std::string &name, const bool &value);
+  void update_synflood_syn_cookie_threshold_by_id(const std::string &name, const uint32_t &value);
+  void update_synflood_syn_rate_limit_by_id(const std::string &name, const uint32_t &value);
 
   /* help related */
   std::vector<nlohmann::fifo_map<std::string, std::string>> read_synflood_list_by_id_get_list();
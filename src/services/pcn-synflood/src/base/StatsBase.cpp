@@ -29,6 +29,12 @@ StatsJsonObject StatsBase::toJsonObject() {
   conf.setTcpoutrsts(getTcpoutrsts());
   conf.setDeliverratio(getDeliverratio());
   conf.setResponseratio(getResponseratio());
+  conf.setSynreceived(getSynreceived());
+  conf.setSynpassed(getSynpassed());
+  conf.setSyncookiessent(getSyncookiessent());
+  conf.setSyncookiesvalid(getSyncookiesvalid());
+  conf.setSynratelimited(getSynratelimited());
+  conf.setSyndropped(getSyndropped());
   conf.setLastupdate(getLastupdate());
 
   return conf;
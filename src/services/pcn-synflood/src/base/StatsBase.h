@@ -58,6 +58,36 @@ class StatsBase {
   /// </summary>
   virtual std::string getResponseratio() = 0;
 
+  /// <summary>
+  /// Number of SYNs received
+  /// </summary>
+  virtual uint64_t getSynreceived() = 0;
+
+  /// <summary>
+  /// Number of SYNs passed to the host
+  /// </summary>
+  virtual uint64_t getSynpassed() = 0;
+
+  /// <summary>
+  /// Number of SYN-ACKs sent with a SYN cookie
+  /// </summary>
+  virtual uint64_t getSyncookiessent() = 0;
+
+  /// <summary>
+  /// Number of ACKs received with a valid SYN cookie, i.e., of verified sources
+  /// </summary>
+  virtual uint64_t getSyncookiesvalid() = 0;
+
+  /// <summary>
+  /// Number of SYNs dropped because their unverified source exceeded the rate limit
+  /// </summary>
+  virtual uint64_t getSynratelimited() = 0;
+
+  /// <summary>
+  /// Number of SYNs of unverified sources dropped because they cannot be answered (IP options or payload)
+  /// </summary>
+  virtual uint64_t getSyndropped() = 0;
+
   /// <summary>
   /// last update (time from epoch in milliseconds)
   /// </summary>
@@ -22,6 +22,18 @@ SynfloodBase::~SynfloodBase() {}
 void SynfloodBase::update(const SynfloodJsonObject &conf) {
   set_conf(conf.getBase());
 
+  if (conf.mitigationIsSet()) {
+    setMitigation(conf.getMitigation());
+  }
+  if (conf.synCookieThresholdIsSet()) {
+    setSynCookieThreshold(conf.getSynCookieThreshold());
+  }
+  if (conf.synRateLimitIsSet()) {
+    setSynRateLimit(conf.getSynRateLimit());
+  }
+  if (conf.admissionTimeoutIsSet()) {
+    setAdmissionTimeout(conf.getAdmissionTimeout());
+  }
   if (conf.statsIsSet()) {
     auto m = getStats();
     m->update(conf.getStats());
@@ -33,6 +45,10 @@ SynfloodJsonObject SynfloodBase::toJsonObject() {
   conf.setBase(to_json());
 
   conf.setName(getName());
+  conf.setMitigation(getMitigation());
+  conf.setSynCookieThreshold(getSynCookieThreshold());
+  conf.setSynRateLimit(getSynRateLimit());
+  conf.setAdmissionTimeout(getAdmissionTimeout());
   conf.setStats(getStats()->toJsonObject());
 
   return conf;
@@ -40,6 +40,30 @@ class SynfloodBase: public virtual polycube::service::TransparentCube {
   virtual void update(const SynfloodJsonObject &conf);
   virtual SynfloodJsonObject toJsonObject();
 
+  /// <summary>
+  /// Verify the sources of the SYNs with SYN cookies before passing their SYNs to the host
+  /// </summary>
+  virtual bool getMitigation() = 0;
+  virtual void setMitigation(const bool &value) = 0;
+
+  /// <summary>
+  /// Rate of the SYNs received by the service above which the mitigation is active, 0 to always verify the sources
+  /// </summary>
+  virtual uint32_t getSynCookieThreshold() = 0;
+  virtual void setSynCookieThreshold(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Maximum rate of the SYNs accepted from a single unverified source, 0 disables the limit
+  /// </summary>
+  virtual uint32_t getSynRateLimit() = 0;
+  virtual void setSynRateLimit(const uint32_t &value) = 0;
+
+  /// <summary>
+  /// Time a verified source can open connections without being verified again, restarted by each SYN of the source
+  /// </summary>
+  virtual uint32_t getAdmissionTimeout() = 0;
+  virtual void setAdmissionTimeout(const uint32_t &value) = 0;
+
   /// <summary>
   ///
   /// </summary>
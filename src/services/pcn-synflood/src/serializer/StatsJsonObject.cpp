@@ -22,6 +22,12 @@ StatsJsonObject::StatsJsonObject() {
   m_tcpoutrstsIsSet = false;
   m_deliverratioIsSet = false;
   m_responseratioIsSet = false;
+  m_synreceivedIsSet = false;
+  m_synpassedIsSet = false;
+  m_syncookiessentIsSet = false;
+  m_syncookiesvalidIsSet = false;
+  m_synratelimitedIsSet = false;
+  m_syndroppedIsSet = false;
   m_lastupdateIsSet = false;
 }
 
@@ -31,6 +37,12 @@ StatsJsonObject::StatsJsonObject(const nlohmann::json &val) :
   m_tcpoutrstsIsSet = false;
   m_deliverratioIsSet = false;
   m_responseratioIsSet = false;
+  m_synreceivedIsSet = false;
+  m_synpassedIsSet = false;
+  m_syncookiessentIsSet = false;
+  m_syncookiesvalidIsSet = false;
+  m_synratelimitedIsSet = false;
+  m_syndroppedIsSet = false;
   m_lastupdateIsSet = false;
 
 
@@ -50,6 +62,30 @@ StatsJsonObject::StatsJsonObject(const nlohmann::json &val) :
     setResponseratio(val.at("responseratio").get<std::string>());
   }
 
+  if (val.count("synreceived")) {
+    setSynreceived(val.at("synreceived").get<uint64_t>());
+  }
+
+  if (val.count("synpassed")) {
+    setSynpassed(val.at("synpassed").get<uint64_t>());
+  }
+
+  if (val.count("syncookiessent")) {
+    setSyncookiessent(val.at("syncookiessent").get<uint64_t>());
+  }
+
+  if (val.count("syncookiesvalid")) {
+    setSyncookiesvalid(val.at("syncookiesvalid").get<uint64_t>());
+  }
+
+  if (val.count("synratelimited")) {
+    setSynratelimited(val.at("synratelimited").get<uint64_t>());
+  }
+
+  if (val.count("syndropped")) {
+    setSyndropped(val.at("syndropped").get<uint64_t>());
+  }
+
   if (val.count("lastupdate")) {
     setLastupdate(val.at("lastupdate").get<uint64_t>());
   }
@@ -77,6 +113,30 @@ nlohmann::json StatsJsonObject::toJson() const {
     val["responseratio"] = m_responseratio;
   }
 
+  if (m_synreceivedIsSet) {
+    val["synreceived"] = m_synreceived;
+  }
+
+  if (m_synpassedIsSet) {
+    val["synpassed"] = m_synpassed;
+  }
+
+  if (m_syncookiessentIsSet) {
+    val["syncookiessent"] = m_syncookiessent;
+  }
+
+  if (m_syncookiesvalidIsSet) {
+    val["syncookiesvalid"] = m_syncookiesvalid;
+  }
+
+  if (m_synratelimitedIsSet) {
+    val["synratelimited"] = m_synratelimited;
+  }
+
+  if (m_syndroppedIsSet) {
+    val["syndropped"] = m_syndropped;
+  }
+
   if (m_lastupdateIsSet) {
     val["lastupdate"] = m_lastupdate;
   }
@@ -152,6 +212,108 @@ void StatsJsonObject::unsetResponseratio() {
   m_responseratioIsSet = false;
 }
 
+uint64_t StatsJsonObject::getSynreceived() const {
+  return m_synreceived;
+}
+
+void StatsJsonObject::setSynreceived(uint64_t value) {
+  m_synreceived = value;
+  m_synreceivedIsSet = true;
+}
+
+bool StatsJsonObject::synreceivedIsSet() const {
+  return m_synreceivedIsSet;
+}
+
+void StatsJsonObject::unsetSynreceived() {
+  m_synreceivedIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSynpassed() const {
+  return m_synpassed;
+}
+
+void StatsJsonObject::setSynpassed(uint64_t value) {
+  m_synpassed = value;
+  m_synpassedIsSet = true;
+}
+
+bool StatsJsonObject::synpassedIsSet() const {
+  return m_synpassedIsSet;
+}
+
+void StatsJsonObject::unsetSynpassed() {
+  m_synpassedIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSyncookiessent() const {
+  return m_syncookiessent;
+}
+
+void StatsJsonObject::setSyncookiessent(uint64_t value) {
+  m_syncookiessent = value;
+  m_syncookiessentIsSet = true;
+}
+
+bool StatsJsonObject::syncookiessentIsSet() const {
+  return m_syncookiessentIsSet;
+}
+
+void StatsJsonObject::unsetSyncookiessent() {
+  m_syncookiessentIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSyncookiesvalid() const {
+  return m_syncookiesvalid;
+}
+
+void StatsJsonObject::setSyncookiesvalid(uint64_t value) {
+  m_syncookiesvalid = value;
+  m_syncookiesvalidIsSet = true;
+}
+
+bool StatsJsonObject::syncookiesvalidIsSet() const {
+  return m_syncookiesvalidIsSet;
+}
+
+void StatsJsonObject::unsetSyncookiesvalid() {
+  m_syncookiesvalidIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSynratelimited() const {
+  return m_synratelimited;
+}
+
+void StatsJsonObject::setSynratelimited(uint64_t value) {
+  m_synratelimited = value;
+  m_synratelimitedIsSet = true;
+}
+
+bool StatsJsonObject::synratelimitedIsSet() const {
+  return m_synratelimitedIsSet;
+}
+
+void StatsJsonObject::unsetSynratelimited() {
+  m_synratelimitedIsSet = false;
+}
+
+uint64_t StatsJsonObject::getSyndropped() const {
+  return m_syndropped;
+}
+
+void StatsJsonObject::setSyndropped(uint64_t value) {
+  m_syndropped = value;
+  m_syndroppedIsSet = true;
+}
+
+bool StatsJsonObject::syndroppedIsSet() const {
+  return m_syndroppedIsSet;
+}
+
+void StatsJsonObject::unsetSyndropped() {
+  m_syndroppedIsSet = false;
+}
+
 uint64_t StatsJsonObject::getLastupdate() const {
   return m_lastupdate;
 }
@@ -68,6 +68,54 @@ public:
   bool responseratioIsSet() const;
   void unsetResponseratio();
 
+  /// <summary>
+  /// Number of SYNs received
+  /// </summary>
+  uint64_t getSynreceived() const;
+  void setSynreceived(uint64_t value);
+  bool synreceivedIsSet() const;
+  void unsetSynreceived();
+
+  /// <summary>
+  /// Number of SYNs passed to the host
+  /// </summary>
+  uint64_t getSynpassed() const;
+  void setSynpassed(uint64_t value);
+  bool synpassedIsSet() const;
+  void unsetSynpassed();
+
+  /// <summary>
+  /// Number of SYN-ACKs sent with a SYN cookie
+  /// </summary>
+  uint64_t getSyncookiessent() const;
+  void setSyncookiessent(uint64_t value);
+  bool syncookiessentIsSet() const;
+  void unsetSyncookiessent();
+
+  /// <summary>
+  /// Number of ACKs received with a valid SYN cookie, i.e., of verified sources
+  /// </summary>
+  uint64_t getSyncookiesvalid() const;
+  void setSyncookiesvalid(uint64_t value);
+  bool syncookiesvalidIsSet() const;
+  void unsetSyncookiesvalid();
+
+  /// <summary>
+  /// Number of SYNs dropped because their unverified source exceeded the rate limit
+  /// </summary>
+  uint64_t getSynratelimited() const;
+  void setSynratelimited(uint64_t value);
+  bool synratelimitedIsSet() const;
+  void unsetSynratelimited();
+
+  /// <summary>
+  /// Number of SYNs of unverified sources dropped because they cannot be answered (IP options or payload)
+  /// </summary>
+  uint64_t getSyndropped() const;
+  void setSyndropped(uint64_t value);
+  bool syndroppedIsSet() const;
+  void unsetSyndropped();
+
   /// <summary>
   /// last update (time from epoch in milliseconds)
   /// </summary>
@@ -85,6 +133,18 @@ private:
   bool m_deliverratioIsSet;
   std::string m_responseratio;
   bool m_responseratioIsSet;
+  uint64_t m_synreceived;
+  bool m_synreceivedIsSet;
+  uint64_t m_synpassed;
+  bool m_synpassedIsSet;
+  uint64_t m_syncookiessent;
+  bool m_syncookiessentIsSet;
+  uint64_t m_syncookiesvalid;
+  bool m_syncookiesvalidIsSet;
+  uint64_t m_synratelimited;
+  bool m_synratelimitedIsSet;
+  uint64_t m_syndropped;
+  bool m_syndroppedIsSet;
   uint64_t m_lastupdate;
   bool m_lastupdateIsSet;
 };
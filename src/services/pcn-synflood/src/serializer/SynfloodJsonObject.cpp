@@ -19,12 +19,24 @@ namespace model {
 
 SynfloodJsonObject::SynfloodJsonObject() {
   m_nameIsSet = false;
+  m_mitigation = false;
+  m_mitigationIsSet = true;
+  m_synCookieThreshold = 1000;
+  m_synCookieThresholdIsSet = true;
+  m_synRateLimit = 0;
+  m_synRateLimitIsSet = true;
+  m_admissionTimeout = 60;
+  m_admissionTimeoutIsSet = true;
   m_statsIsSet = false;
 }
 
 SynfloodJsonObject::SynfloodJsonObject(const nlohmann::json &val) :
   JsonObjectBase(val) {
   m_nameIsSet = false;
+  m_mitigationIsSet = false;
+  m_synCookieThresholdIsSet = false;
+  m_synRateLimitIsSet = false;
+  m_admissionTimeoutIsSet = false;
   m_statsIsSet = false;
 
 
@@ -32,6 +44,22 @@ SynfloodJsonObject::SynfloodJsonObject(const nlohmann::json &val) :
     setName(val.at("name").get<std::string>());
   }
 
+  if (val.count("mitigation")) {
+    setMitigation(val.at("mitigation").get<bool>());
+  }
+
+  if (val.count("syn-cookie-threshold")) {
+    setSynCookieThreshold(val.at("syn-cookie-threshold").get<uint32_t>());
+  }
+
+  if (val.count("syn-rate-limit")) {
+    setSynRateLimit(val.at("syn-rate-limit").get<uint32_t>());
+  }
+
+  if (val.count("admission-timeout")) {
+    setAdmissionTimeout(val.at("admission-timeout").get<uint32_t>());
+  }
+
   if (val.count("stats")) {
     if (!val["stats"].is_null()) {
       StatsJsonObject newItem { val["stats"] };
@@ -50,6 +78,22 @@ nlohmann::json SynfloodJsonObject::toJson() const {
     val["name"] = m_name;
   }
 
+  if (m_mitigationIsSet) {
+    val["mitigation"] = m_mitigation;
+  }
+
+  if (m_synCookieThresholdIsSet) {
+    val["syn-cookie-threshold"] = m_synCookieThreshold;
+  }
+
+  if (m_synRateLimitIsSet) {
+    val["syn-rate-limit"] = m_synRateLimit;
+  }
+
+  if (m_admissionTimeoutIsSet) {
+    val["admission-timeout"] = m_admissionTimeout;
+  }
+
   if (m_statsIsSet) {
     val["stats"] = JsonObjectBase::toJson(m_stats);
   }
@@ -72,6 +116,74 @@ bool SynfloodJsonObject::nameIsSet() const {
 
 
 
+bool SynfloodJsonObject::getMitigation() const {
+  return m_mitigation;
+}
+
+void SynfloodJsonObject::setMitigation(bool value) {
+  m_mitigation = value;
+  m_mitigationIsSet = true;
+}
+
+bool SynfloodJsonObject::mitigationIsSet() const {
+  return m_mitigationIsSet;
+}
+
+void SynfloodJsonObject::unsetMitigation() {
+  m_mitigationIsSet = false;
+}
+
+uint32_t SynfloodJsonObject::getSynCookieThreshold() const {
+  return m_synCookieThreshold;
+}
+
+void SynfloodJsonObject::setSynCookieThreshold(uint32_t value) {
+  m_synCookieThreshold = value;
+  m_synCookieThresholdIsSet = true;
+}
+
+bool SynfloodJsonObject::synCookieThresholdIsSet() const {
+  return m_synCookieThresholdIsSet;
+}
+
+void SynfloodJsonObject::unsetSynCookieThreshold() {
+  m_synCookieThresholdIsSet = false;
+}
+
+uint32_t SynfloodJsonObject::getSynRateLimit() const {
+  return m_synRateLimit;
+}
+
+void SynfloodJsonObject::setSynRateLimit(uint32_t value) {
+  m_synRateLimit = value;
+  m_synRateLimitIsSet = true;
+}
+
+bool SynfloodJsonObject::synRateLimitIsSet() const {
+  return m_synRateLimitIsSet;
+}
+
+void SynfloodJsonObject::unsetSynRateLimit() {
+  m_synRateLimitIsSet = false;
+}
+
+uint32_t SynfloodJsonObject::getAdmissionTimeout() const {
+  return m_admissionTimeout;
+}
+
+void SynfloodJsonObject::setAdmissionTimeout(uint32_t value) {
+  m_admissionTimeout = value;
+  m_admissionTimeoutIsSet = true;
+}
+
+bool SynfloodJsonObject::admissionTimeoutIsSet() const {
+  return m_admissionTimeoutIsSet;
+}
+
+void SynfloodJsonObject::unsetAdmissionTimeout() {
+  m_admissionTimeoutIsSet = false;
+}
+
 StatsJsonObject SynfloodJsonObject::getStats() const {
   return m_stats;
 }
@@ -45,6 +45,38 @@ public:
   void setName(std::string value);
   bool nameIsSet() const;
 
+  /// <summary>
+  /// Verify the sources of the SYNs with SYN cookies before passing their SYNs to the host
+  /// </summary>
+  bool getMitigation() const;
+  void setMitigation(bool value);
+  bool mitigationIsSet() const;
+  void unsetMitigation();
+
+  /// <summary>
+  /// Rate of the SYNs received by the service above which the mitigation is active, 0 to always verify the sources
+  /// </summary>
+  uint32_t getSynCookieThreshold() const;
+  void setSynCookieThreshold(uint32_t value);
+  bool synCookieThresholdIsSet() const;
+  void unsetSynCookieThreshold();
+
+  /// <summary>
+  /// Maximum rate of the SYNs accepted from a single unverified source, 0 disables the limit
+  /// </summary>
+  uint32_t getSynRateLimit() const;
+  void setSynRateLimit(uint32_t value);
+  bool synRateLimitIsSet() const;
+  void unsetSynRateLimit();
+
+  /// <summary>
+  /// Time a verified source can open connections without being verified again, restarted by each SYN of the source
+  /// </summary>
+  uint32_t getAdmissionTimeout() const;
+  void setAdmissionTimeout(uint32_t value);
+  bool admissionTimeoutIsSet() const;
+  void unsetAdmissionTimeout();
+
   /// <summary>
   ///
   /// </summary>
@@ -56,6 +88,14 @@ public:
 private:
   std::string m_name;
   bool m_nameIsSet;
+  bool m_mitigation;
+  bool m_mitigationIsSet;
+  uint32_t m_synCookieThreshold;
+  bool m_synCookieThresholdIsSet;
+  uint32_t m_synRateLimit;
+  bool m_synRateLimitIsSet;
+  uint32_t m_admissionTimeout;
+  bool m_admissionTimeoutIsSet;
   StatsJsonObject m_stats;
   bool m_statsIsSet;
 };
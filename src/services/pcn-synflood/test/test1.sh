@@ -17,3 +17,15 @@ polycubectl sf stats tcpoutrsts show
 polycubectl sf stats deliverratio show
 polycubectl sf stats responseratio show
 polycubectl sf stats lastupdate show
+polycubectl sf stats synreceived show
+polycubectl sf stats synpassed show
+polycubectl sf stats syncookiessent show
+polycubectl sf stats syncookiesvalid show
+polycubectl sf stats synratelimited show
+polycubectl sf stats syndropped show
+
+polycubectl sf set syn-cookie-threshold=0
+polycubectl sf set syn-rate-limit=100
+polycubectl sf set admission-timeout=30
+polycubectl sf set mitigation=false
+polycubectl sf show
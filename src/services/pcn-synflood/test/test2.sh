@@ -0,0 +1,103 @@
+#!/bin/bash
+
+# Checks the verification of the sources with SYN cookies: the first
+# connection of a client is answered by the service and reset once its cookie
+# is validated, the following ones reach the server, also during a flood of
+# SYNs from spoofed sources. ACKs with an invalid cookie do not admit their
+# source.
+# It needs curl and hping3.
+
+function synfloodcleanup {
+  set +e
+  sudo pkill -SIGTERM hping3
+  kill $server_pid
+  polycubectl detach sf veth1
+  polycubectl synflood del sf
+  sudo ip link del veth1
+  sudo ip netns del ns1
+}
+trap synfloodcleanup EXIT
+
+function counter {
+  polycubectl sf stats $1 show
+}
+
+function connect {
+  sudo ip netns exec ns1 curl -s -o /dev/null --max-time 2 \
+    --interface $1 http://10.0.0.2:8080/
+}
+
+echo -e '\nTest 2 \n'
+set -e
+set -x
+
+#                      ns1
+#                  +-----------+
+# veth1 <----------|-> veth1_  |  10.0.0.1, 10.0.0.3
+#   ^              +-----------+
+#   |
+#   sf
+#   10.0.0.2 (server)
+
+sudo ip netns add ns1
+sudo ip link add veth1_ type veth peer name veth1
+sudo ip link set veth1_ netns ns1
+sudo ip netns exec ns1 ip link set dev veth1_ up
+sudo ip link set dev veth1 up
+sudo ip netns exec ns1 ip addr add 10.0.0.1/24 dev veth1_
+sudo ip netns exec ns1 ip addr add 10.0.0.3/24 dev veth1_
+sudo ip addr add 10.0.0.2/24 dev veth1
+
+python3 -m http.server 8080 --bind 10.0.0.2 > /dev/null 2>&1 &
+server_pid=$!
+sleep 1
+
+# the mitigation is disabled by default
+polycubectl synflood add sf
+polycubectl attach sf veth1
+connect 10.0.0.1
+test $(counter synpassed) -ge 1
+test $(counter syncookiessent) -eq 0
+
+polycubectl sf set mitigation=true
+polycubectl sf set syn-cookie-threshold=0
+passed=$(counter synpassed)
+
+# the first connection is reset once the cookie is validated
+if connect 10.0.0.1; then
+  exit 1
+fi
+test $(counter syncookiessent) -ge 1
+test $(counter syncookiesvalid) -ge 1
+test $(counter synpassed) -eq $passed
+
+# the source is admitted, its SYNs reach the server
+connect 10.0.0.1
+test $(counter synpassed) -gt $passed
+
+# an ACK with an invalid cookie does not admit its source
+valid=$(counter syncookiesvalid)
+sudo ip netns exec ns1 hping3 -c 1 -A -p 8080 -a 10.0.0.3 -M 12345 -L 54321 \
+  10.0.0.2 > /dev/null 2>&1 || true
+test $(counter syncookiesvalid) -eq $valid
+passed=$(counter synpassed)
+if connect 10.0.0.3; then
+  exit 1
+fi
+test $(counter synpassed) -eq $passed
+
+# a flood of SYNs from spoofed sources does not evict the admitted ones
+# (more than the unverified sources tracked by the datapath)
+sent=$(counter syncookiessent)
+sudo ip netns exec ns1 \
+  hping3 --flood --rand-source -S -p 8080 10.0.0.2 > /dev/null 2>&1 &
+for i in `seq 1 30`; do
+  sleep 1
+  if [ $(counter syncookiessent) -ge $((sent + 100000)) ]; then
+    break
+  fi
+done
+sudo pkill -SIGTERM hping3
+test $(counter syncookiessent) -ge $((sent + 100000))
+connect 10.0.0.1
+connect 10.0.0.3